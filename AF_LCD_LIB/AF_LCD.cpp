@@ -13,11 +13,35 @@
 #include "..\AF_UART_LIB\AF_string.h"
 #include "..\AF_UART_LIB\AF_size_t.h"
 #include "B_Roya24h.h"
+#include "..\AF_UART_LIB\AF_CPU.h"
+#include "..\AF_UART_LIB\AF_printf.h"
 
 static volatile unsigned short TextColor = White, BackColor = Black;
 
 	static u8 _curX;
 	static u16 _curY;
+
+	/* console mode: GRAM row of the top text line and text line of the cursor */
+	static u8  _conOn,_conLine,_conWrap;
+	static u16 _conTop;
+#define CON_LINES   (WIDTH/16)
+
+#ifdef AF_LCD_FB
+	/* band of AF_LCD_FB_LINES GRAM rows in AHB SRAM, _fb[y-_fbY0][x]         */
+	static u16 _fb[AF_LCD_FB_LINES][240] __attribute__ ((at(AF_LCD_FB_ADDR), zero_init));
+	static u16 _fbY0;
+	static u8  _fbOn;
+	static struct { u8 x0,x1; u16 y0,y1; } _fbDirty[AF_LCD_FB_RECTS];
+	static u8  _fbNDirty;
+
+	/* state of the window stream while it is routed through the band          */
+	static u16 *_sPtr;                          /* 0: current row goes to GRAM */
+	static u8  _sX0,_sW,_sCol;
+	static u16 _sRow,_sRows;                    /* current row, rows still to come */
+	static int _sStep;                          /* +1 top down, -1 bottom up       */
+	static u8  _sFb,_sGram;
+#endif
+	static u8  _sUp;                            /* GRAM entry mode flipped          */
 	
 	
 
@@ -72,18 +96,7 @@ void AF_LCD :: changeXY (void)
 
 static __inline unsigned char lcd_send (unsigned short byte) 
 {
-  u32 data ;
-  DATA_MSB_Nibble_GPIO->FIODIR |= (0xff<<LCD_MSB_Nibble_OFFSET);  
-	DATA_LSB_Nibble_GPIO->FIODIR |= (0xff<<LCD_LSB_Nibble_OFFSET); 
-  data = (byte>>8)&0xff;
-	DATA_MSB_Nibble_GPIO->FIOCLR |= (0xff<<LCD_MSB_Nibble_OFFSET);
-  DATA_MSB_Nibble_GPIO->FIOSET |= data<<LCD_MSB_Nibble_OFFSET;
-	wait();
-	data = byte & 0xff;
-	DATA_LSB_Nibble_GPIO->FIOCLR |= (0xff<<LCD_LSB_Nibble_OFFSET);
-	DATA_LSB_Nibble_GPIO->FIOSET |= data<<LCD_LSB_Nibble_OFFSET;
-  wait();
-
+  LCD_BUS::write(byte);
   return(1);
 }
 
@@ -94,16 +107,22 @@ static __inline unsigned char lcd_send (unsigned short byte)
 *   Return:                                                                    *
 *******************************************************************************/
 
+static u32 _rdWait = 0x1000;                   /* set from the core clock by Init */
+
+__inline void AF_LCD :: rd_wait (void) 
+{
+  u32 n = _rdWait;
+  while(n--);
+}
+
 __inline unsigned short AF_LCD :: lcd_read (void) 
 {
-  unsigned short id1,id2,id;
-  DATA_MSB_Nibble_GPIO->FIODIR &= (~(0xff<<LCD_MSB_Nibble_OFFSET));  
-	DATA_LSB_Nibble_GPIO->FIODIR &= (~(0xff<<LCD_LSB_Nibble_OFFSET));
-  delay(50);							      //delay some times ///////////////////////////////////////////////////////////////////////////////////////////////
-	id1=(DATA_MSB_Nibble_GPIO->FIOPIN >>LCD_MSB_Nibble_OFFSET)&0xFF;
-  id2=(DATA_LSB_Nibble_GPIO->FIOPIN >>LCD_LSB_Nibble_OFFSET)&0xFF;
-	id = id2|(id1<<8);
-  return(id); 
+  unsigned short val;
+  LCD_BUS::input();
+  rd_wait();								      /* tRD, see LCD_T_RD_NS             */
+  val = LCD_BUS::sample();
+  LCD_BUS::output();
+  return(val); 
 }
 
 /*******************************************************************************
@@ -239,15 +258,17 @@ unsigned short AF_LCD ::rd_reg  (unsigned short reg)
 
 void AF_LCD :: Init (void) 
 {
+  CPU cpu;
+
+  /* read wait: LCD_T_RD_NS in rd_wait loops at the real core clock          */
+  _rdWait = LCD_RD_WAIT_COUNT((u32)cpu.GetCpuClk());
+
   /* Configure the LCD Control pins */
-  DATA_MSB_Nibble_GPIO->FIODIR |= (0xFF<<LCD_MSB_Nibble_OFFSET);
-	DATA_LSB_Nibble_GPIO->FIODIR |= (0xFF<<LCD_LSB_Nibble_OFFSET);
-  CONTROL_GPIO_DIR |= PIN_CS | PIN_RS | PIN_WR | PIN_RD | PIN_RST;					
-  CONTROL_GPIO_SET  = PIN_CS | PIN_RS | PIN_WR | PIN_RD | PIN_RST;
+  LCD_BUS::init();
 	
-	CONTROL_GPIO_CLR |= PIN_RST;
+	LCD_RST(0)
   delay(5);                            				 	/* Delay 50 ms             		*/
-	CONTROL_GPIO_SET |= PIN_RST;
+	LCD_RST(1)
 	
   DeviceCode = rd_reg(0x00);
 
@@ -514,6 +535,14 @@ void AF_LCD :: Clear (unsigned short color)
   for(i = 0; i < (WIDTH*HEIGHT); i++)
     wr_dat_only(color);
   wr_dat_stop();
+#ifdef AF_LCD_FB
+	if(_fbOn)
+	{
+		u16 *p = &_fb[0][0];
+		for(i = 0; i < AF_LCD_FB_LINES*240; i++) *p++ = color;
+		_fbNDirty = 0;
+	}
+#endif
 }
 /*******************************************************************************
 * Draw a pixel in foreground color                                             *
@@ -649,26 +678,18 @@ void AF_LCD :: Bargraph (unsigned int x, unsigned int y, unsigned int w, unsigne
   int i,j;
 
   x = WIDTH-x-w;
-  wr_reg(0x50, y);                      /* Horizontal GRAM Start Address      */
-  wr_reg(0x51, y+CHAR_H-1);             /* Horizontal GRAM End   Address (-1) */
-  wr_reg(0x52, x);                      /* Vertical   GRAM Start Address      */
-  wr_reg(0x53, x+w-1);                  /* Vertical   GRAM End   Address (-1) */
-
   val = (val * w) >> 10;                /* Scale value for 24x12 characters   */
-  SetCursor(0,0);
-  LCD_CS(0)
-  wr_cmd(0x22);
-  wr_dat_start();
+  StreamBegin(y, x, CHAR_H, w);
   for (i = 0; i < h; i++) {
     for (j = w-1; j >= 0; j--) {
       if(j >= val) {
-        wr_dat_only(BackColor);
+        StreamPixel(BackColor);
       } else {
-        wr_dat_only(TextColor);
+        StreamPixel(TextColor);
       }
     }
   }
-  wr_dat_stop();
+  StreamEnd();
 }
 
 
@@ -747,6 +768,48 @@ void AF_LCD ::Bmp  (unsigned int x, unsigned int y, unsigned int w, unsigned int
   }
   wr_dat_stop();
 }
+/*******************************************************************************
+* Read a rectangle of GRAM back, row by row, with one 0x22 read sequence       *
+*   Parameter:      (x0 ,y0)  top left corner                                  *
+*                   (x1 ,y1)  bottom right corner                              *
+*                   buf:      (x1-x0+1)*(y1-y0+1) RGB565 pixels                *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void AF_LCD :: ReadRect (u8 x0,u16 y0,u8 x1,u16 y1,u16 *buf) 
+{
+  u32 n = (u32)(x1-x0+1)*(y1-y0+1);
+  u16 v;
+  int bgr = (DeviceCode==0x9325||DeviceCode==0x9328||DeviceCode==0x9320||DeviceCode==0x9300);
+
+#ifdef AF_LCD_FB
+  Flush();                                  /* GRAM has to be up to date       */
+#endif
+  wr_reg(R80, x0);
+  wr_reg(R81, x1);
+  wr_reg(R82, y0);
+  wr_reg(R83, y1);
+  SetCursor(x0,y0);
+  LCD_CS(0)
+  wr_cmd(0x22);
+  LCD_RS(1)
+  LCD_BUS::input();
+  LCD_RD(0)                                 /* dummy read                      */
+  rd_wait();
+  LCD_RD(1)
+  while (n--) {
+    LCD_RD(0)
+    rd_wait();
+    v = LCD_BUS::sample();
+    LCD_RD(1)
+    if (bgr)
+      v = (v << 11) | (v & 0x07E0) | (v >> 11);
+    *buf++ = v;
+  }
+  LCD_BUS::output();
+  LCD_CS(1)
+  WindowMax();
+}
 /******************************************************************************/
 
  
@@ -774,21 +837,10 @@ void AF_LCD :: Fill (u8 xsta,u16 ysta,u8 xend,u16 yend,u16 color)
 {                    
     u32 n;
 											
-	wr_reg(R80, xsta); 						
-	wr_reg(R81, xend); 							
-	wr_reg(R82, ysta); 						
-	wr_reg(R83, yend); 						
-	SetCursor(xsta,ysta);				
-  LCD_CS(0)	  
-	WriteRAM_Prepare();  					
-  wr_dat_start();	 	   	   
+	StreamBegin(xsta,ysta,xend-xsta+1,yend-ysta+1);
 	n=(u32)(yend-ysta+1)*(xend-xsta+1);    
-	while(n--){wr_dat_only(color);}			
-
-	wr_reg(R80, 0x0000); 						
-	wr_reg(R81, 0x00EF); 						
-	wr_reg(R82, 0x0000); 					
-	wr_reg(R83, 0x013F); 				
+	StreamRun(color,n);			
+	StreamEnd();
 } 
 /*
 *********************************************************************************************************
@@ -799,7 +851,14 @@ void AF_LCD :: Fill (u8 xsta,u16 ysta,u8 xend,u16 yend,u16 color)
 */
 void AF_LCD :: DrawPoint  (u16 x,u16 y ) 
 {
-
+#ifdef AF_LCD_FB
+	if(_fbOn && (u16)(y-_fbY0) < AF_LCD_FB_LINES)
+	{
+		FbMark(x,y,x,y);
+		Plot(x,y);
+		return;
+	}
+#endif
   WindowMax();
 
   SetCursor(x,y);
@@ -811,7 +870,54 @@ void AF_LCD :: DrawPoint  (u16 x,u16 y )
 }
 /*
 *********************************************************************************************************
-* Description: 	Draw lines 
+* Description: 	Horizontal span in TextColor, one windowed burst (clipped to the screen)
+* Arguments  : 	x0 ,x1   first and last column (any order)
+*				 y       row
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: HSpan (int x0,int x1,int y)
+{
+	int n,t;
+	u16 fg = TextColor;
+
+	if(x0>x1){t=x0;x0=x1;x1=t;}
+	if(y<0||y>319||x1<0||x0>239)return;
+	if(x0<0)x0=0;
+	if(x1>239)x1=239;
+	n=x1-x0+1;
+	if(n==1){DrawPoint(x0,y);return;}
+	StreamBegin(x0,y,n,1);
+	while(n--)StreamPixel(fg);
+	StreamEnd();
+}
+/*
+*********************************************************************************************************
+* Description: 	Vertical span in TextColor, one windowed burst (clipped to the screen)
+* Arguments  : 	x        column
+*				 y0 ,y1  first and last row (any order)
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: VSpan (int x,int y0,int y1)
+{
+	int n,t;
+	u16 fg = TextColor;
+
+	if(y0>y1){t=y0;y0=y1;y1=t;}
+	if(x<0||x>239||y1<0||y0>319)return;
+	if(y0<0)y0=0;
+	if(y1>319)y1=319;
+	n=y1-y0+1;
+	if(n==1){DrawPoint(x,y0);return;}
+	StreamBegin(x,y0,1,n);
+	while(n--)StreamPixel(fg);
+	StreamEnd();
+}
+/*
+*********************************************************************************************************
+* Description: 	Draw lines (Bresenham). Axis aligned lines are one span, other lines are
+*               cut into their horizontal (x major) or vertical (y major) runs
 * Arguments  : 	(x1 ,y1) start coordinate
 *				(x2 ,y2) end   coordinate
 * Returns    : 	None
@@ -819,57 +925,91 @@ void AF_LCD :: DrawPoint  (u16 x,u16 y )
 */ 
 void AF_LCD :: DrawLine(u16 x1, u16 y1, u16 x2, u16 y2)
 {
-	u16 t; 
-	int xerr=0,yerr=0,delta_x,delta_y,distance; 
-	int incx,incy,uRow,uCol; 
-
-	delta_x=x2-x1; 											
-	delta_y=y2-y1; 
-	uRow=x1; 
-	uCol=y1; 
-	if(delta_x>0)incx=1; 									
-	else if(delta_x==0)incx=0;								
-	else {incx=-1;delta_x=-delta_x;} 
-	if(delta_y>0)incy=1; 
-	else if(delta_y==0)incy=0;							
-	else{incy=-1;delta_y=-delta_y;} 
-	if( delta_x>delta_y)distance=delta_x; 					
-	else distance=delta_y; 
-	for(t=0;t<=distance+1;t++ )							
-	{  
-		DrawPoint(uRow,uCol);						
-		xerr+=delta_x ; 
-		yerr+=delta_y ; 
-		if(xerr>distance) 
-		{ 
-			xerr-=distance; 
-			uRow+=incx; 
-		} 
-		if(yerr>distance) 
-		{ 
-			yerr-=distance; 
-			uCol+=incy; 
-		} 
-	}  
+	int dx,dy,sx,sy,err;
+	int x=x1,y=y1,run=0;
+
+	if(y1==y2){HSpan(x1,x2,y1);return;}
+	if(x1==x2){VSpan(x1,y1,y2);return;}
+
+	dx=x2-x1; sx=1;
+	dy=y2-y1; sy=1;
+	if(dx<0){dx=-dx;sx=-1;}
+	if(dy<0){dy=-dy;sy=-1;}
+
+	if(dx>=dy)
+	{
+		err=dx>>1;
+		for(;;)
+		{
+			if(x==x2){HSpan(run,x,y);break;}
+			if(x==x1)run=x;
+			err-=dy;
+			if(err<0)
+			{
+				HSpan(run,x,y);
+				y+=sy; err+=dx; run=x+sx;
+			}
+			x+=sx;
+		}
+	}
+	else
+	{
+		err=dy>>1;
+		for(;;)
+		{
+			if(y==y2){VSpan(x,run,y);break;}
+			if(y==y1)run=y;
+			err-=dx;
+			if(err<0)
+			{
+				VSpan(x,run,y);
+				x+=sx; err+=dy; run=y+sy;
+			}
+			y+=sy;
+		}
+	}
 }   
 /*
 *********************************************************************************************************
-* Description: 	Draw rectanguar 
+* Description: 	Draw rectanguar, four spans
 * Arguments  : 	(x1 ,y1) (x2 ,y2) The diagonal Level vertical 
 * Returns    : 	None
 *********************************************************************************************************
 */ 
 void AF_LCD :: DrawRectangle (u8 x1, u16 y1, u8 x2, u16 y2)
 {
-	DrawLine(x1,y1,x2,y1);
-	DrawLine(x1,y1,x1,y2);
-	DrawLine(x1,y2,x2,y2);
-	DrawLine(x2,y1,x2,y2);
+	u16 t;
+	if(y1>y2){t=y1;y1=y2;y2=t;}
+	HSpan(x1,x2,y1);
+	if(y2==y1)return;
+	HSpan(x1,x2,y2);
+	if(y2-y1<2)return;
+	VSpan(x1,y1+1,y2-1);
+	if(x2!=x1)VSpan(x2,y1+1,y2-1);
+}
+/*
+*********************************************************************************************************
+* Description: 	Filled rectangle in TextColor
+* Arguments  : 	(x1 ,y1) (x2 ,y2) The diagonal corners (any order)
+* Returns    : 	None
+*********************************************************************************************************
+*/ 
+void AF_LCD :: FillRect (u8 x1, u16 y1, u8 x2, u16 y2)
+{
+	u8 tx; u16 ty;
+	if(x1>x2){tx=x1;x1=x2;x2=tx;}
+	if(y1>y2){ty=y1;y1=y2;y2=ty;}
+	if(x2>239)x2=239;
+	if(y2>319)y2=319;
+	if(x1>x2||y1>y2)return;
+	Fill(x1,y1,x2,y2,TextColor);
 }
 
 /*
 *********************************************************************************************************
-* Description: 	In designated areas within the specified circle 
+* Description: 	In designated areas within the specified circle (midpoint). For a fixed b
+*               the points (x0+-a ,y0+-b) are horizontal runs and (x0+-b ,y0+-a) vertical
+*               runs, every outline pixel is sent once
 * Arguments  : 	(x0 ,y0) center coordinate
 *				 r       radius coordinate
 * Returns    : 	None
@@ -877,31 +1017,137 @@ void AF_LCD :: DrawRectangle (u8 x1, u16 y1, u8 x2, u16 y2)
 */
 void AF_LCD :: Draw_Circle(u8 x0,u16 y0,u8 r)
 {
-	int a,b;
-	int di;
-	a=0;b=r;	  
-	di=3-(r<<1);             								
-	while(a<=b)
+	int a=0,b=r,as=0,av;
+	int di=3-(r<<1);
+	bool last;
+
+	for(;;)
 	{
-		DrawPoint(x0-b,y0-a);                 
-		DrawPoint(x0+b,y0-a);                    
-		DrawPoint(x0-a,y0+b);                
-		DrawPoint(x0-b,y0-a);                    
-		DrawPoint(x0-a,y0-b);                    
-		DrawPoint(x0+b,y0+a);                      
-		DrawPoint(x0+a,y0-b);          
-		DrawPoint(x0+a,y0+b);          
-		DrawPoint(x0-b,y0+a);             
+		last = (a+1>b-(di>=0));             /* next step ends the octant       */
+		if(di>=0||last)
+		{
+			/* run as..a at distance b                                           */
+			if(as==0)
+			{
+				HSpan(x0-a,x0+a,y0-b);
+				HSpan(x0-a,x0+a,y0+b);
+			}
+			else
+			{
+				HSpan(x0-a,x0-as,y0-b); HSpan(x0+as,x0+a,y0-b);
+				HSpan(x0-a,x0-as,y0+b); HSpan(x0+as,x0+a,y0+b);
+			}
+			av = (a<b) ? a : b-1;             /* (b ,b) is already on the H run  */
+			if(av>=as)
+			{
+				if(as==0)
+				{
+					VSpan(x0-b,y0-av,y0+av);
+					VSpan(x0+b,y0-av,y0+av);
+				}
+				else
+				{
+					VSpan(x0-b,y0-av,y0-as); VSpan(x0-b,y0+as,y0+av);
+					VSpan(x0+b,y0-av,y0-as); VSpan(x0+b,y0+as,y0+av);
+				}
+			}
+			as=a+1;
+		}
+		if(last)break;
+		if(di<0)di+=4*a+6;
+		else {di+=10+4*(a-b);b--;}
 		a++;
-		if(di<0)di +=4*a+6;	  
-		else
+	}
+} 
+/*
+*********************************************************************************************************
+* Description: 	Filled circle in TextColor, one span per row
+* Arguments  : 	(x0 ,y0) center coordinate
+*				 r       radius coordinate
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: FillCircle(u8 x0,u16 y0,u8 r)
+{
+	int a=0,b=r;
+	int di=3-(r<<1);
+
+	while(a<=b)
+	{
+		HSpan(x0-b,x0+b,y0+a);
+		if(a)HSpan(x0-b,x0+b,y0-a);
+		if(di>=0)
 		{
-			di+=10+4*(a-b);   
+			if(b!=a)
+			{
+				HSpan(x0-a,x0+a,y0+b);
+				HSpan(x0-a,x0+a,y0-b);
+			}
+			di+=10+4*(a-b);
 			b--;
-		} 
-		DrawPoint(x0+a,y0+b);
+		}
+		else di+=4*a+6;
+		a++;
 	}
-} 
+}
+/*
+*********************************************************************************************************
+* Description: 	Line of the given width. Axis aligned lines are a filled rectangle, other
+*               lines put a span of width pixels across the major axis at every step
+* Arguments  : 	(x1 ,y1) start coordinate
+*				(x2 ,y2) end   coordinate
+*				 width   line width in pixels
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: DrawThickLine(u16 x1, u16 y1, u16 x2, u16 y2, u8 width)
+{
+	int dx,dy,sx,sy,err,h;
+	int x=x1,y=y1;
+
+	if(width<=1){DrawLine(x1,y1,x2,y2);return;}
+	h=width>>1;
+	if(y1==y2)
+	{
+		FillRect(x1<x2?x1:x2, y1>h?y1-h:0, x1<x2?x2:x1, y1-h+width-1);
+		return;
+	}
+	if(x1==x2)
+	{
+		FillRect(x1>h?x1-h:0, y1<y2?y1:y2, x1-h+width-1, y1<y2?y2:y1);
+		return;
+	}
+
+	dx=x2-x1; sx=1;
+	dy=y2-y1; sy=1;
+	if(dx<0){dx=-dx;sx=-1;}
+	if(dy<0){dy=-dy;sy=-1;}
+
+	if(dx>=dy)
+	{
+		err=dx>>1;
+		for(;;)
+		{
+			VSpan(x,y-h,y-h+width-1);
+			if(x==x2)break;
+			err-=dy;
+			if(err<0){y+=sy;err+=dx;}
+			x+=sx;
+		}
+	}
+	else
+	{
+		err=dy>>1;
+		for(;;)
+		{
+			HSpan(x-h,x-h+width-1,y);
+			if(y==y2)break;
+			err-=dx;
+			if(err<0){x+=sx;err+=dy;}
+			y+=sy;
+		}
+	}
+}
 /*
 *********************************************************************************************************
 * Description: 	DrawPoint or white
@@ -923,189 +1169,667 @@ void AF_LCD :: DrawPoint1  (u16 x,u16 y ,u16 color)
 }
 /*
 *********************************************************************************************************
-* Description: 	In designated areas within the specified character 
-* Arguments  : 	(x0 ,y0) The coordinate
-*				 num     The value
-*				size     size (16 or 12)
-*               mode     superposition(1) or not 0
+* Description: 	Open a w*h window at (x ,y) and start a 0x22 data burst.
+*               The caller streams exactly w*h pixels with StreamPixel, row by row,
+*               and closes the burst with StreamEnd
+* Arguments  : 	(x ,y) The coordinate
+*				 w ,h    size of the window
 * Returns    : 	None
 *********************************************************************************************************
 */
-void AF_LCD :: ShowChar(char ch)
-{      
-	
-#define MAX_CHAR_POSX 232
-#define MAX_CHAR_POSY 304 
-    u8 temp;
-    u8 pos,t;      
-		u8 size=16;
-		u8 mode=0;
-		u8 x = _curX;
-		u16 y = _curY;
-	
-    if(_curX>MAX_CHAR_POSX||_curY>MAX_CHAR_POSY)return;	    
-											
-	wr_reg(R80,_curX);           							
-	wr_reg(R81,_curX+(size/2-1));							
-	wr_reg(R82,_curY);           							
-	wr_reg(R83,_curY+size-1);    							
-	SetCursor(_curX,_curY);            						
-	WriteRAM_Prepare();        						
-	ch=ch-' ';										
-	if(!mode) 											
-	{
-		for(pos=0;pos<size;pos++)
-		{
-			if(size==12)temp=asc2_1206[ch][pos];
-			else temp=asc2_1608[ch][pos];		 
-			for(t=0;t<size/2;t++)
-		    {                 
-		        if(temp&0x01)
-				{
-       				DrawPoint1(x+t,y+pos,TextColor);
-				}
-				else
-				{
-       				DrawPoint1(x+t,y+pos,BackColor);			
-				}
-		        temp>>=1; 
-		    }
-		}	
-	}else											
+void AF_LCD :: StreamBegin (u8 x,u16 y,u8 w,u16 h)
+{
+#ifdef AF_LCD_FB
+	_sFb = _fbOn && y < _fbY0+AF_LCD_FB_LINES && y+h > _fbY0;
+	if(_sFb)
 	{
-		for(pos=0;pos<size;pos++)
-		{
-			if(size==12)temp=asc2_1206[ch][pos];		
-			else temp=asc2_1608[ch][pos];		 		
-			for(t=0;t<size/2;t++)
-		    {                 
-		        if(temp&0x01)DrawPoint(x+t,y+pos);	
-		        temp>>=1; 
-		    }
-		}
-	}	    
-	
-	wr_reg(R80, 0x0000); 								
-	wr_reg(R81, 0x00EF); 								
-	wr_reg(R82, 0x0000); 					
-	wr_reg(R83, 0x013F); 				
-	changeXY();	
+		FbMark(x, y, x+w-1, y+h-1);
+		_sX0 = x; _sW = w;
+		_sRow = y-1; _sRows = h; _sStep = 1;
+		_sGram = 0;
+		FbNextRow();
+		return;
+	}
+#endif
+	wr_reg(R80,x);
+	wr_reg(R81,x+w-1);
+	wr_reg(R82,y);
+	wr_reg(R83,y+h-1);
+	SetCursor(x,y);
+  LCD_CS(0)
+	WriteRAM_Prepare();
+  wr_dat_start();
 }
-  
 /*
 *********************************************************************************************************
-* Description: 	m^n function
-* Arguments  : 	m n
+* Description: 	Like StreamBegin, but the rows come bottom row first (bottom up BMP). On GRAM
+*               the vertical address is set to count down, so it is still one window
+* Arguments  : 	(x ,y)   top left corner
+*               (w ,h)   size
 * Returns    : 	None
 *********************************************************************************************************
 */
-u32 AF_LCD :: mypow(u8 m,u8 n)
+void AF_LCD :: StreamBeginUp (u8 x,u16 y,u8 w,u16 h)
 {
-	u32 result=1;	 
-	while(n--)result*=m;    
-	return result;
-}	
-
-/*
-*********************************************************************************************************
-* Description: 	Show num (from 0 to 4294967295)
-* Arguments  : 	(x ,y) The coordinate
-*				 num     The value
-*				 len	 The number of num
-*				size     size (16 or 12)
-* Returns    : 	None
-*********************************************************************************************************
-*/	 
-void AF_LCD ::  ShowNum(u8 x,u16 y,u32 num,u8 len,u8 size)
-{         	
-	u8 t,temp;
-	u8 enshow=0;						   
-	for(t=0;t<len;t++)
+#ifdef AF_LCD_FB
+	_sFb = _fbOn && y < _fbY0+AF_LCD_FB_LINES && y+h > _fbY0;
+	if(_sFb)
 	{
-		temp=(num/mypow(10,len-t-1))%10;
-		if(enshow==0&&t<(len-1))
-		{
-			if(temp==0)
-			{
-			//	ShowChar(x+(size/2)*t,y,' ',size,1);
-				ShowChar(' ');
-				continue;
-			}else enshow=1; 
-		 	 
-		}
-	 	//ShowChar(x+(size/2)*t,y,temp+'0',size,0); 
-		ShowChar(temp+'0');
+		FbMark(x, y, x+w-1, y+h-1);
+		_sX0 = x; _sW = w;
+		_sRow = y+h; _sRows = h; _sStep = -1;
+		_sGram = 0;
+		FbNextRow();
+		return;
 	}
-} 
+#endif
+	EntryMode(1);
+	_sUp = 1;
+	wr_reg(R80,x);
+	wr_reg(R81,x+w-1);
+	wr_reg(R82,y);
+	wr_reg(R83,y+h-1);
+	SetCursor(x,y+h-1);
+  LCD_CS(0)
+	WriteRAM_Prepare();
+  wr_dat_start();
+}
 /*
 *********************************************************************************************************
-* Description: 	Show string (from 0 to 4294967295)
-* Arguments  : 	(x ,y) The coordinate
-*				 *p    The value
+* Description: 	GRAM address direction after each row, 0: down (normal), 1: up. The values
+*               are the entry modes of Init with only the vertical I/D bit changed
+* Arguments  : 	up
 * Returns    : 	None
 *********************************************************************************************************
-*/	
-void AF_LCD :: ShowString(char *p)
-{         
-    while(*p!='\0')
-    {    
-			  if(_curX>MAX_CHAR_POSX){_curX=0;_curY+=16;}
-        if(_curY>MAX_CHAR_POSY){_curY=_curX=0;Clear(BackColor );}
-				ShowChar(*p);
-        p++;
-    }  
+*/
+void AF_LCD :: EntryMode (int up)
+{
+	if(DeviceCode==0x8999)
+		wr_reg(0x11, up ? 0x6850 : 0x6870);
+	else if(DeviceCode==0x8989)
+		wr_reg(0x11, up ? 0x6050 : 0x6070);
+	else
+		wr_reg(0x03, up ? 0x1010 : 0x1030);
 }
 /*
 *********************************************************************************************************
-* Description: 	Show num (from 0 to 99)
-* Arguments  : 	(x ,y) The coordinate
-*				 num     The value
-*				 len	 The number of num
-*				size     size (16 or 12)
-*				mode     superposition(1) or not 0
+* Description: 	One pixel of the burst started by StreamBegin
+* Arguments  : 	color
 * Returns    : 	None
 *********************************************************************************************************
-*/	 
-void AF_LCD :: Show2Num(u8 x,u16 y,u16 num,u8 len,u8 size,u8 mode)
-{         	
-	u8 t,temp;						   
-	for(t=0;t<len;t++)
+*/
+__inline void AF_LCD :: StreamPixel (u16 color)
+{
+#ifdef AF_LCD_FB
+	if(_sFb)
 	{
-		temp=(num/mypow(10,len-t-1))%10;
-	 //	ShowChar(x+(size/2)*t,y,temp+'0',size,mode); 
-		ShowChar(temp+'0');
+		if(_sPtr) *_sPtr++ = color;
+		else      wr_dat_only(color);
+		if(++_sCol == _sW) FbNextRow();
+		return;
 	}
+#endif
+	wr_dat_only(color);
 }
 /*
 *********************************************************************************************************
-* Description: 	write picture 
-* Arguments  : 	(x0 ,y0) The start point
-*               image    pointer of image array
+* Description: 	n RGB565 pixels from memory into the burst started by StreamBegin
+* Arguments  : 	p        pixels
+*               n        number of pixels
 * Returns    : 	None
 *********************************************************************************************************
 */
-void AF_LCD :: write_pic(int x0, int y0 , const unsigned short *image){
-static unsigned int x,y;
-	for(y=y0;y<320 && y<image[1];y++) {
-		for (x=x0;x<240 && x<image[0];x++)	 {
-			SetTextColor(image[(y-y0)*240+(x-x0)+2]);
-			PutPixel(319-x,y);
-		}
-	}
+void AF_LCD :: StreamPixels (const u16 *p,u32 n)
+{
+	while(n--) StreamPixel(*p++);
 }
 /*
 *********************************************************************************************************
-* Description: 	write picture fast
-* Arguments  : 	image : pointer of image array
-*                
+* Description: 	n pixels of one color into the burst started by StreamBegin, on GRAM the
+*               data lines are set once and only WR is strobed
+* Arguments  : 	color
+*               n        number of pixels
 * Returns    : 	None
 *********************************************************************************************************
 */
-void AF_LCD :: write_pic_fast (const unsigned short *image) 
+void AF_LCD :: StreamRun (u16 color,u32 n)
 {
-  unsigned int   i;
-
-  WindowMax();
+#ifdef AF_LCD_FB
+	if(_sFb)
+	{
+		while(n--) StreamPixel(color);
+		return;
+	}
+#endif
+	if(!n) return;
+	lcd_send(color);
+	while(n--)
+	{
+		LCD_WR(0)
+		wait();
+		LCD_WR(1)
+	}
+}
+/*
+*********************************************************************************************************
+* Description: 	End the burst started by StreamBegin and restore the full screen window
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: StreamEnd (void)
+{
+#ifdef AF_LCD_FB
+	if(_sFb)
+	{
+		_sFb = 0;
+		if(!_sGram) return;
+	}
+	else
+#endif
+  wr_dat_stop();
+	if(_sUp) { EntryMode(0); _sUp = 0; }
+	wr_reg(R80, 0x0000);
+	wr_reg(R81, 0x00EF);
+	wr_reg(R82, 0x0000);
+	wr_reg(R83, 0x013F);
+}
+/*
+*********************************************************************************************************
+* Description: 	Set a pixel in TextColor, into the band when it is there, else on GRAM
+* Arguments  : 	(x ,y) The coordinate
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: Plot (u16 x,u16 y)
+{
+#ifdef AF_LCD_FB
+	if(_fbOn && (u16)(y-_fbY0) < AF_LCD_FB_LINES)
+	{
+		if(x < 240) _fb[y-_fbY0][x] = TextColor;
+		return;
+	}
+#endif
+	DrawPoint1(x,y,TextColor);
+}
+
+#ifdef AF_LCD_FB
+/*
+*********************************************************************************************************
+* Description: 	Move the band stream to its next row. Rows inside the band point into _fb,
+*               rows outside get a one row GRAM burst of their own
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: FbNextRow (void)
+{
+	if(!_sPtr && _sGram) wr_dat_stop();
+	_sCol = 0;
+	if(!_sRows) { _sPtr = 0; return; }
+	_sRows--;
+	_sRow += _sStep;
+	if((u16)(_sRow-_fbY0) < AF_LCD_FB_LINES)
+	{
+		_sPtr = &_fb[_sRow-_fbY0][_sX0];
+		return;
+	}
+	_sPtr = 0;
+	_sGram = 1;
+	wr_reg(R80,_sX0);
+	wr_reg(R81,_sX0+_sW-1);
+	wr_reg(R82,_sRow);
+	wr_reg(R83,_sRow);
+	SetCursor(_sX0,_sRow);
+  LCD_CS(0)
+	WriteRAM_Prepare();
+  wr_dat_start();
+}
+/*
+*********************************************************************************************************
+* Description: 	Add a rectangle (clipped to the band) to the dirty list. A rectangle that
+*               touches one in the list is merged into it, when the list is full it is
+*               merged into the one that grows the least
+* Arguments  : 	(x0 ,y0) (x1 ,y1) corners
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: FbMark (u8 x0,u16 y0,u8 x1,u16 y1)
+{
+	u8 i,best=0;
+	u32 area,grow,bestgrow=0xFFFFFFFF;
+	u8 ux0,ux1; u16 uy0,uy1;
+
+	if(y0 < _fbY0) y0 = _fbY0;
+	if(y1 > _fbY0+AF_LCD_FB_LINES-1) y1 = _fbY0+AF_LCD_FB_LINES-1;
+	if(y0 > y1 || x0 > x1) return;
+
+	for(i=0;i<_fbNDirty;i++)
+	{
+		ux0 = _fbDirty[i].x0 < x0 ? _fbDirty[i].x0 : x0;
+		ux1 = _fbDirty[i].x1 > x1 ? _fbDirty[i].x1 : x1;
+		uy0 = _fbDirty[i].y0 < y0 ? _fbDirty[i].y0 : y0;
+		uy1 = _fbDirty[i].y1 > y1 ? _fbDirty[i].y1 : y1;
+		if(x0 <= _fbDirty[i].x1+1 && _fbDirty[i].x0 <= x1+1 &&
+		   y0 <= _fbDirty[i].y1+1 && _fbDirty[i].y0 <= y1+1)
+		{
+			bestgrow = 0; best = i;
+			break;
+		}
+		area = (u32)(_fbDirty[i].x1-_fbDirty[i].x0+1)*(_fbDirty[i].y1-_fbDirty[i].y0+1);
+		grow = (u32)(ux1-ux0+1)*(uy1-uy0+1)-area;
+		if(grow < bestgrow) { bestgrow = grow; best = i; }
+	}
+	if(bestgrow && _fbNDirty < AF_LCD_FB_RECTS)
+	{
+		_fbDirty[_fbNDirty].x0 = x0; _fbDirty[_fbNDirty].x1 = x1;
+		_fbDirty[_fbNDirty].y0 = y0; _fbDirty[_fbNDirty].y1 = y1;
+		_fbNDirty++;
+		return;
+	}
+	if(x0 < _fbDirty[best].x0) _fbDirty[best].x0 = x0;
+	if(x1 > _fbDirty[best].x1) _fbDirty[best].x1 = x1;
+	if(y0 < _fbDirty[best].y0) _fbDirty[best].y0 = y0;
+	if(y1 > _fbDirty[best].y1) _fbDirty[best].y1 = y1;
+}
+/*
+*********************************************************************************************************
+* Description: 	Attach the band to GRAM rows y0 .. y0+AF_LCD_FB_LINES-1. The band is cleared
+*               to BackColor and marked dirty as a whole
+* Arguments  : 	y0       first row of the band
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: FbOpen (u16 y0)
+{
+	u32 i;
+	u16 *p = &_fb[0][0];
+	u16 bg = BackColor;
+
+	if(y0 > 320-AF_LCD_FB_LINES) y0 = 320-AF_LCD_FB_LINES;
+	_fbY0 = y0;
+	for(i=0;i<AF_LCD_FB_LINES*240;i++) *p++ = bg;
+	_fbNDirty = 0;
+	_fbOn = 1;
+	FbMark(0, y0, 239, y0+AF_LCD_FB_LINES-1);
+}
+/*
+*********************************************************************************************************
+* Description: 	Flush and detach the band, drawing goes straight to GRAM again
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: FbClose (void)
+{
+	Flush();
+	_fbOn = 0;
+}
+/*
+*********************************************************************************************************
+* Description: 	Push the dirty rectangles of the band to GRAM, one windowed burst each
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: Flush (void)
+{
+	u8 i,x,w;
+	u16 y;
+	const u16 *p;
+
+	if(!_fbOn) return;
+	_fbOn = 0;                                /* StreamBegin must go to GRAM */
+	for(i=0;i<_fbNDirty;i++)
+	{
+		w = _fbDirty[i].x1-_fbDirty[i].x0+1;
+		StreamBegin(_fbDirty[i].x0,_fbDirty[i].y0,w,_fbDirty[i].y1-_fbDirty[i].y0+1);
+		for(y=_fbDirty[i].y0;y<=_fbDirty[i].y1;y++)
+		{
+			p = &_fb[y-_fbY0][_fbDirty[i].x0];
+			for(x=0;x<w;x++) wr_dat_only(*p++);
+		}
+		StreamEnd();
+	}
+	_fbNDirty = 0;
+	_fbOn = 1;
+}
+#endif
+/*
+*********************************************************************************************************
+* Description: 	In designated areas within the specified character 
+* Arguments  : 	(x0 ,y0) The coordinate
+*				 num     The value
+*				size     size (16 or 12)
+*               mode     superposition(1) or not 0
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ShowChar(char ch)
+{      
+	
+#define MAX_CHAR_POSX 232
+#define MAX_CHAR_POSY 304 
+    u8 temp;
+    u8 pos,t;
+		u16 fg = TextColor;
+		u16 bg = BackColor;
+	
+    if(_curX>MAX_CHAR_POSX||_curY>MAX_CHAR_POSY)return;	    
+											
+	ch=ch-' ';										
+	StreamBegin(_curX,_curY,8,16);
+	for(pos=0;pos<16;pos++)
+	{
+		temp=asc2_1608[ch][pos];		 
+		for(t=0;t<8;t++)
+	    {                 
+				StreamPixel((temp&0x01) ? fg : bg);
+	        temp>>=1; 
+	    }
+	}	
+	StreamEnd();
+	changeXY();	
+}
+
+#ifdef AF_LCD_BENCH
+/*
+*********************************************************************************************************
+* Description: 	Old ShowChar, one DrawPoint1 per pixel (kept only as BenchText reference)
+* Arguments  : 	ch       character
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ShowCharPixel(char ch)
+{
+    u8 temp;
+    u8 pos,t;
+		u8 x = _curX;
+		u16 y = _curY;
+
+    if(_curX>MAX_CHAR_POSX||_curY>MAX_CHAR_POSY)return;
+
+	ch=ch-' ';
+	for(pos=0;pos<16;pos++)
+	{
+		temp=asc2_1608[ch][pos];
+		for(t=0;t<8;t++)
+	    {
+	        if(temp&0x01)
+       				DrawPoint1(x+t,y+pos,TextColor);
+				else
+       				DrawPoint1(x+t,y+pos,BackColor);
+	        temp>>=1;
+	    }
+	}
+	changeXY();
+}
+
+#define DWT_CTRL      (*((volatile unsigned long *) 0xE0001000))
+#define DWT_CYCCNT    (*((volatile unsigned long *) 0xE0001004))
+#define DEMCR         (*((volatile unsigned long *) 0xE000EDFC))
+#define BENCH_CHARS   240                   /* one screen of 8x16 text (30x8)  */
+
+/*
+*********************************************************************************************************
+* Description: 	Draw BENCH_CHARS characters with the per-pixel and the glyph blit path
+*               and print characters per second of both on the screen
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: BenchText(void)
+{
+	CPU cpu;
+	u32 cclk = cpu.GetCpuClk();
+	u32 t0,before,after;
+	int i;
+
+	DEMCR |= (1<<24);                         /* TRCENA                          */
+	DWT_CTRL |= 1;                            /* CYCCNTENA                       */
+
+	_curX=0;_curY=0;
+	t0 = DWT_CYCCNT;
+	for(i=0;i<BENCH_CHARS;i++)
+		ShowCharPixel(' '+(i%95));
+	before = DWT_CYCCNT-t0;
+
+	_curX=0;_curY=0;
+	t0 = DWT_CYCCNT;
+	for(i=0;i<BENCH_CHARS;i++)
+		ShowChar(' '+(i%95));
+	after = DWT_CYCCNT-t0;
+
+	_curX=0;_curY=MAX_CHAR_POSY-16;
+	printf("pixel %d c/s  blit %d c/s",
+		(int)((u64)BENCH_CHARS*cclk/before),(int)((u64)BENCH_CHARS*cclk/after));
+}
+#endif
+  
+/*
+*********************************************************************************************************
+* Description: 	m^n function
+* Arguments  : 	m n
+* Returns    : 	None
+*********************************************************************************************************
+*/
+u32 AF_LCD :: mypow(u8 m,u8 n)
+{
+	u32 result=1;	 
+	while(n--)result*=m;    
+	return result;
+}	
+
+/*
+*********************************************************************************************************
+* Description: 	Show num (from 0 to 4294967295)
+* Arguments  : 	(x ,y) The coordinate
+*				 num     The value
+*				 len	 The number of num
+*				size     size (16 or 12)
+* Returns    : 	None
+*********************************************************************************************************
+*/	 
+void AF_LCD ::  ShowNum(u8 x,u16 y,u32 num,u8 len,u8 size)
+{         	
+	u8 t,temp;
+	u8 enshow=0;						   
+	for(t=0;t<len;t++)
+	{
+		temp=(num/mypow(10,len-t-1))%10;
+		if(enshow==0&&t<(len-1))
+		{
+			if(temp==0)
+			{
+			//	ShowChar(x+(size/2)*t,y,' ',size,1);
+				ShowChar(' ');
+				continue;
+			}else enshow=1; 
+		 	 
+		}
+	 	//ShowChar(x+(size/2)*t,y,temp+'0',size,0); 
+		ShowChar(temp+'0');
+	}
+} 
+/*
+*********************************************************************************************************
+* Description: 	Show string (from 0 to 4294967295)
+* Arguments  : 	(x ,y) The coordinate
+*				 *p    The value
+* Returns    : 	None
+*********************************************************************************************************
+*/	
+void AF_LCD :: ShowString(char *p)
+{         
+    while(*p!='\0')
+    {    
+				PutChar(*p);
+        p++;
+    }  
+}
+/*
+*********************************************************************************************************
+* Description: 	Show one character at the text cursor, wrap at the end of the line and
+*               clear the screen at the end of the page, '\n' starts a new line
+* Arguments  : 	ch       character
+* Returns    : 	None
+*********************************************************************************************************
+*/	
+void AF_LCD :: PutChar(char ch)
+{
+		u16 y;
+
+		if(_conOn)
+		{
+			if(_conWrap || ch=='\n') ConsoleNewLine();
+			if(ch=='\n') return;
+			y=_curY;
+			ShowChar(ch);
+			if(_curX==0){_curY=y;_conWrap=1;}	/* line full, new line with the next char */
+			return;
+		}
+		if(ch=='\n'){_curX=0;_curY+=16;return;}
+	  if(_curX>MAX_CHAR_POSX){_curX=0;_curY+=16;}
+    if(_curY>MAX_CHAR_POSY){_curY=_curX=0;Clear(BackColor );}
+		ShowChar(ch);
+}
+/*
+*********************************************************************************************************
+* Description: 	Start the text console: PutChar / printf / ShowString go down the screen line
+*               by line, at the bottom the screen is moved up one text line with the vertical
+*               scroll of the controller and only the new line is cleared
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ConsoleBegin (void)
+{
+	ScrollTo(0);
+	Clear(BackColor);
+	_conTop = 0;
+	_conLine = 0;
+	_conWrap = 0;
+	_curX = 0;
+	_curY = 0;
+	_conOn = 1;
+}
+/*
+*********************************************************************************************************
+* Description: 	Stop the text console, the scroll is set back to 0 and the screen is cleared
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ConsoleEnd (void)
+{
+	_conOn = 0;
+	ScrollTo(0);
+	Clear(BackColor);
+	_curX = 0;
+	_curY = 0;
+}
+/*
+*********************************************************************************************************
+* Description: 	Console new line. GRAM rows are a ring: text line n is at GRAM row
+*               _conTop+16*n (mod 320), after the last line the top line is cleared and
+*               becomes the new bottom line by moving the scroll start down 16 rows
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ConsoleNewLine (void)
+{
+	_conWrap = 0;
+	_curX = 0;
+	if(_conLine < CON_LINES-1)
+		_conLine++;
+	else
+	{
+		Fill(0,_conTop,HEIGHT-1,_conTop+15,BackColor);
+		_conTop = (_conTop+16) % WIDTH;
+		ScrollTo(_conTop);
+	}
+	_curY = (_conTop+16*_conLine) % WIDTH;
+}
+/*
+*********************************************************************************************************
+* Description: 	Vertical scroll: the display starts at GRAM row vl (ILI932x R61 VLE + R6A,
+*               SSD1289 / SSD1298 R07 VLE1 + R41)
+* Arguments  : 	vl       GRAM row shown on the top of the display (0 .. 319)
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: ScrollTo (u16 vl)
+{
+	if(DeviceCode==0x8999||DeviceCode==0x8989)
+	{
+		wr_reg(0x41, vl);
+		wr_reg(0x07, vl ? 0x0233 : 0x0033);
+	}
+	else
+	{
+		wr_reg(0x6A, vl);
+		wr_reg(0x61, vl ? 0x0003 : 0x0001);
+	}
+}
+/*
+*********************************************************************************************************
+* Description: 	Show num (from 0 to 99)
+* Arguments  : 	(x ,y) The coordinate
+*				 num     The value
+*				 len	 The number of num
+*				size     size (16 or 12)
+*				mode     superposition(1) or not 0
+* Returns    : 	None
+*********************************************************************************************************
+*/	 
+void AF_LCD :: Show2Num(u8 x,u16 y,u16 num,u8 len,u8 size,u8 mode)
+{         	
+	u8 t,temp;						   
+	for(t=0;t<len;t++)
+	{
+		temp=(num/mypow(10,len-t-1))%10;
+	 //	ShowChar(x+(size/2)*t,y,temp+'0',size,mode); 
+		ShowChar(temp+'0');
+	}
+}
+/*
+*********************************************************************************************************
+* Description: 	write picture 
+* Arguments  : 	(x0 ,y0) The start point
+*               image    pointer of image array
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: write_pic(int x0, int y0 , const unsigned short *image){
+	u32 x,y,w,h;
+
+	if(image[0]==AF_IMG_RLE) {DrawImageRle(x0,y0,image); return;}
+	if(x0<0 || y0<0 || x0>=HEIGHT || y0>=WIDTH) return;
+	w = HEIGHT-x0 < image[0] ? HEIGHT-x0 : image[0];
+	h = WIDTH-y0  < image[1] ? WIDTH-y0  : image[1];
+	StreamBegin(x0,y0,w,h);
+	for(y=0;y<h;y++) {
+		for (x=0;x<w;x++)	 {
+			StreamPixel(image[y*image[0]+x+2]);
+		}
+	}
+	StreamEnd();
+}
+/*
+*********************************************************************************************************
+* Description: 	write picture fast
+* Arguments  : 	image : pointer of image array
+*                
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_LCD :: write_pic_fast (const unsigned short *image) 
+{
+  unsigned int   i;
+
+  if(image[0]==AF_IMG_RLE) {DrawImageRle(0,0,image); return;}
+  WindowMax();
   SetCursor(0,0);
   LCD_CS(0)			  
   wr_cmd(0x22);
@@ -1117,78 +1841,96 @@ void AF_LCD :: write_pic_fast (const unsigned short *image)
 
 
 
-int AF_LCD :: printf (const char* str, ...) {
-
-	if (!str)
-		return 0;
-
-	va_list		args;
-	va_start(args, str);
-	size_t i;
-	for (i = 0; i<strlen(str); i++) {
-
-		switch (str[i]) {
-
-		case '%':
-
-			switch (str[i + 1]) {
+/*
+*********************************************************************************************************
+* Description: 	Draw a compressed image (AF_IMG_RLE, see AF_imgconv.c) through one GRAM window,
+*               packets are decoded straight into the stream, runs go out as StreamRun.
+*               The part outside of the screen is decoded but not sent.
+* Arguments  : 	(x0,y0)  top left corner
+*               image    AF_IMG_RLE, width, height, packets
+* Returns    : 	None
+*********************************************************************************************************
+*/
+#define RLE_PUT(px)		{ if(col<cw) StreamPixel(px); if(++col==w) col=0; }
 
-				/*** characters ***/
-			case 'c': {
-				char c = va_arg(args, char);
-				ShowChar(c);
-				i++;		// go to next character
-				break;
-			}
+void AF_LCD :: DrawImageRle (int x0,int y0,const unsigned short *image)
+{
+	const unsigned short *p = image+3;
+	u32 w = image[1], h = image[2];
+	u32 cw, ch, left, n, k, i;
+	u32 col = 0;
+	u16 t, c = 0;
+	u8  d;
+
+	if(x0<0 || y0<0 || x0>=HEIGHT || y0>=WIDTH) return;
+	cw = HEIGHT-x0 < w ? HEIGHT-x0 : w;
+	ch = WIDTH-y0  < h ? WIDTH-y0  : h;
+	StreamBegin(x0,y0,cw,ch);
+
+	left = ch*w;                                /* rows below the screen are not decoded */
+	while(left)
+	{
+		t = *p++;
+		n = ((t & 0x8000) ? (t & 0x3FFF) : t) + 1;
+		if(n > left) n = left;
+		left -= n;
 
-					  /*** address of ***/
-			case 's': {
-				int c = (int&)va_arg(args, char);
-				char str[64];
-				strcpy(str, (const char*)c);
-				ShowString(str);
-				i++;		// go to next character
-				break;
+		if(!(t & 0x8000))                         /* literal pixels                        */
+		{
+			for(; n; n--) { c = *p++; RLE_PUT(c) }
+		}
+		else if(!(t & 0x4000))                    /* run, whole row pieces at a time       */
+		{
+			c = *p++;
+			while(n)
+			{
+				k = w-col < n ? w-col : n;
+				if(col < cw) StreamRun(c, cw-col < k ? cw-col : k);
+				col += k;
+				if(col == w) col = 0;
+				n -= k;
 			}
-
-					  /*** integers ***/
-			case 'd':
-			case 'i': {
-						int c = va_arg (args, int);
-						char str[32]={0};
-						itoa_s (c, 10, str);
-				ShowString(str);
-				i++;		// go to next character
-				break;
+		}
+		else                                      /* deltas to the pixel before, 2 a word  */
+		{
+			for(i = 0; i < n; i++)
+			{
+				d = (i & 1) ? (u8)*p++ : (u8)(*p >> 8);
+				c += ((d>>6)-2)*2048 + (((d>>3)&7)-4)*32 + (d&7)-4;
+				RLE_PUT(c)
 			}
+			if(n & 1) p++;
+		}
+	}
+	StreamEnd();
+}
+#undef RLE_PUT
 
-					  /*** display in hex ***/
-			case 'X':
-			case 'x': {
-					int c = va_arg (args, int);
-					char str[32]={0};
-					itoa_s (c, 16, str);
-				ShowString(str);
-				i++;		// go to next character
-				break;
-			}
 
-			default:
-				va_end(args);
-				return 1;
-			}
 
-			break;
+/*
+*********************************************************************************************************
+* Description: 	printf to the screen at the text cursor (see AF_printf.h for the format)
+* Arguments  : 	str      format
+* Returns    : 	number of characters written
+*********************************************************************************************************
+*/
+struct AF_LCD_Sink {
+	AF_LCD *lcd;
+	void put (char c) { lcd->PutChar(c); }
+};
 
-		default:
-			ShowChar(str[i]);
-			break;
-		}
+int AF_LCD :: printf (const char* str, ...) {
 
-	}
+	if (!str)
+		return 0;
 
+	va_list		args;
+	va_start(args, str);
+	AF_LCD_Sink sink = { this };
+	int n = AF_vprintf(sink, str, args);
 	va_end(args);
-	return i;
+	return n;
 }
 
 
@@ -1212,59 +1954,76 @@ void AF_FLCD :: changeXY (void)
 }
 
 
-void AF_FLCD :: ShowCharF (u16 ch,u16 offset , u8 width)
+/*------------------------------------------------------------------------------
+  Glyph cache: font24h_data_table is column packed (3 bytes per column, LSB on
+  top) and GRAM is filled row by row, so a glyph is unpacked once into 24 row
+  masks (bit t = column t) and kept in an LRU cache of AF_FLCD_GLYPH_CACHE
+  glyphs. A cached glyph is blitted as runs of equal pixels.
+ *----------------------------------------------------------------------------*/
+
+static struct {
+	u16 g;                                      /* glyph index                     */
+	u8  w;                                      /* width                           */
+	u32 used;                                   /* 0: free                         */
+	u32 rows[24];
+} _gc[AF_FLCD_GLYPH_CACHE];
+static u32 _gcTick,_gcHits,_gcMiss;
+
+static void GlyphUnpack (u16 offset,u8 width,u32 *rows)
+{
+	const u8 *col = &font24h_data_table[offset];
+	u32 bits;
+	u8 t,row;
+
+	for(row=0;row<24;row++) rows[row]=0;
+	for(t=0;t<width;t++,col+=3)
+	{
+		bits = col[0] | (col[1]<<8) | ((u32)col[2]<<16);
+		for(row=0;bits;row++,bits>>=1)
+			if(bits&1) rows[row] |= 1ul<<t;
+	}
+}
+
+/*
+*********************************************************************************************************
+* Description: 	Draw 24 row masks at the text cursor (right to left), wrap and clear like
+*               the old ShowCharF
+* Arguments  : 	rows     24 row masks, bit t = column t
+*               width    glyph width
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_FLCD :: BlitGlyph (const u32 *rows,u8 width)
 {
 	start:
 #define MAX_CHAR_POSX_F 240
 #define MAX_CHAR_POSY_F 320 
-    u8 temp;     
+		u16 fg = TextColor;
+		u16 bg = BackColor;
 		u8 _chX = 240-_curX;
+		u8 t,e,row;
+		u32 m,v;
 		_chX-=width;
 	
     if(_chX<0||_chX>MAX_CHAR_POSX_F||_curY>MAX_CHAR_POSY_F){
 				_curY+=24;
 				_curX=0;
-				//isStick=false;
 				goto start;	
 		}			
 		
-
-	wr_reg(R80,_chX);           							
-	wr_reg(R81,_chX+(24/2-1));							
-	wr_reg(R82,_curY);           							
-	wr_reg(R83,_curY+24-1);    							
-	SetCursor(_chX,_curY);            						
-	WriteRAM_Prepare();        						
-	
-
-	
-
-			
-		for(u8 pos=0;pos<width*3;pos+=3)
+	StreamBegin(_chX,_curY,width,24);
+		for(row=0;row<24;row++)
 		{
-			for (u8 i=0;i<3;i++){
-			temp=font24h_data_table[offset+pos+i]; 
-			for(u8 t=0;t<8;t++)
-		    {                 
-		       
-				 if(temp&0x01)
-       				DrawPoint1(_chX+(pos/3),_curY+t+(8*i),TextColor);
-				   else
-							DrawPoint1(_chX+(pos/3),_curY+t+(8*i),BackColor);
-
-		        temp>>=1; 
-					 
-		    }
+			m = rows[row];
+			for(t=0;t<width;t=e)
+			{
+				v = (m>>t)&1;
+				for(e=t+1;e<width && ((m>>e)&1)==v;e++);
+				StreamRun(v ? fg : bg, e-t);
 			}
 		}	
+	StreamEnd();
 	
-	
-	wr_reg(R80, 0x0000); 								
-	wr_reg(R81, 0x00EF); 								
-	wr_reg(R82, 0x0000); 					
-	wr_reg(R83, 0x013F); 				
-	
-//	printf("%x - %x | ",index,ch);
 		_curX+=width;
 	if(_curX>=240){
 		_curY+=24;
@@ -1274,110 +2033,390 @@ void AF_FLCD :: ShowCharF (u16 ch,u16 offset , u8 width)
 
 }
 
+/*
+*********************************************************************************************************
+* Description: 	Draw a glyph from its data (not cached)
+* Arguments  : 	ch       code (not used)
+*               offset   font24h_data_table offset
+*               width    glyph width
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_FLCD :: ShowCharF (u16 ch,u16 offset , u8 width)
+{
+	u32 rows[24];
 
+	GlyphUnpack(offset,width,rows);
+	BlitGlyph(rows,width);
+}
 
 /*
 *********************************************************************************************************
-* Description: 	Show string (from 0 to 4294967295)
-* Arguments  : 	(x ,y) The coordinate
-*				 *p    The value
+* Description: 	Draw glyph g of font24h through the glyph cache
+* Arguments  : 	g        glyph index (GetExtendedIndex)
 * Returns    : 	None
 *********************************************************************************************************
-*/	
-static u8 irecycle=0;
-u8 AF_FLCD :: recycle (char *ch)
+*/
+void AF_FLCD :: ShowGlyph (u16 g)
 {
-	ch++;
-	irecycle++;
-	if (*ch< 0x7f)
-		recycle(ch);
-	ch--;
-	u16 charc=*ch;
-	u16 index = GetExtendedIndex(charc,&font24h);
-	uint16_t offset= font24h_offset_table[index];
-	uint8_t width = font24h_width_table[index];	
-	ShowCharF(charc,offset,width);
-	return irecycle;
+	u8 i,lru=0;
+
+	_gcTick++;
+	for(i=0;i<AF_FLCD_GLYPH_CACHE;i++)
+	{
+		if(_gc[i].used && _gc[i].g == g)
+		{
+			_gcHits++;
+			_gc[i].used = _gcTick;
+			BlitGlyph(_gc[i].rows,_gc[i].w);
+			return;
+		}
+		if(_gc[i].used < _gc[lru].used) lru = i;
+	}
+
+	_gcMiss++;
+	_gc[lru].g    = g;
+	_gc[lru].w    = font24h_width_table[g];
+	_gc[lru].used = _gcTick;
+	GlyphUnpack(font24h_offset_table[g],_gc[lru].w,_gc[lru].rows);
+	BlitGlyph(_gc[lru].rows,_gc[lru].w);
 }
 
+/*
+*********************************************************************************************************
+* Description: 	Glyph cache hits and misses since the last reset
+* Arguments  : 	hits, misses   out, may be 0
+*               reset          set the counters to 0 after reading them
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_FLCD :: GlyphCacheStats (u32 *hits,u32 *misses,int reset)
+{
+	if(hits)   *hits   = _gcHits;
+	if(misses) *misses = _gcMiss;
+	if(reset)  _gcHits = _gcMiss = 0;
+}
 
-void AF_FLCD :: ShowString(char *p)
-{     
-		static bool isStick=false;
-    while(*p!='\0')
-    {  		
-			start:
-			if (*p == '\n')
+
+
+/*------------------------------------------------------------------------------
+  Persian text: shaping and bidi are done once per paragraph into a run of
+  glyph indices in drawing order (right to left), the run is kept in a small
+  LRU cache keyed by a hash of the UTF-8 bytes, so a label that is drawn
+  again only costs the blit.
+
+  - joining forms come from font24h_arabic2_table (isolated presentation form
+    of a letter, +1 final, +2 initial, +3 medial)
+  - lam + alef is one ligature (0xFEF5 .. 0xFEFB)
+  - the paragraph is right to left, runs of latin letters and digits (with
+    the spaces / punctuation between them) are left to right, brackets in
+    right to left text are mirrored
+ *----------------------------------------------------------------------------*/
+
+enum { BIDI_R, BIDI_L, BIDI_N };
+
+static u16 _shCp[AF_FLCD_PARA_MAX];             /* code points, then glyph indices */
+static u8  _shCls[AF_FLCD_PARA_MAX];
+
+static struct {
+	u32 hash;
+	u16 len,n;
+	u32 used;
+	u16 g[AF_FLCD_RUN_MAX];
+	char s[AF_FLCD_RUN_BYTES];                  /* text, compared on a hash hit    */
+} _run[AF_FLCD_CACHE_RUNS];
+static u32 _runTick;
+
+/* isolated presentation form of an arabic letter, 0 if it has no forms      */
+static u16 ArForm (u16 c)
+{
+	u16 f;
+
+	if(c < 0x600 || c > 0x6FF) return 0;
+	f = font24h_arabic2_table[GetExtendedIndex(c,&font24h)];
+	return f >= 0xFB50 ? f : 0;
+}
+
+/* 0 does not join, 1 joins to the letter before only, 2 joins both sides   */
+static u8 ArJoin (u16 c)
+{
+	if(c == 0x640) return 2;                    /* tatweel                         */
+	if(!ArForm(c)) return 0;
+	switch(c)
+	{
+		case 0x622: case 0x623: case 0x624: case 0x625: case 0x627: case 0x629:
+		case 0x62F: case 0x630: case 0x631: case 0x632: case 0x648: case 0x698:
+		case 0x6C0:
+			return 1;
+	}
+	return 2;
+}
+
+static u8 ArMark (u16 c) { return c >= 0x64B && c <= 0x652; }
+
+static u8 BidiClass (u16 c)
+{
+	if((c >= '0' && c <= '9') || ((c|0x20) >= 'a' && (c|0x20) <= 'z') ||
+	   (c >= 0xC0 && c <= 0x24F && c != 0xD7 && c != 0xF7) ||
+	   (c >= 0x660 && c <= 0x669) || (c >= 0x6F0 && c <= 0x6F9))
+		return BIDI_L;
+	if((c >= 0x600 && c <= 0x6FF) || c >= 0xFB50)
+		return BIDI_R;
+	return BIDI_N;
+}
+
+static u16 Mirror (u16 c)
+{
+	switch(c)
+	{
+		case '(': return ')';  case ')': return '(';
+		case '[': return ']';  case ']': return '[';
+		case '{': return '}';  case '}': return '{';
+		case '<': return '>';  case '>': return '<';
+	}
+	return c;
+}
+
+/*
+*********************************************************************************************************
+* Description: 	Shape one paragraph (no line breaks) into glyph indices in drawing order
+* Arguments  : 	s        UTF-8 text
+*               len      bytes, at most AF_FLCD_PARA_MAX characters (ShowString splits longer
+*                        lines with ParaEnd)
+* Returns    : 	number of glyphs in _shCp
+*********************************************************************************************************
+*/
+static u16 Shape (const char *s,u16 len)
+{
+	const u8 *p = (const u8 *)s, *e = p+len;
+	u16 n = 0, o = 0, i, j, k, c, f, t;
+	u8  stick = 0, prev;
+
+	/*** UTF-8 -> code points ***/
+	while(p < e && n < AF_FLCD_PARA_MAX)
+	{
+		c = *p++;
+		if(c >= 0xE0 && e-p >= 2)      { c = ((c&0x0F)<<12) | ((p[0]&0x3F)<<6) | (p[1]&0x3F); p += 2; }
+		else if(c >= 0xC0 && e-p >= 1) { c = ((c&0x1F)<<6)  |  (p[0]&0x3F);                   p += 1; }
+		if(c == 0x200C) { _shCp[n++] = 0; continue; }   /* ZWNJ: breaks joining, not drawn */
+		_shCp[n++] = c;
+	}
+
+	/*** joining forms, in place (o <= i) ***/
+	for(i = 0; i < n; i++)
+	{
+		c = _shCp[i];
+		if(ArMark(c)) { _shCp[o] = c; _shCls[o++] = BIDI_R; continue; }
+		if(!c)        { stick = 0; continue; }
+
+		for(j = i+1; j < n && ArMark(_shCp[j]); j++);           /* next letter         */
+		if(c == 0x644 && j < n && (_shCp[j] == 0x622 || _shCp[j] == 0x623 ||
+		                           _shCp[j] == 0x625 || _shCp[j] == 0x627))
+		{
+			t = _shCp[j];
+			_shCp[o] = (t == 0x622 ? 0xFEF5 : t == 0x623 ? 0xFEF7 : t == 0x625 ? 0xFEF9 : 0xFEFB) + stick;
+			_shCls[o++] = BIDI_R;
+			for(k = i+1; k < j; k++) { _shCp[o] = _shCp[k]; _shCls[o++] = BIDI_R; }
+			i = j;
+			stick = 0;
+			continue;
+		}
+
+		f = ArForm(c);
+		prev = stick;
+		stick = ArJoin(c) == 2;
+		if(f)
+		{
+			c = f + prev;
+			if(stick && j < n && ArJoin(_shCp[j])) c += 2;
+		}
+		_shCp[o] = c;
+		_shCls[o++] = BidiClass(c);
+	}
+	n = o;
+
+	/*** neutrals between two left to right characters are left to right ***/
+	for(i = 0; i < n; i = j)
+	{
+		for(j = i; j < n && _shCls[j] == BIDI_N; j++);
+		if(j == i) { j++; continue; }
+		t = (i > 0 && j < n && _shCls[i-1] == BIDI_L && _shCls[j] == BIDI_L) ? BIDI_L : BIDI_R;
+		for(k = i; k < j; k++)
+		{
+			_shCls[k] = t;
+			if(t == BIDI_R) _shCp[k] = Mirror(_shCp[k]);
+		}
+	}
+
+	/*** drawing goes right to left: left to right runs are reversed ***/
+	for(i = 0; i < n; i = j+1)
+	{
+		for(j = i; j < n && _shCls[j] == BIDI_L; j++);
+		for(k = i, t = j-1; k < t && j > i; k++, t--)
+		{
+			c = _shCp[k]; _shCp[k] = _shCp[t]; _shCp[t] = c;
+		}
+	}
+
+	for(i = 0; i < n; i++)
+		_shCp[i] = GetExtendedIndex(_shCp[i],&font24h);
+	return n;
+}
+
+/*
+*********************************************************************************************************
+* Description: 	Shaped glyph run of a paragraph, from the cache or shaped now (and cached when
+*               it fits into AF_FLCD_RUN_MAX and AF_FLCD_RUN_BYTES). A hit needs the same text,
+*               not only the same hash
+* Arguments  : 	s        UTF-8 text
+*               len      bytes
+*               n        out: number of glyphs
+* Returns    : 	glyph indices in drawing order
+*********************************************************************************************************
+*/
+static const u16 *ShapedRun (const char *s,u16 len,u16 *n)
+{
+	u32 h = 2166136261u;                        /* FNV-1a                          */
+	u16 i, k, lru = 0;
+
+	if(len > AF_FLCD_RUN_BYTES)
+	{
+		*n = Shape(s,len);
+		return _shCp;
+	}
+
+	for(i = 0; i < len; i++)
+		h = (h ^ (u8)s[i]) * 16777619u;
+
+	_runTick++;
+	for(i = 0; i < AF_FLCD_CACHE_RUNS; i++)
+	{
+		if(_run[i].used && _run[i].hash == h && _run[i].len == len)
+		{
+			for(k = 0; k < len && _run[i].s[k] == s[k]; k++);
+			if(k == len)
 			{
-				_curY+=24;
-				_curX=0;
-				isStick=false;
+				_run[i].used = _runTick;
+				*n = _run[i].n;
+				return _run[i].g;
 			}
+		}
+		if(_run[i].used < _run[lru].used) lru = i;
+	}
 
-			if (*p < 0x7f){	
-				
-			if(*p==0x0D) 	// 0x0A 0x0D -> Enter
-			{
-				p++;
-				if (*p == 0x0A){
-					_curY+=24;
-					_curX=0;
-					p++;
-					isStick=false;
-					goto start;
-				}}
-			u16 index = GetExtendedIndex(*p,&font24h);
-			uint16_t offset= font24h_offset_table[index];
-			uint8_t width = font24h_width_table[index];	
-			ShowCharF(*p,offset,width);
+	*n = Shape(s,len);
+	if(*n > AF_FLCD_RUN_MAX) return _shCp;
+
+	_run[lru].hash = h;
+	_run[lru].len  = len;
+	_run[lru].n    = *n;
+	_run[lru].used = _runTick;
+	for(i = 0; i < *n; i++) _run[lru].g[i] = _shCp[i];
+	for(i = 0; i < len; i++) _run[lru].s[i] = s[i];
+	return _run[lru].g;
+}
+
+/*
+*********************************************************************************************************
+* Description: 	End of the next part of a line that Shape takes whole: up to AF_FLCD_PARA_MAX
+*               characters, cut after the last space in them when the line is longer (else
+*               between two characters)
+* Arguments  : 	s        UTF-8 text
+*               e        end of the line
+* Returns    : 	end of the part, > s if s < e
+*********************************************************************************************************
+*/
+static const char *ParaEnd (const char *s,const char *e)
+{
+	const u8 *p = (const u8 *)s, *q = (const u8 *)e, *sp = 0;
+	u16 n;
+
+	for(n = 0; p < q && n < AF_FLCD_PARA_MAX; n++)         /* same steps as Shape   */
+	{
+		if(*p >= 0xE0 && q-p >= 3)      p += 3;
+		else if(*p >= 0xC0 && q-p >= 2) p += 2;
+		else
+		{
+			if(*p == ' ') sp = p+1;
 			p++;
-			isStick=false;
-			}
-			
-		else {
-						
-		u16 ch;
-		ch=(*p << 8);
-		p++;
-		ch|=*p;
-			
-
-		u8 byteL=	(ch &0x3f);		//(10)111111	
-		u8 byteH=((ch >>8 )&0x1f);		//(110)11111
-		u16 bb=(byteH<<6);
-		bb|=byteL;
-		ch=bb;
-		
-					
-	u16 index = GetExtendedIndex(ch,&font24h);
-	uint16_t formII = font24h_arabic2_table[index];
-			
-	if (ch==0x627 || ch == 0x62F || ch == 0x630 || ch == 0x631 || ch == 0x632 || ch == 0x648){
-		if (isStick==true && *(p-2)!=32)
-		formII++;
-			goto exception;	
+		}
 	}
-			
-	if (isStick==true && *(p-2)!=32)
-		formII++;
-	
-	if (*(p+1) != 32)
-		formII+=2;
-	
-	exception:
-	
-	index = GetExtendedIndex (formII,&font24h);
-	uint16_t offset= font24h_offset_table[index];
-	uint8_t width = font24h_width_table[index];	
-	ShowCharF(ch,offset,width);	
-	
-	if (ch==0x627 || ch == 0x62F || ch == 0x630 || ch == 0x631 || ch == 0x632 || ch == 0x648)
-		isStick = false;
-	else
-		isStick=true;
-	
-	p++;
-    }  
+	if(p < q && sp) p = sp;
+	return (const char *)p;
 }
+
+/*
+*********************************************************************************************************
+* Description: 	Show an UTF-8 string (Persian / latin), right to left from the text cursor.
+*               '\n' or "\r\n" starts a new line. Lines longer than AF_FLCD_PARA_MAX characters
+*               are shaped in parts (see ParaEnd)
+* Arguments  : 	p        text
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_FLCD :: ShowString(char *p)
+{
+	const char *e, *s, *m;
+	const u16 *g;
+	u16 n,i;
+
+	while(*p)
+	{
+		for(e = p; *e && *e != '\n' && *e != '\r'; e++);
+		for(s = p; s < e; s = m)
+		{
+			m = ParaEnd(s, e);
+			g = ShapedRun(s, m-s, &n);
+			for(i = 0; i < n; i++)
+				ShowGlyph(g[i]);
+		}
+		if(*e == '\r') e++;
+		if(*e == '\n')
+		{
+			e++;
+			_curY+=24;
+			_curX=0;
+		}
+		p = (char *)e;
+	}
 }
 
+
+#ifdef AF_LCD_BENCH
+#define BENCH_LOOKUPS 10000
+
+/*
+*********************************************************************************************************
+* Description: 	Look up BENCH_LOOKUPS code points (spread over the whole font) with the range
+*               scan and the page table and print lookups per second of both on the screen
+* Arguments  : 	None
+* Returns    : 	None
+*********************************************************************************************************
+*/
+void AF_FLCD :: BenchGlyphIndex(void)
+{
+	CPU cpu;
+	u32 cclk = cpu.GetCpuClk();
+	u32 t0,scan,table;
+	volatile u16 idx;                         /* keeps the lookups in the loops  */
+	u16 c;
+	int i;
+
+	DEMCR |= (1<<24);                         /* TRCENA                          */
+	DWT_CTRL |= 1;                            /* CYCCNTENA                       */
+
+	t0 = DWT_CYCCNT;
+	for(i=0,c=0x20;i<BENCH_LOOKUPS;i++,c+=0x95)
+		idx = GetExtendedIndexScan(c,&font24h);
+	scan = DWT_CYCCNT-t0;
+
+	t0 = DWT_CYCCNT;
+	for(i=0,c=0x20;i<BENCH_LOOKUPS;i++,c+=0x95)
+		idx = GetExtendedIndex(c,&font24h);
+	table = DWT_CYCCNT-t0;
+
+	_curX=0;_curY=MAX_CHAR_POSY-16;
+	AF_LCD::printf("scan %d/s  table %d/s",
+		(int)((u64)BENCH_LOOKUPS*cclk/scan),(int)((u64)BENCH_LOOKUPS*cclk/table));
+}
+#endif
@@ -8,6 +8,9 @@
 
 #include "AF_sys.h"
 #include "AF_Font_24x16.h"
+#include "AF_LCD_bus.h"
+#include "AHB_SRAM.h"
+#include "..\Config\LCD_Timing.h"
 
 
 // Drfine By me 
@@ -23,6 +26,8 @@
 #define TFTLCD_RD                      11
 #define TFTLCD_RST                     13
 
+//#define AF_LCD_BENCH                            /* glyph blit benchmark (BenchText) */
+/* AF_LCD_FB (strip framebuffer, FbOpen/Flush) is switched in AHB_SRAM.h     */
 
 
 static unsigned short DeviceCode;
@@ -30,10 +35,13 @@ static unsigned short DeviceCode;
 #ifdef family_lpc17xx
 	#ifdef TFTLCD_DATA_MSB_Nibble_Port_0 
 			#define DATA_MSB_Nibble_GPIO          LPC_GPIO0
+			#define DATA_MSB_Nibble_BASE          LPC_GPIO0_BASE
 		#elif defined TFTLCD_DATA_MSB_Nibble_Port_1
 			#define DATA_MSB_Nibble_GPIO          LPC_GPIO1
+			#define DATA_MSB_Nibble_BASE          LPC_GPIO1_BASE
 		#elif defined TFTLCD_DATA_MSB_Nibble_Port_2
 			#define DATA_MSB_Nibble_GPIO          LPC_GPIO2
+			#define DATA_MSB_Nibble_BASE          LPC_GPIO2_BASE
 
 		#elif (defined TFTLCD_DATA_MSB_Nibble_Port_3 ||defined TFTLCD_DATA_MSB_Nibble_Port_4)
 			#error : this defined port for LCD not suported 8 sequence pin for interchange of data
@@ -42,10 +50,13 @@ static unsigned short DeviceCode;
 	#endif
 	#ifdef TFTLCD_DATA_LSB_Nibble_Port_0 
 			#define DATA_LSB_Nibble_GPIO          LPC_GPIO0
+			#define DATA_LSB_Nibble_BASE          LPC_GPIO0_BASE
 		#elif defined TFTLCD_DATA_LSB_Nibble_Port_1
 			#define DATA_LSB_Nibble_GPIO          LPC_GPIO1
+			#define DATA_LSB_Nibble_BASE          LPC_GPIO1_BASE
 		#elif defined TFTLCD_DATA_LSB_Nibble_Port_2
 			#define DATA_LSB_Nibble_GPIO          LPC_GPIO2
+			#define DATA_LSB_Nibble_BASE          LPC_GPIO2_BASE
 		#elif (defined TFTLCD_DATA_LSB_Nibble_Port_3 ||defined TFTLCD_DATA_LSB_Nibble_Port_4)
 			#error : this defined port for LCD not suported 8 sequence pin for interchange of data
 		#else 
@@ -57,16 +68,19 @@ static unsigned short DeviceCode;
 			#define CONTROL_GPIO_SET   LPC_GPIO0->FIOSET
 			#define CONTROL_GPIO_CLR   LPC_GPIO0->FIOCLR
 			#define CONTROL_GPIO_PIN   LPC_GPIO0->FIOPIN
+			#define CONTROL_GPIO_BASE  LPC_GPIO0_BASE
 		#elif defined TFTLCD_CONTROLPORT_1
 		  #define CONTROL_GPIO_DIR   LPC_GPIO1->FIODIR
 			#define CONTROL_GPIO_SET   LPC_GPIO1->FIOSET
 			#define CONTROL_GPIO_CLR   LPC_GPIO1->FIOCLR
 			#define CONTROL_GPIO_PIN   LPC_GPIO1->FIOPIN
+			#define CONTROL_GPIO_BASE  LPC_GPIO1_BASE
 		#elif defined TFTLCD_CONTROLPORT_2
 		  #define CONTROL_GPIO_DIR   LPC_GPIO2->FIODIR
 			#define CONTROL_GPIO_SET   LPC_GPIO2->FIOSET
 			#define CONTROL_GPIO_CLR   LPC_GPIO2->FIOCLR
 			#define CONTROL_GPIO_PIN   LPC_GPIO2->FIOPIN
+			#define CONTROL_GPIO_BASE  LPC_GPIO2_BASE
     #elif (defined TFTLCD_CONTROLPORT_3 || defined TFTLCD_CONTROLPORT_4 )
 			#error : this port not suported 4  pin for control signal
 		#else 
@@ -139,19 +153,56 @@ static unsigned short DeviceCode;
 #define BPP         16                  /* Bits per pixel                     */
 #define BYPP        ((BPP+7)/8)         /* Bytes per pixel                    */
 
+/*------------------------- Image settings -----------------------------------*/
+
+/* First word of a compressed image (AF_imgconv.c), raw images start with the
+   width instead, so write_pic / write_pic_fast tell them apart by it        */
+#define AF_IMG_RLE  0xA5E1
+
+/* Read buffer of BmpFile / Raw565File, whole sectors are read into it, it has
+   to hold one visible row (240 pixels * 3 bytes) plus one sector             */
+#define AF_LCD_FILE_BUF   1536
+
+/*------------------------- Persian text settings ----------------------------*/
+
+/* AF_FLCD::ShowString shapes a paragraph of up to AF_FLCD_PARA_MAX characters
+   at a time and keeps AF_FLCD_CACHE_RUNS shaped paragraphs of up to
+   AF_FLCD_RUN_MAX glyphs and AF_FLCD_RUN_BYTES bytes of UTF-8 text (longer
+   ones are shaped on every call)                                            */
+#define AF_FLCD_PARA_MAX    128
+#define AF_FLCD_CACHE_RUNS  8
+#define AF_FLCD_RUN_MAX     48
+#define AF_FLCD_RUN_BYTES   96                  /* 2 bytes per persian letter */
+
+/* Glyphs kept unpacked by AF_FLCD::ShowGlyph, 104 bytes each                */
+#define AF_FLCD_GLYPH_CACHE 32
+
+/*------------------------- Strip framebuffer settings -----------------------*/
+
+/* A band of AF_LCD_FB_LINES full GRAM rows (240 pixels, RGB565) is kept at
+   AF_LCD_FB_ADDR in the AHB SRAM, see AHB_SRAM.h for its size and place.
+   Primitives that fall in the band draw into RAM, Flush() pushes only the
+   dirty rectangles.                                                          */
+#define AF_LCD_FB_RECTS     4                   /* dirty rectangles per band  */
+
 /*--------------- Graphic LCD interface hardware definitions -----------------*/
 
 
+/* Data and control bus, mapped at compile time from the TFTLCD_* defines    */
+typedef AF_LCD_Bus<DATA_MSB_Nibble_BASE, LCD_MSB_Nibble_OFFSET,
+                   DATA_LSB_Nibble_BASE, LCD_LSB_Nibble_OFFSET,
+                   CONTROL_GPIO_BASE, TFTLCD_CS, TFTLCD_RS, TFTLCD_WR, TFTLCD_RD, TFTLCD_RST> LCD_BUS;
+
 /* Pin CS setting to 0 or 1                                                   */
-#define LCD_CS(x)     ((x) ? (CONTROL_GPIO_SET |= PIN_CS) : (CONTROL_GPIO_CLR |= PIN_CS));
+#define LCD_CS(x)     LCD_BUS::cs(x);
 /* Pin RS setting to 0 or 1                                                   */
-#define LCD_RS(x)     ((x) ? (CONTROL_GPIO_SET |= PIN_RS) : (CONTROL_GPIO_CLR |= PIN_RS));
+#define LCD_RS(x)     LCD_BUS::rs(x);
 /* Pin WR setting to 0 or 1                                                   */
-#define LCD_WR(x)     ((x) ? (CONTROL_GPIO_SET |= PIN_WR) : (CONTROL_GPIO_CLR |= PIN_WR));
+#define LCD_WR(x)     LCD_BUS::wr(x);
 /* Pin RD setting to 0 or 1                                                   */
-#define LCD_RD(x)     ((x) ? (CONTROL_GPIO_SET |= PIN_RD) : (CONTROL_GPIO_CLR |= PIN_RD));
+#define LCD_RD(x)     LCD_BUS::rd(x);
 /* Pin RST setting to 0 or 1                                                   */
-#define LCD_RST(x)    ((x) ? (CONTROL_GPIO_SET |= PIN_RST): (CONTROL_GPIO_CLR |= PIN_RST));
+#define LCD_RST(x)    LCD_BUS::rst(x);
 
 
 
@@ -164,8 +215,26 @@ class AF_LCD{
 	int Printf(const char* str, ...);
 	void wait_delay(int count);
 	static __inline unsigned short lcd_read (void) ;
+	static __inline void rd_wait (void) ;
 	u32 mypow(u8 m,u8 n);
 	void DrawPoint1 (u16 x,u16 y ,u16 color) ;
+	void StreamBegin (u8 x,u16 y,u8 w,u16 h);
+	__inline void StreamPixel (u16 color);
+	void StreamRun (u16 color,u32 n);
+	void StreamPixels (const u16 *p,u32 n);
+	void StreamBeginUp (u8 x,u16 y,u8 w,u16 h);
+	void EntryMode (int up);
+	void ScrollTo (u16 vl);
+	void ConsoleNewLine (void);
+	void StreamEnd (void);
+	void Plot (u16 x,u16 y);
+	void HSpan (int x0,int x1,int y);
+	void VSpan (int x,int y0,int y1);
+	void DrawImageRle (int x0,int y0,const unsigned short *image);
+#ifdef AF_LCD_FB
+	void FbNextRow (void);
+	static void FbMark (u8 x0,u16 y0,u8 x1,u16 y1);
+#endif
 	void WriteRAM_Prepare(void);
 	void SetCursor(u8 Xpos, u16 Ypos);
 	static unsigned short rd_reg (unsigned short reg) ;
@@ -192,18 +261,36 @@ class AF_LCD{
 	void Bargraph       (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned int val);
 	void Bitmap         (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned char *bitmap);
 	void Bmp            (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned char *bmp);
+	void ReadRect       (u8 x0,u16 y0,u8 x1,u16 y1,u16 *buf);
 
 	void Fill           (u8 xsta,u16 ysta,u8 xend,u16 yend,u16 color);
 	void DrawPoint      (u16 x,u16 y);
 	void DrawLine       (u16 x1, u16 y1, u16 x2, u16 y2);
 	void DrawRectangle  (u8 x1, u16 y1, u8 x2, u16 y2);
 	void Draw_Circle        (u8 x0,u16 y0,u8 r);
+	void FillRect       (u8 x1, u16 y1, u8 x2, u16 y2);
+	void FillCircle     (u8 x0,u16 y0,u8 r);
+	void DrawThickLine  (u16 x1, u16 y1, u16 x2, u16 y2, u8 width);
 	void ShowChar(char ch);
 	void ShowNum        (u8 x,u16 y,u32 num,u8 len,u8 size);
 	void ShowString(char *p);
+	void PutChar        (char ch);
+	void ConsoleBegin   (void);
+	void ConsoleEnd     (void);
 	void Show2Num       (u8 x,u16 y,u16 num,u8 len,u8 size,u8 mode);
 	void write_pic      (int x0, int y0 , const unsigned short *image);
 	void write_pic_fast (const unsigned short *image); 
+	int  BmpFile        (u8 x,u16 y,const char *fname);
+	int  Raw565File     (u8 x,u16 y,u16 w,u16 h,const char *fname);
+#ifdef AF_LCD_FB
+	void FbOpen         (u16 y0);
+	void FbClose        (void);
+	void Flush          (void);
+#endif
+#ifdef AF_LCD_BENCH
+	void ShowCharPixel  (char ch);
+	void BenchText      (void);
+#endif
 	
 	AF_LCD (void)
 	{
@@ -218,6 +305,9 @@ class AF_LCD{
 
 class AF_FLCD : public AF_LCD
 {
+	protected:
+	
+	void BlitGlyph (const u32 *rows,u8 width);
 	
 	public:
 	
@@ -227,9 +317,13 @@ class AF_FLCD : public AF_LCD
 	}
 	
 	void ShowCharF (u16 ch,u16 offset , u8 width);
+	void ShowGlyph (u16 g);
 	void ShowString(char *p);
+	void GlyphCacheStats (u32 *hits,u32 *misses,int reset);
 	void changeXY (void);	
-	u8 recycle (char *ch);
+#ifdef AF_LCD_BENCH
+	void BenchGlyphIndex (void);
+#endif
 };
 
 
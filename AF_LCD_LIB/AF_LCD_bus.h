@@ -0,0 +1,109 @@
+//----------------------------------------------------------//
+//										AF_LCD_bus.h File
+//				Compile time pin mapped 16 bit bus for AF_LCD
+//----------------------------------------------------------//
+#ifndef _AF_LCD_BUS_H
+#define _AF_LCD_BUS_H
+
+#include <lpc17xx.h>
+#include "AF_sys.h"
+
+/*------------------------------------------------------------------------------
+  The data bus is two 8 bit lanes (MSB, LSB), each one on a GPIO port at a bit
+  offset, and the control lines are on one port. Everything is a template
+  parameter, so every access below folds to constant addresses and shifts.
+
+  Data is written as a FIOSET / FIOCLR pair: the one bits of the word go to
+  FIOSET, the zero bits of the lane to FIOCLR, so only the data lines change
+  and no read-modify-write is needed. FIOMASK is not used, other users of the
+  port (also in interrupts during a LCD transfer) see a normal port. When both
+  lanes share a port the word is one pair of stores, as in GLCD.c.
+
+  FIODIR is only touched around reads; the bus is left as output otherwise.
+  Control pins use plain stores to the write only FIOSET/FIOCLR registers.
+ *----------------------------------------------------------------------------*/
+
+template <u32 MSB_BASE, u8 MSB_OFF, u32 LSB_BASE, u8 LSB_OFF,
+          u32 CTL_BASE, u8 CS, u8 RS, u8 WR, u8 RD, u8 RST>
+class AF_LCD_Bus {
+
+	static __inline LPC_GPIO_TypeDef *msb (void) { return (LPC_GPIO_TypeDef *)MSB_BASE; }
+	static __inline LPC_GPIO_TypeDef *lsb (void) { return (LPC_GPIO_TypeDef *)LSB_BASE; }
+	static __inline LPC_GPIO_TypeDef *ctl (void) { return (LPC_GPIO_TypeDef *)CTL_BASE; }
+
+	public:
+
+	enum {
+		SAME_PORT = (MSB_BASE == LSB_BASE),
+		MSB_MASK  = (0xFFul << MSB_OFF),
+		LSB_MASK  = (0xFFul << LSB_OFF),
+		DATA_MASK = (MSB_BASE == LSB_BASE) ? (0xFFul << MSB_OFF) | (0xFFul << LSB_OFF) : 0
+	};
+
+	/* Data lines to output, control lines to output and idle (high)            */
+	static __inline void init (void)
+	{
+		msb()->FIODIR |= MSB_MASK;
+		lsb()->FIODIR |= LSB_MASK;
+		ctl()->FIODIR |= (1<<CS) | (1<<RS) | (1<<WR) | (1<<RD) | (1<<RST);
+		ctl()->FIOSET  = (1<<CS) | (1<<RS) | (1<<WR) | (1<<RD) | (1<<RST);
+	}
+
+	/* Put one 16 bit word on the data lines (CS must be low)                   */
+	static __inline void write (u16 c)
+	{
+		u32 v;
+		if (SAME_PORT) {
+			v = ((u32)(c >> 8) << MSB_OFF) | ((u32)(c & 0xFF) << LSB_OFF);
+			msb()->FIOSET = v;
+			msb()->FIOCLR = v ^ (u32)DATA_MASK;
+		} else {
+			v = (u32)(c >> 8) << MSB_OFF;
+			msb()->FIOSET = v;
+			msb()->FIOCLR = v ^ (u32)MSB_MASK;
+			v = (u32)(c & 0xFF) << LSB_OFF;
+			lsb()->FIOSET = v;
+			lsb()->FIOCLR = v ^ (u32)LSB_MASK;
+		}
+	}
+
+	/* Data lines to input / back to output around a read or a read burst       */
+	static __inline void input (void)
+	{
+		msb()->FIODIR &= ~MSB_MASK;
+		lsb()->FIODIR &= ~LSB_MASK;
+	}
+	static __inline void output (void)
+	{
+		msb()->FIODIR |= MSB_MASK;
+		lsb()->FIODIR |= LSB_MASK;
+	}
+
+	/* Sample the data lines (input mode, RD low for tRD)                        */
+	static __inline u16 sample (void)
+	{
+		if (SAME_PORT) {
+			u32 v = msb()->FIOPIN;
+			return (((v >> MSB_OFF) & 0xFF) << 8) | ((v >> LSB_OFF) & 0xFF);
+		}
+		return (((msb()->FIOPIN >> MSB_OFF) & 0xFF) << 8) | ((lsb()->FIOPIN >> LSB_OFF) & 0xFF);
+	}
+
+	/* Single read, RD must already be low                                       */
+	static __inline u16 read (void)
+	{
+		u16 v;
+		input();
+		v = sample();
+		output();
+		return v;
+	}
+
+	static __inline void cs  (int x) { if (x) ctl()->FIOSET = (1<<CS);  else ctl()->FIOCLR = (1<<CS);  }
+	static __inline void rs  (int x) { if (x) ctl()->FIOSET = (1<<RS);  else ctl()->FIOCLR = (1<<RS);  }
+	static __inline void wr  (int x) { if (x) ctl()->FIOSET = (1<<WR);  else ctl()->FIOCLR = (1<<WR);  }
+	static __inline void rd  (int x) { if (x) ctl()->FIOSET = (1<<RD);  else ctl()->FIOCLR = (1<<RD);  }
+	static __inline void rst (int x) { if (x) ctl()->FIOSET = (1<<RST); else ctl()->FIOCLR = (1<<RST); }
+};
+
+#endif
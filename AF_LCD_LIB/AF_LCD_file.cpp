@@ -0,0 +1,190 @@
+//----------------------------------------------------------//
+//										AF_LCD_file.cpp File
+//				BMP and raw RGB565 images from FlashFS files
+//----------------------------------------------------------//
+
+#include <stdio.h>
+#include <string.h>
+#include "AF_LCD.h"
+
+/*------------------------------------------------------------------------------
+  The file is read through fread (FlashFS retarget) in whole sectors into one
+  buffer, every visible row is converted to RGB565 in place and pushed into
+  one StreamBegin / StreamBeginUp window that stays open for the whole image.
+  Columns right of the screen are skipped, rows below it are not read.
+ *----------------------------------------------------------------------------*/
+
+#define SECTOR		512
+
+static u32  _buf[AF_LCD_FILE_BUF/4];            /* rows start at even offsets    */
+static u32  _pos,_len;
+static FILE *_f;
+
+/*
+*********************************************************************************************************
+* Description: 	Next n bytes of the file as one block in _buf. The bytes not used yet are moved
+*               to the start of _buf and it is filled up with whole sectors
+* Arguments  : 	n        bytes (<= AF_LCD_FILE_BUF - SECTOR)
+* Returns    : 	pointer to the bytes, 0 at the end of the file
+*********************************************************************************************************
+*/
+static u8 *fetch (u32 n)
+{
+	u8 *b = (u8 *)_buf;
+	u32 rd;
+
+	if(_len-_pos < n)
+	{
+		memmove(b, b+_pos, _len-_pos);
+		_len -= _pos;
+		_pos = 0;
+		rd = (AF_LCD_FILE_BUF-_len) & ~(SECTOR-1);
+		_len += fread(b+_len, 1, rd, _f);
+		if(_len < n) return 0;
+	}
+	b += _pos;
+	_pos += n;
+	return b;
+}
+
+/*
+*********************************************************************************************************
+* Description: 	Skip n bytes of the file, what is not in _buf any more is skipped with fseek.
+*               The seek goes back to the sector start, so fetch keeps reading whole sectors
+* Arguments  : 	n        bytes
+* Returns    : 	None
+*********************************************************************************************************
+*/
+static void skip (u32 n)
+{
+	if(_len-_pos >= n) { _pos += n; return; }
+	n += ftell(_f) - (_len-_pos);                   /* new file position             */
+	_pos = _len = 0;
+	fseek(_f, n & ~(SECTOR-1), SEEK_SET);
+	if(!fetch(n & (SECTOR-1))) _pos = _len;         /* end of file                   */
+}
+
+static u16 get16 (const u8 *p) { return p[0] | (p[1]<<8); }
+static u32 get32 (const u8 *p) { return p[0] | (p[1]<<8) | (p[2]<<16) | ((u32)p[3]<<24); }
+
+/*
+*********************************************************************************************************
+* Description: 	Show a BMP file (24 bit, or 16 bit 565 / 555, bottom up or top down)
+* Arguments  : 	(x ,y)   top left corner, GRAM coordinate like write_pic (x 0..239, y 0..319)
+*               fname    FlashFS file name
+* Returns    : 	0 ok, -1 no file, -2 not a supported BMP
+*********************************************************************************************************
+*/
+int AF_LCD :: BmpFile (u8 x,u16 y,const char *fname)
+{
+	u8  *p;
+	u16 *d;
+	u32 off,w,cw,ch,row,stride,bpp,comp,r,i;
+	int h,up,f555 = 0;
+	u16 v;
+
+	if(x >= HEIGHT || y >= WIDTH) return 0;
+	_f = fopen(fname, "r");
+	if(!_f) return -1;
+	_pos = _len = 0;
+
+	/*** BITMAPFILEHEADER + BITMAPINFOHEADER ***/
+	p = fetch(54);
+	if(!p || p[0] != 'B' || p[1] != 'M') { fclose(_f); return -2; }
+	off  = get32(p+10);
+	w    = get32(p+18);
+	h    = (int)get32(p+22);
+	bpp  = get16(p+28);
+	comp = get32(p+30);
+	if(!(bpp == 24 && comp == 0) && !(bpp == 16 && (comp == 0 || comp == 3)) || !w || !h || off < 54+(comp ? 4 : 0))
+	{
+		fclose(_f);
+		return -2;
+	}
+	/*** 16 bit: BI_RGB is 555, BI_BITFIELDS has the red mask at 54 (after or in the header) ***/
+	if(comp)
+	{
+		p = fetch(4);
+		if(!p) { fclose(_f); return -2; }
+		f555 = get32(p) == 0x7C00;
+		off -= 4;
+	}
+	else
+		f555 = bpp == 16;
+	skip(off-54);
+
+	up = h > 0;
+	if(!up) h = -h;
+	row    = w*(bpp/8);
+	stride = (row+3) & ~3;
+	cw = HEIGHT-x < w ? HEIGHT-x : w;
+	ch = WIDTH-y  < (u32)h ? WIDTH-y : h;
+
+	/*** bottom up: the image rows below the screen come first ***/
+	if(up)
+	{
+		skip((h-ch)*stride);
+		StreamBeginUp(x,y,cw,ch);
+	}
+	else
+		StreamBegin(x,y,cw,ch);
+
+	for(r = 0; r < ch; r++)
+	{
+		p = fetch(cw*(bpp/8));
+		if(!p) break;
+		d = (u16 *)p;                             /* converted in place, 2 bytes <= 3   */
+		if(bpp == 24)
+		{
+			for(i = 0; i < cw; i++, p += 3)
+				d[i] = ((p[2]&0xF8)<<8) | ((p[1]&0xFC)<<3) | (p[0]>>3);
+		}
+		else if(f555)
+		{
+			for(i = 0; i < cw; i++)
+			{
+				v = d[i];
+				d[i] = ((v&0x7FE0)<<1) | ((v>>4)&0x20) | (v&0x1F);
+			}
+		}
+		StreamPixels(d, cw);
+		skip(stride - cw*(bpp/8));
+	}
+	StreamEnd();
+	fclose(_f);
+	return 0;
+}
+
+/*
+*********************************************************************************************************
+* Description: 	Show a raw RGB565 file (little endian, rows top down, no header)
+* Arguments  : 	(x ,y)   top left corner, GRAM coordinate like write_pic (x 0..239, y 0..319)
+*               (w ,h)   size of the image in the file
+*               fname    FlashFS file name
+* Returns    : 	0 ok, -1 no file
+*********************************************************************************************************
+*/
+int AF_LCD :: Raw565File (u8 x,u16 y,u16 w,u16 h,const char *fname)
+{
+	u8  *p;
+	u32 cw,ch,r;
+
+	if(x >= HEIGHT || y >= WIDTH) return 0;
+	_f = fopen(fname, "r");
+	if(!_f) return -1;
+	_pos = _len = 0;
+
+	cw = HEIGHT-x < w ? HEIGHT-x : w;
+	ch = WIDTH-y  < h ? WIDTH-y  : h;
+	StreamBegin(x,y,cw,ch);
+	for(r = 0; r < ch; r++)
+	{
+		p = fetch(cw*2);
+		if(!p) break;
+		StreamPixels((u16 *)p, cw);
+		skip((w-cw)*2);
+	}
+	StreamEnd();
+	fclose(_f);
+	return 0;
+}
@@ -0,0 +1,58 @@
+//----------------------------------------------------------//
+//										AF_fontidx.c File
+//		Host tool: glyph index page table for a BFC font
+//----------------------------------------------------------//
+/*------------------------------------------------------------------------------
+  Build and run on the PC (not part of the Keil project), again every time
+  the font is exported from BitFontCreator:
+
+    gcc -o AF_fontidx AF_fontidx.c
+    AF_fontidx > B_Roya24h_idx.h
+
+  It walks the glyph ranges of font24h and writes a two level table for
+  GetExtendedIndex: font24h_idx_top[code >> 8] is a page number, page 0 is
+  all zero (no glyph, as the range scan returns), font24h_idx_page[page]
+  [code & 0xFF] is the glyph index. Only pages with glyphs are emitted.
+ *----------------------------------------------------------------------------*/
+#define AF_FONTIDX_GEN                          /* B_Roya24h.h: no _idx.h yet   */
+#include "B_Roya24h.h"
+
+static unsigned short idx[65536];
+static unsigned char  used[256];
+
+int main (void)
+{
+	const GLYPH_RANGE *r = font24h_glyph_ranges;
+	unsigned nRanges = font24h_glyph_set[0].nRanges;
+	unsigned i, k, c, n = 0, npages = 1;
+	unsigned char page[256];
+
+	for (i = 0; i < nRanges; i++)
+		for (k = 0; k < r[i].nGlyphs; k++, n++) {
+			c = r[i].charLow + k;
+			idx[c] = (unsigned short)n;
+			used[c >> 8] = 1;
+		}
+
+	printf("/* generated by AF_fontidx.c from the glyph ranges of font24h, do not edit */\n\n");
+	printf("#ifndef _B_ROYA24H_IDX_H\n#define _B_ROYA24H_IDX_H\n\n");
+
+	for (i = 0; i < 256; i++)
+		page[i] = used[i] ? (unsigned char)npages++ : 0;
+
+	printf("const UCHAR font24h_idx_top[256] = \n{");
+	for (i = 0; i < 256; i++)
+		printf("%s%2u%s", i % 16 ? " " : "\n\t", page[i], i < 255 ? "," : "");
+	printf("\n};\n\n");
+
+	printf("const USHORT font24h_idx_page[%u][256] = \n{\n\t{ 0 },", npages);
+	for (i = 0; i < 256; i++) {
+		if (!page[i]) continue;
+		printf("\n\t{ /* 0x%02X00 */", i);
+		for (k = 0; k < 256; k++)
+			printf("%s%3u%s", k % 16 ? " " : "\n\t\t", idx[(i << 8) | k], k < 255 ? "," : "");
+		printf("\n\t}%s", page[i] == npages - 1 ? "" : ",");
+	}
+	printf("\n};\n\n#endif\n");
+	return 0;
+}
@@ -7,9607 +7,6349 @@
 // target width : 240
 // target height : 320
 // ############################################
+// compressed by AF_imgconv.c : AF_IMG_RLE, 50727 words (raw 76802)
+// ############################################
 const unsigned short eca[] = 
 {
-	240,320,
-	0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9942,0x9942,0x9941,0x9921,0x9921,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9141,0x9121,0x9121,0x9141,
-	0x9121,0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x9121,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9941,0x9961,0x9962,0x9961,0x9181,0x9981,0x9981,
-	0x9981,0x9982,0x9962,0x9982,0x9982,0x9982,0x9982,0x9982,
-	0x9981,0x9982,0x9982,0x9982,0x99A2,0x99A2,0x99A2,0xA1C2,
-	0xA1E3,0xAA24,0xAA85,0xB307,0xBB89,0xC40C,0xCC8E,0xCD10,
-	0xD593,0xEEDA,0xFFFF,0xF75D,0xE637,0xE5F5,0xE5F6,0xDDD4,
-	0xDD91,0xD4ED,0xD428,0xCB85,0xCB64,0xCB44,0xCB64,0xCB64,
-	0xCB84,0xCB84,0xCBA4,0xD3A4,0xD3A4,0xD3C5,0xD3E5,0xD405,
-	0xDC05,0xDC25,0xDC46,0xDC46,0xDC67,0xDC87,0xE4A7,0xE4C8,
-	0xE4E8,0xE4E8,0xED08,0xED29,0xED49,0xED4A,0xED6A,0xED6A,
-	0xED8A,0xED8B,0xED8A,0xED8B,0xEDAB,0xEDAB,0xEDAB,0xEDAC,
-	0xED8B,0xED8C,0xED6B,0xED8C,0xED8C,0xED8C,0xED8C,0xED6B,
-	0xED4B,0xED2A,0xE50A,0xE509,0xE4C9,0xE4A9,0xDCA8,0xDC88,
-	0xDC67,0xDC47,0xDC26,0xDC26,0xDC05,0xDC04,0xE424,0xE424,
-	0xE403,0xDBE3,0xDBA3,0xDB83,0xDB84,0xDB84,0xDBA5,0xDBA5,
-	0xDBA4,0xDBC4,0xDBA4,0xD3A4,0xD384,0xD364,0xCB44,0xCB03,
-	0xC2E3,0xC2C4,0xCAC5,0xD2E5,0xDB26,0xE387,0xF50F,0xFF3A,
-	0xFFDE,0xFF5A,0xFED3,0xFECF,0xFEEE,0xF6AD,0xE5EB,0xDD2B,
-	0xD4AB,0xCC8A,0xC48A,0xBC49,0xB3E8,0xA388,0xAB27,0xCB27,
-	0xE387,0xF3C8,0xFC28,0xF448,0xF486,0xECA5,0xE464,0xD402,
-	0xC382,0xB302,0xA2A1,0x9A42,0x9A02,0xA202,0xAA03,0xB223,
-	0xC263,0xCAE3,0xDB43,0xE3C3,0xEC42,0xF483,0xF4A3,0xF4A3,
-	0xF483,0xF463,0xEC44,0xE3E5,0xE3C6,0xE3C5,0xE3C5,0xDBA6,
-	0xDBC5,0xDBE5,0xDBE4,0xDBE4,0xDBE4,0xD3E4,0xD3E4,0xD3E4,
-	0xD405,0xD426,0xD447,0xD427,0xD489,0xE590,0xEE77,0xEE56,
-	0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9921,0x9921,0x9921,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x9141,0x9141,0x9141,0x9941,0x9141,0x9141,0x9141,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9961,0x9961,0x9961,0x9961,0x9981,0x9981,0x9981,
-	0x9181,0x9961,0x9961,0x9961,0x9982,0x9982,0x9982,0x9982,
-	0x9981,0x9982,0x9982,0x99A2,0x99A2,0x99A2,0x99A2,0x99A2,
-	0xA1E2,0xA203,0xAA64,0xB2E6,0xB348,0xBBEB,0xCC6D,0xCCEF,
-	0xD553,0xE658,0xFFBE,0xFFBE,0xEE98,0xDDF5,0xE5F5,0xE5D5,
-	0xDDB2,0xDD2E,0xD46A,0xCBC6,0xCB64,0xCB64,0xCB64,0xCB63,
-	0xD384,0xCB84,0xCBA4,0xD3A4,0xD3A4,0xD3C4,0xD3E5,0xD405,
-	0xD405,0xDC26,0xDC46,0xDC46,0xDC67,0xDC87,0xE4A7,0xE4C7,
-	0xE4E8,0xE4E8,0xED08,0xE529,0xED49,0xED4A,0xED6A,0xED6A,
-	0xED8A,0xED8B,0xED8B,0xEDAB,0xEDAB,0xEDAB,0xEDAC,0xEDAC,
-	0xEDAC,0xED8C,0xED8C,0xED8C,0xEDAC,0xEDAC,0xED8C,0xED6C,
-	0xED4B,0xED4B,0xED2A,0xE50A,0xE4E9,0xE4C9,0xE4A8,0xDC88,
-	0xDC67,0xDC67,0xDC47,0xDC06,0xDC05,0xDC05,0xE404,0xE423,
-	0xE423,0xE3E3,0xDBC3,0xDBA4,0xDB84,0xDB84,0xDBA4,0xDBA5,
-	0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xD364,0xD364,0xCB44,0xCB24,
-	0xC2E4,0xCAC4,0xCAE5,0xD2E5,0xDB25,0xE387,0xF50F,0xFF3A,
-	0xFFDE,0xFF5A,0xFED3,0xFECF,0xFEEE,0xF6AD,0xE5EB,0xDD4B,
-	0xCCAB,0xCC8A,0xCC8A,0xC44A,0xB3E9,0xA388,0xAB27,0xCB47,
-	0xE388,0xF3E8,0xFC28,0xF448,0xF486,0xECA5,0xE464,0xD403,
-	0xC382,0xB302,0xA2A1,0x9A42,0x9A02,0xA202,0xAA03,0xB223,
-	0xC263,0xCAE3,0xDB43,0xE3C3,0xEC43,0xF483,0xF4A3,0xF4A3,
-	0xF483,0xF483,0xEC44,0xEBE5,0xE3C6,0xE3C6,0xE3C5,0xE3C5,
-	0xDBC5,0xDBE5,0xDBE4,0xDBE4,0xDBE4,0xD3E4,0xD3E4,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD489,0xE590,0xEE76,0xEE36,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9921,0x9921,0x9921,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9121,
-	0x9121,0x9121,0x9121,0x9141,0x9941,0x9941,0x9141,0x9141,
-	0x9961,0x9961,0x9961,0x9961,0x9961,0x9961,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0x9961,0x9982,0x9982,0x9982,0x9982,
-	0x9181,0x9182,0x8982,0x8961,0x8962,0x8982,0x8982,0x8981,
-	0x9182,0x91A3,0x9203,0x9A45,0x9AC7,0xA369,0xABEB,0xB44D,
-	0xBC8F,0xC533,0xDE78,0xE6FB,0xD637,0xC553,0xC533,0xC533,
-	0xC511,0xBCAE,0xBC0A,0xBB66,0xBB24,0xC323,0xC343,0xCB64,
-	0xD384,0xCB84,0xCBA4,0xD3A4,0xD3A4,0xD3C5,0xD3E5,0xD405,
-	0xD405,0xDC25,0xDC46,0xDC46,0xDC66,0xDC87,0xE4A7,0xE4C7,
-	0xE4E8,0xE508,0xED08,0xE529,0xED49,0xED4A,0xED6A,0xED8A,
-	0xED8B,0xED8B,0xED8B,0xEDAB,0xEDAC,0xEDAC,0xEDAC,0xEDAC,
-	0xEDAC,0xED8C,0xED8C,0xED8C,0xEDAC,0xEDAD,0xED8C,0xED8C,
-	0xED6B,0xED4B,0xE52A,0xE52A,0xE4EA,0xE4C9,0xE4C9,0xDCA8,
-	0xDC68,0xDC68,0xDC47,0xDC26,0xDC05,0xDC05,0xDC04,0xE424,
-	0xE423,0xE3E3,0xDBC3,0xDBA4,0xDB84,0xDB85,0xDBA4,0xDBA5,
-	0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xD384,0xD364,0xCB44,0xCB24,
-	0xC2E4,0xCAC4,0xCAE4,0xD2E5,0xDB06,0xE387,0xF4EE,0xFF1A,
+	0xA5E1,0x00F0,0x0140,0x0000,0x9921,0x8009,0x9941,0xC004,
+	0xA5A4,0xA39C,0xA400,0x800B,0x9941,0xC003,0x649C,0xA4AC,
+	0x8003,0x9121,0x8002,0x9141,0x0000,0x9121,0x8007,0x9141,
+	0xC005,0xE4A4,0xACA5,0xA36C,0x8002,0x9981,0x0001,0x9982,
+	0x9962,0x8004,0x9982,0x0000,0x9981,0x8002,0x9982,0x8002,
+	0x99A2,0xC003,0xECAD,0xF5BD,0x0009,0xB307,0xBB89,0xC40C,
+	0xCC8E,0xCD10,0xD593,0xEEDA,0xFFFF,0xF75D,0xE637,0xC003,
+	0x92A5,0x5A91,0x0002,0xD4ED,0xD428,0xCB85,0xC01F,0x9B9C,
+	0xACA4,0xACA4,0xACE4,0xA4AD,0xACAC,0xE4AC,0xADA4,0xADAC,
+	0xECAD,0xACA4,0xECAD,0xACA5,0xACA4,0xACA5,0xA3A5,0x8002,
+	0xEDAB,0xC003,0xA59B,0xA59B,0x8003,0xED8C,0xC026,0x9B9C,
+	0x9B5C,0xA394,0x9C63,0x9C9B,0x9C9B,0xA49B,0xA3EC,0xA49B,
+	0x5C94,0x9CA5,0xA4AD,0xA4A3,0xAC9C,0x649C,0x9C5C,0x935C,
+	0x9DE5,0xECF5,0xFD00,0x0009,0xF50F,0xFF3A,0xFFDE,0xFF5A,
+	0xFED3,0xFECF,0xFEEE,0xF6AD,0xE5EB,0xDD2B,0xC006,0x445B,
+	0x6453,0x4B0C,0xCB00,0x0002,0xCB27,0xE387,0xF3C8,0xC00D,
+	0xFC6C,0xB26B,0x530A,0x0404,0x0B4D,0x94E4,0xE5EC,0x0004,
+	0xC263,0xCAE3,0xDB43,0xE3C3,0xEC42,0xC00C,0xF5AC,0xA49C,
+	0x9C5D,0x4D9D,0xA3A4,0x5DAB,0xAC00,0x8002,0xDBE4,0x8002,
+	0xD3E4,0xC004,0xADAD,0xAD9C,0xBE00,0x0003,0xE590,0xEE77,
+	0xEE56,0x9921,0x800A,0x9941,0x8002,0x9921,0x800C,0x9941,
+	0x8007,0x9141,0x0000,0x9941,0x800A,0x9141,0x0000,0x9941,
+	0x8003,0x9961,0x8002,0x9981,0x0000,0x9181,0x8002,0x9961,
+	0x8003,0x9982,0x0002,0x9981,0x9982,0x9982,0x8004,0x99A2,
+	0x000D,0xA1E2,0xA203,0xAA64,0xB2E6,0xB348,0xBBEB,0xCC6D,
+	0xCCEF,0xD553,0xE658,0xFFBE,0xFFBE,0xEE98,0xDDF5,0xC003,
+	0xE49C,0x5980,0x0001,0xD46A,0xCBC6,0x8002,0xCB64,0xC01B,
+	0xA3ED,0x64AC,0xE4A4,0xACAD,0xACA4,0xEDAC,0xA4AD,0xACEC,
+	0xACAD,0xA4EC,0x6DEC,0xA5AC,0xA4AC,0xA5A4,0x8002,0xEDAB,
+	0x8002,0xEDAC,0x8002,0xED8C,0xC01B,0xACA4,0x9C9C,0x9BA4,
+	0x9B5C,0x9B9C,0x9B5C,0x9BA4,0x9C93,0xA3A4,0xE3AB,0xA494,
+	0x5C9D,0x9CA4,0xACA5,0x8003,0xDBA4,0xC009,0x54A4,0x5C9C,
+	0x54DC,0xADE4,0xF4FE,0x000A,0xF50F,0xFF3A,0xFFDE,0xFF5A,
+	0xFED3,0xFECF,0xFEEE,0xF6AD,0xE5EB,0xDD4B,0xCCAB,0xC005,
+	0x9BA4,0x540B,0x0BCB,0x0002,0xCB47,0xE388,0xF3E8,0xC00D,
+	0xF46C,0xB26B,0x530B,0x0304,0x0B4D,0x94E4,0xE5EC,0x0004,
+	0xC263,0xCAE3,0xDB43,0xE3C3,0xEC43,0xC00C,0xF4AC,0xA49C,
+	0xA455,0x8D5D,0xA4A3,0xA464,0xAC00,0x8002,0xDBE4,0xC007,
+	0x64A4,0xACA5,0xADAD,0x9CBE,0x0002,0xE590,0xEE76,0xEE36,
+	0x800B,0x9941,0x8002,0x9921,0x800C,0x9941,0x8003,0x9141,
+	0x0000,0x9941,0x8005,0x9141,0x8003,0x9121,0xC004,0xACE4,
+	0xA464,0xA400,0x800B,0x9961,0x8003,0x9982,0xC00B,0x63A5,
+	0x649B,0xA5AC,0xA4A3,0xE5AD,0xBCF6,0x0009,0x9AC7,0xA369,
+	0xABEB,0xB44D,0xBC8F,0xC533,0xDE78,0xE6FB,0xD637,0xC553,
+	0xC003,0x9CA4,0x9A49,0x0001,0xBC0A,0xBB66,0xC01B,0x92E3,
+	0xACED,0xEC64,0xACE4,0xA4AD,0xACAC,0xA4EC,0xADA4,0xACAD,
+	0xECAC,0xADAC,0xE46D,0xECA5,0xACAC,0x8002,0xED8B,0x0000,
+	0xEDAB,0x8004,0xEDAC,0x8002,0xED8C,0xC01B,0xACA5,0x9BA4,
+	0x9B9C,0x5BA4,0x949B,0xA45B,0x94A4,0x9B9B,0x9BA4,0xA3EC,
+	0xA394,0x5C9D,0x9CA5,0xABA5,0x8003,0xDBA4,0xC008,0x5C9C,
+	0x5C9C,0x54DC,0xACE5,0xED00,0x000B,0xE387,0xF4EE,0xFF1A,
 	0xFFDE,0xFF5A,0xFED3,0xFEAF,0xFEEE,0xF6AD,0xE60B,0xDD4B,
-	0xD4AB,0xCC8B,0xCC8B,0xC44A,0xB3E9,0xAB88,0xAB27,0xCB47,
-	0xEBA8,0xF3E8,0xFC28,0xFC68,0xF486,0xECA5,0xE464,0xD403,
-	0xC382,0xB302,0xA2A2,0x9A42,0x9A02,0xA202,0xAA03,0xB223,
-	0xC263,0xCAE3,0xDB43,0xE3C3,0xEC43,0xF483,0xF4A3,0xF4C3,
-	0xF483,0xF483,0xEC43,0xEC05,0xE3C6,0xE3C6,0xE3C6,0xE3C5,
-	0xDBC5,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xD404,0xD3E4,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD489,0xE590,0xEE76,0xE636,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9942,0x9942,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9141,0x9141,0x9141,0x9121,0x9121,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x9141,0x9941,
-	0x9961,0x9961,0x9961,0x9961,0x9961,0x9961,0x9962,0x9962,
-	0x9962,0x9961,0x9162,0x9161,0x9161,0x8961,0x8961,0x8941,
-	0x8141,0x8141,0x7941,0x7941,0x7941,0x7141,0x7941,0x7941,
-	0x7941,0x7962,0x79A3,0x81E4,0x8A45,0x8AC7,0x9329,0x9B8A,
-	0x9BCC,0xA42F,0xB533,0xC618,0xBDB5,0xACD1,0xAC70,0xAC90,
-	0xAC6F,0xA42D,0xA3C9,0xA346,0xA2E4,0xAAC3,0xB2E3,0xB303,
-	0xBB23,0xBB44,0xC364,0xCB84,0xD3A4,0xD3C4,0xD3E5,0xD3E5,
-	0xD405,0xDC26,0xDC46,0xDC46,0xDC67,0xDC87,0xE4A7,0xE4C7,
-	0xE4E8,0xE508,0xED08,0xE529,0xED49,0xED4A,0xED6A,0xED8A,
-	0xED8B,0xED8B,0xEDAB,0xEDAB,0xEDCC,0xEDAC,0xEDAC,0xEDAC,
-	0xEDAC,0xEDAC,0xEDAC,0xEDAC,0xEDAC,0xEDAD,0xED8D,0xED8D,
-	0xED6C,0xED4B,0xED4B,0xED2B,0xE50A,0xE4E9,0xE4C9,0xDCA9,
-	0xDC88,0xDC68,0xDC67,0xDC26,0xDC06,0xDC05,0xDC04,0xE424,
-	0xE423,0xE403,0xDBC3,0xDBA3,0xDBA4,0xDB84,0xDBA4,0xDBA5,
-	0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xD384,0xD364,0xCB44,0xCB24,
-	0xC2E4,0xCAC4,0xCAE5,0xD2E5,0xDB25,0xE386,0xF4CD,0xFEF9,
-	0xFFDE,0xFF5B,0xFEF3,0xFECF,0xFEEF,0xF6AD,0xE60B,0xDD4B,
-	0xD4CB,0xCCAB,0xCC8B,0xC44A,0xBBE9,0xAB88,0xB347,0xCB67,
-	0xEBA8,0xF3E8,0xFC28,0xFC68,0xF486,0xF4A5,0xE464,0xD402,
-	0xC382,0xB302,0xA2A2,0xA242,0x9A02,0xA202,0xAA23,0xB223,
-	0xC263,0xCAC3,0xDB43,0xE3C3,0xEC43,0xF483,0xF4A3,0xF4C3,
-	0xF4A3,0xF483,0xEC43,0xEC05,0xE3E6,0xE3C6,0xE3C6,0xE3C6,
-	0xE3C5,0xDBE4,0xDBE4,0xDC04,0xDC04,0xD404,0xD404,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD469,0xE570,0xEE56,0xEE36,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9121,0x9141,0x9121,0x9121,0x9121,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9941,0x9961,0x9962,0x9961,0x9961,0x9961,0x9961,
-	0x9161,0x9161,0x8941,0x8141,0x7941,0x7921,0x7921,0x7121,
-	0x7121,0x6921,0x6101,0x6101,0x5901,0x5901,0x5901,0x5901,
-	0x5901,0x5921,0x6142,0x6163,0x69C4,0x7205,0x7246,0x7AA8,
-	0x7AE9,0x7B2A,0x83CE,0x9492,0x9492,0x8BCE,0x838C,0x8B8C,
-	0x836C,0x836A,0x8308,0x82C5,0x8A64,0x9263,0x9A62,0x9AA3,
-	0xA2C3,0xAAC3,0xB303,0xBB24,0xBB44,0xC384,0xD3C5,0xD3E5,
-	0xDC06,0xDC26,0xDC26,0xDC46,0xDC66,0xDC67,0xE4A7,0xE4C8,
-	0xE4E8,0xE508,0xE508,0xED29,0xED49,0xED4A,0xED6A,0xED8A,
-	0xED8B,0xEDAB,0xEDAB,0xEDAC,0xEDAC,0xEDCC,0xEDCC,0xEDAC,
-	0xEDCC,0xEDAC,0xEDAD,0xEDAD,0xEDAD,0xEDAD,0xED8D,0xED8D,
-	0xED6C,0xED6C,0xED4B,0xED2B,0xE50A,0xE4EA,0xE4C9,0xDCA9,
-	0xDC88,0xDC88,0xDC68,0xDC27,0xDC26,0xDC05,0xDC04,0xE424,
-	0xE424,0xE403,0xDBE3,0xDBA3,0xDBA4,0xDB84,0xDBA5,0xDBA4,
-	0xDBC5,0xDBC4,0xDBA4,0xDBA4,0xD384,0xD364,0xCB44,0xCB24,
-	0xC2E3,0xCAE4,0xCAC4,0xD305,0xDB26,0xE366,0xF4AD,0xFEF9,
-	0xFFDE,0xFF7B,0xFEF3,0xFECF,0xFEEE,0xF6AD,0xE60B,0xDD4B,
-	0xD4CB,0xCC8B,0xCC8B,0xC44A,0xBC09,0xABA8,0xB347,0xCB68,
-	0xEBA8,0xF409,0xF448,0xF467,0xF4A6,0xECA5,0xE464,0xD402,
-	0xC382,0xB302,0xA2A2,0xA262,0xA222,0xA202,0xAA23,0xB243,
-	0xBA63,0xCAC3,0xDB44,0xE3C3,0xEC43,0xF483,0xF4A3,0xF4C3,
-	0xF4A3,0xF483,0xEC44,0xEC05,0xE3E6,0xE3C6,0xE3C6,0xE3C6,
-	0xE3E5,0xDBE5,0xDC04,0xDC04,0xDC04,0xD404,0xD403,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD468,0xE56F,0xEE55,0xEE35,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9941,0x9961,0x9962,0x9962,0x9161,0x9161,0x8941,
-	0x8141,0x7941,0x7921,0x7121,0x6901,0x6101,0x60E1,0x58E1,
-	0x58E1,0x50C1,0x50C1,0x48C0,0x48C1,0x48C1,0x48C1,0x48C1,
-	0x48C1,0x48E1,0x48E1,0x5122,0x5143,0x5183,0x59C4,0x5A06,
-	0x6247,0x6268,0x6ACA,0x738D,0x7BAE,0x734C,0x6AEA,0x6ACA,
-	0x6ACA,0x6AC9,0x6A87,0x6A45,0x6A03,0x71E2,0x79E2,0x7A02,
-	0x8222,0x8A43,0x9283,0x9AC3,0xA2E3,0xB304,0xBB44,0xC385,
-	0xCBC5,0xD406,0xDC26,0xDC46,0xDC66,0xDC87,0xE4A7,0xE4C8,
-	0xE4E8,0xE508,0xE508,0xED29,0xED4A,0xED4A,0xED6A,0xED8B,
-	0xED8B,0xEDAB,0xEDAC,0xEDAC,0xEDCC,0xEDCC,0xEDCC,0xF5CD,
-	0xEDCD,0xEDCD,0xEDAD,0xEDAD,0xEDCD,0xF5CD,0xEDAD,0xEDAD,
-	0xED8D,0xED6C,0xE54C,0xE52B,0xE52B,0xE50A,0xE4EA,0xE4A9,
-	0xE4A9,0xDC88,0xDC68,0xDC47,0xDC26,0xDC05,0xDC25,0xE424,
-	0xE424,0xE403,0xE3E3,0xDBC3,0xDBA4,0xDBA4,0xDBA5,0xDBC5,
-	0xDBC5,0xDBC5,0xDBA4,0xDBA4,0xD384,0xD364,0xCB44,0xCB24,
-	0xC2E4,0xCAE4,0xCAC4,0xD2E5,0xDB26,0xE366,0xF4AC,0xFED8,
+	0xD4AB,0xC005,0x5CA4,0x530B,0x4B8B,0x0001,0xCB47,0xEBA8,
+	0xC00E,0xF4F4,0xB46A,0x6B53,0x0B03,0x040C,0x4C94,0xE4E5,
+	0xEC00,0x0004,0xC263,0xCAE3,0xDB43,0xE3C3,0xEC43,0xC006,
+	0xF4AC,0xAC94,0xA454,0x9600,0x8002,0xE3C6,0x0001,0xE3C5,
+	0xDBC5,0x8003,0xDBE4,0xC007,0x6C9C,0xACA5,0xADAD,0x9CBE,
+	0x0002,0xE590,0xEE76,0xE636,0x800A,0x9941,0x0001,0x9942,
+	0x9942,0x8015,0x9941,0x8002,0x9141,0x8004,0x9121,0x8003,
+	0x9141,0x0000,0x9941,0x8005,0x9961,0x8002,0x9962,0xC008,
+	0xA365,0xA3A4,0x64A4,0x9C64,0xA400,0x8002,0x7941,0x0000,
+	0x7141,0x8002,0x7941,0xC003,0xADB5,0xF5FD,0x0000,0x8AC7,
+	0xC003,0xFEFD,0xB6FF,0x0003,0xB533,0xC618,0xBDB5,0xACD1,
+	0xC026,0x8BAC,0x9B52,0x8881,0x8ADB,0xECAC,0xECAD,0xECEC,
+	0xECAC,0xADA4,0xACED,0xACA4,0xADAC,0xECAC,0xADAC,0xE46D,
+	0xECA5,0xACAC,0xA5A4,0xACA4,0xAD00,0x8007,0xEDAC,0xC01A,
+	0xA59C,0xA49B,0x9BA4,0x9C5B,0x9B9C,0x5C9B,0x9CA3,0x939C,
+	0xA3A3,0xECA3,0x9C54,0x9CA5,0x9CAC,0xA500,0x8003,0xDBA4,
+	0xC009,0x5C9C,0x5C9C,0x54DC,0xADE4,0xF4FD,0x0009,0xF4CD,
+	0xFEF9,0xFFDE,0xFF5B,0xFEF3,0xFECF,0xFEEF,0xF6AD,0xE60B,
+	0xDD4B,0xC006,0x445C,0x9C53,0x4B0B,0xD300,0x0001,0xCB67,
+	0xEBA8,0xC00E,0xF4F4,0xB46A,0xAB13,0x0A04,0x040C,0x8C54,
+	0xE4ED,0xE400,0x0004,0xC263,0xCAC3,0xDB43,0xE3C3,0xEC43,
+	0xC007,0xF4AC,0xAC9C,0x9C54,0x965D,0x8002,0xE3C6,0xC004,
+	0xA36B,0xA4AC,0xA400,0x8002,0xD404,0xC004,0xA5AD,0xAD9C,
+	0xB600,0x0002,0xE570,0xEE56,0xEE36,0x801F,0x9941,0x8002,
+	0x9141,0x0001,0x9121,0x9141,0x8005,0x9121,0x8004,0x9141,
+	0xC003,0xE4A4,0xACA5,0x8003,0x9961,0xC00B,0x64A4,0x5C64,
+	0x649C,0xA464,0xA464,0x5CA4,0x8004,0x5901,0xC008,0xACED,
+	0xADFD,0xF5B5,0xFEB5,0xB500,0x0003,0x83CE,0x9492,0x9492,
+	0x8BCE,0xC00F,0x52E4,0x5CA2,0x8A91,0xCBE3,0xE3B5,0xECE4,
+	0xF4ED,0xACF4,0x0000,0xD3C5,0xC01A,0xACED,0xACA4,0xACAC,
+	0xA5F4,0xADAC,0xACA4,0xEDAC,0xA5AC,0xACA5,0xACA4,0xA5A4,
+	0xACA4,0x9CAC,0x9C00,0x8003,0xEDAD,0xC027,0x9CA4,0x9BA4,
+	0x9B9C,0x5B9C,0x9B5C,0x9BA4,0x9C93,0xA39B,0xA3EC,0xA49B,
+	0x5C94,0xA59C,0xADA3,0xADA3,0x9CA4,0x5C9C,0x5C9C,0x53E5,
+	0x9CF5,0xEDF4,0x0009,0xF4AD,0xFEF9,0xFFDE,0xFF7B,0xFEF3,
+	0xFECF,0xFEEE,0xF6AD,0xE60B,0xDD4B,0xC006,0x4454,0xA453,
+	0x530B,0xCB00,0x0001,0xCB68,0xEBA8,0xC00F,0xFDB3,0xABB3,
+	0x6353,0x0A04,0x040C,0x9494,0x9CED,0xECEC,0x0003,0xCAC3,
+	0xDB44,0xE3C3,0xEC43,0xC007,0xF4AC,0xAC9C,0x9C55,0x955D,
+	0x8002,0xE3C6,0x0001,0xE3E5,0xDBE5,0x8002,0xDC04,0xC007,
+	0x64A3,0xA5A5,0xADAD,0x9CB5,0x0002,0xE56F,0xEE55,0xEE35,
+	0x801F,0x9941,0x800F,0x9141,0xC013,0xE4A4,0xACA5,0xA463,
+	0xA45C,0x6464,0x9C64,0x5C64,0x9C64,0xA45C,0xA463,0x8004,
+	0x48C1,0xC009,0xACA4,0xF5AD,0xB4F5,0xB6F5,0xADFE,0x0000,
+	0x738D,0xC010,0xED4A,0x4A9C,0xA4A3,0x9292,0x92DB,0xE4AC,
+	0xECED,0xF4F4,0xEC00,0x0000,0xB304,0xC015,0xF4F5,0xF4F5,
+	0xECAC,0xACAD,0xECAD,0xACAC,0xA4ED,0xADA4,0xACAD,0xA4AC,
+	0xA5A4,0x8002,0xEDCC,0xC01F,0xE564,0xA49C,0xA4AC,0xE45C,
+	0xA49C,0x9B5C,0x9BA4,0x9B9C,0x93A4,0x5B9C,0x9B9B,0x9BAC,
+	0xE3A4,0x9B9C,0x5C9D,0xA4A5,0x8002,0xDBC5,0xC00B,0x9BA4,
+	0x5C9C,0x5C9C,0x54E4,0x9CED,0xF5F4,0x0009,0xF4AC,0xFED8,
 	0xFFDE,0xFF5B,0xFEF4,0xFEEF,0xFEEE,0xF6AD,0xE60B,0xDD4B,
-	0xD4CB,0xCC8B,0xCC8B,0xC46A,0xBC09,0xABA8,0xB347,0xCB68,
-	0xEBA8,0xF409,0xFC48,0xFC68,0xF486,0xECA5,0xE464,0xD402,
-	0xC382,0xB302,0xA2A2,0xA262,0xA222,0xA202,0xAA23,0xB243,
-	0xC263,0xCAC3,0xDB44,0xE3C3,0xEC23,0xF483,0xF4A3,0xF4C3,
-	0xF4A3,0xF483,0xEC64,0xEC05,0xE3E6,0xE3C6,0xE3C6,0xE3E6,
-	0xE3E5,0xDBE5,0xDC04,0xDC05,0xDC04,0xDC04,0xD403,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD468,0xE54F,0xEE35,0xEE35,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9942,0x9942,
-	0x9942,0x9942,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9121,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9941,0x9161,0x9161,0x8941,0x8141,0x8121,0x7921,
-	0x7101,0x6901,0x60E1,0x58E1,0x50C1,0x50C1,0x48C1,0x48C1,
-	0x40C1,0x40A0,0x40A1,0x40A1,0x40A1,0x48C1,0x50C1,0x60C2,
-	0x7902,0x9124,0xB9C6,0xB8C2,0xD103,0xFA28,0xF965,0xF924,
-	0xF965,0xFA28,0xD145,0xC166,0xCAAA,0xA269,0x8A48,0x7A28,
-	0x6A48,0x6247,0x6226,0x59E5,0x59C3,0x59A2,0x5982,0x61A1,
-	0x61A2,0x69C2,0x71E2,0x7A22,0x8A63,0x92A3,0x9AE4,0xAB24,
-	0xB364,0xC385,0xC3C5,0xCC05,0xDC46,0xE487,0xE487,0xE4C8,
-	0xE4E8,0xE508,0xE508,0xED29,0xED4A,0xED4A,0xED6A,0xED8B,
-	0xEDAB,0xEDAC,0xEDAC,0xEDAC,0xEDCC,0xEDCC,0xEDCC,0xEDCD,
-	0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xEDAD,
-	0xEDAD,0xED8C,0xED6C,0xED4C,0xE52B,0xE50B,0xE4EA,0xE4C9,
-	0xDCA9,0xE4A9,0xDC68,0xDC48,0xDC27,0xDC06,0xDC05,0xE425,
-	0xE444,0xEC23,0xE403,0xDBC3,0xDBA4,0xDBA4,0xDBA5,0x8410,
-	0x7C10,0x8410,0x7C10,0x7C10,0x7C10,0x7C10,0x7C10,0x7C10,
-	0x7C10,0x7C10,0x7C10,0x7C10,0x7C10,0x7C10,0x83F0,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x83EF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7C10,0x7C10,0x8410,
-	0x7C10,0xBC0C,0xFC48,0xFC87,0xF4A6,0xF4A5,0xE464,0xD402,
-	0xC382,0xB302,0xA2A2,0xA262,0xA222,0xA202,0xAA23,0xB243,
-	0xC263,0xCAC4,0xD344,0xE3C3,0xEC23,0xF463,0xF4A3,0xF4C3,
-	0xF4A3,0xF483,0xF443,0xEC25,0xE3E6,0xE3C6,0xE3C6,0xE3E6,
-	0xE3E5,0xDBE5,0xDC04,0xDC05,0xDC04,0xDC04,0xD403,0xD404,
-	0xD405,0xD426,0xD447,0xD427,0xD448,0xDD4F,0xEE35,0xE635,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9942,0x9942,
-	0x9942,0x9942,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9921,0x9921,0x9141,0x9121,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x8941,0x8921,0x8121,0x7921,0x7101,0x6901,0x60E1,
-	0x58E0,0x50C1,0x48C0,0x48C0,0x40A0,0x40A0,0x40A1,0x48A1,
-	0x58C1,0x70C2,0x88C2,0xA0A2,0xB8A2,0xC882,0xD861,0xE041,
-	0xF041,0xF020,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xF041,0xF061,0xE882,
-	0xD8A2,0xD0E3,0xC124,0xA944,0x9163,0x8163,0x6942,0x6162,
-	0x5982,0x5982,0x5982,0x61A2,0x69E2,0x7202,0x8243,0x8A83,
-	0x9AC4,0xA304,0xAB44,0xBB85,0xC3E5,0xD426,0xDC87,0xE4A7,
-	0xE4E8,0xE508,0xE508,0xE529,0xED4A,0xED4A,0xED6A,0xED8B,
-	0xEDAB,0xEDAC,0xEDAC,0xEDAC,0xEDCC,0xEDEC,0xF5CD,0xEDCD,
-	0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xEDCE,0xEDCE,0xEDCE,0xEDCD,
-	0xEDAD,0xED8D,0xED8C,0xE54C,0xE52B,0xE50B,0xE4EA,0xE4CA,
-	0xDCA9,0xDCA9,0xDC88,0xDC48,0xDC47,0xDC26,0xDC25,0xDC24,
-	0xE424,0xE423,0xE403,0xE3C3,0xDBA4,0xDBA4,0xDBA4,0x245A,
-	0x243A,0x243A,0x245B,0x245B,0x2C7B,0x2C9B,0x34BB,0x34BB,
-	0x351B,0x351B,0x351A,0x2CFA,0x24D9,0x1C99,0x0B74,0x0148,
-	0x0042,0x0084,0x010B,0x010F,0x0111,0x0952,0x19F3,0x22B4,
-	0x2B34,0x3374,0x3374,0x3B95,0x43F6,0x5456,0x4C97,0x2C77,
-	0x1436,0x7BEF,0xF448,0xFC68,0xF4A6,0xF4A5,0xE463,0xD402,
-	0xC382,0xB302,0xA2A1,0xA242,0xA222,0xA202,0xAA23,0xB243,
-	0xC263,0xCAC4,0xDB24,0xE3A3,0xEC23,0xF483,0xF4A3,0xF4C3,
-	0xF4A3,0xF483,0xF463,0xEC25,0xE3E6,0xE3E6,0xE3C6,0xE3E6,
-	0xE3E5,0xDBE5,0xDC05,0xDC04,0xDC04,0xDC04,0xD404,0xD404,
-	0xD425,0xD426,0xD447,0xD427,0xD468,0xE52F,0xEE14,0xEE35,
-	0x9941,0x9941,0x9941,0x9942,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9962,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9921,0x9921,0x9921,0x9141,0x9141,0x9141,0x9121,0x9121,
-	0x9121,0x9121,0x9121,0x9121,0x9121,0x9121,0x9121,0x8921,
-	0x8121,0x7921,0x7101,0x6901,0x60E1,0x58E1,0x50C1,0x50C1,
-	0x48A1,0x40A1,0x40A1,0x50C1,0x68C2,0x88E2,0xB0C2,0xD0A2,
-	0xF061,0xF841,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xF841,0xE881,0xD8C2,
-	0xB923,0x9943,0x7962,0x6982,0x5982,0x61A2,0x69E2,0x6A02,
-	0x7A23,0x8263,0x8AC3,0x9AE4,0xAB65,0xBBC5,0xCC26,0xD467,
-	0xE4C8,0xE508,0xE508,0xE529,0xED4A,0xED4A,0xED6A,0xED8B,
-	0xED8B,0xEDAC,0xEDAC,0xEDCC,0xEDCC,0xF5ED,0xEDCD,0xF5CD,
-	0xEDCD,0xEDCD,0xEDCD,0xEDCD,0xF5EE,0xEDCE,0xEDCE,0xEDCE,
-	0xEDAD,0xEDAD,0xED8D,0xED6C,0xE52C,0xE52B,0xE50B,0xE4EA,
-	0xE4CA,0xE4CA,0xDC89,0xDC48,0xDC47,0xDC26,0xDC05,0xDC25,
-	0xE424,0xE424,0xE403,0xE3E4,0xE3C4,0xDBA4,0xDBA4,0x245A,
-	0x243A,0x243B,0x243B,0x245B,0x2C7B,0x2C9B,0x34BB,0x34DB,
-	0x351B,0x351B,0x351A,0x2CFA,0x24D9,0x1C99,0x0B74,0x0148,
-	0x0042,0x0083,0x010B,0x010F,0x0910,0x0952,0x19F3,0x2294,
-	0x2B34,0x3354,0x3374,0x3B95,0x43F6,0x5456,0x4C97,0x2C77,
-	0x1436,0x7BEF,0xFC48,0xFC88,0xF4A6,0xECA4,0xE483,0xD402,
-	0xC382,0xB322,0xA2A2,0xA242,0xA222,0xA222,0xAA23,0xB243,
-	0xC283,0xCAC4,0xDB44,0xE3A3,0xEC23,0xF463,0xF4A3,0xF4C3,
-	0xF4A3,0xF4A3,0xEC63,0xEC25,0xE3E6,0xE3E6,0xE3E6,0xE3E6,
-	0xE3E5,0xE405,0xDC04,0xDC04,0xDC04,0xDC04,0xD404,0xD404,
-	0xD405,0xD426,0xD447,0xD428,0xD468,0xDD2E,0xEE14,0xE614,
-	0x9921,0x9941,0x9941,0x9942,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9962,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9121,0x9121,
-	0x9121,0x9121,0x9121,0x9121,0x9121,0x8921,0x8121,0x8121,
-	0x7101,0x68E1,0x60E1,0x58C1,0x50C1,0x48A1,0x40A0,0x48A1,
-	0x58C1,0x80E2,0xA8C2,0xD0A2,0xF061,0xF840,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF841,0xF081,0xD8C2,0xB123,0x9163,0x6982,0x61A2,
-	0x61C2,0x69E2,0x7223,0x7A63,0x8AC4,0xA324,0xB385,0xC3E6,
-	0xCC47,0xDCC8,0xE4E8,0xE529,0xED4A,0xED6A,0xED6A,0xED8B,
-	0xED8B,0xEDAC,0xEDAC,0xEDCC,0xEDCD,0xEDCD,0xF5CD,0xF5CD,
-	0xF5CD,0xF5CD,0xEDCD,0xEDCE,0xEDEE,0xEDEE,0xEDCE,0xEDCE,
-	0xEDAE,0xEDAE,0xEDAD,0xED6D,0xE54C,0xE52B,0xE50B,0xE4EA,
-	0xE4CA,0xE4CA,0xDCA9,0xDC68,0xDC48,0xDC27,0xDC06,0xDC25,
-	0xE424,0xE424,0xE423,0xE3E4,0xE3C4,0xDBA4,0xDBA4,0x243A,
-	0x243A,0x243A,0x243A,0x245B,0x2C5B,0x2C9B,0x34BB,0x34DB,
-	0x351B,0x351B,0x351B,0x2CFA,0x24D9,0x1C98,0x0B74,0x0169,
-	0x0042,0x0084,0x00EB,0x010F,0x0111,0x0952,0x19F3,0x22B4,
-	0x2B14,0x2B54,0x3374,0x3B95,0x43F6,0x5436,0x4C97,0x2C77,
-	0x1416,0x7BEF,0xFC48,0xFC88,0xF4A6,0xECA4,0xE463,0xD402,
-	0xC382,0xB322,0xA2A2,0xA242,0xA222,0xA202,0xAA23,0xB243,
-	0xC283,0xCAC4,0xDB24,0xE3A3,0xEC23,0xEC63,0xF4A3,0xF4C3,
-	0xF4A3,0xF4A3,0xF463,0xEC25,0xE3E6,0xE3E6,0xE3E6,0xE3E6,
-	0xE3E5,0xE405,0xDC04,0xDC04,0xDC04,0xDC04,0xD404,0xD404,
-	0xD425,0xD426,0xD447,0xD428,0xD468,0xDD0E,0xE5F3,0xE614,
-	0x9921,0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9121,
-	0x9121,0x9121,0x9121,0x8921,0x8121,0x7901,0x70E1,0x68E1,
-	0x58E1,0x50C1,0x48A1,0x40A1,0x48C1,0x58C1,0x80E2,0xB0A2,
-	0xE0A2,0xF861,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xF861,0xE0A2,0xC102,
-	0x9183,0x71A2,0x61E3,0x6A03,0x7223,0x8284,0x92E4,0xA365,
-	0xB3C6,0xC447,0xCC88,0xDCC9,0xE529,0xED4A,0xED6A,0xED8B,
-	0xED8B,0xEDAC,0xEDAC,0xEDCC,0xEDCD,0xF5CD,0xF5EE,0xF5CE,
-	0xF5EE,0xF5CD,0xEDCD,0xF5EE,0xEDEE,0xEDEF,0xEDCE,0xEDCE,
-	0xEDCE,0xEDAE,0xEDAE,0xED8D,0xE54C,0xE52C,0xE52B,0xE4EB,
-	0xE4EA,0xE4EA,0xDCA9,0xDC68,0xDC48,0xDC27,0xDC26,0xDC05,
-	0xE425,0xE424,0xE423,0xE404,0xE3C4,0xDBC4,0xDBC4,0x245B,
-	0x243A,0x243A,0x243A,0x245B,0x2C5B,0x2C9B,0x2C9B,0x34BB,
-	0x34FB,0x351B,0x351A,0x2CFA,0x24B9,0x1C99,0x1395,0x0169,
-	0x0042,0x0084,0x00EB,0x010F,0x0111,0x0952,0x19F3,0x2294,
-	0x2B14,0x2B54,0x3354,0x3B95,0x43F6,0x5436,0x4C77,0x2C77,
-	0x1416,0x7BEF,0xFC68,0xFC88,0xF4A6,0xF4A5,0xE463,0xD402,
-	0xC382,0xB322,0xA2A2,0xA262,0xA222,0xA222,0xAA23,0xBA63,
-	0xC283,0xCAC4,0xDB24,0xE3A3,0xEC23,0xEC63,0xF4A3,0xF4C3,
-	0xF4C3,0xF4A3,0xF463,0xEC25,0xE406,0xE3E6,0xE3E6,0xE3E6,
-	0xE405,0xE405,0xE404,0xDC04,0xDC04,0xDC04,0xD404,0xD404,
-	0xD425,0xD426,0xD447,0xD448,0xD468,0xDD0E,0xEDF3,0xE614,
-	0x9921,0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9942,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9121,0x8921,0x8121,0x7901,0x70E1,0x68E1,0x58C1,0x58A0,
-	0x48A0,0x48A0,0x48A1,0x68C2,0xA0C2,0xE0A2,0xF861,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xF861,0xE0C2,0xB143,0x79A3,0x69E3,0x6A03,0x7264,0x82A4,
-	0x9325,0xA386,0xB3E7,0xC448,0xD4A9,0xDD09,0xE56B,0xED8B,
-	0xEDAB,0xEDAC,0xF5CC,0xEDCC,0xEDED,0xEDED,0xF5EE,0xF5EE,
-	0xF5EE,0xF5EE,0xF5EE,0xEDEE,0xF5EE,0xF5EF,0xEDCF,0xEDCE,
-	0xEDCE,0xEDCE,0xEDAE,0xED8E,0xE56D,0xE54C,0xE52C,0xE50B,
-	0xE4EA,0xE4EA,0xDCAA,0xDC89,0xDC48,0xDC47,0xDC26,0xDC05,
-	0xE425,0xE444,0xE424,0xE404,0xE3E4,0xDBC4,0xDBA4,0x243A,
-	0x243A,0x243A,0x245B,0x243B,0x2C5B,0x2C7B,0x2CBB,0x34BB,
-	0x34FB,0x351B,0x351A,0x2CFA,0x24BA,0x1C99,0x1395,0x018A,
-	0x0042,0x0063,0x00EB,0x012F,0x08F1,0x1152,0x19F3,0x22B3,
-	0x2B34,0x2B54,0x3354,0x3B95,0x43D5,0x5436,0x4477,0x2C56,
-	0x1416,0x83F0,0xFC69,0xFC88,0xF4A6,0xECC4,0xE483,0xD403,
-	0xC382,0xB322,0xA2A1,0xA262,0xA222,0xA222,0xB223,0xBA43,
-	0xC283,0xCAC4,0xDB24,0xE3A4,0xEC23,0xEC63,0xF4A3,0xF4C3,
-	0xF4C3,0xF4A3,0xF483,0xEC44,0xE405,0xE3E6,0xE3E6,0xE3E5,
-	0xE405,0xE405,0xE404,0xDC24,0xDC24,0xDC04,0xD404,0xD404,
-	0xD425,0xD426,0xD446,0xD428,0xD468,0xDD0E,0xEDF3,0xE5F3,
-	0x9921,0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9942,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9141,0x9121,0x9121,0x9121,0x8921,
-	0x8121,0x7901,0x70E1,0x68E1,0x60C1,0x50A1,0x4880,0x40A0,
-	0x50C1,0x80C2,0xC0C2,0xF862,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xF861,0xC903,0x9183,0x7203,0x6A23,
-	0x7284,0x82E5,0x9345,0xA3A6,0xB427,0xC468,0xD4EA,0xDD4B,
-	0xE58B,0xEDAC,0xF5CC,0xEDCD,0xF5ED,0xF5ED,0xF5EE,0xF5CE,
-	0xEDEE,0xEDEE,0xEDEE,0xEDEE,0xEDEE,0xEDEF,0xEDEE,0xEDEE,
-	0xEDCF,0xEDCF,0xEDCE,0xEDAE,0xED6D,0xE54C,0xE54C,0xE50B,
-	0xE4EB,0xE4EB,0xDCCA,0xDC89,0xDC68,0xDC47,0xDC26,0xDC06,
-	0xE425,0xE424,0xE424,0xE403,0xE3E4,0xDBC4,0xDBC4,0x245A,
-	0x243A,0x243A,0x243A,0x243B,0x245B,0x2C7B,0x2CBB,0x34BB,
-	0x34FB,0x351B,0x2D1A,0x2CFA,0x24B9,0x1C99,0x1394,0x01AA,
-	0x0063,0x0083,0x00EB,0x012F,0x08F1,0x0932,0x19F3,0x2293,
-	0x2B34,0x2B54,0x3354,0x3B95,0x43D5,0x5416,0x4476,0x2C56,
-	0x13F6,0x83EF,0xF489,0xFC88,0xF4A6,0xECC5,0xE484,0xD403,
-	0xC382,0xB322,0xA2C2,0xA262,0xA222,0xAA22,0xB223,0xBA63,
-	0xC283,0xCAC4,0xD324,0xE3A3,0xEC23,0xEC63,0xF4A3,0xF4C3,
-	0xF4A3,0xF4A3,0xF484,0xEC44,0xEC06,0xE3E6,0xE3E6,0xE405,
-	0xE405,0xE405,0xE404,0xDC24,0xDC24,0xDC24,0xD404,0xD424,
-	0xD425,0xD426,0xD446,0xD428,0xD448,0xDD0D,0xE5D3,0xE5F3,
-	0x9921,0x9921,0x9941,0x9941,0x9941,0x9941,0x9941,0x9942,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9941,0x9941,0x9961,0x9961,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x9141,0x9121,0x8921,0x8121,0x7901,
-	0x70E1,0x68E1,0x60C1,0x50A0,0x4880,0x4080,0x50A1,0x90E2,
-	0xD8C2,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xE103,0xA983,
+	0xC006,0x4454,0xA45B,0x4B0B,0xCB00,0x0001,0xCB68,0xEBA8,
+	0xC00E,0xFDF3,0xAC6A,0x6B53,0x0A04,0x040C,0x9494,0x9CED,
+	0xEC00,0x0003,0xC263,0xCAC3,0xDB44,0xE3C3,0xC018,0xFCFC,
+	0xACAC,0x9C9C,0x5D8D,0x5D9C,0xA4AC,0xA364,0xABA5,0xA3A4,
+	0x63A5,0xA5AD,0xAD9C,0xB500,0x0002,0xE54F,0xEE35,0xEE35,
+	0x800D,0x9941,0x8003,0x9942,0x8006,0x9941,0x0001,0x9961,
+	0x9961,0x8004,0x9941,0x8002,0x9141,0x0000,0x9121,0x800B,
+	0x9141,0xC011,0xE4A4,0x6CA4,0x5C64,0x9C64,0x5C64,0x5C64,
+	0x5CA4,0x64A4,0x649B,0x8002,0x40A1,0x0011,0x48C1,0x50C1,
+	0x60C2,0x7902,0x9124,0xB9C6,0xB8C2,0xD103,0xFA28,0xF965,
+	0xF924,0xF965,0xFA28,0xD145,0xC166,0xCAAA,0xA269,0x8A48,
+	0xC00C,0x1C2C,0x639B,0x539A,0x9B9C,0xEBA5,0xECEC,0xF400,
+	0x0008,0x8A63,0x92A3,0x9AE4,0xAB24,0xB364,0xC385,0xC3C5,
+	0xCC05,0xDC46,0xC00B,0xF5A4,0xB5AC,0xACA4,0xEDAD,0xA4AC,
+	0xADAC,0x8002,0xEDAC,0x8002,0xEDCC,0x8007,0xEDCD,0xC017,
+	0x9CA4,0x9B9C,0x9C5B,0x9C9B,0x9B5C,0xE453,0x9C9B,0x9BA3,
+	0xECAB,0xDB5C,0x549D,0xA4A5,0x0002,0x8410,0x7C10,0x8410,
+	0x800B,0x7C10,0x0000,0x83F0,0x8003,0x7BEF,0x0000,0x83EF,
+	0x8008,0x7BEF,0xC003,0xADA4,0xE464,0x0001,0xBC0C,0xFC48,
+	0xC00C,0xB36B,0xA313,0x0A04,0x040C,0x9494,0x9CED,0xEC00,
+	0x0003,0xC263,0xCAC4,0xD344,0xE3C3,0xC018,0xFCF4,0xB4AC,
+	0x9C9C,0x945E,0x559C,0xA4AC,0xA364,0xABA5,0xA3A4,0x63A5,
+	0xA5AD,0xAD9C,0xAD00,0x0002,0xDD4F,0xEE35,0xE635,0x800D,
+	0x9941,0x8003,0x9942,0x8006,0x9941,0x0001,0x9961,0x9961,
+	0x8004,0x9941,0xC003,0x9CA4,0x6C9C,0x800C,0x9141,0xC00E,
+	0x649C,0x6464,0x5C64,0x5C63,0x5D63,0xA45C,0xA4A5,0xE400,
+	0x000A,0x58C1,0x70C2,0x88C2,0xA0A2,0xB8A2,0xC882,0xD861,
+	0xE041,0xF041,0xF020,0xF820,0x8008,0xF800,0xC006,0xAC6D,
+	0xAC6D,0x2C75,0x3500,0x0004,0xA944,0x9163,0x8163,0x6942,
+	0x6162,0x8002,0x5982,0x000A,0x61A2,0x69E2,0x7202,0x8243,
+	0x8A83,0x9AC4,0xA304,0xAB44,0xBB85,0xC3E5,0xD426,0xC00A,
+	0xFDEC,0xB5AC,0xA4AD,0xEDA4,0xACAD,0xAC00,0x8002,0xEDAC,
+	0x0002,0xEDCC,0xEDEC,0xF5CD,0x8004,0xEDCD,0x8002,0xEDCE,
+	0xC014,0xA39C,0x9CA3,0x549B,0x9C9B,0x9C5B,0xA49B,0x94A3,
+	0x9BA3,0xA3E4,0xA39C,0x9400,0x8002,0xDBA4,0x0000,0x245A,
+	0xC00D,0x9CA4,0xADA4,0xECAC,0xECA4,0xBCA4,0xA35C,0x5B54,
+	0x000A,0x0B74,0x0148,0x0042,0x0084,0x010B,0x010F,0x0111,
+	0x0952,0x19F3,0x22B4,0x2B34,0xC003,0xF4A4,0xEDFD,0x0005,
+	0x5456,0x4C97,0x2C77,0x1436,0x7BEF,0xF448,0xC00C,0xEC72,
+	0xA312,0x0B04,0x040B,0x8D9C,0x9CED,0xEC00,0x0004,0xC263,
+	0xCAC4,0xDB24,0xE3A3,0xEC23,0xC00D,0xFCAC,0xAC9C,0x9C9C,
+	0x5655,0xA49C,0xACA3,0x64AC,0x8002,0xDC04,0xC006,0x64A4,
+	0xADA5,0xAD9C,0xB500,0x0002,0xE52F,0xEE14,0xEE35,0x8002,
+	0x9941,0x0000,0x9942,0x800C,0x9941,0x0000,0x9962,0x800D,
+	0x9941,0x8002,0x9921,0x8002,0x9141,0x8008,0x9121,0xC00B,
+	0x6464,0x645C,0x645C,0x645C,0xA45C,0x64A4,0x0007,0x50C1,
+	0x68C2,0x88E2,0xB0C2,0xD0A2,0xF061,0xF841,0xF820,0x8018,
+	0xF800,0xC003,0xACAD,0x3435,0x0002,0xB923,0x9943,0x7962,
+	0xC004,0x2C24,0xECF4,0xAC00,0x0008,0x7A23,0x8263,0x8AC3,
+	0x9AE4,0xAB65,0xBBC5,0xCC26,0xD467,0xE4C8,0xC00E,0xB4A4,
+	0xADED,0xA4AC,0xADA4,0xADA4,0xACA4,0xED5C,0xE400,0x8003,
+	0xEDCD,0x0000,0xF5EE,0x8002,0xEDCE,0xC016,0x9BA4,0x9C9B,
+	0x54A3,0x9C9B,0x9CA4,0x5393,0xA39B,0x9BAC,0xE3A4,0x9B9D,
+	0x9C5C,0xA400,0x0000,0x245A,0xC00D,0x9CA5,0xA4AC,0xECAC,
+	0xECAC,0xB4A4,0xA35C,0x5B54,0x000A,0x0B74,0x0148,0x0042,
+	0x0083,0x010B,0x010F,0x0910,0x0952,0x19F3,0x2294,0x2B34,
+	0xC003,0xECAC,0xEDFD,0x0005,0x5456,0x4C97,0x2C77,0x1436,
+	0x7BEF,0xFC48,0xC00C,0xB46A,0x625B,0x0304,0x0C04,0x8C9C,
+	0xA4E5,0xEC00,0x0004,0xC283,0xCAC4,0xDB44,0xE3A3,0xEC23,
+	0xC006,0xF4B4,0xAC9C,0xA454,0x9600,0x8003,0xE3E6,0x0001,
+	0xE3E5,0xE405,0x8003,0xDC04,0xC006,0x64A4,0xA5AD,0xAD9D,
+	0xB400,0x0006,0xDD2E,0xEE14,0xE614,0x9921,0x9941,0x9941,
+	0x9942,0x800C,0x9941,0x0000,0x9962,0x800E,0x9941,0x8004,
+	0x9141,0x8006,0x9121,0xC00A,0x6464,0xA41C,0x5C64,0x5C64,
+	0x5C63,0xE500,0x0006,0x58C1,0x80E2,0xA8C2,0xD0A2,0xF061,
+	0xF840,0xF820,0x8021,0xF800,0x0005,0xF841,0xF081,0xD8C2,
+	0xB123,0x9163,0x6982,0xC004,0x6CAC,0xECF5,0xF400,0x0005,
+	0x8AC4,0xA324,0xB385,0xC3E6,0xCC47,0xDCC8,0xC00B,0xECB5,
+	0xEDAC,0xA4AD,0xA4AD,0xA4AC,0xA5A4,0x8003,0xF5CD,0xC01C,
+	0x64A5,0xACA4,0x9CA4,0x9CA4,0xA394,0x5B9B,0x9C9B,0x9CA4,
+	0x5B93,0x9C9B,0x9BAB,0xE3A4,0xA395,0x9C5C,0xA400,0x8003,
+	0x243A,0xC004,0xADE4,0xB4EC,0xAC00,0x8002,0x351B,0x000C,
+	0x2CFA,0x24D9,0x1C98,0x0B74,0x0169,0x0042,0x0084,0x00EB,
+	0x010F,0x0111,0x0952,0x19F3,0x22B4,0xC004,0xFCB4,0xECED,
+	0xFD00,0x0005,0x5436,0x4C97,0x2C77,0x1416,0x7BEF,0xFC48,
+	0xC00C,0xB46A,0x6253,0x0B04,0x0C04,0x8C9C,0x9CED,0xEC00,
+	0x0004,0xC283,0xCAC4,0xDB24,0xE3A3,0xEC23,0xC006,0xB4F4,
+	0xAC9C,0xA494,0x5600,0x8003,0xE3E6,0x0001,0xE3E5,0xE405,
+	0x8003,0xDC04,0xC006,0x64A4,0xADA5,0xAD9D,0xB400,0x0004,
+	0xDD0E,0xE5F3,0xE614,0x9921,0x9921,0x801E,0x9941,0x8005,
+	0x9141,0x8003,0x9121,0xC009,0x6464,0x5C5C,0x6424,0x5C5C,
+	0x64EC,0x0005,0x58C1,0x80E2,0xB0A2,0xE0A2,0xF861,0xF820,
+	0x8028,0xF800,0x000F,0xF820,0xF861,0xE0A2,0xC102,0x9183,
+	0x71A2,0x61E3,0x6A03,0x7223,0x8284,0x92E4,0xA365,0xB3C6,
+	0xC447,0xCC88,0xDCC9,0xC011,0xFCED,0xACAD,0xA4AD,0xA4AC,
+	0xA5E4,0xAD9C,0xAC9B,0x64ED,0x64A5,0x8002,0xEDCE,0xC015,
+	0x9CA4,0x9B53,0x9CA3,0x94A3,0xA453,0x939C,0x9BA3,0x9BEC,
+	0xA3A3,0x9D94,0x64A4,0x0000,0x245B,0x8002,0x243A,0xC00A,
+	0xADE4,0xB4A4,0xECB4,0xACA3,0x5C53,0x5C00,0x000A,0x1395,
+	0x0169,0x0042,0x0084,0x00EB,0x010F,0x0111,0x0952,0x19F3,
+	0x2294,0x2B14,0xC003,0xB4E4,0xF5FD,0x0005,0x5436,0x4C77,
+	0x2C77,0x1416,0x7BEF,0xFC68,0xC00B,0xAC6A,0xA312,0x0B04,
+	0x0C04,0x9494,0xA4E5,0x0005,0xBA63,0xC283,0xCAC4,0xDB24,
+	0xE3A3,0xEC23,0xC007,0xB4F4,0xACA4,0x9C94,0x565D,0x8002,
+	0xE3E6,0x0002,0xE405,0xE405,0xE404,0x8002,0xDC04,0xC006,
+	0x64A4,0xADA5,0xADA5,0xAC00,0x0004,0xDD0E,0xEDF3,0xE614,
+	0x9921,0x9921,0x8004,0x9941,0x0000,0x9942,0x8017,0x9941,
+	0x8007,0x9141,0xC00A,0x9C64,0x645C,0x5C64,0x1C9B,0x24A4,
+	0xA500,0x0004,0x68C2,0xA0C2,0xE0A2,0xF861,0xF820,0x802E,
+	0xF800,0x000D,0xF820,0xF861,0xE0C2,0xB143,0x79A3,0x69E3,
+	0x6A03,0x7264,0x82A4,0x9325,0xA386,0xB3E7,0xC448,0xD4A9,
+	0xC008,0xFCFE,0xECAC,0xA5EC,0x64AD,0xA400,0x8004,0xF5EE,
+	0xC003,0x64E4,0xA55C,0x8002,0xEDCE,0xC014,0x9C9C,0x5B9B,
+	0x9C9B,0x9BA4,0x549B,0x93A3,0x9B9B,0xECAB,0x9C9C,0x9C5C,
+	0x9C00,0x8002,0x243A,0xC00B,0xAD9C,0xECAC,0xB4E4,0xB4AC,
+	0xA35C,0x545B,0x000A,0x1395,0x018A,0x0042,0x0063,0x00EB,
+	0x012F,0x08F1,0x1152,0x19F3,0x22B3,0x2B34,0xC003,0xACE4,
+	0xF5F4,0x0005,0x5436,0x4477,0x2C56,0x1416,0x83F0,0xFC69,
+	0xC00A,0xAB6A,0x6A53,0x0403,0x0C03,0x9594,0xA400,0x0006,
+	0xB223,0xBA43,0xC283,0xCAC4,0xDB24,0xE3A4,0xEC23,0xC017,
+	0xB4F4,0xACA4,0x9C9C,0x5555,0x9DA4,0xA3AC,0xA4A3,0x6CA4,
+	0x9C64,0xA4AD,0xA5AC,0x9EB4,0x0004,0xDD0E,0xEDF3,0xE5F3,
+	0x9921,0x9921,0x8004,0x9941,0x0000,0x9942,0x8017,0x9941,
+	0x8003,0x9141,0x8002,0x9121,0xC008,0x6464,0x5C5C,0x645C,
+	0x1C5B,0x6C00,0x0004,0x50C1,0x80C2,0xC0C2,0xF862,0xF820,
+	0x8034,0xF800,0x000C,0xF820,0xF861,0xC903,0x9183,0x7203,
+	0x6A23,0x7284,0x82E5,0x9345,0xA3A6,0xB427,0xC468,0xD4EA,
+	0xC008,0xFDF4,0xEDEC,0x65EC,0xA4A5,0x9C00,0x8004,0xEDEE,
+	0xC019,0xA5A3,0xA49D,0xA4A3,0x9C93,0x5BA4,0x939C,0xA45B,
+	0x939B,0x9B9B,0x9CEB,0xA3A4,0x9B9D,0x5CA4,0x0000,0x245A,
+	0x8002,0x243A,0xC00A,0xA5AC,0xECB4,0xE4B4,0xAC63,0x9C53,
+	0x5C00,0x000A,0x1394,0x01AA,0x0063,0x0083,0x00EB,0x012F,
+	0x08F1,0x0932,0x19F3,0x2293,0x2B34,0xC003,0xACE4,0xF5F4,
+	0x0005,0x5416,0x4476,0x2C56,0x13F6,0x83EF,0xF489,0xC00F,
+	0xE36A,0x6B53,0x0303,0x0C0C,0x8C94,0xE4E5,0xF4EC,0xF5FC,
+	0x0001,0xE3A3,0xEC23,0xC009,0xB4F4,0xAC9C,0xA49D,0x5496,
+	0x5CA4,0x8002,0xE405,0x0000,0xE404,0x8002,0xDC24,0xC006,
+	0x5CAC,0xA5A5,0xAC9E,0xAC00,0x0004,0xDD0D,0xE5D3,0xE5F3,
+	0x9921,0x9921,0x8004,0x9941,0x0000,0x9942,0x8010,0x9941,
+	0xC006,0xAC9C,0xA4AC,0xA49C,0xA400,0x8003,0x9141,0xC009,
+	0x9C64,0x645C,0x5C64,0x5C1B,0x5C64,0x0003,0x50A1,0x90E2,
+	0xD8C2,0xF841,0x803A,0xF800,0x000C,0xF841,0xE103,0xA983,
 	0x7203,0x6A64,0x7A84,0x82E5,0x9346,0xABC7,0xBC49,0xC4A9,
-	0xD50A,0xE56C,0xEDAC,0xEDCD,0xF5ED,0xF5ED,0xF5EE,0xF5EE,
-	0xEDEE,0xEDEE,0xEDEE,0xEDEE,0xEDEF,0xEE0F,0xEDEF,0xEDEF,
-	0xEDEF,0xEDCF,0xEDCE,0xEDAE,0xED8D,0xED6D,0xE54C,0xE52C,
-	0xE50B,0xE4EB,0xDCCA,0xDC89,0xDC68,0xDC48,0xDC27,0xDC26,
-	0xE425,0xE424,0xE424,0xE423,0xE3E4,0xDBC4,0xDBC4,0xDBC5,
-	0xDBC5,0xDBC5,0xDBC5,0xDBC5,0xDBA4,0xD384,0xD364,0xCB44,
-	0xCB24,0xCAE4,0xD2E5,0xD305,0xDB46,0xE386,0xEC4A,0xFE55,
-	0xFF9C,0xFF7B,0xFF15,0xFEF0,0xBD8F,0x3251,0x19F3,0x22B3,
-	0x2B14,0x2B54,0x3354,0x3B95,0x43D5,0x4C16,0x4456,0x2C56,
-	0x2BF4,0xBC2D,0xFC69,0xFC88,0xF4A6,0xECA5,0xE483,0xD402,
-	0xC382,0xB322,0xA2A1,0xA262,0xA222,0xA222,0xB223,0xBA63,
-	0xC283,0xCAC4,0xD324,0xE3A4,0xEC03,0xEC63,0xF4A3,0xF4C3,
-	0xF4C3,0xF4A3,0xF484,0xEC44,0xE406,0xE3E6,0xE3E6,0xE405,
-	0xE405,0xE405,0xE404,0xDC24,0xDC24,0xDC24,0xDC24,0xD424,
-	0xD425,0xD426,0xD446,0xD448,0xD448,0xDCED,0xE5D3,0xE5F3,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9961,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9941,
-	0x9141,0x9141,0x9141,0x9141,0x8921,0x8121,0x70E1,0x68E1,
-	0x60C1,0x50C0,0x48A0,0x48A0,0x50C1,0x98A2,0xD881,0xF841,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,
-	0xE0A2,0xA963,0x7224,0x6A64,0x7AA5,0x8306,0x9B87,0xAC08,
-	0xBC89,0xCCEA,0xDD6B,0xEDAD,0xF5ED,0xEDED,0xEDEE,0xEDEE,
-	0xEDEE,0xEDEE,0xEDEE,0xEDEE,0xEE0F,0xEE0F,0xEDEF,0xEDEF,
-	0xEDEF,0xEDEF,0xEDCF,0xEDAE,0xED8E,0xED6D,0xE56D,0xE52C,
-	0xE50B,0xE50B,0xE4CB,0xDCAA,0xDC89,0xDC48,0xDC27,0xDC26,
-	0xE425,0xE425,0xEC44,0xE403,0xE404,0xE3E4,0xDBC4,0xDBC4,
-	0xDBC5,0xDBC5,0xDBC5,0xDBC4,0xDBA4,0xD384,0xD364,0xCB44,
-	0xCB04,0xCAE4,0xD2E5,0xD305,0xDB46,0xE366,0xF449,0xFE54,
+	0xD50A,0xE56C,0xC005,0xF4AD,0xECA4,0xA5A4,0x8003,0xEDEE,
+	0x0001,0xEDEF,0xEE0F,0x8002,0xEDEF,0xC015,0x9CA3,0x9C9B,
+	0x9C5B,0x9C9B,0x9C5B,0x939B,0x9C9B,0xA3E3,0xA3A4,0xA395,
+	0x5CA4,0x8004,0xDBC5,0xC009,0x9B5C,0x9C5C,0x9C94,0xE5AC,
+	0xF5F4,0x0009,0xEC4A,0xFE55,0xFF9C,0xFF7B,0xFF15,0xFEF0,
+	0xBD8F,0x3251,0x19F3,0x22B3,0xC006,0xFDB4,0xE4F5,0xF4F5,
+	0x7400,0x0003,0x2C56,0x2BF4,0xBC2D,0xFC69,0xC00A,0xAB6A,
+	0x635A,0x0304,0x0C03,0x9594,0xA400,0x0000,0xB223,0xC003,
+	0xF4EC,0xF5FC,0x0000,0xE3A4,0xC00A,0xFBBC,0xF4AC,0xA49C,
+	0x9D54,0x569C,0xA400,0x8002,0xE405,0x0000,0xE404,0x8003,
+	0xDC24,0xC005,0x64A5,0xA5AC,0xA6A4,0x0002,0xDCED,0xE5D3,
+	0xE5F3,0x8012,0x9941,0x0000,0x9961,0x8008,0x9941,0x0002,
+	0x9961,0x9961,0x9941,0x8003,0x9141,0xC008,0x5C64,0x1464,
+	0x5C23,0x5CA4,0xED00,0x0002,0x98A2,0xD881,0xF841,0x803E,
+	0xF800,0x000E,0xF841,0xE0A2,0xA963,0x7224,0x6A64,0x7AA5,
+	0x8306,0x9B87,0xAC08,0xBC89,0xCCEA,0xDD6B,0xEDAD,0xF5ED,
+	0xEDED,0x8005,0xEDEE,0x0001,0xEE0F,0xEE0F,0x8003,0xEDEF,
+	0xC015,0x9C9B,0x9C9B,0x6493,0x9BA4,0x945B,0x9B93,0x9BA3,
+	0xE3A4,0xEB53,0xA59C,0x5CA4,0x8002,0xDBC5,0xC00A,0xA39C,
+	0x5C9C,0x5C94,0x9CE5,0xACF5,0xEC00,0x000A,0xF449,0xFE54,
 	0xFF9C,0xFF9C,0xEEB4,0x634F,0x00F1,0x0932,0x11D3,0x2293,
-	0x2B14,0x2B54,0x3354,0x3B95,0x43D5,0x5416,0x4456,0x7C10,
-	0xDC0B,0xFC4A,0xFC69,0xFC88,0xF4A6,0xF4A4,0xE483,0xD402,
-	0xC382,0xB322,0xA2C2,0xA262,0xA222,0xAA22,0xB223,0xBA63,
-	0xC283,0xCAE4,0xDB24,0xE384,0xEC04,0xEC63,0xF4A3,0xF4C3,
-	0xF4C3,0xF4A3,0xF483,0xEC44,0xEC25,0xE3E6,0xE406,0xE405,
-	0xE405,0xE405,0xE424,0xDC24,0xDC24,0xDC24,0xDC24,0xD424,
-	0xD425,0xD426,0xD447,0xDC47,0xD448,0xDCED,0xE5D2,0xE5F3,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9961,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9941,0x9941,
-	0x9141,0x9141,0x9141,0x8921,0x7901,0x7101,0x60C1,0x50C0,
-	0x48A0,0x40A0,0x48C1,0x9903,0xD8A2,0xF821,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF840,0xE0E3,0xA9E5,0x6A44,0x6A85,0x7AC5,0x8B47,
-	0xA3C8,0xB469,0xCCEB,0xDD4B,0xEDCD,0xEDEE,0xEDEE,0xEE0E,
-	0xF60E,0xF60E,0xEDEE,0xEDEE,0xF60F,0xF60F,0xEDEF,0xEDEF,
-	0xEDEF,0xEDEF,0xEDCF,0xEDAE,0xEDAE,0xED8E,0xED6D,0xE54C,
-	0xE52C,0xE50C,0xE4EB,0xDCAA,0xDC89,0xDC68,0xDC27,0xE426,
-	0xDC05,0xE424,0xE424,0xE423,0xE404,0xE3E4,0xE3C4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD364,0xD344,0xCB24,
-	0xCB04,0xCAE4,0xD2E4,0xD305,0xDB25,0xEB66,0xF449,0xFE34,
-	0xFF7C,0x9CD2,0x114B,0x0110,0x00F1,0x0932,0x11F3,0x1A93,
-	0x2B34,0x2B54,0x3354,0x3B75,0x43D6,0x6413,0xA3CC,0xD3A9,
-	0xEC2A,0xFC4A,0xFC69,0xFC88,0xFCA6,0xECA4,0xE463,0xD402,
-	0xC382,0xB322,0xA2A1,0xA262,0xA222,0xAA22,0xB223,0xBA63,
-	0xC283,0xCAE4,0xD324,0xE384,0xEC04,0xEC63,0xF483,0xF4C3,
-	0xF4C3,0xF4A3,0xF483,0xEC44,0xEC25,0xE3E6,0xE406,0xE405,
-	0xE405,0xE405,0xE424,0xDC24,0xDC24,0xDC24,0xD424,0xD424,
-	0xD425,0xD426,0xD447,0xDC47,0xD428,0xDCCC,0xE5B2,0xE5D3,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9961,0x9941,0x9941,0x9941,
-	0x9141,0x9141,0x8921,0x7901,0x70E1,0x58E1,0x50A1,0x48A1,
-	0x40A1,0x80E2,0xD0A2,0xF861,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF861,0xD903,0x9A05,0x6A65,0x72A5,
-	0x8306,0x9BA8,0xAC49,0xC4CA,0xDD4C,0xE5AD,0xEE0E,0xEDEE,
-	0xF60E,0xF60E,0xF60E,0xEDEE,0xF60F,0xEE0F,0xF60F,0xF60F,
-	0xEDEF,0xEDEF,0xEDEF,0xEDCF,0xEDAF,0xED8E,0xED8E,0xE54D,
-	0xE52C,0xE52C,0xE4EB,0xDCAA,0xE489,0xDC69,0xDC47,0xE427,
-	0xDC06,0xE425,0xE424,0xE423,0xE404,0xE3E4,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD363,0xD344,0xCB44,
-	0xCB03,0xCAE4,0xD2E4,0xD305,0xDB25,0xEB66,0xF429,0xCD52,
-	0x3A49,0x0064,0x00EA,0x0110,0x00F1,0x0932,0x11D3,0x1A93,
-	0x2B34,0x2B54,0x3355,0x4394,0x8BEE,0xB3E9,0xBBA9,0xD3C9,
-	0xEC0A,0xFC4A,0xFC89,0xFCA8,0xF4A6,0xECA4,0xE463,0xD402,
-	0xC382,0xB302,0xA2A1,0xA242,0xA222,0xAA22,0xB223,0xBA63,
-	0xCA83,0xCAC4,0xD324,0xE384,0xEC04,0xEC63,0xF483,0xF4C3,
-	0xF4C3,0xF4A3,0xF483,0xEC64,0xEC26,0xE406,0xE406,0xE405,
-	0xE405,0xE405,0xE425,0xDC24,0xDC24,0xDC24,0xD424,0xDC24,
-	0xD425,0xD426,0xD447,0xDC47,0xD448,0xDCCC,0xE5B2,0xE5D3,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9941,0x9141,
-	0x9141,0x8121,0x7901,0x70E1,0x58C1,0x48A0,0x40A1,0x60E2,
-	0xB8C2,0xF082,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF882,0xC164,0x7A45,
-	0x6A85,0x8306,0x93A8,0xAC49,0xC4CB,0xD54C,0xE5AD,0xEDEE,
-	0xEDEE,0xF60E,0xF60E,0xF60F,0xF60F,0xF60F,0xF60F,0xF60F,
-	0xF5EF,0xEDEF,0xEDCF,0xEDAF,0xEDAF,0xE5AE,0xED8E,0xE54D,
-	0xE52D,0xE52C,0xE4EB,0xDCCA,0xDC8A,0xDC69,0xDC48,0xDC27,
-	0xDC06,0xE425,0xE424,0xE423,0xE403,0xE3E3,0xDBC4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDB84,0xD364,0xCB43,0xCB23,
-	0xCB03,0xCAE4,0xD2E4,0xD305,0xDB25,0xDB67,0x7BEF,0x01EC,
-	0x0084,0x0084,0x00EA,0x0110,0x00F1,0x0932,0x11D3,0x1A93,
-	0x2B34,0x3354,0x6BD1,0xBC4B,0xBC29,0xB3E9,0xBBA9,0xD3C9,
-	0xEC0A,0xFC6A,0xFC89,0xFCA8,0xF4A6,0xECA4,0xE463,0xD3E2,
-	0xC382,0xB302,0xA2A1,0xA241,0xA202,0xAA02,0xB243,0xBA63,
-	0xCA83,0xCAC4,0xD324,0xE384,0xEC04,0xEC43,0xF483,0xF4C3,
-	0xF4C3,0xF4A3,0xF483,0xEC64,0xEC25,0xE406,0xE406,0xE405,
-	0xE405,0xE425,0xE424,0xDC24,0xDC24,0xDC24,0xDC24,0xDC24,
-	0xD425,0xDC46,0xD447,0xDC47,0xD448,0xDCCC,0xE5B1,0xE5D2,
-	0x9941,0x9941,0x9941,0x9941,0x9942,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9961,0x9962,0x9962,0x9141,0x8921,
-	0x8121,0x7901,0x68E1,0x58C1,0x48A0,0x48A1,0x90E2,0xE082,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xE8C2,
-	0xA9C5,0x6A86,0x7AE6,0x9388,0xA429,0xBCAB,0xCD2C,0xDD8D,
-	0xEDCE,0xF60E,0xF60E,0xF60F,0xF60F,0xF60F,0xEDEF,0xF60F,
-	0xEDEF,0xEDEF,0xEDEF,0xEDCF,0xEDAF,0xEDAE,0xED8E,0xE54D,
-	0xE52C,0xE52C,0xE50C,0xE4CA,0xE48A,0xDC89,0xDC48,0xDC27,
-	0xDC06,0xE405,0xE424,0xE423,0xE403,0xE3E3,0xE3C3,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD363,0xD344,0xCB43,
-	0xCB03,0xCAE4,0xCAE4,0xD2E5,0xA3AC,0x3477,0x0BF6,0x020C,
+	0x2B14,0xC003,0xB4E4,0xF5F4,0x0004,0x5416,0x4456,0x7C10,
+	0xDC0B,0xFC4A,0xC00F,0xABAB,0x6AA2,0x1B03,0x040C,0x0C8C,
+	0x94E4,0xE5F4,0xECFD,0x0002,0xDB24,0xE384,0xEC04,0xC009,
+	0xBBF4,0xACA4,0x9C9C,0x559D,0x55AC,0x8002,0xE405,0x0000,
+	0xE424,0x8003,0xDC24,0xC005,0x64A5,0xA5AD,0xE465,0x0002,
+	0xDCED,0xE5D2,0xE5F3,0x8012,0x9941,0x0000,0x9961,0x8008,
+	0x9941,0x0002,0x9961,0x9941,0x9941,0x8002,0x9141,0xC007,
+	0x5C1C,0x6414,0x235C,0x64ED,0x0002,0x9903,0xD8A2,0xF821,
+	0x8042,0xF800,0x000B,0xF840,0xE0E3,0xA9E5,0x6A44,0x6A85,
+	0x7AC5,0x8B47,0xA3C8,0xB469,0xCCEB,0xDD4B,0xEDCD,0xC008,
+	0xADA4,0xACE4,0xA45C,0xA4ED,0xA400,0x8003,0xEDEF,0xC014,
+	0x9C9B,0xA49C,0x9B5B,0x9C9C,0x9B53,0x9B9B,0x93E3,0x5BEB,
+	0xA4A3,0x9D9C,0x9C00,0x8004,0xDBC4,0xC008,0x9C54,0x9C5C,
+	0x9C9C,0xE4AD,0xEC00,0x000B,0xEB66,0xF449,0xFE34,0xFF7C,
+	0x9CD2,0x114B,0x0110,0x00F1,0x0932,0x11F3,0x1A93,0x2B34,
+	0xC003,0xACE4,0xEDFD,0x0004,0x6413,0xA3CC,0xD3A9,0xEC2A,
+	0xFC4A,0xC010,0xABAB,0xAA22,0x530B,0x040C,0x0395,0x94E4,
+	0xE5F4,0xECFD,0xF400,0x0001,0xE384,0xEC04,0xC009,0xBBEC,
+	0xB4A4,0x9C9C,0x559D,0x55AC,0x8002,0xE405,0x0000,0xE424,
+	0x8002,0xDC24,0xC006,0x64A4,0xA5A5,0xADE4,0x5D00,0x0002,
+	0xDCCC,0xE5B2,0xE5D3,0x801B,0x9941,0x0000,0x9961,0x8002,
+	0x9941,0xC004,0x64A4,0x5C1C,0x5C00,0x0006,0x58E1,0x50A1,
+	0x48A1,0x40A1,0x80E2,0xD0A2,0xF861,0x8046,0xF800,0x000C,
+	0xF861,0xD903,0x9A05,0x6A65,0x72A5,0x8306,0x9BA8,0xAC49,
+	0xC4CA,0xDD4C,0xE5AD,0xEE0E,0xEDEE,0x8002,0xF60E,0xC004,
+	0x5CED,0x64E4,0xA400,0x8002,0xEDEF,0xC012,0x9C9C,0x9BA4,
+	0x539B,0xA493,0x53DB,0x5C9A,0xDC5B,0xEBA3,0xA39D,0x9C00,
+	0x8005,0xDBC4,0xC008,0x9C53,0x9D64,0x939D,0xE4AD,0xEC00,
+	0x0014,0xEB66,0xF429,0xCD52,0x3A49,0x0064,0x00EA,0x0110,
+	0x00F1,0x0932,0x11D3,0x1A93,0x2B34,0x2B54,0x3355,0x4394,
+	0x8BEE,0xB3E9,0xBBA9,0xD3C9,0xEC0A,0xFC4A,0xC00D,0xB3AB,
+	0x6262,0x530B,0x0404,0x0B8D,0x9CE4,0xE5F4,0x0004,0xCA83,
+	0xCAC4,0xD324,0xE384,0xEC04,0xC009,0xBBEC,0xB4A4,0x9C9C,
+	0x5D96,0x5CA4,0x8002,0xE405,0x0000,0xE425,0x8002,0xDC24,
+	0xC006,0x64E4,0x65A5,0xADE4,0x6500,0x0002,0xDCCC,0xE5B2,
+	0xE5D3,0x801C,0x9941,0xC006,0xAC9C,0x64A4,0x1C5C,0x5C00,
+	0x0005,0x58C1,0x48A0,0x40A1,0x60E2,0xB8C2,0xF082,0x804A,
+	0xF800,0x0009,0xF882,0xC164,0x7A45,0x6A85,0x8306,0x93A8,
+	0xAC49,0xC4CB,0xD54C,0xE5AD,0xC003,0xF5A4,0xECA4,0x8004,
+	0xF60F,0xC017,0x9C64,0x9C9C,0xA463,0xDC53,0x9CA3,0x935B,
+	0x949B,0x9B9B,0x9BEB,0xA3A3,0x9C9C,0x5D9C,0x8003,0xDBC4,
+	0xC009,0x945C,0x5B9C,0x9C9D,0xE4AD,0xECB6,0x0013,0x7BEF,
+	0x01EC,0x0084,0x0084,0x00EA,0x0110,0x00F1,0x0932,0x11D3,
+	0x1A93,0x2B34,0x3354,0x6BD1,0xBC4B,0xBC29,0xB3E9,0xBBA9,
+	0xD3C9,0xEC0A,0xFC6A,0xC00D,0xABAB,0x6262,0x5303,0x0C04,
+	0x0B8C,0x95E4,0xF5EC,0x0004,0xCA83,0xCAC4,0xD324,0xE384,
+	0xEC04,0xC00D,0xB3F4,0xB4A4,0x9C9C,0x5D95,0x5DA4,0xA3A4,
+	0xACA3,0x8004,0xDC24,0xC004,0x65ED,0x65E4,0x6500,0x0002,
+	0xDCCC,0xE5B1,0xE5D2,0x8003,0x9941,0x0000,0x9942,0x8003,
+	0x9941,0x0001,0x9961,0x9961,0x800F,0x9941,0xC00A,0xACA5,
+	0xA45B,0x5C64,0x5C1C,0x1C1B,0xA500,0x0002,0x90E2,0xE082,
+	0xF820,0x804C,0xF800,0x000C,0xF820,0xE8C2,0xA9C5,0x6A86,
+	0x7AE6,0x9388,0xA429,0xBCAB,0xCD2C,0xDD8D,0xEDCE,0xF60E,
+	0xF60E,0x8002,0xF60F,0x0001,0xEDEF,0xF60F,0x8002,0xEDEF,
+	0xC014,0x9C9C,0xA39C,0x539B,0xA49C,0x9294,0x6393,0x9B9B,
+	0xE3AB,0xA39C,0x9C9C,0x5D00,0x8003,0xDBC4,0xC007,0x9C53,
+	0x9D63,0x949D,0xA4E5,0x0014,0xA3AC,0x3477,0x0BF6,0x020C,
 	0x0084,0x0084,0x00EA,0x0110,0x00F1,0x0932,0x11D3,0x2294,
 	0x4B72,0xAC4D,0xCC8B,0xC46A,0xBC29,0xABE9,0xBBC9,0xDBEA,
-	0xF42A,0xFC6A,0xFC89,0xFCA8,0xF4A6,0xECA4,0xE463,0xD3E2,
-	0xC382,0xB301,0xA2A1,0xA241,0xA202,0xAA02,0xB223,0xBA63,
-	0xC283,0xCAC3,0xD304,0xDB64,0xE3E4,0xEC43,0xF483,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF464,0xEC05,0xE406,0xE406,0xE405,
-	0xE425,0xE425,0xE444,0xDC24,0xE444,0xDC24,0xDC24,0xDC24,
-	0xD425,0xD426,0xD447,0xDC47,0xD448,0xDCAC,0xE591,0xE5D2,
-	0x9941,0x9941,0x9941,0x9942,0x9942,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9961,0x9942,0x9141,0x8921,0x8121,
-	0x7101,0x60E1,0x58C1,0x48A1,0x6103,0xC0C2,0xF041,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF041,0xC943,0x8287,0x72E6,0x8B68,0x9BE9,0xB46A,0xCD0C,
-	0xDD6D,0xEDCE,0xF60E,0xF60E,0xF60F,0xF60F,0xEDEF,0xF60F,
-	0xF60F,0xEDEF,0xEDEF,0xEDCF,0xEDAF,0xEDAE,0xED8E,0xE56D,
-	0xE54D,0xE54D,0xE50C,0xE4CB,0xDCAA,0xDC69,0xDC48,0xDC47,
-	0xDC26,0xE425,0xE424,0xE423,0xE403,0xE3E3,0xE3C4,0xE3C4,
-	0xDBC4,0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xCB43,0xCB23,
-	0xCB04,0xCAE4,0xBB27,0x5C54,0x24DA,0x1499,0x0BD6,0x020C,
-	0x0084,0x0084,0x00EA,0x0110,0x00F1,0x0932,0x2212,0x7BEF,
-	0xD4CB,0xD4AA,0xCCAB,0xC46A,0xBC29,0xABE9,0xBBA9,0xDBC9,
-	0xF42A,0xFC6A,0xFC89,0xFCA8,0xF4A6,0xECA4,0xE463,0xD3E2,
-	0xC361,0xB301,0xA2A1,0xA241,0xA202,0xAA02,0xB223,0xBA63,
-	0xC2A3,0xCAC3,0xD304,0xDB64,0xEBE3,0xEC43,0xF483,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF444,0xEC05,0xE3E6,0xE406,0xE405,
-	0xE425,0xE425,0xE444,0xDC24,0xE444,0xDC24,0xDC24,0xD424,
-	0xD425,0xD426,0xD447,0xDC47,0xD448,0xDCCC,0xE591,0xE5D2,
-	0x9941,0x9941,0x9941,0x9942,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9941,0x9141,0x9141,0x8921,0x7901,0x70E1,
-	0x58E1,0x50A1,0x48A1,0x8903,0xE082,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xE8C2,0xA205,0x72C6,0x8327,0x93C9,0xAC4A,
-	0xC4EC,0xD54D,0xE5CE,0xEDEE,0xF60F,0xF60F,0xEDEF,0xF60F,
-	0xF60F,0xF610,0xEDEF,0xEDCF,0xEDAF,0xEDAE,0xEDAE,0xE58E,
-	0xE54D,0xE54D,0xE50C,0xE4EB,0xDCAA,0xDC89,0xDC69,0xE448,
-	0xE426,0xE425,0xE424,0xE403,0xE403,0xE3E3,0xE3C3,0xE3C4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD344,0xCB43,
-	0xCB03,0x7C10,0x3CF9,0x2CFA,0x24DA,0x1499,0x13D7,0x020C,
-	0x0084,0x0064,0x00EA,0x0110,0x00F1,0x52F1,0xCD8D,0xDD6C,
-	0xDCEB,0xD4AB,0xCCAB,0xC46A,0xBC29,0xB3E9,0xBBC9,0xDBEA,
-	0xF42A,0xFC6A,0xFC89,0xFCA8,0xF4A6,0xECA4,0xE463,0xD3E2,
-	0xC361,0xB301,0xA2A1,0xA241,0xA222,0xAA02,0xB223,0xBA63,
-	0xC2A3,0xCAC3,0xD304,0xDB64,0xEBE3,0xEC43,0xF483,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF443,0xEC05,0xE3E5,0xE405,0xE405,
-	0xE405,0xE425,0xDC24,0xDC24,0xDC24,0xDC24,0xDC24,0xD424,
-	0xD425,0xD425,0xD447,0xDC47,0xD428,0xDCAC,0xE591,0xE5B2,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9941,
-	0x9961,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9141,0x9161,0x8941,0x8121,0x7901,0x68E1,0x58E1,
-	0x48A0,0x50E2,0xB103,0xF041,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF061,0xC1A5,0x7AC7,0x7B27,0x93A8,
-	0xAC4A,0xBCCB,0xD52C,0xDDAE,0xEDEF,0xF60F,0xF60F,0xF60F,
-	0xF60F,0xF610,0xEDF0,0xEDEF,0xEDCF,0xEDAF,0xEDAE,0xE58E,
-	0xE54D,0xE54D,0xE52C,0xE4EB,0xDCCB,0xDC8A,0xDC69,0xDC48,
-	0xDC26,0xE425,0xE425,0xE423,0xE423,0xE403,0xE3E4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD363,0xAB8A,
-	0x44B9,0x351B,0x2D1B,0x2CFB,0x24DA,0x149A,0x0BF6,0x020C,
-	0x00A4,0x0084,0x00EA,0x21D0,0xBD8F,0xF6CD,0xEE2C,0xDD6C,
-	0xD4EB,0xD4AB,0xD4AB,0xC46A,0xBC29,0xB3E9,0xBBC9,0xDBEA,
-	0xF44B,0xFC6A,0xFC89,0xFCA8,0xF4C6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB2E1,0xA281,0xA241,0xA202,0xAA02,0xB223,0xBA63,
-	0xC2A3,0xCAC3,0xD304,0xDB64,0xE3E3,0xEC23,0xF463,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF443,0xEC04,0xE405,0xE405,0xE405,
-	0xE405,0xE424,0xE424,0xDC24,0xDC24,0xDC24,0xDC23,0xD404,
-	0xD404,0xDC25,0xD427,0xDC27,0xD428,0xDCAB,0xE570,0xE5B2,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,
-	0x9961,0x9961,0x9942,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9141,0x8921,0x8121,0x7101,0x60E1,0x58C1,0x48A0,
-	0x68E2,0xD0C3,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xD924,0x8A86,0x72E7,
-	0x8B68,0x9BE9,0xB48B,0xCD2D,0xDD8E,0xEDEF,0xF60F,0xF60F,
-	0xF60F,0xF610,0xF610,0xEDF0,0xEDCF,0xEDCF,0xEDCF,0xED8E,
-	0xED6D,0xED6D,0xE52D,0xE4EC,0xE4CB,0xDCAA,0xDC89,0xDC68,
-	0xDC27,0xE426,0xE425,0xE423,0xE423,0xE403,0xE3E3,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xCB85,0x6C13,0x34BB,
-	0x34FB,0x351B,0x2D1B,0x2CFB,0x24BA,0x1499,0x0BF6,0x0A0D,
-	0x00A5,0x0084,0x83EF,0xEE8F,0xFF0E,0xF6ED,0xEE2C,0xDD6C,
-	0xDCEB,0xD4CB,0xCCAA,0xC48A,0xBC29,0xB3E9,0xBBC9,0xDC0A,
-	0xF44B,0xFC8A,0xFCAA,0xFCC8,0xF4C6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB2E1,0xA281,0xA241,0xA201,0xAA02,0xB223,0xBA63,
-	0xCAA3,0xCAC3,0xD304,0xDB64,0xE3E4,0xEC23,0xF483,0xF4A3,
-	0xF4C3,0xF4A3,0xF483,0xF443,0xEC25,0xE405,0xE405,0xE405,
-	0xE405,0xE424,0xE424,0xDC44,0xDC23,0xDC23,0xDC23,0xD423,
-	0xD424,0xDC25,0xD427,0xDC27,0xD428,0xDC8B,0xE570,0xE5B2,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9941,0x9961,
-	0x9961,0x9961,0x9942,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9141,0x8921,0x7921,0x7101,0x60E1,0x50C1,0x48A0,0x8103,
-	0xE8A2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xE8E3,0x9A66,
-	0x72E6,0x8348,0x9BC9,0xB46B,0xCD2D,0xDD8E,0xEDEF,0xF60F,
-	0xF60F,0xF610,0xF610,0xEDF0,0xEDCF,0xEDCF,0xEDCF,0xEDAF,
-	0xED8E,0xED6D,0xE54D,0xE50C,0xE4EC,0xE4AB,0xDC89,0xDC68,
-	0xDC47,0xE426,0xE425,0xE403,0xE422,0xE403,0xE3E4,0xE3C4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0x8BEE,0x347A,0x2C9C,0x34BC,
-	0x34DB,0x2D1B,0x2D1B,0x2CFA,0x24BA,0x1499,0x0BF6,0x020D,
-	0x424A,0xDE98,0xFF15,0xFECF,0xFF0E,0xF6ED,0xEE2C,0xE56C,
-	0xDCEB,0xD4CB,0xD4AB,0xC48A,0xBC29,0xB3E9,0xC3CA,0xDC0A,
-	0xF46B,0xFC8B,0xFCAA,0xFCC8,0xF4C6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB2E1,0xA281,0xA241,0xA222,0xAA22,0xB242,0xC263,
-	0xCAA3,0xCAC3,0xD304,0xDB64,0xE3E4,0xEC23,0xF483,0xF4A3,
-	0xF4C3,0xF4A3,0xF483,0xF443,0xEC25,0xEC06,0xE405,0xE405,
-	0xE425,0xE424,0xE444,0xDC24,0xDC23,0xDC23,0xDC23,0xD423,
-	0xDC04,0xDC25,0xDC27,0xDC27,0xD427,0xDC8A,0xE54F,0xE591,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9962,0x9941,0x9941,0x9962,0x9941,0x9941,0x9941,0x9141,
-	0x8921,0x7921,0x70E1,0x60E1,0x50A1,0x40A1,0x9903,0xF082,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF881,
-	0xAA06,0x72C7,0x8327,0x9BC9,0xB48B,0xCD2D,0xDD6E,0xEDEF,
-	0xF610,0xF610,0xF610,0xEDF0,0xEDCF,0xEDCF,0xEDCF,0xEDAF,
-	0xED8E,0xED8E,0xE54D,0xE50C,0xE4EC,0xDCCB,0xDC8A,0xDC69,
-	0xDC48,0xE447,0xE425,0xE423,0xE422,0xE403,0xE3E3,0xE3C4,
-	0xDBC4,0xDBC4,0xBBE8,0x5415,0x245B,0x2C7C,0x2C9C,0x34BB,
-	0x34DB,0x351B,0x2D1B,0x2CDA,0x24DA,0x1499,0x1BF6,0x9C70,
-	0xFF5A,0xFF7B,0xFF15,0xFECF,0xFF0E,0xF6ED,0xEE2C,0xE56C,
-	0xDCEB,0xD4CB,0xD4AB,0xCC8A,0xBC29,0xB40A,0xC3EA,0xDC0A,
-	0xF46B,0xFC8B,0xFCAA,0xFCC8,0xF4C6,0xECA4,0xE463,0xD3E2,
-	0xC361,0xB2E1,0xA281,0xA241,0xAA22,0xAA02,0xB222,0xC263,
-	0xCAA3,0xD2E4,0xD304,0xDB64,0xE3C4,0xEC23,0xF463,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF463,0xEC25,0xE405,0xE405,0xEC05,
-	0xE425,0xE424,0xE444,0xE444,0xDC44,0xDC23,0xDC23,0xD423,
-	0xDC04,0xD425,0xD426,0xDC26,0xD427,0xD48A,0xE54F,0xE591,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,0x9141,0x8921,
-	0x7901,0x7101,0x58C1,0x48A0,0x48C1,0xB103,0xF861,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF861,0xB9C5,0x72C7,0x7B27,0x93EA,0xB48C,0xCD0D,0xDD8E,
-	0xEDEF,0xF610,0xEE10,0xEDF0,0xEDEF,0xEDD0,0xEDD0,0xEDAF,
-	0xED8F,0xED8F,0xE54E,0xE52C,0xE50C,0xE4CB,0xDCAA,0xDC89,
-	0xDC68,0xDC47,0xE425,0xE424,0xE423,0xE422,0xE403,0xDBE4,
-	0xD3C5,0x73F1,0x243B,0x243B,0x245B,0x2C7C,0x2C9B,0x34BC,
-	0x34DB,0x34FB,0x2CFB,0x2CFA,0x24BA,0x7411,0xE409,0xFDD2,
-	0xFF5A,0xFF7B,0xFF15,0xFEEE,0xFF0E,0xF6ED,0xEE2C,0xE56C,
-	0xDD0C,0xD4CB,0xD4AB,0xCC8A,0xBC29,0xB40A,0xC3CA,0xDC2A,
-	0xF48B,0xFC8B,0xFCCA,0xF4C8,0xF4C6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB2E1,0xA281,0xA241,0xAA22,0xAA02,0xBA43,0xC263,
-	0xCAA3,0xD2E3,0xD324,0xDB64,0xE3C4,0xEC44,0xF463,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF463,0xEC24,0xE405,0xE405,0xEC25,
-	0xE425,0xE424,0xE444,0xDC44,0xDC24,0xDC23,0xDC23,0xDC03,
-	0xD404,0xDC25,0xDC26,0xDC27,0xD427,0xDC8A,0xE52F,0xE571,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,
-	0x9961,0x9961,0x9941,0x9941,0x9961,0x9961,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9141,0x8921,0x7901,
-	0x70E1,0x58C1,0x48A0,0x50E2,0xB8E3,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xC985,0x7AC7,0x7B48,0x93CA,0xB48C,0xCD2D,
-	0xDD8F,0xEDF0,0xF610,0xEE10,0xEDEF,0xEDD0,0xEDCF,0xEDAF,
-	0xEDAF,0xED8F,0xE56E,0xE52D,0xE50C,0xE4EC,0xDCAB,0xDC8A,
-	0xDC68,0xE447,0xE425,0xE424,0xE423,0xE423,0xE403,0xA3EB,
-	0x3438,0x243B,0x243B,0x243B,0x245B,0x2C7B,0x2C9B,0x34BC,
-	0x2CDB,0x34FB,0x2D1B,0x4C96,0xABAA,0xEB66,0xF428,0xFDF2,
+	0xF42A,0xC012,0xF4AB,0xAB62,0x6253,0x030C,0x030C,0x8C95,
+	0xE4ED,0xF4EC,0xF4F5,0xFC00,0x0002,0xE3E4,0xEC43,0xF483,
+	0x8002,0xF4A3,0xC00A,0x9C9D,0x4D65,0xA4A3,0xACA4,0xAB5C,
+	0xEC00,0x8002,0xDC24,0xC004,0x65A5,0xADE4,0x6500,0x0002,
+	0xDCAC,0xE591,0xE5D2,0x8002,0x9941,0x0001,0x9942,0x9942,
+	0x8003,0x9941,0x0001,0x9961,0x9961,0x800F,0x9941,0xC008,
+	0xAC9D,0x635C,0x641C,0x1C5C,0x1C00,0x0002,0x6103,0xC0C2,
+	0xF041,0x8050,0xF800,0x0009,0xF041,0xC943,0x8287,0x72E6,
+	0x8B68,0x9BE9,0xB46A,0xCD0C,0xDD6D,0xEDCE,0xC028,0xF4A4,
+	0xA5A4,0x5CEC,0xA45C,0xA49C,0x9CA3,0x9C5B,0x9CA4,0x9393,
+	0x5B93,0x9BA3,0x9BE3,0xA3A3,0x9C9C,0x9DA4,0x649C,0xACA4,
+	0x9C5C,0x539C,0x9D9C,0x3700,0x000D,0x5C54,0x24DA,0x1499,
+	0x0BD6,0x020C,0x0084,0x0084,0x00EA,0x0110,0x00F1,0x0932,
+	0x2212,0x7BEF,0xD4CB,0xC004,0x9B65,0x5353,0x1400,0x0002,
+	0xBBA9,0xDBC9,0xF42A,0xC012,0xF4AB,0xAB62,0x6253,0x0303,
+	0x0C0C,0x8C95,0xE4ED,0xF4F4,0xECF5,0xFC00,0x0002,0xEBE3,
+	0xEC43,0xF483,0x8002,0xF4A3,0xC012,0x9C95,0x555D,0xACA3,
+	0xACA4,0xAB5C,0xEC5C,0xA464,0xA5A5,0xADE4,0x6500,0x0002,
+	0xDCCC,0xE591,0xE5D2,0x8002,0x9941,0x0000,0x9942,0x8004,
+	0x9941,0x0001,0x9961,0x9961,0x8004,0x9941,0x0000,0x9961,
+	0x8006,0x9941,0xC007,0xAC9C,0xA464,0xA45C,0x1C5C,0x0005,
+	0x58E1,0x50A1,0x48A1,0x8903,0xE082,0xF820,0x8052,0xF800,
+	0x0009,0xF820,0xE8C2,0xA205,0x72C6,0x8327,0x93C9,0xAC4A,
+	0xC4EC,0xD54D,0xE5CE,0xC01C,0xECED,0xA45C,0xECA4,0xA55B,
+	0x9C9C,0xA3A4,0x5C93,0xA493,0x9B53,0x9B9C,0xDB9A,0xA3A3,
+	0x9BA4,0x9C9C,0xA500,0x8003,0xDBC4,0xC004,0x9C5C,0x9463,
+	0x9400,0x000E,0x7C10,0x3CF9,0x2CFA,0x24DA,0x1499,0x13D7,
+	0x020C,0x0084,0x0064,0x00EA,0x0110,0x00F1,0x52F1,0xCD8D,
+	0xDD6C,0xC006,0x8354,0x6453,0x5354,0xDC00,0x0001,0xDBEA,
+	0xF42A,0xC012,0xF4AB,0xAB62,0x6253,0x0303,0x0C0C,0x8C9D,
+	0xDCED,0xF4F4,0xECF5,0xFC00,0x0002,0xEBE3,0xEC43,0xF483,
+	0x8002,0xF4A3,0xC003,0x9C94,0x565C,0x8002,0xE405,0x0000,
+	0xE425,0x8004,0xDC24,0xC005,0x64A5,0xA4AE,0xE45D,0x0002,
+	0xDCAC,0xE591,0xE5B2,0x8005,0x9941,0x0001,0x9961,0x9941,
+	0x8002,0x9961,0x8004,0x9941,0x0000,0x9961,0x8007,0x9941,
+	0xC008,0x64AC,0x5C5C,0x5C1C,0x2413,0xF600,0x0001,0xB103,
+	0xF041,0x8056,0xF800,0x0009,0xF061,0xC1A5,0x7AC7,0x7B27,
+	0x93A8,0xAC4A,0xBCCB,0xD52C,0xDDAE,0xEDEF,0x8003,0xF60F,
+	0xC015,0xA55C,0xA39C,0x9CA3,0x5C93,0xA49B,0x935C,0x939B,
+	0x9B9A,0xE3A4,0xA2A4,0x9C9D,0x8004,0xDBC4,0x0004,0xDBA4,
+	0xD384,0xD363,0xAB8A,0x44B9,0xC004,0x3E64,0x9C5B,0x1400,
+	0x0009,0x0BF6,0x020C,0x00A4,0x0084,0x00EA,0x21D0,0xBD8F,
+	0xF6CD,0xEE2C,0xDD6C,0xC006,0x4394,0xA413,0x5354,0xDC00,
+	0x0001,0xDBEA,0xF44B,0xC012,0xEBAB,0xAB6A,0x624B,0x0303,
+	0x040C,0x9495,0xE4ED,0xF4F4,0xECF5,0xFC00,0x0002,0xE3E3,
+	0xEC23,0xF463,0x8002,0xF4A3,0x0002,0xF483,0xF443,0xEC04,
+	0x8003,0xE405,0x0001,0xE424,0xE424,0x8002,0xDC24,0xC006,
+	0xA35D,0xA4ED,0x66E4,0x6500,0x0002,0xDCAB,0xE570,0xE5B2,
+	0x8006,0x9941,0x8002,0x9961,0x0000,0x9942,0x800D,0x9941,
+	0xC006,0x645C,0x641C,0x1C5C,0x1B00,0x0002,0x68E2,0xD0C3,
+	0xF820,0x8058,0xF800,0x0009,0xF820,0xD924,0x8A86,0x72E7,
+	0x8B68,0x9BE9,0xB48B,0xCD2D,0xDD8E,0xEDEF,0x8002,0xF60F,
+	0x0002,0xF610,0xF610,0xEDF0,0x8002,0xEDCF,0xC00F,0x939B,
+	0xA454,0x939B,0x5B9B,0x9B93,0xE3A3,0xA2A4,0x9C9C,0x8004,
+	0xDBC4,0x0003,0xDBA4,0xCB85,0x6C13,0x34BB,0xC005,0xB4AC,
+	0x649C,0x531B,0x0009,0x0BF6,0x0A0D,0x00A5,0x0084,0x83EF,
+	0xEE8F,0xFF0E,0xF6ED,0xEE2C,0xDD6C,0xC006,0x835C,0x5B5C,
+	0x4B54,0xDC00,0x0001,0xDC0A,0xF44B,0xC00E,0xF3AC,0xAA62,
+	0x624B,0x0303,0x040C,0x9494,0xE5ED,0xF400,0x0004,0xCAA3,
+	0xCAC3,0xD304,0xDB64,0xE3E4,0xC007,0xF3FC,0xACAC,0x9C9C,
+	0x945E,0x8003,0xE405,0x0002,0xE424,0xE424,0xDC44,0x8002,
+	0xDC23,0xC006,0x64A5,0xE566,0xE465,0xFF00,0x0001,0xE570,
+	0xE5B2,0x8004,0x9941,0x0001,0x9961,0x9941,0x8002,0x9961,
+	0x0000,0x9942,0x800C,0x9941,0xC006,0x645C,0x245C,0x1C1C,
+	0x5B00,0x0001,0x8103,0xE8A2,0x805B,0xF800,0x0009,0xF820,
+	0xE8E3,0x9A66,0x72E6,0x8348,0x9BC9,0xB46B,0xCD2D,0xDD8E,
+	0xEDEF,0xC004,0xECA4,0xA5A4,0x5C00,0x8002,0xEDCF,0xC010,
+	0x9C9B,0x9B5C,0x939C,0x935A,0x9B9B,0xDBA3,0x9AAB,0x9D9D,
+	0x9C00,0x8003,0xDBC4,0x0001,0x8BEE,0x347A,0xC007,0x6EEC,
+	0xAB74,0xA49B,0x541B,0x0009,0x0BF6,0x020D,0x424A,0xDE98,
+	0xFF15,0xFECF,0xFF0E,0xF6ED,0xEE2C,0xE56C,0xC005,0x435C,
+	0x9C1B,0x4B54,0x0002,0xC3CA,0xDC0A,0xF46B,0xC00D,0xECAB,
+	0xAA62,0x624B,0x0303,0x040C,0x949D,0xE4EC,0x0000,0xC263,
+	0xC003,0xF4AC,0xF5FC,0x0000,0xE3E4,0xC00E,0xF3FC,0xACAC,
+	0x9C9C,0x945E,0x9D63,0xA4AC,0xA3AC,0x5C00,0x8002,0xDC23,
+	0xC006,0x64DD,0xADA6,0xA464,0xFF00,0x0001,0xE54F,0xE591,
+	0x8005,0x9941,0x8004,0x9961,0x8004,0x9941,0xC003,0xAD9B,
+	0xA4AD,0x8002,0x9941,0xC006,0x645C,0x2454,0x2414,0x2400,
+	0x0001,0x9903,0xF082,0x805E,0xF800,0x0008,0xF881,0xAA06,
+	0x72C7,0x8327,0x9BC9,0xB48B,0xCD2D,0xDD6E,0xEDEF,0x8002,
+	0xF610,0x0000,0xEDF0,0x8002,0xEDCF,0xC012,0x9C9B,0xA453,
+	0x939C,0x5B93,0x9B9B,0xE39A,0xA2A3,0x9D9C,0x9D64,0xA400,
+	0x0002,0xBBE8,0x5415,0x245B,0xC008,0xEDAC,0xEBAC,0xB464,
+	0x9364,0x1300,0x0009,0x1BF6,0x9C70,0xFF5A,0xFF7B,0xFF15,
+	0xFECF,0xFF0E,0xF6ED,0xEE2C,0xE56C,0xC005,0x435C,0x9C5B,
+	0x0B5D,0x0002,0xC3EA,0xDC0A,0xF46B,0xC00D,0xECAB,0xAA62,
+	0x5A53,0x0303,0x040C,0x94DD,0x9CEC,0x0000,0xC263,0xC006,
+	0xF4F5,0xACFC,0xFCFB,0xF400,0x8002,0xF4A3,0xC013,0x9C9C,
+	0x565C,0xA4E4,0x6CA3,0xACA4,0x649B,0xA464,0xDD6D,0xA5E4,
+	0x65BF,0x0001,0xE54F,0xE591,0x8005,0x9941,0x8004,0x9961,
+	0x8004,0x9941,0x0000,0x9961,0x8004,0x9941,0xC003,0x645C,
+	0x1C64,0x0004,0x58C1,0x48A0,0x48C1,0xB103,0xF861,0x8060,
+	0xF800,0x0008,0xF861,0xB9C5,0x72C7,0x7B27,0x93EA,0xB48C,
+	0xCD0D,0xDD8E,0xEDEF,0xC017,0xED64,0x9CA3,0x9DA4,0x9B9C,
+	0xA453,0x9A9C,0x935B,0x9B9B,0x9BDA,0xA3A3,0xA39D,0x5D5D,
+	0x0001,0x73F1,0x243B,0xC009,0xA4AC,0xEDAB,0xEDAB,0xAC64,
+	0xA354,0x000A,0x7411,0xE409,0xFDD2,0xFF5A,0xFF7B,0xFF15,
+	0xFEEE,0xFF0E,0xF6ED,0xEE2C,0xE56C,0xC005,0x4C53,0x9C5B,
+	0x0B5D,0x0002,0xC3CA,0xDC2A,0xF48B,0xC00C,0xE4B3,0x62A2,
+	0x624B,0x0303,0x040C,0x94DD,0x9C00,0x0000,0xBA43,0xC005,
+	0xECF4,0xF4B5,0xF4FC,0x0001,0xEC44,0xF463,0x8002,0xF4A3,
+	0xC013,0x9C9C,0x555D,0xA4EC,0x64A3,0xAC64,0x9CA3,0xA49C,
+	0x65ED,0xA5A5,0x64FF,0x0001,0xE52F,0xE571,0x8004,0x9941,
+	0x8004,0x9961,0xC003,0x9CA4,0xACA4,0x8006,0x9941,0xC003,
+	0x645C,0x1C5C,0x0004,0x58C1,0x48A0,0x50E2,0xB8E3,0xF820,
+	0x8062,0xF800,0x0008,0xF820,0xC985,0x7AC7,0x7B48,0x93CA,
+	0xB48C,0xCD2D,0xDD8F,0xEDF0,0xC014,0xEC64,0x9B9D,0xA39C,
+	0xA49C,0x5B93,0x9B9C,0x539B,0x9ADB,0x9AA3,0xA3A4,0x9C00,
+	0x0001,0xA3EB,0x3438,0x8002,0x243B,0xC006,0xACEC,0xACED,
+	0x6BEC,0x6C00,0x000C,0x4C96,0xABAA,0xEB66,0xF428,0xFDF2,
 	0xFF3A,0xFF7B,0xFF14,0xFECE,0xFF0E,0xF6ED,0xEE2C,0xE56C,
-	0xDCEC,0xD4CB,0xD4AB,0xCC8A,0xBC29,0xB3EA,0xC3EA,0xDC2A,
-	0xF46B,0xFC8C,0xFCCA,0xF4E8,0xF4E6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB301,0xAAA1,0xA241,0xAA22,0xAA22,0xBA43,0xC263,
-	0xCAA3,0xD2E4,0xD324,0xDB64,0xE3C4,0xEC44,0xF463,0xF4A3,
-	0xF4A3,0xF4A3,0xF483,0xF463,0xEC25,0xE405,0xE406,0xEC25,
-	0xE425,0xE424,0xE444,0xDC44,0xDC44,0xDC23,0xDC23,0xDC04,
-	0xDC04,0xDC25,0xDC26,0xD447,0xD427,0xDC6A,0xE54F,0xE571,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,
-	0x9942,0x9941,0x9941,0x9941,0x9961,0x9961,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9141,0x8921,0x7901,0x70E1,
-	0x58C1,0x48A0,0x5902,0xC924,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF840,0xD1C5,0x82E8,0x7B28,0x9BEA,0xB48C,
-	0xCD2E,0xDD8F,0xEDF0,0xEE10,0xEDF0,0xEDEF,0xEDD0,0xEDB0,
-	0xEDAF,0xEDAF,0xE56E,0xE52D,0xE50C,0xE4EC,0xDCCB,0xDCAA,
-	0xDC69,0xE447,0xE446,0xE424,0xE423,0xE422,0xE403,0x1C1B,
-	0x1C3B,0x243B,0x241B,0x243B,0x245B,0x2C7B,0x2C9B,0x34BB,
-	0x2CDB,0x34FB,0x44B8,0x7C10,0x7C10,0x7C10,0x7BEF,0x83F0,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x8410,0x7BEF,
-	0x7BEF,0xC44E,0xFCCA,0xFCE8,0xF4E6,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB301,0xAAA1,0xA241,0xAA22,0xAA22,0xBA43,0xC263,
-	0xCAA3,0xD2E4,0xDB24,0xDB64,0xE3C4,0xEC24,0xF483,0xF4A3,
-	0xF4C3,0xF4A3,0xF483,0xF463,0xEC25,0xEC05,0xEC05,0xEC25,
-	0xE425,0xE444,0xE444,0xE444,0xDC44,0xDC23,0xDC23,0xDC04,
-	0xDC04,0xDC25,0xDC26,0xD447,0xD427,0xDC6A,0xE52F,0xE571,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,
-	0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9941,0x9941,
-	0x9941,0x9941,0x9961,0x9141,0x8921,0x7901,0x70E1,0x58C1,
-	0x50A1,0x5902,0xD124,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0xD985,0x82E8,0x7B28,0x93CA,
-	0xB48C,0xCD0D,0xDD8F,0xEDF0,0xEDF0,0xEDF0,0xEDF0,0xEDD0,
-	0xEDAF,0xEDD0,0xED8F,0xE54D,0xE52D,0xE4EC,0xE4CB,0xE4AA,
-	0xDC69,0xDC48,0xE446,0xE445,0xE403,0xE422,0xE403,0x1C1B,
-	0x1C3B,0x243B,0x243B,0x243B,0x245B,0x2C7B,0x2C9B,0x2CBB,
-	0x34DB,0x2CFB,0x2CFB,0x2CDA,0x24BA,0x1499,0x0BF6,0x022E,
-	0x00C6,0x00A5,0x00EB,0x0131,0x00F2,0x0912,0x11D2,0x1A73,
-	0x22F3,0x2B34,0x2B54,0x3375,0x43B5,0x4BF5,0x3C15,0x23B4,
-	0x0B73,0x840F,0xFCEB,0xFCE9,0xF4E7,0xECC4,0xE463,0xD3E2,
-	0xC362,0xB2E1,0xAAA1,0xA241,0xAA22,0xAA22,0xBA43,0xC283,
-	0xCAA3,0xD2E4,0xDB24,0xDB65,0xE3C4,0xEC24,0xF483,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF464,0xEC45,0xEC25,0xEC25,0xE425,
-	0xE425,0xE444,0xE444,0xE444,0xDC44,0xDC43,0xDC23,0xDC04,
-	0xDC04,0xDC25,0xDC26,0xDC47,0xD427,0xDC6A,0xE52E,0xE570,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9141,0x8921,0x7921,0x70E1,0x60E1,0x48A0,
-	0x50C1,0xD124,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF840,0xD9A5,0x7AC7,0x7B28,
-	0x93CA,0xB48C,0xCD2E,0xDD8F,0xE5D0,0xEDF0,0xEDF0,0xEDD0,
-	0xEDB0,0xEDD0,0xE58F,0xE56E,0xE52D,0xE50C,0xE4CB,0xE4AB,
-	0xDC69,0xE448,0xE447,0xE425,0xE403,0xE423,0xE403,0x1C1B,
-	0x243B,0x243B,0x243B,0x243B,0x245B,0x2C7B,0x2C9B,0x2C9B,
-	0x34DC,0x34FB,0x2CFB,0x24DA,0x24BA,0x1499,0x0BF6,0x022D,
-	0x00C6,0x00A5,0x010B,0x0131,0x00F2,0x0912,0x11B3,0x1A73,
-	0x22F4,0x2B34,0x2B34,0x3375,0x43B5,0x4BF5,0x3C15,0x23B4,
-	0x0B73,0x7BEF,0xFCCB,0xFCE9,0xF4E7,0xECC4,0xE463,0xD3E2,
-	0xC362,0xB301,0xA281,0xA241,0xAA22,0xB222,0xBA42,0xC283,
-	0xCAC3,0xD304,0xDB25,0xDB65,0xE3C4,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF463,0xEC44,0xEC25,0xE425,0xE425,
-	0xE425,0xE444,0xE444,0xE444,0xDC44,0xDC23,0xDC23,0xDC03,
-	0xDC04,0xDC05,0xDC26,0xDC47,0xD427,0xDC69,0xE50E,0xE550,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9961,0x8941,0x8121,0x7101,0x58C1,0x48A0,0x50A1,
-	0xB8E3,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xF820,0xF820,0xF841,0xF861,0xF041,0xE820,0xE861,0xF082,
-	0xE861,0xE820,0xF041,0xF861,0xF841,0xF820,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xC985,0x72A7,
-	0x7B28,0x93CA,0xB48C,0xCD2E,0xDD8F,0xEDF0,0xEDF0,0xEDF0,
-	0xEDD0,0xEDD0,0xE5AF,0xE56E,0xE54D,0xE50D,0xE4EC,0xE4CB,
-	0xDC6A,0xE468,0xE446,0xE425,0xE403,0xEC23,0xE423,0x1C1B,
-	0x241B,0x243B,0x243B,0x243B,0x245B,0x2C7C,0x2C7B,0x2CBB,
-	0x34DB,0x2CFB,0x2CFB,0x2CDB,0x24BA,0x1479,0x13D6,0x022E,
-	0x00C6,0x00A5,0x010B,0x0132,0x00F2,0x0912,0x11B3,0x1A73,
-	0x22F3,0x2314,0x2B34,0x3375,0x43B5,0x4BF5,0x3C15,0x23B4,
-	0x0B53,0x7BEF,0xFCEB,0xFCE9,0xF4E7,0xECC4,0xE463,0xD402,
-	0xC362,0xB301,0xAAA1,0xAA61,0xAA42,0xB222,0xBA43,0xC283,
-	0xCAC3,0xD304,0xDB25,0xE365,0xE3C4,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF463,0xF445,0xEC05,0xEC25,0xEC25,
-	0xE445,0xE444,0xE464,0xE464,0xDC44,0xDC43,0xDC23,0xDC03,
-	0xDC04,0xDC25,0xDC26,0xDC47,0xD427,0xDC69,0xDD0E,0xE550,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9141,0x8121,0x7101,0x60E1,0x50A0,0x48A1,0xA904,
-	0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF820,0xF841,0xE861,0xD882,0xC0A2,
-	0xA8A2,0xA0A2,0x88C2,0x80C2,0x78C2,0x68A1,0x70E2,0x7102,
-	0x70E2,0x68A1,0x78E2,0x8102,0x90E2,0xA0E2,0xB0E2,0xC903,
-	0xD8C2,0xF082,0xF841,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xC1C6,
-	0x72C7,0x8348,0x9BEA,0xBCAC,0xCD2E,0xE5AF,0xEDF0,0xEDF0,
-	0xEDD0,0xEDD0,0xEDAF,0xE56E,0xE54E,0xE52D,0xE4EC,0xE4CB,
-	0xDC8A,0xE469,0xE447,0xE425,0xE423,0xE423,0xE423,0x1C1B,
-	0x1C1B,0x243B,0x243B,0x243B,0x245B,0x2C7C,0x2C7B,0x2CBB,
-	0x34DC,0x2CFB,0x2CFB,0x2CDA,0x24DA,0x1499,0x0BD7,0x022E,
-	0x00C6,0x00A5,0x010B,0x0132,0x00F2,0x0912,0x11B3,0x1A73,
-	0x22F3,0x2314,0x2B34,0x3375,0x43B5,0x4BF5,0x3C15,0x23B4,
-	0x0B53,0x7BEF,0xFCEB,0xFCE9,0xF4E7,0xECC4,0xE463,0xD3E2,
-	0xC361,0xB301,0xA281,0xAA41,0xAA42,0xB222,0xBA63,0xC283,
-	0xCAC3,0xD304,0xDB25,0xE365,0xE3C4,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF463,0xEC45,0xEC25,0xEC26,0xEC25,
-	0xE445,0xE444,0xE464,0xE464,0xDC44,0xDC43,0xDC23,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC47,0xD427,0xDC69,0xDD0E,0xDD50,
-	0x9941,0x9941,0x9942,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,
-	0x9141,0x8921,0x7921,0x60C1,0x50A1,0x48A1,0x9903,0xF861,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF840,0xF082,0xD0A2,0xA8A2,0x88C2,0x68C2,0x50C1,0x40C1,
-	0x38A1,0x3080,0x38A0,0x38A0,0x38A0,0x38A0,0x38A0,0x38A0,
-	0x38C0,0x38C0,0x38C1,0x38C1,0x40E1,0x4102,0x4143,0x5184,
-	0x61A4,0x79A5,0x9185,0xB165,0xD924,0xF0A2,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF861,
-	0xAA06,0x72C7,0x8369,0xA40B,0xBCAC,0xD54E,0xE5AF,0xEDF0,
-	0xEDD0,0xEDD0,0xEDB0,0xED8F,0xE56E,0xE52D,0xE50C,0xE4CC,
-	0xE48A,0xE469,0xE447,0xE425,0xE423,0xE423,0xE423,0x1BFC,
-	0x1C1B,0x243B,0x243B,0x243B,0x245B,0x247B,0x2C9B,0x2C9B,
-	0x34DB,0x2CDB,0x2CFB,0x24DA,0x1CBA,0x1479,0x13D7,0x022E,
-	0x00C6,0x00A5,0x010B,0x0132,0x00F2,0x0912,0x11B2,0x1A73,
-	0x22F3,0x2314,0x2B34,0x3374,0x43B5,0x43F5,0x3C15,0x23B4,
-	0x0B53,0x7BEF,0xFCEB,0xFCE9,0xF4E7,0xECC5,0xE463,0xD3E2,
-	0xC361,0xB301,0xAA81,0xAA41,0xAA41,0xB222,0xBA42,0xC283,
-	0xCAC3,0xD2E4,0xDB44,0xDB85,0xE3C5,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF483,0xF464,0xEC26,0xEC26,0xE425,
-	0xE445,0xE444,0xE464,0xE444,0xE444,0xDC43,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xE4ED,0xE52F,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9961,0x9941,0x9941,0x9941,0x9941,0x9941,0x9962,0x9161,
-	0x8941,0x7921,0x68E1,0x50C1,0x48A0,0x8923,0xF061,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xF081,0xC0C2,
-	0x90C2,0x68E2,0x48C1,0x38A0,0x38A0,0x3080,0x3080,0x3080,
-	0x3080,0x3080,0x38A0,0x38A0,0x3880,0x38A0,0x38A0,0x38A0,
-	0x38A0,0x38C0,0x38C0,0x38C0,0x38E1,0x4101,0x4122,0x4163,
-	0x4984,0x49A5,0x49C6,0x4A07,0x6A89,0x8269,0xA1E7,0xC945,
-	0xF082,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF082,0x9A47,0x72E8,0x8B89,0xA42B,0xC4ED,0xDD6F,0xE5D0,
-	0xEDF0,0xEDD1,0xEDD0,0xED8F,0xE56E,0xE52E,0xE50D,0xE4EC,
-	0xE4AB,0xDC89,0xE468,0xE426,0xE424,0xE423,0xE423,0x1BFC,
-	0x1C1B,0x243B,0x243B,0x243B,0x245B,0x245C,0x2C7C,0x2C9C,
-	0x34DB,0x2CDB,0x2CFB,0x24DA,0x24B9,0x1479,0x13D7,0x022D,
-	0x00C6,0x00A5,0x010B,0x0132,0x00F3,0x0912,0x11B2,0x1A73,
-	0x22F3,0x2314,0x2B34,0x3354,0x4395,0x43F5,0x3BF5,0x1B94,
-	0x0B52,0x7BEF,0xFCEB,0xFCE9,0xF4E7,0xECC5,0xE463,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA61,0xAA21,0xB222,0xBA63,0xC283,
-	0xCAC3,0xD304,0xDB44,0xDB85,0xE3C5,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF483,0xF444,0xEC26,0xEC26,0xE445,
-	0xE445,0xE444,0xE464,0xE464,0xE444,0xDC43,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xE4ED,0xE52F,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9141,0x8921,
-	0x8121,0x7101,0x58E1,0x48A0,0x7123,0xE8A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0xD0C2,0x90E2,0x58C1,0x40C1,
-	0x3080,0x3080,0x3080,0x3080,0x38A0,0x3080,0x38A0,0x3080,
-	0x3080,0x3880,0x3880,0x38A0,0x38A0,0x38A0,0x38A0,0x38A0,
-	0x38A0,0x38C0,0x38C1,0x38C1,0x38E1,0x40E1,0x4122,0x4143,
-	0x4183,0x49A4,0x49C5,0x49E6,0x5248,0x5AAA,0x5AAA,0x5A69,
-	0x7207,0x99A6,0xD904,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF0C3,0x8AA8,0x7308,0x93AA,0xAC6C,0xCD0E,0xDD6F,
-	0xEDD0,0xEDF1,0xEDD1,0xEDAF,0xE58F,0xE54E,0xE50D,0xE50C,
-	0xE4AB,0xDC89,0xE468,0xE426,0xE424,0xEC23,0xE423,0xE404,
-	0xE3E4,0xDBC4,0xE3C4,0xDBC4,0xDBC4,0xDBA3,0xD383,0xD364,
-	0xCB24,0xD324,0xD304,0xD324,0xE366,0xEB86,0xEC28,0xFDD2,
-	0xFF39,0xFF5A,0xFEF3,0xFECC,0xFF0C,0xF6ED,0xEE4C,0xE58C,
-	0xDD0C,0xDCEC,0xD4CB,0xCCAA,0xBC4A,0xBC0A,0xC40B,0xDC6B,
-	0xF4AD,0xFCED,0xFCEB,0xFD0A,0xFD07,0xECC5,0xE443,0xD3E2,
-	0xC361,0xB301,0xAAA1,0xAA62,0xAA21,0xB222,0xBA63,0xC283,
-	0xCAC3,0xD304,0xDB45,0xE385,0xE3C5,0xEC24,0xF463,0xF483,
-	0xF4C3,0xF4C3,0xF4A3,0xF483,0xF464,0xEC26,0xEC26,0xEC45,
-	0xE445,0xE465,0xE464,0xE464,0xE444,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xE4ED,0xDD4F,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9961,0x9141,0x8121,
-	0x7101,0x58C1,0x50A1,0x50E2,0xD8C3,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xF861,0xC0C2,0x70C2,0x40A1,0x38A0,0x3080,0x3080,
-	0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,
-	0x3080,0x3080,0x38A0,0x38A0,0x3880,0x3880,0x38A0,0x38A0,
-	0x38A0,0x38C0,0x38C0,0x38C0,0x38E1,0x40E1,0x3902,0x4142,
-	0x4963,0x4984,0x49C5,0x49E6,0x4A27,0x5289,0x5AAA,0x5269,
-	0x5228,0x5227,0x6207,0x81E6,0xC923,0xF881,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xE124,0x7AC8,0x7B28,0x9BCA,0xB48C,0xCD2E,
-	0xE58F,0xEDD1,0xEDD1,0xEDB0,0xE58F,0xE54E,0xE52D,0xE50C,
-	0xE4CB,0xE48A,0xE488,0xE446,0xE424,0xEC23,0xE423,0xE423,
-	0xE3E4,0xE3E4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD383,0xD364,
-	0xD343,0xD324,0xD304,0xDB25,0xDB45,0xEB86,0xEC28,0xFDD2,
-	0xFF39,0xFF5A,0xFEF3,0xFECC,0xFF0C,0xF6ED,0xEE4D,0xE58C,
-	0xDD0C,0xDCEC,0xD4CB,0xCCAA,0xBC4A,0xBC0A,0xC40A,0xE46B,
-	0xF4AD,0xFCED,0xFCEB,0xFD09,0xF507,0xF4C5,0xE443,0xD402,
-	0xC361,0xB301,0xAAA1,0xAA61,0xAA42,0xB242,0xBA63,0xC2A3,
-	0xCAC3,0xD304,0xDB44,0xE384,0xE3C5,0xEC24,0xF463,0xF483,
-	0xF4C3,0xF4C3,0xF4A3,0xF483,0xF464,0xEC26,0xEC26,0xE445,
-	0xE445,0xE465,0xE464,0xE464,0xE464,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xDCED,0xDD2F,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9961,0x9961,0x9961,0x9141,0x8121,0x7101,
-	0x60E1,0x50C1,0x40A1,0xB8E3,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF862,
-	0xB0E3,0x68E2,0x3880,0x3080,0x3080,0x3080,0x3080,0x3080,
-	0x3080,0x3880,0x3080,0x3080,0x3080,0x3080,0x40A1,0x48C1,
-	0x60C1,0x78C2,0x88C2,0x98C2,0xA081,0xB0C2,0xB903,0xB8A2,
-	0xB903,0xB0C2,0xA0A1,0xA0E2,0x90E2,0x8102,0x6922,0x5943,
-	0x4963,0x4984,0x49A4,0x49E5,0x4A07,0x5269,0x52AA,0x5A89,
-	0x5248,0x5227,0x5227,0x5207,0x51C5,0x79A4,0xB923,0xF881,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xC985,0x6AC7,0x8349,0x9C0B,0xBCAD,
-	0xD54F,0xE5B0,0xEDD0,0xEDB0,0xE5AF,0xE54E,0xE52E,0xE50D,
-	0xE4EC,0xE48A,0xE469,0xE447,0xE425,0xE423,0xEC23,0xE423,
-	0xE404,0xE3E4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD364,
-	0xCB44,0xD324,0xD324,0xDB25,0xDB45,0xEB86,0xF429,0xFDD2,
-	0xFF39,0xFF5A,0xFEF3,0xFECC,0xFEEB,0xF6EC,0xEE4D,0xE58C,
-	0xDD0C,0xDCEB,0xD4EB,0xCCAB,0xBC6A,0xBC2A,0xC40B,0xE46B,
-	0xFCAD,0xFCED,0xFD0B,0xFD09,0xF4E7,0xECC5,0xE463,0xD3E2,
-	0xC382,0xB302,0xAAA1,0xAA61,0xAA42,0xB242,0xBA63,0xC2A3,
-	0xCAC3,0xD304,0xDB44,0xE385,0xE3C5,0xEC24,0xF463,0xF4A3,
-	0xF4C3,0xF4C3,0xF4A3,0xF483,0xF464,0xEC25,0xEC46,0xE445,
-	0xE445,0xE464,0xE464,0xE464,0xE464,0xDC43,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xDCCD,0xE50F,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9961,0x9961,0x9141,0x8921,0x7901,0x68E1,
-	0x58C1,0x48A0,0x9903,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xC8C2,0x70C2,
-	0x3881,0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,
-	0x3080,0x3080,0x38A0,0x58C2,0x80C2,0xA8C2,0xC0A2,0xE082,
-	0xE841,0xF041,0xF040,0xF000,0xF800,0xF820,0xF820,0xF800,
-	0xF820,0xF800,0xF000,0xF820,0xF020,0xF041,0xF061,0xE0A2,
-	0xC8C2,0xB144,0x8964,0x69C6,0x51E7,0x5248,0x5AAA,0x5A8A,
-	0x5269,0x5227,0x5207,0x5207,0x49E5,0x49C4,0x5182,0x7963,
-	0xC903,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C2,0xD144,0xF041,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF861,0xAA06,0x6AE8,0x8B69,0xA42C,
-	0xC4EE,0xDD6F,0xE5D0,0xEDD0,0xEDB0,0xE56E,0xE54E,0xE50D,
-	0xE4EC,0xE4AB,0xE489,0xE447,0xE425,0xEC23,0xEC43,0xE423,
-	0xE403,0xE3E4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD364,
-	0xCB43,0xD324,0xD324,0xDB25,0xDB45,0xEB86,0xF429,0xFDD2,
-	0xFF39,0xFF59,0xFEF3,0xFECC,0xFF0B,0xF6EC,0xEE4C,0xE58C,
-	0xDD2C,0xDD0C,0xD4EB,0xCCAB,0xC46A,0xBC2A,0xC40B,0xE46C,
-	0xFCCD,0xFD0D,0xFD0B,0xFD2A,0xF507,0xECC5,0xE463,0xD3E2,
-	0xC382,0xB302,0xAAA1,0xAA62,0xAA42,0xB242,0xBA62,0xC2A3,
-	0xCAC3,0xD304,0xDB44,0xDB85,0xE3C5,0xEC04,0xF463,0xF483,
-	0xF4A3,0xF4C3,0xF4A3,0xF483,0xF464,0xEC25,0xEC46,0xE445,
-	0xE445,0xE464,0xE464,0xE464,0xE464,0xDC43,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC49,0xDCCC,0xE50E,
-	0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,0x9941,
-	0x9941,0x9941,0x9961,0x9962,0x9141,0x8121,0x70E1,0x58C1,
-	0x48A1,0x7103,0xE082,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF020,0xB8E3,
-	0xD061,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF820,0xE0A2,0x88E3,0x40A1,0x3080,
-	0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,0x3080,0x38A1,
-	0x58E2,0x90A2,0xC0A1,0xE861,0xF841,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xF841,0xE8A2,0xC903,0xA185,0x7A69,0x5ACA,
-	0x5269,0x5228,0x5227,0x5207,0x4A06,0x49E5,0x49A3,0x4962,
-	0x5162,0x9143,0xE0C2,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE0E3,0x7A25,0xB184,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE8C2,0x8A87,0x7B08,0x93AA,
-	0xB46C,0xCD0F,0xDD90,0xEDD1,0xEDB0,0xED8F,0xE54E,0xE52D,
-	0xE4EC,0xE4CB,0xE489,0xE447,0xE425,0xE424,0xEC43,0x3BD8,
-	0xBBE8,0xDBC4,0xE3E4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD364,
-	0xCB43,0xD324,0xD324,0xD324,0xDB45,0xEB86,0xF429,0xFDD2,
+	0xC005,0x445B,0x9C5B,0x0B55,0x0002,0xC3EA,0xDC2A,0xF46B,
+	0xC00C,0xEDB2,0x6AA2,0x5A4B,0x0303,0x0C4C,0x4CDD,0xA400,
+	0x0000,0xBA43,0xC005,0xECF4,0xF5B4,0xF4FC,0x0001,0xEC44,
+	0xF463,0x8002,0xF4A3,0xC013,0x9C9C,0x565C,0xA5EB,0x64A3,
+	0xAC64,0xA49B,0xA49D,0xA4AD,0xA56D,0x9CF7,0x0001,0xE54F,
+	0xE571,0x8004,0x9941,0x8002,0x9961,0x0000,0x9942,0x8002,
+	0x9941,0x0001,0x9961,0x9961,0x8005,0x9941,0xC003,0x645C,
+	0x1C5C,0x0004,0x58C1,0x48A0,0x5902,0xC924,0xF841,0x8064,
+	0xF800,0x0008,0xF840,0xD1C5,0x82E8,0x7B28,0x9BEA,0xB48C,
+	0xCD2E,0xDD8F,0xEDF0,0xC013,0xAC9C,0xA39D,0x9CA3,0xA453,
+	0x939B,0x9C5B,0x9B93,0xDAA3,0x9AA3,0xA39D,0x0000,0x1C1B,
+	0xC009,0xACE4,0x9CAC,0xACEC,0xACEC,0x6CEC,0x0000,0x44B8,
+	0x8002,0x7C10,0x0001,0x7BEF,0x83F0,0x800D,0x7BEF,0x0004,
+	0x8410,0x7BEF,0x7BEF,0xC44E,0xFCCA,0xC00A,0xAA62,0x5A4B,
+	0x0303,0x0C4C,0x4CDD,0xA400,0x0000,0xBA43,0xC011,0xECF4,
+	0xF5F4,0xB4FC,0xFCFB,0xACAC,0x9C9C,0x9C56,0x9CA4,0xAC64,
+	0x8002,0xE444,0xC009,0x649B,0xA49D,0xA4AD,0xA56D,0x9CF7,
+	0x0001,0xE52F,0xE571,0x8004,0x9941,0x8002,0x9961,0x8003,
+	0x9941,0x0001,0x9961,0x9961,0x8003,0x9941,0xC004,0xAC5C,
+	0x5C1C,0x5C00,0x0004,0x58C1,0x50A1,0x5902,0xD124,0xF820,
+	0x8066,0xF800,0x0007,0xF841,0xD985,0x82E8,0x7B28,0x93CA,
+	0xB48C,0xCD0D,0xDD8F,0x8003,0xEDF0,0xC00F,0x9C9B,0xAD93,
+	0x529C,0x939B,0x9B53,0x9BE2,0xA392,0xAB9D,0x0001,0x1C1B,
+	0x1C3B,0x8002,0x243B,0xC009,0xACEC,0xACAC,0xEC6C,0xA49B,
+	0x5C1B,0x0014,0x0BF6,0x022E,0x00C6,0x00A5,0x00EB,0x0131,
+	0x00F2,0x0912,0x11D2,0x1A73,0x22F3,0x2B34,0x2B54,0x3375,
+	0x43B5,0x4BF5,0x3C15,0x23B4,0x0B73,0x840F,0xFCEB,0xC00A,
+	0xA262,0x594B,0x0304,0x0354,0x4CDD,0xA400,0x0000,0xBA43,
+	0xC011,0xF4EC,0xF5F4,0xB5FB,0xFCFB,0xACAC,0xA49C,0x955D,
+	0x9CA4,0x64A4,0x8002,0xE444,0xC009,0x64A3,0x9C9D,0xA4AD,
+	0xA5AD,0x5CF7,0x0001,0xE52E,0xE570,0x800F,0x9941,0xC006,
+	0xAC9C,0x645C,0x2454,0x2400,0x0003,0x48A0,0x50C1,0xD124,
+	0xF841,0x8068,0xF800,0x0007,0xF840,0xD9A5,0x7AC7,0x7B28,
+	0x93CA,0xB48C,0xCD2E,0xDD8F,0xC012,0xF5EC,0xA49C,0x9CAC,
+	0x539B,0x939B,0x939C,0x52DB,0xA39A,0x9AAC,0x9C00,0x0000,
+	0x1C1B,0x8003,0x243B,0xC009,0xACEC,0xACA4,0xF5AB,0x645B,
+	0x9C1B,0x0014,0x0BF6,0x022D,0x00C6,0x00A5,0x010B,0x0131,
+	0x00F2,0x0912,0x11B3,0x1A73,0x22F4,0x2B34,0x2B34,0x3375,
+	0x43B5,0x4BF5,0x3C15,0x23B4,0x0B73,0x7BEF,0xFCCB,0xC01A,
+	0xAA62,0x594B,0x0304,0x0B04,0x94DD,0xE4EC,0xF5F4,0xF5ED,
+	0xB4FB,0xFCF3,0xB4AC,0xA49C,0x945D,0x9D00,0x8002,0xE425,
+	0x8002,0xE444,0xC009,0x649B,0xA49C,0xA5A5,0xADAD,0x5CF6,
+	0x0001,0xE50E,0xE550,0x8010,0x9941,0xC003,0xAC1C,0x5C1C,
+	0x0004,0x58C1,0x48A0,0x50A1,0xB8E3,0xF841,0x802C,0xF800,
+	0x8002,0xF820,0xC00C,0xADAC,0x5C5B,0xB5ED,0x5B93,0xEDEC,
+	0x9C9B,0xA400,0x802D,0xF800,0x0007,0xF841,0xC985,0x72A7,
+	0x7B28,0x93CA,0xB48C,0xCD2E,0xDD8F,0x8002,0xEDF0,0xC00E,
+	0x9CA4,0x5B93,0x9B94,0x9B9B,0x4BE2,0x9A9B,0x9AEC,0x6400,
+	0x0001,0x1C1B,0x241B,0x8002,0x243B,0xC009,0xACED,0xA3B4,
+	0xEC6C,0xA49C,0x5B13,0x0014,0x13D6,0x022E,0x00C6,0x00A5,
+	0x010B,0x0132,0x00F2,0x0912,0x11B3,0x1A73,0x22F3,0x2314,
+	0x2B34,0x3375,0x43B5,0x4BF5,0x3C15,0x23B4,0x0B53,0x7BEF,
+	0xFCEB,0xC004,0xA262,0x594B,0x0B00,0x0000,0xC362,0xC024,
+	0x0B4C,0x949D,0xDCED,0xF4F4,0xF5ED,0xF4BB,0xFCF3,0xB4AC,
+	0xA49C,0x949E,0x54AC,0xA46C,0xA3AC,0xA45C,0xA39C,0x9CA5,
+	0xADA5,0xAD5C,0xF600,0x0001,0xDD0E,0xE550,0x8010,0x9941,
+	0xC005,0x641C,0x1C1C,0x1365,0x0001,0xA904,0xF841,0x8029,
+	0xF800,0xC003,0xACAD,0x2C2D,0x0003,0xC0A2,0xA8A2,0xA0A2,
+	0x88C2,0xC006,0x6464,0x1BF5,0xAC9C,0x5300,0x0009,0x78E2,
+	0x8102,0x90E2,0xA0E2,0xB0E2,0xC903,0xD8C2,0xF082,0xF841,
+	0xF820,0x8029,0xF800,0x0007,0xF841,0xC1C6,0x72C7,0x8348,
+	0x9BEA,0xBCAC,0xCD2E,0xE5AF,0xC00D,0xF5A4,0x9CA4,0x9B53,
+	0x9C9B,0x939B,0x53DB,0x9A9A,0x8002,0xE423,0x0001,0x1C1B,
+	0x1C1B,0x8002,0x243B,0xC009,0xACED,0xA3B4,0xED6B,0xA49B,
+	0x6413,0x0014,0x0BD7,0x022E,0x00C6,0x00A5,0x010B,0x0132,
+	0x00F2,0x0912,0x11B3,0x1A73,0x22F3,0x2314,0x2B34,0x3375,
+	0x43B5,0x4BF5,0x3C15,0x23B4,0x0B53,0x7BEF,0xFCEB,0xC02A,
+	0xA262,0x594B,0x0303,0x0C04,0xD4A5,0xDCF5,0xECF4,0xF5ED,
+	0xF4BB,0xFCF3,0xB4AC,0xA49C,0x945E,0x9CA5,0xA36C,0xA3AC,
+	0xA45C,0xA39C,0xA49D,0xADA5,0xAD5C,0xF600,0x0004,0xDD0E,
+	0xDD50,0x9941,0x9941,0x9942,0x800B,0x9941,0xC003,0xAC5C,
+	0x5C24,0x0004,0x60C1,0x50A1,0x48A1,0x9903,0xF861,0x8027,
+	0xF800,0x0009,0xF840,0xF082,0xD0A2,0xA8A2,0x88C2,0x68C2,
+	0x50C1,0x40C1,0x38A1,0x3080,0x8005,0x38A0,0xC006,0xACA4,
+	0xA5A4,0xECAD,0xB500,0x0007,0x5184,0x61A4,0x79A5,0x9185,
+	0xB165,0xD924,0xF0A2,0xF820,0x8027,0xF800,0x0007,0xF861,
+	0xAA06,0x72C7,0x8369,0xA40B,0xBCAC,0xD54E,0xE5AF,0xC00C,
+	0xF59C,0xA49C,0x9B5B,0x939B,0x9492,0x9B9A,0x9A00,0x8002,
+	0xE423,0x0001,0x1BFC,0x1C1B,0x8002,0x243B,0xC009,0xACAC,
+	0xECA4,0xF464,0xAC5B,0x5C53,0x0014,0x13D7,0x022E,0x00C6,
+	0x00A5,0x010B,0x0132,0x00F2,0x0912,0x11B2,0x1A73,0x22F3,
+	0x2314,0x2B34,0x3374,0x43B5,0x43F5,0x3C15,0x23B4,0x0B53,
+	0x7BEF,0xFCEB,0xC02A,0xA262,0x5A4A,0x0303,0x0C44,0x94A4,
+	0xDDEC,0xF5F4,0xEDFC,0xB5F4,0xFBF3,0xB4AC,0xA49C,0x9C9D,
+	0x56A4,0x63AC,0xA3AC,0x9CA4,0x639C,0xA4A5,0xA5AD,0x9D64,
+	0xEE00,0x0001,0xE4ED,0xE52F,0x8007,0x9941,0x0000,0x9961,
+	0x8004,0x9941,0xC004,0xAD63,0x5C1C,0x1400,0x0003,0x50C1,
+	0x48A0,0x8923,0xF061,0x8025,0xF800,0x0007,0xF820,0xF081,
+	0xC0C2,0x90C2,0x68E2,0x48C1,0x38A0,0x38A0,0x8004,0x3080,
+	0x0002,0x38A0,0x38A0,0x3880,0x8003,0x38A0,0x8002,0x38C0,
+	0xC007,0xADEC,0xADB5,0xEDAD,0xADB5,0x0005,0x6A89,0x8269,
+	0xA1E7,0xC945,0xF082,0xF820,0x8025,0xF800,0x0006,0xF082,
+	0x9A47,0x72E8,0x8B89,0xA42B,0xC4ED,0xDD6F,0xC00F,0xFDEC,
+	0x9DA3,0x935B,0x949B,0x9B93,0x5ADB,0x92A2,0xA3A4,0x0001,
+	0x1BFC,0x1C1B,0x8002,0x243B,0xC009,0xACA5,0xECAC,0xF364,
+	0xAC5B,0x9B14,0x0014,0x13D7,0x022D,0x00C6,0x00A5,0x010B,
+	0x0132,0x00F3,0x0912,0x11B2,0x1A73,0x22F3,0x2314,0x2B34,
+	0x3354,0x4395,0x43F5,0x3BF5,0x1B94,0x0B52,0x7BEF,0xFCEB,
+	0xC02A,0xA262,0x5A4A,0x0304,0x0B4C,0x9494,0xE5F5,0xECF4,
+	0xF5F4,0xB5F4,0xFBF3,0xB4AC,0xA49C,0x9C95,0x5EA4,0x6BA4,
+	0xA3AC,0xA49C,0x639C,0xA4A5,0xA5AD,0x9D64,0xEE00,0x0001,
+	0xE4ED,0xE52F,0x800D,0x9941,0xC003,0x645C,0x641C,0x0003,
+	0x58E1,0x48A0,0x7123,0xE8A2,0x8024,0xF800,0x0004,0xF841,
+	0xD0C2,0x90E2,0x58C1,0x40C1,0x8003,0x3080,0xC006,0xEC5C,
+	0xEC5C,0xA4E4,0xA400,0x8005,0x38A0,0xC00E,0xACA5,0xA4AC,
+	0xE4B5,0xADB4,0xEDAD,0xADFE,0xFEA4,0x9300,0x0003,0x7207,
+	0x99A6,0xD904,0xF841,0x8024,0xF800,0x0007,0xF0C3,0x8AA8,
+	0x7308,0x93AA,0xAC6C,0xCD0E,0xDD6F,0xEDD0,0xC01A,0xAD9C,
+	0x9A5C,0x9393,0xA38B,0x5ADB,0x92A2,0xE364,0x9D9C,0x5CE4,
+	0x64A4,0x9B5C,0x9D54,0xE49C,0xAC00,0x000B,0xE366,0xEB86,
+	0xEC28,0xFDD2,0xFF39,0xFF5A,0xFEF3,0xFECC,0xFF0C,0xF6ED,
+	0xEE4C,0xE58C,0xC006,0x449C,0x5B5B,0x0C94,0xE500,0x0001,
+	0xDC6B,0xF4AD,0xC02C,0xF4A2,0xABA1,0x1242,0x0B03,0x0C4C,
+	0x9593,0xE5F5,0xECF4,0xF5F5,0xF4B4,0xFBF3,0xACB4,0xA49C,
+	0x9C9D,0x56A4,0xAB64,0xACA3,0xA49C,0x649B,0xA4A5,0xA5AD,
+	0x9D64,0xEE00,0x0001,0xE4ED,0xDD4F,0x800C,0x9941,0xC003,
+	0xAC5C,0x1C1C,0x0004,0x58C1,0x50A1,0x50E2,0xD8C3,0xF820,
+	0x8021,0xF800,0x0005,0xF820,0xF861,0xC0C2,0x70C2,0x40A1,
+	0x38A0,0x800B,0x3080,0xC003,0xECA4,0x9CA4,0x8002,0x38A0,
+	0x8002,0x38C0,0xC00D,0xADE4,0x6DF4,0xEDAD,0xB5AD,0xB5FE,
+	0xED53,0x93A3,0x0004,0x6207,0x81E6,0xC923,0xF881,0xF820,
+	0x8022,0xF800,0x0006,0xE124,0x7AC8,0x7B28,0x9BCA,0xB48C,
+	0xCD2E,0xE58F,0xC010,0xF6A4,0x9B5B,0x939B,0x9B93,0x93A2,
+	0x929A,0xE364,0xA495,0xA400,0x8002,0xDBC4,0xC007,0x9C5B,
+	0x9D9B,0x9D9C,0xEDAC,0x000A,0xEB86,0xEC28,0xFDD2,0xFF39,
+	0xFF5A,0xFEF3,0xFECC,0xFF0C,0xF6ED,0xEE4D,0xE58C,0xC006,
+	0x449C,0x5B5B,0x0C94,0xE400,0x0001,0xE46B,0xF4AD,0xC006,
+	0xF4A2,0xAA62,0x9202,0x1300,0x0000,0xC361,0xC018,0x0C4C,
+	0x949D,0xE4ED,0xF4EC,0xF5F4,0xF4B5,0xFBF3,0xACB4,0xA49C,
+	0x9C9D,0x56A4,0x6BA4,0xAC00,0x8002,0xE464,0xC008,0x5C9B,
+	0xA4A5,0xA5AD,0x9D64,0xEE00,0x0001,0xDCED,0xDD2F,0x8009,
+	0x9941,0x8002,0x9961,0xC005,0x5C1C,0x1C1C,0x1C1C,0x0000,
+	0xB8E3,0x8022,0xF800,0x0003,0xF862,0xB0E3,0x68E2,0x3880,
+	0x8005,0x3080,0x0000,0x3880,0x8003,0x3080,0x0007,0x40A1,
+	0x48C1,0x60C1,0x78C2,0x88C2,0x98C2,0xA081,0xB0C2,0xC007,
+	0xF58B,0xBD53,0x1BB5,0x242C,0x0000,0x6922,0xC00D,0x2D2C,
+	0xADAC,0xB5AE,0xFEB5,0xDB53,0x9BA4,0x9C92,0x0002,0x79A4,
+	0xB923,0xF881,0x800C,0xF800,0x0000,0xF820,0x8013,0xF800,
+	0x0007,0xF820,0xC985,0x6AC7,0x8349,0x9C0B,0xBCAD,0xD54F,
+	0xE5B0,0xC00F,0xEC9C,0x638B,0x9C9B,0x9B8A,0x9B9A,0x9AA2,
+	0xE464,0x9D9C,0x8002,0xDBC4,0xC007,0x9C5C,0x9C5C,0xDCA4,
+	0xE5AC,0x000A,0xEB86,0xF429,0xFDD2,0xFF39,0xFF5A,0xFEF3,
+	0xFECC,0xFEEB,0xF6EC,0xEE4D,0xE58C,0xC006,0x449B,0x6454,
+	0x1394,0xDD00,0x0001,0xE46B,0xFCAD,0xC01F,0xB4AA,0xA25A,
+	0x5A4A,0x030C,0x044B,0x949D,0xE4ED,0xF4EC,0xF5F4,0xF5B4,
+	0xFBF3,0xB4AC,0xA49C,0x9C9D,0x55AD,0x63A4,0x8003,0xE464,
+	0xC008,0x5B9C,0xA4A5,0xA5AD,0x9D64,0xEE00,0x0001,0xDCCD,
+	0xE50F,0x8009,0x9941,0xC007,0xACA4,0x5C5C,0x1C1C,0x1C1B,
+	0x0001,0x9903,0xF841,0x8012,0xF800,0x0001,0xF841,0xF820,
+	0x800B,0xF800,0x0003,0xF841,0xC8C2,0x70C2,0x3881,0x8008,
+	0x3080,0x0005,0x38A0,0x58C2,0x80C2,0xA8C2,0xC0A2,0xE082,
+	0xC00F,0xD3E4,0xA394,0xE4AC,0xA49C,0xAC9C,0x64EC,0x64AD,
+	0xAC35,0x0004,0xC8C2,0xB144,0x8964,0x69C6,0x51E7,0xC009,
+	0xBDFE,0x9C5B,0x929C,0xA45A,0x9BD2,0x0002,0x7963,0xC903,
+	0xF841,0x800A,0xF800,0x0002,0xE8C2,0xD144,0xF041,0x8012,
+	0xF800,0x0006,0xF861,0xAA06,0x6AE8,0x8B69,0xA42C,0xC4EE,
+	0xDD6F,0xC00F,0xFDE4,0x9C52,0x9C93,0x9B93,0x9A92,0x9AE2,
+	0xAC5C,0x9C9D,0x8002,0xDBC4,0xC007,0x9C5C,0x9C5B,0xDDA4,
+	0xE5AC,0x000A,0xEB86,0xF429,0xFDD2,0xFF39,0xFF59,0xFEF3,
+	0xFECC,0xFF0B,0xF6EC,0xEE4C,0xE58C,0xC006,0x4C9C,0x5B54,
+	0x5354,0xDD00,0x0001,0xE46C,0xFCCD,0xC01F,0xB4A2,0xAB59,
+	0x524A,0x030C,0x044B,0x959C,0xE4EC,0xF5EC,0xF5F4,0xB5F4,
+	0xF3FB,0xACAC,0xAC9C,0x9C9D,0x55AD,0x63A4,0x8003,0xE464,
+	0xC008,0x5B9C,0xA4A5,0xA5AD,0x9D64,0xEE00,0x0001,0xDCCC,
+	0xE50E,0x8009,0x9941,0xC004,0xACA5,0x5B1C,0x1400,0x0003,
+	0x58C1,0x48A1,0x7103,0xE082,0x8012,0xF800,0x0002,0xF020,
+	0xB8E3,0xD061,0x8009,0xF800,0x0003,0xF820,0xE0A2,0x88E3,
+	0x40A1,0x8007,0x3080,0x0006,0x38A1,0x58E2,0x90A2,0xC0A1,
+	0xE861,0xF841,0xF820,0x8012,0xF800,0x0006,0xF820,0xF841,
+	0xE8A2,0xC903,0xA185,0x7A69,0x5ACA,0xC008,0x4B93,0xA39C,
+	0x639B,0x9293,0xE400,0x0002,0x9143,0xE0C2,0xF820,0x8008,
+	0xF800,0x0003,0xE0E3,0x7A25,0xB184,0xF820,0x8012,0xF800,
+	0x0007,0xE8C2,0x8A87,0x7B08,0x93AA,0xB46C,0xCD0F,0xDD90,
+	0xEDD1,0xC00A,0x9B9B,0x539B,0x939B,0x9292,0x9AA3,0xEB00,
+	0x0002,0x3BD8,0xBBE8,0xDBC4,0xC006,0xEC5C,0xA49C,0x5C9C,
+	0x5B00,0x8002,0xD324,0x000B,0xDB45,0xEB86,0xF429,0xFDD2,
 	0xFF39,0xFF59,0xFEF3,0xFECC,0xFEEB,0xF6EC,0xEE4C,0xE58C,
-	0xDD2C,0xDCEC,0xDCEB,0xCCAB,0xBC6A,0xBC2A,0xC40B,0xE46C,
-	0xF4CD,0xFD0D,0xFD2C,0xFD2A,0xF527,0xECE5,0xE464,0xD3E2,
-	0xC382,0xBB01,0xAAA1,0xAA62,0xAA42,0xB242,0xC263,0xCAA3,
-	0xCAC3,0xD304,0xDB44,0xE385,0xE3E5,0xEC25,0xF463,0xF4A4,
-	0xF4C4,0xF4C3,0xF4A3,0xF483,0xF464,0xEC25,0xEC46,0xE445,
-	0xEC45,0xE465,0xE464,0xE464,0xE464,0xDC43,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD428,0xD449,0xDCCC,0xE50E,
-	0x9141,0x9141,0x9941,0x9941,0x9141,0x9141,0x9141,0x9141,
-	0x9961,0x9961,0x9141,0x9141,0x8921,0x7101,0x60E1,0x50A0,
-	0x5102,0xC8E3,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF020,0xA0A2,0x4081,
-	0xC020,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0xB0E2,0x50C2,0x3080,0x3080,0x3080,
-	0x3080,0x3080,0x3080,0x3080,0x3080,0x48A1,0x8902,0xC8C2,
-	0xF061,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xF082,0xD145,
-	0x9A08,0x6248,0x5227,0x4A27,0x4A06,0x49E5,0x49A4,0x4962,
-	0x4941,0x4941,0x6982,0xB923,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF0E3,0x71C3,0x51E3,
-	0xB143,0xF020,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xD144,0x7B09,0x8329,
-	0x9BEA,0xBCAD,0xD54F,0xE590,0xEDB0,0xED8F,0xE54E,0xE52D,
-	0xE4EC,0xE4CB,0xE48A,0xE467,0xE425,0xE423,0xEC43,0x1BDC,
-	0x1BFB,0x7C10,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xD384,0xD364,
-	0xD344,0xD324,0xD324,0xDB25,0xDB65,0xE386,0xF449,0xFDF2,
+	0xC006,0x4C94,0xA314,0x1394,0xDD00,0x0001,0xE46C,0xF4CD,
+	0xC00C,0xF4AB,0xA261,0x5243,0x020C,0x430C,0x959C,0xE400,
+	0x0000,0xC263,0xC012,0xF4AC,0xF5F4,0xF5BC,0xF4F2,0xB5AC,
+	0xA39C,0x9C9D,0x55AD,0x63E4,0x6C00,0x8002,0xE464,0xC008,
+	0x5B9C,0xA4A5,0xA5AD,0x9D65,0xAD00,0x0005,0xDCCC,0xE50E,
+	0x9141,0x9141,0x9941,0x9941,0x8003,0x9141,0xC004,0xECA4,
+	0x5CA4,0x5C00,0x0005,0x7101,0x60E1,0x50A0,0x5102,0xC8E3,
+	0xF820,0x8011,0xF800,0x0003,0xF020,0xA0A2,0x4081,0xC020,
+	0x8008,0xF800,0x0002,0xF841,0xB0E2,0x50C2,0x8007,0x3080,
+	0x0004,0x48A1,0x8902,0xC8C2,0xF061,0xF820,0x801A,0xF800,
+	0x0004,0xF820,0xF082,0xD145,0x9A08,0x6248,0xC007,0x1B64,
+	0x9B9B,0x9392,0x9BA4,0x0002,0x6982,0xB923,0xF841,0x8007,
+	0xF800,0x0004,0xF0E3,0x71C3,0x51E3,0xB143,0xF020,0x8011,
+	0xF800,0x0007,0xF820,0xD144,0x7B09,0x8329,0x9BEA,0xBCAD,
+	0xD54F,0xE590,0xC00A,0xEC9B,0x539B,0x939B,0x9399,0x92A2,
+	0xEC00,0x0002,0x1BDC,0x1BFB,0x7C10,0x8002,0xDBC4,0xC008,
+	0x9C5C,0x9C9C,0x9CA4,0xE5B4,0xED00,0x0009,0xF449,0xFDF2,
 	0xFF39,0xFF5A,0xFEF3,0xFECB,0xFEEB,0xFECC,0xEE4C,0xE5AC,
-	0xDD2C,0xDCEC,0xD4EB,0xCCAB,0xC46A,0xBC2A,0xC42B,0xE46C,
-	0xBC6E,0xA44F,0xFD2C,0xFD2A,0xF528,0xECC5,0xE463,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA61,0xAA42,0xB242,0xC283,0xCAA3,
-	0xCAE3,0xD304,0xDB65,0xDB85,0xE3C5,0xEC25,0xF464,0xF484,
-	0xF4C4,0xF4C3,0xF4A3,0xF484,0xF464,0xEC46,0xEC46,0xE445,
-	0xE465,0xE465,0xE464,0xE464,0xE464,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC27,0xD427,0xDC48,0xDCCC,0xE50E,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9961,0x9961,0x9141,0x8921,0x7901,0x68E1,0x58C1,0x48A0,
-	0xA923,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF821,0xA8A2,0x3080,0x4060,
-	0xC820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE8A2,0x8103,0x3881,0x3080,0x3080,0x3080,0x3080,
-	0x3080,0x3080,0x3081,0x58C2,0xA103,0xE882,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xE8C3,0xB1A6,0x6A27,0x5227,0x49E5,0x49C4,0x4983,
-	0x4941,0x4941,0x4941,0x5162,0x9183,0xE8C2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF0E3,0x71C4,0x51C3,
-	0x51E4,0xB944,0xF821,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF861,0xB9E6,0x72C8,
-	0x8B6A,0xAC4C,0xC4EE,0xD54F,0xE5B1,0xE58F,0xED6E,0xE54E,
-	0xE50C,0xE4CB,0xE48A,0xE468,0xE446,0xE424,0xEC43,0x1BDC,
-	0x1BFC,0x1C1B,0x3C18,0xABEA,0xDBC4,0xDBC4,0xD384,0xD364,
-	0xD344,0xD324,0xD324,0xDB24,0xDB66,0xE386,0xEC49,0xFDF2,
-	0xFF39,0xFF5A,0xFEF2,0xFECB,0xFEEA,0xF6CC,0xEE4C,0xE5AD,
-	0xDD2C,0xDCEC,0xD4EB,0xCCCB,0xC46A,0xBC2A,0xBC2B,0x73F0,
-	0x0332,0x8410,0xFD2C,0xFD2B,0xF528,0xECC5,0xE463,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA62,0xB242,0xBA42,0xC283,0xCAA3,
-	0xD2E4,0xD324,0xDB64,0xDB85,0xE3C5,0xEC25,0xF464,0xF484,
-	0xF4C4,0xF4C3,0xF4A3,0xF483,0xF464,0xEC46,0xEC46,0xEC45,
-	0xE465,0xE465,0xE464,0xE464,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC47,0xD427,0xD448,0xDCCC,0xDD0D,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9941,0x9141,0x8121,0x7101,0x58E1,0x48A1,0x7103,
-	0xE882,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0xB124,0x3881,0x3060,0x4060,
-	0xC820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xC8E3,0x5902,0x3080,0x3880,0x3080,0x3080,0x3080,0x3080,
-	0x3880,0x50C1,0xA8E3,0xF062,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF082,0xB186,0x69E6,0x49C5,0x49A3,
-	0x4962,0x4941,0x4941,0x4961,0x5161,0x71C3,0xD123,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF0E3,0x71E4,0x51C3,
-	0x51E3,0x5A04,0xB9A5,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8A2,0x9267,
-	0x7B08,0x93AA,0xB46D,0xCD0E,0xE590,0xEDB0,0xE58F,0xE54E,
-	0xE50D,0xE4CC,0xE4AB,0xE468,0xE426,0xE424,0xEC43,0x13DC,
-	0x1BFB,0x1C1B,0x1C1B,0x243B,0x73F1,0xD3C6,0xDBA3,0xD384,
-	0xD344,0xD324,0xD324,0xDB25,0xDB65,0xEB86,0xF449,0xFE13,
-	0xFF39,0xFF59,0xFEF2,0xFEAB,0xFEEA,0xF6CB,0xEE4C,0xE5AD,
-	0xDD2C,0xDD0C,0xD50C,0xCCCB,0xC46A,0x940E,0x4BD3,0x1B73,
-	0x0B12,0x7BEF,0xFD4C,0xFD2B,0xF528,0xECE6,0xE464,0xD3E2,
-	0xC362,0xB302,0xAAA1,0xAA62,0xB242,0xBA42,0xC283,0xCAA3,
-	0xD2E4,0xD324,0xDB64,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC4,0xF4A3,0xF483,0xF464,0xEC46,0xEC46,0xEC65,
-	0xE465,0xE465,0xE484,0xE484,0xE464,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC47,0xD427,0xDC48,0xDCCC,0xDD0D,
-	0x9141,0x9141,0x9141,0x9941,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9141,0x8921,0x7901,0x60C1,0x50A1,0x50E2,0xC8E3,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xB8C3,0x4081,0x3080,0x3080,0x4060,
-	0xC820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF861,0xA903,
-	0x40C1,0x3880,0x3880,0x3880,0x3080,0x3080,0x3080,0x48A1,
-	0x90C2,0xE8A2,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xE8C3,0xA185,0x61C4,
-	0x4962,0x4961,0x4961,0x5161,0x5981,0x5981,0x61A2,0xB164,
-	0xF861,0xF800,0xF800,0xF800,0xF800,0xF0E3,0x71C4,0x51C3,
-	0x59E3,0x5A04,0x6224,0xC964,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xD165,
-	0x72E8,0x8349,0x9BEB,0xBCAD,0xD52F,0xE590,0xED8F,0xE54E,
-	0xE50D,0xE4EC,0xE4AB,0xE488,0xE446,0xE424,0xEC43,0x1BDC,
-	0x1BFC,0x1C1B,0x1C1B,0x243B,0x243B,0x3C38,0xABCA,0xD384,
-	0xD344,0xD324,0xD324,0xDB25,0xE365,0xEB86,0xF449,0xFE13,
-	0xFF39,0xFF59,0xFED2,0xFEAB,0xFEEA,0xF6CB,0xEE4C,0xE58D,
-	0xDD2C,0xDD0C,0xD50C,0xC4AB,0x63F2,0x43D5,0x33D4,0x1B73,
-	0x0312,0x7BEF,0xFD4C,0xFD2B,0xF528,0xECE6,0xE464,0xD3E2,
-	0xC362,0xB302,0xAAA1,0xAA62,0xB242,0xBA42,0xC283,0xCAA3,
-	0xD2E4,0xD324,0xDB64,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC4,0xF4A3,0xF483,0xF484,0xEC46,0xEC46,0xEC65,
-	0xEC65,0xE485,0xE484,0xE484,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC46,0xDC47,0xD427,0xDC48,0xDCCC,0xDCED,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9941,0x9141,0x8121,0x68E1,0x58C1,0x48A1,0x9123,0xF861,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xD0E3,0x48A1,0x3880,0x3880,0x3080,0x4080,
-	0xC820,0xF800,0xF800,0xF800,0xF800,0xF082,0x9123,0x38A0,
-	0x4080,0x3880,0x4080,0x3880,0x3880,0x3881,0x70E2,0xC8E3,
-	0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xD124,
-	0x81A4,0x5162,0x5161,0x5161,0x5981,0x59A1,0x59A2,0x59A2,
-	0xA1A4,0xF082,0xF800,0xF800,0xF800,0xF0E3,0x71E4,0x59E3,
-	0x6224,0x6A44,0x6244,0x6A45,0xD964,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF862,
-	0xAA27,0x72E8,0x8B8A,0xAC4C,0xC4EE,0xDD70,0xED90,0xE56E,
-	0xE52D,0xE4EC,0xE4AB,0xE468,0xE426,0xE424,0xEC43,0x13BC,
-	0x1BFC,0x1C1B,0x1C1B,0x1C3B,0x243B,0x245B,0x2C7C,0x6434,
-	0xCB66,0xD344,0xD324,0xDB45,0xDB65,0xEB86,0xF449,0xFE13,
-	0xFF39,0xFF39,0xFEF2,0xFECA,0xFEE9,0xF6CB,0xEE2C,0xE58D,
-	0xDD4C,0xDD0C,0xA46E,0x3B54,0x3B95,0x43D5,0x33D4,0x1B73,
-	0x0311,0x7BEF,0xFD4C,0xFD4B,0xF528,0xECE6,0xE464,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA62,0xB242,0xBA42,0xC283,0xCAC3,
-	0xD2E4,0xDB24,0xDB64,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC3,0xFCC4,0xF483,0xF484,0xEC45,0xEC46,0xEC45,
-	0xE465,0xE484,0xE484,0xE484,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xD427,0xDC48,0xDCAB,0xE4ED,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x9141,0x8921,0x7101,0x60C1,0x48A0,0x58E2,0xD8C2,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE8C3,0x6102,0x3880,0x3880,0x3880,0x3880,0x4080,
-	0xC820,0xF800,0xF800,0xF800,0xF082,0x8103,0x4080,0x4080,
-	0x4080,0x40A0,0x4080,0x3880,0x40A1,0x98E3,0xF082,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF0A2,0xA943,0x5982,0x5162,0x5981,0x61A2,0x61C2,0x61C2,
-	0x61C2,0x99C4,0xF082,0xF800,0xF800,0xF0E3,0x71E4,0x6203,
-	0x6A44,0x72A5,0x72A5,0x6A85,0x8286,0xE8E3,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xE104,0x82A8,0x7B09,0x93CB,0xBC8D,0xD52F,0xE56F,0xED6F,
-	0xE52E,0xE4EC,0xE4CB,0xE489,0xE426,0xE424,0xEC43,0x13DC,
-	0x1BDC,0x1BFB,0x1C1B,0x243B,0x243B,0x245B,0x2C5C,0x2C9B,
-	0x349A,0x9BAB,0xD324,0xDB45,0xDB65,0xEB86,0xF46A,0xFE33,
-	0xFF39,0xFF39,0xFED2,0xFEAA,0xFEE9,0xF6CB,0xEE2C,0xE5AD,
-	0xCCED,0x5391,0x22F3,0x3334,0x3B95,0x43D4,0x33D4,0x1B73,
-	0x0312,0x7BEF,0xFD4D,0xFD4B,0xF528,0xECE6,0xE464,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA61,0xB242,0xBA42,0xC283,0xCAC3,
-	0xD2E4,0xDB24,0xDB64,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC3,0xFCC4,0xF4A3,0xF484,0xEC66,0xEC46,0xEC65,
-	0xE485,0xEC85,0xE484,0xE484,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDCAB,0xDD0D,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x8921,0x7901,0x68E1,0x58C1,0x48A0,0xA103,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF882,0x7902,0x4080,0x40A0,0x48A0,0x4080,0x3880,0x4080,
-	0xC820,0xF800,0xF820,0xF0A2,0x7903,0x40A0,0x48A0,0x48A0,
-	0x48A0,0x40A0,0x3880,0x58E2,0xB8E3,0xF861,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF861,0xC923,0x71A3,0x5981,0x61A2,0x69E2,0x69E2,
-	0x69E2,0x61E2,0x91C4,0xF0A2,0xF800,0xF0C3,0x79E4,0x6223,
-	0x7A84,0x8B05,0x8326,0x7AE6,0x6AA6,0x9226,0xF882,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF841,0xB1C6,0x6AC8,0x8369,0xAC2C,0xC4CE,0xDD4F,0xED6F,
-	0xE54E,0xE50D,0xE4CC,0xE489,0xE426,0xE445,0xEC43,0x13DC,
-	0x1BDC,0x1BFB,0x1C1B,0x243B,0x243B,0x245B,0x247B,0x2C7B,
-	0x2C9B,0x2CBB,0x5475,0xC368,0xDB45,0xEB86,0xF46A,0xFE33,
-	0xFF39,0xFF39,0xFED1,0xFEA9,0xFEE9,0xF6CB,0xEE4C,0x8C2F,
-	0x2AF2,0x22F3,0x22F3,0x2B34,0x3B95,0x43D4,0x33D4,0x1B73,
-	0x0B12,0x7BEF,0xFD4D,0xFD4B,0xF529,0xECE6,0xE464,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA61,0xB242,0xBA42,0xC283,0xCAC4,
-	0xD304,0xDB24,0xE385,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC3,0xFCC4,0xF4A3,0xF484,0xEC66,0xEC46,0xEC65,
-	0xE485,0xEC85,0xE484,0xE484,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDCAB,0xDCED,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x9141,0x9141,
-	0x8121,0x7101,0x60C1,0x48A0,0x6902,0xE0A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,
-	0x9903,0x40A1,0x48A1,0x50C0,0x50C0,0x48A0,0x4080,0x4080,
-	0xC800,0xF800,0xE881,0x7903,0x40A0,0x48A1,0x48A0,0x48A0,
-	0x40A0,0x40A0,0x6902,0xE0C3,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xE0E3,0x81A3,0x61A2,0x69E2,0x6A02,
-	0x7222,0x6A02,0x61E2,0x91C4,0xF061,0xF8A2,0x79E4,0x6A43,
-	0x82C5,0x9346,0x9B87,0x9367,0x8326,0x6AA6,0xB1E5,0xF841,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE8E3,0x8287,0x7B09,0x9BCB,0xB48D,0xD50E,0xE56F,
-	0xE54E,0xE50D,0xE4CC,0xE489,0xE447,0xE445,0xE443,0x7BEF,
-	0x1BDC,0x1BFB,0x1C1B,0x243B,0x243B,0x245B,0x245C,0x2C7B,
-	0x2C9B,0x2CBB,0x2CDB,0x3499,0x8BEE,0xEB86,0xF46A,0xFE34,
-	0xFF39,0xFF39,0xFED1,0xFEA9,0xFEE9,0xCDAC,0x42D1,0x1A52,
-	0x1AB2,0x22D3,0x22F3,0x2B34,0x3B95,0x43D5,0x33D4,0x1B73,
-	0x0B11,0x83F0,0xFD4D,0xFD4B,0xF529,0xECE6,0xE484,0xD3E2,
-	0xC362,0xB301,0xAAA1,0xAA82,0xB262,0xBA42,0xC283,0xCAC4,
-	0xD2E4,0xDB24,0xDB65,0xE3A5,0xE3E6,0xEC25,0xF464,0xF484,
-	0xF4C4,0xFCC3,0xFCC4,0xF484,0xF484,0xEC66,0xEC46,0xEC65,
-	0xE485,0xEC84,0xE484,0xE484,0xDC64,0xDC44,0xDC23,0xDC23,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDCAB,0xE4ED,
-	0x9141,0x9121,0x9141,0x9141,0x9141,0x9141,0x9141,0x9121,
-	0x7901,0x68E1,0x50A0,0x40A0,0xA8E3,0xF841,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xC8E2,
-	0x50E2,0x48A1,0x58C1,0x58E1,0x58C1,0x48A1,0x40A0,0x4880,
-	0xD020,0xF882,0x8903,0x40A0,0x48A0,0x50C0,0x50C1,0x48A1,
-	0x4080,0x8103,0xE8A2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF0A2,0x91A4,0x61C2,0x69E2,
-	0x7222,0x7222,0x6A02,0x61E2,0xA163,0xF944,0x8204,0x6A44,
+	0xC006,0x4494,0x6354,0x5354,0xE500,0x0003,0xE46C,0xBC6E,
+	0xA44F,0xFD2C,0xC00A,0xA262,0x494A,0x0304,0x0B4C,0x949D,
+	0xE400,0x0000,0xC283,0xC012,0xECB4,0xEDFD,0xACF4,0xFCF3,
+	0xACB4,0xA39C,0x9D9C,0x5EA4,0x63AC,0xA400,0x8002,0xE464,
+	0xC008,0x5C9B,0xA4A5,0xA5AD,0x9D64,0xED00,0x0001,0xDCCC,
+	0xE50E,0x8007,0x9141,0xC007,0xECA4,0x5C5C,0x1C1C,0x1C1B,
+	0x0001,0xA923,0xF841,0x8011,0xF800,0x0004,0xF821,0xA8A2,
+	0x3080,0x4060,0xC820,0x8007,0xF800,0x0002,0xE8A2,0x8103,
+	0x3881,0x8005,0x3080,0x0004,0x3081,0x58C2,0xA103,0xE882,
+	0xF820,0x8020,0xF800,0x0007,0xF820,0xE8C3,0xB1A6,0x6A27,
+	0x5227,0x49E5,0x49C4,0x4983,0x8002,0x4941,0x0002,0x5162,
+	0x9183,0xE8C2,0x8006,0xF800,0x0005,0xF0E3,0x71C4,0x51C3,
+	0x51E4,0xB944,0xF821,0x8011,0xF800,0x0007,0xF861,0xB9E6,
+	0x72C8,0x8B6A,0xAC4C,0xC4EE,0xD54F,0xE5B1,0xC009,0x9ADB,
+	0x5C92,0x9393,0x9A9A,0x9AEB,0x0005,0x1BDC,0x1BFC,0x1C1B,
+	0x3C18,0xABEA,0xDBC4,0xC008,0xA454,0x9C9C,0x9CA4,0xE4B6,
+	0xEC00,0x0009,0xEC49,0xFDF2,0xFF39,0xFF5A,0xFEF2,0xFECB,
+	0xFEEA,0xF6CC,0xEE4C,0xE5AD,0xC006,0x4394,0x635C,0x4B54,
+	0xA500,0x0003,0x73F0,0x0332,0x8410,0xFD2C,0xC02A,0xA361,
+	0x494A,0x0304,0x0B4C,0x95DC,0xE4F5,0xECF5,0xB4F4,0xADF4,
+	0xFCF3,0xACB4,0xA39C,0x9C9D,0x5EA4,0xA36C,0xA4A3,0xA464,
+	0x9C9B,0xA4A5,0xA5AD,0xA55C,0xAD00,0x0001,0xDCCC,0xDD0D,
+	0x8007,0x9141,0xC004,0xE4A4,0x641C,0x1C00,0x0003,0x58E1,
+	0x48A1,0x7103,0xE882,0x8011,0xF800,0x0005,0xF841,0xB124,
+	0x3881,0x3060,0x4060,0xC820,0x8005,0xF800,0x0004,0xF820,
+	0xC8E3,0x5902,0x3080,0x3880,0x8003,0x3080,0x0003,0x3880,
+	0x50C1,0xA8E3,0xF062,0x8026,0xF800,0x0003,0xF082,0xB186,
+	0x69E6,0x49C5,0xC005,0x9A93,0x9BA4,0xACE4,0x0002,0x71C3,
+	0xD123,0xF820,0x8004,0xF800,0x0006,0xF0E3,0x71E4,0x51C3,
+	0x51E3,0x5A04,0xB9A5,0xF841,0x8011,0xF800,0x0006,0xE8A2,
+	0x9267,0x7B08,0x93AA,0xB46D,0xCD0E,0xE590,0xC009,0xEC5B,
+	0x9393,0x939B,0x9192,0xA2EB,0x0000,0x13DC,0xC003,0xEBAC,
+	0xA4EC,0x0001,0x73F1,0xD3C6,0xC006,0xD95D,0x949C,0xA4E5,
+	0xB400,0x000A,0xEB86,0xF449,0xFE13,0xFF39,0xFF59,0xFEF2,
+	0xFEAB,0xFEEA,0xF6CB,0xEE4C,0xE5AD,0xC004,0x439C,0x6453,
+	0x4B00,0x0005,0x940E,0x4BD3,0x1B73,0x0B12,0x7BEF,0xFD4C,
+	0xC02A,0x9B61,0x5242,0x0204,0x0C4B,0x95DC,0xE4F5,0xECF5,
+	0xB4F4,0xF5B5,0xF3F3,0xACB4,0xE45B,0x9C9D,0x5EA4,0xAB64,
+	0xA4AB,0xA49C,0x5C9B,0xA4A5,0xA5AD,0xA55C,0xED00,0x0001,
+	0xDCCC,0xDD0D,0x8002,0x9141,0x0000,0x9941,0x8003,0x9141,
+	0xC003,0xE464,0x5C1C,0x0004,0x60C1,0x50A1,0x50E2,0xC8E3,
+	0xF820,0x8010,0xF800,0x0006,0xF820,0xB8C3,0x4081,0x3080,
+	0x3080,0x4060,0xC820,0x8004,0xF800,0x0002,0xF861,0xA903,
+	0x40C1,0x8002,0x3880,0x8002,0x3080,0x0003,0x48A1,0x90C2,
+	0xE8A2,0xF820,0x8028,0xF800,0x0004,0xF820,0xE8C3,0xA185,
+	0x61C4,0x4962,0xC005,0xA3A4,0xE4EC,0xA4ED,0x0001,0xB164,
+	0xF861,0x8003,0xF800,0x0007,0xF0E3,0x71C4,0x51C3,0x59E3,
+	0x5A04,0x6224,0xC964,0xF820,0x8010,0xF800,0x0007,0xF820,
+	0xD165,0x72E8,0x8349,0x9BEB,0xBCAD,0xD52F,0xE590,0xC008,
+	0xE353,0x939B,0x9399,0x929A,0xEB00,0x0000,0x1BDC,0xC004,
+	0xACAB,0xA4EC,0xA400,0x0002,0x3C38,0xABCA,0xD384,0xC005,
+	0x949C,0xA4E5,0xF4ED,0x0009,0xF449,0xFE13,0xFF39,0xFF59,
+	0xFED2,0xFEAB,0xFEEA,0xF6CB,0xEE4C,0xE58D,0xC003,0x4B9C,
+	0x640B,0x0006,0x63F2,0x43D5,0x33D4,0x1B73,0x0312,0x7BEF,
+	0xFD4C,0xC02A,0x9B61,0x5242,0x0204,0x0C4B,0x95DC,0xE4F5,
+	0xECF5,0xB4F4,0xF5B5,0xF3F3,0xACB4,0xE45B,0x9CA5,0x56A4,
+	0xABA4,0x6CA3,0xA45C,0x9C9B,0xA4A5,0xA5AD,0xA55C,0xED00,
+	0x0001,0xDCCC,0xDCED,0x8007,0x9141,0x0007,0x9941,0x9141,
+	0x8121,0x68E1,0x58C1,0x48A1,0x9123,0xF861,0x8010,0xF800,
+	0x0007,0xF820,0xD0E3,0x48A1,0x3880,0x3880,0x3080,0x4080,
+	0xC820,0x8003,0xF800,0x0002,0xF082,0x9123,0x38A0,0xC005,
+	0xDC64,0xE464,0xA4A5,0x0002,0x70E2,0xC8E3,0xF841,0x802C,
+	0xF800,0x0003,0xF841,0xD124,0x81A4,0x5162,0xC005,0xA3A4,
+	0xECAC,0xA5A4,0x0001,0xA1A4,0xF082,0x8002,0xF800,0x0002,
+	0xF0E3,0x71E4,0x59E3,0xC003,0xF5EC,0x64E5,0x0000,0xD964,
+	0x8011,0xF800,0x0007,0xF862,0xAA27,0x72E8,0x8B8A,0xAC4C,
+	0xC4EE,0xDD70,0xED90,0xC007,0x5A93,0x9393,0x9192,0xA2EB,
+	0x0000,0x13BC,0xC006,0xF4AB,0xA4AC,0xE4AC,0xED00,0x0001,
+	0x6434,0xCB66,0xC003,0xDA9C,0xEDAC,0x0015,0xEB86,0xF449,
+	0xFE13,0xFF39,0xFF39,0xFEF2,0xFECA,0xFEE9,0xF6CB,0xEE2C,
+	0xE58D,0xDD4C,0xDD0C,0xA46E,0x3B54,0x3B95,0x43D5,0x33D4,
+	0x1B73,0x0311,0x7BEF,0xFD4C,0xC01D,0xA359,0x5242,0x0204,
+	0x0B4C,0x95DC,0xE4F5,0xF4ED,0xF4B4,0xF5B5,0xF3F3,0xACB4,
+	0xE3A5,0x53A5,0x55A5,0xA36C,0x8002,0xE484,0xC00B,0x5C9C,
+	0x9BA4,0xA5A5,0xA5A5,0x64ED,0xBFF6,0x8008,0x9141,0x0005,
+	0x8921,0x7101,0x60C1,0x48A0,0x58E2,0xD8C2,0x8011,0xF800,
+	0x0001,0xE8C3,0x6102,0x8003,0x3880,0x0001,0x4080,0xC820,
+	0x8002,0xF800,0x0001,0xF082,0x8103,0x8002,0x4080,0xC003,
+	0xAC9C,0x64ED,0x0001,0x98E3,0xF082,0x8030,0xF800,0x0005,
+	0xF0A2,0xA943,0x5982,0x5162,0x5981,0x61A2,0x8002,0x61C2,
+	0x0005,0x99C4,0xF082,0xF800,0xF800,0xF0E3,0x71E4,0xC004,
+	0x2BF5,0xFDA4,0x5C00,0x0001,0x8286,0xE8E3,0x8011,0xF800,
+	0x0006,0xE104,0x82A8,0x7B09,0x93CB,0xBC8D,0xD52F,0xE56F,
+	0xC007,0xE453,0x929B,0x9289,0xA2EB,0x0000,0x13DC,0xC008,
+	0xE4AB,0xACEC,0xA4AC,0xE5B3,0xE300,0x0019,0x9BAB,0xD324,
+	0xDB45,0xDB65,0xEB86,0xF46A,0xFE33,0xFF39,0xFF39,0xFED2,
+	0xFEAA,0xFEE9,0xF6CB,0xEE2C,0xE5AD,0xCCED,0x5391,0x22F3,
+	0x3334,0x3B95,0x43D4,0x33D4,0x1B73,0x0312,0x7BEF,0xFD4D,
+	0xC02C,0xA259,0x5242,0x0204,0x0B4C,0x94DD,0xE4F5,0xF4ED,
+	0xF4B4,0xF5B5,0xF3F3,0xACB4,0xE3A5,0x5B9D,0x5E9C,0xAB6C,
+	0xE463,0xA45C,0x9C9B,0xA4A5,0xA5A5,0xA5A4,0xADBF,0xBE00,
+	0x8007,0x9141,0xC004,0x5C1C,0x1C1C,0x1B00,0x0001,0xA103,
+	0xF841,0x8010,0xF800,0x0002,0xF882,0x7902,0x4080,0xC004,
+	0xACE4,0x5C64,0xE400,0x0005,0xC820,0xF800,0xF820,0xF0A2,
+	0x7903,0x40A0,0x8002,0x48A0,0x0004,0x40A0,0x3880,0x58E2,
+	0xB8E3,0xF861,0x8032,0xF800,0x0004,0xF861,0xC923,0x71A3,
+	0x5981,0x61A2,0x8002,0x69E2,0x000D,0x61E2,0x91C4,0xF0A2,
+	0xF800,0xF0C3,0x79E4,0x6223,0x7A84,0x8B05,0x8326,0x7AE6,
+	0x6AA6,0x9226,0xF882,0x8010,0xF800,0x0007,0xF841,0xB1C6,
+	0x6AC8,0x8369,0xAC2C,0xC4CE,0xDD4F,0xED6F,0xC006,0x5B93,
+	0x9391,0x89AB,0xE200,0x0000,0x13DC,0xC009,0xE4AB,0xACEC,
+	0xA4AC,0xACE4,0xACAC,0x0018,0x5475,0xC368,0xDB45,0xEB86,
+	0xF46A,0xFE33,0xFF39,0xFF39,0xFED1,0xFEA9,0xFEE9,0xF6CB,
+	0xEE4C,0x8C2F,0x2AF2,0x22F3,0x22F3,0x2B34,0x3B95,0x43D4,
+	0x33D4,0x1B73,0x0B12,0x7BEF,0xFD4D,0xC02C,0xA25A,0x5142,
+	0x0204,0x0B4C,0x94DD,0xE4F5,0xF5F4,0xECFD,0xACB5,0xF3F3,
+	0xACB4,0xE3A5,0x5B9D,0x5E9C,0xAB6C,0xE463,0xA45C,0x9C9B,
+	0xA4A5,0xA5A5,0xA5A4,0xADBF,0xB600,0x8002,0x9121,0x8004,
+	0x9141,0x0005,0x8121,0x7101,0x60C1,0x48A0,0x6902,0xE0A2,
+	0x8010,0xF800,0x0002,0xF841,0x9903,0x40A1,0xC005,0xE4EB,
+	0xA45C,0x5CA4,0x0004,0xC800,0xF800,0xE881,0x7903,0x40A0,
+	0xC004,0xE5A3,0xA464,0xA400,0x0002,0x6902,0xE0C3,0xF820,
+	0x8034,0xF800,0x0003,0xF820,0xE0E3,0x81A3,0x61A2,0xC004,
+	0xF4AC,0xEC5C,0x5C00,0x000C,0x91C4,0xF061,0xF8A2,0x79E4,
+	0x6A43,0x82C5,0x9346,0x9B87,0x9367,0x8326,0x6AA6,0xB1E5,
+	0xF841,0x8010,0xF800,0x0006,0xE8E3,0x8287,0x7B09,0x9BCB,
+	0xB48D,0xD50E,0xE56F,0xC006,0x9B93,0x9391,0x92A2,0xA200,
+	0x0001,0x7BEF,0x1BDC,0xC00A,0xABAC,0xECA4,0xACA5,0xEBAC,
+	0xACAC,0xD200,0x000B,0x8BEE,0xEB86,0xF46A,0xFE34,0xFF39,
+	0xFF39,0xFED1,0xFEA9,0xFEE9,0xCDAC,0x42D1,0x1A52,0xC003,
+	0xBCED,0xACF5,0x0006,0x3B95,0x43D5,0x33D4,0x1B73,0x0B11,
+	0x83F0,0xFD4D,0xC003,0xA25A,0x514A,0x0000,0xD3E2,0xC027,
+	0x040B,0x4C9D,0xDCDC,0xF5F5,0xECF4,0xB5F4,0xB5F3,0xF3AC,
+	0xB4E3,0xA554,0xA45E,0x9CAB,0x6CE3,0x64A4,0x5C9C,0x9BA4,
+	0xA5A5,0xA5A5,0xA4AD,0xBFF6,0x0001,0x9141,0x9121,0x8004,
+	0x9141,0x0006,0x9121,0x7901,0x68E1,0x50A0,0x40A0,0xA8E3,
+	0xF841,0x800F,0xF800,0x0004,0xF820,0xC8E2,0x50E2,0x48A1,
+	0x58C1,0xC004,0xAC9C,0x1C63,0xDC00,0x0003,0xD020,0xF882,
+	0x8903,0x40A0,0xC004,0xE4EC,0xA55C,0x5B00,0x0001,0x8103,
+	0xE8A2,0x8038,0xF800,0x0002,0xF0A2,0x91A4,0x61C2,0xC004,
+	0xECF4,0xA45C,0x5C00,0x000B,0xA163,0xF944,0x8204,0x6A44,
 	0x8B05,0xA3A6,0xABE7,0xABE8,0x9387,0x7B07,0x72A7,0xD164,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF841,0xB9A5,0x6AC8,0x8B6A,0xAC2C,0xC4CE,0xDD4F,
-	0xE54E,0xED0D,0xE4EC,0xE4A9,0xE467,0xE445,0xEC43,0xEC43,
-	0xCC26,0x4BF5,0x1C1B,0x1C1B,0x243B,0x245B,0x245B,0x2C7B,
-	0x2C9B,0x2CBB,0x2CDB,0x24BA,0x1C9A,0x4C34,0xC44C,0xFE34,
-	0xFF39,0xFF39,0xFED1,0xFEA9,0x7BEF,0x0955,0x11D4,0x1A52,
-	0x22B3,0x22F3,0x22F3,0x2B34,0x3B75,0x3BB5,0x33D4,0x1B73,
-	0x1311,0xAC6F,0xFD6D,0xFD6B,0xF549,0xED06,0xDC84,0xD3E3,
-	0xC362,0xBB01,0xB2C1,0xAA82,0xB262,0xBA62,0xC283,0xCAC4,
-	0xD304,0xDB24,0xDB65,0xE3C5,0xE3E6,0xEC25,0xF464,0xF4A4,
-	0xF4C4,0xFCC3,0xFCC4,0xF4A4,0xF484,0xEC65,0xEC46,0xEC65,
-	0xE485,0xE484,0xE484,0xE484,0xE464,0xDC44,0xDC43,0xDC23,
-	0xDC24,0xDC25,0xDC26,0xDC26,0xDC27,0xDC48,0xDCAB,0xDCED,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x9121,0x8121,
-	0x70E1,0x60A1,0x48A0,0x68E2,0xE8A2,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C3,0x68E2,
-	0x48A0,0x58C1,0x60E1,0x6901,0x60E1,0x50C0,0x40A0,0x4880,
-	0xD861,0xA0E3,0x4080,0x48A0,0x48A1,0x50C0,0x48A1,0x40A0,
-	0x9164,0xF082,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF0A2,0xA1C4,0x69C2,
-	0x6A02,0x7202,0x6A02,0x61E2,0x61E3,0xA226,0x8245,0x7284,
-	0x9325,0xB3E7,0xBC48,0xBC69,0xAC29,0x9388,0x72E7,0x8287,
-	0xF0E3,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF0E3,0x8A67,0x7B09,0x9BCB,0xB48D,0xCD0E,
-	0xE54E,0xE52E,0xE4EC,0xE4AA,0xE468,0xE446,0xEC43,0xEC43,
-	0xEC23,0xE404,0x8BEE,0x2C1A,0x243B,0x243B,0x245B,0x2C7B,
-	0x2C9B,0x2CBB,0x24BA,0x24BA,0x1C9A,0x1479,0x0B75,0x7BEF,
+	0x8010,0xF800,0x0006,0xF841,0xB9A5,0x6AC8,0x8B6A,0xAC2C,
+	0xC4CE,0xDD4F,0xC007,0xE3D3,0x5B91,0x929A,0xE2A4,0x0002,
+	0xCC26,0x4BF5,0x1C1B,0xC009,0xA4EC,0xACA4,0xECAC,0xACAC,
+	0x5B5C,0x000A,0x4C34,0xC44C,0xFE34,0xFF39,0xFF39,0xFED1,
+	0xFEA9,0x7BEF,0x0955,0x11D4,0x1A52,0xC003,0xFDB4,0xA4F5,
+	0x0006,0x3B75,0x3BB5,0x33D4,0x1B73,0x1311,0xAC6F,0xFD6D,
+	0xC003,0xA25A,0x5102,0x0000,0xD3E3,0xC018,0x034B,0x5455,
+	0xDCE4,0xEDF5,0xF4EC,0xB5FC,0xADF3,0xF3B4,0xACE3,0xA55C,
+	0x9C5D,0x9DAB,0x6C00,0x8002,0xE484,0xC00B,0x9C5C,0xA39C,
+	0xA5A5,0xA5A4,0xA5AD,0xBFB6,0x8002,0x9121,0x8002,0x9141,
+	0xC003,0x9C24,0x1414,0x0002,0x48A0,0x68E2,0xE8A2,0x8010,
+	0xF800,0x0003,0xE8C3,0x68E2,0x48A0,0x58C1,0xC005,0xECEC,
+	0x5C1B,0x1CDC,0x0002,0xD861,0xA0E3,0x4080,0xC004,0xECA5,
+	0xEB5D,0x6300,0x0001,0x9164,0xF082,0x803A,0xF800,0x0002,
+	0xF0A2,0xA1C4,0x69C2,0xC004,0xB4E4,0x645C,0xA500,0x000B,
+	0xA226,0x8245,0x7284,0x9325,0xB3E7,0xBC48,0xBC69,0xAC29,
+	0x9388,0x72E7,0x8287,0xF0E3,0x8010,0xF800,0x0006,0xF0E3,
+	0x8A67,0x7B09,0x9BCB,0xB48D,0xCD0E,0xE54E,0xC008,0x9C92,
+	0x9292,0x9AE1,0xA49C,0x5D00,0x0001,0x8BEE,0x2C1A,0xC009,
+	0x6DA4,0xACEC,0xACAC,0x63A4,0x5C5B,0x0009,0x0B75,0x7BEF,
 	0xFF39,0xFF38,0xBD70,0x3254,0x0117,0x0935,0x11D4,0x1A52,
-	0x1AB3,0x22F3,0x22F3,0x2B34,0x3B75,0x3BB4,0x33D4,0x53D1,
-	0xDCCE,0xFD4E,0xFD6D,0xFD6C,0xF549,0xED06,0xE484,0xD403,
-	0xC382,0xBB02,0xAAA1,0xB262,0xB262,0xBA63,0xC283,0xCAC4,
-	0xD304,0xDB24,0xDB65,0xE3C5,0xE3E6,0xEC25,0xF464,0xF4A4,
-	0xFCC4,0xF4C3,0xFCC4,0xF4A4,0xF484,0xEC65,0xEC66,0xEC85,
-	0xEC85,0xEC85,0xE484,0xE484,0xE484,0xE444,0xDC43,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC47,0xD427,0xDC48,0xDCAB,0xDCCD,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x9141,0x8921,0x7901,
-	0x68E1,0x50A0,0x4080,0xA0C2,0xF821,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF862,0x9123,0x40A0,
-	0x50C0,0x6901,0x7101,0x7921,0x6901,0x58C1,0x48A0,0x50A0,
-	0x88E2,0x48C1,0x40A0,0x48A0,0x48A0,0x48A1,0x40A0,0x9944,
-	0xF882,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF882,0xA9C4,
-	0x61C2,0x6A02,0x6A02,0x6A02,0x6202,0x6A23,0x7264,0x82C4,
-	0x9B66,0xBC27,0xCCA9,0xCCCA,0xC48A,0xAC09,0x8B68,0x72E7,
-	0xAA47,0xF882,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF821,0xB1A5,0x72C8,0x8B6A,0xA42C,0xC4CE,
-	0xDD2E,0xED2E,0xECED,0xE4AA,0xE468,0xE446,0xEC44,0xEC43,
-	0xEC23,0xE404,0xE3E4,0xCBE7,0x5C14,0x243B,0x245B,0x2C7B,
-	0x2C9B,0x2CBB,0x2CBB,0x24BA,0x1C9A,0x1479,0x0B75,0x01CB,
-	0x29E9,0x5B2D,0x014E,0x0156,0x0117,0x0956,0x11D4,0x1A53,
-	0x1AB3,0x22D3,0x22F3,0x2B34,0x3B75,0x43D4,0x9C0D,0xE4AC,
-	0xFD0E,0xFD4E,0xFD6D,0xFD6C,0xF549,0xED07,0xE485,0xD403,
-	0xC382,0xBB22,0xB2C1,0xAA81,0xB262,0xBA63,0xC283,0xCAC3,
-	0xD304,0xDB24,0xE365,0xE3C5,0xE3E5,0xEC25,0xF464,0xF4A4,
-	0xFCC4,0xF4C3,0xF4C4,0xF4A4,0xF484,0xF466,0xEC66,0xEC85,
-	0xEC85,0xEC85,0xE484,0xE484,0xE464,0xE444,0xDC43,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC47,0xDC27,0xDC48,0xDCAB,0xE4CD,
-	0x9141,0x9121,0x9121,0x9141,0x9141,0x9141,0x8121,0x70E1,
-	0x58C1,0x48A0,0x60A1,0xE082,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xC103,0x50E2,0x48A1,
-	0x60E1,0x7101,0x8121,0x8121,0x7921,0x60E1,0x50C1,0x48C0,
-	0x40A1,0x4080,0x40A0,0x48A1,0x48A0,0x40A0,0x9164,0xF8A2,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF820,0xF841,0xF820,0xF841,0xF861,
-	0xF841,0xF820,0xF840,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF8A2,
-	0xA205,0x61C2,0x69E2,0x6A02,0x6A23,0x7243,0x82A4,0x9325,
-	0xB3C6,0xCC68,0xDCE9,0xE52A,0xCCEA,0xBC8A,0x9BE9,0x8327,
-	0x72C7,0xD165,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE8C3,0x8267,0x7B09,0x93AB,0xB46D,
-	0xD4EE,0xE52E,0xE50D,0xE4AA,0xE468,0xE446,0xE423,0xEC43,
-	0xEC23,0xE403,0xE3E4,0xE3E4,0xDBE4,0xA3EB,0x345A,0x2C7B,
-	0x2C9B,0x2CBB,0x2CDB,0x24BA,0x1C9A,0x1479,0x0B74,0x01AA,
-	0x00C5,0x00C7,0x014F,0x0157,0x0117,0x0956,0x11D5,0x1A53,
-	0x1AB2,0x22D3,0x22F3,0x2B34,0x6BD1,0xBC2B,0xD42B,0xECAC,
-	0xF50E,0xFD4E,0xFD6D,0xFD6C,0xF569,0xED07,0xE485,0xD3E3,
-	0xC362,0xB321,0xB2C1,0xB281,0xB262,0xBA62,0xC2A3,0xCAE4,
-	0xD304,0xDB24,0xE365,0xE3C5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCE3,0xF4C4,0xF4A4,0xF484,0xEC65,0xEC66,0xEC85,
-	0xEC85,0xEC85,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC47,0xDC27,0xDC48,0xDC8B,0xE4CC,
-	0x9121,0x9121,0x9121,0x9141,0x9141,0x8921,0x7901,0x68E1,
-	0x50A1,0x4080,0x90C2,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE8A2,0x70E2,0x48A1,0x58C1,
-	0x6901,0x8121,0x8941,0x8941,0x8121,0x7101,0x60E1,0x50E1,
-	0x48A1,0x48A1,0x40A0,0x40A0,0x40A1,0x8923,0xF8A2,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,
-	0xE861,0xD881,0xB8A2,0xA0C2,0x90C2,0x88C1,0x80C1,0x8903,
-	0x80C1,0x88C1,0x90C2,0xA8C2,0xB8C2,0xD882,0xF061,0xF841,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF8A3,0x99E4,0x61C2,0x69E2,0x7223,0x7A63,0x9305,0xAB85,
-	0xC427,0xD4A8,0xE509,0xED4B,0xE54B,0xCCEB,0xB44A,0x93A9,
-	0x7B08,0x9267,0xF0C3,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0xA1C6,0x6AC8,0x8349,0xA40C,
-	0xC4AD,0xDD0D,0xED0D,0xE4CB,0xE468,0xE446,0xE424,0xEC43,
-	0xE443,0xE404,0xE3E4,0xE3E4,0xDBC4,0xDBC4,0xCBA5,0x6C12,
-	0x2C9B,0x2CBB,0x24BB,0x24BA,0x1C99,0x1479,0x0B74,0x01AA,
-	0x00C5,0x00C7,0x014F,0x0177,0x0117,0x0956,0x11F5,0x1A53,
-	0x1AB3,0x22D3,0x3B32,0xAC6D,0xC48A,0xC44A,0xCC4B,0xECAC,
-	0xF50E,0xFD4F,0xFD6D,0xFD6C,0xF549,0xED07,0xE485,0xD3E3,
-	0xC382,0xBB22,0xB2C1,0xB281,0xB262,0xBA62,0xC2A3,0xCAE3,
-	0xD304,0xDB44,0xE385,0xE3A5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCE3,0xF4C4,0xF4A4,0xF484,0xEC66,0xEC66,0xEC85,
-	0xEC85,0xEC85,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC47,0xDC27,0xDC48,0xDC8B,0xE4CC,
-	0x9121,0x9121,0x9121,0x9141,0x9121,0x8121,0x70E1,0x58C1,
-	0x48A0,0x50A1,0xD0A2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF821,0xA103,0x40A0,0x50C0,0x68E1,
-	0x7921,0x8941,0x9161,0x9161,0x8941,0x7921,0x6901,0x60E1,
-	0x50C1,0x48C0,0x40A0,0x4080,0x7103,0xE8C2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF821,0xE882,0xB8C2,0x88C2,
-	0x68C1,0x50C1,0x48C1,0x40C1,0x40C1,0x40C1,0x40C0,0x40C1,
-	0x40C0,0x40C1,0x40C1,0x48E1,0x48C1,0x50E1,0x6902,0x88E2,
-	0xB8E2,0xE882,0xF821,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF0C3,0x81E4,0x61E2,0x7223,0x8284,0x9B24,0xB3C6,
-	0xCC67,0xE4E8,0xED2A,0xED4A,0xED6B,0xDD4B,0xC4CB,0xAC2A,
-	0x8B68,0x72C7,0xB1C5,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xD904,0x7A67,0x7B09,0x9BCB,
-	0xB44C,0xCCCD,0xE4EE,0xE4CC,0xE489,0xE447,0xE424,0xEC43,
-	0xEC43,0xE404,0xE3E4,0xE3E4,0xE3E4,0xDBC4,0xDBA4,0xD384,
-	0xABAA,0x4478,0x2CBB,0x24BA,0x1C79,0x1459,0x0B54,0x018A,
-	0x00C5,0x00E7,0x014F,0x0177,0x0138,0x0957,0x11F5,0x1A73,
-	0x1AB3,0x73D0,0xD4EC,0xD4EB,0xC48B,0xC44B,0xD44B,0xECAC,
-	0xF50E,0xFD4E,0xFD6D,0xFD6C,0xF569,0xED07,0xE485,0xD403,
-	0xC382,0xBB22,0xB2C1,0xB282,0xB282,0xBA83,0xC2A3,0xCAE3,
-	0xD304,0xDB24,0xE385,0xE3C5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCE3,0xF4C4,0xF4A4,0xF484,0xEC66,0xEC66,0xEC85,
-	0xEC85,0xEC85,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC47,0xDC27,0xDC48,0xDC8B,0xDCCC,
-	0x9121,0x9121,0x9121,0x9141,0x8921,0x7901,0x68E1,0x50C0,
-	0x4080,0x78E2,0xF861,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xD8A2,0x60E2,0x48A0,0x58E1,0x7101,
-	0x8121,0x8941,0x9161,0x9161,0x8941,0x8141,0x7921,0x60E1,
-	0x50C1,0x48A0,0x4080,0x60E2,0xE0C3,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0xD0A2,0x88E2,0x60E1,0x48C0,0x40A0,
-	0x40C1,0x40C0,0x40C1,0x40C1,0x40C1,0x48C1,0x48C0,0x48C0,
-	0x48E0,0x48E1,0x48C0,0x48E1,0x48E0,0x48E1,0x48E1,0x48E0,
-	0x5101,0x6922,0x9123,0xD0C2,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xE0E3,0x79E4,0x6A03,0x7A63,0x9B04,0xB3C6,
-	0xCC67,0xE4E8,0xED29,0xED4A,0xED6B,0xE58C,0xD52C,0xBC8B,
-	0x9BE9,0x7B28,0x82A7,0xE103,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF861,0x9226,0x6AC8,0x8B49,
-	0xA40B,0xC48C,0xDCCD,0xE4EC,0xE489,0xE467,0xE424,0xEC43,
-	0xEC43,0xE424,0xE3E4,0xE3E4,0xE3E4,0xDBC4,0xDBA4,0xD384,
-	0xD384,0xCB66,0x5C34,0x24BA,0x1C9A,0x1479,0x0B54,0x0189,
-	0x00C5,0x00E8,0x0170,0x0177,0x0138,0x0957,0x11F5,0x32D2,
-	0xBCCE,0xDD2D,0xDD2C,0xD4EB,0xC48B,0xC44B,0xD44B,0xECAC,
-	0xFD0E,0xFD4F,0xFD8E,0xFD6C,0xF54A,0xED07,0xE485,0xD403,
-	0xC382,0xBB01,0xB2C1,0xB282,0xB262,0xBA83,0xC2A3,0xCAE3,
-	0xD304,0xDB44,0xE385,0xE3A5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCC3,0xF4C4,0xF4A4,0xF484,0xEC65,0xEC66,0xEC85,
-	0xEC85,0xEC84,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC47,0xDC27,0xDC48,0xDC8B,0xDCCC,
-	0x9121,0x9121,0x9121,0x9121,0x8121,0x70E1,0x58C1,0x48A0,
-	0x48A1,0xB8C2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0x90E2,0x40A1,0x50C0,0x68E1,0x7921,
-	0x8941,0x9161,0x9161,0x9161,0x9161,0x8941,0x7921,0x60E1,
-	0x50C1,0x40A1,0x48C1,0xC0E3,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF841,0xD0E3,0x7903,0x48C1,0x40C0,0x48C0,0x48E0,0x48C0,
-	0x48C0,0x48C0,0x48C1,0x48C1,0x48E1,0x50E1,0x50E1,0x50E1,
-	0x50E0,0x50E1,0x50E1,0x5101,0x5101,0x5101,0x5101,0x5101,
-	0x5101,0x5121,0x5121,0x5942,0x8163,0xD103,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xC923,0x71E3,0x7243,0x8AC4,0xAB85,
-	0xC426,0xDCA8,0xE529,0xED4A,0xED6B,0xEDAC,0xE56C,0xCCEB,
-	0xAC4A,0x8B88,0x72E7,0xA9E5,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xC144,0x7287,0x7B09,
-	0x93AA,0xB44B,0xCCAC,0xE4CC,0xE489,0xE467,0xE444,0xEC42,
-	0xEC43,0xE424,0xE404,0xDBE4,0xE3C4,0xDBC4,0xDBA4,0xD384,
-	0xD384,0x8BEE,0x3499,0x24BA,0x1C9A,0x1459,0x0B33,0x0189,
-	0x00C5,0x00E8,0x0170,0x0177,0x0138,0x0977,0x11F6,0x1A74,
-	0x5B91,0xC4CD,0xDD2C,0xD4EB,0xC48B,0xC44B,0xCC4B,0xECAC,
-	0xFD2E,0xFD4F,0xFD8E,0xFD6C,0xFD4A,0xED07,0xE485,0xD403,
-	0xC382,0xBB02,0xB2C2,0xB282,0xB282,0xBA83,0xC2A3,0xCAE3,
-	0xD304,0xDB44,0xE385,0xE3C5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xF4C4,0xF4C3,0xF4C4,0xF4A4,0xF4A4,0xF485,0xEC66,0xEC85,
-	0xECA5,0xE4A4,0xE484,0xE484,0xE464,0xE464,0xDC44,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xDC47,0xDC48,0xDC8A,0xDCCC,
-	0x9121,0x9121,0x9121,0x8921,0x7901,0x68E1,0x58A0,0x4080,
-	0x60C2,0xE881,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xD082,0x50C2,0x48A0,0x60E1,0x7101,0x8141,
-	0x9141,0x9141,0x9161,0x9161,0x8941,0x8121,0x7101,0x60E1,
-	0x48A1,0x48C1,0xA103,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xD8C2,
-	0x7923,0x40C1,0x48C0,0x48C0,0x50E0,0x5101,0x50E1,0x5101,
-	0x50E1,0x50E1,0x50E1,0x50E1,0x50E1,0x50E1,0x50E1,0x50E1,
-	0x50E0,0x5900,0x5900,0x5901,0x5901,0x5921,0x6121,0x6141,
-	0x6141,0x6141,0x6141,0x5961,0x5962,0x5983,0x89A4,0xE103,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0xB184,0x6A23,0x7A63,0x9325,
-	0xB3E6,0xCC67,0xE4E9,0xED4A,0xED6B,0xEDAC,0xEDAC,0xD52C,
-	0xBCAB,0x9BEA,0x7B28,0x7AA7,0xD8E3,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF0A2,0x7A47,0x72C8,
-	0x8B49,0xA40B,0xC48C,0xDCAC,0xE4AA,0xE487,0xE424,0xEC23,
-	0xEC43,0xEC24,0xE404,0xE3E4,0xE3E4,0xDBC4,0xDBA4,0xC3A7,
-	0x5435,0x2CBB,0x24BA,0x24BA,0x1C99,0x1459,0x0B33,0x0169,
-	0x00A5,0x0108,0x0170,0x0178,0x0138,0x0977,0x11F6,0x1A74,
-	0x1AB3,0x2AF2,0x8C2F,0xD4EB,0xC48B,0xC44B,0xCC4B,0xECCC,
-	0xFD2E,0xFD6F,0xFD8E,0xFD8C,0xFD6A,0xED28,0xE4A5,0xD403,
-	0xC382,0xBB01,0xB2C1,0xB282,0xB262,0xBA83,0xCAA3,0xD2E3,
-	0xD304,0xDB44,0xE385,0xE3C5,0xE3E6,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4A4,0xF4A4,0xF465,0xEC66,0xEC85,
-	0xECA5,0xECA4,0xE4A4,0xE464,0xE463,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC25,0xDC26,0xDC27,0xDC47,0xDC48,0xDC8A,0xDCCC,
-	0x9121,0x9121,0x9121,0x8101,0x70E1,0x60C1,0x48A0,0x40A0,
-	0x98C2,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF841,0x9103,0x40A0,0x50C0,0x6901,0x7921,0x8941,
-	0x9161,0x9141,0x9161,0x9141,0x8941,0x7921,0x68E1,0x50C0,
-	0x40A1,0x7903,0xF8A2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF082,0xA8E3,0x48C1,
-	0x40C0,0x50C1,0x58E1,0x5901,0x6100,0x6101,0x6101,0x5901,
-	0x50E1,0x50E1,0x48E0,0x48C0,0x48C1,0x48E1,0x48E0,0x48E0,
-	0x50E0,0x50E0,0x48E0,0x5101,0x5101,0x5901,0x6121,0x6141,
-	0x6961,0x7181,0x7182,0x71A2,0x69A2,0x61A2,0x59A3,0x61E4,
-	0xB184,0xF082,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF8A2,0x91C4,0x6A23,0x82C4,
-	0xA365,0xBC26,0xD4A8,0xE52A,0xED6A,0xEDAB,0xEDAC,0xE58D,
-	0xCD0C,0xAC4A,0x8B89,0x72E8,0xAA06,0xF841,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xA9A5,0x6A88,
-	0x7B09,0x9BAA,0xBC4B,0xD48B,0xE4AA,0xE488,0xE444,0xEC43,
-	0xEC43,0xEC24,0xE404,0xE3E4,0xE3E4,0xDBC4,0x7C10,0x247B,
-	0x2C7B,0x2CBB,0x2CBB,0x24BA,0x1C9A,0x1459,0x0B33,0x0168,
+	0xC003,0xBDF4,0xA4F5,0x0005,0x3B75,0x3BB4,0x33D4,0x53D1,
+	0xDCCE,0xFD4E,0xC01C,0xABA3,0x5951,0x4203,0x0344,0x0BD5,
+	0xA4E5,0xECF5,0xF4EC,0xB5FC,0xADF3,0xF3B4,0xEC63,0xE55C,
+	0x9C5D,0xA500,0x8002,0xEC85,0x8002,0xE484,0xC00A,0x9463,
+	0x9C9D,0xADA5,0xAD5C,0xEDBF,0xAE00,0x8002,0x9121,0x8002,
+	0x9141,0x0006,0x8921,0x7901,0x68E1,0x50A0,0x4080,0xA0C2,
+	0xF821,0x800F,0xF800,0x0004,0xF862,0x9123,0x40A0,0x50C0,
+	0x6901,0xC005,0xE4EC,0x1C14,0x1BE4,0x0001,0x88E2,0x48C1,
+	0xC004,0x5BE4,0xA4A5,0x6300,0x0001,0x9944,0xF882,0x803C,
+	0xF800,0x0002,0xF882,0xA9C4,0x61C2,0x8002,0x6A02,0x000D,
+	0x6202,0x6A23,0x7264,0x82C4,0x9B66,0xBC27,0xCCA9,0xCCCA,
+	0xC48A,0xAC09,0x8B68,0x72E7,0xAA47,0xF882,0x800F,0xF800,
+	0x0007,0xF821,0xB1A5,0x72C8,0x8B6A,0xA42C,0xC4CE,0xDD2E,
+	0xED2E,0xC008,0x9351,0x929A,0xE2A3,0x9C5D,0x9C00,0x0002,
+	0xCBE7,0x5C14,0x243B,0xC007,0xACEC,0xACAC,0xA463,0x5C5B,
+	0x0009,0x0B75,0x01CB,0x29E9,0x5B2D,0x014E,0x0156,0x0117,
+	0x0956,0x11D4,0x1A53,0xC003,0xBCEC,0xACF5,0x0004,0x3B75,
+	0x43D4,0x9C0D,0xE4AC,0xFD0E,0xC01D,0xB4AB,0xA359,0x5242,
+	0x0203,0x4C4B,0x54DD,0xE5EC,0xF4F5,0xECF5,0xBCAC,0xF4F3,
+	0xB4EC,0x63A5,0x9C9C,0x9E64,0x8002,0xEC85,0xC00D,0x63A4,
+	0x9C9C,0x639C,0x9DAD,0xA5AD,0x9CAD,0xBFEE,0x0002,0x9141,
+	0x9121,0x9121,0x8002,0x9141,0x0005,0x8121,0x70E1,0x58C1,
+	0x48A0,0x60A1,0xE082,0x800F,0xF800,0x0009,0xF820,0xC103,
+	0x50E2,0x48A1,0x60E1,0x7101,0x8121,0x8121,0x7921,0x60E1,
+	0xC007,0x1C63,0x5D9B,0xACE5,0xA364,0x0001,0x9164,0xF8A2,
+	0x801A,0xF800,0xC008,0xACAD,0x9BAD,0xAC9C,0x9BAC,0x9C00,
+	0x801A,0xF800,0x0002,0xF8A2,0xA205,0x61C2,0xC003,0xECAC,
+	0xADEC,0x000C,0x82A4,0x9325,0xB3C6,0xCC68,0xDCE9,0xE52A,
+	0xCCEA,0xBC8A,0x9BE9,0x8327,0x72C7,0xD165,0xF820,0x800F,
+	0xF800,0x0006,0xE8C3,0x8267,0x7B09,0x93AB,0xB46D,0xD4EE,
+	0xE52E,0xC00A,0x9B89,0x929A,0x99EC,0x9C5C,0x9DA4,0x6400,
+	0x0001,0xA3EB,0x345A,0xC006,0x6DAC,0xACAC,0x5B5C,0x5B00,
+	0x0009,0x0B74,0x01AA,0x00C5,0x00C7,0x014F,0x0157,0x0117,
+	0x0956,0x11D5,0x1A53,0xC003,0xBBED,0xACF5,0x0003,0x6BD1,
+	0xBC2B,0xD42B,0xECAC,0xC006,0xFEF4,0xABA3,0x614A,0x4200,
+	0x0000,0xD3E3,0xC016,0x0313,0x8C94,0x9DE4,0xF5F5,0xECEC,
+	0xF5BC,0xADF4,0xF3B3,0xECAB,0x5D9C,0x9C5D,0xA500,0x8002,
+	0xEC85,0xC00D,0x63A4,0x9CA4,0x9C5C,0xA4A5,0xA5AD,0x9CAD,
+	0xB7F5,0x8002,0x9121,0xC004,0xACA4,0x5C1C,0x1C00,0x0003,
+	0x50A1,0x4080,0x90C2,0xF841,0x800F,0xF800,0x0005,0xE8A2,
+	0x70E2,0x48A1,0x58C1,0x6901,0x8121,0xC00A,0xECA4,0x5C1C,
+	0x1C24,0x54A4,0x63A4,0xA500,0x0001,0x8923,0xF8A2,0x8017,
+	0xF800,0x0004,0xF841,0xE861,0xD881,0xB8A2,0xA0C2,0xC006,
+	0x2463,0x64F6,0x52E4,0xE500,0x0005,0xA8C2,0xB8C2,0xD882,
+	0xF061,0xF841,0xF820,0x8016,0xF800,0x0012,0xF8A3,0x99E4,
+	0x61C2,0x69E2,0x7223,0x7A63,0x9305,0xAB85,0xC427,0xD4A8,
+	0xE509,0xED4B,0xE54B,0xCCEB,0xB44A,0x93A9,0x7B08,0x9267,
+	0xF0C3,0x800F,0xF800,0x0007,0xF841,0xA1C6,0x6AC8,0x8349,
+	0xA40C,0xC4AD,0xDD0D,0xED0D,0xC00B,0x5289,0x9A9A,0xEB64,
+	0x959C,0xA45C,0xA41D,0x0001,0x6C12,0x2C9B,0xC004,0xAC64,
+	0xA35B,0x5C00,0x0011,0x0B74,0x01AA,0x00C5,0x00C7,0x014F,
+	0x0177,0x0117,0x0956,0x11F5,0x1A53,0x1AB3,0x22D3,0x3B32,
+	0xAC6D,0xC48A,0xC44A,0xCC4B,0xECAC,0xC006,0xFEF5,0xAAA3,
+	0x5952,0x4200,0x0000,0xD3E3,0xC016,0x0B4C,0x4B94,0x9DE4,
+	0xF5F4,0xEDF4,0xF5AC,0xB5F4,0xF3B3,0xECAB,0x5D9C,0x9C5E,
+	0xA400,0x8002,0xEC85,0xC00D,0x63A4,0x9CA4,0x9C5C,0xA4A5,
+	0xA5AD,0x9CAD,0xB7F5,0x8002,0x9121,0xC003,0xAC9C,0x2414,
+	0x0003,0x58C1,0x48A0,0x50A1,0xD0A2,0x800F,0xF800,0x0006,
+	0xF821,0xA103,0x40A0,0x50C0,0x68E1,0x7921,0x8941,0xC009,
+	0xECA4,0x5C1C,0x1C5C,0x1C63,0x5C9C,0x0001,0x7103,0xE8C2,
+	0x8015,0xF800,0x0006,0xF821,0xE882,0xB8C2,0x88C2,0x68C1,
+	0x50C1,0x48C1,0x8002,0x40C1,0xC007,0xA3A5,0xA3A5,0xA4EC,
+	0x9CEC,0x0004,0x6902,0x88E2,0xB8E2,0xE882,0xF821,0x8015,
+	0xF800,0x0008,0xF0C3,0x81E4,0x61E2,0x7223,0x8284,0x9B24,
+	0xB3C6,0xCC67,0xE4E8,0xC003,0xF6AC,0xAD1C,0x0005,0xC4CB,
+	0xAC2A,0x8B68,0x72C7,0xB1C5,0xF820,0x800F,0xF800,0x0006,
+	0xD904,0x7A67,0x7B09,0x9BCB,0xB44C,0xCCCD,0xE4EE,0xC006,
+	0x9A91,0x9299,0xEBA4,0x5500,0x8002,0xE3E4,0x001A,0xDBC4,
+	0xDBA4,0xD384,0xABAA,0x4478,0x2CBB,0x24BA,0x1C79,0x1459,
+	0x0B54,0x018A,0x00C5,0x00E7,0x014F,0x0177,0x0138,0x0957,
+	0x11F5,0x1A73,0x1AB3,0x73D0,0xD4EC,0xD4EB,0xC48B,0xC44B,
+	0xD44B,0xECAC,0xC01E,0xFEF4,0xABA3,0x614A,0x4202,0x034C,
+	0x4B95,0xA4E5,0xECF4,0xEDEC,0xFDB4,0xADF4,0xF3B3,0xECAB,
+	0x5D9C,0x9C5E,0xA400,0x8002,0xEC85,0xC00D,0x63A4,0x9CA4,
+	0x9C5C,0xA4A5,0xA5AD,0x9CAD,0xB7B5,0x8002,0x9121,0xC003,
+	0xAC5C,0x1C1C,0x0003,0x50C0,0x4080,0x78E2,0xF861,0x800F,
+	0xF800,0x0005,0xD8A2,0x60E2,0x48A0,0x58E1,0x7101,0x8121,
+	0xC005,0xECEC,0xA45C,0x645C,0x0005,0x60E1,0x50C1,0x48A0,
+	0x4080,0x60E2,0xE0C3,0x8014,0xF800,0x0007,0xF841,0xD0A2,
+	0x88E2,0x60E1,0x48C0,0x40A0,0x40C1,0x40C0,0x8002,0x40C1,
+	0xC00B,0xE4A3,0xA4AC,0xA59B,0xADA3,0xA5A4,0xA3ED,0x0003,
+	0x6922,0x9123,0xD0C2,0xF841,0x8014,0xF800,0x0007,0xE0E3,
+	0x79E4,0x6A03,0x7A63,0x9B04,0xB3C6,0xCC67,0xE4E8,0xC004,
+	0xF5AD,0xAD6D,0x0C00,0x0004,0xBC8B,0x9BE9,0x7B28,0x82A7,
+	0xE103,0x800F,0xF800,0x0006,0xF861,0x9226,0x6AC8,0x8B49,
+	0xA40B,0xC48C,0xDCCD,0xC006,0xEB89,0x9A91,0xEBA4,0x5D00,
+	0x8002,0xE3E4,0xC004,0x5C9C,0x5CA4,0x5E00,0x000F,0x5C34,
+	0x24BA,0x1C9A,0x1479,0x0B54,0x0189,0x00C5,0x00E8,0x0170,
+	0x0177,0x0138,0x0957,0x11F5,0x32D2,0xBCCE,0xDD2D,0xC003,
+	0xA353,0x0C94,0x0002,0xD44B,0xECAC,0xFD0E,0xC02E,0xB5B3,
+	0x9A5A,0x5142,0x0203,0x4354,0x959C,0xEDEC,0xF4ED,0xF4F5,
+	0xACB5,0xF4F3,0xB3EC,0xA365,0x9C9C,0x5DA5,0xABA4,0xA364,
+	0xA49C,0xA49C,0x5CA4,0xA5A5,0xAD9C,0xADB7,0xB500,0x8003,
+	0x9121,0x0005,0x8121,0x70E1,0x58C1,0x48A0,0x48A1,0xB8C2,
+	0x800F,0xF800,0x0006,0xF841,0x90E2,0x40A1,0x50C0,0x68E1,
+	0x7921,0x8941,0x8003,0x9161,0x0007,0x8941,0x7921,0x60E1,
+	0x50C1,0x40A1,0x48C1,0xC0E3,0xF820,0x8012,0xF800,0x0006,
+	0xF841,0xD0E3,0x7903,0x48C1,0x40C0,0x48C0,0x48E0,0x8002,
+	0x48C0,0x0002,0x48C1,0x48C1,0x48E1,0x8002,0x50E1,0x0002,
+	0x50E0,0x50E1,0x50E1,0x8005,0x5101,0x0005,0x5121,0x5121,
+	0x5942,0x8163,0xD103,0xF841,0x8012,0xF800,0x0008,0xF820,
+	0xC923,0x71E3,0x7243,0x8AC4,0xAB85,0xC426,0xDCA8,0xE529,
+	0xC003,0xEDAD,0xB554,0x0005,0xCCEB,0xAC4A,0x8B88,0x72E7,
+	0xA9E5,0xF841,0x800E,0xF800,0x0007,0xF820,0xC144,0x7287,
+	0x7B09,0x93AA,0xB44B,0xCCAC,0xE4CC,0xC00C,0x919A,0x99E2,
+	0xA55D,0x9C5C,0xDC64,0x9C5C,0xA400,0x0011,0x8BEE,0x3499,
+	0x24BA,0x1C9A,0x1459,0x0B33,0x0189,0x00C5,0x00E8,0x0170,
+	0x0177,0x0138,0x0977,0x11F6,0x1A74,0x5B91,0xC4CD,0xDD2C,
+	0xC003,0x530C,0x94E4,0x0001,0xECAC,0xFD2E,0xC02E,0xADB3,
+	0x9A9A,0x1142,0x0203,0x4454,0x94A4,0xE5EC,0xF4ED,0xF4F5,
+	0xB4AD,0xF4F3,0xB3AC,0xA3A5,0x9CA4,0x9D5D,0xABAC,0x639C,
+	0xA49C,0xA45C,0x9CA4,0xA5A5,0xA5AC,0xA5B6,0xB600,0x8002,
+	0x9121,0xC003,0x641C,0x1C13,0x0002,0x4080,0x60C2,0xE881,
+	0x800F,0xF800,0x0006,0xD082,0x50C2,0x48A0,0x60E1,0x7101,
+	0x8141,0x9141,0xC006,0xA4AC,0xA45C,0x5C1C,0x1C00,0x0003,
+	0x48A1,0x48C1,0xA103,0xF841,0x8011,0xF800,0x0003,0xF820,
+	0xD8C2,0x7923,0x40C1,0xC005,0xE3A4,0xECAD,0x9CAC,0x8007,
+	0x50E1,0xC006,0xA3EC,0xA4A5,0xA4AC,0xE400,0x8003,0x6141,
+	0x0004,0x5961,0x5962,0x5983,0x89A4,0xE103,0x8012,0xF800,
+	0x0007,0xF841,0xB184,0x6A23,0x7A63,0x9325,0xB3E6,0xCC67,
+	0xE4E9,0xC003,0xFDAD,0xB5A4,0x0005,0xD52C,0xBCAB,0x9BEA,
+	0x7B28,0x7AA7,0xD8E3,0x800F,0xF800,0x0006,0xF0A2,0x7A47,
+	0x72C8,0x8B49,0xA40B,0xC48C,0xDCAC,0xC00A,0xE299,0x89E3,
+	0xAC9D,0x5C9C,0xA45C,0x9C00,0x0002,0xC3A7,0x5435,0x2CBB,
+	0xC003,0x63A4,0x5B54,0x0012,0x0B33,0x0169,0x00A5,0x0108,
+	0x0170,0x0178,0x0138,0x0977,0x11F6,0x1A74,0x1AB3,0x2AF2,
+	0x8C2F,0xD4EB,0xC48B,0xC44B,0xCC4B,0xECCC,0xFD2E,0xC005,
+	0xB5AB,0xA29A,0x1241,0x0000,0xD403,0xC005,0x0343,0x5495,
+	0x9CED,0x0000,0xCAA3,0xC008,0xF4AD,0xF4F5,0xB4AD,0xF4F3,
+	0xB300,0x8002,0xFCC4,0xC014,0x5CA4,0x9565,0xABAC,0xA364,
+	0x94A3,0xA59C,0x5CA4,0xA5A5,0xA5AC,0xA5B6,0xB600,0x8002,
+	0x9121,0x0006,0x8101,0x70E1,0x60C1,0x48A0,0x40A0,0x98C2,
+	0xF841,0x800E,0xF800,0x0006,0xF841,0x9103,0x40A0,0x50C0,
+	0x6901,0x7921,0x8941,0xC006,0xEC9C,0xAC9C,0x641C,0x1400,
+	0x0003,0x50C0,0x40A1,0x7903,0xF8A2,0x8011,0xF800,0x0004,
+	0xF082,0xA8E3,0x48C1,0x40C0,0x50C1,0xC01D,0xECAC,0xE3A5,
+	0xA464,0x5CA4,0x639C,0xA5AC,0xA3A4,0xE4A4,0x64ED,0xA4E4,
+	0xECAC,0xECEC,0xA5AC,0x6464,0x65F5,0x0001,0xB184,0xF082,
+	0x8011,0xF800,0x0007,0xF8A2,0x91C4,0x6A23,0x82C4,0xA365,
+	0xBC26,0xD4A8,0xE52A,0xC003,0xF4B5,0xA55D,0x0005,0xCD0C,
+	0xAC4A,0x8B89,0x72E8,0xAA06,0xF841,0x800E,0xF800,0x0007,
+	0xF841,0xA9A5,0x6A88,0x7B09,0x9BAA,0xBC4B,0xD48B,0xE4AA,
+	0xC008,0x9A90,0xE3A4,0x9D5C,0x9CA4,0x5C00,0x0001,0x7C10,
+	0x247B,0xC005,0xE4B4,0xA463,0x5C53,0x0012,0x0B33,0x0168,
 	0x00A5,0x0108,0x0191,0x0178,0x0138,0x0978,0x11F6,0x1A74,
 	0x1AB3,0x22B2,0x22D3,0x5392,0xB46C,0xC44B,0xD44B,0xECCC,
-	0xFD2E,0xFD4F,0xFD8E,0xFD8C,0xFD6A,0xED27,0xDCA5,0xD403,
-	0xC382,0xBB02,0xB2C2,0xB2A2,0xBA82,0xC283,0xCAA3,0xD2E3,
-	0xD303,0xDB44,0xE385,0xE3C5,0xE406,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A4,0xF485,0xEC86,0xEC85,
-	0xECA5,0xECA4,0xE4A4,0xE484,0xE464,0xE464,0xDC44,0xDC24,
-	0xDC24,0xDC05,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCCC,
-	0x9121,0x9121,0x9121,0x8101,0x68E1,0x58C0,0x4080,0x48A1,
-	0xC8C2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xD882,0x50E2,0x48A0,0x58E1,0x7101,0x8121,0x9141,
-	0x9141,0x9161,0x9161,0x8941,0x8121,0x70E1,0x58C1,0x48A1,
-	0x50C1,0xD0C3,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF820,0xE0C2,0x7923,0x48C0,0x50E0,
-	0x50E1,0x5901,0x6101,0x6901,0x6121,0x6101,0x5901,0x5101,
-	0x50E1,0x48C0,0x40C0,0x40C0,0x40C0,0x40C0,0x40C0,0x40C1,
-	0x48C1,0x48C0,0x48C0,0x48E1,0x48E1,0x5101,0x5901,0x6121,
-	0x6961,0x7181,0x79A1,0x79C2,0x79C2,0x71E3,0x7204,0x6A04,
-	0x6225,0x8A26,0xE0E3,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xD903,0x71E3,0x7263,
-	0x8B04,0xABA6,0xC467,0xDCE9,0xED4A,0xED8C,0xEDAC,0xEDAD,
-	0xD52C,0xBCAC,0x9BEA,0x7B48,0x7AC8,0xE0E3,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xD124,0x6A67,
-	0x72C8,0x8B4A,0xB40B,0xCC6B,0xE4AA,0xE488,0xEC24,0xEC43,
-	0xEC43,0xEC24,0xE404,0xE3E4,0xBBE8,0x4417,0x245B,0x247B,
-	0x2C9B,0x2C9B,0x2CBB,0x249A,0x1C9A,0x1459,0x0B12,0x0168,
+	0xFD2E,0xC005,0xADB3,0xA29A,0x1102,0x0000,0xD403,0xC00F,
+	0x0344,0x549C,0xDCE5,0xECF4,0xACF5,0xF5B4,0xB5EC,0xF3B3,
+	0x8002,0xFCC4,0xC014,0x649C,0x9D65,0xA3AC,0xA364,0x9C9C,
+	0xA45C,0x9CA4,0x9DAD,0xA5A4,0xADB6,0xB600,0x8002,0x9121,
+	0x0005,0x8101,0x68E1,0x58C0,0x4080,0x48A1,0xC8C2,0x800F,
+	0xF800,0x0006,0xD882,0x50E2,0x48A0,0x58E1,0x7101,0x8121,
+	0x9141,0xC005,0xA4AC,0xA45C,0x5C14,0x0003,0x58C1,0x48A1,
+	0x50C1,0xD0C3,0x8010,0xF800,0x0003,0xF820,0xE0C2,0x7923,
+	0x48C0,0xC00A,0xECA5,0xECE4,0xE46C,0x9C64,0x649C,0x5B00,
+	0x8004,0x40C0,0xC011,0xA5E4,0xA3A4,0xADA4,0xECE4,0xECF4,
+	0xECEC,0xADA4,0x6DAD,0x646D,0x0002,0x8A26,0xE0E3,0xF820,
+	0x8010,0xF800,0x0010,0xD903,0x71E3,0x7263,0x8B04,0xABA6,
+	0xC467,0xDCE9,0xED4A,0xED8C,0xEDAC,0xEDAD,0xD52C,0xBCAC,
+	0x9BEA,0x7B48,0x7AC8,0xE0E3,0x800E,0xF800,0x0007,0xF820,
+	0xD124,0x6A67,0x72C8,0x8B4A,0xB40B,0xCC6B,0xE4AA,0xC006,
+	0x9AC8,0xABA4,0x9D5C,0x9C00,0x0002,0xBBE8,0x4417,0x245B,
+	0xC006,0xACEC,0xA4AC,0x5B64,0x5300,0x0009,0x0B12,0x0168,
 	0x00A5,0x0109,0x0192,0x0177,0x0938,0x0958,0x11F7,0x1A74,
-	0x1AB3,0x1AD2,0x22D3,0x2B14,0x3B54,0x83EF,0xD46B,0xECCD,
-	0xFD2E,0xFD6F,0xFD8E,0xFD8D,0xF56A,0xED28,0xDC86,0xD424,
-	0xC382,0xBB02,0xB2C1,0xB281,0xBA82,0xC283,0xCAC3,0xD2E3,
-	0xD304,0xDB44,0xE385,0xE3C5,0xE406,0xEC26,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4A3,0xF4A4,0xEC85,0xEC86,0xECA5,
-	0xECA5,0xECA4,0xE4A4,0xE484,0xE464,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC05,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCAC,
-	0x9121,0x9121,0x8921,0x7901,0x68E1,0x50A0,0x4080,0x68E2,
-	0xF082,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xA8E3,0x40A0,0x50C0,0x68E1,0x7921,0x8941,0x9161,
-	0x9161,0x9161,0x9141,0x8141,0x7901,0x60E1,0x50C0,0x40A1,
-	0x90E2,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xD0E3,0x6102,0x48C0,0x50E1,0x6101,
-	0x6901,0x6921,0x6921,0x6921,0x6101,0x5901,0x50E1,0x48E0,
-	0x48C1,0x48C1,0x50C1,0x58E1,0x68E2,0x78C2,0x8102,0x8903,
-	0x8102,0x78E1,0x68E2,0x60E1,0x50E1,0x48E1,0x48E1,0x5101,
-	0x6141,0x6961,0x7181,0x81C2,0x81E2,0x8203,0x8244,0x7A65,
-	0x7265,0x6A66,0x7A47,0xD944,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xA183,0x6203,
-	0x7A84,0x9B45,0xB406,0xD4A8,0xE52A,0xED8B,0xEDAC,0xEDCD,
-	0xE58D,0xCD2C,0xAC6B,0x8B89,0x7308,0xB9A5,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF0A2,0x8226,
-	0x6AA7,0x8329,0xA3CA,0xC44B,0xDC8A,0xE4A8,0xE445,0xEC43,
-	0xEC43,0xEC24,0xD405,0x73F1,0x1C1B,0x243B,0x245B,0x247B,
-	0x2C7B,0x2C9B,0x24BB,0x249A,0x1C99,0x1459,0x0B12,0x11A9,
-	0xAD33,0xDE34,0x42D1,0x0178,0x0138,0x0978,0x11F7,0x1A74,
-	0x1AB3,0x22B2,0x22D3,0x2B14,0x3B54,0x3B94,0x4BB2,0xC46E,
-	0xF52F,0xFD6F,0xFD8E,0xFD8D,0xF58B,0xED28,0xE4A6,0xD424,
-	0xC382,0xBB02,0xB2C2,0xB281,0xBA82,0xC283,0xCAC3,0xD2E3,
-	0xD324,0xDB64,0xE3A5,0xE3C5,0xE406,0xEC46,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4A3,0xF4A4,0xEC85,0xEC86,0xECA5,
-	0xECA5,0xECA4,0xE4A4,0xE484,0xE464,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC05,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCAC,
-	0x9121,0x9121,0x8101,0x70E1,0x60C1,0x48A1,0x4081,0x90C2,
-	0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xE861,0x6902,0x48A1,0x58C1,0x7101,0x8121,0x9141,0x9161,
-	0x9161,0x9161,0x8941,0x7921,0x68E1,0x58C1,0x48A0,0x58A1,
-	0xE8A2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF841,0xC904,0x58E2,0x48C1,0x58E1,0x6101,0x6921,
-	0x7121,0x6921,0x6921,0x6101,0x58E1,0x50E1,0x48C1,0x58E1,
-	0x7102,0xA0C2,0xC082,0xE082,0xF061,0xF821,0xF861,0xF861,
-	0xF841,0xF821,0xF061,0xE082,0xC8A2,0xA0E2,0x7902,0x6102,
-	0x5101,0x5921,0x6141,0x7181,0x81C2,0x8A03,0x8A64,0x8AA5,
-	0x8AC6,0x7AC6,0x7287,0x7288,0xD185,0xF841,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C2,0x71C3,
-	0x6A43,0x8AE4,0xA3A6,0xC467,0xDD09,0xED8B,0xEDAC,0xEDCC,
-	0xEDCD,0xD56D,0xBCAC,0x9BEA,0x7B28,0x82A7,0xE8A2,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xA1C5,
-	0x6287,0x7AE8,0x9BAA,0xBC2A,0xCC6A,0xE4A9,0xE445,0xEC23,
-	0xEC43,0xB40A,0x33F8,0x1C1B,0x1C1B,0x1C3B,0x243B,0x245B,
-	0x247B,0x2C9B,0x24BB,0x249A,0x1C99,0x1438,0x5391,0xEE56,
-	0xFF3A,0xFEF6,0xFE4D,0xACED,0x1198,0x0978,0x1217,0x1A95,
-	0x1AB3,0x1AD2,0x22B2,0x2B13,0x3354,0x3B94,0x2B94,0x1332,
-	0x73CF,0xED4F,0xFD8E,0xFD8D,0xF58B,0xF528,0xE4A6,0xD424,
-	0xC383,0xBB22,0xB2C2,0xB2A2,0xBA82,0xC2A3,0xCAC3,0xD2E4,
-	0xD324,0xDB64,0xE3A5,0xE3C5,0xEC06,0xEC46,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A4,0xEC85,0xEC86,0xECA5,
-	0xECA5,0xE4A4,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC05,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCAC,
-	0x9141,0x9141,0x8121,0x68E1,0x58C0,0x40A0,0x40A1,0xB8C2,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xC8C3,0x40A1,0x50A0,0x68E1,0x7921,0x8941,0x9161,0x9161,
-	0x9161,0x9141,0x8121,0x7101,0x60E1,0x48A1,0x40A1,0xA103,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xC8E3,0x5102,0x48C1,0x58E1,0x6901,0x7121,0x7121,
-	0x6921,0x6101,0x5901,0x50E1,0x48C0,0x60E1,0x98E2,0xD0C2,
-	0xF881,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xF881,0xD0E2,
-	0x9902,0x6921,0x5121,0x6141,0x7182,0x81E2,0x8A43,0x92A5,
-	0x9AE6,0x9327,0x8308,0x72C8,0x72CA,0xD185,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xB183,
-	0x6203,0x7284,0x9325,0xB407,0xCCA8,0xED6A,0xEDAC,0xEDCC,
-	0xEDED,0xE5AD,0xCD0C,0xAC6B,0x8389,0x6AC8,0xD144,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xC944,
-	0x6247,0x72C8,0x9369,0xB40A,0xCC6A,0xE4A9,0xEC65,0xDC25,
-	0x63F3,0x1BDB,0x1BFB,0x1C1B,0x243B,0x241B,0x243B,0x245B,
-	0x2C9B,0x249B,0x249B,0x249A,0x3477,0xB3EB,0xF52E,0xFED7,
-	0xFF3A,0xFED6,0xFE4C,0xFE87,0xEE68,0x5313,0x1218,0x1A95,
-	0x1AD3,0x1AB2,0x22B2,0x2B13,0x3354,0x3B94,0x2B93,0x1332,
-	0x02D0,0x840F,0xFD8E,0xFDAD,0xF58B,0xED28,0xE4A6,0xD424,
-	0xC3A3,0xBB22,0xB2E2,0xB282,0xBA83,0xC283,0xCAC3,0xD304,
-	0xD324,0xDB64,0xE3A5,0xE3C5,0xEC06,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A4,0xF486,0xEC86,0xECA5,
-	0xECA5,0xE4A4,0xE484,0xE484,0xE464,0xE464,0xE444,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCAC,
-	0x9141,0x8921,0x7901,0x68E1,0x50C0,0x40A0,0x58C1,0xE082,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF041,
-	0x88E2,0x40A0,0x58C1,0x6901,0x8121,0x9162,0x9161,0x9161,
-	0x9161,0x8941,0x7921,0x68E1,0x50C1,0x40A0,0x58E2,0xF0A2,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xD0C3,0x5102,0x50C0,0x5901,0x6901,0x7121,0x7121,0x6921,
-	0x6101,0x58E1,0x48C0,0x50E2,0x98E2,0xE0C2,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF841,0xE8C2,0x9902,0x6142,0x6141,0x6982,0x79E3,0x8A64,
-	0x9AE6,0x9B28,0x9349,0x8349,0x72E9,0x7AEA,0xD945,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF0C2,
-	0x7204,0x6A43,0x8AE4,0xA3A6,0xC488,0xDD2A,0xEDAC,0xEDAC,
-	0xEDCD,0xEDCE,0xD54D,0xB4AC,0x93CA,0x7308,0xA226,0xF041,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C2,
-	0x7A47,0x72C8,0x8B49,0xABEA,0xC44A,0xE489,0xE466,0x23DA,
-	0x13BC,0x13DB,0x1BFB,0x1C1B,0x241B,0x241B,0x243B,0x245B,
-	0x247B,0x2C9B,0x2CBB,0x7411,0xDB87,0xE3C7,0xF52E,0xFED7,
-	0xFF5A,0xFED5,0xFE2C,0xFE88,0xFEC7,0xF666,0xB4EC,0x32F4,
-	0x1AD3,0x1AD3,0x22D3,0x2B14,0x3354,0x3B94,0x2B94,0x1332,
-	0x02D1,0x7BEF,0xFDAE,0xFDAD,0xF58B,0xED29,0xE4C6,0xD444,
-	0xC3A3,0xBB22,0xB2C1,0xB2A2,0xBA83,0xC2A3,0xCAC3,0xD304,
-	0xD324,0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCE4,0xF4C4,0xF4A4,0xF485,0xEC86,0xECA5,
-	0xECA5,0xECA4,0xE484,0xE484,0xE484,0xE464,0xE444,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDC8A,0xDCAC,
-	0x9141,0x8921,0x7901,0x60C1,0x50A0,0x4080,0x70A1,0xF841,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE082,
-	0x58C2,0x48A1,0x60E1,0x7101,0x8141,0x9161,0x9161,0x9161,
-	0x9161,0x8141,0x7101,0x60E1,0x48A1,0x4080,0xA0E3,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8A2,
-	0x6103,0x48C1,0x58E1,0x6901,0x7121,0x7121,0x6901,0x6101,
-	0x50E1,0x48C1,0x7102,0xC8E3,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0xD0E3,0x7963,0x5941,0x6982,0x7A03,
-	0x8AA5,0x9B27,0xA389,0x9389,0x8B4A,0x732B,0x8B0B,0xE8E3,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xB184,0x6223,0x7AA4,0x9B45,0xBC27,0xD4E9,0xED8B,0xEDAC,
-	0xF5CC,0xEDCD,0xDD6D,0xC4ED,0x9C2B,0x7B49,0x7AA8,0xE8C2,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,
-	0x89E6,0x6A87,0x8329,0xA3A9,0xC42A,0xDC69,0xE466,0x1BBC,
-	0x13BC,0x13BB,0x1BFB,0x1C1B,0x241B,0x241B,0x243B,0x245B,
-	0x2C7B,0x4C57,0xABAA,0xDB65,0xE365,0xE3C7,0xF54F,0xFED8,
-	0xFF3A,0xFED4,0xFE4C,0xFE88,0xFEC6,0xF686,0xEDE7,0xD52A,
-	0x73F0,0x1AD3,0x22D3,0x2B13,0x3354,0x3B94,0x2B94,0x1332,
-	0x02D0,0x7BEF,0xFDAE,0xFDAD,0xF58B,0xED28,0xE4C6,0xD445,
-	0xC383,0xBB22,0xB2C2,0xB2A2,0xBA83,0xC2A3,0xCAC3,0xD304,
-	0xDB24,0xDB65,0xE3A5,0xE3E6,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xF4C4,0xF4A4,0xF485,0xECA6,0xECA5,
-	0xECA5,0xECA4,0xE484,0xE484,0xE484,0xE464,0xE444,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDC6A,0xDCAC,
-	0x9141,0x8121,0x7101,0x60C1,0x48A0,0x4081,0x98A2,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xC0C2,
-	0x4080,0x50C1,0x60E1,0x7921,0x8941,0x9161,0x9161,0x9161,
-	0x9161,0x8141,0x6901,0x58C1,0x40A0,0x48C1,0xE082,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF061,0x8923,
-	0x48A1,0x58E1,0x6101,0x7121,0x7121,0x6901,0x60E1,0x50C0,
-	0x48C1,0x9103,0xF0A2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF0A2,0xA143,0x5962,0x69A3,
-	0x7A24,0x92E6,0x9B68,0xA3A9,0x93AB,0x836C,0x734C,0x9A8A,
-	0xF861,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xE0C2,0x6A03,0x6A63,0x8B05,0xABE7,0xCCA9,0xED6B,0xEDAC,
-	0xF5CC,0xEDED,0xE58E,0xCD2D,0xAC6B,0x8389,0x6AC8,0xC964,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xA985,0x6A67,0x7AE8,0x9B89,0xBC0A,0xD469,0xE486,0x13BB,
-	0x13BC,0x13BB,0x1BFB,0x1C1B,0x241B,0x241B,0x243B,0x245B,
+	0xC003,0xB3AB,0xE5F5,0x0004,0x3B54,0x83EF,0xD46B,0xECCD,
+	0xFD2E,0xC004,0xB5AB,0xA359,0x5200,0x0002,0xDC86,0xD424,
+	0xC382,0xC00E,0x4453,0x94E5,0xE5F4,0xECAD,0xF4F5,0xB4B5,
+	0xECF3,0xB300,0x8002,0xFCC4,0xC014,0x5BA5,0x5DA5,0xABA4,
+	0xA364,0x9C9C,0xA49B,0x5CA5,0x9DAD,0xA5A4,0xADB6,0xAE00,
+	0x0000,0x9121,0xC003,0xA464,0x1C1C,0x0003,0x50A0,0x4080,
+	0x68E2,0xF082,0x800E,0xF800,0x0006,0xF820,0xA8E3,0x40A0,
+	0x50C0,0x68E1,0x7921,0x8941,0x8002,0x9161,0x0007,0x9141,
+	0x8141,0x7901,0x60E1,0x50C0,0x40A1,0x90E2,0xF841,0x800F,
+	0xF800,0x0006,0xF820,0xD0E3,0x6102,0x48C0,0x50E1,0x6101,
+	0x6901,0x8002,0x6921,0xC007,0x5C64,0x5C63,0x9DA4,0xE4EC,
+	0x0001,0x68E2,0x78C2,0xC009,0xF4E5,0x635B,0x2563,0x2464,
+	0xA4EC,0x0003,0x6141,0x6961,0x7181,0x81C2,0xC005,0xACAD,
+	0xB56D,0x6465,0x0002,0x7A47,0xD944,0xF820,0x800F,0xF800,
+	0x0007,0xF841,0xA183,0x6203,0x7A84,0x9B45,0xB406,0xD4A8,
+	0xE52A,0xC003,0xFDAD,0xAD54,0x0005,0xCD2C,0xAC6B,0x8B89,
+	0x7308,0xB9A5,0xF820,0x800E,0xF800,0x0006,0xF0A2,0x8226,
+	0x6AA7,0x8329,0xA3CA,0xC44B,0xDC8A,0xC004,0xEA89,0xE2A4,
+	0x9D00,0x0002,0xD405,0x73F1,0x1C1B,0xC008,0xECAC,0xACE4,
+	0xAC6C,0x9B63,0x5400,0x0009,0x0B12,0x11A9,0xAD33,0xDE34,
+	0x42D1,0x0178,0x0138,0x0978,0x11F7,0x1A74,0xC003,0xB3E3,
+	0xADF5,0x0004,0x3B54,0x3B94,0x4BB2,0xC46E,0xF52F,0xC006,
+	0xF4AB,0xA362,0x4942,0x0200,0x0000,0xC382,0xC00E,0x4454,
+	0x93E5,0xE5F4,0xECB5,0xF4F5,0xACB5,0xF4EB,0xB300,0x8002,
+	0xFCC4,0xC014,0x5BA5,0x5DA5,0xABA4,0xA364,0x9C9C,0xA49B,
+	0x5CA5,0x9DAD,0xA5A4,0xADB6,0xAE00,0x0000,0x9121,0xC003,
+	0xA41C,0x1C1C,0x0003,0x48A1,0x4081,0x90C2,0xF841,0x800E,
+	0xF800,0x0006,0xE861,0x6902,0x48A1,0x58C1,0x7101,0x8121,
+	0x9141,0x8002,0x9161,0xC004,0x5C1C,0x141C,0x1B00,0x0001,
+	0x58A1,0xE8A2,0x800F,0xF800,0x0004,0xF841,0xC904,0x58E2,
+	0x48C1,0x58E1,0xC008,0xECEC,0xE464,0xA45C,0x5C64,0x5C00,
+	0x0005,0x58E1,0x7102,0xA0C2,0xC082,0xE082,0xF061,0xC006,
+	0xD4B4,0xA49C,0x9C74,0x2D00,0x0008,0xC8A2,0xA0E2,0x7902,
+	0x6102,0x5101,0x5921,0x6141,0x7181,0x81C2,0xC006,0xF5BD,
+	0xB5AD,0x2455,0xA500,0x0001,0xD185,0xF841,0x800F,0xF800,
+	0x0010,0xE8C2,0x71C3,0x6A43,0x8AE4,0xA3A6,0xC467,0xDD09,
+	0xED8B,0xEDAC,0xEDCC,0xEDCD,0xD56D,0xBCAC,0x9BEA,0x7B28,
+	0x82A7,0xE8A2,0x800E,0xF800,0x000D,0xF841,0xA1C5,0x6287,
+	0x7AE8,0x9BAA,0xBC2A,0xCC6A,0xE4A9,0xE445,0xEC23,0xEC43,
+	0xB40A,0x33F8,0x1C1B,0xC009,0xA4AC,0xE4AC,0xACEC,0x6C9B,
+	0x634B,0x0009,0x5391,0xEE56,0xFF3A,0xFEF6,0xFE4D,0xACED,
+	0x1198,0x0978,0x1217,0x1A95,0xC006,0xAAAB,0xDCFD,0xF5F4,
+	0x2400,0x0003,0x1332,0x73CF,0xED4F,0xFD8E,0xC004,0xA362,
+	0x8902,0x0200,0x0000,0xC383,0xC00E,0x4B4C,0x9CDC,0xEDEC,
+	0xEDB4,0xF4F5,0xACF5,0xB4EB,0xB300,0x8002,0xFCC4,0xC014,
+	0x649C,0x5DA5,0xABA4,0x639C,0xA49C,0xA49C,0x5BA5,0x9DAD,
+	0xA5A4,0xADB6,0xAE00,0x0007,0x9141,0x9141,0x8121,0x68E1,
+	0x58C0,0x40A0,0x40A1,0xB8C2,0x800E,0xF800,0x0006,0xF820,
+	0xC8C3,0x40A1,0x50A0,0x68E1,0x7921,0x8941,0x8002,0x9161,
+	0xC003,0x9C1C,0x1C1C,0x0003,0x48A1,0x40A1,0xA103,0xF820,
+	0x800E,0xF800,0x0005,0xF820,0xC8E3,0x5102,0x48C1,0x58E1,
+	0x6901,0xC006,0xECA4,0x645C,0x645C,0x5B00,0x0004,0x60E1,
+	0x98E2,0xD0C2,0xF881,0xF820,0x800A,0xF800,0x0008,0xF820,
+	0xF881,0xD0E2,0x9902,0x6921,0x5121,0x6141,0x7182,0x81E2,
+	0xC006,0xFDFE,0xF575,0x1D14,0xA600,0x0001,0xD185,0xF820,
+	0x800E,0xF800,0x0007,0xF820,0xB183,0x6203,0x7284,0x9325,
+	0xB407,0xCCA8,0xED6A,0xC003,0xB6AC,0xAD54,0x0005,0xCD0C,
+	0xAC6B,0x8389,0x6AC8,0xD144,0xF820,0x800E,0xF800,0x000A,
+	0xC944,0x6247,0x72C8,0x9369,0xB40A,0xCC6A,0xE4A9,0xEC65,
+	0xDC25,0x63F3,0x1BDB,0xC009,0xACAC,0xEC9C,0xACAC,0xF464,
+	0xA4A3,0x000B,0x3477,0xB3EB,0xF52E,0xFED7,0xFF3A,0xFED6,
+	0xFE4C,0xFE87,0xEE68,0x5313,0x1218,0x1A95,0xC006,0xB29B,
+	0xE4FD,0xF5F4,0x2300,0x0003,0x1332,0x02D0,0x840F,0xFD8E,
+	0xC014,0xAB5A,0x4942,0x0203,0x4354,0x8CE5,0xE4F4,0xF5AC,
+	0xF4F5,0xACF5,0xB5F2,0xAB00,0x8002,0xFCC4,0xC014,0x649C,
+	0x9E64,0xABA4,0x639C,0xA49C,0xA49C,0x5B9D,0xADA5,0xA5A4,
+	0xADB6,0xAE00,0x0007,0x9141,0x8921,0x7901,0x68E1,0x50C0,
+	0x40A0,0x58C1,0xE082,0x800E,0xF800,0x0006,0xF041,0x88E2,
+	0x40A0,0x58C1,0x6901,0x8121,0x9162,0x8002,0x9161,0x0006,
+	0x8941,0x7921,0x68E1,0x50C1,0x40A0,0x58E2,0xF0A2,0x800F,
+	0xF800,0x0004,0xD0C3,0x5102,0x50C0,0x5901,0x6901,0xC006,
+	0xECA4,0x645C,0x5C1B,0xEE00,0x0002,0x98E2,0xE0C2,0xF841,
+	0x8010,0xF800,0x0008,0xF841,0xE8C2,0x9902,0x6142,0x6141,
+	0x6982,0x79E3,0x8A64,0x9AE6,0xC004,0xB66D,0x240C,0xE500,
+	0x0000,0xD945,0x800F,0xF800,0x0010,0xF0C2,0x7204,0x6A43,
+	0x8AE4,0xA3A6,0xC488,0xDD2A,0xEDAC,0xEDAC,0xEDCD,0xEDCE,
+	0xD54D,0xB4AC,0x93CA,0x7308,0xA226,0xF041,0x800E,0xF800,
+	0x0008,0xE8C2,0x7A47,0x72C8,0x8B49,0xABEA,0xC44A,0xE489,
+	0xE466,0x23DA,0xC00A,0x1EAB,0xECAC,0xE4A4,0xACAC,0xACEC,
+	0xAC00,0x000D,0x7411,0xDB87,0xE3C7,0xF52E,0xFED7,0xFF5A,
+	0xFED5,0xFE2C,0xFE88,0xFEC7,0xF666,0xB4EC,0x32F4,0x1AD3,
+	0xC005,0xA4E4,0xF5F4,0xF424,0x0003,0x1332,0x02D1,0x7BEF,
+	0xFDAE,0xC004,0xA35A,0x4A49,0x0200,0x0000,0xC3A3,0xC018,
+	0x434B,0x9DDD,0xECEC,0xF5AC,0xF4F5,0xB4F5,0xADF2,0xABEC,
+	0xACA4,0x5C9C,0x9D65,0xABA4,0xA300,0x8002,0xE484,0xC00A,
+	0x9C9C,0x5B9D,0xADA5,0xA5A4,0xADB6,0xAE00,0x0007,0x9141,
+	0x8921,0x7901,0x60C1,0x50A0,0x4080,0x70A1,0xF841,0x800E,
+	0xF800,0x0005,0xE082,0x58C2,0x48A1,0x60E1,0x7101,0x8141,
+	0x8003,0x9161,0x0006,0x8141,0x7101,0x60E1,0x48A1,0x4080,
+	0xA0E3,0xF820,0x800E,0xF800,0x0004,0xE8A2,0x6103,0x48C1,
+	0x58E1,0x6901,0xC005,0xECA4,0x5C64,0x1C5C,0x0002,0x7102,
+	0xC8E3,0xF841,0x8014,0xF800,0x000D,0xF841,0xD0E3,0x7963,
+	0x5941,0x6982,0x7A03,0x8AA5,0x9B27,0xA389,0x9389,0x8B4A,
+	0x732B,0x8B0B,0xE8E3,0x800E,0xF800,0x0007,0xF820,0xB184,
+	0x6223,0x7AA4,0x9B45,0xBC27,0xD4E9,0xED8B,0xC003,0xADEC,
+	0x650C,0x0004,0xC4ED,0x9C2B,0x7B49,0x7AA8,0xE8C2,0x800E,
+	0xF800,0x0008,0xF841,0x89E6,0x6A87,0x8329,0xA3A9,0xC42A,
+	0xDC69,0xE466,0x1BBC,0xC008,0x64A3,0xF4AC,0xE4A4,0xACAC,
+	0xEC00,0x0010,0x4C57,0xABAA,0xDB65,0xE365,0xE3C7,0xF54F,
+	0xFED8,0xFF3A,0xFED4,0xFE4C,0xFE88,0xFEC6,0xF686,0xEDE7,
+	0xD52A,0x73F0,0x1AD3,0xC004,0xE4F4,0xF5F4,0x2400,0x0003,
+	0x1332,0x02D0,0x7BEF,0xFDAE,0xC004,0xA35A,0x494A,0x0300,
+	0x0000,0xC383,0xC018,0x4B4C,0x9CDD,0xECEC,0xF5EC,0xB5F4,
+	0xB5F4,0xADF2,0xABEC,0xAC9C,0x649C,0x9D6D,0xA3A4,0xA300,
+	0x8002,0xE484,0xC00A,0x9C9C,0x5B9D,0xADA5,0xA5A4,0xADAE,
+	0xB600,0x0007,0x9141,0x8121,0x7101,0x60C1,0x48A0,0x4081,
+	0x98A2,0xF820,0x800E,0xF800,0x0005,0xC0C2,0x4080,0x50C1,
+	0x60E1,0x7921,0x8941,0x8003,0x9161,0x0005,0x8141,0x6901,
+	0x58C1,0x40A0,0x48C1,0xE082,0x800E,0xF800,0x0005,0xF061,
+	0x8923,0x48A1,0x58E1,0x6101,0x7121,0xC004,0xA45C,0x5C1B,
+	0x6500,0x0001,0x9103,0xF0A2,0x8018,0xF800,0x0006,0xF0A2,
+	0xA143,0x5962,0x69A3,0x7A24,0x92E6,0x9B68,0xC003,0xF526,
+	0x151C,0x0001,0x9A8A,0xF861,0x800E,0xF800,0x0006,0xE0C2,
+	0x6A03,0x6A63,0x8B05,0xABE7,0xCCA9,0xED6B,0xC003,0xB5EC,
+	0x6D4D,0x0004,0xCD2D,0xAC6B,0x8389,0x6AC8,0xC964,0x800F,
+	0xF800,0x0007,0xA985,0x6A67,0x7AE8,0x9B89,0xBC0A,0xD469,
+	0xE486,0x13BB,0xC007,0xA5A3,0xF4AC,0xE4A4,0xACAC,0x000A,
 	0x7C10,0xD364,0xDB64,0xDB65,0xE365,0xEBE7,0xF570,0xFEF8,
-	0xFF39,0xFEB4,0xFE2B,0xFE87,0xFEC6,0xF666,0xEDE7,0xE549,
-	0xDD0B,0xAC8E,0x3B12,0x2B13,0x3354,0x3B94,0x2B74,0x1332,
-	0x02D0,0x7BEF,0xFDAE,0xFDAD,0xF58B,0xF529,0xE4C7,0xD445,
-	0xC3A3,0xBB22,0xB2C2,0xB2A2,0xBA83,0xC2A3,0xCAC3,0xD304,
-	0xDB24,0xDB65,0xE3A5,0xE3E5,0xEC26,0xEC46,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xF4C3,0xF4A4,0xEC85,0xECA6,0xECA5,
-	0xECA5,0xECA4,0xE484,0xE484,0xE484,0xE464,0xE444,0xDC23,
-	0xDC04,0xDC25,0xDC26,0xDC27,0xDC27,0xDC48,0xDC6A,0xDCAC,
-	0x9121,0x8101,0x68E1,0x58C0,0x4080,0x48A1,0xC0C2,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF041,0x88E2,
-	0x40A0,0x58C0,0x6901,0x8121,0x9161,0x9161,0x9161,0x9161,
-	0x8941,0x7921,0x68E1,0x50C1,0x40A0,0x88E2,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xB103,0x40A0,
-	0x50C1,0x60E1,0x6901,0x7121,0x6901,0x58E1,0x50C1,0x4902,
-	0xB124,0xF861,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF861,0xB164,0x61A3,
+	0xFF39,0xFEB4,0xFE2B,0xC003,0xB8B3,0x4C45,0x0003,0xE549,
+	0xDD0B,0xAC8E,0x3B12,0xC003,0x25F5,0xF41C,0x0003,0x1332,
+	0x02D0,0x7BEF,0xFDAE,0xC004,0xA35A,0x8A0A,0x0200,0x0000,
+	0xC3A3,0xC018,0x434C,0x9CDD,0xECEC,0xF5EC,0xB5F4,0xB4F5,
+	0xACF3,0xABEC,0xAC9C,0x639D,0x5DAD,0xA3A4,0xA300,0x8002,
+	0xE484,0xC00A,0x9C9C,0x5B9D,0xADA5,0xA5A4,0xADAE,0xB600,
+	0x0006,0x9121,0x8101,0x68E1,0x58C0,0x4080,0x48A1,0xC0C2,
+	0x800E,0xF800,0x0005,0xF041,0x88E2,0x40A0,0x58C0,0x6901,
+	0x8121,0x8003,0x9161,0x0006,0x8941,0x7921,0x68E1,0x50C1,
+	0x40A0,0x88E2,0xF841,0x800D,0xF800,0x0004,0xF820,0xB103,
+	0x40A0,0x50C1,0x60E1,0xC005,0xECEC,0x5C1C,0x5C75,0x0001,
+	0xB124,0xF861,0x801A,0xF800,0x000C,0xF861,0xB164,0x61A3,
 	0x69C3,0x7A65,0x9307,0xA389,0xA3AA,0x93AC,0x7B8C,0x6B4C,
-	0xC1E7,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF841,0x99A4,0x6A43,0x82E4,0xA3A6,0xC488,0xDD2A,0xEDAC,
-	0xEDCC,0xF5CD,0xEDCE,0xD54D,0xB48C,0x8BAA,0x72E8,0xA1E6,
-	0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xC944,0x6A47,0x72C8,0x9349,0xB3E9,0xCC49,0xEC67,0x13BB,
-	0x139C,0x13BC,0x1BFB,0x1C1B,0x241B,0x241B,0x5435,0xBBC8,
-	0xD384,0xDB64,0xDB65,0xDB65,0xE385,0xEBE7,0xF590,0xFEF9,
+	0xC1E7,0xF820,0x800D,0xF800,0x0010,0xF841,0x99A4,0x6A43,
+	0x82E4,0xA3A6,0xC488,0xDD2A,0xEDAC,0xEDCC,0xF5CD,0xEDCE,
+	0xD54D,0xB48C,0x8BAA,0x72E8,0xA1E6,0xF841,0x800E,0xF800,
+	0x0007,0xC944,0x6A47,0x72C8,0x9349,0xB3E9,0xCC49,0xEC67,
+	0x13BB,0xC005,0x9DAC,0xF3AC,0xE4A4,0x0002,0x5435,0xBBC8,
+	0xD384,0xC004,0xDCA5,0xA4EC,0xFE00,0x0014,0xF590,0xFEF9,
 	0xFF3A,0xFE94,0xFE2B,0xFE87,0xFEC6,0xFE85,0xEDE6,0xE549,
 	0xE50B,0xE52C,0xDD4C,0x7BEF,0x3354,0x3B94,0x2B73,0x1332,
-	0x02D0,0x7BEF,0xFDAE,0xFDAD,0xF58B,0xED49,0xE4C7,0xD445,
-	0xC3A3,0xBB22,0xB2C2,0xB2A2,0xBA83,0xC2A3,0xCAC3,0xD304,
-	0xDB44,0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC46,0xF485,0xF4C4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4A4,0xF4A6,0xECA6,0xECC5,
-	0xECA5,0xE4A4,0xE484,0xE484,0xE484,0xE464,0xE444,0xDC24,
-	0xDC04,0xDC04,0xDC26,0xDC47,0xDC27,0xDC48,0xDC8A,0xDCAB,
-	0x8921,0x7901,0x68E1,0x50A0,0x40A0,0x50A1,0xE082,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF082,0x68C2,
-	0x48A1,0x58E1,0x7101,0x8121,0x9161,0x9161,0x9161,0x9161,
-	0x8141,0x7101,0x60E1,0x48A0,0x40C1,0xC0C2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C3,0x50E1,0x40A0,
-	0x58C1,0x6901,0x6901,0x6901,0x60E1,0x50C1,0x5102,0xB944,
-	0xF861,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF861,0xC184,
-	0x61C3,0x6A04,0x82A6,0x9348,0xA3AA,0x93AB,0x838C,0x736C,
-	0x7AEB,0xE904,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xC903,0x6223,0x7284,0x9365,0xBC27,0xD4E9,0xED8B,
-	0xEDAC,0xF5CD,0xF5EE,0xD56D,0xBCCC,0x93EA,0x7B29,0x8287,
-	0xF0A2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xE0C2,0x7226,0x72C8,0x8B48,0xABC9,0xC429,0xE467,0x13BC,
-	0x139C,0x13BC,0x1BDB,0x1BFB,0x2C1A,0x8BEE,0xDBC4,0xDBA4,
-	0xD384,0xD384,0xDB65,0xDB65,0xE385,0xEBE8,0xF591,0xFEF9,
-	0xFF39,0xFE93,0xFE0A,0xFE87,0xFEC6,0xF685,0xEDE6,0xE549,
-	0xE50B,0xE54C,0xE54D,0xD50C,0xAC6D,0x53B2,0x2B73,0x1332,
-	0x02D0,0x7BEF,0xFDAE,0xFDAD,0xF5AB,0xED49,0xE4C7,0xD445,
-	0xC3A3,0xBB22,0xBAE2,0xBAA2,0xBAA3,0xC2A3,0xCAC3,0xD304,
-	0xDB44,0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC46,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4A4,0xF4A6,0xECA6,0xECC5,
-	0xECA5,0xE4A4,0xE484,0xE484,0xE484,0xE464,0xE444,0xDC24,
-	0xDC04,0xDC04,0xDC26,0xDC47,0xDC47,0xDC48,0xDC8A,0xDCAB,
-	0x8121,0x7101,0x60E1,0x50A0,0x4080,0x68A1,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD082,0x48C1,
-	0x48A0,0x60E1,0x7921,0x8941,0x9161,0x9161,0x9161,0x9161,
-	0x8121,0x6901,0x58C1,0x48A0,0x60C2,0xE862,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF841,0x8903,0x40A0,0x48C1,
-	0x58E1,0x6901,0x6901,0x60E1,0x50C1,0x48E1,0xA924,0xF861,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF862,
-	0xB164,0x59C3,0x6A24,0x82E7,0x9B69,0x9BAB,0x8B8C,0x7B6C,
-	0x6B2C,0xA249,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE882,0x7A04,0x6A63,0x8B05,0xB3E7,0xCCA9,0xE56B,
-	0xEDAC,0xF5CC,0xF5EE,0xDD8D,0xC4EC,0xA42B,0x8369,0x72C8,
-	0xD903,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF861,0x8206,0x6AA7,0x8308,0xA3A9,0xC429,0xDC47,0x13BB,
-	0x139C,0x13BC,0x1BFB,0x4C15,0xCBE7,0xDBE4,0xDBC4,0xDBA4,
-	0xD384,0xDB84,0xDB65,0xDB65,0xE385,0xEC08,0xF5B2,0xFEF9,
-	0xFF19,0xFE72,0xFE0A,0xFE87,0xFEC6,0xF685,0xEDE6,0xE528,
-	0xE50B,0xE52C,0xE54D,0xD50C,0xCCAC,0xC48B,0x8C0F,0x2352,
-	0x02D0,0x7C0F,0xFDAE,0xFDCD,0xF5AB,0xED49,0xE4C7,0xD446,
-	0xC3A4,0xBB22,0xBAE2,0xBAA2,0xBAA3,0xC2A3,0xCAC3,0xD304,
-	0xDB44,0xDB64,0xE3A5,0xEBE6,0xEC26,0xEC46,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4A4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA5,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC24,
-	0xDC04,0xDC04,0xDC26,0xDC26,0xDC47,0xDC48,0xDC8A,0xDCAB,
-	0x8101,0x7101,0x58C1,0x48A0,0x3880,0x80A2,0xF821,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xA8A2,0x40A0,
-	0x50C0,0x60E1,0x7921,0x8941,0x9161,0x9161,0x9161,0x8941,
-	0x7921,0x68E1,0x50C1,0x40A0,0x90C2,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xD0A2,0x48C1,0x40A0,0x50C0,
-	0x58E1,0x6101,0x6101,0x50C1,0x40C0,0x9103,0xF882,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF882,0x9984,0x61E4,0x7286,0x8B28,0x936A,0x938B,0x838C,
-	0x736D,0x6AEB,0xD904,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF840,0xA183,0x6A43,0x82E4,0xA3A6,0xC488,0xE52A,
-	0xEDAB,0xF5AC,0xF5CE,0xE5AE,0xCD2D,0xAC6B,0x8B89,0x6AE8,
-	0xB984,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF840,0x91C6,0x6287,0x7AE8,0x9B68,0xBC09,0xD427,0x139B,
-	0x139C,0x239A,0x9C0D,0xE3E4,0xE3E4,0xE3E4,0xDBC4,0xDBA4,
-	0xDB84,0xD384,0xDB64,0xDB65,0xE385,0xEC08,0xF5B2,0xFF19,
-	0xFF19,0xFE71,0xFE09,0xFE87,0xFEC6,0xF665,0xEDC5,0xE528,
-	0xDCEA,0xE52C,0xDD4D,0xD50C,0xCCCC,0xC48B,0xD48C,0xD4AE,
-	0x4350,0x840F,0xFDAF,0xFDCD,0xF5AB,0xED49,0xE4C7,0xD465,
-	0xC3A4,0xBB22,0xBAE2,0xBAA2,0xBAA3,0xCAA3,0xCAC3,0xD304,
-	0xDB44,0xE385,0xE3A5,0xEBE6,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4C4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA5,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC04,0xDC25,0xDC26,0xDC47,0xDC48,0xE48A,0xDCAB,
-	0x7901,0x68E1,0x58C1,0x48A0,0x4080,0x98C2,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF040,0x80C2,0x4080,
-	0x50C0,0x68E1,0x7921,0x9141,0x9141,0x9141,0x9141,0x8121,
-	0x7101,0x60E1,0x48A0,0x40C1,0xC0C2,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0x80C2,0x40A0,0x48C0,0x58C1,
-	0x58E0,0x60E1,0x58E1,0x48C1,0x7123,0xF0A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF0C2,0x81C4,0x6224,0x7AA6,0x8B28,0x8B6B,0x8B8C,
-	0x7B6D,0x6B2C,0x9A28,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xC923,0x6A43,0x7AA4,0x9B66,0xBC47,0xDCE9,
-	0xF5AB,0xF5CC,0xF5CD,0xEDCE,0xD54D,0xB48C,0x8BAA,0x72E8,
-	0x9A06,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xA985,0x6267,0x72C7,0x9348,0xB3E9,0xCC27,0x1BBB,
-	0x53D4,0xDC45,0xE404,0xE3E4,0xE3E4,0xE3E4,0xDBC4,0xDBA4,
-	0xDB84,0xD384,0xDB64,0xDB65,0xE385,0xEC09,0xFDD2,0xFF19,
-	0xFF19,0xFE51,0xFE09,0xFE87,0xFEC6,0xF665,0xEDC5,0xE507,
-	0xE4EA,0xE52C,0xE54D,0xD50C,0xCCCC,0xC48B,0xD48C,0xECED,
-	0xFD4F,0xDD2F,0xFDAE,0xFDCD,0xF5AC,0xED49,0xE4E7,0xD465,
-	0xCBC4,0xBB23,0xB2E2,0xBAA2,0xBAA3,0xCAA3,0xCAE3,0xD324,
-	0xDB44,0xDB85,0xE3A5,0xEBE6,0xEC26,0xEC47,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xFCC4,0xF4A4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC04,0xDC25,0xDC47,0xDC47,0xDC48,0xDC8A,0xDCAB,
-	0x7901,0x68E1,0x50C0,0x40A0,0x4080,0xB0A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE841,0x60C1,0x40A0,
-	0x50C1,0x6901,0x8121,0x9142,0x9141,0x9141,0x9141,0x8121,
-	0x7101,0x58E1,0x48A1,0x58C2,0xE861,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xD8A2,0x50C1,0x40A0,0x48C0,0x58E1,
-	0x58E1,0x50E1,0x48C0,0x50E2,0xC8E3,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xD882,0xA0C1,0xE020,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE020,0xA0C2,0xD8A1,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xC923,0x69E4,0x6A65,0x82E7,0x8B4A,0x8B8B,
-	0x838D,0x736D,0x72CA,0xD904,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xE8A2,0x7A04,0x7284,0x9345,0xB407,0xD4C9,
-	0xED8B,0xEDAC,0xF5CD,0xF5EE,0xD54D,0xB4AC,0x93CA,0x7308,
-	0x8246,0xE881,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xC144,0x6246,0x72A7,0x8B28,0xB3E9,0xCC27,0xA40B,
-	0xEC63,0xEC63,0xE424,0xE3E4,0xE3E4,0xE3E4,0xDBC4,0xDBA4,
-	0xDB84,0xD384,0xDB64,0xDB65,0xE385,0xEC29,0xFDF3,0xFF3A,
-	0xFF18,0xFE30,0xFE09,0xFE87,0xFEC6,0xF685,0xEDC5,0xE507,
-	0xDD0A,0xE52C,0xE54D,0xDD0C,0xCCCC,0xC48B,0xDCAC,0xF4EE,
-	0xFD4F,0xFD8F,0xFDAF,0xFDCD,0xF5AC,0xF54A,0xE4E7,0xD466,
-	0xCBC4,0xC343,0xBAE2,0xBAC2,0xBAA2,0xCAC3,0xCAE3,0xD304,
-	0xDB44,0xDB85,0xE3C5,0xEBE6,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC04,0xDC25,0xDC47,0xDC47,0xDC48,0xDC8A,0xDCAB,
-	0x7901,0x68E1,0x50C0,0x4080,0x4081,0xC881,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xD881,0x50C1,0x48A1,
-	0x58E1,0x7101,0x8121,0x9141,0x9141,0x9141,0x8941,0x7921,
-	0x6901,0x50C1,0x40A0,0x78C2,0xF041,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0x98E2,0x40A1,0x48A0,0x50C1,0x58E1,
-	0x58E1,0x50C0,0x48C1,0x9123,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF082,
-	0xA903,0x40C1,0x50A1,0xE020,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE000,0x5080,0x48E1,0xA923,0xF082,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF861,0x99A4,0x6224,0x72A6,0x8309,0x834A,
-	0x838D,0x736D,0x6B0B,0xA9E7,0xF840,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF061,0x91C3,0x6A63,0x8B05,0xABE6,0xCCA8,
+	0x02D0,0x7BEF,0xFDAE,0xC004,0xA35A,0x5242,0x0200,0x0000,
+	0xC3A3,0xC018,0x434C,0x9CDD,0xECEC,0xF5F4,0xACF5,0xB4F5,
+	0xACF3,0xB3E4,0xAC9C,0xA45C,0xA664,0xAB9C,0x6300,0x8002,
+	0xE484,0xC00A,0x9C9C,0x5C9C,0xA4AE,0xAD9C,0xADB6,0xAD00,
+	0x0006,0x8921,0x7901,0x68E1,0x50A0,0x40A0,0x50A1,0xE082,
+	0x800E,0xF800,0x0005,0xF082,0x68C2,0x48A1,0x58E1,0x7101,
+	0x8121,0x8003,0x9161,0x0005,0x8141,0x7101,0x60E1,0x48A0,
+	0x40C1,0xC0C2,0x800E,0xF800,0x0003,0xE8C3,0x50E1,0x40A0,
+	0x58C1,0x8002,0x6901,0x0004,0x60E1,0x50C1,0x5102,0xB944,
+	0xF861,0x801C,0xF800,0x0006,0xF861,0xC184,0x61C3,0x6A04,
+	0x82A6,0x9348,0xA3AA,0xC003,0x251D,0x1CC3,0x0000,0xE904,
+	0x800E,0xF800,0x000F,0xC903,0x6223,0x7284,0x9365,0xBC27,
+	0xD4E9,0xED8B,0xEDAC,0xF5CD,0xF5EE,0xD56D,0xBCCC,0x93EA,
+	0x7B29,0x8287,0xF0A2,0x800E,0xF800,0x0007,0xE0C2,0x7226,
+	0x72C8,0x8B48,0xABC9,0xC429,0xE467,0x13BC,0xC003,0x9CAC,
+	0xEBAC,0x0002,0x2C1A,0x8BEE,0xDBC4,0xC006,0x9C5C,0xA4DD,
+	0xA4EC,0xFF00,0x0009,0xF591,0xFEF9,0xFF39,0xFE93,0xFE0A,
+	0xFE87,0xFEC6,0xF685,0xEDE6,0xE549,0xC003,0x96B5,0xA513,
+	0x0006,0xAC6D,0x53B2,0x2B73,0x1332,0x02D0,0x7BEF,0xFDAE,
+	0xC004,0xA362,0x4A42,0x0200,0x0000,0xC3A3,0xC018,0x4394,
+	0x94A5,0xE4EC,0xF5F4,0xACF5,0xB4F5,0xACF3,0xABEC,0xAC9C,
+	0xA45C,0xA664,0xAB9C,0x6300,0x8002,0xE484,0xC00A,0x9C9C,
+	0x5C9C,0xA4AE,0xADA4,0xA5B6,0xAD00,0x0000,0x8121,0xC003,
+	0x1C1C,0x131C,0x0001,0x68A1,0xF841,0x800E,0xF800,0x0005,
+	0xD082,0x48C1,0x48A0,0x60E1,0x7921,0x8941,0x8003,0x9161,
+	0x0005,0x8121,0x6901,0x58C1,0x48A0,0x60C2,0xE862,0x800D,
+	0xF800,0x0005,0xF841,0x8903,0x40A0,0x48C1,0x58E1,0x6901,
+	0xC003,0xA45C,0x1C6C,0x0001,0xA924,0xF861,0x801E,0xF800,
+	0x0005,0xF862,0xB164,0x59C3,0x6A24,0x82E7,0x9B69,0xC003,
+	0xB61D,0x1C14,0x0001,0xA249,0xF841,0x800D,0xF800,0x000F,
+	0xE882,0x7A04,0x6A63,0x8B05,0xB3E7,0xCCA9,0xE56B,0xEDAC,
+	0xF5CC,0xF5EE,0xDD8D,0xC4EC,0xA42B,0x8369,0x72C8,0xD903,
+	0x800E,0xF800,0x000D,0xF861,0x8206,0x6AA7,0x8308,0xA3A9,
+	0xC429,0xDC47,0x13BB,0x139C,0x13BC,0x1BFB,0x4C15,0xCBE7,
+	0xDBE4,0xC006,0x9C9C,0x5CE4,0x9DA4,0xEC00,0x000A,0xEC08,
+	0xF5B2,0xFEF9,0xFF19,0xFE72,0xFE0A,0xFE87,0xFEC6,0xF685,
+	0xEDE6,0xE528,0xC005,0x9FAD,0xAD13,0x4C5B,0x0004,0x8C0F,
+	0x2352,0x02D0,0x7C0F,0xFDAE,0xC004,0xAB5A,0x4A42,0x0300,
+	0x0000,0xC3A4,0xC026,0x4294,0x94A5,0xE4EC,0xF5F4,0xACF5,
+	0xF5B4,0xACF3,0xABEC,0xAC9C,0xA45C,0xA664,0xABA4,0x9C63,
+	0xA49C,0x9C9C,0x5C9C,0xA4AE,0xA4AD,0xA5B6,0xAD00,0x0006,
+	0x8101,0x7101,0x58C1,0x48A0,0x3880,0x80A2,0xF821,0x800D,
+	0xF800,0x0006,0xF820,0xA8A2,0x40A0,0x50C0,0x60E1,0x7921,
+	0x8941,0x8002,0x9161,0x0006,0x8941,0x7921,0x68E1,0x50C1,
+	0x40A0,0x90C2,0xF820,0x800D,0xF800,0x0003,0xD0A2,0x48C1,
+	0x40A0,0x50C0,0xC004,0xEDEC,0xA414,0x2300,0x0001,0x9103,
+	0xF882,0x8020,0xF800,0x0004,0xF882,0x9984,0x61E4,0x7286,
+	0x8B28,0xC004,0xF6AD,0x251D,0x4200,0x0000,0xD904,0x800D,
+	0xF800,0x0010,0xF840,0xA183,0x6A43,0x82E4,0xA3A6,0xC488,
+	0xE52A,0xEDAB,0xF5AC,0xF5CE,0xE5AE,0xCD2D,0xAC6B,0x8B89,
+	0x6AE8,0xB984,0xF820,0x800D,0xF800,0x000A,0xF840,0x91C6,
+	0x6287,0x7AE8,0x9B68,0xBC09,0xD427,0x139B,0x139C,0x239A,
+	0x9C0D,0x8002,0xE3E4,0xC006,0x5C9C,0x9C64,0xDCA5,0xEC00,
+	0x000A,0xEC08,0xF5B2,0xFF19,0xFF19,0xFE71,0xFE09,0xFE87,
+	0xFEC6,0xF665,0xEDC5,0xE528,0xC005,0x56F6,0x6D53,0x5453,
+	0x0004,0xD48C,0xD4AE,0x4350,0x840F,0xFDAF,0xC004,0xAA5A,
+	0x4A42,0x0A00,0x0000,0xC3A4,0xC003,0x4294,0x94A5,0x0000,
+	0xCAA3,0xC021,0xACF5,0xF4F5,0xACF5,0xB4AD,0xF2AB,0xECAC,
+	0x9CA4,0x649E,0x64AB,0xA49C,0x63A4,0x9C9C,0x9C5C,0xA49C,
+	0xADA5,0xADA5,0xF66D,0x0000,0x7901,0xC003,0x1C1C,0x1B5C,
+	0x0001,0x98C2,0xF820,0x800D,0xF800,0x0005,0xF040,0x80C2,
+	0x4080,0x50C0,0x68E1,0x7921,0x8003,0x9141,0x0005,0x8121,
+	0x7101,0x60E1,0x48A0,0x40C1,0xC0C2,0x800D,0xF800,0x0004,
+	0xF841,0x80C2,0x40A0,0x48C0,0x58C1,0xC003,0xABE5,0x641C,
+	0x0001,0x7123,0xF0A2,0x800B,0xF800,0x0000,0xF820,0x8008,
+	0xF800,0x0000,0xF820,0x800B,0xF800,0x0004,0xF0C2,0x81C4,
+	0x6224,0x7AA6,0x8B28,0xC003,0xB7AD,0x1D13,0x0001,0x9A28,
+	0xF841,0x800D,0xF800,0x000F,0xC923,0x6A43,0x7AA4,0x9B66,
+	0xBC47,0xDCE9,0xF5AB,0xF5CC,0xF5CD,0xEDCE,0xD54D,0xB48C,
+	0x8BAA,0x72E8,0x9A06,0xF841,0x800D,0xF800,0x000A,0xF820,
+	0xA985,0x6267,0x72C7,0x9348,0xB3E9,0xCC27,0x1BBB,0x53D4,
+	0xDC45,0xE404,0x8002,0xE3E4,0xC006,0x5C9C,0x9C64,0xDCA5,
+	0xEC00,0x000A,0xEC09,0xFDD2,0xFF19,0xFF19,0xFE51,0xFE09,
+	0xFE87,0xFEC6,0xF665,0xEDC5,0xE507,0xC005,0x9FB6,0xAD13,
+	0x5453,0x0004,0xD48C,0xECED,0xFD4F,0xDD2F,0xFDAE,0xC004,
+	0xAB5B,0x494A,0x0200,0x0005,0xCBC4,0xBB23,0xB2E2,0xBAA2,
+	0xBAA3,0xCAA3,0xC009,0xB4F5,0xECB5,0xECF5,0xB4AD,0xEAB3,
+	0x8003,0xFCC4,0xC013,0x5CA6,0x64AB,0xA49B,0x64A4,0x9C9C,
+	0x9C5C,0xA49C,0xADAE,0xA4A5,0xB6AD,0x0005,0x7901,0x68E1,
+	0x50C0,0x40A0,0x4080,0xB0A2,0x800E,0xF800,0x0006,0xE841,
+	0x60C1,0x40A0,0x50C1,0x6901,0x8121,0x9142,0x8002,0x9141,
+	0x0005,0x8121,0x7101,0x58E1,0x48A1,0x58C2,0xE861,0x800D,
+	0xF800,0x0004,0xD8A2,0x50C1,0x40A0,0x48C0,0x58E1,0xC003,
+	0xA464,0x5BEE,0x0001,0xC8E3,0xF820,0x8009,0xF800,0x0003,
+	0xF820,0xD882,0xA0C1,0xE020,0x8006,0xF800,0x0003,0xE020,
+	0xA0C2,0xD8A1,0xF820,0x8009,0xF800,0x0004,0xF820,0xC923,
+	0x69E4,0x6A65,0x82E7,0xC003,0xFFB5,0x661C,0x0001,0x72CA,
+	0xD904,0x800D,0xF800,0x000F,0xE8A2,0x7A04,0x7284,0x9345,
+	0xB407,0xD4C9,0xED8B,0xEDAC,0xF5CD,0xF5EE,0xD54D,0xB4AC,
+	0x93CA,0x7308,0x8246,0xE881,0x800E,0xF800,0x0009,0xC144,
+	0x6246,0x72A7,0x8B28,0xB3E9,0xCC27,0xA40B,0xEC63,0xEC63,
+	0xE424,0x8002,0xE3E4,0xC006,0x5C9C,0x9C64,0xDCA5,0xEC00,
+	0x000A,0xEC29,0xFDF3,0xFF3A,0xFF18,0xFE30,0xFE09,0xFE87,
+	0xFEC6,0xF685,0xEDC5,0xE507,0xC005,0x67EE,0xAD53,0x1453,
+	0x0001,0xDCAC,0xF4EE,0xC007,0xFDB4,0xACAA,0x5B8A,0x0903,
+	0x0000,0xCBC4,0xC003,0x434B,0x9C9C,0x0000,0xCAC3,0xC009,
+	0xACED,0xF4B5,0xF4ED,0xB4AD,0xF2AB,0x8003,0xFCC4,0xC013,
+	0x649E,0x64AB,0xA49B,0x64A4,0x9C9C,0x9C5C,0xA49C,0xADAE,
+	0xA4A5,0xB6AD,0x0005,0x7901,0x68E1,0x50C0,0x4080,0x4081,
+	0xC881,0x800E,0xF800,0x0005,0xD881,0x50C1,0x48A1,0x58E1,
+	0x7101,0x8121,0x8002,0x9141,0x0006,0x8941,0x7921,0x6901,
+	0x50C1,0x40A0,0x78C2,0xF041,0x800C,0xF800,0x0002,0xF820,
+	0x98E2,0x40A1,0xC005,0xE3ED,0xECA4,0x5B65,0x0001,0x9123,
+	0xF841,0x8009,0xF800,0x0004,0xF082,0xA903,0x40C1,0x50A1,
+	0xE020,0x8006,0xF800,0x0004,0xE000,0x5080,0x48E1,0xA923,
+	0xF082,0x8009,0xF800,0x0004,0xF861,0x99A4,0x6224,0x72A6,
+	0x8309,0xC003,0xB5B7,0x1C4A,0x0001,0xA9E7,0xF840,0x800C,
+	0xF800,0x000F,0xF061,0x91C3,0x6A63,0x8B05,0xABE6,0xCCA8,
 	0xED6A,0xEDAB,0xF5CC,0xF5ED,0xDD6D,0xBCCC,0x9BEA,0x7B28,
-	0x72A7,0xD8E3,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xC903,0x6A47,0x72A7,0x8B28,0xB3E9,0xCC27,0xEC64,
-	0xEC63,0xEC43,0xE424,0xE404,0xE3E4,0xDBE4,0xDBC4,0xDBA4,
-	0xDB84,0xDB84,0xDB64,0xDB65,0xE385,0xEC49,0xFDF3,0xFF3A,
+	0x72A7,0xD8E3,0x800E,0xF800,0x0006,0xC903,0x6A47,0x72A7,
+	0x8B28,0xB3E9,0xCC27,0xEC64,0xC00C,0xA39C,0x5D9C,0x9C64,
+	0x9C9C,0x9CA4,0x9CA5,0xEC00,0x000A,0xEC49,0xFDF3,0xFF3A,
 	0xFF18,0xFE30,0xFE09,0xFE87,0xFEC6,0xF685,0xEDA4,0xE507,
-	0xDCEA,0xE52C,0xE54D,0xD52C,0xCCCC,0xC48B,0xDCAC,0xF4ED,
-	0xFD4F,0xFD8F,0xFDAF,0xFDCE,0xF5AC,0xF54A,0xE4E8,0xDC66,
-	0xCBC5,0xBB43,0xBAE2,0xBAC2,0xC2A2,0xCAC3,0xD2E3,0xD324,
-	0xDB44,0xE385,0xE3C5,0xEBE6,0xEC26,0xEC47,0xF465,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC24,
-	0xDC24,0xDC04,0xDC25,0xDC47,0xDC48,0xDC68,0xDC8A,0xDCAB,
-	0x7901,0x68E1,0x50A0,0x4080,0x50A1,0xD861,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xC8A2,0x40A1,0x48A0,
-	0x58E1,0x7101,0x8121,0x9141,0x9141,0x9141,0x8941,0x7921,
-	0x60E1,0x50C1,0x40A0,0xA0C2,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xE882,0x68E2,0x40A0,0x48A0,0x50C0,0x58E1,
-	0x50C0,0x48A1,0x58C1,0xD8A3,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C2,0x8144,
-	0x38A0,0x38A0,0x5080,0xE020,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE000,0x58A0,0x38A0,0x38C0,0x8164,
-	0xF0C2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xD8E3,0x69C4,0x6A45,0x72C7,0x832A,
-	0x836C,0x7B8D,0x6B4C,0x8289,0xF0A2,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xB163,0x6A43,0x82E4,0xA3A6,0xC488,
-	0xE54A,0xEDAB,0xEDCC,0xF5ED,0xDD6D,0xC4EC,0xA40B,0x8349,
-	0x6AC8,0xD144,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xD8A2,0x7247,0x72A7,0x8B28,0xB3E9,0xCC27,0xEC64,
-	0xEC63,0xEC63,0xE424,0xE404,0xE3E4,0xE3E4,0xDBC4,0xDBC4,
-	0xDBA4,0xDB84,0xDB85,0xDB65,0xE385,0xEC49,0xFE14,0xFF3A,
-	0xFEF8,0xFE30,0xFE09,0xFE88,0xFEC6,0xF665,0xEDA5,0xE4E7,
-	0xDCC9,0xE52C,0xE54D,0xD50D,0xCCCB,0xC48B,0xDCAC,0xF4EE,
-	0xFD4F,0xFD8F,0xFDAF,0xFDCE,0xF5AC,0xF56A,0xE4E8,0xD467,
-	0xCBC5,0xC343,0xBAE3,0xBAC2,0xC2A3,0xCAC3,0xD2E3,0xD324,
-	0xDB44,0xE385,0xE3C5,0xEBE6,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCC4,0xFCC4,0xFCC4,0xF4C4,0xF4A6,0xECA6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC04,0xDC25,0xDC46,0xDC48,0xDC68,0xDC8A,0xDC8B,
-	0x7901,0x68E1,0x50A0,0x4080,0x60C1,0xE061,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xA8C2,0x40A0,0x48A1,
-	0x6101,0x7921,0x8941,0x9141,0x9141,0x9141,0x8121,0x7101,
-	0x60E1,0x48C1,0x40A1,0xC0A1,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xC0C2,0x48A1,0x40A0,0x50C0,0x58E0,0x58E0,
-	0x50C0,0x48C1,0x98E2,0xF841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE8A2,0x7964,0x38A0,
-	0x38A0,0x38A0,0x5080,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x50A0,0x38A0,0x38C0,0x40C1,
-	0x7964,0xF0A2,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0x9963,0x6205,0x6A86,0x72E8,
-	0x832B,0x7B6C,0x6B6C,0x6ACA,0xD145,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xC902,0x6223,0x7AA4,0x9B66,0xBC47,
-	0xDD09,0xEDAB,0xEDAC,0xF5CD,0xE5AD,0xCD2C,0xAC6B,0x8B89,
-	0x6AE7,0xB985,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE882,0x8246,0x72C7,0x8B48,0xB3E9,0xCC48,0xE444,
-	0xEC63,0xEC43,0xEC24,0xE404,0xDC04,0xDBC4,0xDBC4,0xDBC4,
-	0xDBA4,0xDB84,0xDB85,0xDB65,0xE385,0xEC6A,0xFE14,0xFF3A,
-	0xFEF8,0xFE0F,0xFE09,0xFE87,0xFEC6,0xF685,0xEDA4,0xE506,
-	0xE4C9,0xE50C,0xDD4D,0xD50C,0xCCCB,0xCC8C,0xDCAC,0xECEE,
-	0xFD4F,0xFD8F,0xFDAF,0xFDCE,0xFDAC,0xED6A,0xE4E8,0xD466,
-	0xCBE5,0xC344,0xBB03,0xBAC3,0xBAA3,0xCAC3,0xD2E4,0xD324,
-	0xDB44,0xE385,0xE3C5,0xEBE6,0xEC26,0xEC47,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4C4,0xF4A5,0xECC6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC47,0xDC69,0xDC8A,0xDCAB,
-	0x7901,0x68E1,0x50C0,0x4080,0x7903,0xF041,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0x90A2,0x4080,0x50C1,
-	0x6901,0x7921,0x8941,0x9141,0x9141,0x9141,0x8121,0x7101,
-	0x58C1,0x48A1,0x48C1,0xD881,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF841,0x98C2,0x40A0,0x48C0,0x58C1,0x60E0,0x58E1,
-	0x58C0,0x50C1,0x88A1,0xB040,0xA040,0xA040,0xA040,0xA840,
-	0xA840,0xA840,0xA840,0xA840,0xB060,0x78E1,0x40C1,0x40C0,
-	0x40A0,0x38A0,0x5080,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x50A0,0x38C0,0x40C1,0x40C1,
-	0x40E1,0x8903,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xC103,0x61C4,0x6245,0x72A7,
-	0x7B0A,0x7B4C,0x736D,0x6B0B,0xA9C6,0xF841,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE0C2,0x6A23,0x7283,0x9345,0xB427,
-	0xD4E9,0xEDAB,0xEDAC,0xF5CD,0xEDCD,0xD52C,0xB46B,0x8B89,
-	0x72E7,0xA9C5,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF061,0x9A27,0x72C7,0x8B49,0xB409,0xCC48,0x4BD5,
-	0x4BD6,0x4BD6,0x4BF5,0x4BF5,0x4BF5,0x4C15,0x5416,0x5416,
-	0x5435,0x5435,0x5455,0x5435,0x4C35,0x4BD2,0x42CD,0x426A,
-	0x428B,0x3AF0,0x42F3,0x42B4,0x4294,0x42B5,0x4B15,0x4B94,
-	0x5393,0x4B72,0x4B51,0x5371,0x5B91,0x5BB2,0x53B1,0x4391,
-	0x4350,0x9C6F,0xFDAF,0xFDCE,0xFDAC,0xED6A,0xE4E8,0xD487,
-	0xCBE5,0xC364,0xBAE3,0xBAC3,0xC2A3,0xCAC3,0xD304,0xD324,
-	0xDB44,0xE385,0xEBC5,0xEC06,0xEC26,0xEC47,0xF485,0xFCA4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4C4,0xF4C6,0xECC6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC47,0xDC69,0xDC8A,0xDCAB,
-	0x7901,0x68E1,0x50C0,0x4080,0x9923,0xF020,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0x80C2,0x40A0,0x50C1,
-	0x6901,0x8121,0x9141,0x9141,0x9141,0x9141,0x8121,0x7101,
-	0x58C1,0x40A1,0x60C2,0xE861,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF041,0x78E2,0x40A0,0x50C0,0x60E0,0x6901,0x6901,
-	0x60E0,0x58C1,0x48C0,0x48C0,0x48C0,0x48C1,0x48C1,0x48C0,
-	0x48C0,0x48C0,0x48C1,0x48C0,0x50C1,0x48E1,0x48E1,0x48C0,
-	0x40C0,0x38C0,0x5080,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x40C0,0x40C0,0x48E1,
-	0x48E1,0x48E1,0xB923,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE8C2,0x71C4,0x5A25,0x6A87,
-	0x7AE9,0x7B4B,0x736C,0x6B2C,0x9269,0xF861,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE861,0x7A03,0x7263,0x8B25,0xB406,
-	0xD4C9,0xED8B,0xEDAB,0xF5CC,0xF5CD,0xD54C,0xB48B,0x93A9,
-	0x72E7,0x9A05,0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xAA07,0x72C7,0x8B49,0xB40A,0xCC48,0x139A,
-	0x139C,0x139C,0x1BDB,0x1BFB,0x1BFB,0x1C1B,0x243B,0x243B,
-	0x245B,0x247B,0x247B,0x249A,0x1C9A,0x1375,0x01AA,0x00C5,
-	0x0108,0x01F0,0x01F7,0x0178,0x0139,0x097B,0x125B,0x1B19,
-	0x2337,0x1AF4,0x1AB2,0x2AD3,0x3334,0x3374,0x2333,0x0AF1,
-	0x02B0,0x83F0,0xFDAF,0xFDCE,0xF5AC,0xED6B,0xE4E8,0xD487,
-	0xCBE5,0xC364,0xBB03,0xBAC3,0xC2A3,0xCAC3,0xD2E4,0xD324,
-	0xDB64,0xE385,0xEBC5,0xEC06,0xEC46,0xEC67,0xF485,0xFCA4,
-	0xFCC4,0xFCE4,0xFCC4,0xFCC4,0xF4C4,0xF4C6,0xECC6,0xECE5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC47,0xDC69,0xDC8A,0xDCAB,
-	0x7901,0x68E0,0x50C1,0x4080,0xB124,0xF820,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF041,0x78C2,0x40A0,0x50C0,
-	0x6901,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7101,
-	0x58C1,0x40A1,0x70A1,0xE841,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xE861,0x58A1,0x40A0,0x50C0,0x6901,0x7121,0x7921,
-	0x7121,0x6901,0x60E0,0x58E0,0x58E1,0x5901,0x58E1,0x58E1,
-	0x5900,0x5901,0x5901,0x5901,0x6101,0x6101,0x5901,0x5901,
-	0x48E0,0x40C0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x40C0,0x48E1,0x5101,
-	0x50E1,0x48E1,0x7143,0xF8A3,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF841,0x9163,0x5A04,0x6246,
-	0x72A8,0x7B2A,0x734B,0x6B2C,0x7A89,0xE8A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF061,0x89C3,0x6A63,0x8B25,0xB3E7,
-	0xD4C8,0xF58A,0xF5AB,0xEDAC,0xEDED,0xD54C,0xB4AB,0x93C9,
-	0x7308,0x9226,0xF061,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xC1C6,0x72C7,0x8B48,0xB40A,0xCC49,0x137A,
-	0x137C,0x139C,0x1BDB,0x1BFB,0x1BFB,0x1C1B,0x243B,0x245B,
-	0x247B,0x247B,0x249B,0x247A,0x1C7A,0x1374,0x01AA,0x00C5,
-	0x0108,0x0211,0x0217,0x0177,0x0139,0x099B,0x125B,0x1B1A,
-	0x2357,0x1AF4,0x1AB2,0x2AD3,0x3333,0x3374,0x2353,0x0AF1,
-	0x0290,0x7BEF,0xFDAF,0xFDCD,0xF5AC,0xED6B,0xE509,0xD487,
-	0xCBE5,0xC364,0xBB03,0xBAC2,0xC2C2,0xCAC3,0xD2E4,0xD324,
-	0xDB44,0xE385,0xE3C5,0xEC06,0xEC46,0xEC67,0xF486,0xFCA4,
-	0xFCC4,0xFCE4,0xFCE4,0xFCE4,0xF4C5,0xF4C6,0xECC6,0xECE5,
-	0xECC5,0xECA4,0xECA4,0xE4A4,0xE484,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC04,0xDC25,0xDC47,0xDC47,0xDC69,0xDC8B,0xDCAB,
-	0x7901,0x68E0,0x50C1,0x4080,0xC8C3,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE841,0x68C1,0x40A0,0x50C1,
-	0x6901,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7101,
-	0x58C1,0x40A0,0x80A1,0xF020,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xD0A1,0x50A1,0x40A0,0x58E0,0x7101,0x7921,0x8141,
-	0x8161,0x7941,0x7921,0x7121,0x7121,0x7141,0x7141,0x7921,
-	0x7941,0x7941,0x7941,0x7941,0x7941,0x7941,0x7141,0x6921,
-	0x50E1,0x48C0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x48C0,0x50E1,0x5901,
-	0x5901,0x5101,0x5101,0xB903,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF820,0xB123,0x59E4,0x6245,
-	0x6A87,0x72E9,0x730B,0x6B2C,0x72AA,0xD904,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF040,0x9983,0x6A63,0x8B05,0xB406,
-	0xCCA8,0xED6A,0xED8B,0xEDAC,0xEDCD,0xD54C,0xBCAB,0x8BA9,
-	0x72E7,0x8A46,0xE861,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xD144,0x72C7,0x8B49,0xB40A,0xCC48,0x137A,
-	0x137C,0x139C,0x1BDB,0x1BDA,0x1BFB,0x1C1B,0x243B,0x245B,
-	0x245B,0x247B,0x249B,0x247A,0x1C5A,0x1354,0x01A9,0x00A5,
-	0x0128,0x0211,0x0217,0x0177,0x0139,0x019B,0x125B,0x1B1A,
-	0x2357,0x1AF5,0x1AB3,0x22D3,0x3313,0x3373,0x2353,0x0AF1,
-	0x0290,0x7BEF,0xFDAF,0xFDCD,0xF5AC,0xED6A,0xE509,0xD487,
-	0xCBE5,0xC364,0xBB03,0xBAE3,0xC2C3,0xCAE3,0xD304,0xD324,
-	0xDB44,0xE385,0xE3C5,0xEC26,0xEC46,0xF467,0xF4A6,0xFCA4,
-	0xFCC4,0xFCE4,0xFCE4,0xFCE4,0xF4C5,0xF4C6,0xECC6,0xECE5,
-	0xECC5,0xECA4,0xECA4,0xE4A4,0xE484,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC47,0xDC47,0xDC69,0xE4AB,0xDCAB,
-	0x7901,0x68E0,0x50C1,0x4080,0xF9A6,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE041,0x58A1,0x40A0,0x50C0,
-	0x68E1,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7101,
-	0x58E1,0x40A0,0x90E2,0xF020,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xB8A2,0x48A1,0x40A0,0x58E0,0x7121,0x8141,0x9161,
-	0x9161,0x8961,0x8941,0x8961,0x8161,0x8161,0x8961,0x8961,
-	0x8961,0x8981,0x8981,0x8981,0x9181,0x8982,0x8161,0x7141,
-	0x5901,0x48C0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x48E0,0x5901,0x6121,
-	0x6121,0x5901,0x5101,0x8102,0xF861,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xD0E3,0x61C4,0x6225,
-	0x6A66,0x72C9,0x72EA,0x6B0B,0x6ACB,0xC945,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF820,0xA1C3,0x7263,0x8B05,0xB406,
-	0xD4A8,0xED8A,0xED8B,0xEDAC,0xF5CC,0xD54C,0xBC8B,0x93A9,
-	0x72E7,0x7A46,0xE881,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF9A6,0x72C7,0x8B49,0xB42B,0xCC69,0x1379,
-	0x137C,0x139C,0x1BDB,0x1BDA,0x1BFB,0x1C1B,0x243B,0x245B,
-	0x245B,0x247B,0x249B,0x247A,0x1C7A,0x1354,0x0189,0x00C4,
-	0x0128,0x0232,0x0217,0x0177,0x0139,0x097B,0x125B,0x1B1A,
-	0x2357,0x1AF5,0x1AB3,0x2AD3,0x3313,0x3353,0x2353,0x0AF1,
-	0x0290,0x7BEF,0xFDCF,0xFDCE,0xF5AC,0xED6B,0xE509,0xDC87,
-	0xCBE5,0xC364,0xBB03,0xBAE3,0xC2C3,0xCAE3,0xD304,0xD324,
-	0xDB44,0xE3A5,0xE3E5,0xEC26,0xEC46,0xF467,0xF4A6,0xF4A4,
-	0xFCC4,0xFCE4,0xFCE4,0xFCE4,0xF4C5,0xF4C6,0xECE6,0xECE5,
-	0xECC5,0xECA4,0xECA4,0xE4A4,0xE484,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC47,0xDC48,0xDC69,0xE4AB,0xDCAB,
-	0x7901,0x68E0,0x50C1,0x4080,0xF8E3,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE0A2,0x5903,0x40A0,0x50C1,
-	0x6901,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7101,
-	0x58C1,0x40A0,0x9903,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xA8A2,0x40A1,0x48A0,0x58E1,0x7101,0x8141,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,0x99A1,0x9981,
-	0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA1A1,0x8981,0x7961,
-	0x5901,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x50E1,0x5901,0x6941,
-	0x6941,0x5921,0x5101,0x68E2,0xE882,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE0A2,0x69C4,0x5A04,
-	0x6A66,0x72C8,0x72C9,0x6AEA,0x6AEB,0xB985,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF821,0xA9A4,0x6A63,0x8B05,0xB3E6,
-	0xCCA7,0xED6A,0xED8A,0xEDAB,0xF5CC,0xD52C,0xBC8B,0x93A9,
-	0x72E7,0x7AA8,0xE8C2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF903,0x6AC7,0x8B49,0xB42B,0xCC69,0x1359,
-	0x137C,0x137C,0x1BBB,0x1BDB,0x1BFB,0x1C1B,0x1C1B,0x243B,
-	0x245B,0x245B,0x247B,0x249A,0x1C7A,0x1354,0x0189,0x00A4,
-	0x0129,0x0212,0x01F6,0x0177,0x0138,0x097A,0x125B,0x1B3A,
-	0x2358,0x1B15,0x1AD3,0x22D3,0x3313,0x3353,0x2333,0x0AF1,
-	0x0290,0x7BEF,0xFDCF,0xFDCE,0xFDAC,0xF56B,0xE509,0xD487,
-	0xCC06,0xC364,0xBB23,0xBAE3,0xC2C3,0xCAE3,0xD304,0xDB24,
-	0xDB64,0xE385,0xE3C6,0xEC06,0xEC46,0xF467,0xF485,0xF4A4,
-	0xFCC4,0xFCE4,0xFCE4,0xFCC4,0xF4C5,0xF4C6,0xECE6,0xECE5,
-	0xECC5,0xECC5,0xECC4,0xE4A4,0xE484,0xE464,0xE443,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC48,0xDC69,0xE4AB,0xDCAB,
-	0x7901,0x68E1,0x50C0,0x40A0,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xE882,0x58E2,0x40A0,0x50C1,
-	0x6901,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7121,
-	0x58C1,0x48A0,0xA881,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF820,0xB0E3,0x48C1,0x48A0,0x60E1,0x7921,0x8941,0x9181,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,0x99A1,0x9981,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0x9181,0x7961,
-	0x6121,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x50E1,0x6121,0x6941,
-	0x6941,0x5921,0x5101,0x5902,0xD0A2,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE881,0x71A3,0x6204,
-	0x6A66,0x7AC8,0x72E9,0x730B,0x6B0B,0xC1C7,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xB122,0x7263,0x8B04,0xB406,
-	0xCCA8,0xED69,0xED8A,0xEDAB,0xF5CC,0xD52B,0xBCAA,0x93A9,
-	0x7307,0x7A87,0xE8C2,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0x72C7,0x9369,0xB42B,0xCC89,0x1359,
-	0x137C,0x139C,0x1BBB,0x1BDB,0x1BFB,0x23FB,0x1C1B,0x243B,
-	0x245B,0x245B,0x247A,0x249A,0x1C7A,0x1353,0x0188,0x00A4,
-	0x0129,0x0232,0x01F6,0x0178,0x0158,0x099A,0x125C,0x1B1B,
-	0x2378,0x1B15,0x1AD4,0x22D3,0x3313,0x3353,0x2332,0x0AD1,
-	0x0290,0x7BEF,0xFDCF,0xFDCD,0xFDAD,0xF56B,0xE509,0xD488,
-	0xCC06,0xC384,0xC323,0xBAE3,0xC2C3,0xCAE3,0xD304,0xDB24,
-	0xDB64,0xE385,0xE3C6,0xEC06,0xEC46,0xF467,0xF486,0xFCC4,
-	0xFCC4,0xFCE4,0xFCE4,0xFCC4,0xF4C5,0xF4C6,0xECE6,0xECE5,
-	0xECC5,0xECC5,0xECC4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC48,0xDC69,0xE4AB,0xE4CB,
-	0x7901,0x68E1,0x50C0,0x48A0,0xE800,0xF000,0xF000,0xF000,
-	0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,
-	0xF000,0xF000,0xF000,0xF000,0xD020,0x5080,0x48A1,0x58C1,
-	0x7101,0x8121,0x9141,0x9141,0x9141,0x9141,0x8141,0x7101,
-	0x58E1,0x48A0,0xA040,0xF000,0xF000,0xE800,0xF000,0xF000,
-	0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,0xF000,
-	0xF800,0x98A1,0x48A1,0x50C1,0x6901,0x7921,0x8941,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,0x99A1,0x9981,
-	0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0x91A2,0x7962,
-	0x6101,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x5101,0x6121,0x6961,
-	0x7141,0x6121,0x5101,0x50E1,0xC081,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE020,0x7142,0x6203,
-	0x7265,0x82E8,0x8309,0x732A,0x732B,0xB1C7,0xF800,0xF020,
-	0xF020,0xF020,0xF020,0xF000,0xF020,0xF000,0xF000,0xF000,
-	0xF000,0xF000,0xF000,0xF000,0xB101,0x7283,0x9324,0xB406,
-	0xD4C7,0xED69,0xED6A,0xED8A,0xF5AC,0xDD2B,0xBCAA,0x9BE9,
-	0x7B27,0x7A66,0xD881,0xF800,0xF020,0xF020,0xF020,0xF020,
-	0xF020,0xF020,0xF020,0xF020,0xF020,0xF020,0xF020,0xF020,
-	0xF020,0xF020,0xF020,0x7AE8,0x93AA,0xBC6B,0xD48A,0xB46B,
-	0xB449,0xBC29,0xB42A,0xB40A,0xB40A,0xB40A,0xB3EA,0xABE9,
-	0xB3CA,0xABCA,0xABCA,0xB3CA,0x147A,0x1333,0x0168,0x00C4,
-	0x0149,0x32F1,0xBCEC,0xBD4B,0xBD6B,0xBD4A,0xB4C9,0xB46A,
-	0xAC4B,0xB46D,0xB4AE,0x8C0F,0x3313,0x3353,0x2332,0x0AF1,
-	0x0290,0x7BEF,0xFDCF,0xFDCD,0xF5AC,0xF56B,0xE509,0xDCA8,
-	0xCC06,0xC385,0xC323,0xC2E3,0xC2E3,0xCAE3,0xD303,0xDB44,
-	0xDB64,0xE385,0xE3C6,0xEC26,0xEC46,0xF467,0xF486,0xFCC4,
-	0xFCC4,0xFCE4,0xFCE4,0xF4E4,0xF4E5,0xF4C6,0xECE6,0xECE5,
-	0xECC5,0xECC5,0xECA4,0xE4A4,0xE484,0xE464,0xE444,0xDC23,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC48,0xE489,0xE4AB,0xE4AB,
-	0x7921,0x7101,0x58C0,0x48A0,0x7060,0x7060,0x7060,0x6860,
-	0x6860,0x6860,0x6840,0x6840,0x6840,0x6840,0x6860,0x6860,
-	0x6860,0x6860,0x7040,0x7040,0x6860,0x48A0,0x50C0,0x60E1,
-	0x7921,0x8121,0x9141,0x9141,0x9141,0x9141,0x8941,0x7921,
-	0x60E1,0x50C1,0x6080,0x7860,0x7060,0x7060,0x7060,0x7060,
-	0x7060,0x7060,0x7060,0x7060,0x7060,0x7060,0x7060,0x7060,
-	0x7860,0x5880,0x50C1,0x60E1,0x7121,0x8141,0x9161,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,0x99A1,0x9981,
-	0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0x91A2,0x7961,
-	0x6101,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x50E1,0x6121,0x6961,
-	0x6941,0x6121,0x5101,0x50E1,0xC081,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE020,0x7142,0x61E3,
-	0x7285,0x8B28,0x9369,0x8B6B,0x838D,0x82EB,0x9208,0x8A07,
-	0x89E6,0x89C6,0x89C6,0x89A5,0x8984,0x8963,0x8942,0x8941,
-	0x8941,0x8941,0x8941,0x9162,0x81E2,0x82E3,0xA385,0xC446,
-	0xDCC7,0xED69,0xED69,0xED8A,0xF5AC,0xDD4B,0xC4EB,0xA429,
-	0x8B88,0x72E7,0x8A05,0x91C4,0x89C5,0x89E5,0x89E5,0x89E4,
-	0x89C5,0x89C5,0x89E5,0x89C5,0x89C5,0x89C5,0x89C5,0x89C5,
-	0x89C5,0x89C5,0x9A05,0x8B49,0xA40A,0xC4AC,0xDCAA,0xECA6,
-	0xEC83,0xEC63,0xE444,0xE424,0xE424,0xE404,0xDBE4,0xDBC4,
-	0xDBA4,0xDBA5,0xDB85,0xDB65,0x1C79,0x1333,0x0168,0x00A4,
-	0x0149,0x4311,0xFE09,0xFE87,0xFEC7,0xF685,0xEDA3,0xDCC4,
-	0xDC87,0xE4C9,0xE52B,0xAC8E,0x3313,0x3353,0x2332,0x0AD1,
-	0x0290,0x7BEF,0xFDCF,0xFDCD,0xF5AC,0xF56B,0xE509,0xDCA8,
-	0xD406,0xC385,0xC324,0xC2E3,0xC2E3,0xCAE3,0xD303,0xDB44,
-	0xDB64,0xE3A5,0xEBE6,0xEC26,0xEC46,0xF467,0xF485,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xFCC4,0xF4E5,0xF4E6,0xECE6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE484,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC68,0xE48A,0xE4AB,0xE4CB,
-	0x8121,0x7901,0x68E1,0x58C0,0x48A0,0x40A0,0x40A0,0x4080,
-	0x4080,0x4080,0x4080,0x4080,0x4080,0x4080,0x4080,0x4080,
-	0x4080,0x4080,0x4080,0x40A0,0x48A1,0x50A1,0x58E0,0x6901,
-	0x8121,0x8941,0x9141,0x9141,0x9141,0x9141,0x8941,0x8141,
-	0x7101,0x60E1,0x50C1,0x48A1,0x48A1,0x40A1,0x40C1,0x40A0,
-	0x40A0,0x40A0,0x40A0,0x48A0,0x48A1,0x48A1,0x40A0,0x48A1,
-	0x48C1,0x50C1,0x6101,0x7121,0x8141,0x8941,0x9161,0x9961,
-	0x9982,0x9981,0x9181,0x9981,0x9981,0x9981,0x99A2,0xA1A2,
-	0xA1A2,0xA1A1,0xA1A1,0xA1A2,0xA1C2,0xA1C2,0x91A1,0x7961,
-	0x6121,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x50E1,0x5901,0x6941,
-	0x6941,0x6121,0x5101,0x5901,0xC8A2,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE861,0x7162,0x61E3,
-	0x7A85,0x9348,0xA3CA,0xA3EC,0x9C0E,0x840F,0x7BAE,0x736D,
-	0x730B,0x730A,0x72EA,0x6AC9,0x6AA7,0x6A65,0x6A23,0x6A02,
-	0x6A03,0x6A23,0x6A23,0x7263,0x82C3,0x9B44,0xB3E5,0xCC86,
-	0xE4E7,0xED49,0xED69,0xED8A,0xEDAB,0xE58B,0xD52B,0xBCAA,
-	0x9C09,0x8B89,0x7B28,0x7308,0x7308,0x7308,0x7308,0x7308,
-	0x7328,0x7329,0x7328,0x7309,0x7309,0x7308,0x7308,0x7309,
-	0x7308,0x7B08,0x8B69,0xA3EB,0xBC6C,0xD4ED,0xDCEB,0xECC7,
-	0xECA3,0xEC83,0xE444,0xE445,0xE424,0xE404,0xE3E4,0xDBC4,
-	0xDBA4,0xDB84,0xDB84,0xDB85,0x1C5A,0x1333,0x0148,0x00A4,
-	0x0149,0x4311,0xFDE9,0xFE88,0xFEC7,0xF685,0xEDA3,0xE4C3,
-	0xDC86,0xE4C9,0xE50B,0xAC8E,0x3313,0x3354,0x2333,0x0AD1,
-	0x0290,0x7BEF,0xFDCF,0xFDCD,0xF5AC,0xF56B,0xE50A,0xDCA8,
-	0xD427,0xC3A5,0xC324,0xC2E3,0xC2E3,0xCAE3,0xD303,0xDB44,
-	0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC47,0xF467,0xF4A6,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xF4E4,0xF4E5,0xF4E6,0xECE6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC48,0xE48A,0xE4CB,0xE4CB,
-	0x8121,0x7901,0x7101,0x68E1,0x58C1,0x58C1,0x50C0,0x50C0,
-	0x50C1,0x50C1,0x50C1,0x50C0,0x50C1,0x50C1,0x50C1,0x50C1,
-	0x50C1,0x50C1,0x50C0,0x50C1,0x58C1,0x60E1,0x6901,0x7921,
-	0x8141,0x8941,0x9141,0x9141,0x9141,0x9141,0x9141,0x8941,
-	0x7921,0x7101,0x60E1,0x60E1,0x58E1,0x58E1,0x58E1,0x58C1,
-	0x58E1,0x58E1,0x58E1,0x58E1,0x58E1,0x58E1,0x58E1,0x58E1,
-	0x60E1,0x6901,0x7121,0x8141,0x8961,0x9182,0x9161,0x9962,
-	0x9182,0x9161,0x8961,0x8961,0x8161,0x8961,0x8961,0x8961,
-	0x8961,0x8981,0x9181,0x9181,0x91A1,0x91A2,0x8981,0x7961,
-	0x6101,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x50E1,0x5901,0x6941,
-	0x6941,0x5901,0x5101,0x6902,0xE081,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE081,0x6962,0x61E3,
-	0x7A85,0x9B68,0xAC0A,0xB44D,0xB48F,0xA4D1,0x9CB1,0x9450,
-	0x8C0E,0x8BCD,0x8BCD,0x8BAC,0x8B6A,0x8B28,0x8AE5,0x8AA4,
-	0x8AA3,0x8AA3,0x8AC3,0x92E3,0x9B64,0xB3C5,0xC446,0xDCC7,
-	0xED28,0xED48,0xED69,0xED8A,0xED8B,0xEDAC,0xE56C,0xCD0B,
-	0xBCAB,0xAC4A,0x9C0A,0x93CA,0x93CA,0x93EA,0x93CB,0x93EB,
-	0x93EB,0x93EB,0x93EB,0x93EB,0x93CB,0x93CB,0x93CB,0x93CB,
-	0x93CB,0x93EB,0xA42C,0xBC8C,0xCCED,0xDD4E,0xED2C,0xECC7,
-	0xECA3,0xEC83,0xE465,0xE445,0xE424,0xE404,0xE404,0xDBE4,
-	0xDBA4,0xDBA4,0xDB84,0xDB85,0x1C5A,0x1312,0x0147,0x00A4,
-	0x0149,0x4311,0xFDE9,0xFE88,0xFEC7,0xF685,0xEDA3,0xE4C4,
-	0xDC86,0xE4C8,0xE52B,0xACAE,0x2B13,0x3353,0x2333,0x0AD1,
-	0x0290,0x7BEF,0xFDCF,0xFDCE,0xF5AD,0xF56C,0xE52A,0xDCA8,
-	0xCC27,0xC3A5,0xC344,0xC303,0xC2E3,0xCB03,0xD303,0xDB44,
-	0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC47,0xF467,0xF4A6,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xF4E4,0xF4E5,0xF4E6,0xECE6,0xECC5,
-	0xECC5,0xECA4,0xECA4,0xE4A4,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC68,0xE48A,0xE4CB,0xE4AB,
-	0x8921,0x8121,0x7901,0x7901,0x7101,0x6901,0x6901,0x68E1,
-	0x68E1,0x68E1,0x68E1,0x68E1,0x68E0,0x68E0,0x68E0,0x68E0,
-	0x68E0,0x68E1,0x68E1,0x6901,0x70E1,0x7101,0x7901,0x8121,
-	0x8941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9162,
-	0x8941,0x8121,0x7921,0x7121,0x7121,0x7121,0x7121,0x7121,
-	0x7121,0x7121,0x7121,0x7121,0x7121,0x7121,0x7121,0x7121,
-	0x7921,0x7941,0x8141,0x8961,0x9162,0x9982,0x9961,0x9161,
-	0x8961,0x8161,0x7941,0x7941,0x7121,0x7121,0x7921,0x7921,
-	0x7941,0x7941,0x7941,0x8161,0x8161,0x8161,0x7961,0x7141,
-	0x5901,0x48E0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x48E0,0x5901,0x6121,
-	0x6121,0x5901,0x48E1,0x7902,0xF861,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xD0C2,0x6182,0x61E3,
-	0x8285,0xA388,0xBC4A,0xC4CD,0xCD10,0xC573,0xC5B5,0xBD95,
-	0xBD33,0xB4F1,0xB4D1,0xB4B0,0xB46E,0xAC2B,0xABC8,0xAB86,
-	0xAB65,0xAB64,0xB385,0xB3A4,0xBC05,0xCC45,0xDCA6,0xE507,
-	0xED27,0xED48,0xED69,0xED69,0xED8A,0xF5AC,0xEDAC,0xDD6C,
-	0xD52C,0xCD0C,0xC4EC,0xBCCC,0xBCCD,0xBCED,0xBCEE,0xBCEE,
-	0xBCEE,0xBD0E,0xBD0E,0xBCEE,0xBCEE,0xBCEE,0xBCCE,0xBCEE,
-	0xBCCE,0xBCCE,0xC50E,0xD52E,0xDD6F,0xEDAF,0xED6C,0xECE8,
-	0xECA4,0xECA3,0xE465,0xE445,0xE445,0xE425,0xE405,0xDBE4,
-	0xDBC4,0xDBA5,0xDBA5,0xDBA5,0x1C59,0x1312,0x0147,0x0084,
-	0x0149,0x4311,0xFDE9,0xFE88,0xFEC7,0xF686,0xEDA3,0xE4C4,
-	0xDC86,0xDCE8,0xE52B,0xACAE,0x2AF3,0x3333,0x1B12,0x0AD1,
-	0x0270,0x7BEF,0xFDCF,0xFDCE,0xF5AD,0xED8C,0xE52A,0xDCC8,
-	0xD447,0xC3C5,0xC344,0xC303,0xC2E3,0xD304,0xD324,0xDB44,
-	0xDB64,0xE3A5,0xE3E5,0xEC26,0xEC47,0xF467,0xF4A6,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xF4E4,0xF4E5,0xF4E6,0xECE6,0xECC5,
-	0xECC5,0xECC5,0xECA4,0xE4A4,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC68,0xE4AA,0xE4CC,0xE4AB,
-	0x8921,0x8921,0x8121,0x8121,0x7921,0x7921,0x7921,0x7901,
-	0x7901,0x7901,0x7921,0x7921,0x7901,0x7901,0x7901,0x7901,
-	0x7901,0x7901,0x7901,0x7921,0x8121,0x8121,0x8921,0x8941,
-	0x8941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9142,0x8941,0x8941,0x8141,0x8141,0x8141,0x8141,0x8141,
-	0x8141,0x8141,0x8141,0x8141,0x8141,0x8161,0x8941,0x8941,
-	0x8941,0x8941,0x9161,0x9182,0x9981,0x9961,0x9161,0x8941,
-	0x8121,0x7121,0x6901,0x60E1,0x58E1,0x58E1,0x58E1,0x60E1,
-	0x58E1,0x6101,0x6101,0x6121,0x6921,0x7141,0x6941,0x6921,
-	0x5901,0x48C0,0x58A0,0xE000,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE000,0x58A0,0x48E1,0x5101,0x5921,
-	0x5901,0x5101,0x50E1,0xA902,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xB902,0x5982,0x69E2,
-	0x82A4,0xA387,0xC44A,0xD50E,0xD551,0xDDD4,0xDE58,0xDE79,
-	0xDE37,0xD5D5,0xD5B4,0xD593,0xD551,0xCCEE,0xCC8A,0xCC27,
-	0xC3E5,0xCBE5,0xCC05,0xD425,0xD466,0xDCA6,0xE4E7,0xED27,
-	0xED27,0xED48,0xED69,0xED69,0xF58A,0xF58B,0xF5CC,0xEDCC,
-	0xEDAD,0xE58E,0xDDAE,0xDDAE,0xD58F,0xDDB0,0xDDB0,0xDDD0,
-	0xDDD0,0xD5D1,0xD5D1,0xD5D1,0xD5D1,0xD5B0,0xD5B0,0xD5B1,
-	0xD5B0,0xDD90,0xE5B0,0xE5D0,0xEDCF,0xEDCF,0xED6D,0xED08,
-	0xECC4,0xECA3,0xE465,0xE465,0xE445,0xE424,0xE404,0xE3E4,
-	0xDBC4,0xDBC5,0xDBA5,0xDBA5,0x1C39,0x12F2,0x0147,0x00A4,
-	0x0169,0x4311,0xFDE9,0xFE88,0xFEC7,0xF686,0xEDA3,0xE4C4,
-	0xDC66,0xE4C8,0xE52B,0xACAE,0x2B13,0x3333,0x1B12,0x0AB1,
-	0x026F,0x7BEF,0xFDCF,0xFDEE,0xF5CD,0xED8C,0xE52A,0xDCC9,
-	0xD447,0xCBC6,0xC364,0xC324,0xCAE3,0xD304,0xD324,0xDB44,
-	0xDB64,0xE3C5,0xE3E6,0xEC26,0xEC66,0xF467,0xF4A6,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xF4E4,0xF4E5,0xF4E6,0xECE6,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE484,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xDC68,0xE4AB,0xE4EB,0xE4AA,
-	0x8101,0x8901,0x8921,0x8921,0x8921,0x8941,0x8941,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9162,
-	0x9142,0x9141,0x9161,0x9962,0x9162,0x9162,0x9962,0x9162,
-	0x9162,0x9981,0x9961,0x9962,0x9961,0x9981,0x9981,0x9982,
-	0x9961,0x9961,0x9982,0x9982,0x9982,0x9961,0x8961,0x8141,
-	0x7121,0x6101,0x50E1,0x48C1,0x48C0,0x48C1,0x48C1,0x48C0,
-	0x48C0,0x48C0,0x48E1,0x50E1,0x58E1,0x5901,0x5901,0x5901,
-	0x50E1,0x40C0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x40C1,0x48E1,0x5101,
-	0x50E1,0x48E1,0x6101,0xE8C3,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF841,0x9922,0x5982,0x69E2,
-	0x8AA4,0xAB87,0xC46A,0xDD2E,0xDD70,0xEDF4,0xF6D9,0xF75B,
-	0xF73B,0xF6D8,0xEE76,0xEE55,0xEE14,0xEDD1,0xE54D,0xE4E9,
-	0xE4A6,0xE486,0xEC86,0xECA6,0xE4C6,0xE4E6,0xED06,0xED27,
-	0xED27,0xED48,0xED48,0xED69,0xF58A,0xF5AB,0xF5CC,0xF5CD,
-	0xF5ED,0xF60E,0xF64F,0xF650,0xF651,0xF672,0xF672,0xF692,
-	0xF692,0xF6B3,0xF693,0xF693,0xF693,0xF673,0xF673,0xF693,
-	0xF652,0xF652,0xF631,0xF611,0xF5F0,0xEDD0,0xED8D,0xED08,
-	0xECC4,0xECA3,0xE465,0xE464,0xE444,0xE424,0xDC05,0xE404,
-	0xDBC4,0xDBA4,0xDBA5,0xDBA5,0x1C3A,0x12F1,0x0126,0x00A4,
-	0x014A,0x4311,0xFE09,0xFE88,0xFEC7,0xFE85,0xEDC3,0xE4C3,
-	0xDC65,0xE4C8,0xE50B,0xACAE,0x2AF3,0x3333,0x1B12,0x0AB1,
-	0x0270,0x7BEF,0xFDCF,0xFDEE,0xF5CD,0xED8C,0xE52A,0xDCC9,
-	0xD447,0xCBC6,0xC364,0xC324,0xCB03,0xD304,0xD324,0xDB44,
-	0xDB85,0xE3C5,0xE406,0xEC26,0xEC66,0xF487,0xF4A6,0xFCC5,
-	0xFCE4,0xFCE4,0xFCE4,0xFCE4,0xF4E5,0xF4E5,0xECE5,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE484,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC26,0xDC69,0xE4AB,0xE4EB,0xE4AA,
-	0x8921,0x8921,0x8921,0x8920,0x8921,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8941,0x9141,0x8941,0x9141,0x8941,
-	0x8941,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9162,0x9162,0x9162,0x9162,0x9162,0x9162,0x9962,0x9162,
-	0x9161,0x9981,0x9981,0x9962,0x9181,0x9981,0x9982,0x9982,
-	0x9982,0x9982,0x9982,0x9982,0x9981,0x9182,0x8942,0x7121,
-	0x6101,0x50C1,0x48A1,0x40A1,0x40A0,0x40A1,0x40A0,0x40A0,
-	0x40A0,0x40A0,0x40A0,0x40A0,0x48C0,0x48C0,0x48C0,0x48E1,
-	0x48C0,0x40C0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x40C1,0x40C1,0x48E1,
-	0x48E1,0x48E1,0xA944,0xF821,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF082,0x7963,0x5981,0x7202,
-	0x92C4,0xB3A7,0xCC69,0xDCED,0xDD4F,0xE5B2,0xEE97,0xF73B,
-	0xF75C,0xF6FA,0xEE97,0xEE76,0xF655,0xEDF3,0xED8F,0xED2B,
-	0xE4C7,0xE486,0xEC86,0xE4A6,0xE4C6,0xECE7,0xED06,0xED27,
-	0xED27,0xED27,0xED48,0xED69,0xED89,0xEDAB,0xF5AB,0xF5CC,
-	0xF60D,0xF62E,0xF62F,0xF650,0xF651,0xF671,0xF672,0xF692,
-	0xF6B2,0xF6B3,0xF693,0xF693,0xF693,0xF673,0xF673,0xF693,
-	0xF672,0xF652,0xF631,0xF611,0xEDF0,0xEDF0,0xF5AD,0xED29,
-	0xECC4,0xECA3,0xEC65,0xE465,0xE444,0xE425,0xE405,0xE405,
-	0xDBC4,0xDBA4,0xDBA5,0xDBA5,0x1C3A,0x12F1,0x0127,0x00A4,
-	0x016A,0x22B2,0xFE09,0xFE88,0xFEC7,0xFE85,0xEDA4,0xE4C4,
-	0xDC65,0xDCA8,0xE50A,0xA46E,0x2B13,0x3333,0x1B12,0x0AB1,
-	0x0270,0x7BEF,0xFDCF,0xFDEE,0xF5CD,0xED8C,0xE54B,0xDCE9,
-	0xD467,0xCBE6,0xC364,0xC324,0xCB03,0xCB03,0xD344,0xDB44,
-	0xDB85,0xE3C5,0xE406,0xEC46,0xF467,0xF487,0xF4A6,0xFCE5,
-	0xFCE4,0xFD04,0xFD04,0xF4E4,0xF4E5,0xF4E5,0xECE5,0xECC5,
-	0xECC5,0xECA4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC26,0xDC69,0xE4AB,0xE4EB,0xE4AA,
-	0x8121,0x8121,0x8921,0x8921,0x8921,0x8941,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9162,0x9162,0x9161,0x9161,0x9161,0x9162,0x9162,0x9162,
-	0x9162,0x9981,0x9961,0x9962,0x9961,0x9981,0x9981,0x9982,
-	0x9982,0x9961,0x9982,0x9982,0x9981,0x9161,0x8141,0x6901,
-	0x58E1,0x50C1,0x80A1,0xA840,0x9840,0x9840,0x9840,0x9840,
-	0x9840,0x9840,0x9840,0x9840,0xA081,0x68E2,0x40C0,0x40C1,
-	0x40A0,0x38A0,0x50A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x5080,0x38C0,0x40C0,0x40C1,
-	0x40E1,0x7902,0xF082,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xD0E2,0x6142,0x6181,0x7A22,
-	0x9AE4,0xBBA6,0xD469,0xDCEB,0xE54F,0xE591,0xEE35,0xF71A,
-	0xF77C,0xF71A,0xF6B8,0xF677,0xF636,0xEDF4,0xEDB1,0xE54C,
-	0xE4E8,0xE4A7,0xE486,0xE4A6,0xE4C6,0xE4E6,0xED06,0xED27,
-	0xED27,0xED27,0xED48,0xED69,0xED89,0xF58A,0xF5AB,0xF5CC,
-	0xF5ED,0xF60E,0xF64F,0xF62F,0xF650,0xF671,0xF672,0xF692,
-	0xF692,0xF6B3,0xF693,0xF693,0xF693,0xF673,0xF673,0xF693,
-	0xF673,0xF652,0xF631,0xF611,0xEDF0,0xEDF0,0xEDAD,0xED29,
-	0xECC4,0xECA3,0xE485,0xE465,0xE465,0xE445,0xE405,0xE405,
-	0xDBE4,0xDBA4,0xDBA4,0xDBA5,0x1C39,0x12F1,0x0126,0x0084,
-	0x016A,0x0253,0xFE09,0xFE88,0xFEC7,0xFE85,0xEDC4,0xE4C3,
-	0xDC65,0xE4A7,0xE50A,0x7BEF,0x2B13,0x2B12,0x2312,0x0AB1,
-	0x0270,0x7BEF,0xFDEF,0xFDEE,0xF5CD,0xF58C,0xE54B,0xDCE9,
-	0xD468,0xCBE6,0xC384,0xC324,0xCB04,0xD304,0xDB44,0xDB64,
-	0xDB85,0xE3C5,0xEC06,0xEC46,0xF467,0xF487,0xF4C6,0xFCE5,
-	0xFD04,0xFD04,0xF504,0xFCE4,0xF4E5,0xF4E5,0xF4E6,0xECE5,
-	0xECC5,0xECA4,0xE4A4,0xE484,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xE489,0xE4CB,0xE4EC,0xE4AA,
-	0x8101,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9162,0x9161,0x9162,0x9162,0x9162,
-	0x9162,0x9961,0x9982,0x9961,0x9961,0x9981,0x9981,0x9981,
-	0x9981,0x9961,0x9982,0x9982,0x9981,0x9161,0x8141,0x6901,
-	0x50C0,0x48C1,0xA0E2,0xF840,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xE0C3,0x6943,0x38A0,
-	0x38A0,0x38A0,0x58A0,0xE800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE800,0x58A0,0x38C0,0x38C0,0x38C0,
-	0x6963,0xE0C3,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF841,0x9902,0x5961,0x69A2,0x8222,
-	0xA304,0xC3A6,0xD469,0xDCCB,0xE52E,0xE570,0xEDF4,0xF6D9,
-	0xF75C,0xFF3B,0xF6D9,0xEE77,0xEE55,0xEE15,0xEDB2,0xED6E,
-	0xE50A,0xE4A7,0xE485,0xE4A6,0xECC6,0xECE7,0xED26,0xED26,
-	0xED27,0xED27,0xED48,0xED69,0xED89,0xF58B,0xF5AB,0xF5CC,
-	0xF5ED,0xF60E,0xF62F,0xF62F,0xF650,0xF671,0xF672,0xF692,
-	0xF692,0xF693,0xF693,0xF693,0xF693,0xF673,0xF673,0xF693,
-	0xF673,0xF652,0xF651,0xF611,0xEDF0,0xEDEF,0xEDAD,0xED4A,
-	0xECC4,0xECA3,0xE485,0xE485,0xE465,0xE425,0xE425,0xE405,
-	0xDBE5,0xDBC5,0xDBA5,0xDBA5,0x4C15,0x12D1,0x0106,0x00A4,
-	0x016B,0x0253,0xCD2B,0xFE88,0xFEA7,0xF686,0xEDA4,0xE4A3,
-	0xDC64,0xDCA7,0xE50A,0x5B91,0x2B13,0x2B12,0x22F2,0x0AB0,
-	0x026F,0x9C6F,0xFDEF,0xFDEE,0xF5CD,0xF58C,0xE54B,0xDCEA,
-	0xD468,0xCBE6,0xCB85,0xC324,0xCB04,0xD323,0xDB44,0xDB64,
-	0xE385,0xE3C5,0xEC06,0xEC46,0xEC67,0xF487,0xF4C6,0xFCE5,
-	0xFD04,0xFD04,0xF504,0xF505,0xF505,0xF506,0xECE6,0xECE5,
-	0xECE5,0xECC4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC46,0xE489,0xE4EB,0xE4CB,0xE4A9,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9162,0x9161,0x9162,0x9162,0x9162,
-	0x9162,0x9961,0x9981,0x9961,0x9961,0x9982,0x9981,0x9981,
-	0x9981,0x9982,0x9982,0x9982,0x9981,0x9182,0x8141,0x7101,
-	0x58E1,0x48C0,0x58C1,0xE8A2,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE103,0x6923,
-	0x38A0,0x38A0,0x5080,0xE000,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE000,0x50A0,0x38A0,0x38C0,0x7123,
-	0xE104,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE0C2,0x6942,0x6161,0x79E2,0x9282,
-	0xB324,0xC3C5,0xD448,0xDCAA,0xDD0C,0xDD4F,0xE5B2,0xEE77,
-	0xF73B,0xFF5C,0xF6FA,0xF697,0xF676,0xF635,0xEDD3,0xED8F,
-	0xE52B,0xE4C8,0xE4A6,0xE4A6,0xECC6,0xECE7,0xED27,0xED26,
-	0xED27,0xED27,0xED48,0xED68,0xED89,0xED8A,0xEDAB,0xF5EC,
-	0xF5ED,0xF60D,0xF60E,0xF62F,0xF650,0xF651,0xF671,0xF692,
-	0xF692,0xF693,0xF693,0xF693,0xF693,0xF673,0xF673,0xF693,
-	0xF673,0xF652,0xF651,0xF611,0xF5F0,0xEDEF,0xEDAD,0xED4A,
-	0xECC4,0xECA3,0xE4A5,0xEC85,0xE465,0xE445,0xE425,0xE405,
-	0xDBE4,0xE3C5,0xDBA5,0xE3A5,0x4C15,0x12D1,0x0106,0x00A4,
-	0x016B,0x0273,0x5332,0xFE88,0xFEC7,0xF685,0xEDA4,0xE4C3,
-	0xDC64,0xDCA6,0xCCCB,0x2AF4,0x2AF3,0x3313,0x22F2,0x0AB0,
-	0x026F,0xBCF0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE54B,0xDD0A,
-	0xD488,0xCC07,0xC385,0xC344,0xCB24,0xD323,0xDB24,0xDB64,
-	0xE385,0xE3C5,0xE406,0xEC46,0xF467,0xF4A7,0xF4C6,0xFCE5,
-	0xFD04,0xFD04,0xF504,0xF505,0xF505,0xF506,0xF505,0xECE5,
-	0xECE5,0xECC4,0xE4A4,0xE4A4,0xE484,0xE484,0xDC64,0xDC43,
-	0xDC24,0xDC24,0xDC25,0xDC47,0xE4A9,0xE4EC,0xE4EB,0xE489,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9162,0x9162,0x9162,0x9162,0x9162,
-	0x9162,0x9961,0x9981,0x9961,0x9961,0x9982,0x9981,0x9981,
-	0x9981,0x9982,0x9982,0x9982,0x9981,0x9982,0x8961,0x7921,
-	0x6101,0x50C1,0x40C1,0x98E3,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xE8C2,
-	0x8103,0x40C1,0x50A0,0xD820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE020,0x50A0,0x40E1,0x8123,0xE8C3,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0xA143,0x5962,0x69A1,0x8222,0xA2A3,
-	0xBB23,0xCBC5,0xD427,0xDC89,0xDCEC,0xE52E,0xE591,0xEE35,
-	0xF71A,0xF75C,0xF73B,0xEEB8,0xF676,0xEE56,0xEE14,0xEDB1,
-	0xE56D,0xE509,0xECC7,0xE4A6,0xECC6,0xED06,0xED27,0xED26,
-	0xED27,0xED27,0xED48,0xED68,0xED69,0xED8A,0xEDAB,0xF5CC,
-	0xF5CC,0xF5ED,0xF60E,0xF62F,0xF630,0xF650,0xF671,0xF692,
-	0xF692,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF652,0xF651,0xF631,0xF5F0,0xEDEF,0xEDAD,0xED4A,
-	0xECC4,0xECA3,0xE4A5,0xEC85,0xE465,0xE445,0xE425,0xE405,
-	0xDBE5,0xDBC5,0xDBA5,0xE3C5,0x73F1,0x12D1,0x0106,0x00A3,
-	0x016B,0x0254,0x01F6,0x8C4E,0xFEA7,0xF686,0xEDA4,0xE4C3,
-	0xDC64,0xD487,0x4374,0x2AF4,0x2B13,0x2B12,0x22F2,0x0AB0,
-	0x024F,0xBCF0,0xFDEF,0xFDEE,0xF5CD,0xF58C,0xE54B,0xDD0A,
-	0xD488,0xCC27,0xCBA5,0xCB44,0xCB24,0xD323,0xDB44,0xDB64,
-	0xE3A5,0xE3E5,0xEC06,0xEC46,0xEC67,0xF4A7,0xF4C6,0xFCE5,
-	0xFD04,0xFD04,0xF504,0xF505,0xF506,0xF506,0xF506,0xECE5,
-	0xECE5,0xECC4,0xECA4,0xE4A4,0xE484,0xE484,0xE464,0xE443,
-	0xDC24,0xDC24,0xDC25,0xDC67,0xE4CA,0xE50C,0xE4EB,0xE489,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9141,0x9141,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9162,0x9162,0x9162,0x9162,0x9162,
-	0x9962,0x9961,0x9961,0x9961,0x9961,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9982,0x9981,0x9981,0x9982,0x9182,0x8141,
-	0x7101,0x58E1,0x48C0,0x58E2,0xD903,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF861,0xB8C2,0x80E2,0xE040,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xE040,0x80E2,0xB8C2,0xF861,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF820,0xD904,0x6962,0x6182,0x79E2,0x9262,0xAAE3,
-	0xC363,0xD3C5,0xD406,0xDC68,0xDCCB,0xDD0D,0xE570,0xEDD3,
-	0xF6B9,0xF75B,0xFF3B,0xF6D9,0xEE77,0xF676,0xEE35,0xEDF2,
-	0xED8E,0xE52A,0xE4C7,0xE4A6,0xECC7,0xECE7,0xED06,0xED26,
-	0xED27,0xED47,0xED48,0xED68,0xED69,0xF58A,0xF5AB,0xF5CB,
-	0xF5CC,0xF5ED,0xF60E,0xF62E,0xF62F,0xF650,0xF651,0xF692,
-	0xF692,0xF6B2,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF652,0xF651,0xF631,0xF610,0xF5EF,0xF5CE,0xED4A,
-	0xF4C4,0xECA4,0xE4A5,0xEC85,0xE465,0xE445,0xE425,0xE405,
-	0xDBE5,0xDBC5,0xDBC5,0xDBA5,0x9BED,0x12D1,0x0106,0x00A4,
-	0x018B,0x0254,0x0216,0x0177,0x4294,0x9CAD,0xB4CA,0xB449,
-	0x73F1,0x2B98,0x2316,0x2AF5,0x2B13,0x2B12,0x22F2,0x0A90,
-	0x024F,0xFDD0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE56B,0xDD0A,
-	0xD488,0xCC07,0xCBA6,0xCB44,0xCB24,0xD324,0xDB44,0xDB65,
-	0xE3A5,0xE3E5,0xEC26,0xEC66,0xF487,0xF4A7,0xF4C6,0xFCE5,
-	0xFD04,0xFD04,0xF505,0xF4E5,0xF506,0xF506,0xF506,0xECE5,
-	0xECE5,0xECC4,0xECC4,0xE4A4,0xE484,0xE484,0xE464,0xE444,
-	0xDC44,0xDC24,0xDC25,0xDC87,0xE4CA,0xE50C,0xE4CB,0xE488,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9142,0x9142,0x9161,0x9161,
-	0x9161,0x9162,0x9162,0x9162,0x9162,0x9162,0x9162,0x9162,
-	0x9962,0x9962,0x9982,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9982,0x9981,0x9981,0x9982,0x9182,0x8961,
-	0x8141,0x6901,0x58E1,0x48C1,0x8123,0xF8A2,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF841,0xF820,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF000,0xF841,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF882,0x8983,0x5941,0x71A2,0x8A22,0xAA83,0xBB03,
-	0xCB64,0xD3A4,0xD3E6,0xDC47,0xDCAA,0xDD0C,0xDD4F,0xEDB2,
-	0xEE77,0xF73B,0xFF5C,0xF6FA,0xF697,0xF676,0xEE56,0xEE14,
-	0xED90,0xED4C,0xECE8,0xE4A6,0xE4E6,0xECE7,0xED06,0xED26,
-	0xED27,0xED27,0xED48,0xED48,0xED69,0xF589,0xF5AA,0xF5AB,
-	0xF5CC,0xF5ED,0xF60D,0xF60E,0xF62F,0xF650,0xF670,0xF672,
-	0xF692,0xF6B2,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF652,0xF651,0xF611,0xF5F0,0xEDEF,0xEDCE,0xED6B,
-	0xF4E5,0xECC3,0xE4A5,0xEC85,0xE485,0xE465,0xE425,0xE405,
-	0xDBE5,0xDBC5,0xDBC5,0xDBC5,0xDBE7,0x12D1,0x0106,0x00A4,
+	0xC005,0x5FF6,0xAD1B,0x4C53,0x0001,0xDCAC,0xF4ED,0xC007,
+	0xFEB4,0xACAB,0x5A8A,0x0A42,0x0000,0xCBC5,0xC00E,0x028B,
+	0x9CDC,0xEDEC,0xB5EC,0xF5B4,0xEDB4,0xADEA,0xB300,0x8003,
+	0xFCC4,0xC013,0x649E,0x64AB,0xA49B,0x64A4,0x9C9C,0x9C5C,
+	0xA49C,0xADAE,0xA5AC,0xAEAD,0x0005,0x7901,0x68E1,0x50A0,
+	0x4080,0x50A1,0xD861,0x800E,0xF800,0x0005,0xC8A2,0x40A1,
+	0x48A0,0x58E1,0x7101,0x8121,0x8002,0x9141,0x0005,0x8941,
+	0x7921,0x60E1,0x50C1,0x40A0,0xA0C2,0x800D,0xF800,0x0002,
+	0xE882,0x68E2,0x40A0,0xC004,0xE4EC,0xED5B,0x5D00,0x0001,
+	0x58C1,0xD8A3,0x8009,0xF800,0x0005,0xE8C2,0x8144,0x38A0,
+	0x38A0,0x5080,0xE020,0x8006,0xF800,0x0005,0xE000,0x58A0,
+	0x38A0,0x38C0,0x8164,0xF0C2,0x8009,0xF800,0x0009,0xD8E3,
+	0x69C4,0x6A45,0x72C7,0x832A,0x836C,0x7B8D,0x6B4C,0x8289,
+	0xF0A2,0x800D,0xF800,0x000E,0xB163,0x6A43,0x82E4,0xA3A6,
+	0xC488,0xE54A,0xEDAB,0xEDCC,0xF5ED,0xDD6D,0xC4EC,0xA40B,
+	0x8349,0x6AC8,0xD144,0x800E,0xF800,0x0006,0xD8A2,0x7247,
+	0x72A7,0x8B28,0xB3E9,0xCC27,0xEC64,0xC00C,0xA3A4,0x559C,
+	0x9CA4,0x5CA4,0x9C9C,0xA59C,0xEC00,0x000A,0xEC49,0xFE14,
+	0xFF3A,0xFEF8,0xFE30,0xFE09,0xFE88,0xFEC6,0xF665,0xEDA5,
+	0xE4E7,0xC005,0x5EFF,0xAD14,0x5254,0x0001,0xDCAC,0xF4EE,
+	0xC007,0xFDB4,0xACAB,0x5A92,0x0203,0x0000,0xCBC5,0xC00E,
+	0x424C,0x9BDD,0xECEC,0xB5EC,0xF5B4,0xEDB4,0xADF2,0xAB00,
+	0x8003,0xFCC4,0xC013,0x649E,0x64AB,0xA49B,0x64A4,0x9C9C,
+	0x9C5B,0xA59C,0xADAD,0xA6AC,0xAEA5,0x0005,0x7901,0x68E1,
+	0x50A0,0x4080,0x60C1,0xE061,0x800D,0xF800,0x0006,0xF820,
+	0xA8C2,0x40A0,0x48A1,0x6101,0x7921,0x8941,0x8002,0x9141,
+	0x0005,0x8121,0x7101,0x60E1,0x48C1,0x40A1,0xC0A1,0x800D,
+	0xF800,0x0003,0xC0C2,0x48A1,0x40A0,0x50C0,0xC003,0xECA4,
+	0x5C65,0x0001,0x98E2,0xF841,0x8008,0xF800,0x0001,0xE8A2,
+	0x7964,0x8002,0x38A0,0x0001,0x5080,0xE800,0x8006,0xF800,
+	0x0006,0xE800,0x50A0,0x38A0,0x38C0,0x40C1,0x7964,0xF0A2,
+	0x8008,0xF800,0x000A,0xF841,0x9963,0x6205,0x6A86,0x72E8,
+	0x832B,0x7B6C,0x6B6C,0x6ACA,0xD145,0xF820,0x800C,0xF800,
+	0x000F,0xC902,0x6223,0x7AA4,0x9B66,0xBC47,0xDD09,0xEDAB,
+	0xEDAC,0xF5CD,0xE5AD,0xCD2C,0xAC6B,0x8B89,0x6AE7,0xB985,
+	0xF820,0x800D,0xF800,0x0006,0xE882,0x8246,0x72C7,0x8B48,
+	0xB3E9,0xCC48,0xE444,0xC004,0xEB9C,0x9D5C,0x6400,0x8002,
+	0xDBC4,0xC004,0x9C9C,0xA59C,0xEC00,0x000A,0xEC6A,0xFE14,
+	0xFF3A,0xFEF8,0xFE0F,0xFE09,0xFE87,0xFEC6,0xF685,0xEDA4,
+	0xE506,0xC005,0x97B7,0x7553,0x5395,0x0002,0xDCAC,0xECEE,
+	0xFD4F,0xC007,0xB4AC,0xAB9A,0x1242,0x0243,0x0004,0xC344,
+	0xBB03,0xBAC3,0xBAA3,0xCAC3,0xC021,0xEDB4,0xECF5,0xB4ED,
+	0xB4AD,0xF2AB,0xECAC,0x9CA4,0x649D,0x6DA3,0xA49B,0x64A4,
+	0x9C9C,0x9C5B,0xA5A4,0xA5AD,0xA5AE,0xADAD,0x0005,0x7901,
+	0x68E1,0x50C0,0x4080,0x7903,0xF041,0x800D,0xF800,0x0006,
+	0xF820,0x90A2,0x4080,0x50C1,0x6901,0x7921,0x8941,0x8002,
+	0x9141,0x0005,0x8121,0x7101,0x58C1,0x48A1,0x48C1,0xD881,
+	0x800C,0xF800,0x0004,0xF841,0x98C2,0x40A0,0x48C0,0x58C1,
+	0xC003,0xEB65,0x9B65,0x0001,0x88A1,0xB040,0x8002,0xA040,
+	0x8004,0xA840,0x0007,0xB060,0x78E1,0x40C1,0x40C0,0x40A0,
+	0x38A0,0x5080,0xE800,0x8006,0xF800,0x0007,0xE800,0x50A0,
+	0x38C0,0x40C1,0x40C1,0x40E1,0x8903,0xF841,0x8008,0xF800,
+	0x0003,0xC103,0x61C4,0x6245,0x72A7,0xC003,0xFFB6,0x6D4A,
+	0x0001,0xA9C6,0xF841,0x800C,0xF800,0x000F,0xE0C2,0x6A23,
+	0x7283,0x9345,0xB427,0xD4E9,0xEDAB,0xEDAC,0xF5CD,0xEDCD,
+	0xD52C,0xB46B,0x8B89,0x72E7,0xA9C5,0xF820,0x800D,0xF800,
+	0x0008,0xF061,0x9A27,0x72C7,0x8B49,0xB409,0xCC48,0x4BD5,
+	0x4BD6,0x4BD6,0x8002,0x4BF5,0xC008,0xACE5,0xA4AB,0xA4AC,
+	0x9C64,0x8900,0x0003,0x42CD,0x426A,0x428B,0x3AF0,0xC004,
+	0xE795,0x9CAD,0xFC00,0x0000,0x4B94,0xC008,0xE35B,0x9BEC,
+	0xECAD,0x631C,0x9300,0x0001,0x9C6F,0xFDAF,0xC004,0xAB9A,
+	0x1242,0x0B00,0x0000,0xCBE5,0xC026,0x4343,0x9CDC,0xECF5,
+	0xACEC,0xF5F4,0xB5AC,0xADF2,0xEBAC,0xAC9C,0xA464,0xA664,
+	0xA3A4,0x9B64,0xA49C,0x9C9C,0x5BA5,0xA4A5,0xADA5,0xAEAD,
+	0xAD00,0x0005,0x7901,0x68E1,0x50C0,0x4080,0x9923,0xF020,
+	0x800D,0xF800,0x0005,0xF820,0x80C2,0x40A0,0x50C1,0x6901,
+	0x8121,0x8003,0x9141,0x0005,0x8121,0x7101,0x58C1,0x40A1,
+	0x60C2,0xE861,0x800C,0xF800,0x0004,0xF041,0x78E2,0x40A0,
+	0x50C0,0x60E0,0xC003,0xEDA4,0x5B5D,0x8002,0x48C0,0x0001,
+	0x48C1,0x48C1,0x8002,0x48C0,0xC007,0xA5A3,0xE56C,0xA49B,
+	0x6464,0x0001,0x5080,0xE800,0x8006,0xF800,0x0003,0xE800,
+	0x58A0,0x40C0,0x40C0,0x8002,0x48E1,0x0000,0xB923,0x8008,
+	0xF800,0x0009,0xE8C2,0x71C4,0x5A25,0x6A87,0x7AE9,0x7B4B,
+	0x736C,0x6B2C,0x9269,0xF861,0x800C,0xF800,0x000F,0xE861,
+	0x7A03,0x7263,0x8B25,0xB406,0xD4C9,0xED8B,0xEDAB,0xF5CC,
+	0xF5CD,0xD54C,0xB48B,0x93A9,0x72E7,0x9A05,0xF841,0x800D,
+	0xF800,0x0006,0xF820,0xAA07,0x72C7,0x8B49,0xB40A,0xCC48,
+	0x139A,0xC00C,0xA6A4,0xF3AC,0xA4AC,0xECA4,0xACAC,0xA4AB,
+	0x6400,0x0015,0x1375,0x01AA,0x00C5,0x0108,0x01F0,0x01F7,
+	0x0178,0x0139,0x097B,0x125B,0x1B19,0x2337,0x1AF4,0x1AB2,
+	0x2AD3,0x3334,0x3374,0x2333,0x0AF1,0x02B0,0x83F0,0xFDAF,
+	0xC004,0xAB5A,0x5341,0x0B00,0x0000,0xCBE5,0xC026,0x434B,
+	0x94DC,0xECED,0xB4F4,0xEDF4,0xB5B4,0xADEA,0xEBAC,0xAC9C,
+	0xA464,0xA664,0xAB9C,0x9B64,0xA49C,0x9C9C,0x5BA5,0xA4A5,
+	0xADA5,0xAEAD,0xAD00,0x0005,0x7901,0x68E0,0x50C1,0x4080,
+	0xB124,0xF820,0x800D,0xF800,0x0005,0xF041,0x78C2,0x40A0,
+	0x50C0,0x6901,0x8121,0x8003,0x9141,0x0005,0x8141,0x7101,
+	0x58C1,0x40A1,0x70A1,0xE841,0x800C,0xF800,0x0004,0xE861,
+	0x58A1,0x40A0,0x50C0,0x6901,0xC00A,0xECE4,0x645C,0x5B64,
+	0xA5AC,0x9CA4,0xAB00,0x8002,0x5901,0xC005,0xE4A4,0x64A4,
+	0x1B5C,0x0001,0x58A0,0xE800,0x8006,0xF800,0x0002,0xE800,
+	0x58A0,0x40C0,0xC003,0xEDEC,0x9C64,0x0001,0x7143,0xF8A3,
+	0x8007,0xF800,0x0009,0xF841,0x9163,0x5A04,0x6246,0x72A8,
+	0x7B2A,0x734B,0x6B2C,0x7A89,0xE8A2,0x800C,0xF800,0x000F,
+	0xF061,0x89C3,0x6A63,0x8B25,0xB3E7,0xD4C8,0xF58A,0xF5AB,
+	0xEDAC,0xEDED,0xD54C,0xB4AB,0x93C9,0x7308,0x9226,0xF061,
+	0x800D,0xF800,0x0006,0xF820,0xC1C6,0x72C7,0x8B48,0xB40A,
+	0xCC49,0x137A,0xC00C,0xA6AC,0xF3AC,0xA4AC,0xECAC,0xACA4,
+	0xAC9B,0x6400,0x0015,0x1374,0x01AA,0x00C5,0x0108,0x0211,
+	0x0217,0x0177,0x0139,0x099B,0x125B,0x1B1A,0x2357,0x1AF4,
+	0x1AB2,0x2AD3,0x3333,0x3374,0x2353,0x0AF1,0x0290,0x7BEF,
+	0xFDAF,0xC004,0xAA5B,0x534A,0x0200,0x0000,0xCBE5,0xC00F,
+	0x434B,0x93E4,0xE5ED,0xB4EC,0xF5B4,0xF5B4,0xADEB,0xEAAC,
+	0x8002,0xFCE4,0xC013,0x5DA5,0x64AB,0x9C9B,0xA464,0x9C9C,
+	0x9B5C,0xA59C,0xADAE,0xA4AE,0xAEAC,0x0004,0x7901,0x68E0,
+	0x50C1,0x4080,0xC8C3,0x800E,0xF800,0x0005,0xE841,0x68C1,
+	0x40A0,0x50C1,0x6901,0x8121,0x8003,0x9141,0x0005,0x8141,
+	0x7101,0x58C1,0x40A0,0x80A1,0xF020,0x800C,0xF800,0x0004,
+	0xD0A1,0x50A1,0x40A0,0x58E0,0x7101,0xC009,0xECEC,0xAC5C,
+	0x9C64,0xA4AC,0xA4DC,0x8005,0x7941,0x0005,0x7141,0x6921,
+	0x50E1,0x48C0,0x58A0,0xE800,0x8006,0xF800,0x0001,0xE800,
+	0x58A0,0xC005,0x2CED,0xECA4,0x64A4,0x0000,0xB903,0x8007,
+	0xF800,0x0002,0xF820,0xB123,0x59E4,0xC005,0xFDF6,0xFEAE,
+	0x6DC2,0x0000,0xD904,0x800C,0xF800,0x000F,0xF040,0x9983,
+	0x6A63,0x8B05,0xB406,0xCCA8,0xED6A,0xED8B,0xEDAC,0xEDCD,
+	0xD54C,0xBCAB,0x8BA9,0x72E7,0x8A46,0xE861,0x800E,0xF800,
+	0x0005,0xD144,0x72C7,0x8B49,0xB40A,0xCC48,0x137A,0xC00C,
+	0xA6AC,0xF3A3,0xADAC,0xECAC,0xA4AC,0xAC9B,0x5C00,0x000A,
+	0x1354,0x01A9,0x00A5,0x0128,0x0211,0x0217,0x0177,0x0139,
+	0x019B,0x125B,0x1B1A,0xC003,0xF14A,0x92EC,0x0006,0x3313,
+	0x3373,0x2353,0x0AF1,0x0290,0x7BEF,0xFDAF,0xC004,0xAA5B,
+	0x524B,0x0200,0x0000,0xCBE5,0xC00F,0x434B,0x9CDC,0xECED,
+	0xACEC,0xF5B4,0xFDAC,0xEDB3,0xE2AC,0x8002,0xFCE4,0xC013,
+	0x5DA5,0x64AB,0x9C9B,0xA464,0x9C9C,0x9B5C,0xA5A4,0xA5AE,
+	0xA4AE,0xF664,0x0004,0x7901,0x68E0,0x50C1,0x4080,0xF9A6,
+	0x800E,0xF800,0x0005,0xE041,0x58A1,0x40A0,0x50C0,0x68E1,
+	0x8121,0x8003,0x9141,0x0005,0x8141,0x7101,0x58E1,0x40A0,
+	0x90E2,0xF020,0x800C,0xF800,0x0006,0xB8A2,0x48A1,0x40A0,
+	0x58E0,0x7121,0x8141,0x9161,0xC005,0xA464,0x9CAC,0x64A4,
+	0x8002,0x8961,0x8002,0x8981,0xC003,0xE465,0x5B1C,0x0003,
+	0x5901,0x48C0,0x58A0,0xE800,0x8006,0xF800,0x0003,0xE800,
+	0x58A0,0x48E0,0x5901,0xC003,0xECA4,0x5C64,0x0001,0x8102,
+	0xF861,0x8007,0xF800,0x0001,0xD0E3,0x61C4,0xC005,0xBDF5,
+	0xFFAD,0x6D94,0x0000,0xC945,0x800C,0xF800,0x000F,0xF820,
+	0xA1C3,0x7263,0x8B05,0xB406,0xD4A8,0xED8A,0xED8B,0xEDAC,
+	0xF5CC,0xD54C,0xBC8B,0x93A9,0x72E7,0x7A46,0xE881,0x800E,
+	0xF800,0x0005,0xF9A6,0x72C7,0x8B49,0xB42B,0xCC69,0x1379,
+	0xC00C,0xA7AC,0xF3A3,0xADAC,0xECAC,0xA4AC,0xAC9B,0x6400,
+	0x0015,0x1354,0x0189,0x00C4,0x0128,0x0232,0x0217,0x0177,
+	0x0139,0x097B,0x125B,0x1B1A,0x2357,0x1AF5,0x1AB3,0x2AD3,
+	0x3313,0x3353,0x2353,0x0AF1,0x0290,0x7BEF,0xFDCF,0xC004,
+	0xA35A,0x534A,0x4200,0x0000,0xCBE5,0xC00F,0x434B,0x9CDC,
+	0xECED,0xACEC,0xFDB4,0xF5AC,0xEDB3,0xA2EC,0x8002,0xFCE4,
+	0xC013,0x5DA5,0x6CA3,0x9C9B,0xA464,0x9C9C,0x9B5C,0xA5A4,
+	0xA5AE,0xA5AD,0xF664,0x0004,0x7901,0x68E0,0x50C1,0x4080,
+	0xF8E3,0x800E,0xF800,0x0005,0xE0A2,0x5903,0x40A0,0x50C1,
+	0x6901,0x8121,0x8003,0x9141,0x0005,0x8141,0x7101,0x58C1,
+	0x40A0,0x9903,0xF820,0x800B,0xF800,0x0006,0xF820,0xA8A2,
+	0x40A1,0x48A0,0x58E1,0x7101,0x8141,0x8006,0x9981,0xC007,
+	0xAC9C,0xECA4,0xA5A4,0xAC9B,0x0005,0x8981,0x7961,0x5901,
+	0x48E0,0x58A0,0xE800,0x8006,0xF800,0x0009,0xE800,0x58A0,
+	0x50E1,0x5901,0x6941,0x6941,0x5921,0x5101,0x68E2,0xE882,
+	0x8007,0xF800,0x0003,0xE0A2,0x69C4,0x5A04,0x6A66,0xC003,
+	0xFEA5,0x6DA5,0x0001,0xB985,0xF820,0x800B,0xF800,0x000F,
+	0xF821,0xA9A4,0x6A63,0x8B05,0xB3E6,0xCCA7,0xED6A,0xED8A,
+	0xEDAB,0xF5CC,0xD52C,0xBC8B,0x93A9,0x72E7,0x7AA8,0xE8C2,
+	0x800E,0xF800,0x0005,0xF903,0x6AC7,0x8B49,0xB42B,0xCC69,
+	0x1359,0xC00C,0xAFA4,0xF3AC,0xACAC,0xA4EC,0xACA4,0xACAB,
+	0x5C00,0x000A,0x1354,0x0189,0x00A4,0x0129,0x0212,0x01F6,
+	0x0177,0x0138,0x097A,0x125B,0x1B3A,0xC003,0xEA51,0x92E4,
+	0x0006,0x3313,0x3353,0x2333,0x0AF1,0x0290,0x7BEF,0xFDCF,
+	0xC005,0xA39A,0x530A,0x0243,0x0000,0xC364,0xC025,0x5394,
+	0xDCEC,0xEDEC,0xB4ED,0xB5F4,0xB4ED,0xAAAB,0xECAC,0xA49C,
+	0x65A5,0x6CA3,0x9CA4,0xA35C,0x9C9C,0x9B5C,0xA5A4,0xA5AD,
+	0xA6AD,0xF664,0x0004,0x7901,0x68E1,0x50C0,0x40A0,0xF841,
+	0x800E,0xF800,0x0005,0xE882,0x58E2,0x40A0,0x50C1,0x6901,
+	0x8121,0x8003,0x9141,0x0004,0x8141,0x7121,0x58C1,0x48A0,
+	0xA881,0x800C,0xF800,0x0007,0xF820,0xB0E3,0x48C1,0x48A0,
+	0x60E1,0x7921,0x8941,0x9181,0x8005,0x9981,0x0002,0x99A1,
+	0x9981,0xA1A1,0x8002,0xA1A2,0x0007,0xA1C2,0xA1C2,0x9181,
+	0x7961,0x6121,0x48E0,0x58A0,0xE800,0x8006,0xF800,0x0003,
+	0xE800,0x58A0,0x50E1,0x6121,0xC004,0xECA4,0x1C5C,0xE500,
+	0x0000,0xD0A2,0x8007,0xF800,0x0009,0xE881,0x71A3,0x6204,
+	0x6A66,0x7AC8,0x72E9,0x730B,0x6B0B,0xC1C7,0xF820,0x800C,
+	0xF800,0x000E,0xB122,0x7263,0x8B04,0xB406,0xCCA8,0xED69,
+	0xED8A,0xEDAB,0xF5CC,0xD52B,0xBCAA,0x93A9,0x7307,0x7A87,
+	0xE8C2,0x800E,0xF800,0x0005,0xF841,0x72C7,0x9369,0xB42B,
+	0xCC89,0x1359,0xC00C,0xAFAC,0xEBAC,0xACE4,0x6CEC,0xACA4,
+	0xABAC,0x5C00,0x000A,0x1353,0x0188,0x00A4,0x0129,0x0232,
+	0x01F6,0x0178,0x0158,0x099A,0x125C,0x1B1B,0xC003,0xF949,
+	0x93E3,0x0006,0x3313,0x3353,0x2332,0x0AD1,0x0290,0x7BEF,
+	0xFDCF,0xC02C,0xA29C,0x520A,0x0342,0x428B,0x54DC,0xECED,
+	0xECB4,0xEDB5,0xF4B4,0xEDAB,0xF2A4,0xACA4,0x9C65,0xA56C,
+	0xA39C,0xA4A3,0x5C9C,0x9C9C,0x5BA5,0xA4A5,0xADA6,0xADF6,
+	0xAC00,0x0004,0x7901,0x68E1,0x50C0,0x48A0,0xE800,0x800E,
+	0xF000,0x0005,0xD020,0x5080,0x48A1,0x58C1,0x7101,0x8121,
+	0x8003,0x9141,0x0007,0x8141,0x7101,0x58E1,0x48A0,0xA040,
+	0xF000,0xF000,0xE800,0x8009,0xF000,0x0006,0xF800,0x98A1,
+	0x48A1,0x50C1,0x6901,0x7921,0x8941,0x8006,0x9981,0xC008,
+	0xAC9C,0xECA4,0xA5A4,0xACA4,0x1C00,0x0004,0x7962,0x6101,
+	0x48E0,0x58A0,0xE800,0x8006,0xF800,0x0003,0xE800,0x58A0,
+	0x5101,0x6121,0xC004,0xF4DC,0x1C1C,0x9C00,0x0000,0xC081,
+	0x8007,0xF800,0x0009,0xE020,0x7142,0x6203,0x7265,0x82E8,
+	0x8309,0x732A,0x732B,0xB1C7,0xF800,0x8003,0xF020,0x0001,
+	0xF000,0xF020,0x8006,0xF000,0x000F,0xB101,0x7283,0x9324,
+	0xB406,0xD4C7,0xED69,0xED6A,0xED8A,0xF5AC,0xDD2B,0xBCAA,
+	0x9BE9,0x7B27,0x7A66,0xD881,0xF800,0x800E,0xF020,0x0007,
+	0x7AE8,0x93AA,0xBC6B,0xD48A,0xB46B,0xB449,0xBC29,0xB42A,
+	0x8002,0xB40A,0xC005,0x9C63,0xDD64,0xA4E4,0x0006,0x147A,
+	0x1333,0x0168,0x00C4,0x0149,0x32F1,0xBCEC,0xC007,0xBBAC,
+	0x9B43,0x8D5D,0xEEB5,0x0007,0x8C0F,0x3313,0x3353,0x2332,
+	0x0AF1,0x0290,0x7BEF,0xFDCF,0xC004,0xA25B,0x930A,0x4B00,
+	0x0000,0xCC06,0xC026,0x438A,0x94A4,0xE4EC,0xF5AC,0xEDB5,
+	0xFCAC,0xEDAB,0xF2A4,0xACA4,0x64A5,0x9D6C,0xA39C,0xA49B,
+	0x649C,0x9C9C,0x5BA5,0xA4A5,0xADA6,0xF5AE,0xA400,0x0003,
+	0x7921,0x7101,0x58C0,0x48A0,0x8002,0x7060,0x8002,0x6860,
+	0x8003,0x6840,0x8003,0x6860,0x0007,0x7040,0x7040,0x6860,
+	0x48A0,0x50C0,0x60E1,0x7921,0x8121,0x8003,0x9141,0x0005,
+	0x8941,0x7921,0x60E1,0x50C1,0x6080,0x7860,0x800B,0x7060,
+	0x0006,0x7860,0x5880,0x50C1,0x60E1,0x7121,0x8141,0x9161,
+	0x8006,0x9981,0xC008,0xAC9C,0xECA4,0xA5A4,0xACA4,0x1C00,
+	0x0004,0x7961,0x6101,0x48E0,0x58A0,0xE800,0x8006,0xF800,
+	0x0003,0xE800,0x58A0,0x50E1,0x6121,0xC004,0xF49C,0x5C1C,
+	0x9C00,0x0000,0xC081,0x8007,0xF800,0x0009,0xE020,0x7142,
+	0x61E3,0x7285,0x8B28,0x9369,0x8B6B,0x838D,0x82EB,0x9208,
+	0xC007,0x639B,0x9CA4,0x9B9B,0x9B9B,0x8003,0x8941,0x000F,
+	0x9162,0x81E2,0x82E3,0xA385,0xC446,0xDCC7,0xED69,0xED69,
+	0xED8A,0xF5AC,0xDD4B,0xC4EB,0xA429,0x8B88,0x72E7,0x8A05,
+	0xC007,0xD365,0xACA4,0xA39D,0xA4AC,0x8006,0x89C5,0x0005,
+	0x9A05,0x8B49,0xA40A,0xC4AC,0xDCAA,0xECA6,0xC00B,0x999C,
+	0x5D9C,0xA49C,0x5C9C,0x9CA5,0x9C9C,0x0016,0x1C79,0x1333,
+	0x0168,0x00A4,0x0149,0x4311,0xFE09,0xFE87,0xFEC7,0xF685,
+	0xEDA3,0xDCC4,0xDC87,0xE4C9,0xE52B,0xAC8E,0x3313,0x3353,
+	0x2332,0x0AD1,0x0290,0x7BEF,0xFDCF,0xC004,0xA25B,0x930A,
+	0x4B00,0x0000,0xD406,0xC00E,0x038B,0x93A4,0xE4EC,0xF5AC,
+	0xF5F5,0xB4AC,0xEDAA,0xF400,0x8002,0xFCE4,0xC014,0x9C6D,
+	0xA564,0x9BA4,0x9B64,0x9CA4,0x9C9C,0x639D,0xA4A5,0xADAE,
+	0xEEAD,0xAC00,0x0000,0x8121,0xC005,0x5C1C,0x1B1C,0x64A4,
+	0x800B,0x4080,0xC003,0xACE5,0xE4F3,0x0002,0x6901,0x8121,
+	0x8941,0x8003,0x9141,0xC008,0x6464,0x141C,0x1C5C,0xA464,
+	0xAC00,0x8003,0x40A0,0xC006,0xE4A5,0xA463,0xE5AC,0xE400,
+	0x0002,0x6101,0x7121,0x8141,0xC005,0xE4EC,0xE4AD,0xA364,
+	0x8002,0x9981,0xC008,0xADE4,0xA4A3,0xA4A5,0xACA4,0x1B00,
+	0x0004,0x7961,0x6121,0x48E0,0x58A0,0xE800,0x8006,0xF800,
+	0x0004,0xE800,0x58A0,0x50E1,0x5901,0x6941,0xC003,0xA45C,
+	0x1CE4,0x0000,0xC8A2,0x8007,0xF800,0x0008,0xE861,0x7162,
+	0x61E3,0x7A85,0x9348,0xA3CA,0xA3EC,0x9C0E,0x840F,0xC00D,
+	0x4B53,0x8AA3,0x9C5B,0x9A92,0x929B,0xA5AC,0xA4F4,0x0004,
+	0x82C3,0x9B44,0xB3E5,0xCC86,0xE4E7,0xC005,0xFEAC,0xADAD,
+	0x5C0C,0x0003,0xBCAA,0x9C09,0x8B89,0x7B28,0x8004,0x7308,
+	0xC009,0xACA5,0xA39D,0xA4A3,0xA4A5,0xA3E4,0x0005,0x8B69,
+	0xA3EB,0xBC6C,0xD4ED,0xDCEB,0xECC7,0xC00B,0x989C,0x55A5,
+	0x9B9C,0x9C5C,0x9C9C,0xA4A5,0x0016,0x1C5A,0x1333,0x0148,
+	0x00A4,0x0149,0x4311,0xFDE9,0xFE88,0xFEC7,0xF685,0xEDA3,
+	0xE4C3,0xDC86,0xE4C9,0xE50B,0xAC8E,0x3313,0x3354,0x2333,
+	0x0AD1,0x0290,0x7BEF,0xFDCF,0xC014,0xA25B,0x930B,0x4A43,
+	0x0283,0x93A4,0xE4EC,0xF5AC,0xF5B4,0xF5AD,0xECB3,0xEB00,
+	0x8002,0xFCE4,0xC014,0x64A5,0xA564,0x9BA4,0x9B64,0xA49C,
+	0x9C9C,0x639D,0xA4A5,0xADA6,0xF6B5,0xA400,0x0000,0x8121,
+	0xC006,0x5C64,0x5C1C,0xA463,0xA400,0x8002,0x50C1,0x0000,
+	0x50C0,0x8005,0x50C1,0xC004,0xA3A5,0xE4EC,0xEC00,0x0002,
+	0x7921,0x8141,0x8941,0x8004,0x9141,0xC004,0x641C,0x5C1C,
+	0xA400,0x8002,0x58E1,0x0000,0x58C1,0x8007,0x58E1,0x0003,
+	0x60E1,0x6901,0x7121,0x8141,0xC008,0xECED,0x9BE5,0x6C9B,
+	0x64A4,0x6400,0x8003,0x8961,0xC006,0xACE4,0xA4AC,0xA55B,
+	0x1C00,0x0003,0x6101,0x48E0,0x58A0,0xE800,0x8006,0xF800,
+	0x0009,0xE800,0x58A0,0x50E1,0x5901,0x6941,0x6941,0x5901,
+	0x5101,0x6902,0xE081,0x8007,0xF800,0x0005,0xE081,0x6962,
+	0x61E3,0x7A85,0x9B68,0xAC0A,0xC010,0xF7B6,0x365C,0x4B52,
+	0x93A4,0x9B92,0x9291,0x93A3,0xA4AC,0xEC00,0x0004,0x9B64,
+	0xB3C5,0xC446,0xDCC7,0xED28,0xC005,0xACAD,0xADA5,0xAD54,
+	0x0000,0xCD0B,0xC006,0x0C0B,0x1454,0xA4AC,0x9D00,0x8004,
+	0x93EB,0x8004,0x93CB,0x0006,0x93EB,0xA42C,0xBC8C,0xCCED,
+	0xDD4E,0xED2C,0xECC7,0xC00B,0x989C,0x5E9C,0x9B9C,0xA45C,
+	0x94A4,0x9CA5,0x0016,0x1C5A,0x1312,0x0147,0x00A4,0x0149,
+	0x4311,0xFDE9,0xFE88,0xFEC7,0xF685,0xEDA3,0xE4C4,0xDC86,
+	0xE4C8,0xE52B,0xACAE,0x2B13,0x3353,0x2333,0x0AD1,0x0290,
+	0x7BEF,0xFDCF,0xC014,0xA35B,0x9312,0x4203,0x428B,0x939C,
+	0xECE4,0xF5AC,0xF5B4,0xF5AD,0xECB3,0xEB00,0x8002,0xFCE4,
+	0xC014,0x64A5,0xA564,0x9BA4,0x9BA4,0x649C,0x9C9C,0x639D,
+	0xA4A5,0xADAE,0xEEB5,0x9C00,0x0000,0x8921,0xC005,0x645C,
+	0xA464,0x64A4,0x8004,0x68E1,0x8004,0x68E0,0xC007,0xA5A4,
+	0xACDC,0xACE4,0xECEC,0x8004,0x9141,0xC004,0xACA5,0x5B5C,
+	0x6400,0x800C,0x7121,0xC00F,0xE4AC,0xE4EC,0xE5EC,0x9B64,
+	0x6464,0x5CA4,0x5CA4,0xE4A4,0x8002,0x7941,0x8002,0x8161,
+	0x0005,0x7961,0x7141,0x5901,0x48E0,0x58A0,0xE800,0x8006,
+	0xF800,0x0003,0xE800,0x58A0,0x48E0,0x5901,0xC003,0xECA4,
+	0x5C1C,0x0001,0x7902,0xF861,0x8007,0xF800,0x0006,0xD0C2,
+	0x6182,0x61E3,0x8285,0xA388,0xBC4A,0xC4CD,0xC010,0xF77F,
+	0xB65C,0x8A52,0x9C9B,0x9251,0x8992,0x9BA3,0xEDAB,0xFD00,
+	0x0001,0xCC45,0xDCA6,0xC00E,0xFDEC,0xADAD,0xA4AD,0xEE64,
+	0x1454,0x5C5C,0x5CA5,0xAC00,0x8002,0xBCEE,0x0001,0xBD0E,
+	0xBD0E,0x8002,0xBCEE,0xC004,0x9CAC,0x9CA4,0xF400,0x0002,
+	0xD52E,0xDD6F,0xEDAF,0xC00A,0x9180,0x90A3,0x569C,0xA49C,
+	0x9C5B,0x9C00,0x8002,0xDBA5,0x0016,0x1C59,0x1312,0x0147,
+	0x0084,0x0149,0x4311,0xFDE9,0xFE88,0xFEC7,0xF686,0xEDA3,
+	0xE4C4,0xDC86,0xDCE8,0xE52B,0xACAE,0x2AF3,0x3333,0x1B12,
+	0x0AD1,0x0270,0x7BEF,0xFDCF,0xC009,0xA35B,0x5B4A,0x4A43,
+	0x0283,0x939C,0x0000,0xD304,0xC009,0xACEC,0xACF5,0xB4F5,
+	0xADEC,0xB3EB,0x8002,0xFCE4,0xC003,0x64A5,0xA564,0x8002,
+	0xECC5,0xC00D,0x9B64,0x9C9C,0x9C63,0x9DA4,0xA5AD,0xAEF6,
+	0xAE9B,0x0003,0x8921,0x8921,0x8121,0x8121,0x8002,0x7921,
+	0x8002,0x7901,0x0001,0x7921,0x7921,0x8006,0x7901,0xC005,
+	0xACE4,0xA4E4,0xACA4,0x8004,0x9141,0xC004,0xACA4,0x9D63,
+	0xA400,0x8009,0x8141,0x0000,0x8161,0x8003,0x8941,0xC009,
+	0xECAD,0xE39C,0x645C,0x5C24,0x5C5C,0x8002,0x58E1,0xC00A,
+	0xE464,0xECA4,0xACE4,0xEC64,0x9C1C,0x1300,0x0001,0x58A0,
+	0xE000,0x8006,0xF800,0x0001,0xE000,0x58A0,0xC005,0x35EC,
+	0xEC9C,0x649C,0x0001,0xA902,0xF820,0x8007,0xF800,0x0009,
+	0xB902,0x5982,0x69E2,0x82A4,0xA387,0xC44A,0xD50E,0xD551,
+	0xDDD4,0xDE58,0xC021,0xAD92,0x4A9B,0x9B92,0x4988,0x8952,
+	0xE4AC,0xECB5,0xF4F5,0xF4A4,0xADAD,0xA4ED,0xA5B5,0x649D,
+	0x5D6C,0xA45D,0xEDA4,0xACA4,0x8003,0xD5D1,0xC009,0x9BA4,
+	0xA5A3,0xDCEC,0xACE3,0xA48A,0x0000,0xED08,0xC00B,0x909B,
+	0x56A4,0x9C9B,0x9C9C,0x5CA5,0x9CA4,0x0016,0x1C39,0x12F2,
+	0x0147,0x00A4,0x0169,0x4311,0xFDE9,0xFE88,0xFEC7,0xF686,
+	0xEDA3,0xE4C4,0xDC66,0xE4C8,0xE52B,0xACAE,0x2B13,0x3333,
+	0x1B12,0x0AB1,0x026F,0x7BEF,0xFDCF,0xC014,0xAB5B,0x534A,
+	0x4B42,0x434A,0x94D3,0xEDAC,0xECAC,0xFDAD,0xF4B4,0xE5B3,
+	0xEB00,0x8002,0xFCE4,0xC014,0x64A5,0xA564,0x9BA4,0x9B64,
+	0x9CA4,0x9C9C,0x639D,0xA4A5,0xADAE,0xF7B4,0x9300,0x0001,
+	0x8101,0x8901,0x8002,0x8921,0x0002,0x8941,0x8941,0x8921,
+	0x8007,0x8941,0x8002,0x8921,0x8005,0x8941,0x8004,0x9141,
+	0xC013,0xACA5,0x9CA3,0xACE5,0x64A4,0xE464,0xA4EB,0x9CA5,
+	0xA3AC,0xA4A5,0x9BA4,0x8002,0x9982,0xC009,0x9B24,0x5C1C,
+	0x1C1C,0x5CA3,0xA5A4,0x8002,0x48C0,0x0002,0x48E1,0x50E1,
+	0x58E1,0x8002,0x5901,0x0003,0x50E1,0x40C0,0x58A0,0xE800,
+	0x8006,0xF800,0x0002,0xE800,0x58A0,0x40C1,0xC003,0xECEC,
+	0x9C64,0x0001,0x6101,0xE8C3,0x8007,0xF800,0x000B,0xF841,
+	0x9922,0x5982,0x69E2,0x8AA4,0xAB87,0xC46A,0xDD2E,0xDD70,
+	0xEDF4,0xF6D9,0xF75B,0xC021,0x9C89,0x4A9B,0x9391,0x4088,
+	0x919C,0xE4AC,0x6CAC,0xECAD,0xA4AD,0xA4AD,0xEDAD,0xADA5,
+	0xACAD,0xB5A5,0xA5AD,0xA4AC,0xA4AD,0x8002,0xF693,0xC009,
+	0x9CA4,0xAC93,0xA49B,0x9C9B,0x5C91,0x0000,0xED08,0xC00B,
+	0x909B,0x56A3,0x9C9C,0x5DE3,0x549C,0xA5A4,0x0016,0x1C3A,
+	0x12F1,0x0126,0x00A4,0x014A,0x4311,0xFE09,0xFE88,0xFEC7,
+	0xFE85,0xEDC3,0xE4C3,0xDC65,0xE4C8,0xE50B,0xACAE,0x2AF3,
+	0x3333,0x1B12,0x0AB1,0x0270,0x7BEF,0xFDCF,0xC014,0xAB5B,
+	0x534A,0x4B42,0x434A,0x94DB,0xE5AC,0xECB5,0xF4B5,0xECB4,
+	0xEDAB,0xEB00,0x8003,0xFCE4,0xC013,0x65A4,0x649C,0xA49B,
+	0x649C,0xA49C,0x9C63,0x9DA4,0xA5A5,0xB7F6,0xB493,0x8002,
+	0x8921,0x0001,0x8920,0x8921,0x800C,0x8941,0xC006,0x9CAC,
+	0xE464,0xE464,0xA400,0x8004,0x9141,0x0001,0x9161,0x9161,
+	0x8005,0x9162,0xC007,0xE464,0xA3EC,0xA49D,0x6BE4,0x8005,
+	0x9982,0x0003,0x9981,0x9182,0x8942,0x7121,0xC005,0x1C14,
+	0x5C64,0xA3A5,0x8005,0x40A0,0x8002,0x48C0,0x0004,0x48E1,
+	0x48C0,0x40C0,0x58A0,0xE800,0x8006,0xF800,0x0003,0xE800,
+	0x58A0,0x40C1,0x40C1,0x8002,0x48E1,0x0001,0xA944,0xF821,
+	0x8007,0xF800,0x000B,0xF082,0x7963,0x5981,0x7202,0x92C4,
+	0xB3A7,0xCC69,0xDCED,0xDD4F,0xE5B2,0xEE97,0xF73B,0xC00E,
+	0xAD8A,0x499B,0xDB4A,0x8888,0x4893,0xE46C,0xACED,0xAB00,
+	0x8002,0xED27,0xC00F,0xADAD,0xACAE,0xE4AD,0xB5AD,0xA5AD,
+	0xA5AC,0xA5AC,0xACA5,0x8002,0xF693,0xC00A,0x9CA4,0xAC9B,
+	0x9C9B,0x9C5B,0xA4D1,0x4000,0x0000,0xECC4,0xC00A,0x9B96,
+	0x649B,0x9D9C,0xA453,0x9CA5,0xA400,0x0016,0x1C3A,0x12F1,
+	0x0127,0x00A4,0x016A,0x22B2,0xFE09,0xFE88,0xFEC7,0xFE85,
+	0xEDA4,0xE4C4,0xDC65,0xDCA8,0xE50A,0xA46E,0x2B13,0x3333,
+	0x1B12,0x0AB1,0x0270,0x7BEF,0xFDCF,0xC02C,0xAB5B,0x5353,
+	0x4A42,0x4342,0x94DB,0xA4F5,0xE4B5,0xF4B5,0xF4ED,0xACAB,
+	0xF3A3,0xACA4,0x5CA5,0xA464,0x9CA4,0x9B64,0xA49C,0x9C9C,
+	0x639D,0xA4A5,0xA5B7,0xF6B4,0x9300,0x0001,0x8121,0x8121,
+	0x8002,0x8921,0x0001,0x8941,0x8921,0x8009,0x8941,0x0000,
+	0x8921,0x8005,0x8941,0x8005,0x9141,0xC003,0xACA4,0xA5A4,
+	0x8002,0x9161,0x8003,0x9162,0xC00D,0xEB9C,0xA5A3,0xACA4,
+	0xA5A4,0x9BAD,0xA4A3,0x5C1C,0x0004,0x6901,0x58E1,0x50C1,
+	0x80A1,0xA840,0x8007,0x9840,0x0007,0xA081,0x68E2,0x40C0,
+	0x40C1,0x40A0,0x38A0,0x50A0,0xE800,0x8006,0xF800,0x0007,
+	0xE800,0x5080,0x38C0,0x40C0,0x40C1,0x40E1,0x7902,0xF082,
+	0x8008,0xF800,0x000B,0xD0E2,0x6142,0x6181,0x7A22,0x9AE4,
+	0xBBA6,0xD469,0xDCEB,0xE54F,0xE591,0xEE35,0xF71A,0xC006,
+	0xBE8A,0x8A93,0x9352,0x9100,0x0000,0xE54C,0xC006,0x8893,
+	0x9BAC,0xACAC,0xEC00,0x8002,0xED27,0xC00F,0xADAD,0xACE5,
+	0xADAD,0xADAD,0xB59C,0xADAD,0xA5AC,0xA4AD,0x8002,0xF693,
+	0xC00A,0x9CA4,0xAC9C,0x9B9B,0x9C5B,0xA491,0x8000,0x0000,
+	0xECC4,0xC00A,0x9B5E,0x9CA4,0x9C94,0xA45B,0x94A4,0xA500,
+	0x0016,0x1C39,0x12F1,0x0126,0x0084,0x016A,0x0253,0xFE09,
+	0xFE88,0xFEC7,0xFE85,0xEDC4,0xE4C3,0xDC65,0xE4A7,0xE50A,
+	0x7BEF,0x2B13,0x2B12,0x2312,0x0AB1,0x0270,0x7BEF,0xFDEF,
+	0xC02C,0xA35B,0x9313,0x4A43,0x424A,0x8CDC,0xE4F4,0xACAD,
+	0xF4F5,0xB4ED,0xACB3,0xEBAB,0xA464,0xDC65,0xA4A5,0x639C,
+	0x9B64,0x9CA4,0x9C9C,0x639D,0xA4A5,0xADF7,0xB6AD,0x9200,
+	0x0002,0x8101,0x8121,0x8121,0x8003,0x8921,0x8008,0x8941,
+	0x0001,0x8921,0x8921,0x8005,0x8941,0x8005,0x9141,0x8004,
+	0x9161,0x0001,0x9162,0x9161,0x8003,0x9162,0xC003,0xE3AD,
+	0x9BA4,0x8003,0x9981,0xC005,0x9CAD,0xA4A3,0x5C1C,0x0004,
+	0x6901,0x50C0,0x48C1,0xA0E2,0xF840,0x8008,0xF800,0x0001,
+	0xE0C3,0x6943,0x8002,0x38A0,0x0001,0x58A0,0xE800,0x8006,
+	0xF800,0x0001,0xE800,0x58A0,0x8002,0x38C0,0x0001,0x6963,
+	0xE0C3,0x8008,0xF800,0x000D,0xF841,0x9902,0x5961,0x69A2,
+	0x8222,0xA304,0xC3A6,0xD469,0xDCCB,0xE52E,0xE570,0xEDF4,
+	0xF6D9,0xF75C,0xC01F,0xDB4A,0x4A9A,0x9489,0x9048,0x899A,
+	0xADEC,0xADB3,0xA4A5,0xA4AD,0xADAC,0xE6AC,0xADAD,0xADAD,
+	0xA4AD,0xADA5,0xACA4,0x8003,0xF693,0xC00A,0x9CA4,0xAC9C,
+	0x9BA3,0x945B,0xA392,0x8900,0x0000,0xECC4,0xC00A,0x9B5E,
+	0xA49C,0x94A4,0x9C5C,0x9C9C,0xA400,0x0016,0x4C15,0x12D1,
+	0x0106,0x00A4,0x016B,0x0253,0xCD2B,0xFE88,0xFEA7,0xF686,
+	0xEDA4,0xE4A3,0xDC64,0xDCA7,0xE50A,0x5B91,0x2B13,0x2B12,
+	0x22F2,0x0AB0,0x026F,0x9C6F,0xFDEF,0xC02C,0xA35B,0x9313,
+	0x4B42,0x428B,0x4BDC,0xEBED,0xACED,0xB4F5,0xB4AD,0xECB3,
+	0xEBAB,0xA464,0xA5A4,0xA55C,0xA3A4,0x9B5C,0xA49C,0x9C9C,
+	0x639D,0xA4A5,0xADF7,0xBE9C,0x9A00,0x8002,0x8121,0x8003,
+	0x8921,0x8008,0x8941,0x0001,0x8921,0x8921,0x8005,0x8941,
+	0x8005,0x9141,0x8004,0x9161,0x0001,0x9162,0x9161,0x8003,
+	0x9162,0xC004,0xE3AC,0x9CA4,0xAD00,0x8002,0x9981,0x8002,
+	0x9982,0xC003,0xA365,0x1314,0x0003,0x58E1,0x48C0,0x58C1,
+	0xE8A2,0x8009,0xF800,0x0005,0xE103,0x6923,0x38A0,0x38A0,
+	0x5080,0xE000,0x8006,0xF800,0x0005,0xE000,0x50A0,0x38A0,
+	0x38C0,0x7123,0xE104,0x8009,0xF800,0x0007,0xE0C2,0x6942,
+	0x6161,0x79E2,0x9282,0xB324,0xC3C5,0xD448,0xC003,0xFEBE,
+	0xB7FF,0x0001,0xEE77,0xF73B,0xC01F,0xED4A,0x899B,0x934A,
+	0x9048,0x899A,0xA4EC,0xADB4,0xA3A5,0xA4AD,0xACAD,0xA5AD,
+	0xF5A5,0xACA5,0xADAD,0xA5AC,0xADA4,0x8003,0xF693,0xC00A,
+	0x9CA4,0xAC9C,0x9BA3,0x949B,0x6392,0x8900,0x0000,0xECC4,
+	0xC00A,0x9B66,0xDC5C,0x9C9C,0x9C5B,0xDD5C,0xE400,0x0016,
+	0x4C15,0x12D1,0x0106,0x00A4,0x016B,0x0273,0x5332,0xFE88,
+	0xFEC7,0xF685,0xEDA4,0xE4C3,0xDC64,0xDCA6,0xCCCB,0x2AF4,
+	0x2AF3,0x3313,0x22F2,0x0AB0,0x026F,0xBCF0,0xFDEF,0xC02C,
+	0xA35B,0x5B4B,0x5342,0x4342,0x93DC,0xE3E5,0xB4ED,0xB4B5,
+	0xF4ED,0xB4AB,0xEBAB,0xA464,0xA5A4,0xA5A3,0x5CA4,0x9B5C,
+	0xA49C,0xA45C,0x9B9D,0xA4A5,0xAEFE,0xB7A3,0x8A00,0x8002,
+	0x8121,0x8003,0x8921,0x8008,0x8941,0x0001,0x8921,0x8921,
+	0x8005,0x8941,0x8005,0x9141,0x8004,0x9161,0x8005,0x9162,
+	0xC004,0xE3AC,0x9CA4,0xAD00,0x8002,0x9981,0x8002,0x9982,
+	0xC003,0xA3A5,0x1B14,0x0004,0x6101,0x50C1,0x40C1,0x98E3,
+	0xF841,0x8009,0xF800,0x0004,0xE8C2,0x8103,0x40C1,0x50A0,
+	0xD820,0x8006,0xF800,0x0004,0xE020,0x50A0,0x40E1,0x8123,
+	0xE8C3,0x8009,0xF800,0x0007,0xF841,0xA143,0x5962,0x69A1,
+	0x8222,0xA2A3,0xBB23,0xCBC5,0xC004,0xFEFE,0xBFF6,0xBF00,
+	0x0001,0xEE35,0xF71A,0xC01F,0xB69B,0x41D2,0x5C92,0x8950,
+	0x88D2,0x5BEC,0xB4AD,0xA3A5,0xA4AD,0xACA5,0xADAD,0xEDA4,
+	0xADAD,0xADA5,0xACAD,0xADA4,0x8006,0xF693,0xC007,0x9C9B,
+	0xA39C,0x9363,0x9289,0x0000,0xECC4,0xC00A,0x9B66,0xDC5C,
+	0x9C9C,0x9C5C,0x9C9C,0xEC00,0x0016,0x73F1,0x12D1,0x0106,
+	0x00A3,0x016B,0x0254,0x01F6,0x8C4E,0xFEA7,0xF686,0xEDA4,
+	0xE4C3,0xDC64,0xD487,0x4374,0x2AF4,0x2B13,0x2B12,0x22F2,
+	0x0AB0,0x024F,0xBCF0,0xFDEF,0xC018,0xA35B,0x9313,0x5342,
+	0x4B82,0x8B9C,0xE3ED,0xACF5,0xB4ED,0xB4AD,0xF4AB,0xEBAB,
+	0xA464,0xA500,0x8002,0xF506,0xC010,0x5BA4,0x9B9C,0x649C,
+	0xA49C,0x9B5D,0xA4A5,0xB6FF,0xB69B,0x8A00,0x8002,0x8121,
+	0x8003,0x8921,0x8009,0x8941,0x0000,0x8921,0x8005,0x8941,
+	0x8005,0x9141,0x8004,0x9161,0x8004,0x9162,0x0000,0x9962,
+	0x8003,0x9961,0x8004,0x9981,0xC006,0xA5A3,0xA4A5,0x6413,
+	0x1400,0x0003,0x58E1,0x48C0,0x58E2,0xD903,0x800A,0xF800,
+	0x0003,0xF861,0xB8C2,0x80E2,0xE040,0x8006,0xF800,0x0003,
+	0xE040,0x80E2,0xB8C2,0xF861,0x8009,0xF800,0x0008,0xF820,
+	0xD904,0x6962,0x6182,0x79E2,0x9262,0xAAE3,0xC363,0xD3C5,
+	0xC005,0xB5FE,0xBFB6,0xFFFF,0x0001,0xF6B9,0xF75B,0xC01F,
+	0xDC4A,0x4AE3,0x5391,0x8848,0x899B,0xEDAC,0xABAC,0xA5AC,
+	0xA5AC,0xA5ED,0xADAC,0xA5AD,0xADAC,0xA5AD,0xA5B5,0xA4AC,
+	0x8005,0xF693,0xC007,0x9C9B,0xA39C,0x9B9B,0x9B40,0x0000,
+	0xF4C4,0xC00A,0x5C65,0xDC5C,0x9C9C,0x9C5C,0x9CA4,0x9C00,
+	0x000D,0x9BED,0x12D1,0x0106,0x00A4,0x018B,0x0254,0x0216,
+	0x0177,0x4294,0x9CAD,0xB4CA,0xB449,0x73F1,0x2B98,0xC004,
+	0x42DB,0xAAA3,0x5C00,0x0002,0x0A90,0x024F,0xFDD0,0xC019,
+	0xABA3,0x5B5B,0x534B,0x4243,0x8B8A,0x9CE4,0xECAD,0xF4B4,
+	0xF5B4,0xEDAC,0xABEB,0xABA4,0x659C,0x8002,0xF506,0xC010,
+	0x5BA4,0x9BA4,0x5C9C,0xA49C,0x9C64,0x9CA5,0xBEF7,0xB693,
+	0x9100,0x8002,0x8121,0x8003,0x8921,0x800A,0x8941,0x0000,
+	0x8921,0x8004,0x8941,0x8003,0x9141,0x0001,0x9142,0x9142,
+	0x8002,0x9161,0x8006,0x9162,0x0002,0x9962,0x9962,0x9982,
+	0x8006,0x9981,0xC006,0xA5A3,0xA4A5,0x645B,0x5C00,0x0004,
+	0x6901,0x58E1,0x48C1,0x8123,0xF8A2,0x800B,0xF800,0x0001,
+	0xF841,0xF820,0x8006,0xF800,0x0001,0xF000,0xF841,0x800B,
+	0xF800,0x0007,0xF882,0x8983,0x5941,0x71A2,0x8A22,0xAA83,
+	0xBB03,0xCB64,0xC005,0xF4B6,0xFDBF,0xBEB7,0x0002,0xEDB2,
+	0xEE77,0xF73B,0xC01F,0xED4A,0x899B,0x5C92,0x8090,0x8852,
+	0xB4E5,0xABAC,0xA5A4,0xADA4,0xADEC,0xADA5,0xADAD,0xACA5,
+	0xADAD,0xACA6,0xACAC,0x8005,0xF693,0xC007,0x9C9B,0xA394,
+	0x9B63,0x9B89,0x0000,0xF4E5,0xC007,0x5A5E,0xDC64,0x9C94,
+	0x9C5C,0x8002,0xDBC5,0x000C,0xDBE7,0x12D1,0x0106,0x00A4,
 	0x018B,0x0254,0x0216,0x0177,0x0138,0x0979,0x125B,0x1B3C,
-	0x23BB,0x2379,0x2316,0x22F5,0x2B13,0x2B13,0x1AF1,0x0290,
-	0x432F,0xFDD0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE54C,0xDCEA,
-	0xD4A9,0xCC27,0xCBA6,0xCB64,0xCB24,0xD324,0xDB64,0xDB64,
-	0xE3A5,0xE3E5,0xEC26,0xEC66,0xEC87,0xF4A7,0xF4E6,0xFD05,
-	0xFD05,0xFD24,0xFD25,0xF505,0xF506,0xF506,0xF505,0xECE5,
-	0xECC5,0xECC5,0xECC4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,
-	0xDC24,0xE424,0xE425,0xE488,0xE4EB,0xE50C,0xE4CB,0xE468,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9142,0x9142,0x9161,0x9161,
-	0x9161,0x9162,0x9162,0x9162,0x9162,0x9162,0x9162,0x9962,
-	0x9962,0x9962,0x9961,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9982,0x9982,0x9182,
-	0x8961,0x7921,0x60E1,0x50C1,0x48E1,0xA903,0xF841,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF841,0xB123,0x5962,0x6981,0x81E2,0x9A43,0xB2C3,0xC323,
-	0xCB64,0xCB84,0xD3C5,0xD427,0xD489,0xDCEB,0xDD2E,0xED91,
-	0xEE35,0xF6FA,0xFF5C,0xF73B,0xF6B8,0xF677,0xF676,0xEE35,
-	0xEDD1,0xED8D,0xED09,0xE4C7,0xE4E6,0xECE7,0xED06,0xED26,
-	0xED27,0xED47,0xED47,0xED48,0xED68,0xF589,0xF589,0xF5AA,
-	0xEDCB,0xF5EC,0xF60D,0xF60E,0xF62F,0xF630,0xF650,0xF671,
-	0xF692,0xF692,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF652,0xF651,0xF611,0xF5F0,0xEDEF,0xF5CE,0xED6B,
-	0xECE5,0xECC3,0xE4A5,0xEC85,0xEC85,0xE465,0xE445,0xE405,
-	0xE3E5,0xDBC5,0xE3C5,0xDBA5,0xE3E6,0x73D0,0x0106,0x00A3,
-	0x018B,0x0254,0x0216,0x0177,0x0138,0x0179,0x125B,0x1B5C,
-	0x1BBB,0x1B7A,0x1B37,0x2315,0x2B14,0x2B13,0x1AF1,0x0A90,
-	0xA46F,0xFDD0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE54C,0xDD0A,
-	0xD4A9,0xCC27,0xCBA6,0xCB65,0xCB24,0xD324,0xDB64,0xDB84,
-	0xE3A5,0xEBE6,0xEC26,0xEC66,0xF487,0xF4A7,0xFCC6,0xFD05,
-	0xFD25,0xFD25,0xFD25,0xF505,0xF526,0xF526,0xED06,0xED05,
-	0xECE5,0xECE5,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE464,0xE444,
-	0xDC24,0xE424,0xDC45,0xE4A9,0xE50C,0xE50C,0xE4CA,0xE468,
-	0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x9141,0x9141,0x9141,0x9142,0x9142,0x9161,0x9161,
-	0x9161,0x9161,0x9162,0x9162,0x9162,0x9162,0x9162,0x9962,
-	0x9962,0x9962,0x9961,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9982,0x9981,0x9981,0x9982,0x9982,0x9982,
-	0x9161,0x8941,0x7121,0x60E1,0x50C1,0x58E2,0xC903,0xF820,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,
-	0xD103,0x6162,0x6161,0x79C2,0x9222,0xAA83,0xC2E3,0xCB23,
-	0xCB44,0xCB84,0xCBC5,0xD406,0xDC89,0xDCEB,0xDD2D,0xE570,
-	0xEDF4,0xF6D8,0xFF3B,0xFF3B,0xF6F9,0xF697,0xF697,0xEE55,
-	0xEDF2,0xED8F,0xED2B,0xECC8,0xE4C7,0xECE7,0xED06,0xED26,
-	0xED46,0xED47,0xED47,0xED48,0xED68,0xED89,0xF58A,0xF5AA,
-	0xF5AB,0xF5CC,0xF5ED,0xF60D,0xF62F,0xF630,0xF650,0xFE71,
-	0xF691,0xF692,0xF693,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF672,0xF651,0xF631,0xF610,0xF610,0xF5CE,0xF56B,
-	0xF505,0xECC4,0xE4A5,0xECA5,0xEC85,0xE465,0xE445,0xE425,
-	0xE3E5,0xDBE5,0xDBC5,0xDBC5,0xE3E6,0xE50E,0x1147,0x00A3,
-	0x018B,0x0254,0x0216,0x0177,0x0138,0x0179,0x125B,0x1B5C,
-	0x1BBB,0x1B7A,0x1B37,0x2B35,0x2B14,0x2B12,0x1AF1,0x4350,
-	0xFDB0,0xFDD0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE54C,0xDD0A,
-	0xD4A9,0xD448,0xCBC6,0xCB65,0xCB44,0xD324,0xDB64,0xDB84,
-	0xE3A5,0xE3E5,0xEC26,0xEC66,0xF487,0xF4A7,0xFCC6,0xFD05,
-	0xFD05,0xFD24,0xFD05,0xFD05,0xF526,0xF526,0xED06,0xED05,
-	0xED05,0xECE5,0xECC4,0xE4C4,0xE4A4,0xE484,0xE464,0xE444,
-	0xDC24,0xDC25,0xE466,0xE4C9,0xE50C,0xE52C,0xE4C9,0xE468,
-	0x8121,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x9141,0x8941,0x8941,0x9141,0x9142,0x9141,0x9141,0x9162,
-	0x9161,0x9161,0x9161,0x9162,0x9162,0x9162,0x9162,0x9962,
-	0x6101,0x3880,0x3060,0x9982,0x9982,0x9981,0x9981,0x9981,
-	0x9981,0x9982,0x9982,0x9982,0x9982,0x9982,0x9982,0x9981,
-	0x9982,0x9161,0x8141,0x7121,0x60E1,0x50C1,0x6122,0xD924,
-	0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xD924,
-	0x6983,0x6161,0x79A2,0x9202,0xA263,0xBAC3,0xC303,0xCB23,
-	0xCB63,0xCB84,0xD3C4,0xD406,0xD468,0xDCAA,0xDD0C,0xE54F,
-	0xE5B2,0xF657,0xF73A,0xFF5C,0xF71A,0xF6B8,0xF697,0xF676,
-	0xEE14,0xEDD1,0xED6C,0xE509,0xECE7,0xECE7,0xED06,0xED26,
-	0xED27,0xED47,0xED47,0xED48,0xED68,0xED69,0xF589,0xED8A,
-	0xEDAA,0xF5CC,0xF5EC,0xF5ED,0xF60E,0xF62F,0xF630,0xF671,
-	0xF671,0xF692,0xF692,0xF693,0xF693,0xF693,0xF673,0xF693,
-	0xF673,0xF672,0xF651,0xF631,0xF610,0xEDF0,0xF5CE,0xED8B,
-	0xED06,0xECC4,0xECA5,0xE4A5,0xEC85,0xE485,0xE445,0xE405,
-	0xE405,0xDBE4,0xDBC5,0xDBC5,0xE3E6,0xED4F,0xCDD6,0x1105,
-	0x018C,0x0254,0x01F6,0x0177,0x0138,0x099A,0x125B,0x1B3C,
-	0x23BB,0x239A,0x2338,0x2336,0x2B14,0x2B13,0x4351,0xE52F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CD,0xF5AC,0xE54B,0xDD0B,
-	0xD4A9,0xCC48,0xCBC7,0xCB85,0xCB44,0xD344,0xDB44,0xDB64,
-	0xE3A5,0xE3E5,0xEC26,0xEC66,0xF487,0xF4A7,0xF4E6,0xFD05,
-	0xFD04,0xFD24,0xFD25,0xF525,0xF526,0xF506,0xF506,0xED06,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xDC64,0xDC24,0xE466,0xE4CA,0xE52C,0xE50B,0xE4A9,0xE468,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x9141,0x9141,0x9142,0x9141,0x9162,
-	0x9161,0x9161,0x9161,0x9161,0x9162,0x6101,0x3880,0x0820,
-	0x0000,0x0000,0x2060,0x9982,0x9982,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9982,0x9982,0x9982,0x9982,0x9982,0x9982,
-	0x99A2,0x9182,0x8981,0x8141,0x7121,0x60E1,0x50C1,0x6102,
-	0xD104,0xF820,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF820,0xD124,0x6963,
-	0x6141,0x79A2,0x8A02,0xA242,0xB2A3,0xC2E3,0xCB23,0xCB23,
-	0xCB64,0xCB84,0xD3C4,0xD3E5,0xD447,0xDCA9,0xDCEB,0xE54E,
-	0xE591,0xEE35,0xF6F9,0xFF5B,0xFF3B,0xF6D9,0xF697,0xF676,
-	0xF635,0xEDF2,0xED8E,0xED2A,0xECE8,0xECE7,0xED07,0xED26,
-	0xED47,0xED47,0xED47,0xED48,0xED48,0xED68,0xF589,0xF58A,
-	0xEDAA,0xF5CB,0xF5EC,0xF5ED,0xF60E,0xF62E,0xF630,0xF670,
-	0xF671,0xF692,0xF692,0xF693,0xF693,0xF693,0xF673,0xF693,
-	0xF673,0xF672,0xF652,0xF611,0xF610,0xF610,0xF5EF,0xF58C,
-	0xED06,0xECC4,0xECC5,0xE4A5,0xE485,0xE485,0xE465,0xE425,
-	0xE405,0xE3E5,0xE3C5,0xE3C5,0xE3E6,0xF52F,0xFEF9,0xCE17,
-	0x11EC,0x0254,0x0216,0x0197,0x0138,0x0179,0x125B,0x1B5C,
-	0x1BBB,0x239A,0x2358,0x2B36,0x2B34,0x4B72,0xDCEE,0xF56F,
-	0xFDB0,0xFDD0,0xFDEF,0xFDEE,0xF5CD,0xF5AC,0xE56B,0xDD0B,
-	0xD4A9,0xD448,0xCBE7,0xCBA5,0xD344,0xD344,0xDB64,0xDB85,
-	0xE3A5,0xEBE5,0xEC26,0xEC66,0xF487,0xF4A7,0xF4E5,0xFD05,
-	0xF504,0xFD05,0xFD25,0xF525,0xF526,0xF506,0xF506,0xED06,
-	0xED05,0xED05,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xDC64,0xE445,0xE4A7,0xE50B,0xE52C,0xE50A,0xE488,0xE468,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,
-	0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x9142,0x9141,0x9141,0x9141,0x9162,
-	0x9162,0x8941,0x58E1,0x2860,0x0820,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9982,0x9982,0x9981,0x9981,0x9981,
-	0x9981,0x9982,0x9982,0x9982,0x9982,0x9982,0x9982,0x9982,
-	0x9982,0x9982,0x9182,0x8961,0x8161,0x7121,0x60E1,0x50C1,
-	0x5901,0xB903,0xF861,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF861,0xB903,0x6142,0x6141,
-	0x71A2,0x89E2,0xA242,0xB283,0xC2C3,0xC303,0xCB23,0xCB23,
-	0xCB63,0xCB64,0xD3A4,0xD3E5,0xD427,0xDC89,0xDCEB,0xE52D,
-	0xE570,0xEDF3,0xF6B8,0xFF3B,0xF75B,0xF6F9,0xF697,0xF676,
-	0xF656,0xEE13,0xEDB0,0xED4B,0xED08,0xE4E7,0xECE7,0xED27,
-	0xED47,0xED27,0xED47,0xED47,0xED48,0xED68,0xF589,0xF589,
-	0xF5AA,0xF5AB,0xF5CC,0xF5ED,0xF5ED,0xF60E,0xF62F,0xF650,
-	0xF671,0xF672,0xF692,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF672,0xF652,0xF631,0xF610,0xF610,0xF5EF,0xF58C,
-	0xED06,0xECE4,0xECC5,0xE4A5,0xE4A5,0xE485,0xE465,0xE425,
-	0xE425,0xDC05,0xDBE5,0xE3C5,0xE3E6,0xF54F,0xFEFA,0xFF5B,
-	0xEDF3,0x73D0,0x0216,0x0197,0x0138,0x0179,0x125B,0x1B5C,
-	0x1BBB,0x23BA,0x2379,0x3376,0x7BEF,0xD4EC,0xE52E,0xF56F,
-	0xFDB0,0xFDF0,0xFDEF,0xFDEE,0xF5CD,0xF5AC,0xE56B,0xDD2B,
-	0xD4A9,0xD448,0xCBE7,0xCBA5,0xD365,0xDB44,0xDB64,0xDB85,
-	0xE3A5,0xE3E5,0xEC26,0xEC66,0xF487,0xF4A7,0xFCE6,0xFD05,
-	0xFD04,0xFD05,0xFD05,0xF525,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xDC64,0xDC65,0xE4C8,0xED2C,0xED4C,0xE50A,0xE4C9,0xE489,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8101,0x8121,
-	0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x9141,0x9161,0x9141,0x8941,0x58E1,
-	0x2860,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9982,0x9982,0x9981,0x9981,0x9981,
-	0x9981,0x9982,0x9982,0x9982,0x9982,0x99A2,0x99A2,0x99A2,
-	0x9982,0x9982,0x9981,0x9982,0x9161,0x8141,0x7121,0x6101,
-	0x50C1,0x50E1,0x9123,0xF0C3,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xF0C2,0x9943,0x5121,0x6141,0x7181,
-	0x89E2,0xA223,0xB263,0xBAA3,0xC2E3,0xCB03,0xCB23,0xCB23,
-	0xCB44,0xCB64,0xD3A4,0xD3E4,0xD406,0xDC48,0xDCCA,0xE50C,
-	0xE56F,0xE5B2,0xF677,0xF71A,0xF75B,0xF71A,0xF6B8,0xEE96,
-	0xF676,0xEE34,0xEDD2,0xED8D,0xED29,0xED07,0xECE7,0xED06,
-	0xED27,0xED47,0xED47,0xED47,0xED48,0xED48,0xED68,0xF589,
-	0xED8A,0xEDAB,0xF5CC,0xF5EC,0xF60D,0xF60E,0xF62F,0xF650,
-	0xF671,0xF671,0xF692,0xF693,0xF693,0xF693,0xF693,0xF693,
-	0xF673,0xF672,0xF652,0xF631,0xF610,0xF610,0xF5EF,0xF5AC,
-	0xED26,0xECE4,0xECC5,0xECC5,0xE4A5,0xE485,0xE465,0xE445,
-	0xE425,0xDC05,0xE3E5,0xE3C5,0xE406,0xF54F,0xFEF9,0xFF5B,
-	0xFE53,0xFD8A,0xEDAA,0xA4AE,0x7C0F,0x42B5,0x4B35,0x4BB6,
-	0x5BF4,0x7BEF,0xA42C,0xD4A8,0xD4CA,0xD4EC,0xE52E,0xF56F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CD,0xEDAC,0xE56B,0xDD2B,
-	0xDCCA,0xD448,0xCBE7,0xCBA6,0xD365,0xDB44,0xDB64,0xDB85,
-	0xE3C5,0xE3E5,0xEC26,0xEC66,0xECA7,0xF4C7,0xFCE6,0xFD05,
-	0xFD04,0xFD05,0xFD05,0xF525,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xDC64,0xE485,0xE4E9,0xED2C,0xED4C,0xE50A,0xE4C9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8921,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8921,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8941,0x8921,0x8941,0x8941,0x8941,
-	0x8961,0x8941,0x9141,0x8121,0x58E1,0x2860,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1840,0x48C1,0x7921,0x9982,0x9982,0x9981,0x9981,0x9982,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0x9982,0x9982,0x9982,
-	0x9982,0x9982,0xA1A1,0x99A1,0x9981,0x8961,0x8141,0x7121,
-	0x6101,0x50E1,0x48C0,0x7102,0xB8E2,0xF082,0xF820,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF882,0xB8E2,0x7122,0x5101,0x6141,0x7181,0x89C2,
-	0x9A22,0xB263,0xBAA3,0xC2C3,0xCAE3,0xC303,0xCB23,0xCB23,
-	0xCB43,0xCB63,0xD384,0xD3C4,0xD405,0xD447,0xDCA9,0xDCEC,
-	0xE54F,0xE5B1,0xEE15,0xF6D9,0xF73B,0xF73B,0xF6D9,0xF697,
-	0xF676,0xF655,0xEDF2,0xED8E,0xED4B,0xED08,0xED06,0xED26,
-	0xED26,0xED27,0xED47,0xED47,0xED48,0xED48,0xED68,0xF569,
-	0xED8A,0xF5AB,0xEDAB,0xF5CC,0xF5ED,0xF60E,0xF62F,0xF650,
-	0xF670,0xF671,0xF692,0xF693,0xF693,0xF673,0xF693,0xF693,
-	0xF673,0xF672,0xF652,0xF631,0xF610,0xEE10,0xF5EF,0xF5AC,
-	0xED26,0xECE5,0xECC5,0xECA5,0xE4A5,0xE485,0xE465,0xE445,
-	0xE425,0xDBE5,0xE3C5,0xE3C5,0xE406,0xED4F,0xFF19,0xFF3B,
-	0xFE33,0xFD8B,0xFDE9,0xFE68,0xFEC7,0xFE86,0xEDA4,0xE4A3,
-	0xE424,0xDC45,0xDCA6,0xD4A8,0xD4AA,0xD4EC,0xE52E,0xF56F,
-	0xFDB0,0xFDF0,0xFDEF,0xFDEF,0xF5CE,0xED8C,0xE54B,0xDD0B,
-	0xD4AA,0xD468,0xCBE7,0xCBA6,0xD365,0xD364,0xDB64,0xDB84,
-	0xE3C5,0xE405,0xEC46,0xEC66,0xF4A7,0xF4C7,0xFCE5,0xFD05,
-	0xFD05,0xFD25,0xFD25,0xFD26,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xE464,0xE486,0xE50A,0xED4C,0xED2C,0xE4E9,0xE4A9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8921,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8921,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8961,0x9141,0x8961,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0820,0x3080,0x58E1,0x8941,
-	0x9982,0x9982,0x9962,0x9982,0x9982,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9982,0x9982,0x9982,
-	0x9982,0x9982,0x9981,0x99A1,0x9981,0x9981,0x9161,0x8141,
-	0x7941,0x6901,0x5901,0x50E1,0x48C1,0x7902,0xB8E2,0xF082,
-	0xF841,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF841,0xF082,
-	0xB8E3,0x8122,0x50E1,0x5901,0x6141,0x7181,0x89C2,0x9A02,
-	0xAA42,0xBA83,0xC2C3,0xC2C3,0xC2C3,0xC303,0xCB23,0xCB23,
-	0xCB43,0xCB63,0xD384,0xD3C4,0xD3E5,0xD427,0xDC68,0xDCCB,
-	0xE52E,0xE570,0xEDF3,0xF6B8,0xF73B,0xF73B,0xF6FA,0xF6B7,
-	0xEE76,0xF656,0xF613,0xEDD0,0xED4C,0xED29,0xED07,0xED06,
-	0xED26,0xED27,0xED47,0xED47,0xED48,0xED68,0xED68,0xF569,
-	0xF589,0xF5AA,0xF5CB,0xF5CC,0xF5ED,0xF5ED,0xF62E,0xF64F,
-	0xF650,0xF670,0xF671,0xF692,0xF693,0xF673,0xF693,0xF693,
-	0xF693,0xF672,0xF652,0xF631,0xF610,0xEE10,0xF5EF,0xF5AC,
-	0xED26,0xECE5,0xECC5,0xE4C5,0xE4A5,0xE485,0xE465,0xE445,
-	0xE425,0xDBE5,0xE3E5,0xE3C5,0xE406,0xED4F,0xFF19,0xFF3B,
-	0xFE53,0xFD8B,0xFDE9,0xFE68,0xFEA7,0xFE86,0xEDA3,0xE4C3,
-	0xE424,0xE444,0xDC86,0xD4A8,0xCCCA,0xD4EC,0xE52E,0xF56F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEF,0xF5CE,0xED8C,0xED4B,0xDD0B,
-	0xD4AA,0xD468,0xCC07,0xCBA6,0xD365,0xDB64,0xDB64,0xDB84,
-	0xE3C5,0xE405,0xEC26,0xEC66,0xF4A7,0xF4C7,0xFCE5,0xFD05,
-	0xFD05,0xFD25,0xFD25,0xFD26,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xE464,0xE4C7,0xE52B,0xED4C,0xED2B,0xE4E9,0xE4C9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8961,0x9141,0x9141,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x1840,0x40A0,0x7921,0x9161,0x9162,0x9162,0x9162,
-	0x9982,0x9982,0x9182,0x9982,0x9982,0x9981,0x9981,0x9982,
-	0x9981,0x9981,0x9981,0x9981,0x99A1,0x99A2,0x9982,0x99A2,
-	0xA182,0x9982,0x9981,0x99A1,0x99A1,0x9981,0x9982,0x9181,
-	0x8961,0x8141,0x7121,0x6101,0x58E1,0x50C1,0x48E1,0x68E2,
-	0x9903,0xB8A2,0xD861,0xF041,0xF820,0xF800,0xF800,0xF800,
-	0xF800,0xF800,0xF820,0xE841,0xD881,0xB8C2,0x9903,0x6902,
-	0x50E1,0x5101,0x5921,0x6961,0x81A2,0x89C2,0xA222,0xAA42,
-	0xBA62,0xC2A3,0xC2C3,0xC2C3,0xC2C3,0xC303,0xCB23,0xCB23,
-	0xCB63,0xCB64,0xD384,0xD3A3,0xD3E4,0xD406,0xDC48,0xDCAA,
-	0xDD0D,0xE54F,0xE5B2,0xEE56,0xF6FA,0xFF3B,0xFF1A,0xF6D8,
-	0xF697,0xF677,0xF635,0xF5F2,0xED8E,0xED4A,0xED07,0xED07,
-	0xED26,0xD4C9,0x8C2F,0x73D1,0x4B54,0x4B53,0x4B53,0x5372,
-	0x7BEF,0xAC8D,0xE56B,0xF5CB,0xF5EC,0xF5ED,0xF60E,0xF62F,
-	0xF650,0xF650,0xF691,0xF692,0xF693,0xF673,0xF693,0xF693,
-	0xF673,0xF672,0xF652,0xF631,0xF610,0xEE10,0xF5EF,0xF5AC,
-	0xED47,0xED06,0xECC6,0xE4C5,0xECA5,0xE485,0xE465,0xE445,
-	0xE425,0xE3E5,0xE3E5,0xE3E5,0xE406,0xED4F,0xFF19,0xFF5B,
-	0xF632,0xFD8A,0xFDE9,0xFE68,0xFEA7,0xFE86,0xEDA4,0xE4A3,
-	0xE423,0xE444,0xDC85,0xD4A7,0xCCAA,0xD4EC,0xE52E,0xF56F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEF,0xF5CE,0xED8C,0xED4C,0xDD0B,
-	0xDCAA,0xD469,0xD407,0xD3C6,0xD385,0xDB64,0xDB85,0xDB85,
-	0xE3C5,0xE405,0xEC46,0xEC67,0xF4A7,0xF4C7,0xFCE6,0xFD05,
-	0xFD05,0xFD25,0xFD25,0xFD26,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE484,
-	0xE484,0xE4E8,0xE52C,0xE54C,0xE50A,0xE4C8,0xE4A9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8121,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x9141,0x9141,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1020,0x40A0,0x6901,0x8941,0x9162,0x9962,0x9162,0x9962,
-	0x9962,0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9982,0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9981,0x9981,
-	0x9982,0x9981,0x9981,0x9981,0x99A2,0xA1A2,0x9981,0x9981,
-	0x9981,0x9182,0x8161,0x7941,0x6921,0x6101,0x50E1,0x50C1,
-	0x48C1,0x48E1,0x58E1,0x7923,0xA964,0xD124,0xF165,0xF986,
-	0xF165,0xD144,0xA964,0x7922,0x58E1,0x48E1,0x48E1,0x5101,
-	0x5921,0x6941,0x7181,0x81A1,0x91E2,0xA202,0xAA42,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2C3,0xC303,0xCB23,0xCB23,
-	0xCB43,0xD364,0xD384,0xD3A4,0xD3C4,0xD3E5,0xD427,0xDC89,
-	0xDCEC,0xE52E,0xE591,0xEE15,0xF6D9,0xF73B,0xF73B,0xF6D9,
-	0xF697,0xF677,0xF655,0xF5F3,0xF58F,0xED4B,0xE528,0xB48B,
-	0x4B74,0x12B8,0x12B8,0x12B8,0x12B8,0x0AB7,0x1297,0x1297,
-	0x1296,0x0A75,0x1A94,0x6391,0xE58C,0xF5ED,0xF60D,0xF62F,
-	0xF62F,0xF650,0xF671,0xF692,0xF693,0xF673,0xF693,0xF693,
-	0xF673,0xF672,0xF672,0xF631,0xF610,0xF610,0xF5EF,0xEDAC,
-	0xED47,0xED06,0xECE6,0xE4C5,0xECA5,0xE4A5,0xE485,0xE465,
-	0xE425,0xE405,0xE3E5,0xE3E5,0xE406,0xF54F,0xFF1A,0xFF3B,
-	0xFE32,0xFD8A,0xFDE9,0xFE68,0xFEC7,0xFE86,0xEDA4,0xE4A4,
-	0xDC44,0xE444,0xDC65,0xD487,0xCC89,0xD4CC,0xE52E,0xFD8F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CE,0xED8D,0xE54C,0xDD0B,
-	0xDCCA,0xD469,0xCC07,0xCBC6,0xD385,0xDB85,0xDB85,0xDBA5,
-	0xE3C5,0xEC05,0xEC46,0xEC67,0xF4A7,0xF4C7,0xFCE5,0xFD05,
-	0xFD05,0xFD25,0xFD25,0xF526,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xECE5,0xECE4,0xE4C4,0xE4C4,0xE4A4,0xE484,0xE484,
-	0xDCA5,0xE4E9,0xED2C,0xE52B,0xE4E9,0xE4C8,0xE4A9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x9141,0x9141,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x1840,0x40A0,0x7101,0x9962,
-	0x9962,0x9981,0x9982,0x9982,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x9981,0x9981,0x9981,0x9981,0xA1A2,0x9981,0xA1A2,0xA1A2,
-	0xA1A1,0x9981,0x9182,0x8961,0x8141,0x7941,0x6921,0x6121,
-	0x5901,0x5101,0x50E1,0x5101,0x5101,0x5101,0x5101,0x5101,
-	0x5101,0x5101,0x5101,0x5101,0x5101,0x5101,0x5921,0x6141,
-	0x7162,0x81A1,0x89C2,0x9A02,0xA222,0xB242,0xBA62,0xBA62,
-	0xBA83,0xBA83,0xC2A3,0xC2C3,0xC2C3,0xC303,0xCB23,0xCB23,
-	0xCB43,0xD364,0xD384,0xD3A4,0xD3C4,0xD3E5,0xD406,0xDC68,
-	0xDCCB,0xE50D,0xE590,0xEDF3,0xEE97,0xF73A,0xFF5B,0xF71A,
-	0xF698,0xF697,0xF676,0xF613,0xF5B0,0xED6C,0x7C0F,0x12F8,
-	0x12D8,0x12B8,0x12B8,0x12B8,0x12B8,0x12B7,0x0A97,0x0A97,
-	0x1296,0x0A75,0x0A55,0x1255,0x1A53,0xACAE,0xF5ED,0xF60E,
-	0xF62F,0xF650,0xF671,0xF692,0xF693,0xF672,0xF692,0xF693,
-	0xF673,0xF672,0xF672,0xF631,0xF630,0xF610,0xF5EF,0xF5CC,
-	0xED48,0xED06,0xECE6,0xE4C5,0xE4C5,0xE4A5,0xE485,0xE465,
-	0xE445,0xE405,0xE405,0xE3E5,0xE406,0xF56F,0xFF1A,0xFF3B,
-	0xFE32,0xFD8A,0xFDC9,0xFE68,0xFEA7,0xFE86,0xEDA4,0xE4A3,
-	0xDC44,0xDC44,0xDC65,0xD487,0xCC89,0xD4CB,0xE52E,0xFD8F,
-	0xFDD0,0xFDF0,0xFE0F,0xFDEE,0xF5CE,0xED8D,0xE54C,0xDD0B,
-	0xDCCA,0xD469,0xCC28,0xD3C7,0xD385,0xDB85,0xDB85,0xE3A5,
-	0xE3C5,0xEC05,0xEC46,0xEC67,0xF4A7,0xF4C7,0xFCE5,0xF525,
-	0xFD05,0xFD25,0xFD25,0xF526,0xF526,0xF506,0xED06,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4C4,0xE4A4,0xE484,0xE464,
-	0xE4C6,0xED0A,0xED4C,0xED2B,0xE4E9,0xE4C9,0xE4A9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8121,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x9141,0x9161,0x60E1,0x4080,0x1020,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x2840,0x58C1,0x7941,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x9981,0x9981,0x9981,0x9981,0xA1A2,0x9981,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A2,0xA1A1,0x99A2,0x9181,0x8981,0x8161,0x7961,
-	0x7141,0x6941,0x6941,0x6121,0x6941,0x6941,0x6941,0x6941,
-	0x6941,0x6941,0x6941,0x6941,0x6941,0x6961,0x7161,0x79A2,
-	0x89C2,0x99E2,0xA202,0xAA22,0xB242,0xB242,0xBA62,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xCB03,0xCB23,
-	0xCB23,0xD364,0xD384,0xD384,0xD3C3,0xD3C5,0xD406,0xDC48,
-	0xDCAA,0xE50C,0xE56F,0xE5B2,0xEE56,0xF6F9,0xF73B,0xF71A,
-	0xF6B8,0xF697,0xF677,0xF655,0xF5F2,0x6390,0x12B5,0x12F8,
-	0x12D8,0x12D8,0x12B8,0x12B8,0x12B8,0x0AB8,0x12B7,0x0A97,
-	0x1296,0x0A76,0x0A75,0x0A55,0x0A34,0x0A33,0x9C6F,0xF60E,
-	0xF62F,0xF64F,0xF670,0xF672,0xF692,0xF692,0xF692,0xF693,
-	0xF673,0xF672,0xF672,0xF631,0xF630,0xF610,0xF5EF,0xF5CC,
-	0xED48,0xED06,0xECC6,0xECC5,0xECC5,0xE4A5,0xE485,0xE465,
-	0xE445,0xE405,0xE3E5,0xE3E5,0xEC06,0xF56F,0xFEFA,0xFF3B,
-	0xFE32,0xFD8A,0xFDE9,0xFE68,0xFEC7,0xFE86,0xEDA4,0xE4A4,
-	0xDC43,0xE444,0xDC65,0xD466,0xCC89,0xD4CB,0xE52E,0xFD8F,
-	0xFDD0,0xFDF0,0xFE0F,0xFDEE,0xF5CE,0xED8D,0xE54C,0xDD0B,
-	0xDCCA,0xD469,0xD428,0xD3E7,0xD3A6,0xDB85,0xDB85,0xE3A5,
-	0xE3C5,0xEC05,0xEC46,0xEC67,0xF4A7,0xF4C7,0xFCE5,0xFD05,
-	0xFD05,0xFD25,0xFD25,0xF526,0xF526,0xF506,0xED05,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4C4,0xE4A4,0xE484,0xE484,
-	0xE4C7,0xED2B,0xED4C,0xE509,0xE4E8,0xE4C9,0xE4A9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8121,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x9141,0x9141,0x9162,0x9141,0x9141,0x7921,0x58E1,
-	0x3081,0x0820,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9981,0x99A2,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0x99A1,0x91A2,0x91A2,
-	0x8981,0x8181,0x8181,0x8181,0x81A1,0x81A1,0x81A1,0x81A1,
-	0x81A1,0x81A1,0x81A2,0x81A2,0x81A2,0x89A2,0x91C2,0x99E2,
-	0xA202,0xAA22,0xB242,0xB242,0xB242,0xB242,0xBA62,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xCB03,0xCB23,
-	0xCB23,0xD364,0xD384,0xD383,0xD3A3,0xD3C4,0xD3E5,0xDC27,
-	0xDC89,0xE4EC,0xE52E,0xE591,0xEE14,0xF6B8,0xF73A,0xF73B,
-	0xF6D9,0xF697,0xF697,0xF676,0xACD1,0x122F,0x1294,0x12D7,
-	0x12D8,0x12D9,0x1AD7,0x4354,0x7BEF,0x840F,0x7BEF,0x7BEF,
-	0x4353,0x1AB5,0x0A75,0x1255,0x0A34,0x0A33,0x1A52,0xD58E,
-	0xF62E,0xF62F,0xF650,0xF671,0xF692,0xF692,0xF692,0xF673,
-	0xF673,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5CD,
-	0xF548,0xED06,0xECE6,0xECE5,0xECC5,0xE4A5,0xE485,0xE465,
-	0xE445,0xE405,0xE405,0xE3E5,0xEC06,0xED4F,0xFEF9,0xFF3B,
-	0xFE32,0xFD8A,0xFDE9,0xFE68,0xFEA7,0xFE86,0xEDA4,0xE4A4,
-	0xE444,0xE444,0xDC64,0xD466,0xCC88,0xD4AB,0xE52E,0xFD90,
-	0xFDD0,0xFDF0,0xFE0F,0xFDEF,0xF5CE,0xED8D,0xE54C,0xDD2B,
-	0xDCCA,0xD489,0xD428,0xD3E7,0xD3A6,0xDB85,0xDBA5,0xE3A5,
-	0xE3C5,0xEC06,0xEC46,0xEC67,0xF4A7,0xF4C7,0xFCE5,0xFD05,
-	0xFD05,0xFD25,0xFD26,0xF526,0xF526,0xF506,0xED05,0xED05,
-	0xED05,0xED05,0xECE4,0xE4C4,0xE4C4,0xE4A4,0xE484,0xE485,
-	0xE4E8,0xED2B,0xED4B,0xE508,0xE4E8,0xE4C9,0xECA9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8121,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8961,0x8961,0x8961,0x9161,0x9161,0x9161,0x9161,0x9162,
-	0x9161,0x9162,0x7901,0x50C1,0x2860,0x0820,0x0000,0x0000,
-	0x0000,0x0000,0x2840,0x9981,0x9981,0x9981,0x9982,0x9982,
-	0x9981,0x9981,0x9981,0x9981,0x99A1,0x9981,0x99A2,0x99A2,
-	0x99A2,0x99A2,0x9981,0x9981,0x9981,0x9981,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C1,0xA1C2,
-	0x99C2,0x99C2,0x99C2,0x99C2,0x99E2,0x99C1,0x99E2,0x99E2,
-	0x99E2,0x99E2,0x99E1,0x99E2,0x99E2,0xA1E2,0xA202,0xAA22,
-	0xB242,0xB242,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xC283,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xCB03,0xCB23,
-	0xCB43,0xCB43,0xD364,0xCB84,0xD3C4,0xD3C4,0xD3E5,0xD427,
-	0xDC68,0xDCCA,0xE52D,0xE570,0xEDD3,0xF697,0xF71A,0xF73B,
-	0xF71A,0xF6B8,0xF697,0xE635,0x1A0B,0x122E,0x1292,0x12D6,
-	0x3336,0xA46C,0xED47,0xED47,0xED47,0xED47,0xED47,0xED68,
-	0xED68,0xE549,0x8C2F,0x1A94,0x1255,0x0A34,0x0A13,0x6370,
-	0xF60E,0xF62E,0xF650,0xF671,0xF692,0xF692,0xF692,0xF693,
-	0xF673,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5CD,
-	0xED69,0xED06,0xECE5,0xECE5,0xE4C5,0xE4A5,0xE485,0xE485,
-	0xE445,0xE405,0xE405,0xE405,0xEC26,0xED6F,0xFEF9,0xFF3B,
-	0xFE32,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,0xE4A4,
-	0xE444,0xE444,0xDC44,0xD466,0xCC88,0xD4AB,0xE52E,0xFD90,
-	0xFDD0,0xFDF0,0xFDF0,0xFDEF,0xF5CE,0xED8D,0xE54C,0xDD2B,
-	0xDCCA,0xD48A,0xD429,0xD3E7,0xD3A6,0xDB85,0xDBA5,0xE3A5,
-	0xE3C5,0xEC06,0xEC46,0xEC86,0xF4A6,0xFCC7,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF526,0xF506,0xED25,0xED05,
-	0xED05,0xECE5,0xECE4,0xE4C4,0xE4C4,0xE4A4,0xE484,0xE4A5,
-	0xE529,0xED4C,0xED2B,0xE508,0xE4E7,0xE4C9,0xECA9,0xE4A9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8961,0x8961,0x9161,0x9161,0x9161,0x9161,0x9162,
-	0x9162,0x8121,0x58C1,0x2860,0x0820,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9981,0x99A2,0x99A2,
-	0x99A2,0x9981,0x9981,0x9981,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C1,0xA9E2,
-	0xA9E2,0xA9E2,0xAA02,0xAA02,0xB222,0xB222,0xB222,0xB222,
-	0xB242,0xB242,0xB222,0xB222,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB262,0xBA62,0xBA62,
-	0xBA82,0xC283,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xCB03,0xCB23,
-	0xCB23,0xD343,0xD364,0xD383,0xD3A4,0xD3C4,0xD3C4,0xD406,
-	0xDC48,0xDCA9,0xE50C,0xE56F,0xEDB2,0xF655,0xF6D9,0xFF3B,
-	0xFF1A,0xF6D8,0xF697,0x9C91,0x09AA,0x0A0D,0x1271,0x2AF4,
-	0xDD09,0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,0xED48,
-	0xF568,0xED68,0xED89,0xC50C,0x0A55,0x1234,0x0A33,0x0A12,
-	0xD58E,0xF60E,0xF64F,0xF670,0xF671,0xF672,0xF672,0xF693,
-	0xF673,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5CD,
-	0xED69,0xED26,0xECE5,0xECE5,0xECE5,0xE4A6,0xE485,0xE485,
-	0xE445,0xE425,0xE405,0xE405,0xE406,0xED6F,0xFEF9,0xFF3A,
-	0xFE32,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,0xE4C4,
-	0xE444,0xE444,0xDC44,0xD445,0xCC67,0xD4AA,0xE52E,0xFD8F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CE,0xED8D,0xE54C,0xDD2B,
-	0xDCCB,0xD48A,0xD429,0xD3E7,0xD3C6,0xDB85,0xDBA5,0xE3A5,
-	0xE3C5,0xE406,0xEC46,0xF486,0xF4A6,0xFCC7,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF526,0xF506,0xED25,0xED25,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE484,0xE4C6,
-	0xE52A,0xED4C,0xE52A,0xE4E7,0xE4C7,0xE4C9,0xECA9,0xE4A9,
-	0x78E1,0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8961,0x8961,0x9161,0x9161,0x8941,0x60E1,0x4080,
-	0x1020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2840,0x9981,0x9982,0x9982,0x9982,0x9982,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9981,0x99A2,0x99A2,
-	0x99A2,0x99A2,0x9981,0x9981,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,0xA9C2,
-	0xA9E2,0xA9E2,0xAA02,0xAA02,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB222,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xCB03,0xCB03,
-	0xCB23,0xCB43,0xCB64,0xCB83,0xD3A4,0xD3A4,0xD3C4,0xD3E5,
-	0xDC27,0xDC89,0xE50B,0xE54E,0xE591,0xEDF4,0xF6B8,0xF73A,
-	0xFF3A,0xFEF9,0xF6B7,0x530D,0x0989,0x09EB,0x0A2F,0xAC8E,
-	0xED49,0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xF568,0xED68,0xED89,0xF569,0x73D1,0x0A54,0x0A34,0x0A13,
-	0x944F,0xF60E,0xF62F,0xF670,0xF671,0xF672,0xF692,0xF693,
-	0xF673,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5CD,
-	0xED69,0xED27,0xECE6,0xECE6,0xECE5,0xE4C6,0xE486,0xE465,
-	0xE445,0xE425,0xE425,0xE405,0xEC26,0xF56F,0xFEF9,0xFF1A,
-	0xFE11,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,0xE4C4,
-	0xE443,0xE444,0xDC44,0xD445,0xCC67,0xD4AA,0xE52E,0xFD8F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CD,0xED8D,0xE54C,0xDD0B,
-	0xDCCA,0xD48A,0xD449,0xD407,0xDBC6,0xDB85,0xDBA5,0xE3C5,
-	0xE3C5,0xE406,0xEC46,0xEC86,0xF4A6,0xFCC7,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF526,0xF506,0xED25,0xED25,
-	0xED05,0xECE4,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE4A4,0xE4E7,
-	0xED4B,0xED4C,0xE509,0xE4C7,0xE4C7,0xECA9,0xECA9,0xE4A9,
-	0x78E1,0x7901,0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8961,0x9161,0x40A0,0x2040,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1840,
-	0x4080,0x7121,0x9982,0x9981,0x9982,0x9982,0x9981,0x99A2,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x9981,0x99A2,0x99A2,
-	0xA1A2,0x99A2,0x99A2,0x99A2,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A2,0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA9C1,
-	0xA9E2,0xA9E2,0xAA02,0xB222,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB262,0xB262,0xB262,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,0xCB03,
-	0xCB23,0xCB43,0xD363,0xD384,0xD3A4,0xD3A3,0xD3C4,0xD3E5,
-	0xD426,0xDC68,0xE4EB,0xE52D,0xE58F,0xE5D3,0xF677,0xF71A,
-	0xFF3B,0xF6F9,0xF6B8,0x220A,0x0969,0x09CB,0x1A4E,0xED8D,
-	0xED49,0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED67,0xED68,0xED68,0xF589,0xC50C,0x0A55,0x0A34,0x0A13,
-	0x6390,0xF5EE,0xF62F,0xF650,0xF671,0xF672,0xF673,0xF693,
-	0xF673,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5CD,
-	0xED89,0xED27,0xECE6,0xECE5,0xECE5,0xECC6,0xE4A6,0xE485,
-	0xE445,0xE425,0xE425,0xE405,0xEC26,0xED6F,0xFEF9,0xFF1A,
-	0xFE11,0xFD8A,0xFDC9,0xFE49,0xFEA7,0xFE66,0xEDA4,0xE4C4,
-	0xDC43,0xE444,0xDC44,0xD445,0xCC47,0xD4AA,0xE52E,0xFD90,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CD,0xED8D,0xE56C,0xDD2B,
-	0xDCEB,0xD48A,0xD449,0xD408,0xD3C6,0xDBA5,0xE3A5,0xE3C5,
-	0xE3C5,0xE406,0xEC46,0xF486,0xF4A7,0xFCE6,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF526,0xF506,0xED25,0xED25,
-	0xED05,0xECE4,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE4A5,0xE508,
-	0xED6C,0xED4B,0xECE8,0xE4C7,0xE4C8,0xECC9,0xECA9,0xE4A9,
-	0x7901,0x78E1,0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x8961,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8961,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x1840,0x40A0,0x6901,0x8961,0x9182,
-	0x9182,0x9982,0x9981,0x9982,0x9982,0x9982,0x9981,0x99A1,
-	0x99A1,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A2,0x99A2,
-	0xA1A2,0x99A2,0x99A2,0x99A2,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A2,0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA9C2,
-	0xA9E2,0xB202,0xAA02,0xB222,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xBA82,
-	0xBA83,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,0xCB04,
-	0xCB23,0xD343,0xD364,0xD384,0xD3A4,0xD3A3,0xD3C4,0xD3E5,
-	0xD406,0xDC47,0xDCCA,0xE52C,0xE56F,0xE5B1,0xEE35,0xF6D9,
-	0xF73A,0xFF1A,0xF6D8,0x0968,0x0969,0x09AA,0x430E,0xF5AE,
-	0xED6A,0xED48,0xED47,0xED67,0xED47,0xED47,0xED47,0xED47,
-	0xED67,0xED68,0xED68,0xF569,0xEDA9,0x0A55,0x0A34,0x0A13,
-	0x4B11,0xF5ED,0xF62F,0xF650,0xF670,0xF671,0xF672,0xF693,
-	0xF672,0xF672,0xF671,0xF651,0xF630,0xF610,0xF5EF,0xF5ED,
-	0xED69,0xED27,0xED06,0xE4E5,0xECE5,0xECC6,0xE4A5,0xE485,
-	0xE465,0xE425,0xE425,0xE405,0xEC26,0xED6F,0xFEF9,0xFF1A,
-	0xFE11,0xFD8A,0xFDC9,0xFE68,0xFEA7,0xFE66,0xEDA4,0xE4C4,
-	0xE444,0xE444,0xDC44,0xD424,0xCC46,0xD4AA,0xE50D,0xFD90,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CE,0xED8D,0xE56C,0xE52B,
-	0xDCCB,0xD4AB,0xD449,0xD408,0xD3C6,0xDBA6,0xDBA5,0xE3C5,
-	0xE3C5,0xEC06,0xEC46,0xF486,0xF4A6,0xFCE6,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF527,0xF506,0xED26,0xED06,
-	0xED05,0xECE4,0xE4E4,0xECC4,0xE4A4,0xE4A4,0xE4C5,0xE529,
-	0xED6D,0xED2B,0xE4C7,0xE4C7,0xE4C8,0xECC9,0xECA9,0xE4A9,
-	0x78E1,0x7901,0x7901,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8961,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1020,0x50C0,0x8941,0x9161,0x9162,0x9162,0x9962,0x9962,
-	0x9962,0x9982,0x9981,0x9982,0x9982,0x9982,0x9981,0x99A1,
-	0x99A1,0x9981,0x99A1,0x99A1,0x99A1,0x9981,0x99A2,0x99A2,
-	0xA1A2,0x99A2,0x99A2,0xA1A2,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A2,0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA9C2,
-	0xA9E2,0xB202,0xB202,0xB222,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xBA62,0xBA82,
-	0xBA83,0xBA82,0xC283,0xC2A3,0xC2C3,0xCAE3,0xCAE3,0xCB03,
-	0xCB23,0xD343,0xD364,0xD384,0xD3A4,0xD3A3,0xD3C3,0xD3C4,
-	0xD3E5,0xDC47,0xDC89,0xE4EB,0xE54E,0xE590,0xEDF4,0xF6B8,
+	0x23BB,0xC005,0x9289,0x9BEA,0xA41A,0x0002,0x0290,0x432F,
+	0xFDD0,0xC02D,0xABA3,0x5B5B,0x4C4A,0x5342,0x8392,0x94E4,
+	0xF4A4,0xF5B4,0xF5B4,0xADEC,0xB3EB,0xA4AB,0xA55C,0xA5A4,
+	0xA35C,0x9CA4,0xA35C,0xA49C,0x9C9C,0x5CE4,0xA5BF,0xBFAD,
+	0x9389,0x8002,0x8121,0x8004,0x8921,0x8009,0x8941,0x0000,
+	0x8921,0x8004,0x8941,0x8003,0x9141,0x0001,0x9142,0x9142,
+	0x8002,0x9161,0x8005,0x9162,0x8002,0x9962,0x0000,0x9961,
+	0x8009,0x9981,0xC004,0xA5A4,0x645B,0x1400,0x0004,0x60E1,
+	0x50C1,0x48E1,0xA903,0xF841,0x8020,0xF800,0x0007,0xF841,
+	0xB123,0x5962,0x6981,0x81E2,0x9A43,0xB2C3,0xC323,0xC006,
+	0xF5AC,0xF5BE,0xBEFE,0xB700,0x0002,0xED91,0xEE35,0xF6FA,
+	0xC01F,0xFE5B,0x8193,0xA353,0x8890,0x8052,0xABE5,0xABAC,
+	0xA5AC,0xA4A5,0xACED,0xA4AD,0x6DED,0xADA5,0xADA5,0xACAD,
+	0xADA4,0x8005,0xF693,0xC007,0x9C9B,0xA394,0x9B63,0xDB49,
+	0x0000,0xECE5,0xC00B,0x9A5E,0xDCA4,0x5C9C,0x949C,0x5CE4,
+	0x5CF5,0x000A,0x73D0,0x0106,0x00A3,0x018B,0x0254,0x0216,
+	0x0177,0x0138,0x0179,0x125B,0x1B5C,0xC007,0xBB93,0x91DA,
+	0xE3A3,0x1A0B,0x0001,0xA46F,0xFDD0,0xC015,0xABA3,0x5B5B,
+	0x4C52,0x4B42,0x8393,0x93E4,0xF4AC,0xEDF5,0xB4B4,0xEDAC,
+	0xEBB3,0x8002,0xFD25,0xC00F,0x5CAD,0xA45C,0xA39C,0xA45B,
+	0x9CA4,0x9C9C,0x9C5C,0xE46D,0x0000,0xE4A9,0xC003,0xBFA4,
+	0x928A,0x8002,0x8121,0x8004,0x8921,0x8009,0x8941,0x0000,
+	0x8921,0x8004,0x8941,0x8003,0x9141,0x0001,0x9142,0x9142,
+	0x8003,0x9161,0x8004,0x9162,0x8002,0x9962,0x0000,0x9961,
+	0x8006,0x9981,0x0002,0x9982,0x9981,0x9981,0x8002,0x9982,
+	0x0007,0x9161,0x8941,0x7121,0x60E1,0x50C1,0x58E2,0xC903,
+	0xF820,0x801E,0xF800,0x0007,0xF820,0xD103,0x6162,0x6161,
+	0x79C2,0x9222,0xAA83,0xC2E3,0xC004,0xF4AD,0xB4B5,0xF500,
+	0x0005,0xDC89,0xDCEB,0xDD2D,0xE570,0xEDF4,0xF6D8,0xC01F,
+	0xFFA4,0x528A,0xA452,0x8989,0x8889,0x63EC,0xABAC,0xACA5,
+	0xA4A5,0xACAD,0xE5AC,0xA5AD,0xADAC,0xAEA5,0xACED,0x6CA5,
+	0x8005,0xF693,0xC007,0x9CA3,0x9B9C,0x9BA4,0x9289,0x0000,
+	0xF505,0xC00B,0x535D,0xE49C,0x5C9C,0x9C94,0x649C,0xA4ED,
+	0x0013,0xE50E,0x1147,0x00A3,0x018B,0x0254,0x0216,0x0177,
+	0x0138,0x0179,0x125B,0x1B5C,0x1BBB,0x1B7A,0x1B37,0x2B35,
+	0x2B14,0x2B12,0x1AF1,0x4350,0xFDB0,0xC02E,0xACAB,0xA35B,
+	0x5B4C,0x524B,0x8B42,0x8B9B,0xDCF4,0xACED,0xB4F5,0xB4ED,
+	0xACEB,0xB3A4,0xAB9D,0xA46D,0xA45C,0xA3A4,0x9C9B,0x649C,
+	0x9C9C,0x9C5C,0xA5F5,0xBFB7,0xAC89,0x8B00,0x8003,0x8121,
+	0x8005,0x8921,0x800D,0x8941,0xC007,0xE464,0xA4E4,0xA5A3,
+	0xA4AD,0x8002,0x9161,0x8003,0x9162,0x0005,0x9962,0x6101,
+	0x3880,0x3060,0x9982,0x9982,0x8003,0x9981,0x8005,0x9982,
+	0xC006,0xA3A5,0x5B1C,0x1C14,0x1C00,0x0002,0x6122,0xD924,
+	0xF820,0x801C,0xF800,0x0007,0xF820,0xD924,0x6983,0x6161,
+	0x79A2,0x9202,0xA263,0xBAC3,0xC00A,0xF4EC,0xB4AD,0xF4B6,
+	0xBEF6,0xBEF7,0xBF00,0x0001,0xF657,0xF73A,0xC006,0xEE52,
+	0x8A9B,0x9B4A,0x9100,0x0000,0xED6C,0xC017,0x49DA,0xA4AB,
+	0xACA5,0xACA4,0xA5AC,0xA5EC,0x65AC,0xEEAC,0xA5AD,0xADA5,
+	0xB5A4,0xADA4,0x8002,0xF693,0xC009,0x9CAC,0x9CA3,0x9B9C,
+	0x9B5C,0xDA51,0x0000,0xED06,0xC00B,0x929D,0x64DC,0x6494,
+	0x94A4,0x5B9D,0xA4ED,0x0004,0xED4F,0xCDD6,0x1105,0x018C,
+	0x0254,0xC003,0x8E85,0x95FE,0x0002,0x125B,0x1B3C,0x23BB,
+	0xC004,0x9B8A,0xA2DA,0xA300,0x0002,0x4351,0xE52F,0xFDD0,
+	0xC029,0xACA3,0xA35B,0x9B0B,0x544A,0x4B83,0x9293,0xE4E4,
+	0xACF5,0xB4F5,0xB4ED,0xACB3,0xEBA3,0xACA5,0x64A5,0x9CA4,
+	0x64A3,0x9C63,0x9C9C,0xA49C,0xA45C,0x94F6,0x0000,0xE4CA,
+	0xC003,0xBE9B,0x8A93,0x8006,0x8121,0x8002,0x8921,0x8010,
+	0x8941,0xC004,0xE4A4,0xA5A3,0xAD00,0x8003,0x9161,0x0008,
+	0x9162,0x6101,0x3880,0x0820,0x0000,0x0000,0x2060,0x9982,
+	0x9982,0x8004,0x9981,0x8005,0x9982,0xC006,0xAC5C,0x6354,
+	0x1C14,0x1C00,0x0002,0x6102,0xD104,0xF820,0x801A,0xF800,
+	0x0008,0xF820,0xD124,0x6963,0x6141,0x79A2,0x8A02,0xA242,
+	0xB2A3,0xC2E3,0xC00A,0xF4A4,0xB5AC,0xF4AD,0xBEFE,0xB6FF,
+	0xB700,0x0001,0xEE35,0xF6F9,0xC00C,0xFE9C,0x4A92,0x9B93,
+	0x5188,0x8892,0xA3AC,0xAB00,0x8002,0xED47,0xC00F,0xA5A4,
+	0xACED,0xA56C,0xEDAD,0xA5AD,0xACA6,0xB4A5,0xADA4,0x8002,
+	0xF693,0xC009,0x9CAC,0x9CA3,0x9C93,0xA3A4,0x9B89,0x0000,
+	0xED06,0xC00B,0x92A5,0x5C9C,0xA49C,0x949C,0x9C9C,0xA4AD,
+	0x0004,0xF52F,0xFEF9,0xCE17,0x11EC,0x0254,0xC003,0x9685,
+	0x8DB5,0x0001,0x125B,0x1B5C,0xC004,0xBBDB,0x92DA,0xA200,
+	0x0002,0x4B72,0xDCEE,0xF56F,0xC02A,0xF5AC,0xABA3,0x5B9B,
+	0x134C,0x4A8B,0x4B92,0xCBA4,0xECAD,0xECF4,0xB5B4,0xEDAC,
+	0xB2EC,0x63E5,0xAC64,0xA59C,0xA464,0xA3A4,0x5B9C,0x9CA4,
+	0x9CA4,0x5CDD,0xBE00,0x0000,0xE50B,0xC003,0xAD9A,0x829C,
+	0x8007,0x8121,0x8002,0x8921,0x800F,0x8941,0x0000,0x9142,
+	0x8002,0x9141,0x0005,0x9162,0x9162,0x8941,0x58E1,0x2860,
+	0x0820,0x8004,0x0000,0x0002,0x2060,0x9982,0x9982,0x8003,
+	0x9981,0x8008,0x9982,0xC006,0x645B,0x6414,0x141C,0xF400,
+	0x0001,0xB903,0xF861,0x8018,0xF800,0x0008,0xF861,0xB903,
+	0x6142,0x6141,0x71A2,0x89E2,0xA242,0xB283,0xC2C3,0xC00B,
+	0xB4EC,0xA4B4,0xA5F4,0xB5B6,0xFEBE,0xF6B7,0x0002,0xEDF3,
+	0xF6B8,0xFF3B,0xC006,0x6C8A,0x8A9B,0x9C51,0x8900,0x0000,
+	0xED4B,0xC016,0x915B,0xE4B4,0xAC9C,0xACA4,0xA5AC,0xEDA4,
+	0xADA5,0xADAD,0xA4AD,0xADAD,0xADA5,0xAC00,0x8004,0xF693,
+	0xC007,0x9CA3,0x9C9B,0x9BA4,0x9B89,0x0000,0xED06,0xC00B,
+	0x9A9D,0x5CA4,0x9C9C,0x94A4,0x5C9C,0xDCAD,0x0012,0xF54F,
+	0xFEFA,0xFF5B,0xEDF3,0x73D0,0x0216,0x0197,0x0138,0x0179,
+	0x125B,0x1B5C,0x1BBB,0x23BA,0x2379,0x3376,0x7BEF,0xD4EC,
+	0xE52E,0xF56F,0xC01E,0xF5B4,0xA3A3,0x5B9B,0x1354,0x428B,
+	0x4B92,0xD4DB,0xACAD,0xECB4,0xF5B4,0xEDAC,0xF3AB,0xA3A5,
+	0xA46C,0xA59C,0x6400,0x8002,0xED05,0xC008,0x5B9C,0x9CA4,
+	0x9CA4,0x5CA5,0xFF00,0x0000,0xED2C,0xC003,0xAC52,0x9394,
+	0x8005,0x8121,0x0001,0x8101,0x8121,0x8002,0x8921,0x800F,
+	0x8941,0xC003,0xE4AC,0x9C64,0x0001,0x58E1,0x2860,0x8008,
+	0x0000,0x0002,0x2060,0x9982,0x9982,0x8003,0x9981,0x8003,
+	0x9982,0x8002,0x99A2,0xC009,0x9CA4,0xA3A5,0x5B1C,0x1C1C,
+	0x14AC,0x0002,0x9123,0xF0C3,0xF820,0x8014,0xF800,0x0008,
+	0xF820,0xF0C2,0x9943,0x5121,0x6141,0x7181,0x89E2,0xA223,
+	0xB263,0xC00A,0xF4F4,0xECAC,0xA4AD,0xACF4,0xB4AE,0xF600,
+	0x0005,0xDCCA,0xE50C,0xE56F,0xE5B2,0xF677,0xF71A,0xC006,
+	0xB593,0x8A5A,0xDC52,0x8A00,0x0000,0xED8D,0xC004,0x889A,
+	0x9CAB,0xAD00,0x8002,0xED47,0xC00E,0xA5A4,0xACED,0x65AD,
+	0xEDAC,0xADA5,0xADAD,0xADA4,0xAD00,0x8004,0xF693,0xC007,
+	0x9CA3,0x9C9B,0x9BA4,0x9B91,0x0000,0xED26,0xC00B,0x929D,
+	0xA45C,0x9C9C,0x9C9C,0x5CDC,0x9CB5,0x0012,0xF54F,0xFEF9,
+	0xFF5B,0xFE53,0xFD8A,0xEDAA,0xA4AE,0x7C0F,0x42B5,0x4B35,
+	0x4BB6,0x5BF4,0x7BEF,0xA42C,0xD4A8,0xD4CA,0xD4EC,0xE52E,
+	0xF56F,0xC01E,0xFDAC,0xA3A3,0x5B5B,0x5354,0x8B42,0x4B93,
+	0xD3DB,0xACAD,0xF4AC,0xF5B4,0xB5EC,0xEBAB,0xA3A5,0xA46C,
+	0xA59C,0x6400,0x8002,0xED05,0xC007,0x5B9C,0x9CA4,0x9CA4,
+	0x5CED,0x0000,0xE4E9,0xC004,0xF7AC,0x5293,0x9C00,0x8004,
+	0x8101,0x0000,0x8121,0x8003,0x8921,0x0002,0x8941,0x8941,
+	0x8921,0x8004,0x8941,0x0002,0x8921,0x8941,0x8921,0x8002,
+	0x8941,0xC003,0xAC9C,0xE41C,0x0001,0x58E1,0x2860,0x8009,
+	0x0000,0x0003,0x1840,0x48C1,0x7921,0x9982,0xC003,0xA4A3,
+	0xA4A5,0x8004,0x9981,0x8004,0x9982,0xC008,0xEB64,0x9C1C,
+	0x5C1C,0x1C1C,0x5B00,0x0003,0x7102,0xB8E2,0xF082,0xF820,
+	0x8011,0xF800,0x0008,0xF882,0xB8E2,0x7122,0x5101,0x6141,
+	0x7181,0x89C2,0x9A22,0xB263,0xC00F,0xF4EC,0xEC6C,0xECA4,
+	0xACAC,0xEDB4,0xB5B6,0xFEB7,0xFFBE,0x0001,0xEE15,0xF6D9,
+	0xC02B,0xBEA4,0x8A92,0x9B9B,0x4988,0x9191,0xA2AC,0xA4A5,
+	0xACA4,0xA5A4,0xACE5,0x6DED,0x64ED,0xADAD,0xADAD,0xACA5,
+	0xADA5,0xA49C,0xACA4,0x9CA3,0x9C9B,0x9B64,0xDB91,0x0000,
+	0xED26,0xC00B,0x939C,0x9C64,0x9C9C,0x9C9C,0x54DC,0xA4B5,
+	0x000A,0xED4F,0xFF19,0xFF3B,0xFE33,0xFD8B,0xFDE9,0xFE68,
+	0xFEC7,0xFE86,0xEDA4,0xE4A3,0xC005,0x856D,0xBD66,0xA6B6,
+	0x0001,0xE52E,0xF56F,0xC01E,0xF5B4,0xA3A4,0x5B52,0x5354,
+	0x4B92,0x4393,0xD3A3,0xE4AC,0xF5B4,0xF5AC,0xF5AC,0xEAAC,
+	0xA4AC,0xA4A5,0x649C,0x6400,0x8002,0xED05,0xC007,0x9B5C,
+	0x9CA4,0x9CA4,0x9CAE,0x0000,0xE50A,0xC004,0xF69C,0x5194,
+	0xA400,0x8004,0x8101,0x0000,0x8121,0x8003,0x8921,0x0002,
+	0x8941,0x8941,0x8921,0x800A,0x8941,0x0002,0x8961,0x9141,
+	0x8961,0x8008,0x0000,0x0004,0x0820,0x3080,0x58E1,0x8941,
+	0x9982,0xC003,0xA49C,0xACA4,0x8005,0x9981,0x0001,0x99A1,
+	0x99A1,0x8004,0x9982,0xC00A,0xA3AC,0x9CA4,0x5C1C,0x6414,
+	0x245C,0x5C00,0x0003,0x7902,0xB8E2,0xF082,0xF841,0x800C,
+	0xF800,0x000B,0xF841,0xF082,0xB8E3,0x8122,0x50E1,0x5901,
+	0x6141,0x7181,0x89C2,0x9A02,0xAA42,0xBA83,0x8002,0xC2C3,
+	0xC00C,0xB4EC,0xA4AC,0xACED,0xB4AD,0xB6F5,0xBFFF,0xB600,
+	0x0002,0xEDF3,0xF6B8,0xF73B,0xC020,0xA493,0x9153,0xDC91,
+	0x5180,0x999A,0xA3AC,0xA5AC,0xA4A5,0xACA4,0xE5AC,0xADAD,
+	0xA5AD,0xA4B5,0xADA5,0xACA5,0xADA5,0x9C00,0x8002,0xF693,
+	0xC006,0x9B9C,0x9B9B,0x64DB,0x9100,0x0000,0xED26,0xC00B,
+	0x939C,0x649C,0x9C9C,0x9C9C,0x54E4,0x9CB5,0x000B,0xED4F,
+	0xFF19,0xFF3B,0xFE53,0xFD8B,0xFDE9,0xFE68,0xFEA7,0xFE86,
+	0xEDA3,0xE4C3,0xE424,0xC004,0xAC76,0x6E6E,0xEE00,0x0001,
+	0xE52E,0xF56F,0xC01E,0xFDAC,0xA3A4,0x5B52,0x9314,0x4B92,
+	0x4B8B,0xD3E3,0xA4AC,0xF5B4,0xEDB4,0xF5AC,0xEAAC,0xA4AC,
+	0xA4A5,0x649C,0x6400,0x8002,0xED05,0xC007,0x9B5C,0x9CA4,
+	0x9CA4,0x9CBF,0x0000,0xE52B,0xC004,0xED9B,0x529C,0x9C00,
+	0x8004,0x8101,0x0000,0x8121,0x8004,0x8921,0x800C,0x8941,
+	0x0002,0x8961,0x9141,0x9141,0x8005,0x0000,0x0003,0x1840,
+	0x40A0,0x7921,0x9161,0x8002,0x9162,0xC007,0xECA4,0x64E4,
+	0xA4A3,0xA4A5,0x8003,0x9981,0xC012,0xACA5,0x9CAC,0xDC64,
+	0xA3AC,0xA49C,0xA563,0x5C5C,0x1C1C,0x5C5C,0x6C00,0x0005,
+	0x68E2,0x9903,0xB8A2,0xD861,0xF041,0xF820,0x8004,0xF800,
+	0x000F,0xF820,0xE841,0xD881,0xB8C2,0x9903,0x6902,0x50E1,
+	0x5101,0x5921,0x6961,0x81A2,0x89C2,0xA222,0xAA42,0xBA62,
+	0xC2A3,0x8002,0xC2C3,0xC00D,0xB4EC,0xA4B4,0xA5EC,0xABB5,
+	0xAEF6,0xBEBF,0xF6BF,0x0001,0xEE56,0xF6FA,0xC00B,0xF59B,
+	0x5293,0x9C92,0x9148,0x9091,0xA4AB,0x000A,0xD4C9,0x8C2F,
+	0x73D1,0x4B54,0x4B53,0x4B53,0x5372,0x7BEF,0xAC8D,0xE56B,
+	0xF5CB,0xC013,0xADA5,0xADAD,0xADA4,0xB5A5,0xA59C,0xACA4,
+	0x9CA3,0x9C9B,0x9B64,0xDB91,0x0000,0xED47,0xC007,0x9394,
+	0x63DC,0x5C9C,0x9C9C,0x8002,0xE3E5,0x000B,0xE406,0xED4F,
+	0xFF19,0xFF5B,0xF632,0xFD8A,0xFDE9,0xFE68,0xFEA7,0xFE86,
+	0xEDA4,0xE4A3,0xC005,0x84AD,0x756E,0x67F6,0x0001,0xE52E,
+	0xF56F,0xC01E,0xFDAC,0xA3A4,0x5B52,0x9413,0x8B53,0x8A93,
+	0x93DB,0xADA4,0xF4B4,0xF5AD,0xF4AC,0xEBAB,0xA4AC,0xA4A5,
+	0x649C,0x6400,0x8002,0xED05,0xC003,0x9B5C,0x9CA4,0x8002,
+	0xE484,0x0001,0xE4E8,0xE52C,0xC004,0xAC92,0x929D,0xA400,
+	0x8004,0x8101,0x0001,0x8121,0x8121,0x8004,0x8921,0x800C,
+	0x8941,0x0001,0x9141,0x9141,0x8004,0x0000,0x0003,0x1020,
+	0x40A0,0x6901,0x8941,0xC004,0xEDE4,0x64E4,0xA400,0x8006,
+	0x9981,0x0000,0x9982,0x8002,0x9981,0xC004,0xACA4,0x9CA4,
+	0xA500,0x8002,0x9981,0x0001,0x99A2,0xA1A2,0x8002,0x9981,
+	0xC008,0x651B,0x5C1C,0x5C1C,0x9C64,0xAC00,0x000A,0x58E1,
+	0x7923,0xA964,0xD124,0xF165,0xF986,0xF165,0xD144,0xA964,
+	0x7922,0x58E1,0xC003,0x24A4,0xECEC,0x0006,0x6941,0x7181,
+	0x81A1,0x91E2,0xA202,0xAA42,0xBA62,0xC012,0xADE4,0xACAC,
+	0xA4B4,0xECA4,0xACED,0xACAC,0xACAD,0xB6FE,0xBFF6,0xBF00,
+	0x0001,0xEE15,0xF6D9,0xC009,0xBEA4,0x8A92,0x9C9A,0x8A88,
+	0x5059,0x0001,0xB48B,0x4B74,0x8003,0x12B8,0xC004,0x63DC,
+	0xA4A3,0x5B00,0x0003,0x1A94,0x6391,0xE58C,0xF5ED,0xC011,
+	0xACAE,0xA4AD,0xADAD,0xA59C,0xACA4,0x9CA3,0xA493,0x9BA4,
+	0x9B51,0x0000,0xED47,0xC00B,0x939C,0x5BDC,0x649C,0x9C94,
+	0x9C9C,0xA4AD,0x000A,0xF54F,0xFF1A,0xFF3B,0xFE32,0xFD8A,
+	0xFDE9,0xFE68,0xFEC7,0xFE86,0xEDA4,0xE4A4,0xC005,0x4CE4,
+	0x6D6E,0x66F7,0x0001,0xE52E,0xFD8F,0xC028,0xB5AC,0xA3A3,
+	0x5C53,0x5353,0x934B,0x4A93,0xD3E4,0xA4AC,0xECF4,0xB5AD,
+	0xF4AC,0xEAAC,0xA4AC,0xA465,0xA49C,0x64A3,0xA49C,0xA35C,
+	0xA49C,0x9CA4,0x6D00,0x0000,0xE4E9,0xC005,0xF763,0x929B,
+	0x9DA4,0x8004,0x8101,0x0000,0x8121,0x8006,0x8921,0x800B,
+	0x8941,0x0001,0x9141,0x9141,0x8008,0x0000,0x0003,0x1840,
+	0x40A0,0x7101,0x9962,0xC003,0xA4AB,0xA5A4,0x8007,0x9981,
+	0x8003,0x99A1,0x8003,0x9981,0xC00E,0xED5B,0xEDA4,0xA35C,
+	0x655B,0x5C64,0x1C64,0x5C64,0x9C00,0x800A,0x5101,0x0007,
+	0x5921,0x6141,0x7162,0x81A1,0x89C2,0x9A02,0xA222,0xB242,
+	0xC013,0xECA4,0xADA4,0xECAC,0xA4B4,0xECA4,0xACED,0xACAC,
+	0xACAD,0xADFE,0xBFF6,0x0003,0xE590,0xEDF3,0xEE97,0xF73A,
+	0xC007,0xED53,0x82A3,0x9B89,0x8950,0x0002,0x7C0F,0x12F8,
+	0x12D8,0x8003,0x12B8,0xC007,0xA35C,0xA4E3,0x5B9C,0xE4E2,
+	0x0001,0xACAE,0xF5ED,0xC01D,0xADAD,0xADAD,0xADA5,0x9BAC,
+	0xA59C,0xA3A4,0x93A3,0x9C9B,0x9940,0x929C,0x5BA4,0x9C9C,
+	0x9C9C,0x94A4,0x9CAD,0x000A,0xF56F,0xFF1A,0xFF3B,0xFE32,
+	0xFD8A,0xFDC9,0xFE68,0xFEA7,0xFE86,0xEDA4,0xE4A3,0xC005,
+	0x4DA4,0xAD6E,0x66F6,0x0001,0xE52E,0xFD8F,0xC01E,0xB5AC,
+	0xAB9B,0x5C53,0x5353,0x934B,0x53CB,0x92E4,0xA4EC,0xACF4,
+	0xB5AD,0xF4AC,0xEA74,0xDCAC,0xA465,0xA49C,0x6400,0x8002,
+	0xED05,0xC006,0x9B5C,0xA49C,0x9C9C,0xBE00,0x0000,0xED0A,
+	0xC005,0xB69B,0x529C,0x9CA4,0x8004,0x8101,0x0001,0x8121,
+	0x8121,0x8005,0x8921,0x800B,0x8941,0x0004,0x9141,0x9161,
+	0x60E1,0x4080,0x1020,0x8009,0x0000,0x0002,0x2840,0x58C1,
+	0x7941,0x8008,0x9981,0x8003,0x99A1,0x8003,0x9981,0xC00F,
+	0xED5B,0xEDA4,0xA3A5,0xA365,0x5B64,0x5C64,0x5C64,0xA45C,
+	0x8008,0x6941,0x0004,0x6961,0x7161,0x79A2,0x89C2,0x99E2,
+	0xC019,0xECEC,0xECA4,0xECA4,0xADE4,0xACAC,0xA4AC,0xECAC,
+	0xA4F5,0xACA4,0xB3A6,0xB5F6,0xBEFE,0xBFB7,0x0001,0xEE56,
+	0xF6F9,0xC006,0xB69B,0x8A9B,0x9C9A,0x8900,0x0004,0x6390,
+	0x12B5,0x12F8,0x12D8,0x12D8,0x8002,0x12B8,0xC008,0x64E3,
+	0x5CE3,0x5CA3,0x9C9B,0xA300,0x0001,0x9C6F,0xF60E,0xC003,
+	0xADAC,0xADA6,0x8002,0xF692,0xC015,0xA59C,0xA3A4,0x93A3,
+	0x9C9B,0x9940,0x9294,0xA3A4,0x5C9C,0x9C9C,0x949C,0xA4ED,
+	0x000A,0xF56F,0xFEFA,0xFF3B,0xFE32,0xFD8A,0xFDE9,0xFE68,
+	0xFEC7,0xFE86,0xEDA4,0xE4A4,0xC005,0x4BE5,0x6D65,0x6FF6,
+	0x0001,0xE52E,0xFD8F,0xC01D,0xB5AC,0xAB9B,0x5C53,0x5353,
+	0x934B,0x9393,0x93DB,0xA4EC,0xACF4,0xB5AD,0xF4AC,0xEAAC,
+	0xA4AC,0xA465,0xA49C,0x8003,0xED05,0xC006,0x9B5C,0xA49C,
+	0x9CA4,0xB700,0x0000,0xED2B,0xC005,0xAD51,0x9B9D,0x9CA4,
+	0x8004,0x8101,0x0001,0x8121,0x8121,0x8006,0x8921,0x800A,
+	0x8941,0xC004,0xE4A4,0xAD9B,0xA400,0x0003,0x7921,0x58E1,
+	0x3081,0x0820,0x8007,0x0000,0x0000,0x2860,0x8008,0x9981,
+	0xC003,0xACA4,0x9CAD,0x8004,0x9981,0x8002,0xA1A2,0x0000,
+	0xA1A1,0x8003,0xA1A2,0xC003,0x6365,0xA45B,0x8002,0x8181,
+	0x8005,0x81A1,0x8002,0x81A2,0xC004,0xE4EC,0xECEC,0xEC00,
+	0x8003,0xB242,0xC015,0xECA4,0xADE4,0xACAC,0xACA4,0xECAC,
+	0xA4F5,0xACA3,0xACAD,0xADF6,0xBEFF,0xB6BF,0x0002,0xEE14,
+	0xF6B8,0xF73A,0xC004,0xA58A,0x92A4,0x9B00,0x0002,0xACD1,
+	0x122F,0x1294,0xC003,0xB7A5,0xA5E2,0x0006,0x4354,0x7BEF,
+	0x840F,0x7BEF,0x7BEF,0x4353,0x1AB5,0xC003,0x14DC,0x5BA3,
+	0x0005,0x1A52,0xD58E,0xF62E,0xF62F,0xF650,0xF671,0x8002,
+	0xF692,0xC008,0x9DA4,0xA3A4,0x9B9B,0x9C9B,0x9A00,0x0000,
+	0xF548,0xC00B,0x529C,0xA39C,0x5C9C,0x9C9C,0x94A4,0x9CED,
+	0x000A,0xED4F,0xFEF9,0xFF3B,0xFE32,0xFD8A,0xFDE9,0xFE68,
+	0xFEA7,0xFE86,0xEDA4,0xE4A4,0xC005,0x8CA4,0x6C66,0x6EEF,
+	0x0001,0xE52E,0xFD90,0xC01D,0xB4AC,0xAB9C,0x5B53,0x535B,
+	0x8B53,0x8B93,0x93DB,0xACE4,0xACF5,0xB4AD,0xF4AC,0xEAAC,
+	0xA4AC,0xA564,0xA49C,0x8003,0xED05,0xC00D,0x9B5C,0xA49C,
+	0x9CA5,0xBFF7,0xAC51,0x9C9D,0xDC64,0x8004,0x8101,0x0001,
+	0x8121,0x8121,0x8006,0x8921,0x8009,0x8941,0x8002,0x8961,
+	0x8003,0x9161,0x0006,0x9162,0x9161,0x9162,0x7901,0x50C1,
+	0x2860,0x0820,0x8003,0x0000,0x0000,0x2840,0x8002,0x9981,
+	0x0001,0x9982,0x9982,0x8003,0x9981,0x0001,0x99A1,0x9981,
+	0x8003,0x99A2,0x8003,0x9981,0x0002,0xA1A2,0xA1A2,0xA1A1,
+	0x8002,0xA1A2,0xC003,0xACA4,0xA3A5,0x8003,0x99C2,0x0001,
+	0x99E2,0x99C1,0x8003,0x99E2,0xC005,0xA3A5,0xA4E4,0xACEC,
+	0x8003,0xB242,0xC018,0xACA4,0xE4A4,0xACE5,0xACAC,0xACA4,
+	0xECAC,0xACA4,0xED6C,0xF4A4,0xADB6,0xF5BE,0xFFB7,0xFF00,
+	0x0001,0xF697,0xF71A,0xC004,0xAD9B,0x8A9B,0x0A00,0x0005,
+	0x1A0B,0x122E,0x1292,0x12D6,0x3336,0xA46C,0x8004,0xED47,
+	0x000C,0xED68,0xED68,0xE549,0x8C2F,0x1A94,0x1255,0x0A34,
+	0x0A13,0x6370,0xF60E,0xF62E,0xF650,0xF671,0x8002,0xF692,
+	0xC011,0xA59C,0xA3A4,0x9B9B,0x9C9B,0x9A48,0x899B,0xA45C,
+	0x9C9C,0xA494,0x8002,0xE405,0x000B,0xEC26,0xED6F,0xFEF9,
+	0xFF3B,0xFE32,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,
+	0xE4A4,0xC005,0x8CA4,0x646E,0x6EEF,0x0001,0xE52E,0xFD90,
+	0xC015,0xB4AC,0xA4A3,0x5B53,0x535B,0x8B54,0x8B92,0x93DB,
+	0xACE4,0xACF5,0xB4B4,0xECED,0x8002,0xFD05,0xC00E,0xADA4,
+	0x64A4,0x9C6B,0x9CA4,0x9CA3,0x5CA4,0x9C9C,0xAD00,0x0000,
+	0xE529,0xC006,0xEF9B,0x599B,0x9EDC,0x6400,0x8006,0x8101,
+	0x8006,0x8921,0x0001,0x8941,0x8921,0x8008,0x8941,0x0001,
+	0x8961,0x8961,0x8003,0x9161,0x0005,0x9162,0x9162,0x8121,
+	0x58C1,0x2860,0x0820,0x8004,0x0000,0x0000,0x2060,0x8007,
+	0x9981,0x0002,0x99A1,0x99A1,0x9981,0x8002,0x99A2,0x8003,
+	0x9981,0x8002,0xA1A2,0x0000,0xA1A1,0x8002,0xA1A2,0x0002,
+	0xA1C2,0xA1C2,0xA1C1,0x8002,0xA9E2,0x0001,0xAA02,0xAA02,
+	0x8003,0xB222,0x0001,0xB242,0xB242,0x8004,0xB222,0x8005,
+	0xB242,0xC017,0xACE4,0xA4AC,0xE5AC,0xACAC,0xA4EC,0xACA4,
+	0xECAD,0xABAD,0xACA4,0xB6F6,0xBDFF,0xBFF7,0x0001,0xF655,
+	0xF6D9,0xC003,0xFE9B,0x5293,0x0005,0x9C91,0x09AA,0x0A0D,
+	0x1271,0x2AF4,0xDD09,0x8005,0xED47,0xC003,0xA5EC,0x64AD,
+	0x0006,0xC50C,0x0A55,0x1234,0x0A33,0x0A12,0xD58E,0xF60E,
+	0xC00F,0xB5AD,0xA5A5,0xA4AD,0x9CA3,0xA49B,0x9B9C,0x9B9A,
+	0x4891,0x8002,0xECE5,0xC007,0x559B,0xA494,0x9C9C,0xA4A5,
+	0x000A,0xED6F,0xFEF9,0xFF3A,0xFE32,0xFD8A,0xFDC9,0xFE48,
+	0xFEA7,0xFE66,0xEDA4,0xE4C4,0xC005,0x84A4,0x6465,0x6EF7,
+	0x0001,0xE52E,0xFD8F,0xC015,0xB5AC,0xA3A3,0x5C53,0x535B,
+	0x8C53,0x8B92,0x9BD3,0xACE4,0xACB5,0xF4F4,0xACED,0x8002,
+	0xFD05,0xC00E,0xADA4,0x64A4,0x9C6B,0xA49C,0x9C63,0x9C9C,
+	0xA49C,0xB600,0x0000,0xE52A,0xC006,0xEE5A,0x919C,0xA6DC,
+	0x6400,0x0000,0x78E1,0x8005,0x8101,0x0000,0x8121,0x8005,
+	0x8921,0x800A,0x8941,0xC004,0xACA4,0xE4A4,0x5C00,0x0002,
+	0x60E1,0x4080,0x1020,0x8008,0x0000,0x0001,0x2840,0x9981,
+	0x8003,0x9982,0x8002,0x9981,0x0002,0x99A1,0x99A1,0x9981,
+	0x8003,0x99A2,0x8002,0x9981,0x8002,0xA1A2,0x0000,0xA1A1,
+	0x8002,0xA1A2,0x8002,0xA1C2,0xC006,0xE4AC,0xA4AC,0xA4EC,
+	0xA400,0x8004,0xB242,0x8003,0xB222,0x8004,0xB242,0xC015,
+	0xACA4,0xE4A4,0xADE4,0xACAC,0xACA4,0xECA4,0xACAC,0xADAB,
+	0xEDA4,0xACAD,0xF6BE,0x000E,0xE50B,0xE54E,0xE591,0xEDF4,
+	0xF6B8,0xF73A,0xFF3A,0xFEF9,0xF6B7,0x530D,0x0989,0x09EB,
+	0x0A2F,0xAC8E,0xED49,0x8006,0xED47,0xC003,0xED64,0xADDC,
+	0x0005,0x73D1,0x0A54,0x0A34,0x0A13,0x944F,0xF60E,0xC01A,
+	0xADB5,0xA5A5,0xACA5,0x9CA3,0xA49B,0x9B9C,0x9B9A,0x4892,
+	0x93A4,0xA35D,0x949B,0x9C9C,0xA49C,0xED00,0x000A,0xF56F,
+	0xFEF9,0xFF1A,0xFE11,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,
+	0xEDA4,0xE4C4,0xC005,0x83A5,0x6465,0x6EF7,0x0001,0xE52E,
+	0xFD8F,0xC015,0xB5AC,0xA3A3,0x5B54,0x5353,0x9354,0x9392,
+	0xD393,0xACEC,0xA4B5,0xF4B4,0xECED,0x8002,0xFD05,0xC00A,
+	0xADA4,0x64A4,0x9C6B,0xA49C,0x9B64,0x9C00,0x8002,0xE4A4,
+	0x0001,0xE4E7,0xED4B,0xC006,0xA551,0x92A4,0xDEA4,0x6400,
+	0x0001,0x78E1,0x7901,0x8004,0x8101,0x0000,0x8121,0x8007,
+	0x8921,0x8008,0x8941,0x0003,0x8961,0x9161,0x40A0,0x2040,
+	0x8009,0x0000,0x0003,0x1840,0x4080,0x7121,0x9982,0xC004,
+	0xA3A5,0xA4A3,0xAD00,0x8002,0x9981,0xC005,0xACA4,0x9CAD,
+	0xA4E4,0x8002,0x99A2,0x0000,0x9981,0x8003,0xA1A2,0xC009,
+	0xA3A4,0xA5A4,0xACA4,0xE3AD,0xA4AC,0x8002,0xB222,0x8005,
+	0xB242,0x8002,0xB222,0x8004,0xB242,0x8002,0xB262,0xC012,
+	0xE4AD,0xE4AC,0xACA4,0xECA4,0xACAC,0xACEC,0xADAC,0xA3AD,
+	0xADB5,0xF600,0x000E,0xE4EB,0xE52D,0xE58F,0xE5D3,0xF677,
+	0xF71A,0xFF3B,0xF6F9,0xF6B8,0x220A,0x0969,0x09CB,0x1A4E,
+	0xED8D,0xED49,0x8006,0xED47,0xC003,0xACA5,0xA4ED,0x0005,
+	0xC50C,0x0A55,0x0A34,0x0A13,0x6390,0xF5EE,0xC01A,0xB5AD,
+	0xADA5,0xA5AC,0x9CA3,0xA49B,0x9B9C,0x9B9A,0x508A,0x93A3,
+	0xA49D,0x5C9B,0x949C,0xA49C,0xED00,0x000A,0xED6F,0xFEF9,
+	0xFF1A,0xFE11,0xFD8A,0xFDC9,0xFE49,0xFEA7,0xFE66,0xEDA4,
+	0xE4C4,0xC005,0x43E5,0x6465,0x66FF,0x0001,0xE52E,0xFD90,
+	0xC015,0xB4AC,0xA3A3,0x5B54,0x5B53,0x944B,0x9393,0x92DB,
+	0xE4AC,0xA4B5,0xF4F4,0xADF3,0x8002,0xFD05,0xC00E,0xADA4,
+	0x64A4,0x9C6B,0xA49C,0x9B64,0x9C9C,0xA4A5,0xBF00,0x0000,
+	0xED6C,0xC006,0x9B89,0x5BA5,0xE59C,0x6400,0x0001,0x7901,
+	0x78E1,0x8004,0x8101,0x0000,0x8121,0x8007,0x8921,0x8002,
+	0x8941,0x0000,0x8961,0x8004,0x8941,0x0001,0x8961,0x9161,
+	0x8007,0x0000,0x0003,0x1840,0x40A0,0x6901,0x8961,0xC003,
+	0xEDA4,0xE4A3,0x8002,0x9982,0xC003,0xA3AC,0xA49C,0x8003,
+	0x99A1,0x0002,0x99A2,0x99A2,0xA1A2,0x8002,0x99A2,0x0000,
+	0x9981,0x8003,0xA1A2,0x0000,0xA1A1,0x8002,0xA1A2,0xC005,
+	0xACA4,0xE4AC,0xEC64,0x8003,0xB222,0x800F,0xB242,0xC012,
+	0xF4A5,0xACE4,0xA4AC,0xECA4,0xADAB,0xECAD,0xACAC,0xA3AD,
+	0xADAD,0xF500,0x000D,0xDCCA,0xE52C,0xE56F,0xE5B1,0xEE35,
+	0xF6D9,0xF73A,0xFF1A,0xF6D8,0x0968,0x0969,0x09AA,0x430E,
+	0xF5AE,0xC003,0x509A,0xA3AC,0x8003,0xED47,0xC004,0xACA5,
+	0xA4E5,0x7400,0x0004,0x0A55,0x0A34,0x0A13,0x4B11,0xF5ED,
+	0xC01A,0xB6AD,0xACA5,0xA5AD,0x9BA4,0xA39C,0x9B9C,0x9BA2,
+	0x4092,0x9B5B,0xE49D,0x5B9C,0x9C94,0xA49C,0xED00,0x000A,
+	0xED6F,0xFEF9,0xFF1A,0xFE11,0xFD8A,0xFDC9,0xFE68,0xFEA7,
+	0xFE66,0xEDA4,0xE4C4,0xC004,0x84A4,0x645C,0x6E00,0x0002,
+	0xD4AA,0xE50D,0xFD90,0xC015,0xB4AC,0xA3A3,0x5C53,0x5B93,
+	0x4C5C,0x8A93,0x92DC,0xA3EC,0xA4F5,0xB4F4,0xACF4,0x8002,
+	0xFD05,0xC00D,0xADA4,0x64A5,0x9B6C,0x9CA3,0x9B64,0xDC5C,
+	0xA4AD,0x0001,0xE529,0xED6D,0xC006,0x9248,0xA4A5,0xE59C,
+	0x6400,0x0002,0x78E1,0x7901,0x7901,0x8003,0x8101,0x8002,
+	0x8121,0x8005,0x8921,0x8008,0x8941,0x0001,0x8961,0x9161,
+	0x8004,0x0000,0x0005,0x1020,0x50C0,0x8941,0x9161,0x9162,
+	0x9162,0x8002,0x9962,0x0001,0x9982,0x9981,0x8002,0x9982,
+	0xC003,0xA3AC,0xA49C,0x8002,0x99A1,0xC007,0x9CAD,0xA4E4,
+	0x64A4,0xE45B,0x8003,0xA1A2,0x0000,0xA1A1,0x8002,0xA1A2,
+	0xC005,0xACA4,0xE4AC,0xECA4,0x8002,0xB222,0x800F,0xB242,
+	0xC017,0xECAC,0xA5A3,0xE5AC,0xACEC,0xA4AC,0xACEC,0xADAC,
+	0xACA3,0xACA5,0xADFE,0xB6FE,0xBFB6,0x0009,0xEDF4,0xF6B8,
 	0xFF1A,0xF73A,0xFEF9,0x0947,0x0968,0x0989,0x42EE,0xEDF0,
-	0xED8C,0xED49,0xED47,0xED67,0xED47,0xED47,0xED47,0xED47,
-	0xED68,0xED68,0xED68,0xED68,0xEDA9,0x0A55,0x0A54,0x0A33,
-	0x42F1,0xF5ED,0xF60E,0xF62F,0xF650,0xF671,0xF672,0xF673,
-	0xF672,0xF672,0xF671,0xF651,0xF630,0xF610,0xF5EF,0xF5ED,
-	0xF589,0xED27,0xECE6,0xECE5,0xECE5,0xECC6,0xE4A6,0xE485,
-	0xE465,0xE425,0xE425,0xE405,0xEC27,0xF56F,0xFEF8,0xFF1A,
-	0xFE11,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,0xE4A4,
-	0xE444,0xE444,0xDC44,0xD424,0xCC26,0xD489,0xE50D,0xF58F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEE,0xF5CE,0xED8D,0xE54C,0xDD2B,
-	0xDCEB,0xD4AB,0xD469,0xD428,0xDBE7,0xDBC6,0xDBA5,0xE3C5,
-	0xE3E5,0xEC06,0xEC46,0xF486,0xF4A6,0xFCE6,0xFD05,0xFD05,
-	0xFD26,0xFD26,0xFD26,0xF526,0xF527,0xF506,0xED26,0xED06,
-	0xED05,0xECE4,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE4C7,0xE54A,
-	0xED6D,0xED2A,0xE4C6,0xE4A6,0xE4C8,0xE4C9,0xE4A9,0xE4A9,
-	0x78E1,0x7901,0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,
-	0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8921,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x1840,0x50C1,0x7921,0x9162,0x9962,0x9182,
-	0x9962,0x9982,0x9982,0x9982,0x9982,0x9982,0x9981,0x99A2,
-	0x99A1,0x9981,0x99A1,0x99A1,0x99A1,0x99A2,0x99A2,0x99A2,
-	0x99A2,0x99A2,0x99A2,0xA1A2,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A2,0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA9C2,0xA9E2,
-	0xA9E2,0xB202,0xB222,0xB222,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xBA62,0xBA82,
-	0xBA82,0xBA82,0xC283,0xC2A3,0xC2C3,0xCAE3,0xCAE3,0xCB03,
-	0xCB23,0xD323,0xD364,0xD384,0xD3A4,0xD3A3,0xD3A3,0xD3C4,
-	0xD3E5,0xDC26,0xDC68,0xE4CB,0xE52D,0xE58F,0xEDD2,0xF676,
-	0xFEFA,0xF73B,0xFF1A,0x0927,0x0968,0x0968,0x11EB,0xEE12,
-	0xEDAE,0xED69,0xED47,0xED67,0xF547,0xED47,0xF547,0xED47,
-	0xED47,0xED68,0xED68,0xED68,0xC4EB,0x0A75,0x0A55,0x0A34,
-	0x4311,0xF5ED,0xF60E,0xF62F,0xF650,0xF670,0xF672,0xF692,
-	0xF692,0xF672,0xF671,0xF651,0xEE30,0xF610,0xF5EF,0xF5EC,
-	0xF58A,0xF527,0xECE6,0xECE5,0xECE5,0xECC6,0xE4A5,0xE485,
-	0xE465,0xE445,0xE425,0xE425,0xEC26,0xED6F,0xFEF9,0xFEF9,
-	0xFE11,0xFD8A,0xFDC9,0xFE68,0xFEA7,0xFE66,0xEDA4,0xE4A4,
-	0xE444,0xE444,0xDC44,0xD424,0xCC26,0xD469,0xED0D,0xFD8F,
-	0xFDD0,0xFDF0,0xFDEF,0xFDEF,0xF5CE,0xED8D,0xE56C,0xE52B,
-	0xDCEB,0xD4AB,0xD46A,0xD428,0xDC07,0xDBA6,0xDBA5,0xE3C5,
-	0xE3E5,0xEC06,0xEC46,0xF486,0xF4A6,0xFCE6,0xFD05,0xFD05,
-	0xFD05,0xFD26,0xFD26,0xF526,0xF527,0xF506,0xED26,0xED06,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4A4,0xE4A4,0xE4E7,0xED6B,
-	0xED6D,0xED09,0xE4C5,0xE4C6,0xECC8,0xECA9,0xECA9,0xE4A9,
-	0x78E1,0x7901,0x7901,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8961,0x8941,0x8961,
-	0x8961,0x8961,0x8961,0x1020,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x1020,0x3880,0x6901,
-	0x8961,0x9982,0x9982,0x9981,0x9981,0x9982,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A2,0x99A2,0xA1A2,0xA1A2,0x9981,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA9C2,0xA9C2,0xA9E2,
-	0xA9E2,0xB202,0xB222,0xB222,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB262,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCB03,
-	0xCB23,0xCB43,0xD364,0xD384,0xD384,0xD3A3,0xD3A4,0xD3C4,
-	0xD3E5,0xDC06,0xDC48,0xDCAA,0xE50C,0xE54E,0xE5B1,0xEE34,
-	0xF6B8,0xF71A,0xF71A,0x428B,0x0948,0x0969,0x09AA,0x8C50,
-	0xEDCF,0xED8B,0xF548,0xED47,0xED67,0xED67,0xED47,0xED47,
-	0xED47,0xED47,0xED68,0xED68,0x73D0,0x0A76,0x0A55,0x0A34,
-	0x83EF,0xF5EC,0xF60D,0xF62E,0xF64F,0xF650,0xF671,0xF673,
-	0xF672,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5ED,
-	0xF58A,0xED27,0xECE6,0xED06,0xED06,0xECC5,0xE4C5,0xE4A6,
-	0xE465,0xE445,0xE425,0xE425,0xEC27,0xED6F,0xFEF8,0xFEF9,
-	0xFE11,0xFD89,0xFDC9,0xFE49,0xFE87,0xFE66,0xEDA4,0xE4A3,
-	0xE424,0xE444,0xDC44,0xD424,0xCC26,0xD469,0xED0D,0xF58F,
-	0xFDD0,0xFDF0,0xFDF0,0xFDEE,0xF5CE,0xEDAD,0xE54C,0xDD2B,
-	0xDCEB,0xDCAB,0xD46A,0xD429,0xDBE7,0xDBC6,0xDBC6,0xE3C5,
-	0xE405,0xE425,0xEC46,0xF486,0xF4C6,0xFCE6,0xFD05,0xFD25,
-	0xFD26,0xFD26,0xF526,0xF526,0xF526,0xF506,0xED26,0xED26,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4A3,0xE4A4,0xED08,0xED8D,
-	0xED6D,0xE508,0xE4C5,0xE4C6,0xE4A8,0xECA9,0xECA9,0xE4A9,
-	0x78E1,0x7901,0x7901,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8121,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8961,0x8961,0x8961,
-	0x8961,0x9161,0x9161,0x8961,0x7121,0x50C0,0x1840,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x3080,0x60E1,0x9981,0x9982,0x9982,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A2,0x99A2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1C2,0xA9C2,0xA9C2,0xA9E2,
-	0xA9E2,0xAA02,0xAA02,0xB222,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCB03,
-	0xCB23,0xCB23,0xD364,0xD364,0xD384,0xD3A3,0xD3A3,0xD3C4,
-	0xD3E5,0xD405,0xDC47,0xDCA9,0xE50B,0xE54D,0xE590,0xEDF3,
-	0xF697,0xF719,0xF73A,0x6B8E,0x0947,0x0948,0x0989,0x1A0C,
-	0xBCF0,0xEDAC,0xED89,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED47,0xED47,0xED68,0x9C4E,0x1297,0x0A76,0x0A75,0x0A34,
-	0xACAE,0xF5CC,0xF60D,0xF62E,0xF62F,0xF64F,0xF671,0xF672,
-	0xF672,0xF672,0xF672,0xF651,0xF630,0xF610,0xF60F,0xF5ED,
-	0xF56A,0xED27,0xECE6,0xED06,0xECE6,0xECC5,0xE4C5,0xE4A5,
-	0xE465,0xE445,0xE445,0xE425,0xEC27,0xED6F,0xF6D8,0xFEF9,
-	0xFE11,0xFD89,0xFDC9,0xFE49,0xFE87,0xFE66,0xEDA4,0xE4A4,
-	0xE424,0xE444,0xDC43,0xD424,0xCC25,0xD469,0xE50D,0xFD8F,
-	0xFDD0,0xFDF0,0xFDF0,0xFDEE,0xF5CE,0xEDAD,0xE56C,0xE52B,
-	0xDCEB,0xDCAB,0xD46A,0xDC29,0xDBE7,0xDBE6,0xE3C6,0xE3C5,
-	0xE405,0xEC25,0xEC66,0xF486,0xF4C6,0xF4E6,0xFD05,0xFD26,
-	0xFD26,0xFD26,0xF526,0xF527,0xF526,0xF506,0xED26,0xED26,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4A3,0xE4C5,0xED4A,0xEDAD,
-	0xED6C,0xE4C7,0xE4A5,0xE4C6,0xECA8,0xECA9,0xECA9,0xE4A9,
-	0x78E1,0x78E1,0x7900,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8101,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,0x8921,
-	0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8961,0x8961,
-	0x8961,0x8941,0x8961,0x8961,0x9161,0x9162,0x9161,0x8141,
-	0x50C0,0x1840,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x9981,0x9981,0x9982,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,
-	0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,0xA9C2,0xA9C2,0xA9E2,
-	0xA9E2,0xAA02,0xB202,0xB222,0xB242,0xB242,0xB262,0xB262,
-	0xB262,0xB262,0xB262,0xB262,0xB262,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCB04,0xCB23,0xD344,0xD364,0xD384,0xD3A3,0xD3A3,0xD3C4,
-	0xD3E4,0xD3E5,0xDC26,0xDC68,0xDCCA,0xE52C,0xED6F,0xEDD2,
-	0xF656,0xF6D9,0xF71A,0xDE57,0x0927,0x0947,0x0169,0x09AA,
-	0x09ED,0x6390,0xC4EC,0xED67,0xED67,0xED47,0xED47,0xED47,
-	0xED47,0xD509,0x63B2,0x1297,0x0A97,0x1297,0x0A76,0x2AB4,
-	0xEDCB,0xF5CC,0xF5ED,0xF60E,0xF62E,0xF62F,0xF651,0xF672,
-	0xF671,0xF672,0xF672,0xF651,0xF630,0xF610,0xF5EF,0xF5ED,
-	0xF58A,0xED27,0xED06,0xED06,0xED06,0xECE6,0xECC5,0xE4A5,
-	0xE465,0xE445,0xE445,0xE425,0xEC47,0xF570,0xFEF8,0xFEF9,
-	0xF5F0,0xFD89,0xFDE9,0xFE48,0xFE87,0xFE66,0xEDA4,0xE4A4,
-	0xE424,0xE444,0xDC44,0xCC04,0xC405,0xCC48,0xE4EC,0xFD8F,
-	0xFDD0,0xFDF0,0xFDF0,0xFE0E,0xF5CE,0xEDAD,0xE56C,0xE52B,
-	0xDCEB,0xDCAB,0xD48A,0xD449,0xDC07,0xDBE7,0xE3E6,0xE3E6,
-	0xE405,0xE425,0xEC46,0xF486,0xF4C6,0xFCE6,0xFD05,0xFD05,
-	0xFD26,0xFD26,0xF527,0xF527,0xF526,0xF506,0xED26,0xED26,
-	0xED05,0xECE5,0xE4C5,0xE4A4,0xE4A4,0xE4E6,0xED6B,0xEDAE,
-	0xE54B,0xE4C6,0xE4A5,0xE4C6,0xECC8,0xECA9,0xECA9,0xE4A9,
-	0x78E1,0x78E1,0x78E1,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8101,0x8121,0x8921,0x8921,0x8921,0x8921,0x8941,0x8921,
-	0x8921,0x8942,0x8921,0x8941,0x8941,0x8941,0x8961,0x8961,
-	0x8961,0x8941,0x8961,0x9161,0x9161,0x9161,0x9161,0x9161,
-	0x9161,0x9161,0x8141,0x50C0,0x2860,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0x9981,0xA1A2,
-	0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA9C2,0xA9C2,0xA9E2,
-	0xA9E2,0xB202,0xB202,0xB223,0xB242,0xB242,0xB242,0xB262,
-	0xB262,0xB262,0xB262,0xB262,0xB262,0xB262,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCB04,0xCB24,0xCB44,0xD364,0xD384,0xD3A3,0xD3A3,0xD3A4,
-	0xD3C4,0xD3C5,0xDC06,0xDC67,0xDCC9,0xE50C,0xE54E,0xEDB1,
-	0xEE14,0xF6B8,0xF71A,0xF71A,0x73AE,0x0947,0x0968,0x0989,
-	0x09EC,0x0A30,0x1274,0xD50A,0xED67,0xED47,0xF547,0xED47,
-	0xED47,0x9C4E,0x12B8,0x1297,0x1297,0x1297,0x1276,0xACAD,
-	0xF5CA,0xF5CB,0xF5EC,0xF60D,0xF62E,0xF62F,0xF650,0xF672,
-	0xF672,0xF672,0xF671,0xF651,0xF630,0xF610,0xF5EF,0xBCEE,
-	0xBCCC,0xB48B,0xB48B,0xB48B,0xB48B,0xB46B,0xB46B,0xB44A,
-	0xB44A,0xB42A,0xB42B,0xAC0A,0xB42B,0xBCAF,0xBD54,0xC574,
-	0xBD10,0xBCCD,0xBCEC,0xBD2C,0xBD4C,0xBD2B,0xB4CA,0xB44A,
-	0xB40A,0xB42A,0xAC2A,0xAC0A,0xA40A,0xAC2C,0xB48E,0xBCCF,
-	0xBCF0,0xFDF1,0xFDEF,0xFDEF,0xF5CE,0xED8D,0xE56C,0xE52B,
-	0xDCEB,0xDCAB,0xD48A,0xDC49,0xDC28,0xDBE7,0xE3E6,0xE3E5,
-	0xE405,0xEC26,0xEC66,0xF4A6,0xF4C6,0xF4E6,0xFD06,0xFD26,
-	0xFD26,0xFD26,0xF527,0xF527,0xF527,0xF506,0xED26,0xED26,
-	0xED05,0xECE5,0xE4E4,0xECC4,0xE4A4,0xE4E7,0xED8C,0xEDAE,
-	0xED29,0xE4A5,0xECA5,0xE4A6,0xECA8,0xECA9,0xECA9,0xE4A9,
-	0x70E1,0x7901,0x7901,0x78E1,0x8101,0x8101,0x8101,0x8121,
-	0x8121,0x8101,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8921,0x8941,0x8921,0x8941,0x8941,0x8941,0x8961,0x8961,
-	0x8961,0x8961,0x9161,0x9161,0x9161,0x9161,0x9161,0x9161,
-	0x9161,0x9182,0x9161,0x9161,0x9162,0x8941,0x58E1,0x2860,
-	0x0000,0x0000,0x2840,0x9982,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,0xA1A1,
-	0x99A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A2,
-	0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,0xA9C2,0xA9C2,0xA9E2,
-	0xAA02,0xB202,0xB202,0xB223,0xB242,0xB243,0xB242,0xB262,
-	0xBA62,0xBA62,0xB262,0xBA62,0xB262,0xB262,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xCAE4,0xCAE3,
-	0xCB03,0xCB24,0xCB44,0xD344,0xD383,0xD3A3,0xD3A4,0xD3A4,
-	0xD3C4,0xD3C4,0xDC06,0xDC47,0xDCA9,0xE50B,0xE54D,0xE591,
-	0xEDF3,0xF696,0xF6F9,0xF73A,0xEE98,0x324A,0x0948,0x0969,
-	0x09CB,0x0A0E,0x3AF2,0xED89,0xED67,0xED46,0xED47,0xED47,
-	0xED47,0xB4AB,0x12B8,0x1298,0x1297,0x1297,0x6391,0xF58A,
-	0xF5CA,0xF5CB,0xF5CC,0xF60D,0xF62E,0xF62E,0xF64F,0xF671,
-	0xF671,0xF671,0xF671,0xF651,0xF630,0xF610,0xF60F,0x0A12,
-	0x0A75,0x12D8,0x12F9,0x12F9,0x12F9,0x1B19,0x1B3A,0x1B5A,
-	0x1B79,0x1B9A,0x1BBA,0x1BB9,0x1B98,0x1290,0x0147,0x0127,
-	0x020F,0x0275,0x0236,0x01B6,0x0178,0x0999,0x125B,0x1B5B,
-	0x1BBB,0x1BBB,0x239B,0x2BFC,0x3C1B,0x33B7,0x1B13,0x0270,
-	0x022E,0xFDF1,0xFE10,0xFE0F,0xF5CE,0xED8D,0xED6C,0xE52B,
-	0xDCEB,0xDCAB,0xD46A,0xDC49,0xDC28,0xDC07,0xE3E6,0xE3E6,
-	0xE405,0xEC26,0xEC66,0xF4A6,0xF4C6,0xFCE6,0xFD06,0xFD06,
-	0xFD26,0xFD26,0xFD47,0xF527,0xF527,0xF506,0xED26,0xED25,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4C4,0xE528,0xEDAE,0xEDAD,
-	0xED08,0xE4A4,0xE4A5,0xECA6,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x7901,0x78E1,0x78E1,0x7901,0x8101,0x8101,0x8101,0x8101,
-	0x8121,0x8101,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8941,0x8961,
-	0x8961,0x8961,0x9161,0x9160,0x9161,0x9161,0x9161,0x9161,
-	0x9161,0x9181,0x9161,0x9161,0x9162,0x9162,0x9962,0x9961,
-	0x8141,0x2840,0x2060,0x9982,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0xA1A1,0x99A1,0x99A1,0x99A1,0x99A1,0xA1A1,
-	0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1A1,0xA1A1,0xA1A1,0xA1A2,
-	0xA1A2,0xA1C2,0xA1C2,0xA1C2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,
-	0xAA02,0xB202,0xB202,0xB223,0xB242,0xB243,0xB242,0xB262,
-	0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xB262,0xB262,0xB262,
-	0xB242,0xB262,0xB262,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCB03,0xCB24,0xCB43,0xD364,0xD384,0xD3A3,0xD3A3,0xD3A4,
-	0xD3C4,0xD3C4,0xDBE5,0xDC26,0xDC88,0xE4CA,0xE52D,0xE570,
-	0xEDB2,0xEE35,0xF6D9,0xF73A,0xFF1A,0xE697,0x52EC,0x0968,
-	0x09AA,0x09ED,0x73D0,0xF5AA,0xED88,0xED66,0xED47,0xED47,
-	0xF547,0xED47,0x12B8,0x1298,0x1297,0x7BEF,0xED88,0xF589,
-	0xF5AA,0xF5AA,0xF5CC,0xF5ED,0xF60E,0xF62E,0xF62F,0xF651,
-	0xF671,0xF651,0xF672,0xF651,0xF630,0xF610,0xF60F,0x0A12,
-	0x0A75,0x12D8,0x12F9,0x12F9,0x12F9,0x1319,0x1B3A,0x1B5A,
-	0x1B7A,0x1B9A,0x1BBA,0x1BBA,0x1398,0x0A90,0x0147,0x0127,
-	0x020F,0x0295,0x0236,0x01B7,0x0178,0x0999,0x125B,0x1B5B,
-	0x1BBB,0x1B9B,0x23BB,0x2BDC,0x3BFB,0x33B7,0x1313,0x0270,
-	0x022E,0xFDF1,0xFE10,0xFDEF,0xF5CE,0xED8D,0xE56C,0xE52B,
-	0xDCEB,0xDCAB,0xDC8A,0xDC69,0xDC28,0xDC07,0xE3E6,0xE3E6,
-	0xE405,0xEC45,0xEC66,0xF4A6,0xF4C6,0xFCE6,0xFD06,0xFD26,
-	0xFD26,0xFD46,0xFD47,0xF527,0xF527,0xF506,0xED26,0xED25,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4C5,0xED4A,0xEDCF,0xED8D,
-	0xE4E7,0xE4A5,0xECA5,0xE4A6,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x70E1,0x78E1,0x78E1,0x78E1,0x7901,0x8101,0x8101,0x8101,
-	0x8121,0x8101,0x8121,0x8121,0x8921,0x8941,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,0x8961,
-	0x8961,0x8961,0x8961,0x9161,0x9161,0x9182,0x9161,0x9161,
-	0x9181,0x9161,0x9161,0x9161,0x9162,0x8941,0x58E1,0x3060,
-	0x0000,0x0000,0x2060,0x9981,0x9981,0x9981,0x9981,0x9981,
-	0x9981,0x9981,0x99A1,0x99A1,0x99A1,0x99A1,0xA1A1,0xA1A2,
-	0xA1C2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,0xA1A1,0xA1A2,0xA1A2,
-	0xA1C2,0xA1C2,0xA1C2,0xA9C2,0xA9C2,0xA9C2,0xA9E2,0xB1E2,
-	0xB202,0xB202,0xB202,0xB222,0xB242,0xBA43,0xB263,0xBA62,
-	0xBA62,0xBA62,0xBA62,0xBA82,0xBA82,0xBA62,0xB262,0xB262,
-	0xB242,0xB262,0xB262,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA83,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB24,0xCB44,0xD344,0xD384,0xD3A3,0xD3C3,0xD3A4,
-	0xD3C4,0xD3C4,0xD3E4,0xDC06,0xDC67,0xE4A9,0xE50C,0xE56F,
-	0xED91,0xEE14,0xF6B8,0xF71A,0xFF1A,0xF6F9,0xF6D8,0xBD53,
-	0x42AC,0x09EC,0xC52F,0xEDAB,0xED88,0xED67,0xED67,0xED47,
-	0xED47,0xED47,0x4B54,0x63B2,0xD50A,0xED68,0xED68,0xF589,
-	0xF5AA,0xF5AA,0xF5CB,0xF5EC,0xF60D,0xF62E,0xF62F,0xF650,
-	0xF651,0xF671,0xF651,0xF651,0xF630,0xF610,0xF60F,0x0A12,
-	0x0A75,0x12D8,0x12F9,0x12F9,0x12F9,0x1319,0x1B39,0x1B59,
-	0x1B7A,0x1B9A,0x1BBA,0x1BB9,0x1398,0x0A90,0x0147,0x0127,
-	0x020F,0x0296,0x0236,0x01B7,0x0178,0x0999,0x125B,0x1B5B,
-	0x1BBB,0x1B9B,0x239B,0x2BFC,0x3C1B,0x2BB8,0x1B33,0x0270,
-	0x022F,0xFDF1,0xFE10,0xFDEF,0xF5AE,0xED8D,0xE56C,0xDD2B,
-	0xDCEC,0xDCCB,0xDC8A,0xDC69,0xDC28,0xDC07,0xE3E6,0xE406,
-	0xE405,0xEC46,0xEC66,0xF4A6,0xF4C6,0xFCE6,0xF506,0xFD26,
-	0xFD26,0xFD26,0xFD47,0xF527,0xF527,0xF506,0xED06,0xED25,
-	0xED05,0xECE5,0xE4E4,0xE4C4,0xE4E6,0xED8C,0xEDCF,0xED6C,
-	0xE4C5,0xE4A4,0xECA5,0xECA7,0xECA8,0xECA9,0xECAA,0xECA9,
-	0x70E1,0x78E1,0x78E1,0x78E1,0x7901,0x7901,0x8101,0x8101,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8941,0x8921,0x8921,
-	0x8921,0x8941,0x8921,0x8921,0x8921,0x8941,0x8941,0x8961,
-	0x8961,0x8961,0x9161,0x9181,0x9181,0x9181,0x9181,0x9181,
-	0x9162,0x9161,0x8141,0x50C1,0x2860,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9982,0x9982,0x9982,0x9981,0x9981,
-	0x9981,0xA1A1,0x99A1,0x99A1,0x99A1,0x99A2,0xA1A1,0xA1A1,
-	0xA1A1,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1A2,0xA1A1,0xA1C2,
-	0xA1C2,0xA1C2,0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA43,0xB262,0xBA62,
-	0xBA62,0xBA62,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,0xB262,
-	0xB262,0xBA62,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA83,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE4,0xCB24,0xCB24,0xD344,0xD364,0xD3A4,0xD3A3,0xD3C4,
-	0xD3C4,0xD3A4,0xD3C4,0xD405,0xDC46,0xE488,0xE4EB,0xE54E,
-	0xE590,0xEDF3,0xF676,0xF6D9,0xF73A,0xF71A,0xFEB8,0xFEB7,
-	0xF696,0xDDB3,0xF611,0xEDCD,0xEDA9,0xF587,0xF547,0xED47,
-	0xED47,0xED47,0xED47,0xED47,0xED67,0xF567,0xED68,0xED89,
-	0xF589,0xF5AA,0xF5CB,0xF5EC,0xF5ED,0xF60D,0xF62F,0xF650,
-	0xF651,0xF651,0xF651,0xF651,0xF610,0xF60F,0xF5EF,0x0A12,
-	0x0A74,0x12D7,0x12F9,0x12F9,0x12F9,0x1B19,0x1B39,0x1B3A,
-	0x1B7A,0x1B9A,0x1B9A,0x1BBA,0x1B99,0x1290,0x0148,0x0127,
-	0x020F,0x02B6,0x0236,0x01B6,0x0178,0x0199,0x125B,0x1B5B,
-	0x1BBB,0x1BBB,0x239B,0x33FC,0x3C1B,0x33D8,0x1B34,0x0A70,
-	0x022F,0xFDF1,0xFDEF,0xFDEF,0xF5CE,0xED8D,0xE54C,0xE52C,
-	0xDCEB,0xDCAB,0xDC8B,0xDC6A,0xDC49,0xE427,0xE407,0xE406,
-	0xE405,0xEC25,0xF466,0xF486,0xF4C6,0xFD06,0xFD06,0xFD26,
-	0xFD26,0xFD26,0xF527,0xF527,0xF527,0xF506,0xED26,0xED25,
-	0xED05,0xECE5,0xE4C4,0xE4C4,0xE507,0xEDAD,0xEDCF,0xED4B,
-	0xE4C5,0xE4A4,0xECA5,0xECA7,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x7901,0x7901,0x7901,0x78E1,0x78E1,0x7901,0x8101,0x8101,
-	0x8101,0x8101,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8941,0x8921,0x8921,0x8921,0x8941,0x8941,0x8961,
-	0x8961,0x8961,0x9161,0x9161,0x9181,0x9181,0x9182,0x8141,
-	0x48C1,0x1840,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x9982,0x9981,0x9982,0x9981,0x9981,
-	0x9981,0x9981,0x99A1,0x99A1,0xA1A1,0x99A2,0xA1A2,0xA1A1,
-	0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1A2,0xA1A2,
-	0xA1C2,0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA43,0xBA62,0xBA62,
-	0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,
-	0xB262,0xBA62,0xBA62,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA82,0xC2A2,0xC2A3,0xC2A3,0xC2C3,0xCAC4,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xD344,0xD364,0xD383,0xD3A3,0xD3C4,
-	0xD3C4,0xD3A4,0xD3C4,0xD3E5,0xDC26,0xDC88,0xE4CA,0xE52D,
-	0xE56F,0xEDD2,0xEE55,0xF6B8,0xF71A,0xFF1A,0xFEF9,0xF6B8,
-	0xF697,0xF675,0xF632,0xEDEE,0xEDCA,0xED87,0xED47,0xED47,
-	0xF547,0xED47,0xED47,0xED47,0xED47,0xED47,0xF568,0xF588,
-	0xF589,0xF5AA,0xF5AB,0xF5CB,0xF5EC,0xF60D,0xF62E,0xF630,
-	0xF651,0xF651,0xF651,0xF631,0xF610,0xF610,0xF5EF,0x0A12,
-	0x0A75,0x0AB7,0x12F9,0x12F9,0x12F9,0x12F9,0x1B1A,0x1B3A,
-	0x1B59,0x1B9A,0x1B99,0x1BB9,0x1B98,0x0A90,0x0168,0x0148,
-	0x020F,0x0295,0x0236,0x01D6,0x0177,0x01B9,0x125B,0x1B5B,
-	0x1BBB,0x1B9B,0x239B,0x2BFC,0x3C3B,0x33D9,0x1B34,0x0A91,
-	0x020F,0xFDF1,0xFE0F,0xFDEF,0xF5CE,0xEDAD,0xE54C,0xE52C,
-	0xDCEC,0xDCCB,0xDCAB,0xDC6A,0xDC49,0xE428,0xE407,0xE406,
-	0xEC25,0xEC46,0xF466,0xF4A6,0xF4C6,0xF506,0xFD06,0xFD26,
-	0xFD26,0xFD46,0xF527,0xF507,0xF507,0xF506,0xED26,0xED05,
-	0xECE5,0xECE5,0xE4C4,0xE4C4,0xE528,0xEDCE,0xEDCF,0xED29,
-	0xE4A4,0xE4A4,0xE4A5,0xECA7,0xECA8,0xECC9,0xECAA,0xE4A9,
-	0x7901,0x7901,0x7901,0x7900,0x7901,0x8101,0x8101,0x8101,
-	0x8101,0x8101,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,0x8941,
-	0x8961,0x8961,0x9161,0x9161,0x8141,0x50E1,0x1840,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x2060,0x58E1,0x9982,0x9981,0x9982,0x9981,0x9981,
-	0x9981,0x9981,0x99A1,0x99A1,0xA1A1,0xA1A2,0xA1A2,0xA1A1,
-	0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA1C2,
-	0xA9C2,0xA9C2,0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA42,0xBA62,0xBA62,
-	0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,
-	0xBA62,0xBA62,0xBA62,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA82,0xC2A2,0xC2A3,0xC2A3,0xC2C3,0xCAC4,0xCAE3,
-	0xCAE3,0xCB03,0xCB23,0xD344,0xD364,0xD383,0xD3A3,0xD3C4,
-	0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xDC05,0xDC67,0xE4A9,0xE50C,
-	0xE54E,0xEDB1,0xEE14,0xF697,0xF719,0xFF19,0xFF19,0xF6D8,
-	0xF6B7,0xF696,0xF654,0xF610,0xEDCC,0xED88,0xED67,0xED47,
-	0xED47,0xED47,0xED47,0xED47,0xED47,0xED67,0xED67,0xF568,
-	0xF589,0xF589,0xF5AA,0xF5CB,0xF5EC,0xF60C,0xF60E,0xF62F,
-	0xF651,0xF651,0xF651,0xF630,0xF60F,0xF60F,0xF5EF,0x0A12,
-	0x0A75,0x0AB7,0x12F9,0x12D9,0x12F9,0x1B19,0x1B1A,0x1B39,
-	0x1B59,0x1B9A,0x1B9A,0x1BB9,0x1B98,0x0A90,0x0148,0x0148,
-	0x020F,0x0295,0x0236,0x01D7,0x0178,0x0199,0x125B,0x1B5B,
-	0x1BBB,0x1B9B,0x239B,0x2BFC,0x3C3C,0x33F9,0x1B35,0x0291,
-	0x022F,0xFDF1,0xFDEF,0xFDEF,0xF5CE,0xED8D,0xE54C,0xE52C,
-	0xDCEB,0xDCCB,0xDCAB,0xDC6A,0xDC49,0xE428,0xE407,0xE406,
-	0xEC26,0xEC45,0xF466,0xF4A6,0xF4C6,0xFD06,0xFD06,0xFD27,
-	0xFD46,0xFD46,0xF527,0xF507,0xF507,0xF506,0xED06,0xED05,
-	0xECE5,0xECE5,0xE4C4,0xE4C5,0xE54A,0xF5F0,0xEDAE,0xE507,
-	0xE4A4,0xE4A4,0xE4A5,0xECA7,0xECA8,0xECC9,0xECAA,0xE4A9,
-	0x7921,0x7921,0x7901,0x7901,0x7901,0x7901,0x8101,0x8101,
-	0x8101,0x8101,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8941,0x8941,
-	0x8941,0x8941,0x9161,0x1020,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x1020,0x3880,0x6901,
-	0x8961,0x9982,0x9981,0x9982,0x9982,0x9982,0x9981,0x9982,
-	0x9981,0x9981,0x9981,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,
-	0xA1C2,0xA1C2,0xA1C2,0xA1E2,0xA1C1,0xA1C1,0xA1C2,0xA9E2,
-	0xA9C2,0xA9E2,0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA42,0xBA63,0xBA62,
-	0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,
-	0xB262,0xBA62,0xBA62,0xBA62,0xB262,0xBA62,0xBA62,0xBA62,
-	0xBA83,0xBA82,0xC2A2,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAC3,
-	0xCAE3,0xCB04,0xCB24,0xD344,0xD364,0xD383,0xD3A3,0xD3C4,
-	0xD3C4,0xD3C4,0xD3A4,0xD3C4,0xDBE5,0xDC46,0xE4A9,0xE4EB,
-	0xE52D,0xE590,0xEDD3,0xF656,0xF6D8,0xF71A,0xEEB8,0x9CB2,
-	0x52ED,0x11AA,0x098A,0x09CD,0x2A92,0x6391,0xB4AC,0xED47,
-	0xED47,0xED47,0xED47,0xED47,0xED47,0xED47,0xED48,0xF568,
-	0xF568,0xF589,0xF58A,0xF5CB,0xF5EC,0xF5EC,0xF60D,0xF62F,
-	0xF630,0xF651,0xF650,0xF630,0xF60F,0xF610,0xF5EF,0x0A12,
-	0x1274,0x12B7,0x12F9,0x12D9,0x2318,0x4B74,0x4B95,0x4B94,
-	0x4BB4,0x4BD4,0x4BD5,0x4BD4,0x4BD4,0x4B30,0x42AC,0x42AC,
-	0x4310,0x4332,0x4313,0x42D3,0x42B4,0x42D4,0x4335,0x4BB5,
-	0x4BD5,0x4BD5,0x53D6,0x53F6,0x5C16,0x5BF4,0x4B92,0x4350,
-	0x430F,0xFDF1,0xFDF0,0xFDEE,0xF5CE,0xED8D,0xE56C,0xE52C,
-	0xDD0B,0xDCCB,0xDCAB,0xDC8A,0xDC49,0xE428,0xE407,0xE406,
-	0xE425,0xEC46,0xEC66,0xF4A6,0xF4E6,0xFD06,0xFD06,0xFD26,
-	0xFD26,0xFD47,0xF527,0xF527,0xF527,0xF506,0xED06,0xED05,
-	0xECE5,0xECC4,0xE4C4,0xECE5,0xED8C,0xF5F0,0xED8C,0xE4E6,
-	0xE4A3,0xE4A5,0xECA6,0xECA7,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x7920,0x8121,0x7921,0x8121,0x8121,0x8101,0x8101,0x8101,
-	0x8101,0x8121,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8922,0x8922,0x8921,0x8941,
-	0x9161,0x8961,0x8961,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x1840,0x50C1,0x7921,0x9161,0x9962,0x9981,
-	0x9981,0x9981,0x9982,0x9982,0x9982,0x9982,0x99A1,0x9981,
-	0x99A2,0x99A2,0x99A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,
-	0xA1C2,0xA1C2,0xA1C2,0xA1C1,0xA1C1,0xA9C2,0xA9E2,0xA9E2,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA42,0xBA62,0xBA62,
-	0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xB262,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A2,0xC2C3,0xC2C3,0xCAE3,0xCAC3,
-	0xCAE3,0xCB04,0xCB24,0xD344,0xD363,0xD384,0xD3A3,0xD3C4,
-	0xD3A4,0xD3C4,0xD3C4,0xD3C4,0xDBE5,0xDC26,0xDC88,0xE4CA,
-	0xE52C,0xED6F,0xEDD2,0xEE35,0xF6B8,0xAD33,0x1146,0x0906,
-	0x0928,0x0948,0x098A,0x09AC,0x09F1,0x1235,0x1297,0x4B54,
-	0xDD28,0xED47,0xED47,0xED47,0xED47,0xED47,0xED48,0xED68,
-	0xF588,0xF589,0xF58A,0xF5AA,0xF5CB,0xF5EC,0xF60D,0xF60E,
-	0xF630,0xF630,0xF630,0xF630,0xF60F,0xF60F,0xF5EF,0x0A12,
-	0x0A54,0x12D7,0x12F9,0x12D9,0x4B74,0xED06,0xE4E6,0xE4C6,
-	0xE4A6,0xE485,0xE465,0xE446,0xEC66,0xF56F,0xFE96,0xFEB7,
-	0xFDF0,0xFD6A,0xFDC9,0xFE49,0xFE87,0xF646,0xEDA4,0xE4A4,
-	0xE444,0xE464,0xE464,0xD403,0xC3C3,0xCC05,0xE4AA,0xFD4E,
-	0xFDD0,0xFDF1,0xFDF0,0xFDEF,0xF5CE,0xED8D,0xE56C,0xE52C,
-	0xDD0B,0xDCCB,0xDCAB,0xDC8A,0xE469,0xE428,0xE427,0xE406,
-	0xE425,0xEC46,0xEC66,0xF4A6,0xF4C6,0xF506,0xFD06,0xFD26,
-	0xFD26,0xFD27,0xF527,0xF527,0xF527,0xF506,0xED05,0xED05,
-	0xECE5,0xECE5,0xE4C4,0xED06,0xEDCE,0xEE10,0xED6B,0xE4C6,
-	0xE4C4,0xECC4,0xECA6,0xECA7,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x8120,0x8120,0x8121,0x8121,0x8101,0x8121,0x8101,0x8101,
-	0x8101,0x8121,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8942,0x8922,0x8921,0x8941,
-	0x8941,0x8961,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1020,0x58E1,0x8961,0x9181,0x9961,0x9161,0x9961,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9982,0x9982,0x9981,0x9981,
-	0x99A2,0x99A2,0x99A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,
-	0xA1C2,0xA1C2,0xA1C2,0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,
-	0xB202,0xB202,0xB202,0xB222,0xB222,0xBA42,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xBAA2,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A2,0xC2C3,0xC2C3,0xCAE3,0xCAC3,
-	0xCAE3,0xCB04,0xCB24,0xD344,0xD364,0xD384,0xD3A3,0xD3C4,
-	0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xDBE5,0xDC25,0xDC47,0xE4C9,
-	0xE50B,0xED4E,0xEDB1,0xEE13,0xACF2,0x0906,0x00E5,0x00E6,
-	0x0927,0x0948,0x0969,0x098B,0x09CF,0x0A13,0x1277,0x12B8,
-	0x22D7,0xD4E9,0xED47,0xED47,0xED47,0xED47,0xED47,0xF568,
-	0xF588,0xF589,0xF589,0xF5AA,0xF5CB,0xF5EB,0xF60C,0xF60E,
-	0xF60F,0xF630,0xF630,0xF630,0xEE0F,0xF60F,0xF5EF,0x0A12,
-	0x0A54,0x12D7,0x12F9,0x12D9,0x4B74,0xED06,0xE4E6,0xECC5,
-	0xE4A6,0xE485,0xE466,0xE466,0xEC67,0xF56E,0xFE97,0xFEB7,
-	0xFDD0,0xFD6A,0xFDC9,0xFE48,0xFE87,0xF646,0xEDA4,0xE4A4,
-	0xE444,0xE464,0xE464,0xD403,0xC3C3,0xCC05,0xE4AA,0xFD4E,
-	0xFDD0,0xFDF1,0xFDF0,0xFDEE,0xF5CE,0xED8D,0xE56C,0xE52C,
-	0xDCEB,0xDCCB,0xDCAB,0xDC8A,0xE469,0xE448,0xCC29,0xB40B,
-	0xB40B,0xB42B,0xB42A,0xBC4B,0xBC6B,0xBC8B,0xBC8B,0xCCAA,
-	0xFD26,0xFD47,0xF527,0xF527,0xF527,0xF506,0xED05,0xECE5,
-	0xECE5,0xECE5,0xECC4,0xED28,0xEDEF,0xEDF0,0xED4A,0xE4C5,
-	0xE4C4,0xECC5,0xECA6,0xECA7,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x8140,0x8140,0x8120,0x8120,0x8121,0x8121,0x8121,0x8121,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8921,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8942,0x8922,0x8921,0x8941,
-	0x8941,0x9161,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x1840,0x40A0,0x68E1,0x9982,0x9981,
-	0x9981,0x9981,0x9981,0x9981,0x9982,0xA1A2,0x9981,0x99A2,
-	0x99A2,0x99A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,
-	0xA1A2,0xA1C2,0xA1C2,0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,
-	0xB202,0xB202,0xB202,0xB223,0xB222,0xBA42,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xC2A2,0xC2A2,0xC2C3,0xC2C3,0xCAE3,0xCAC3,
-	0xCAE3,0xCB04,0xCB23,0xCB43,0xD364,0xD384,0xD3A3,0xD3C4,
-	0xD3C4,0xD3C4,0xD3C3,0xD3C4,0xDBE4,0xDC05,0xDC46,0xE4A9,
-	0xE4EB,0xE52D,0xE590,0xDDB2,0x19EA,0x0927,0x08E5,0x0105,
-	0x0907,0x0948,0x0949,0x098A,0x09CD,0x0A12,0x1256,0x1298,
-	0x12B8,0x4B54,0xED47,0xED47,0xED47,0xED47,0xED47,0xED67,
-	0xF568,0xF568,0xED69,0xF58A,0xF5CA,0xF5EB,0xF5EC,0xF60D,
-	0xF60F,0xF630,0xF630,0xF610,0xF60F,0xF60F,0xF5EF,0x0A12,
-	0x0A54,0x12D7,0x12F9,0x12D9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECA6,0xE485,0xEC66,0xE466,0xEC67,0xED6E,0xFE96,0xFEB7,
-	0xFDF0,0xFD6A,0xFDC9,0xFE48,0xFE87,0xFE46,0xF584,0xE4A4,
-	0xE444,0xE464,0xE464,0xD403,0xC3A2,0xCBE5,0xE4AA,0xFD4E,
-	0xFDD0,0xFDF1,0xFDF0,0xF5CE,0xF5CE,0xED8D,0xE56C,0xE52C,
-	0xDCEB,0xDCCB,0xD48C,0x942E,0x5BD2,0x1BB7,0x1BD8,0x1BD8,
-	0x13B9,0x13B9,0x1379,0x0B39,0x0B19,0x0AF9,0x0AF8,0x4374,
-	0xFD47,0xFD47,0xF527,0xF527,0xF527,0xF506,0xED05,0xECE5,
-	0xECE4,0xE4E4,0xECE5,0xED69,0xEE10,0xEDEF,0xED28,0xE4C4,
-	0xECC4,0xECA5,0xECA6,0xECA7,0xECA8,0xECA9,0xECAA,0xE4A9,
-	0x8140,0x8140,0x8140,0x8140,0x8121,0x8121,0x8121,0x8120,
-	0x8121,0x8121,0x8121,0x8121,0x8121,0x8121,0x8921,0x8921,
-	0x8921,0x8941,0x8921,0x8921,0x8922,0x8921,0x8921,0x8921,
-	0x8941,0x9161,0x8961,0x3880,0x1840,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2060,
-	0x48C0,0x7941,0x9982,0x9981,0x9961,0x9982,0x9981,0x99A1,
-	0x99A1,0xA1A1,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,0xA1C2,
-	0xA1A2,0xA9C2,0xA9C2,0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,0xB1E2,
-	0xB202,0xB202,0xB222,0xBA23,0xB222,0xBA43,0xBA62,0xBA62,
-	0xBA82,0xBA83,0xBA83,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBA82,
-	0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,0xBA62,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBAA3,0xBAA2,0xC2C3,0xC2C3,0xC2C3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xCB44,0xD364,0xD384,0xD3A4,0xD3C4,
-	0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xD3E4,0xDC04,0xDC26,0xDC68,
-	0xE4CA,0xE52C,0xED6F,0x7BF0,0x11CB,0x0148,0x0105,0x08E6,
-	0x632D,0x9CB2,0xBD53,0xBD52,0x8C50,0x42F0,0x1235,0x1297,
-	0x12B8,0x0AB8,0xAC6C,0xED47,0xED47,0xED47,0xED47,0xF567,
-	0xF568,0xF568,0xED69,0xF589,0xF5AA,0xF5CA,0xF5EC,0xF60D,
-	0xF60E,0xF62F,0xF630,0xF60F,0xF60F,0xF60F,0xF5EF,0x0A32,
-	0x0A54,0x0AB7,0x12F9,0x12D9,0x4B74,0xED06,0xED06,0xE4E6,
-	0xE4C6,0xE4A6,0xE466,0xEC46,0xEC86,0xED6E,0xFE75,0xFE96,
-	0xFDCF,0xF58A,0xFDC9,0xFE49,0xFE88,0xFE46,0xEDA4,0xE4A4,
-	0xE444,0xE484,0xE464,0xD403,0xC3A2,0xCBE5,0xE4A9,0xFD4D,
-	0xFDD0,0xFDF1,0xFE10,0xFDEF,0xF5CE,0xEDAE,0xE56D,0xE54C,
-	0xDD0C,0x8C2F,0x2B53,0x2355,0x1B96,0x1BB6,0x1BD8,0x1BD8,
-	0x1BD9,0x13B9,0x1379,0x0B59,0x0319,0x0B19,0x02F9,0x4374,
-	0xFD27,0xFD47,0xF527,0xF507,0xF506,0xF506,0xED05,0xECE5,
-	0xECE5,0xECE4,0xE4E5,0xED8B,0xF611,0xEDAE,0xED07,0xE4C4,
-	0xECC4,0xECA4,0xEC86,0xEC87,0xECA8,0xECA9,0xE4AA,0xE4A9,
-	0x8140,0x8140,0x8140,0x8141,0x8141,0x8120,0x8120,0x8120,
-	0x8141,0x8141,0x8141,0x8141,0x8141,0x8941,0x8921,0x8921,
-	0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,0x8921,
-	0x8941,0x8961,0x8961,0x9162,0x9161,0x7941,0x5901,0x3880,
-	0x1020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x9981,0x9982,0x9982,0x9981,0x9981,
-	0xA1A1,0xA1C2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA1C2,
-	0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,
-	0xB202,0xB202,0xB223,0xB223,0xB222,0xBA43,0xBA62,0xBA62,
-	0xBA82,0xBA83,0xBAA3,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA2,
-	0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,0xBA82,0xBA82,
-	0xBA82,0xBAA3,0xBAA3,0xC2A2,0xC2C3,0xC2C3,0xC2C3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xD344,0xD364,0xD384,0xD3A4,0xD3C4,
-	0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xDC04,0xDC26,0xDC47,
-	0xE4A9,0xE50B,0xE56E,0x2ACF,0x120C,0x0969,0x1167,0xCDF6,
-	0xFF19,0xF6D8,0xFEB7,0xF6B6,0xF674,0xF630,0x9C6E,0x1276,
-	0x12B8,0x0AB8,0x5373,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xF568,0xF568,0xED69,0xF589,0xF5AA,0xF5CA,0xF5EB,0xF5ED,
-	0xF60D,0xF60F,0xF610,0xF60F,0xF60E,0xF5EF,0xF5EE,0x0A32,
-	0x0A54,0x0AB7,0x12F9,0x12D9,0x4B74,0xED06,0xED06,0xE4E6,
-	0xECC6,0xE4A6,0xE485,0xE446,0xE486,0xF56E,0xFE75,0xFE96,
+	0xC003,0x8891,0xA2AC,0x8003,0xED47,0x8003,0xED68,0x0005,
+	0xEDA9,0x0A55,0x0A54,0x0A33,0x42F1,0xF5ED,0xC01A,0xADAD,
+	0xADAD,0xA5A5,0xA3A4,0xA39C,0x9B9C,0x9BA2,0x884A,0x93A3,
+	0xA49D,0x5C9B,0x9C94,0xA49C,0xEE00,0x000A,0xF56F,0xFEF8,
+	0xFF1A,0xFE11,0xFD8A,0xFDC9,0xFE48,0xFEA7,0xFE66,0xEDA4,
+	0xE4A4,0xC005,0x8CA4,0x645C,0x66FF,0x0001,0xE50D,0xF58F,
+	0xC017,0xF5AC,0xA3A3,0x5C53,0x535B,0x9454,0x9293,0xD39B,
+	0x9BEC,0xACED,0xB4F4,0xACF4,0xABA4,0x8002,0xFD26,0xC00B,
+	0x64A5,0x9B6C,0x9CA3,0x9B64,0x9C9C,0xA4AF,0x0000,0xE54A,
+	0xC007,0xEF91,0x489C,0xAEA5,0x9CA4,0x0001,0x78E1,0x7901,
+	0x8005,0x8101,0x0001,0x8121,0x8121,0x8006,0x8921,0x8008,
+	0x8941,0x0000,0x9161,0x8006,0x0000,0x0006,0x1840,0x50C1,
+	0x7921,0x9162,0x9962,0x9182,0x9962,0x8004,0x9982,0xC003,
+	0xA3AD,0xA39C,0x8002,0x99A1,0x8005,0x99A2,0x0001,0xA1A2,
+	0x9981,0x8003,0xA1A2,0x0000,0xA1A1,0x8002,0xA1A2,0xC004,
+	0xACE4,0xACA4,0xEC00,0x8003,0xB222,0x800F,0xB242,0x0000,
+	0xBA62,0x8002,0xBA82,0xC014,0xE5AC,0xACEC,0xA4AC,0xACE4,
+	0xB5AC,0xACA3,0xA4AD,0xADF5,0xB6FF,0xBEBE,0xF700,0x000A,
+	0xF676,0xFEFA,0xF73B,0xFF1A,0x0927,0x0968,0x0968,0x11EB,
+	0xEE12,0xEDAE,0xED69,0xC006,0x9AAC,0xDC64,0xE464,0xA400,
+	0x8002,0xED68,0x0005,0xC4EB,0x0A75,0x0A55,0x0A34,0x4311,
+	0xF5ED,0xC01A,0xADAD,0xADAC,0xA6AC,0xA49C,0xA39C,0x5BDC,
+	0x9BA1,0x8A89,0x53A3,0xA49D,0x5B9C,0x9C9C,0x9CA4,0xE500,
+	0x000A,0xED6F,0xFEF9,0xFEF9,0xFE11,0xFD8A,0xFDC9,0xFE68,
+	0xFEA7,0xFE66,0xEDA4,0xE4A4,0xC005,0x8CA4,0x645C,0x66F7,
+	0x0001,0xED0D,0xFD8F,0xC015,0xB5AC,0xA3A4,0x5B53,0x5B93,
+	0x5454,0x9392,0xDB8B,0xA3EC,0xACED,0xB4F4,0xACF4,0x8002,
+	0xFD05,0xC00D,0xADA4,0x64A5,0x9B6C,0x9CA3,0x9C63,0x9C9C,
+	0xA4B7,0x0000,0xED6B,0xC007,0xA688,0x50A5,0xE69D,0xA464,
+	0x0002,0x78E1,0x7901,0x7901,0x8003,0x8101,0x8002,0x8121,
+	0x8003,0x8921,0x0000,0x8941,0x8002,0x8921,0x8002,0x8941,
+	0x0001,0x8961,0x8941,0x8003,0x8961,0x0000,0x1020,0x8008,
+	0x0000,0x0004,0x1020,0x3880,0x6901,0x8961,0x9982,0xC003,
+	0xA4A3,0xA4A5,0x8004,0x9981,0x8004,0x99A1,0xC004,0xA5A4,
+	0xE4A4,0x5B00,0x8002,0xA1A2,0xC009,0xA3A4,0xA5A4,0xACE4,
+	0xA4AC,0xA4EC,0x8003,0xB222,0x8003,0xB242,0x0000,0xB262,
+	0x8008,0xB242,0xC01A,0xACA4,0xE4A4,0xACA4,0xECA5,0xACA4,
+	0xECAC,0xACAC,0xEDAC,0xA4AB,0xA5AC,0xADED,0xB6BE,0xFEB6,
+	0xBF00,0x0009,0xEE34,0xF6B8,0xF71A,0xF71A,0x428B,0x0948,
+	0x0969,0x09AA,0x8C50,0xEDCF,0xC004,0x90D1,0x63AC,0xA400,
+	0x8003,0xED47,0x0007,0xED68,0xED68,0x73D0,0x0A76,0x0A55,
+	0x0A34,0x83EF,0xF5EC,0xC005,0xADAD,0xADA5,0xADA6,0x8002,
+	0xF672,0xC011,0x9B9B,0x9C9B,0xA289,0x4993,0xACA4,0x9364,
+	0x9D93,0x9C9C,0xA4E6,0x000A,0xED6F,0xFEF8,0xFEF9,0xFE11,
+	0xFD89,0xFDC9,0xFE49,0xFE87,0xFE66,0xEDA4,0xE4A3,0xC005,
+	0x85AC,0x645C,0x66F7,0x0001,0xED0D,0xF58F,0xC019,0xF5AC,
+	0xA4A2,0x5C5B,0x4B5B,0x9494,0x5393,0xD29B,0xA4E3,0xB4AC,
+	0xEDF4,0xB4EC,0xABAC,0xA5A4,0x8002,0xF526,0xC008,0x9C6C,
+	0xA49B,0x9C63,0x9C9B,0xA500,0x0003,0xED08,0xED8D,0xED6D,
+	0xE508,0xC005,0x91A5,0x9EE5,0xA464,0x0002,0x78E1,0x7901,
+	0x7901,0x8003,0x8101,0x8002,0x8121,0x8003,0x8921,0x0000,
+	0x8941,0x8002,0x8921,0x8002,0x8941,0x8003,0x8961,0x0005,
+	0x9161,0x9161,0x8961,0x7121,0x50C0,0x1840,0x8009,0x0000,
+	0x0004,0x3080,0x60E1,0x9981,0x9982,0x9982,0x8004,0x9981,
+	0x8004,0x99A1,0x0001,0x99A2,0x99A2,0x8005,0xA1A2,0xC00B,
+	0xA3A4,0xA5A4,0xACE4,0xA4AC,0xA4AC,0xA4EC,0x8004,0xB242,
+	0x8002,0xB262,0x8007,0xB242,0xC01B,0xACA4,0xE4A4,0xACA4,
+	0xECA5,0xACA4,0xECAC,0xACA4,0xF5A4,0xACAB,0xA4AD,0xADAC,
+	0xF6BE,0xFEB6,0xB7FF,0x000A,0xF697,0xF719,0xF73A,0x6B8E,
+	0x0947,0x0948,0x0989,0x1A0C,0xBCF0,0xEDAC,0xED89,0x8006,
+	0xED47,0x0007,0xED68,0x9C4E,0x1297,0x0A76,0x0A75,0x0A34,
+	0xACAE,0xF5CC,0xC004,0xB5AD,0xA5AC,0xAE00,0x8003,0xF672,
+	0xC011,0x9B9B,0x9CA3,0x9A81,0x5193,0xAC9C,0x9B64,0x9C94,
+	0x9CA4,0x9CE6,0x000A,0xED6F,0xF6D8,0xFEF9,0xFE11,0xFD89,
+	0xFDC9,0xFE49,0xFE87,0xFE66,0xEDA4,0xE4A4,0xC004,0x84AC,
+	0x635D,0x6500,0x0002,0xD469,0xE50D,0xFD8F,0xC016,0xB5AC,
+	0xA4A2,0x5C5B,0x5393,0x5494,0x53D3,0x92A3,0xDCA3,0xB4EC,
+	0xB5EC,0xB4AC,0xEB00,0x8002,0xFD26,0xC00B,0x64A5,0xA39C,
+	0x6CA4,0x9B9C,0x639C,0x9BAE,0x0003,0xED4A,0xEDAD,0xED6C,
+	0xE4C7,0xC005,0x9AAD,0xDEA5,0xA464,0x0002,0x78E1,0x78E1,
+	0x7900,0x8003,0x8101,0x0002,0x8121,0x8101,0x8121,0x8003,
+	0x8921,0x0000,0x8941,0x8002,0x8921,0x8003,0x8941,0x8002,
+	0x8961,0xC006,0x9CAC,0xA4E4,0xA5A3,0x1C00,0x0001,0x50C0,
+	0x1840,0x8007,0x0000,0x0003,0x2860,0x9981,0x9981,0x9982,
+	0x8004,0x9981,0x8005,0x99A1,0x0000,0xA1A1,0x8007,0xA1A2,
+	0x8002,0xA1C2,0xC008,0xE4A4,0xACA4,0xACE4,0xACAC,0xA400,
+	0x8006,0xB262,0x8004,0xB242,0x8003,0xB262,0xC019,0xE4A4,
+	0xACA4,0xECA5,0xA4AC,0xECA4,0xADAB,0xEDAC,0xACAB,0xA4AD,
+	0xACA5,0xF5B6,0xBEFE,0xF7BF,0x0004,0xF656,0xF6D9,0xF71A,
+	0xDE57,0x0927,0xC003,0xAC6E,0xF5B7,0x0003,0x6390,0xC4EC,
+	0xED67,0xED67,0x8003,0xED47,0x0007,0xD509,0x63B2,0x1297,
+	0x0A97,0x1297,0x0A76,0x2AB4,0xEDCB,0xC010,0xE5AD,0xADAC,
+	0xA5AE,0xADA3,0xA5A4,0x9B9B,0x9C9B,0xA289,0x4900,0x8002,
+	0xED06,0xC007,0x9C9B,0x5C94,0x9CA4,0x9CEE,0x0004,0xF570,
+	0xFEF8,0xFEF9,0xF5F0,0xFD89,0xC003,0xBCBB,0xB39B,0x0001,
+	0xEDA4,0xE4A4,0xC005,0x84AC,0x6414,0x65F7,0x0001,0xE4EC,
+	0xFD8F,0xC025,0xB5AC,0xA4AA,0x545B,0x5393,0x5494,0x5B93,
+	0xD29C,0xE3A4,0xABAC,0xEDF4,0xB4EC,0xABA4,0xADA4,0x65A4,
+	0xA39C,0x6CA4,0x9B9C,0x5C9B,0xA4B6,0x0003,0xED6B,0xEDAE,
+	0xE54B,0xE4C6,0xC005,0x9BAD,0xE69D,0xA464,0x8002,0x78E1,
+	0x8003,0x8101,0x0002,0x8121,0x8101,0x8121,0x8003,0x8921,
+	0xC004,0xAC9C,0xA4AD,0x9B00,0x8002,0x8941,0x8002,0x8961,
+	0x0001,0x8941,0x8961,0x8006,0x9161,0x0002,0x8141,0x50C0,
+	0x2860,0x8004,0x0000,0x0000,0x2860,0x8007,0x9981,0x8005,
+	0x99A1,0x8004,0xA1A1,0x0000,0x9981,0x8003,0xA1A2,0xC008,
+	0xACA4,0xE4A4,0xACA4,0xECA4,0xAD00,0x8002,0xB242,0x8006,
+	0xB262,0x8002,0xB242,0x8004,0xB262,0xC01A,0xE4A4,0xACA4,
+	0xECA5,0xA4AC,0xECA4,0xADAC,0xACEC,0xACAB,0xA4A5,0xACA5,
+	0xF5BD,0xBEF7,0xB6FF,0xBF00,0x000B,0xF6B8,0xF71A,0xF71A,
+	0x73AE,0x0947,0x0968,0x0989,0x09EC,0x0A30,0x1274,0xD50A,
+	0xED67,0xC003,0x9CE4,0x64A4,0x0001,0x9C4E,0x12B8,0x8002,
+	0x1297,0x0002,0x1276,0xACAD,0xF5CA,0xC005,0xA5AD,0xADAD,
+	0xA5AD,0x8002,0xF672,0xC004,0xA39C,0x9B9C,0x9B00,0x0001,
+	0xBCEE,0xBCCC,0x8003,0xB48B,0xC007,0x9CA4,0x9BA4,0x9CA5,
+	0x5BED,0x0001,0xBCAF,0xBD54,0xC011,0xEC48,0x91AB,0xB4AC,
+	0x9B4B,0x8494,0xAC64,0x9C64,0xEEFE,0xF5AD,0x0000,0xFDF1,
+	0xC014,0xA2A4,0x5B53,0x5B93,0x5494,0x5BD3,0x9B93,0xE3A3,
+	0xACED,0xB4F4,0xACAC,0xEC00,0x8002,0xFD26,0x8002,0xF527,
+	0xC008,0x9B6C,0xA49B,0x9C63,0xDC5C,0xB700,0x0002,0xED8C,
+	0xEDAE,0xED29,0xC006,0x40E4,0x65E6,0xA5A4,0x6400,0x0003,
+	0x70E1,0x7901,0x7901,0x78E1,0x8002,0x8101,0x0002,0x8121,
+	0x8121,0x8101,0x8006,0x8921,0x0001,0x8941,0x8921,0x8002,
+	0x8941,0x8003,0x8961,0x8006,0x9161,0xC004,0xAD9B,0xA4A5,
+	0x5B00,0x0005,0x58E1,0x2860,0x0000,0x0000,0x2840,0x9982,
+	0x8005,0x9981,0x8004,0x99A1,0x0001,0xA1A1,0x99A1,0x8005,
+	0xA1A1,0x8002,0xA1A2,0x8002,0xA1C2,0xC010,0xE4A4,0xACAC,
+	0xE4A4,0xADAB,0xA5A3,0xACE4,0xA464,0xE464,0xA400,0x8002,
+	0xB242,0x8003,0xB262,0x8002,0xBA62,0xC016,0xACA4,0xADE4,
+	0xA4AC,0xEDA3,0xACAD,0xACE4,0xB3AC,0xA5A4,0xACA4,0xF6B5,
+	0xBEFE,0xB600,0x000E,0xE591,0xEDF3,0xF696,0xF6F9,0xF73A,
+	0xEE98,0x324A,0x0948,0x0969,0x09CB,0x0A0E,0x3AF2,0xED89,
+	0xED67,0xED46,0x8002,0xED47,0x0006,0xB4AB,0x12B8,0x1298,
+	0x1297,0x1297,0x6391,0xF58A,0xC006,0xB4A5,0xA5B5,0xADA4,
+	0xAD00,0x8003,0xF671,0xC003,0x9C9B,0x9CA3,0x0002,0x0A12,
+	0x0A75,0x12D8,0x8002,0x12F9,0xC007,0xECAD,0xACAB,0xADAC,
+	0xA39B,0x0004,0x1290,0x0147,0x0127,0x020F,0x0275,0xC003,
+	0x9584,0x96ED,0x0001,0x125B,0x1B5B,0xC003,0xBCA4,0xDCFD,
+	0x0005,0x3C1B,0x33B7,0x1B13,0x0270,0x022E,0xFDF1,0xC022,
+	0xABA3,0x5353,0x9B53,0x5494,0x53DB,0x9B9B,0xDBA4,0xABED,
+	0xB4F4,0xACEC,0xACA4,0xACA4,0xAD5C,0xA49B,0x6CA3,0x9C9C,
+	0x639C,0xA400,0x0003,0xE528,0xEDAE,0xEDAD,0xED08,0xC006,
+	0x48A5,0xE5A6,0xA5A5,0x6300,0x0003,0x7901,0x78E1,0x78E1,
+	0x7901,0x8003,0x8101,0x0001,0x8121,0x8101,0x8008,0x8921,
+	0x8003,0x8941,0x8002,0x8961,0x0001,0x9161,0x9160,0x8004,
+	0x9161,0xC006,0xAC9C,0xA4A5,0xA4E4,0xA300,0x0003,0x8141,
+	0x2840,0x2060,0x9982,0x8005,0x9981,0x0000,0xA1A1,0x8003,
+	0x99A1,0x0001,0xA1A1,0xA1A1,0x8002,0xA1A2,0x8002,0xA1A1,
+	0x0001,0xA1A2,0xA1A2,0x8002,0xA1C2,0x0000,0xA9C2,0x8002,
+	0xA9E2,0xC007,0xACE4,0xA4AD,0xABA5,0xA3AC,0x8004,0xBA62,
+	0x8002,0xB262,0xC004,0x9CAC,0xA4E4,0x6400,0x8002,0xBA62,
+	0xC018,0xACA4,0xACE5,0xA4AC,0xECA4,0xACAD,0xABED,0xACAB,
+	0xA4A5,0xACA4,0xEDB5,0xBEF6,0xBFB7,0xF600,0x000A,0xEE35,
+	0xF6D9,0xF73A,0xFF1A,0xE697,0x52EC,0x0968,0x09AA,0x09ED,
+	0x73D0,0xF5AA,0xC005,0x5A9A,0x9DA4,0xE464,0x0004,0x12B8,
+	0x1298,0x1297,0x7BEF,0xED88,0xC00F,0xE5AD,0xA4AE,0xADAD,
+	0xACA5,0xAEAC,0x9CAD,0x9B9B,0x9CA3,0x0002,0x0A12,0x0A75,
+	0x12D8,0x8002,0x12F9,0xC007,0xACED,0xACAC,0xACAC,0xA45A,
+	0x0004,0x0A90,0x0147,0x0127,0x020F,0x0295,0xC003,0x8D85,
+	0x95ED,0x0001,0x125B,0x1B5B,0xC003,0xBC9C,0xECED,0x0005,
+	0x3BFB,0x33B7,0x1313,0x0270,0x022E,0xFDF1,0xC022,0xAB9B,
+	0x5B53,0x5B93,0x5494,0x9B9B,0x939B,0xDBA4,0xABF4,0xADF4,
+	0xACEC,0xACAC,0xA4AC,0xA55C,0xA49B,0x6CA3,0x9C9C,0x639C,
+	0xA500,0x0003,0xED4A,0xEDCF,0xED8D,0xE4E7,0xC006,0x92E4,
+	0x65E6,0xA5A5,0x6300,0x0000,0x70E1,0x8002,0x78E1,0x0000,
+	0x7901,0x8002,0x8101,0xC005,0xAC9C,0xACA4,0xE4AC,0x8005,
+	0x8921,0x8002,0x8941,0x8003,0x8961,0xC005,0xE4A4,0xAD9B,
+	0xA4AC,0x8002,0x9161,0x0006,0x9162,0x8941,0x58E1,0x3060,
+	0x0000,0x0000,0x2060,0x8006,0x9981,0x8003,0x99A1,0xC003,
+	0xE4A5,0xAC9C,0x8002,0xA1C2,0x0002,0xA1A1,0xA1A2,0xA1A2,
+	0x8002,0xA1C2,0x8002,0xA9C2,0x0001,0xA9E2,0xB1E2,0x8002,
+	0xB202,0xC003,0xACAC,0xE56C,0x8003,0xBA62,0xC009,0xACA4,
+	0x9C64,0xA49C,0xACA4,0xE464,0x8003,0xBA62,0xC004,0xADAB,
+	0xE5A4,0xAC00,0x8002,0xCAE3,0xC00F,0xB5AC,0xE4B4,0xABAC,
+	0x9DAC,0xA4AC,0xEEBD,0xF6BF,0xBFEE,0x0001,0xEE14,0xF6B8,
+	0xC003,0xBEE4,0x5B9B,0x0007,0xBD53,0x42AC,0x09EC,0xC52F,
+	0xEDAB,0xED88,0xED67,0xED67,0x8002,0xED47,0x0003,0x4B54,
+	0x63B2,0xD50A,0xED68,0xC010,0xA4ED,0xADA4,0xADAD,0xADAD,
+	0xA5AD,0xA5AC,0x9CA4,0x9B9C,0xA300,0x0002,0x0A12,0x0A75,
+	0x12D8,0x8002,0x12F9,0xC007,0xACEC,0xACAD,0xACAC,0xA35B,
+	0x0004,0x0A90,0x0147,0x0127,0x020F,0x0296,0xC003,0x8C85,
+	0x95ED,0x0001,0x125B,0x1B5B,0xC003,0xBC9C,0xE4FD,0x0005,
+	0x3C1B,0x2BB8,0x1B33,0x0270,0x022F,0xFDF1,0xC014,0xAB9B,
+	0x535B,0x5B53,0x959B,0x939B,0x939B,0xDBAC,0xA3F5,0xACF4,
+	0xACEC,0x6C00,0x8002,0xFD26,0xC00A,0xAD5C,0xA49B,0x64AB,
+	0x9C9C,0x639C,0xAE00,0x0003,0xED8C,0xEDCF,0xED6C,0xE4C5,
+	0xC006,0x9BE5,0xA6A5,0xA5A5,0xA300,0x0000,0x70E1,0x8002,
+	0x78E1,0xC003,0xACA4,0xE4A4,0x8004,0x8121,0x0000,0x8941,
+	0x8002,0x8921,0x0000,0x8941,0x8002,0x8921,0x0001,0x8941,
+	0x8941,0x8002,0x8961,0x0000,0x9161,0x8004,0x9181,0x0004,
+	0x9162,0x9161,0x8141,0x50C1,0x2860,0x8004,0x0000,0x0000,
+	0x2060,0x8002,0x9982,0x8002,0x9981,0x0000,0xA1A1,0x8002,
+	0x99A1,0x0000,0x99A2,0x8002,0xA1A1,0x8003,0xA1C2,0x0001,
+	0xA1A2,0xA1A1,0x8003,0xA1C2,0x8004,0xA9E2,0x8002,0xB202,
+	0xC003,0xACA4,0xED6B,0x8002,0xBA62,0x8002,0xBA82,0xC006,
+	0x9CA4,0x64A4,0xE4A4,0x6400,0x8003,0xBA62,0xC019,0xACA5,
+	0xABE5,0xA4AC,0xECA4,0xA5B4,0xA4EC,0xACB4,0xA3AD,0xA49C,
+	0xACB5,0xF5F6,0xBFBF,0xB6FF,0x0000,0xF676,0xC005,0xBFBD,
+	0x9CCA,0xA35B,0x0001,0xDDB3,0xF611,0xC003,0x5098,0xDA94,
+	0x8004,0xED47,0xC00B,0xACE4,0x65AD,0xE4AD,0xADAD,0xA5AC,
+	0xAEAD,0x8003,0xF651,0x0005,0xF610,0xF60F,0xF5EF,0x0A12,
+	0x0A74,0x12D7,0x8002,0x12F9,0xC007,0xECAC,0xA5B4,0xACA4,
+	0xAC9B,0x0004,0x1290,0x0148,0x0127,0x020F,0x02B6,0xC003,
+	0x8484,0x96AD,0x000B,0x125B,0x1B5B,0x1BBB,0x1BBB,0x239B,
+	0x33FC,0x3C1B,0x33D8,0x1B34,0x0A70,0x022F,0xFDF1,0xC014,
+	0xA2A4,0x5B53,0x539C,0x5394,0x9C9B,0x9BDA,0x9CA3,0xA3EC,
+	0xF5AC,0xB4F4,0xA400,0x8002,0xFD26,0x8002,0xF527,0xC007,
+	0x9B6C,0xA39C,0x9C5B,0xA4B7,0x0003,0xEDAD,0xEDCF,0xED4B,
+	0xE4C5,0xC006,0x9BE5,0xA6A5,0xA5A5,0x6300,0x8002,0x7901,
+	0x0002,0x78E1,0x78E1,0x7901,0x8003,0x8101,0x8002,0x8121,
+	0x8003,0x8921,0x0000,0x8941,0x8002,0x8921,0x0001,0x8941,
+	0x8941,0x8002,0x8961,0xC005,0xE4A4,0xACA4,0xA513,0x0001,
+	0x48C1,0x1840,0x8007,0x0000,0x0003,0x2860,0x9982,0x9981,
+	0x9982,0x8003,0x9981,0xC005,0xACA4,0xE465,0xE4A3,0x8005,
+	0xA1C2,0xC003,0x9CA4,0xACA4,0x8005,0xA9E2,0x8002,0xB202,
+	0x0002,0xB222,0xB222,0xBA43,0x8002,0xBA62,0x8004,0xBA82,
+	0x0002,0xBA62,0xBA62,0xB262,0x8002,0xBA62,0x0000,0xB262,
+	0x8003,0xBA62,0xC018,0xACEC,0xA5A4,0xACE5,0xABA4,0xADAC,
+	0xECAC,0xABAC,0xADA4,0x9CAC,0xADF5,0xBEF6,0xBFB6,0xFF00,
+	0x0000,0xEE55,0xC00D,0xFFBE,0xE49B,0x539B,0x9A91,0x5098,
+	0x9194,0xA4E4,0x8004,0xED47,0xC009,0xEDAC,0xA5AD,0xA5AC,
+	0xADAD,0xADA6,0x8002,0xF651,0xC003,0x9C9B,0xA49B,0x0002,
+	0x0A12,0x0A75,0x0AB7,0x8003,0x12F9,0xC006,0xEDAC,0xABB5,
+	0xA3AC,0x9B00,0x0004,0x0A90,0x0168,0x0148,0x020F,0x0295,
+	0xC003,0x8D8C,0x8DB6,0x0001,0x125B,0x1B5B,0xC003,0xBC9C,
+	0xE4FD,0x0005,0x3C3B,0x33D9,0x1B34,0x0A91,0x020F,0xFDF1,
+	0xC021,0xAA9C,0x5B5B,0x4B9C,0x549B,0x9C93,0x9BDB,0x9BA3,
+	0xEBAD,0xECB4,0xACB4,0xE4AC,0xA4AC,0x5D9C,0xA4A3,0x6C9B,
+	0x9CA4,0x5BA4,0x0004,0xE528,0xEDCE,0xEDCF,0xED29,0xE4A4,
+	0xC006,0xA4A5,0xE6A5,0xAD9D,0x6300,0x8002,0x7901,0x0001,
+	0x7900,0x7901,0x8004,0x8101,0x8002,0x8121,0x8007,0x8921,
+	0x8002,0x8941,0xC004,0xACA4,0xE4A4,0x1C00,0x0001,0x50E1,
+	0x1840,0x8009,0x0000,0x0004,0x2060,0x58E1,0x9982,0x9981,
+	0x9982,0x8003,0x9981,0xC005,0xACA4,0xE4A5,0xA4A3,0x8007,
+	0xA1C2,0xC003,0xE4A4,0xAC9C,0x8003,0xA9E2,0x8002,0xB202,
+	0x0002,0xB222,0xB222,0xBA42,0x8002,0xBA62,0x8005,0xBA82,
+	0x8004,0xBA62,0x0000,0xB262,0x8003,0xBA62,0xC00D,0xACEC,
+	0xA5A4,0xACE5,0xABA4,0xACAC,0xEDAC,0xABAC,0x8004,0xD3C4,
+	0xC006,0xF5BE,0xF6BF,0xB6FF,0xBF00,0x0001,0xF697,0xF719,
+	0xC009,0xE4A4,0x539B,0x9B92,0x9050,0x909B,0x8005,0xED47,
+	0xC00A,0xACA4,0xE5AD,0xA4AD,0xADAD,0xACA6,0xAD00,0x8002,
+	0xF651,0xC003,0x9B9B,0xA49C,0x0000,0x0A12,0xC00C,0xBFB6,
+	0xF69C,0xACEC,0xA5AB,0xACB5,0xA4AB,0x9B00,0x0004,0x0A90,
+	0x0148,0x0148,0x020F,0x0295,0xC003,0x8D8D,0x8DAD,0x0001,
+	0x125B,0x1B5B,0xC003,0xBC9C,0xE4FD,0x0005,0x3C3C,0x33F9,
+	0x1B35,0x0291,0x022F,0xFDF1,0xC021,0xA2A4,0x5B53,0x539C,
+	0x539C,0x9C93,0x9BDB,0x9BA3,0xECAB,0xEDB4,0xACF4,0xA4AD,
+	0xABA4,0x5D9C,0xA4A3,0x64A3,0x9CA4,0x5BA5,0x0003,0xE54A,
+	0xF5F0,0xEDAE,0xE507,0xC007,0x89A4,0xA5E6,0xA5AD,0x9D63,
+	0x0001,0x7921,0x7921,0x8003,0x7901,0x8003,0x8101,0x8002,
+	0x8121,0x8008,0x8921,0x8003,0x8941,0x0001,0x9161,0x1020,
+	0x8008,0x0000,0x0005,0x1020,0x3880,0x6901,0x8961,0x9982,
+	0x9981,0x8002,0x9982,0x0001,0x9981,0x9982,0x8002,0x9981,
+	0x8003,0xA1A2,0x8003,0xA1C2,0xC008,0xAC9B,0xA4A5,0xEC9C,
+	0xACA4,0x9C00,0x8003,0xA9E2,0x8002,0xB202,0xC005,0xACA4,
+	0xECAD,0xA3A4,0x8005,0xBA82,0x0001,0xBA62,0xB262,0x8002,
+	0xBA62,0x0000,0xB262,0x8002,0xBA62,0xC00E,0xADA3,0xECA5,
+	0xACA4,0xEC9C,0xACAD,0xACEC,0xACAB,0xAC00,0x8002,0xD3C4,
+	0xC008,0x9CAC,0xEDBD,0xFFB6,0xB6BF,0xF700,0x000B,0xF656,
+	0xF6D8,0xF71A,0xEEB8,0x9CB2,0x52ED,0x11AA,0x098A,0x09CD,
+	0x2A92,0x6391,0xB4AC,0x8006,0xED47,0xC010,0xA5EC,0xA4AD,
+	0xA5B5,0xADA4,0xADAE,0xA5AD,0xA39C,0x9BA5,0x9B00,0x0000,
+	0x0A12,0xC003,0xFEB7,0xB69C,0x0001,0x2318,0x4B74,0xC006,
+	0xADA3,0xACAC,0xA5A3,0xA400,0x0003,0x4B30,0x42AC,0x42AC,
+	0x4310,0xC005,0xAE9D,0x949D,0xACBD,0x0000,0x4BB5,0xC008,
+	0xACA4,0xE5AC,0xEC9A,0x0A52,0x9300,0x0000,0xFDF1,0xC017,
+	0xA3A2,0x5C53,0x5B94,0x5B94,0x9C9B,0x93DB,0x9BA3,0xABED,
+	0xACF4,0xB4EC,0xA4AC,0xA4AD,0x8002,0xF527,0xC006,0x9B64,
+	0xA39C,0x9B64,0xED00,0x0003,0xED8C,0xF5F0,0xED8C,0xE4E6,
+	0xC007,0x91A6,0xE5A5,0xA5A5,0xA563,0x0000,0x7920,0xC003,
+	0xE564,0xE4A4,0x8003,0x8101,0x8003,0x8121,0x8006,0x8921,
+	0xC006,0xA5A4,0xA3AC,0xEC64,0xA400,0x8006,0x0000,0x0004,
+	0x1840,0x50C1,0x7921,0x9161,0x9962,0x8002,0x9981,0x8003,
+	0x9982,0x0001,0x99A1,0x9981,0x8002,0x99A2,0x8002,0xA1A2,
+	0x8004,0xA1C2,0xC006,0xA3A4,0xE5AC,0xA49C,0xA400,0x8004,
+	0xA9E2,0x0000,0xB1E2,0x8002,0xB202,0x0002,0xB222,0xB222,
+	0xBA42,0x8002,0xBA62,0x8006,0xBA82,0x0000,0xB262,0x8006,
+	0xBA62,0xC010,0xACA4,0xECA4,0xADA4,0xEC9C,0xACAD,0xACEC,
+	0xABAD,0xABAD,0x9C00,0x8002,0xD3C4,0xC007,0xEDB5,0xBEF6,
+	0xBEF7,0xBFBF,0x0002,0xF6B8,0xAD33,0x1146,0xC004,0x54AE,
+	0xACB6,0xAE00,0x0004,0x09F1,0x1235,0x1297,0x4B54,0xDD28,
+	0x8004,0xED47,0xC009,0xA5AC,0xECA5,0xA5AC,0xADAD,0xADA5,
+	0x8003,0xF630,0x0009,0xF60F,0xF60F,0xF5EF,0x0A12,0x0A54,
+	0x12D7,0x12F9,0x12D9,0x4B74,0xED06,0xC006,0x5C9C,0x9C9B,
+	0x9C9D,0xEC00,0x000A,0xF56F,0xFE96,0xFEB7,0xFDF0,0xFD6A,
+	0xFDC9,0xFE49,0xFE87,0xF646,0xEDA4,0xE4A4,0xC005,0x8CAC,
+	0xA40B,0x14F6,0x0002,0xE4AA,0xFD4E,0xFDD0,0xC018,0xADA3,
+	0xA35B,0x535B,0x945B,0x949C,0x9BDB,0x93A3,0x9BAB,0xEDAC,
+	0xF4AC,0xB4E4,0xACA4,0xA500,0x8002,0xF527,0xC006,0x9B63,
+	0xA49C,0xA45B,0xF600,0x0003,0xEDCE,0xEE10,0xED6B,0xE4C6,
+	0xC007,0xA2E4,0x9EA5,0xA5A5,0xA563,0x0000,0x8120,0xC004,
+	0xA4A5,0xA49C,0xAC00,0x8002,0x8101,0x8003,0x8121,0x8006,
+	0x8921,0xC006,0xAD9C,0xA3AC,0xA4AC,0xE400,0x8004,0x0000,
+	0x0002,0x1020,0x58E1,0x8961,0xC003,0xECDC,0x64E4,0x8004,
+	0x9981,0xC003,0xA5A4,0xA3A4,0x8002,0x99A2,0x8002,0xA1A2,
+	0x8005,0xA1C2,0x8003,0xA9E2,0x0001,0xA9C2,0xA9C2,0x8004,
+	0xA9E2,0x0000,0xB1E2,0x8002,0xB202,0xC007,0xACA4,0xECAC,
+	0xA4AC,0xA4AC,0x8006,0xBA82,0x8005,0xBA62,0xC00E,0xACA4,
+	0xECA4,0xADA4,0xEC9C,0xACAD,0xACEC,0xACAC,0xAB00,0x8004,
+	0xD3C4,0x0003,0xDBE5,0xDC25,0xDC47,0xE4C9,0xC003,0xB6F7,
+	0xBFBE,0x0001,0xACF2,0x0906,0xC005,0x5BA5,0xF5AD,0xADAE,
+	0x0005,0x09CF,0x0A13,0x1277,0x12B8,0x22D7,0xD4E9,0x8004,
+	0xED47,0xC009,0xEDAC,0xA5A4,0xADAD,0xACAD,0xA6A5,0x8002,
+	0xF630,0x0009,0xEE0F,0xF60F,0xF5EF,0x0A12,0x0A54,0x12D7,
+	0x12F9,0x12D9,0x4B74,0xED06,0xC006,0x5CDB,0x5D9B,0x9DA4,
+	0xE500,0x000A,0xF56E,0xFE97,0xFEB7,0xFDD0,0xFD6A,0xFDC9,
+	0xFE48,0xFE87,0xF646,0xEDA4,0xE4A4,0xC005,0x8CAC,0xA40B,
+	0x14F6,0x0002,0xE4AA,0xFD4E,0xFDD0,0xC00C,0xADA3,0xA25C,
+	0x535B,0x9453,0x9C9C,0x9BDB,0x9B00,0x0001,0xCC29,0xB40B,
+	0xC006,0xA4AC,0xA3ED,0xACAC,0xA400,0x0002,0xCCAA,0xFD26,
+	0xFD47,0x8002,0xF527,0x0001,0xF506,0xED05,0x8002,0xECE5,
+	0x0005,0xECC4,0xED28,0xEDEF,0xEDF0,0xED4A,0xE4C5,0xC007,
+	0xA3E5,0x9DA5,0xA5A5,0xA563,0x0003,0x8140,0x8140,0x8120,
+	0x8120,0x8008,0x8121,0x8006,0x8921,0xC006,0xAD9C,0xA3AC,
+	0xA4EC,0xA400,0x8007,0x0000,0x0003,0x1840,0x40A0,0x68E1,
+	0x9982,0x8004,0x9981,0x0002,0x9982,0xA1A2,0x9981,0x8002,
+	0x99A2,0x8002,0xA1A2,0x8002,0xA1C2,0xC004,0x9CAC,0xA4EC,
+	0x9C00,0x8002,0xA9E2,0x0001,0xA9C2,0xA9C2,0x8004,0xA9E2,
+	0x0000,0xB1E2,0x8002,0xB202,0xC006,0xADA3,0xECAC,0xA4AC,
+	0xA400,0x8003,0xBAA2,0x8005,0xBA82,0x8003,0xBA62,0xC00E,
+	0xACA4,0xECA4,0xADA4,0xEC9C,0xACAD,0xABAC,0xEDAC,0xAB00,
+	0x8002,0xD3C4,0xC009,0xA3A5,0xECAD,0xB5FF,0xB6B6,0xBF6E,
+	0x0001,0x19EA,0x0927,0xC006,0x926C,0xE6B5,0xA5B5,0xB700,
+	0x0004,0x0A12,0x1256,0x1298,0x12B8,0x4B54,0x8004,0xED47,
+	0xC00F,0xACE5,0xA465,0xEDB4,0xADA5,0xADA6,0xADA4,0x9CA3,
+	0xA49C,0x0006,0x0A12,0x0A54,0x12D7,0x12F9,0x12D9,0x4B74,
+	0xED06,0xC006,0xA49C,0x945B,0xDD64,0xE500,0x000A,0xED6E,
+	0xFE96,0xFEB7,0xFDF0,0xFD6A,0xFDC9,0xFE48,0xFE87,0xFE46,
+	0xF584,0xE4A4,0xC005,0x8CAC,0xA40B,0x0BF7,0x0002,0xE4AA,
+	0xFD4E,0xFDD0,0xC009,0xADA3,0x5AA4,0x535B,0x9453,0x9C55,
+	0x0002,0x942E,0x5BD2,0x1BB7,0xC008,0xADA4,0x5DA4,0x9454,
+	0x9C9C,0xA300,0x0002,0x4374,0xFD47,0xFD47,0x8002,0xF527,
+	0xC005,0x9B63,0x9CA3,0x64E5,0x0003,0xED69,0xEE10,0xEDEF,
+	0xED28,0xC008,0x48E4,0x9DA5,0xA5A5,0xA5A5,0x6300,0x8003,
+	0x8140,0x8002,0x8121,0x0000,0x8120,0x8005,0x8121,0x8002,
+	0x8921,0xC003,0xAC9C,0xA4A5,0x8002,0x8921,0x0004,0x8941,
+	0x9161,0x8961,0x3880,0x1840,0x8009,0x0000,0x0003,0x2060,
+	0x48C0,0x7941,0x9982,0xC006,0xA39C,0xADA3,0xACA4,0xE400,
+	0x8002,0xA1A2,0x8002,0xA1C2,0xC004,0x9CEC,0xA4AC,0x9C00,
+	0x8008,0xA9E2,0xC00C,0xE4A4,0xACA4,0xACE5,0x63ED,0xABA4,
+	0xACA5,0xA400,0x8003,0xBAA2,0x8003,0xBA82,0x8002,0xBA62,
+	0x8003,0xBA82,0x0001,0xBAA3,0xBAA2,0x8002,0xC2C3,0xC007,
+	0xECA4,0xADAC,0xACEC,0xACAC,0x8004,0xD3C4,0xC006,0xACEC,
+	0xAEB6,0xFEBE,0xF700,0x000F,0x7BF0,0x11CB,0x0148,0x0105,
+	0x08E6,0x632D,0x9CB2,0xBD53,0xBD52,0x8C50,0x42F0,0x1235,
+	0x1297,0x12B8,0x0AB8,0xAC6C,0x8003,0xED47,0xC00B,0xECA5,
+	0xA465,0xECAD,0xACAE,0xADA5,0xADA5,0x8002,0xF60F,0x0001,
+	0xF5EF,0x0A32,0xC003,0xAEBF,0xF69C,0x0001,0x4B74,0xED06,
+	0xC006,0xA45C,0x9C9C,0x94DC,0xB400,0x000A,0xED6E,0xFE75,
+	0xFE96,0xFDCF,0xF58A,0xFDC9,0xFE49,0xFE88,0xFE46,0xEDA4,
+	0xE4A4,0xC005,0x8CB4,0x9C0B,0x0BF7,0x0002,0xE4A9,0xFD4D,
+	0xFDD0,0xC007,0xADAB,0x9B5B,0x5C53,0x9B54,0x0001,0x8C2F,
+	0x2B53,0xC00B,0x6675,0xACAE,0xA4A5,0x5C94,0x5C54,0xE45C,
+	0x0001,0x4374,0xFD27,0xC009,0xAC5C,0x9CA3,0xA463,0x9CA4,
+	0xA365,0x0003,0xED8B,0xF611,0xEDAE,0xED07,0xC008,0x51E4,
+	0x9C9E,0xA5AD,0xA565,0xA300,0x8002,0x8140,0x0001,0x8141,
+	0x8141,0x8002,0x8120,0x8004,0x8141,0x0000,0x8941,0x8009,
+	0x8921,0xC004,0xACAC,0xA4E5,0xA300,0x0003,0x7941,0x5901,
+	0x3880,0x1020,0x8008,0x0000,0x0001,0x2860,0x9981,0xC005,
+	0xA5A4,0xA3A4,0xECAD,0x8003,0xA1A2,0xC003,0xACA4,0xEC9C,
+	0x800C,0xA9E2,0xC00B,0xE4AC,0xA4AD,0xA4A3,0xEDAB,0xA4AC,
+	0xA5AC,0x8004,0xBAA2,0x8003,0xBA82,0x0001,0xBA62,0xBA62,
+	0x8002,0xBA82,0x0002,0xBAA3,0xBAA3,0xC2A2,0x8002,0xC2C3,
+	0xC007,0xECA4,0xADAC,0xECAC,0xACAC,0x8005,0xD3C4,0xC005,
+	0xF4AE,0xADFE,0xBEBF,0x0005,0x2ACF,0x120C,0x0969,0x1167,
+	0xCDF6,0xFF19,0xC004,0x53DB,0x6392,0x9000,0x0004,0x9C6E,
+	0x1276,0x12B8,0x0AB8,0x5373,0x8004,0xED47,0xC00E,0xEDA4,
+	0x65EC,0xADAC,0xADA6,0xACA6,0xA5A3,0xA39D,0xA300,0x0000,
+	0x0A32,0xC003,0xAEBF,0xF69C,0x0001,0x4B74,0xED06,0xC006,
+	0xA45C,0xDC5C,0x9B95,0xB400,0x000A,0xF56E,0xFE75,0xFE96,
 	0xFDCF,0xFD8A,0xFDC9,0xFE49,0xFE87,0xFE46,0xED84,0xE4A4,
-	0xE444,0xE484,0xE464,0xD403,0xC3A2,0xCBC4,0xE4A9,0xF54D,
-	0xFDB0,0xFDF1,0xFDF0,0xF5EF,0xF5CE,0xEDAD,0xE56D,0xE54C,
-	0x63B0,0x2333,0x2334,0x2354,0x1B75,0x1BB6,0x1BD7,0x1BD8,
-	0x13B9,0x1399,0x0B79,0x0B59,0x0B19,0x02F9,0x02F8,0x4374,
-	0xFD27,0xFD47,0xF527,0xF507,0xF506,0xF506,0xED05,0xED05,
-	0xECE5,0xE4C4,0xE507,0xEDAD,0xF611,0xED8D,0xE4E6,0xE4C4,
-	0xECC4,0xECA5,0xEC86,0xEC87,0xECA8,0xECA9,0xE4AA,0xE4A9,
-	0x8160,0x8160,0x8161,0x8941,0x8941,0x8941,0x8140,0x8140,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8921,0x8921,0x8922,0x8921,0x8921,0x8921,
-	0x8941,0x8941,0x8941,0x9161,0x9161,0x9181,0x9181,0x91A1,
-	0x91A1,0x7941,0x50E1,0x2860,0x0800,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9982,0x9981,0x9982,0x99A2,0x99A1,
-	0xA1A1,0xA1C2,0xA1A2,0xA1A2,0xA1A2,0xA1A2,0xA1C2,0xA9E2,
-	0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,0xB202,
-	0xB202,0xB202,0xB223,0xB223,0xB222,0xBA43,0xBA62,0xBA62,
-	0xBA82,0xBA83,0xBAA3,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA2,
-	0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBAA3,0xBAA3,0xC2A3,0xC2C3,0xC2C3,0xC2C3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xCB24,0xD344,0xD364,0xD3A4,0xD3A4,
-	0xD3C4,0xD3C4,0xDBC4,0xD3C4,0xD3C4,0xDBE5,0xDC06,0xDC47,
-	0xDCA8,0xE4EA,0xCCEE,0x126F,0x122D,0x09AA,0x9CB2,0xF719,
-	0xFF1A,0xFF19,0xFED8,0xF6B6,0xF695,0xF652,0xF60D,0x6391,
-	0x12B7,0x0AB8,0x2AF6,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED48,0xF568,0xF568,0xF589,0xF5AA,0xEDCA,0xF5CA,0xF5EC,
-	0xEDED,0xF60E,0xF610,0xF60F,0xEE0E,0xF60F,0xF5EE,0x0A32,
-	0x0A54,0x0AB7,0x12F9,0x12F9,0x4B74,0xED06,0xED06,0xE4E6,
-	0xECC6,0xE4A6,0xE486,0xE466,0xE486,0xED6E,0xFE75,0xFE76,
-	0xFDCF,0xFD8A,0xFDC9,0xFE49,0xFE68,0xF646,0xED84,0xE4C4,
-	0xE464,0xE465,0xE464,0xD403,0xC3A2,0xCBC4,0xE489,0xFD2D,
-	0xFDD0,0xFDF1,0xFE10,0xFDEF,0xF5CE,0xEDAD,0xE54C,0x73D0,
-	0x22F3,0x2334,0x2334,0x2354,0x1B75,0x1BB6,0x1BB8,0x1BB8,
-	0x13B9,0x1399,0x0B79,0x0B39,0x0319,0x0AF9,0x0AF9,0x4374,
-	0xFD27,0xFD27,0xF527,0xF507,0xF506,0xF506,0xED05,0xECE5,
-	0xECE5,0xE4E4,0xE528,0xEDEF,0xF611,0xED4B,0xE4C5,0xE4C4,
-	0xECC4,0xECA5,0xEC86,0xEC87,0xECA8,0xECA9,0xE4AA,0xE4A9,
-	0x8160,0x8160,0x8161,0x8961,0x8961,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x8941,0x8961,0x8941,0x8941,
-	0x8941,0x8941,0x8922,0x8921,0x8921,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x9161,0x9161,0x9181,0x9181,0x9181,
-	0x91A1,0x91A1,0x8161,0x50E1,0x2860,0x0820,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x9981,0x9981,0x9981,0xA1A2,0xA1A1,
-	0xA1C2,0xA1C2,0xA1C2,0xA1A2,0xA1C2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xB202,0xB202,
-	0xB202,0xB202,0xBA23,0xBA23,0xBA23,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xBA83,0xBAA3,0xBAA2,0xBAC2,0xBAC2,0xBAC2,0xBAA2,
-	0xBAA2,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xCB23,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xDBC4,0xDBC4,0xD3C4,0xDBE4,0xDC05,0xDC26,
-	0xDC88,0xE4EA,0xB48E,0x1A90,0x122E,0x11CB,0xF697,0xFEF9,
-	0xF71A,0xFEF9,0xFED8,0xF6D7,0xF696,0xFE73,0xF62F,0xBCED,
-	0x12B7,0x12B8,0x12B8,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xF567,0xF568,0xF568,0xED89,0xF589,0xF5A9,0xF5CA,0xF5EB,
-	0xEDEC,0xF5EE,0xF60F,0xF5EF,0xF60E,0xF5EE,0xF5EE,0x0A32,
-	0x0A54,0x0AB7,0x12F9,0x12F9,0x4B74,0xED06,0xED06,0xE4E6,
-	0xE4C6,0xE4A6,0xE486,0xEC66,0xEC87,0xED6E,0xFE55,0xFE76,
-	0xFDCF,0xFD89,0xFDE9,0xFE49,0xFE88,0xFE46,0xED84,0xE4A4,
-	0xE444,0xE485,0xE464,0xD403,0xC3A2,0xCBC4,0xE488,0xFD2D,
-	0xFDB0,0xFDF1,0xFE10,0xFDEF,0xF5CE,0xED8D,0xB4AE,0x1AB3,
-	0x22F3,0x2313,0x2334,0x1B54,0x1B75,0x2BB5,0x63F2,0x7BEF,
-	0x7BEF,0x7BEF,0x7C0F,0x7C0F,0x7BEF,0x7BF0,0x7BEF,0x9C4E,
-	0xF547,0xFD27,0xF527,0xF527,0xF507,0xF506,0xED05,0xECE5,
-	0xECE5,0xE4E5,0xED49,0xEE10,0xF5F0,0xED2A,0xE4E4,0xE4C4,
-	0xECC4,0xECA5,0xEC86,0xEC87,0xECA8,0xECA9,0xE4A9,0xE4A9,
-	0x8960,0x8960,0x8961,0x8961,0x8961,0x8961,0x8961,0x8961,
-	0x8961,0x8961,0x8961,0x8941,0x8961,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8942,0x8942,0x8941,0x8921,0x8921,0x8941,
-	0x8941,0x8941,0x8941,0x8941,0x9161,0x9161,0x8961,0x6101,
-	0x3880,0x1020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x99A1,0x9981,0x9981,0xA1A2,0x99A1,
-	0xA1A2,0xA1C2,0xA1C1,0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xAA02,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xBA23,0xBA23,0xBA23,0xBA23,0xBA43,0xBA63,
-	0xBA83,0xC282,0xBAA3,0xBAA2,0xBAC2,0xBAC2,0xBAC2,0xBAC2,
-	0xBAA2,0xBA82,0xBA82,0xBA83,0xBA83,0xBA83,0xBA83,0xBA83,
-	0xBA83,0xBAA3,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xCB23,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xDBC4,0xDBC4,0xDBC4,0xD3C4,0xDBE4,0xDBE5,0xDC26,
-	0xE467,0xDCC9,0xB48D,0x12B1,0x124F,0x11EC,0xF676,0xFED9,
-	0xFEFA,0xF71A,0xFEF8,0xF6D7,0xFEB6,0xFE94,0xF651,0xBCEE,
-	0x1296,0x12B8,0x12B8,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED67,0xF567,0xF568,0xED68,0xF589,0xEDA9,0xF5CA,0xF5CB,
-	0xF5EC,0xF5ED,0xF60F,0xF60E,0xF5EE,0xF5EE,0xF5EE,0x0A32,
-	0x0A54,0x0AB7,0x12F9,0x12F9,0x4B74,0xED06,0xED06,0xED06,
-	0xE4C6,0xE4A6,0xE486,0xE466,0xEC86,0xED6E,0xFE55,0xFE75,
-	0xFDAF,0xFD89,0xFDE9,0xFE49,0xFE88,0xFE46,0xED84,0xE4A4,
-	0xE445,0xE485,0xE464,0xD403,0xC3A2,0xD3C4,0xE468,0xF52C,
-	0xFDAF,0xFDF0,0xFDF0,0xFDEF,0xF5CE,0xED8D,0x4B51,0x1AB3,
-	0x22F3,0x2313,0x2334,0x1B54,0x7BEF,0xE469,0xE448,0xE447,
-	0xEC46,0xEC65,0xF486,0xF4C6,0xF4E6,0xF4E7,0xF507,0xFD27,
-	0xF547,0xFD27,0xF527,0xF527,0xF527,0xF506,0xED05,0xECE5,
-	0xECE4,0xE505,0xED6B,0xF611,0xEDEF,0xE528,0xECE4,0xECE4,
-	0xECA5,0xEC85,0xEC86,0xEC87,0xECA8,0xECC9,0xE4A9,0xE4A9,
-	0x8960,0x8960,0x8960,0x8960,0x8961,0x8961,0x8961,0x8961,
-	0x8961,0x8961,0x8961,0x8961,0x8961,0x8961,0x8961,0x8961,
-	0x8961,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x6901,0x48A0,0x1840,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1840,0x48C0,0x7941,0x99A1,0x9981,0x99A2,0xA1A2,0xA1A1,
-	0xA1A2,0xA1A2,0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xB1E2,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA23,0xBA23,0xBA43,0xBA63,
-	0xBA83,0xC283,0xBAA3,0xBAA3,0xBAC2,0xBAC2,0xC2C2,0xC2C2,
-	0xBAA2,0xBAA2,0xBA82,0xBA82,0xBA82,0xBA83,0xBA83,0xBA83,
-	0xBA83,0xBAA3,0xBAA2,0xC2C2,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB24,0xCB24,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xDBC4,0xDBC4,0xD3C4,0xDBC4,0xDBE4,0xDC05,
-	0xDC46,0xDCA8,0xCCAC,0x1AB2,0x126F,0x120D,0x9C91,0xF6B7,
-	0xFEF9,0xFF1A,0xFF19,0xFED8,0xF6B7,0xFE95,0xF672,0x6370,
-	0x1275,0x0AB7,0x2AF6,0xED47,0xED47,0xED46,0xED47,0xED47,
-	0xED47,0xED48,0xF568,0xED69,0xF589,0xF5A9,0xF5AA,0xEDCB,
-	0xEDCC,0xF5CD,0xF5EE,0xF5EE,0xF5EE,0xEDEE,0xEDED,0x0A32,
-	0x0A54,0x12B7,0x12F9,0x12F9,0x4B74,0xED06,0xED06,0xED06,
-	0xE4C6,0xE4A6,0xE4A6,0xEC66,0xECA6,0xED4D,0xF655,0xFE75,
-	0xFDCF,0xFD69,0xFDE9,0xFE69,0xFE88,0xFE46,0xED84,0xECC4,
-	0xE465,0xE485,0xE464,0xD403,0xC3A2,0xD3C3,0xEC68,0xF52C,
-	0xFD8F,0xFDF0,0xFDF0,0xFDEF,0xF5CE,0xD52E,0x1293,0x1AD3,
-	0x22F3,0x2313,0x2334,0x9C2E,0xE48A,0xE469,0xE468,0xE447,
-	0xEC66,0xEC86,0xF4A6,0xF4C6,0xFCE6,0xFD07,0xFD27,0xFD27,
-	0xF547,0xFD27,0xF527,0xF527,0xF527,0xF506,0xED05,0xECE5,
-	0xECC4,0xE506,0xEDCD,0xF632,0xEDCE,0xE507,0xE4C4,0xECE4,
-	0xECC5,0xEC85,0xEC86,0xEC87,0xECA8,0xECC9,0xE4A9,0xE4A9,
-	0x8160,0x8160,0x8160,0x8960,0x8961,0x8961,0x8961,0x8961,
-	0x8961,0x8961,0x8961,0x8961,0x8961,0x8961,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9141,0x8961,0x8941,0x8941,0x8941,
-	0x8941,0x8941,0x8941,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x1840,0x40A0,0x6901,0x9161,
-	0x9982,0x9982,0x9981,0x99A1,0x9981,0x99A1,0xA1A1,0xA1A1,
-	0xA1C2,0xA1E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xAA02,0xA9E2,0xA9E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA23,0xBA23,0xBA43,0xBA63,
-	0xBA83,0xC283,0xBAA3,0xBAA3,0xBAC3,0xBAC2,0xC2C2,0xC2C2,
-	0xBAC2,0xBAA2,0xBAA2,0xBA82,0xBA83,0xBA83,0xBA83,0xBA83,
-	0xBA83,0xBAA3,0xC2A3,0xC2C2,0xC2A3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB04,0xD324,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xDBC4,0xDBC4,0xD3C4,0xDBC4,0xDBE4,0xDC05,
-	0xDC46,0xDC87,0xE4CA,0x3312,0x1270,0x122E,0x222C,0xCD94,
-	0xFED9,0xF719,0xFF19,0xFEF8,0xFED7,0xF6B6,0x9CB0,0x09D0,
-	0x0A54,0x0A97,0x5B73,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED47,0xED47,0xF568,0xED68,0xF589,0xF589,0xF5A9,0xEDAA,
-	0xEDCB,0xF5CD,0xF5EE,0xF5EE,0xF5CE,0xEE0E,0xF5ED,0x0A32,
-	0x1254,0x12B7,0x12F9,0x12D9,0x4B74,0xED26,0xED06,0xED06,
-	0xECC6,0xE4A6,0xE4A6,0xEC66,0xE4A6,0xED4D,0xFE55,0xFE55,
-	0xFDCE,0xFD89,0xFDE9,0xFE69,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xE465,0xEC65,0xE484,0xD403,0xC3A2,0xCBC3,0xE467,0xFD2C,
-	0xFD8F,0xFDF0,0xFDF0,0xFDEF,0xF5CE,0x9C4F,0x1293,0x1AB3,
-	0x22F3,0x2313,0x5391,0xE4AB,0xE4AA,0xE469,0xE468,0xE467,
-	0xEC66,0xEC66,0xF4A6,0xF4C6,0xFCC6,0xFD07,0xFD27,0xFD27,
-	0xF547,0xFD27,0xF527,0xF527,0xF527,0xF506,0xED05,0xECE5,
-	0xE4E4,0xE527,0xEDEF,0xF632,0xED8C,0xE4E6,0xECE4,0xECE4,
-	0xECA5,0xEC85,0xEC86,0xEC87,0xECA8,0xECA9,0xE4A9,0xE4A9,
-	0x8160,0x8160,0x8160,0x8960,0x8960,0x8960,0x8961,0x8960,
-	0x8961,0x8961,0x9181,0x9181,0x9181,0x8981,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x9141,0x8961,0x8961,0x9141,0x9161,
-	0x8961,0x8941,0x8941,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1020,0x3880,0x6121,0x8981,0x91A1,0x99A1,0x9981,0x9981,
-	0x9981,0x9981,0x9981,0x9982,0x99A2,0xA1A1,0xA181,0xA1A2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E1,0xA9E2,0xA9E2,0xA9E2,0xA9E3,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xAA02,0xA9E2,0xA9E2,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA23,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xC2A3,0xBAA3,0xC2A3,0xC2C3,0xC2C2,0xC2C2,0xBAC2,
-	0xBAC2,0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBA83,0xBA83,0xBA83,
-	0xBA82,0xBAA3,0xC2A3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,
-	0xCAE3,0xCB04,0xD304,0xD324,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xD3C4,0xDBC4,0xD3C4,0xDBC4,0xDBE4,0xDBE5,
-	0xDC25,0xDC87,0xE4C9,0x7BF0,0x1291,0x124F,0x11EC,0x09AA,
-	0x634D,0x9CB2,0xBD94,0xBD74,0x8C50,0x428C,0x094B,0x09AE,
-	0x0A12,0x0A76,0xB4AB,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED47,0xF547,0xF548,0xF568,0xF568,0xF589,0xF5A9,0xEDA9,
-	0xEDAB,0xF5CC,0xF5EE,0xF5EE,0xEDCD,0xF5ED,0xF5ED,0x0A32,
-	0x1274,0x12B7,0x12D9,0x12F9,0x4B74,0xED26,0xED06,0xED06,
-	0xECC6,0xE4A6,0xE4A6,0xEC86,0xECA6,0xED4D,0xFE55,0xFE55,
-	0xF5CE,0xFD89,0xFDEA,0xFE49,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xE465,0xE485,0xE464,0xD403,0xC3A2,0xD3C3,0xEC67,0xF50C,
-	0xFD8E,0xFDF0,0xFDF0,0xFDEF,0xF5AF,0x7BEF,0x1292,0x1AB3,
-	0x1AD3,0x2313,0xA44E,0xE4AB,0xE4AA,0xE489,0xE468,0xEC67,
-	0xEC66,0xEC86,0xF4A6,0xF4C6,0xFCE6,0xFD07,0xFD27,0xF547,
-	0xFD47,0xF527,0xF527,0xF527,0xF526,0xF506,0xED05,0xECE4,
-	0xECE4,0xED28,0xEE10,0xF632,0xED6B,0xE4C4,0xE504,0xECE4,
-	0xECC5,0xECA5,0xEC86,0xEC87,0xECA8,0xECC9,0xECCA,0xE4A9,
-	0x8160,0x8160,0x8160,0x8160,0x8960,0x8961,0x8961,0x8961,
-	0x8961,0x9181,0x9180,0x9181,0x9181,0x9181,0x9181,0x9181,
-	0x9181,0x9181,0x9161,0x9161,0x9161,0x9161,0x9161,0x9161,
-	0x9161,0x8941,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x1840,0x40A0,0x7941,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x9981,0x9981,0x9981,0x9981,0x9981,0xA182,0xA1A2,0xA9C2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB1E2,0xAA02,0xAA02,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xAA02,0xB202,0xB1E2,0xB1E2,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA43,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xC2A3,0xBAA3,0xC2C3,0xC2C2,0xC2C3,0xC2C3,0xC2C3,
-	0xC2C2,0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xBA82,0xBAA3,0xBA83,
-	0xBAA3,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCAE4,0xCB04,0xD324,0xCB43,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xD3C4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xDBE5,
-	0xDC25,0xDC66,0xE4A8,0xD4CB,0x22D1,0x1270,0x120D,0x09AA,
-	0x0148,0x0106,0x00E6,0x00E6,0x0908,0x0929,0x094A,0x098D,
-	0x09F1,0x4332,0xED67,0xED47,0xED47,0xED47,0xED27,0xED47,
-	0xED47,0xF547,0xF548,0xF548,0xF568,0xF589,0xF5A8,0xEDA9,
-	0xEDAA,0xEDCB,0xF5CD,0xF5ED,0xEDCD,0xF5ED,0xF5CD,0x0A32,
-	0x0A74,0x0AB7,0x12D9,0x12F9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECC6,0xE4A6,0xE4A6,0xE486,0xECA6,0xED4D,0xF654,0xFE55,
-	0xFDCE,0xFD89,0xFDEA,0xFE49,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xE465,0xE485,0xE464,0xD403,0xC3A2,0xCBC3,0xE447,0xF50B,
-	0xFD8E,0xFDF0,0xFE10,0xFDEF,0xF5CE,0x7BEF,0x1293,0x1AB3,
-	0x1AD3,0x2313,0xD4AD,0xE4AB,0xE4AB,0xE48A,0xE468,0xEC67,
-	0xEC66,0xEC86,0xF4A6,0xF4C6,0xFCE6,0xFD07,0xFD27,0xF547,
-	0xF547,0xF547,0xF528,0xF527,0xF526,0xF506,0xED05,0xECE4,
-	0xE4E5,0xED6B,0xF631,0xF611,0xED29,0xE4E4,0xE504,0xED04,
-	0xECC5,0xEC86,0xEC86,0xEC87,0xECA8,0xECA9,0xE4A9,0xE4A9,
-	0x8160,0x8160,0x8160,0x8160,0x8960,0x8961,0x8961,0x8961,
-	0x8981,0x9181,0x8980,0x9180,0x9181,0x9181,0x9181,0x9180,
-	0x9181,0x9181,0x9181,0x9181,0x9161,0x9161,0x9161,0x9161,
-	0x9161,0x9161,0x9161,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0820,0x38A0,0x6101,0x9181,
-	0x99A1,0x99A1,0x9981,0x99A1,0xA1A1,0xA1A2,0xA1C2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xAA02,0xAA02,0xAA02,0xB1E2,0xAA02,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xAA02,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA43,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xC2A3,0xBAA3,0xC2C3,0xC2C2,0xC2C3,0xC2C3,0xC2E3,
-	0xC2C3,0xC2C3,0xC2C3,0xBAC2,0xBAA2,0xBAA2,0xBAA2,0xBAA3,
-	0xBAA3,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB04,0xD324,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xD3C4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xDBE4,
-	0xDC25,0xDC46,0xE488,0xE4EA,0xC4AD,0x22B0,0x122E,0x09EB,
-	0x0989,0x0907,0x00E6,0x00E6,0x0107,0x0128,0x0129,0x096B,
-	0x3AAF,0xE58C,0xF568,0xED47,0xED47,0xED47,0xED47,0xED47,
-	0xED47,0xF547,0xF548,0xF548,0xF568,0xF589,0xF5A8,0xEDA9,
-	0xEDA9,0xEDAB,0xF5CC,0xF5CD,0xEDCD,0xF5CD,0xF5CC,0x0A33,
-	0x0A74,0x0AB7,0x12D9,0x12D9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECC6,0xE4A6,0xE4A6,0xE486,0xECA6,0xED4D,0xF654,0xFE55,
-	0xFDCE,0xFD89,0xFDEA,0xFE49,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xE465,0xE485,0xE464,0xD403,0xC3A2,0xD3C2,0xE447,0xFD0B,
-	0xFD8E,0xFDF0,0xFE10,0xFDEF,0xF5CE,0x7C0F,0x1293,0x1AB3,
-	0x1AD3,0x1B13,0xE4CC,0xE4CB,0xE4AB,0xE48A,0xE469,0xE467,
-	0xEC66,0xEC86,0xF4A6,0xF4C6,0xFCE6,0xFD07,0xFD27,0xFD47,
-	0xF547,0xF547,0xF528,0xF527,0xF526,0xF506,0xED05,0xECE4,
-	0xE4E5,0xEDAC,0xF652,0xEDEF,0xE508,0xECC4,0xE4E4,0xECE4,
-	0xECC5,0xEC86,0xEC86,0xEC87,0xECA8,0xECA9,0xE4A9,0xE4A9,
-	0x8160,0x8160,0x8160,0x8160,0x8960,0x8961,0x8961,0x8961,
-	0x8981,0x9181,0x8980,0x9181,0x9181,0x9181,0x9181,0x91A1,
-	0x91A1,0x9181,0x9181,0x9181,0x9181,0x9181,0x9181,0x9181,
-	0x9181,0x9181,0x9161,0x8141,0x50C0,0x2860,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1840,0x58E1,0x7941,0xA1A1,0xA1A2,0xA9C2,0xA9E2,0xA9C2,
-	0xA9E1,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xB1E2,0xB202,0xAA02,0xB202,0xB202,0xB202,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xBA23,0xBA43,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2E3,0xC2C3,0xC2C3,0xC2C2,0xBAC2,0xBAA2,0xBAA2,0xBAA2,
-	0xBAA3,0xBAA3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xD304,0xD324,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xD3E4,0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,
-	0xDC04,0xDC45,0xDC67,0xE4C9,0xE50B,0xC4CE,0x3AEF,0x09EC,
-	0x09AA,0x0947,0x00E6,0x00E6,0x0106,0x0108,0x0929,0x42AD,
-	0xE611,0xF5ED,0xED89,0xED48,0xED47,0xED47,0xED47,0xED47,
-	0xED47,0xF547,0xF548,0xF548,0xF568,0xF568,0xF588,0xEDA9,
-	0xEDAA,0xEDAB,0xEDAC,0xF5CC,0xEDCC,0xEDCD,0xF5CC,0x0A33,
-	0x0A74,0x12B7,0x12D9,0x12F9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECC6,0xE4C6,0xE4A6,0xECA6,0xECC6,0xED4D,0xF634,0xFE55,
-	0xFDCE,0xFD89,0xFDEA,0xFE49,0xFE88,0xFE46,0xEDA5,0xE4C4,
-	0xE465,0xE485,0xE484,0xD403,0xC3A2,0xCBA3,0xEC46,0xFD0B,
-	0xFD8E,0xFDF0,0xFDF0,0xFDEF,0xF5CE,0x7BEF,0x1292,0x1AB3,
-	0x1AD3,0x22F3,0xE4CC,0xE4CB,0xE4CB,0xE4AA,0xE489,0x9C0E,
-	0x7BEF,0x63D2,0x4BB4,0x73F1,0xF4C6,0xFD07,0xFD27,0xF527,
-	0xF547,0xF528,0xF527,0xF527,0xF527,0xED06,0xECE5,0xECE4,
-	0xE507,0xEDEE,0xF652,0xEDCE,0xE4E6,0xECC4,0xECE4,0xECE4,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4A9,
-	0x8960,0x8960,0x8160,0x8960,0x8960,0x8961,0x8960,0x8961,
-	0x8981,0x8981,0x8980,0x9181,0x9181,0x9181,0x9181,0x91A1,
-	0x91A1,0x91A1,0x91A1,0x9181,0x9181,0x9181,0x9181,0x9181,
-	0x9181,0x9181,0x9181,0x9161,0x9161,0x9161,0x8961,0x58E1,
-	0x2880,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0xA9A1,0xA9C2,0xA9C2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xB202,
-	0xB1E2,0xAA02,0xAA02,0xAA02,0xAA02,0xB202,0xB202,0xB202,
-	0xAA02,0xB202,0xAA02,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xB222,0xB222,0xBA23,0xBA23,0xBA43,0xBA43,0xBA63,
-	0xBA83,0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2E3,0xC2E3,0xC2C2,0xC2C2,0xC2C2,0xBAA2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xD304,0xD324,0xD344,0xD344,0xD364,0xD384,
-	0xD3C4,0xD3C4,0xD3E4,0xDBE4,0xD3E4,0xD3E4,0xDBE4,0xDBE4,
-	0xDC04,0xDC45,0xDC67,0xE4A8,0xE50B,0xED4D,0xED90,0x9C70,
-	0x532E,0x11A9,0x0906,0x00E5,0x21A9,0x634E,0xBD73,0xF6B5,
-	0xF693,0xF60F,0xF5AB,0xED48,0xED27,0xED47,0xED47,0xED27,
-	0xED47,0xF547,0xF548,0xF548,0xED68,0xED68,0xF588,0xEDA9,
-	0xF5A9,0xED8A,0xEDAB,0xEDAC,0xEDCC,0xF5CC,0xF5CC,0x0A33,
-	0x0A74,0x12B7,0x12F9,0x12F9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECE6,0xE4C6,0xE4A6,0xECA6,0xECC6,0xF56D,0xF634,0xFE34,
-	0xF5CE,0xFD89,0xFDEA,0xFE49,0xFE88,0xFE46,0xEDA5,0xE4C4,
-	0xE465,0xE485,0xE484,0xD403,0xC3A2,0xCBA2,0xE426,0xFCEA,
-	0xFD8E,0xFDD0,0xFDF0,0xFDEF,0xF5CE,0x7BEF,0x1292,0x1A93,
-	0x1AD3,0x1B13,0xE4CC,0xE4CC,0xE4CB,0xE48A,0xE489,0x4BD3,
-	0x1378,0x0B79,0x0B59,0x4394,0xF4E7,0xFD07,0xFD27,0xFD47,
-	0xFD48,0xFD28,0xF527,0xF527,0xF526,0xED06,0xECE5,0xECE4,
-	0xED48,0xF5EF,0xF652,0xED8C,0xE4E5,0xE4C4,0xED04,0xECE4,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4C9,
-	0x8980,0x8980,0x8160,0x8960,0x8960,0x8960,0x8960,0x8981,
-	0x8981,0x8981,0x8980,0x8980,0x9180,0x9181,0x9181,0x9181,
-	0x91A1,0x91A1,0x91A1,0x91A1,0x9981,0x91A1,0x91A1,0x91A1,
-	0x91A1,0x9981,0x9181,0x9181,0x9161,0x9161,0x9181,0x9981,
-	0x9981,0x8981,0x6101,0x3080,0x0820,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0xA9C2,0xA9C2,0xA9C2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xB202,
-	0xB202,0xB202,0xAA02,0xAA02,0xAA02,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xB222,0xBA23,0xBA23,0xBA43,0xBA43,0xBA42,0xBA62,
-	0xBA83,0xC283,0xC2A3,0xC2A3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2E3,0xC2C3,0xC2E3,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xBAC2,
-	0xC2A3,0xBAA2,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAE3,0xCAE3,
-	0xCAE3,0xCB04,0xCB04,0xD324,0xD344,0xD344,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xD3E4,0xDBE4,0xD3E4,0xD3E4,0xDBE4,0xDBE4,
-	0xDC05,0xDC25,0xDC46,0xE488,0xE4CA,0xE52C,0xED6F,0xEDD1,
-	0xF634,0xF676,0xFED8,0xFF19,0xFF19,0xFF18,0xF6F7,0xF6D6,
-	0xF694,0xF630,0xF5CC,0xED69,0xF547,0xED47,0xED47,0xED47,
-	0xED47,0xF547,0xF548,0xED48,0xED48,0xF568,0xF588,0xF589,
-	0xED89,0xF58A,0xEDAB,0xEDAB,0xEDAC,0xF5CC,0xF5CC,0x1253,
-	0x1274,0x12B7,0x12D9,0x12F9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECE6,0xE4C5,0xE4C6,0xECA6,0xECC6,0xF56C,0xF634,0xFE34,
-	0xF5CE,0xFD89,0xFDEA,0xFE4A,0xFE88,0xFE46,0xEDA5,0xE4C4,
-	0xE465,0xEC85,0xE464,0xD403,0xC3A2,0xCBA3,0xE426,0xFCEA,
-	0xFD6E,0xFDCF,0xFDF0,0xFDEF,0xF5CE,0x7BEF,0x1292,0x1A93,
-	0x1AD3,0x1B13,0xE4CC,0xE4CB,0xECCB,0xECAA,0xE489,0x4BB4,
-	0x1358,0x1359,0x0B59,0x4394,0xFCC7,0xFD07,0xFD27,0xFD47,
-	0xFD48,0xFD28,0xF527,0xF527,0xF506,0xED06,0xECE5,0xECE4,
-	0xED69,0xF631,0xF651,0xED6A,0xE4E4,0xE4E4,0xED04,0xECE5,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4C9,
-	0x91E0,0x89A0,0x8980,0x8961,0x8960,0x8960,0x8961,0x8961,
-	0x8961,0x8981,0x8980,0x8980,0x9180,0x9181,0x9181,0x91A1,
-	0x91A1,0x91A1,0x91A1,0x99A1,0x91A1,0x91A1,0x91A1,0x91A1,
-	0x91A1,0x99A1,0x99A1,0x99A1,0x9981,0x9181,0x9981,0x99A1,
-	0x99A1,0x99A1,0x99C1,0x99C1,0x99C1,0x6941,0x38A0,0x0820,
-	0x0000,0x0000,0x2860,0xA9E1,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,
-	0xB1E2,0xB202,0xAA02,0xAA02,0xAA02,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB222,0xB223,0xBA23,0xBA23,0xBA43,0xBA43,0xBA43,0xC263,
-	0xBA83,0xC283,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2E3,0xC2E3,0xC2E3,0xC2C2,0xC2C3,0xC2C2,0xC2C2,0xC2C2,
-	0xC2A2,0xC2A3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,
-	0xCAE3,0xCB04,0xD304,0xD324,0xD344,0xD344,0xD384,0xD3A4,
-	0xDBC4,0xD3E4,0xDBE4,0xDBE4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,
-	0xDBE4,0xDC05,0xDC46,0xE487,0xE4C9,0xE50B,0xED4E,0xEDB0,
-	0xF5F3,0xF655,0xF6B7,0xFF19,0xFF19,0xFF19,0xF6F8,0xF6D6,
-	0xF6B5,0xF651,0xF5EE,0xED89,0xF547,0xED47,0xED47,0xED47,
-	0xED47,0xF547,0xF548,0xED48,0xED48,0xF568,0xED68,0xED88,
-	0xED88,0xF589,0xF58A,0xEDAB,0xEDAC,0xF5AC,0xF5AC,0x1253,
-	0x1274,0x12B7,0x12D9,0x12F9,0x4B74,0xED06,0xED06,0xECE6,
-	0xECE6,0xECC6,0xECC6,0xECA6,0xECC6,0xF56C,0xFE33,0xFE34,
-	0xF5CE,0xFD8A,0xFDEA,0xFE4A,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xEC65,0xEC85,0xE484,0xD423,0xC3A2,0xD3C2,0xE426,0xF4E9,
-	0xFD6D,0xFDCF,0xFDF0,0xFDEF,0xF5CE,0x7BEF,0x1292,0x1A93,
-	0x1AD3,0x1B13,0xE4CB,0xE4CB,0xE4CB,0xE4AA,0xECA9,0x4BB3,
-	0x1358,0x1359,0x0B59,0x4394,0xFCC7,0xFD07,0xFD27,0xFD68,
-	0xFD48,0xFD28,0xF527,0xF527,0xF506,0xED06,0xECE5,0xECE5,
-	0xED8B,0xF652,0xF631,0xED29,0xE4C4,0xECE4,0xE504,0xECE5,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4C9,
-	0x9A41,0x9200,0x91C1,0x8980,0x8960,0x8960,0x8960,0x8961,
-	0x8981,0x8980,0x8981,0x8980,0x9181,0x9181,0x9181,0x91A1,
-	0x91A1,0x91A1,0x91A1,0x91A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0x99A1,0x99A1,0x99A1,0x99A1,0x9981,0x9981,0x9981,
-	0x99A1,0x99A1,0xA1C2,0x99E1,0xA1E1,0xA1C1,0xA1C1,0xA1C1,
-	0x7141,0x40A0,0x3080,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0xB222,0xB222,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xB222,0xBA23,0xBA23,0xBA43,0xBA43,0xBA63,0xBA63,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2E3,0xC2E3,0xC2E3,0xC2C3,0xC2C3,0xC2C2,0xC2C2,0xC2C2,
-	0xC2A2,0xC2A2,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,
-	0xCB03,0xCB04,0xD324,0xD324,0xD344,0xD344,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xD3E4,0xDBE4,0xDBE4,0xD3E4,0xDBE4,0xDBE4,
-	0xDBE4,0xDC25,0xDC45,0xE466,0xE4A8,0xE50B,0xED4D,0xED90,
-	0xEDF2,0xF634,0xF697,0xF6F8,0xFF19,0xFF19,0xFEF8,0xF6F7,
-	0xF6D6,0xF653,0xF5EF,0xF5AB,0xF548,0xED47,0xED47,0xED27,
-	0xED47,0xED47,0xED47,0xF548,0xED48,0xF568,0xED68,0xED88,
-	0xED88,0xED89,0xED8A,0xEDAB,0xF5AB,0xF5AB,0xEDAB,0xF58C,
-	0xF58B,0xED48,0xED27,0xED06,0xED26,0xED06,0xED06,0xED06,
-	0xECE6,0xE4C6,0xECA6,0xECA6,0xECC6,0xF56C,0xFE33,0xFE34,
-	0xF5AE,0xFD8A,0xFDCA,0xFE4A,0xFE88,0xFE46,0xEDA5,0xECC4,
-	0xE465,0xEC85,0xE484,0xD423,0xCBA2,0xD3A2,0xE425,0xF4E9,
-	0xFD6D,0xFDCF,0xFDF0,0xFDF0,0xF5CE,0x7BEF,0x1292,0x1A93,
-	0x1AD3,0x1AF3,0xE4EC,0xE4CC,0xE4CB,0xE4AB,0xE4A9,0x3B94,
-	0x1358,0x1359,0x0B59,0x4394,0xFCC7,0xFD07,0xFD28,0xFD48,
-	0xFD48,0xF528,0xF527,0xF527,0xF506,0xED05,0xECE4,0xED06,
-	0xEDCD,0xF653,0xF5EF,0xED07,0xE4C4,0xE504,0xED04,0xECE5,
-	0xECA5,0xEC86,0xEC86,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4C9,
-	0xA2C1,0xA261,0x9A20,0x91E0,0x91A0,0x8980,0x8980,0x8980,
-	0x8960,0x8980,0x8980,0x8980,0x9181,0x9181,0x91A1,0x91A1,
-	0x9181,0x91A1,0x91A1,0x91A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0x99A1,0x99A1,0x99C1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0x99C1,0xA1C1,0xA1E2,0xA1E1,0xA1E1,0xA1E1,0x89A1,
-	0x48E0,0x1040,0x2860,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0xB222,0xB222,0xB202,0xB202,
-	0xB202,0xB222,0xB222,0xB222,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xB222,0xBA22,0xBA23,0xBA43,0xBA43,0xBA63,0xBA63,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xC2C3,0xC2E3,0xC2E3,
-	0xC303,0xC303,0xC303,0xC2E3,0xC2C3,0xC2C3,0xC2C2,0xC2C2,
-	0xC2C2,0xC2C2,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,
-	0xCB03,0xCB04,0xD324,0xD324,0xD344,0xD344,0xD384,0xD3A4,
-	0xD3C4,0xD3C4,0xDBE4,0xDBE4,0xD3E4,0xD3E4,0xDBE4,0xDBE4,
-	0xDC05,0xDC25,0xDC45,0x53D4,0x4BB4,0x4B93,0x4B71,0x4B30,
-	0x4B0F,0x42ED,0x42CC,0x428B,0x426B,0x426A,0x426B,0x428B,
-	0x428C,0x42CE,0x73AF,0xF5AC,0xF569,0xED47,0xF547,0xED27,
-	0xED47,0xED47,0xED27,0xF548,0xED48,0xED48,0xED68,0xED88,
-	0xED88,0xED69,0xED69,0xED8B,0xEDAB,0xEDAB,0xF5AB,0xEDAC,
-	0xED6A,0xED48,0xED06,0xED06,0xED26,0xED26,0xED06,0xED06,
-	0xECE6,0xE4E6,0xECA6,0xECA6,0xECC6,0xF56C,0xFE13,0xFE34,
-	0xF5AE,0xFD8A,0xFDCA,0xFE49,0xFE88,0xFE47,0xEDA5,0xECC4,
-	0xEC85,0xEC85,0xE485,0xD423,0xCBC2,0xD3A3,0xEC25,0xF4C9,
-	0xFD6D,0xFDCF,0xFDF0,0xFDEF,0xF5CE,0x7BEF,0x1292,0x1A93,
-	0x1AD3,0x1AF3,0xB46E,0xE4CB,0xE4CB,0xE4AB,0xECA9,0x1337,
-	0x1358,0x0B58,0x0B58,0x4394,0xF4C7,0xFD08,0xFD27,0xFD48,
-	0xF547,0xFD27,0xF527,0xF527,0xF506,0xED05,0xE4E4,0xED26,
-	0xF5CE,0xF673,0xEDCD,0xECE6,0xE4E4,0xE504,0xED05,0xECE5,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xECA8,0xECA9,0xE4C9,0xE4C9,
-	0xAAE0,0xAAC1,0xAA80,0xA260,0x9A20,0x91C0,0x91A0,0x8980,
-	0x8980,0x8980,0x8981,0x8981,0x8981,0x9181,0x9181,0x9181,
-	0x9181,0x91A1,0x91A1,0x91A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0x99C1,0x99A1,0x99C1,0x99A1,0x99A1,0x99C1,0x99C1,
-	0x99C1,0xA1C1,0xA1C1,0xA1E2,0x8181,0x48E0,0x1040,0x0000,
-	0x0000,0x0000,0x2880,0xAA02,0xA9E2,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xB1E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA02,0xB202,
-	0xB202,0xB202,0xB222,0xB202,0xB202,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB202,0xB202,
-	0xB222,0xBA22,0xBA22,0xBA23,0xBA43,0xBA43,0xBA63,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,0xC303,
-	0xC303,0xC323,0xC303,0xC302,0xC2E3,0xC2C3,0xC2C3,0xC2E3,
-	0xC2C3,0xC2C3,0xC2C3,0xC2A3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCAE3,0xCB03,0xD324,0xD324,0xD344,0xD344,0xD364,0xD384,
-	0xD3C4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,
-	0xDBE4,0xDC05,0xDC25,0x23D9,0x1B98,0x1B36,0x1AF4,0x1292,
-	0x122F,0x09EC,0x09AA,0x0148,0x0106,0x00C6,0x00C6,0x00E7,
-	0x0908,0x094B,0x42CE,0xF5EE,0xF58A,0xED68,0xED47,0xED27,
-	0xED47,0xED47,0xED27,0xF548,0xF548,0xF547,0xF567,0xED67,
-	0xED88,0xED68,0xED69,0xED8A,0xED8A,0xEDAB,0xF58B,0xF58B,
-	0xED8A,0xED47,0xED06,0xED26,0xED26,0xED06,0xED06,0xED06,
-	0xECE6,0xE4E6,0xECA6,0xECA6,0xECC6,0xED4C,0xFE33,0xFE34,
+	0xC005,0x8CB4,0x9C0B,0x0BEE,0x0001,0xE4A9,0xF54D,0xC007,
+	0xFFB5,0xA363,0x9B5B,0x549B,0x0001,0x63B0,0x2333,0xC00C,
+	0xA5AC,0x6DB5,0xADA5,0x5D9C,0x5C9C,0x945C,0xA300,0x0001,
+	0x4374,0xFD27,0xC009,0xAC5C,0x9CA3,0xA463,0xA49C,0x5BB7,
+	0x0003,0xEDAD,0xF611,0xED8D,0xE4E6,0xC008,0x9AE4,0x9D9D,
+	0xA5AD,0xA565,0xA300,0x0002,0x8160,0x8160,0x8161,0x8002,
+	0x8941,0x0001,0x8140,0x8140,0x8009,0x8941,0x0002,0x8921,
+	0x8921,0x8922,0x8002,0x8921,0x8002,0x8941,0xC005,0xECA4,
+	0xACA4,0xACA4,0x0003,0x7941,0x50E1,0x2860,0x0800,0x8004,
+	0x0000,0x0001,0x2060,0x9982,0xC005,0xA3A5,0xACA3,0xE4AD,
+	0x8003,0xA1A2,0xC003,0xACEC,0xA49C,0x800B,0xA9E2,0x0000,
+	0xB1E2,0x8002,0xB202,0xC008,0xADA4,0xA3ED,0xABA4,0xACA5,
+	0xAC00,0x8004,0xBAA2,0x8008,0xBA82,0x0002,0xBAA3,0xBAA3,
+	0xC2A3,0x8002,0xC2C3,0xC012,0xECA4,0xADAC,0xA4EC,0xACB4,
+	0xA4AC,0xA4E4,0x64A4,0xEDAD,0xB5BD,0xF600,0x0005,0xCCEE,
+	0x126F,0x122D,0x09AA,0x9CB2,0xF719,0xC005,0xE5A3,0x935A,
+	0x9B91,0x0004,0xF60D,0x6391,0x12B7,0x0AB8,0x2AF6,0x8004,
+	0xED47,0xC00E,0xA5EC,0xA4AD,0xAD6C,0xE4AE,0x65ED,0xA6A3,
+	0x63E5,0x9B00,0x0000,0x0A32,0xC003,0xAEBF,0xF6A4,0x0001,
+	0x4B74,0xED06,0xC006,0xA45C,0xDC5C,0x9C9C,0xAC00,0x000A,
+	0xED6E,0xFE75,0xFE76,0xFDCF,0xFD8A,0xFDC9,0xFE49,0xFE68,
+	0xF646,0xED84,0xE4C4,0xC005,0x8CA5,0xA30B,0x0BEE,0x0002,
+	0xE489,0xFD2D,0xFDD0,0xC005,0xADAB,0x9B5B,0x5B4B,0x0001,
+	0x73D0,0x22F3,0xC00D,0xB5A4,0xAC6D,0xB5A6,0xA465,0x9C5C,
+	0x945C,0xDCA4,0x0001,0x4374,0xFD27,0xC008,0xA464,0x9CA3,
+	0xA463,0x9CA4,0x6300,0x0004,0xE528,0xEDEF,0xF611,0xED4B,
+	0xE4C5,0xC008,0xA3E4,0x9D9D,0xA5AD,0xA565,0xA300,0x0000,
+	0x8160,0xC003,0xA4A5,0xE4A4,0x8007,0x8941,0x0000,0x8961,
+	0x8003,0x8941,0x0000,0x8922,0x8003,0x8921,0x8003,0x8941,
+	0x0001,0x9161,0x9161,0x8002,0x9181,0x0005,0x91A1,0x91A1,
+	0x8161,0x50E1,0x2860,0x0820,0x8003,0x0000,0x0000,0x2060,
+	0x8002,0x9981,0x0001,0xA1A2,0xA1A1,0x8002,0xA1C2,0x0001,
+	0xA1A2,0xA1C2,0x8003,0xA9E2,0x0000,0xA9C2,0x800A,0xA9E2,
+	0x0000,0xAA02,0x8003,0xB202,0x8002,0xBA23,0xC006,0xACA4,
+	0xACAC,0xA4AC,0xA300,0x8002,0xBAC2,0x0001,0xBAA2,0xBAA2,
+	0x8008,0xBA82,0xC003,0xADE4,0xA4AC,0x8002,0xCAE3,0xC010,
+	0xADAC,0xA3ED,0xACAC,0xACAC,0xA4E4,0xA464,0xECAD,0xADBE,
+	0xFE00,0x0004,0xB48E,0x1A90,0x122E,0x11CB,0xF697,0xC007,
+	0xFE6D,0xDB9B,0x6393,0xD950,0x0003,0xBCED,0x12B7,0x12B8,
+	0x12B8,0x8004,0xED47,0xC00E,0xECA5,0xA46D,0xE4AC,0xADAD,
+	0x65E6,0xAD9C,0xAB9C,0xA400,0x0000,0x0A32,0xC003,0xAEBF,
+	0xF6A4,0x0001,0x4B74,0xED06,0xC006,0xA45C,0x9C9C,0x9CDC,
+	0xAD00,0x0004,0xED6E,0xFE55,0xFE76,0xFDCF,0xFD89,0xC003,
+	0xBCBC,0xB392,0x0001,0xED84,0xE4A4,0xC005,0x8CB5,0x9B0B,
+	0x0BEE,0x0002,0xE488,0xFD2D,0xFDB0,0xC004,0xB5AB,0x9B5B,
+	0x5300,0x0001,0xB4AE,0x1AB3,0xC004,0xF4AC,0xAD6C,0xAD00,
+	0x0001,0x2BB5,0x63F2,0x8002,0x7BEF,0xC004,0xACA4,0x9CA5,
+	0xA300,0x0001,0x9C4E,0xF547,0xC008,0xDC64,0xA49C,0xA363,
+	0x9CA4,0x6400,0x0004,0xED49,0xEE10,0xF5F0,0xED2A,0xE4E4,
+	0xC008,0x9CE4,0x9D9D,0xA5AD,0xA564,0xA400,0x0001,0x8960,
+	0x8960,0x8008,0x8961,0x0001,0x8941,0x8961,0x8004,0x8941,
+	0xC004,0xA5A4,0xA39C,0xA400,0x8004,0x8941,0x0005,0x9161,
+	0x9161,0x8961,0x6101,0x3880,0x1020,0x8007,0x0000,0x0001,
+	0x2060,0x99A1,0xC007,0x9CA4,0xED63,0xE5AC,0xA3A5,0x800B,
+	0xA9E2,0x0000,0xAA02,0x8003,0xA9E2,0x8004,0xB202,0x8003,
+	0xBA23,0xC005,0xACAC,0xACE3,0x6DA3,0x8003,0xBAC2,0x0002,
+	0xBAA2,0xBA82,0xBA82,0x8005,0xBA83,0xC004,0xACA3,0xE5A4,
+	0xAC00,0x8002,0xCAE3,0xC007,0xADAC,0xA3ED,0xACAC,0xACAC,
+	0x8002,0xDBC4,0xC005,0x64EC,0xA5B5,0xF57E,0x0004,0xB48D,
+	0x12B1,0x124F,0x11EC,0xF676,0xC007,0xFFAD,0x6CDA,0x5BDB,
+	0x9A51,0x0003,0xBCEE,0x1296,0x12B8,0x12B8,0x8004,0xED47,
+	0xC00B,0xACE4,0xA564,0xED6C,0xEDA5,0xADA5,0xAEA3,0x8002,
+	0xF5EE,0x0000,0x0A32,0xC003,0xAEBF,0xF6A4,0x0000,0x4B74,
+	0x8002,0xED06,0xC004,0x549C,0x9C9C,0xEC00,0x0004,0xED6E,
+	0xFE55,0xFE75,0xFDAF,0xFD89,0xC003,0xBCBC,0xB392,0x0001,
+	0xED84,0xE4A4,0xC004,0x8DB4,0x9B0B,0x0B00,0x0003,0xD3C4,
+	0xE468,0xF52C,0xFDAF,0xC004,0xB5A4,0xA35B,0x5300,0x0001,
+	0x4B51,0x1AB3,0xC003,0xF4AC,0xAD6C,0x0001,0x7BEF,0xE469,
+	0xC00B,0x9BA3,0xE3AB,0xEDB4,0xACA5,0xACEC,0x6CDC,0x8002,
+	0xF527,0xC004,0x9B63,0x9CA3,0x6D00,0x0003,0xED6B,0xF611,
+	0xEDEF,0xE528,0xC009,0xD0A4,0x959C,0xA5A5,0xADAD,0x5CA4,
+	0x8003,0x8960,0x800C,0x8961,0x8009,0x8941,0x0002,0x6901,
+	0x48A0,0x1840,0x8009,0x0000,0x0003,0x1840,0x48C0,0x7941,
+	0x99A1,0xC006,0x9CAD,0xE4A3,0xA5A4,0xEC00,0x8011,0xA9E2,
+	0x0000,0xB1E2,0x8003,0xB202,0x0000,0xB222,0x8002,0xBA23,
+	0xC00B,0xACAC,0xACE4,0x6CA4,0xABA4,0xE4A4,0x5CA4,0x8002,
+	0xBA82,0x8003,0xBA83,0xC004,0xACA3,0xEC9D,0xAC00,0x8002,
+	0xCAE3,0xC010,0xADAC,0xA4EC,0xACAC,0xACAC,0xA4E4,0xA464,
+	0xE4AC,0xADB5,0xBE00,0x0005,0xCCAC,0x1AB2,0x126F,0x120D,
+	0x9C91,0xF6B7,0xC006,0xF6AD,0xA393,0x5BDA,0x5900,0x0006,
+	0x6370,0x1275,0x0AB7,0x2AF6,0xED47,0xED47,0xED46,0x8002,
+	0xED47,0xC008,0xA5EC,0x65EC,0xACA5,0x6DA5,0xE500,0x8002,
+	0xF5EE,0x0002,0xEDEE,0xEDED,0x0A32,0xC003,0xAEFF,0xB6A4,
+	0x0000,0x4B74,0x8002,0xED06,0xC004,0x549C,0xA4D4,0xB400,
+	0x000A,0xED4D,0xF655,0xFE75,0xFDCF,0xFD69,0xFDE9,0xFE69,
+	0xFE88,0xFE46,0xED84,0xECC4,0xC004,0x4DAC,0x9B0B,0x0B00,
+	0x0002,0xD3C3,0xEC68,0xF52C,0xC004,0xFFBD,0xA4A3,0x5B00,
+	0x0001,0xD52E,0x1293,0xC003,0xF4EC,0xACAD,0x0001,0x9C2E,
+	0xE48A,0xC00C,0x9BA3,0x9BEB,0xACEC,0xACEC,0xADAC,0xA46C,
+	0xDC00,0x8002,0xF527,0xC004,0x9B63,0x9C9B,0x7600,0x0003,
+	0xEDCD,0xF632,0xEDCE,0xE507,0xC009,0x91EC,0x9D94,0xA5A5,
+	0xADAD,0x5CA4,0x8002,0x8160,0x0000,0x8960,0x8009,0x8961,
+	0x8004,0x9161,0x0001,0x9141,0x8961,0x8005,0x8941,0x8008,
+	0x0000,0x0003,0x1840,0x40A0,0x6901,0x9161,0xC009,0xEDA4,
+	0xA3AC,0x9CAC,0xE4A4,0xADAC,0x800E,0xA9E2,0xC003,0xAC9C,
+	0xA4E4,0x8004,0xB202,0x0000,0xB222,0x8002,0xBA23,0xC00D,
+	0xACAC,0xACE4,0x6CA4,0xACA3,0xE4A4,0x649C,0xA49C,0x8004,
+	0xBA83,0xC004,0xACE4,0xAB9D,0xAC00,0x8002,0xCAE3,0xC011,
+	0xADA4,0xECAC,0xACAC,0xACAC,0xA4E4,0xA464,0xE4AC,0xADB5,
+	0xB5F7,0x0005,0x3312,0x1270,0x122E,0x222C,0xCD94,0xFED9,
+	0xC004,0x74E4,0x9B9B,0x5B00,0x0004,0x9CB0,0x09D0,0x0A54,
+	0x0A97,0x5B73,0x8006,0xED47,0xC00C,0xED64,0xEDA4,0xAC65,
+	0xADE6,0xADA4,0x9C74,0xDB00,0x0000,0x0A32,0xC003,0xEEBF,
+	0xB69C,0x0001,0x4B74,0xED26,0xC006,0x9CA4,0x945C,0xA4D4,
+	0x7400,0x000A,0xED4D,0xFE55,0xFE55,0xFDCE,0xFD89,0xFDE9,
+	0xFE69,0xFE88,0xFE46,0xEDA5,0xECC4,0xC005,0x4DE4,0x6B03,
+	0x0BED,0x0001,0xE467,0xFD2C,0xC004,0xBFBD,0xA4A3,0x5B00,
+	0x0006,0x9C4F,0x1293,0x1AB3,0x22F3,0x2313,0x5391,0xE4AB,
+	0xC00D,0xA393,0xA3A3,0xE3A4,0xF4AC,0xE4B5,0xACA4,0x6CDC,
+	0x8002,0xF527,0xC004,0x9B63,0x9C63,0xB700,0x0003,0xEDEF,
+	0xF632,0xED8C,0xE4E6,0xC009,0xE2A4,0x959C,0xA5A5,0xADA5,
+	0x64A4,0x8002,0x8160,0x8002,0x8960,0xC003,0xA5A3,0xA5A4,
+	0x8002,0x9181,0x0000,0x8981,0x8004,0x9161,0xC007,0x9C6C,
+	0xA4DC,0xAC64,0x9CA4,0x8004,0x0000,0x0005,0x1020,0x3880,
+	0x6121,0x8981,0x91A1,0x99A1,0x8004,0x9981,0xC004,0xA5AC,
+	0xE39C,0xAD00,0x8002,0xA9E2,0x0000,0xA9E1,0x8002,0xA9E2,
+	0x0000,0xA9E3,0x8005,0xA9E2,0x8004,0xAA02,0x0001,0xA9E2,
+	0xA9E2,0x8004,0xB202,0xC00E,0xACE5,0xA4AC,0xA4AC,0xACEC,
+	0x64E4,0xACA3,0xA464,0xA400,0x8002,0xBAA2,0x0000,0xBAA3,
+	0x8002,0xBA83,0x0001,0xBA82,0xBAA3,0x8002,0xC2A3,0xC00A,
+	0xACA4,0xECA4,0xADE4,0xACAC,0xACAC,0xAC00,0x8002,0xD3C4,
+	0xC007,0xE464,0xE4AC,0xA5B4,0xBEF6,0x000F,0x7BF0,0x1291,
+	0x124F,0x11EC,0x09AA,0x634D,0x9CB2,0xBD94,0xBD74,0x8C50,
+	0x428C,0x094B,0x09AE,0x0A12,0x0A76,0xB4AB,0x8005,0xED47,
+	0xC00D,0xE4A5,0xACA4,0xADAC,0x64A6,0xEDAE,0xA45B,0xECA4,
+	0x0000,0x0A32,0xC003,0xF6B7,0xAEAC,0x0001,0x4B74,0xED26,
+	0xC006,0x9CA4,0x945C,0xA4DC,0xAC00,0x0004,0xED4D,0xFE55,
+	0xFE55,0xF5CE,0xFD89,0xC003,0xBDBB,0xB392,0x0001,0xEDA5,
+	0xECC4,0xC004,0x4DAC,0x9B0B,0x0B00,0x0003,0xD3C3,0xEC67,
+	0xF50C,0xFD8E,0xC003,0xBEA4,0xA354,0x0006,0x7BEF,0x1292,
+	0x1AB3,0x1AD3,0x2313,0xA44E,0xE4AB,0xC00C,0xA39B,0x9BE3,
+	0xA3AC,0xECAC,0xECAD,0xAC6C,0xE400,0x8002,0xF527,0xC004,
+	0xA39C,0x639B,0xA400,0x0004,0xED28,0xEE10,0xF632,0xED6B,
+	0xE4C4,0xC009,0xB4DC,0x9D9C,0x9DA5,0xADAD,0xA55B,0x8003,
+	0x8160,0x0000,0x8960,0x8003,0x8961,0x0001,0x9181,0x9180,
+	0x8006,0x9181,0x8006,0x9161,0x0001,0x8941,0x9161,0x8005,
+	0x0000,0x0002,0x1840,0x40A0,0x7941,0x8003,0x99A1,0x8004,
+	0x9981,0x0002,0xA182,0xA1A2,0xA9C2,0x8007,0xA9E2,0xC004,
+	0xE46C,0xA49C,0xA400,0x8005,0xAA02,0x0002,0xB202,0xB1E2,
+	0xB1E2,0x8003,0xB202,0x0001,0xB222,0xBA23,0x8002,0xBA43,
+	0xC005,0xACAC,0xEC64,0xECA3,0x8002,0xC2C3,0xC00D,0xA364,
+	0xA49C,0xA49C,0xAD9C,0xACA4,0xE4A4,0xACA4,0x8002,0xCAE3,
+	0xC006,0xA5AC,0xEC6B,0xEDAC,0xAC00,0x8002,0xD3C4,0x8002,
+	0xDBC4,0xC005,0xACA5,0xB4B5,0xF62F,0x0000,0x22D1,0xC00A,
+	0x0B89,0x494A,0x929C,0xA4EE,0xADAD,0xB700,0x0002,0x09F1,
+	0x4332,0xED67,0x8002,0xED47,0xC010,0x9CAC,0xA4E4,0xA5A4,
+	0xACAD,0xAB65,0xA5AD,0xE6AC,0x5CEC,0x9C00,0x0000,0x0A32,
+	0xC003,0xB6B7,0xEEAC,0x0001,0x4B74,0xED06,0xC006,0xA49C,
+	0x9C5C,0xA49C,0xEC00,0x0004,0xED4D,0xF654,0xFE55,0xFDCE,
+	0xFD89,0xC003,0xBDBB,0xB392,0x0001,0xEDA5,0xECC4,0xC005,
+	0x4DAC,0x9B0B,0x0BED,0x0002,0xE447,0xF50B,0xFD8E,0xC003,
+	0xBEAC,0x9B5B,0x0006,0x7BEF,0x1293,0x1AB3,0x1AD3,0x2313,
+	0xD4AD,0xE4AB,0xC00A,0xA49B,0x9AE3,0xA3AC,0xECAC,0xECAD,
+	0xAC00,0x8002,0xF547,0xC006,0x9DA3,0xA39C,0x639B,0x6500,
+	0x0004,0xED6B,0xF631,0xF611,0xED29,0xE4E4,0xC009,0xACE4,
+	0x9595,0xA4A5,0xADA5,0x64A4,0x8003,0x8160,0x0000,0x8960,
+	0x8002,0x8961,0xC003,0xACE4,0x63E4,0x8002,0x9181,0x0000,
+	0x9180,0x8003,0x9181,0x8006,0x9161,0x8008,0x0000,0x0003,
+	0x0820,0x38A0,0x6101,0x9181,0xC006,0xECA4,0x9CAC,0xE4A5,
+	0xAC00,0x8009,0xA9E2,0x8002,0xAA02,0x0000,0xB1E2,0x8005,
+	0xAA02,0x0001,0xB1E2,0xB1E2,0x8004,0xB202,0x0001,0xB222,
+	0xBA23,0x8002,0xBA43,0xC008,0xACAC,0xEC64,0xECA3,0xA5A4,
+	0xAC00,0x8002,0xC2C3,0x0000,0xBAC2,0x8002,0xBAA2,0x8002,
+	0xBAA3,0xC003,0xE4A4,0xACA4,0x8002,0xCAE3,0xC006,0xADA4,
+	0xECAC,0xACAC,0xAC00,0x8002,0xD3C4,0x8002,0xDBC4,0xC005,
+	0xACA4,0xB5AD,0xF6BE,0x0001,0xC4AD,0x22B0,0xC009,0x0251,
+	0x8A82,0x5BA4,0xADAD,0xA5F6,0x0002,0x3AAF,0xE58C,0xF568,
+	0x8005,0xED47,0xC00D,0xE4A5,0xA4AC,0xADAB,0x65A4,0xA6ED,
+	0xA564,0xE4A3,0x0000,0x0A33,0xC003,0xB5B7,0xEEA4,0x0001,
+	0x4B74,0xED06,0xC006,0xA49C,0x9C5C,0xA49C,0xEC00,0x0004,
+	0xED4D,0xF654,0xFE55,0xFDCE,0xFD89,0xC003,0xBDBB,0xB392,
+	0x0001,0xEDA5,0xECC4,0xC004,0x4DAC,0x9B0B,0x0B00,0x0003,
+	0xD3C2,0xE447,0xFD0B,0xFD8E,0xC003,0xBEAC,0x9B5B,0x0005,
+	0x7C0F,0x1293,0x1AB3,0x1AD3,0x1B13,0xE4CC,0xC015,0xA39C,
+	0x9B9B,0xA2E3,0xACEC,0xACEC,0xADAC,0xAC64,0xA49D,0xA3A3,
+	0x9C63,0x9B65,0x0003,0xEDAC,0xF652,0xEDEF,0xE508,0xC00A,
+	0xD06C,0xE49D,0x95A4,0xA5AD,0xA564,0xA400,0x8003,0x8160,
+	0x0000,0x8960,0x8002,0x8961,0x0002,0x8981,0x9181,0x8980,
+	0x8003,0x9181,0x0001,0x91A1,0x91A1,0x8008,0x9181,0x0003,
+	0x9161,0x8141,0x50C0,0x2860,0x8009,0x0000,0x0003,0x1840,
+	0x58E1,0x7941,0xA1A1,0xC004,0xA5EC,0xAC9C,0xAB00,0x8006,
+	0xA9E2,0x0002,0xB1E2,0xB202,0xAA02,0x8002,0xB202,0x8003,
+	0xAA02,0x8007,0xB202,0x0001,0xB222,0xBA23,0x8002,0xBA43,
+	0xC005,0xACAC,0xE4AC,0xACA4,0x8003,0xC2E3,0xC003,0x9CA4,
+	0xA364,0x8002,0xBAA2,0xC005,0xA5A4,0xE4A4,0xACA4,0x8002,
+	0xCAE3,0xC00B,0xADE4,0xACAC,0xACAC,0xACAC,0xACA4,0xDCA4,
+	0x8002,0xDBE4,0xC004,0xACB5,0xAEFE,0xB600,0x0002,0xC4CE,
+	0x3AEF,0x09EC,0xC006,0x9289,0x4BA4,0xACA6,0xED00,0x0004,
+	0x42AD,0xE611,0xF5ED,0xED89,0xED48,0x8004,0xED47,0xC00D,
+	0xE4A5,0xA4AC,0xA4AC,0x6DA5,0xA5A5,0xEC64,0xA5E3,0x0000,
+	0x0A33,0xC003,0xB5F7,0xAEAC,0x0001,0x4B74,0xED06,0xC006,
+	0xA49C,0x9C64,0x9CE4,0xAC00,0x0004,0xED4D,0xF634,0xFE55,
+	0xFDCE,0xFD89,0xC003,0xBDBB,0xB392,0x0001,0xEDA5,0xE4C4,
+	0xC005,0x8DAC,0xA303,0x0BE5,0x0002,0xEC46,0xFD0B,0xFD8E,
+	0xC003,0xBEA4,0xA35B,0x0005,0x7BEF,0x1292,0x1AB3,0x1AD3,
+	0x22F3,0xE4CC,0xC003,0xA3A4,0x9B9B,0x0005,0x9C0E,0x7BEF,
+	0x63D2,0x4BB4,0x73F1,0xF4C6,0xC004,0xF5AC,0x64AC,0x9D00,
+	0x8002,0xF527,0xC003,0x5B9B,0xA36F,0x0003,0xEDEE,0xF652,
+	0xEDCE,0xE4E6,0xC00A,0xDAAC,0xA495,0x9D9C,0xADAD,0xA56C,
+	0x9C00,0x0000,0x8960,0xC009,0xA464,0xE4A4,0xA5A3,0xA5AC,
+	0xA4A3,0x8003,0x9181,0x8003,0x91A1,0x8007,0x9181,0x8002,
+	0x9161,0x0002,0x8961,0x58E1,0x2880,0x8008,0x0000,0x0003,
+	0x2860,0xA9A1,0xA9C2,0xA9C2,0x8006,0xA9E2,0xC003,0xACA4,
+	0xE49C,0x8003,0xAA02,0x8002,0xB202,0x0002,0xAA02,0xB202,
+	0xAA02,0x8005,0xB202,0xC00B,0xACA4,0xE5A4,0xACA4,0xACAC,
+	0xE4AC,0xA4AC,0x8004,0xC2E3,0x8002,0xC2C2,0x8004,0xBAA2,
+	0xC003,0xE5A4,0xACA4,0x8002,0xCAE3,0xC015,0xADE4,0xACAC,
+	0xA4AC,0xACB4,0xA4AC,0xE464,0xA4E4,0xA4AC,0xB5AE,0xF5BF,
+	0xF6B7,0x0008,0x9C70,0x532E,0x11A9,0x0906,0x00E5,0x21A9,
+	0x634E,0xBD73,0xF6B5,0xC016,0x9A80,0x8849,0x9BAC,0xA49C,
+	0xACE4,0xA5A4,0x6CA4,0xEC6D,0xE45D,0xADA5,0xACE4,0xA400,
+	0x0000,0x0A33,0xC003,0xB5F7,0xB6A4,0x0001,0x4B74,0xED06,
+	0xC006,0xA49C,0xA45C,0x9CE4,0xAC00,0x0004,0xF56D,0xF634,
+	0xFE34,0xF5CE,0xFD89,0xC003,0xBDBB,0xB392,0x0001,0xEDA5,
+	0xE4C4,0xC005,0x8DAC,0xA303,0x0BE4,0x0002,0xE426,0xFCEA,
+	0xFD8E,0xC003,0xB6AC,0xA35B,0x0005,0x7BEF,0x1292,0x1A93,
+	0x1AD3,0x1B13,0xE4CC,0xC003,0xA4A3,0x93A3,0x0005,0x4BD3,
+	0x1378,0x0B79,0x0B59,0x4394,0xF4E7,0xC00A,0xECAC,0xACA5,
+	0x9C63,0xA4A3,0x5C9B,0xA300,0x0004,0xED48,0xF5EF,0xF652,
+	0xED8C,0xE4E5,0xC00A,0x9BF4,0x9C95,0x9D9C,0xADAD,0xA56C,
+	0xA400,0x0002,0x8980,0x8980,0x8160,0x8003,0x8960,0x8002,
+	0x8981,0x0002,0x8980,0x8980,0x9180,0x8002,0x9181,0x8003,
+	0x91A1,0x0000,0x9981,0x8003,0x91A1,0xC008,0xDC64,0xA49C,
+	0xA4AC,0xE4A4,0x2400,0x0002,0x6101,0x3080,0x0820,0x8004,
+	0x0000,0x0000,0x2860,0x8002,0xA9C2,0x8006,0xA9E2,0x0001,
+	0xAA02,0xAA02,0x8002,0xB202,0x8002,0xAA02,0x800B,0xB202,
+	0xC00A,0xACE5,0xA4AC,0xA4A3,0xACAD,0xE4AC,0xA400,0x8004,
+	0xC2E3,0x0001,0xC2C3,0xC2E3,0x8003,0xC2C2,0xC006,0x64DD,
+	0x63E5,0xA4AC,0xA400,0x8002,0xCAE3,0xC023,0xADA4,0xECAC,
+	0xA4B4,0xACAC,0xACA4,0xE464,0xA4E4,0xA4AD,0xACAD,0xF6B6,
+	0xBEF7,0xBEFF,0xB6FE,0xB5A4,0xA35B,0x9B92,0x8888,0x49DA,
+	0x8003,0xED47,0xC00D,0xE4A5,0x64A4,0xECAC,0xA564,0xE56D,
+	0xA4A5,0xECA4,0x0000,0x1253,0xC003,0xADB7,0xAEAC,0x0001,
+	0x4B74,0xED06,0xC006,0xA49C,0xA45B,0xA5DC,0xAC00,0x0004,
+	0xF56C,0xF634,0xFE34,0xF5CE,0xFD89,0xC003,0xBDBC,0xB292,
+	0x0001,0xEDA5,0xE4C4,0xC005,0x8DEC,0x5B0B,0x0BE5,0x0002,
+	0xE426,0xFCEA,0xFD6E,0xC003,0xBDAD,0xA35B,0x0005,0x7BEF,
+	0x1292,0x1A93,0x1AD3,0x1B13,0xE4CC,0xC003,0xA3E4,0x9B5B,
+	0x0005,0x4BB4,0x1358,0x1359,0x0B59,0x4394,0xFCC7,0xC00A,
+	0xB4AC,0xACA5,0x9C63,0xA49B,0x649B,0xA300,0x0004,0xED69,
+	0xF631,0xF651,0xED6A,0xE4E4,0xC00A,0xA4EC,0x9D94,0x9D9C,
+	0xADAD,0xA56C,0xA400,0x0000,0x91E0,0xC004,0x549C,0x9DA3,
+	0xA400,0x8002,0x8961,0xC005,0xACA3,0xA4E4,0xA5A4,0x8003,
+	0x91A1,0x0000,0x99A1,0x8004,0x91A1,0x8002,0x99A1,0x0002,
+	0x9981,0x9181,0x9981,0x8002,0x99A1,0x8002,0x99C1,0x0006,
+	0x6941,0x38A0,0x0820,0x0000,0x0000,0x2860,0xA9E1,0x8008,
+	0xA9E2,0x8002,0xAA02,0x0001,0xB1E2,0xB202,0x8002,0xAA02,
+	0x800A,0xB202,0xC003,0xACA5,0xE4A4,0x8002,0xBA43,0xC004,
+	0xEC6C,0xE4AC,0xAC00,0x8006,0xC2E3,0x0001,0xC2C2,0xC2C3,
+	0x8002,0xC2C2,0x0000,0xC2A2,0x8002,0xC2A3,0xC010,0xACA4,
+	0xACA4,0xE4AD,0xE4AC,0xACA4,0xB4AC,0xEC6C,0xE4A4,0x6400,
+	0x8003,0xDBE4,0xC009,0xADB5,0xF5B6,0xB6F7,0xBEF7,0xBEBE,
+	0x8002,0xFF19,0xC004,0x5B9A,0x9B88,0x8900,0x0001,0xED89,
+	0xF547,0x8003,0xED47,0xC00D,0xE4A5,0x64A4,0xEC64,0xACA4,
+	0xE5A5,0x6DA5,0xE4A4,0x0000,0x1253,0xC003,0xADB7,0xAEAC,
+	0x0001,0x4B74,0xED06,0xC006,0xA49C,0xA49C,0xA49C,0xAC00,
+	0x0003,0xF56C,0xFE33,0xFE34,0xF5CE,0xC004,0xD0BC,0xBCB2,
+	0x9200,0x0001,0xEDA5,0xECC4,0xC004,0x8DAC,0x630B,0x0300,
+	0x0003,0xD3C2,0xE426,0xF4E9,0xFD6D,0xC003,0xBEAD,0xA35B,
+	0x0004,0x7BEF,0x1292,0x1A93,0x1AD3,0x1B13,0x8002,0xE4CB,
+	0x0007,0xE4AA,0xECA9,0x4BB3,0x1358,0x1359,0x0B59,0x4394,
+	0xFCC7,0xC00A,0xB4AC,0xB59C,0x9C63,0xA49B,0x649B,0xA400,
+	0x0004,0xED8B,0xF652,0xF631,0xED29,0xE4C4,0xC00A,0xEC6C,
+	0xDD94,0x9D9C,0xADAD,0xA56C,0xA400,0x0003,0x9A41,0x9200,
+	0x91C1,0x8980,0x8002,0x8960,0xC004,0xA5AC,0xA3A5,0xA300,
+	0x8002,0x9181,0x8004,0x91A1,0x8008,0x99A1,0x8002,0x9981,
+	0xC004,0xACA4,0xED6B,0xE400,0x8002,0xA1C1,0x0002,0x7141,
+	0x40A0,0x3080,0x8008,0xA9E2,0x8002,0xAA02,0x8004,0xB202,
+	0x0001,0xB222,0xB222,0x8003,0xB202,0x0000,0xB222,0x8005,
+	0xB202,0xC00A,0xACE5,0xA4AC,0xA4AC,0xA4EC,0xACA4,0xAC00,
+	0x8006,0xC2E3,0x0001,0xC2C3,0xC2C3,0x8002,0xC2C2,0x0001,
+	0xC2A2,0xC2A2,0x8002,0xC2C3,0x8002,0xC2E3,0xC00D,0xECA5,
+	0xECA4,0xACA4,0xB4AC,0xACAC,0xA4E4,0xA464,0x8002,0xDBE4,
+	0xC016,0xB5AC,0xEDB6,0xBFF6,0xB7BE,0xF6BF,0xBDED,0xA49B,
+	0x639B,0x8188,0x9089,0x63A4,0x9C00,0x8002,0xED47,0xC011,
+	0xE564,0xEC64,0xACA4,0xA5A5,0xADE4,0xA464,0xDDA3,0x519B,
+	0x9BAC,0x8002,0xED06,0xC004,0x9C5C,0xDCA4,0xAC00,0x000A,
+	0xF56C,0xFE33,0xFE34,0xF5AE,0xFD8A,0xFDCA,0xFE4A,0xFE88,
+	0xFE46,0xEDA5,0xECC4,0xC005,0x4DEC,0x630B,0x43E4,0x0002,
+	0xE425,0xF4E9,0xFD6D,0xC003,0xBEAD,0xA45A,0x0005,0x7BEF,
+	0x1292,0x1A93,0x1AD3,0x1AF3,0xE4EC,0xC003,0x9CA3,0x9CA2,
+	0x0005,0x3B94,0x1358,0x1359,0x0B59,0x4394,0xFCC7,0xC00A,
+	0xB4AD,0xACA4,0x5CA3,0xA49B,0x639B,0xAE00,0x0003,0xEDCD,
+	0xF653,0xF5EF,0xED07,0xC00B,0x51B4,0xE49D,0x949D,0xA4A5,
+	0xADA5,0x6CA4,0x0000,0xA2C1,0xC003,0x8C53,0x5494,0x8002,
+	0x8980,0x0000,0x8960,0x8002,0x8980,0xC004,0xE5A4,0xACA4,
+	0x9C00,0x8002,0x91A1,0x8006,0x99A1,0x0000,0x99C1,0x8004,
+	0x99A1,0x0002,0x99C1,0xA1C1,0xA1E2,0x8002,0xA1E1,0x0003,
+	0x89A1,0x48E0,0x1040,0x2860,0x8008,0xA9E2,0x8002,0xAA02,
+	0x8004,0xB202,0x0001,0xB222,0xB222,0x8002,0xB202,0x8002,
+	0xB222,0x8004,0xB202,0xC00E,0xACE4,0xA5AC,0xA4AC,0xA4EC,
+	0xACA4,0xACAC,0x9CAC,0xA400,0x8002,0xC303,0x0002,0xC2E3,
+	0xC2C3,0xC2C3,0x8003,0xC2C2,0x8002,0xC2C3,0x8002,0xC2E3,
+	0xC012,0xECA5,0xECA4,0xACA4,0xB4AC,0xACA4,0xECA4,0x64A4,
+	0xE4A4,0xADAC,0xAC00,0x0000,0x53D4,0xC00D,0x5C9B,0x9A93,
+	0x9B5A,0x9B93,0x9CA3,0xA5AC,0xA5B6,0x0001,0x73AF,0xF5AC,
+	0xC020,0x915A,0xE45C,0xACA4,0x9CED,0x64A4,0xACAC,0xA49D,
+	0xA4AE,0xACA4,0xE465,0x929A,0x92A4,0xACA4,0x9CA4,0x9C64,
+	0xD4A4,0xAC00,0x000A,0xF56C,0xFE13,0xFE34,0xF5AE,0xFD8A,
+	0xFDCA,0xFE49,0xFE88,0xFE47,0xEDA5,0xECC4,0xC005,0x95A4,
+	0x640A,0x4BDD,0x0002,0xEC25,0xF4C9,0xFD6D,0xC003,0xBEAD,
+	0xA35B,0x000F,0x7BEF,0x1292,0x1A93,0x1AD3,0x1AF3,0xB46E,
+	0xE4CB,0xE4CB,0xE4AB,0xECA9,0x1337,0x1358,0x0B58,0x0B58,
+	0x4394,0xF4C7,0xC00A,0xF5AB,0xAD63,0xDC64,0xA49B,0x635B,
+	0xF600,0x0003,0xF5CE,0xF673,0xEDCD,0xECE6,0xC00B,0x62AC,
+	0xE59C,0x949D,0x9CAD,0xADA5,0x6CA4,0x0000,0xAAE0,0xC005,
+	0x9D93,0x5C54,0x4C9C,0x8002,0x8980,0x8002,0x8981,0x8003,
+	0x9181,0x8002,0x91A1,0x8004,0x99A1,0xC004,0xAC9C,0xAC9C,
+	0xA400,0x8002,0x99C1,0x0005,0xA1C1,0xA1C1,0xA1E2,0x8181,
+	0x48E0,0x1040,0x8002,0x0000,0x0001,0x2880,0xAA02,0x8004,
+	0xA9E2,0x0001,0xB1E2,0xA9E2,0x8003,0xAA02,0x8002,0xB202,
+	0x0002,0xB222,0xB202,0xB202,0x8008,0xB222,0xC019,0x9CA4,
+	0xACE4,0xA4A5,0xACA4,0xACE4,0xACAC,0xA4AC,0xA4AC,0xA4AC,
+	0xA4AC,0x9CA3,0x9D9C,0xA4AC,0x8002,0xC2C3,0xC00E,0x9CAC,
+	0xACE4,0xAC9C,0xACED,0xA4AC,0xA4AC,0xACB4,0xAC00,0x8006,
+	0xDBE4,0x0002,0xDC05,0xDC25,0x23D9,0xC00D,0x538A,0x924A,
+	0x8951,0x924A,0x9294,0xA4AD,0xEDB7,0x0001,0x42CE,0xF5EE,
+	0xC018,0x885A,0x9B9C,0xACA4,0x9CED,0xA4A3,0xAC64,0xAD9C,
+	0xA5AD,0xA4AD,0xDCA4,0x6391,0x93AC,0xA400,0x8002,0xED06,
+	0xC004,0x9C64,0xD4A4,0xAC00,0x000A,0xED4C,0xFE33,0xFE34,
 	0xF5AE,0xFD8A,0xFDCA,0xFE49,0xFE88,0xFE47,0xF5A5,0xECC4,
-	0xEC85,0xEC85,0xE484,0xD423,0xCBC2,0xD3C2,0xE425,0xFCC9,
-	0xFD6C,0xFDAE,0xFDEF,0xFDEF,0xF5AF,0xAC8F,0x1292,0x1A93,
-	0x1AB3,0x1AF3,0x5BB1,0xE4CC,0xE4CB,0xECCB,0xDC8A,0x1337,
-	0x1338,0x0B58,0x0B59,0x4394,0xFCC7,0xFD07,0xFD48,0xFD68,
-	0xFD48,0xF528,0xF527,0xF527,0xF4E6,0xECE5,0xECE5,0xED48,
-	0xF610,0xF653,0xED8B,0xE4E5,0xE4E4,0xED04,0xED05,0xECC5,
-	0xECA5,0xEC86,0xEC86,0xEC87,0xE4A7,0xE4A9,0xE4C9,0xE4C9,
-	0xAAC1,0xB2E1,0xAAE1,0xAAC1,0xA281,0x9A20,0x9A01,0x91E1,
-	0x91A0,0x8980,0x8981,0x8980,0x8980,0x9181,0x9181,0x91A1,
-	0x9181,0x91A1,0x91A1,0x91A1,0x99A1,0x99A1,0x99A1,0x99A1,
-	0x99A1,0x99A1,0x99C1,0x99C1,0x99C1,0x99C1,0x99C1,0x99C1,
-	0xA1C1,0x6921,0x38A0,0x0820,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2880,0xAA02,0xAA02,0xA9E2,0xAA02,0xA9E2,
-	0xA9E2,0xAA02,0xA9E2,0xAA02,0xAA02,0xAA02,0xB202,0xB202,
-	0xB202,0xB202,0xB222,0xB222,0xB222,0xB222,0xB222,0xB202,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB202,0xB202,
-	0xBA22,0xBA22,0xBA23,0xBA43,0xBA43,0xBA43,0xBA63,0xBA63,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,0xC303,
-	0xC303,0xC303,0xC303,0xC302,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xC2C3,0xC2C3,0xC2C2,0xC2A3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB03,0xD324,0xCB24,0xD344,0xD344,0xD384,0xD384,
-	0xD3C4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,
-	0xDBE4,0xDC05,0xDC25,0x23D9,0x2399,0x1B57,0x1AF5,0x12B3,
-	0x1250,0x0A0D,0x09CB,0x0969,0x0107,0x00E6,0x00C6,0x00E7,
-	0x00E8,0x0129,0x42CE,0xF60F,0xF5AB,0xED68,0xED47,0xED27,
-	0xED47,0xED47,0xED27,0xF548,0xF548,0xF547,0xF567,0xED87,
-	0xED68,0xED68,0xED69,0xED69,0xED8A,0xED8B,0xF58B,0xF58B,
-	0xED6A,0xED47,0xED26,0xED26,0xED26,0xED26,0xED06,0xED06,
-	0xECE6,0xE4E6,0xECA6,0xECA6,0xECC7,0xED6C,0xF613,0xFE34,
-	0xF5AE,0xFD8A,0xFDCA,0xFE49,0xFE88,0xFE47,0xF5A5,0xECE4,
-	0xEC85,0xEC85,0xE485,0xDC23,0xCBC2,0xD3A3,0xEC25,0xF4C8,
-	0xFD4C,0xFDAE,0xFDEF,0xFDEF,0xF5CF,0xE56E,0x1292,0x1A93,
-	0x1AD3,0x1AF3,0x1B33,0x63B0,0xE4CB,0xECCB,0xA44D,0x1336,
-	0x1338,0x0B38,0x0B59,0x4394,0xF4E7,0xFD28,0xFD48,0xFD68,
-	0xFD48,0xFD27,0xF527,0xF527,0xF506,0xECE5,0xECE5,0xED4A,
-	0xF631,0xEE52,0xED69,0xECE4,0xE4E4,0xED04,0xED05,0xECC5,
-	0xECA5,0xEC86,0xEC66,0xEC87,0xE4A7,0xE4A9,0xE4C9,0xE4C9,
-	0xA261,0xAAC1,0xAAE1,0xB301,0xAAE1,0xAAA1,0xA261,0xA221,
-	0x9A00,0x91C0,0x89A0,0x8980,0x9180,0x8980,0x8980,0x9181,
-	0x91A1,0x91A1,0x9181,0x91A1,0x91A1,0x91A1,0x99A1,0x99A1,
-	0x99A1,0x99C1,0x99A1,0x99C1,0x99A1,0x99C1,0x6920,0x38A0,
-	0x0820,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2880,0xAA02,0xAA02,0xAA22,0xAA02,0xA9E2,
-	0xA9E2,0xA9E2,0xAA02,0xB202,0xB202,0xB202,0xB202,0xB222,
-	0xB202,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,
-	0xBA22,0xBA22,0xBA23,0xBA43,0xBA43,0xBA43,0xC263,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,0xCB03,
-	0xCB03,0xC302,0xC302,0xC302,0xC303,0xC2E3,0xC2E3,0xC2E3,
-	0xC2C3,0xC2C3,0xC2C3,0xC2A3,0xC2C3,0xC2E3,0xCAE3,0xCAE3,
-	0xCB03,0xCB04,0xD324,0xD324,0xD324,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC25,0x23DA,0x1B99,0x1B57,0x1B15,0x12B3,
-	0x1270,0x0A2E,0x09CB,0x098A,0x0128,0x00E6,0x00E6,0x00C7,
-	0x08E8,0x0129,0x42CD,0xF630,0xF5CC,0xED69,0xED47,0xED46,
-	0xED47,0xED27,0xED27,0xF548,0xF548,0xF548,0xF567,0xF588,
-	0xED88,0xED48,0xED68,0xF549,0xED6A,0xED8A,0xED8A,0xED8B,
-	0xED69,0xED48,0xED06,0xED26,0xED26,0xED26,0xED06,0xED06,
-	0xED06,0xECE6,0xE4C6,0xE4A6,0xECC6,0xF54C,0xF612,0xFE33,
-	0xF5AD,0xFDAA,0xFDEA,0xFE49,0xFE88,0xFE47,0xEDA5,0xECE4,
-	0xE4A5,0xECA5,0xE484,0xD423,0xCBC2,0xD3A3,0xEC25,0xF4C8,
-	0xFD2B,0xFDAE,0xFDEF,0xFDEF,0xF5AF,0xEDAE,0x6390,0x1AB3,
-	0x1AD3,0x1AF3,0x1B13,0x1B13,0x3353,0x73F0,0x2335,0x1337,
-	0x1337,0x0B38,0x0B58,0x4394,0xF4E7,0xFD28,0xF548,0xFD68,
-	0xFD48,0xFD28,0xF527,0xF527,0xED06,0xECE5,0xED05,0xED8B,
-	0xF653,0xEE31,0xED29,0xE4C5,0xE504,0xED24,0xED05,0xECA6,
-	0xECA6,0xEC86,0xEC66,0xEC87,0xE4A8,0xE4A9,0xE4A9,0xE4C9,
-	0x9A00,0x9A61,0xA281,0xAAC1,0xAAE1,0xB2E1,0xB2C1,0xAAA1,
-	0xA261,0x9A20,0x99E0,0x91A1,0x91A0,0x91A1,0x9181,0x9180,
-	0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x99A1,
-	0x99A1,0x99A1,0x99A1,0x6100,0x38A0,0x0820,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2060,
-	0x4900,0x81A1,0xB242,0xB222,0xB222,0xB222,0xB222,0xAA02,
-	0xB202,0xAA02,0xB202,0xB202,0xB202,0xB202,0xB202,0xB222,
-	0xB202,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xBA22,
-	0xBA22,0xBA22,0xBA22,0xBA43,0xBA43,0xBA43,0xC263,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xC2E3,0xC2E3,0xCB03,
-	0xC303,0xCB23,0xCB23,0xC303,0xC303,0xC2E2,0xC2E3,0xC2E3,
-	0xC2C3,0xC2C3,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB04,0xD324,0xD324,0xD344,0xD344,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC25,0x8410,0x7BEF,0x7BF0,0x7BEF,0x7BEF,
-	0x7BEF,0x7BF0,0x7BEF,0x530D,0x324B,0x0107,0x00E6,0x00C6,
-	0x1128,0x738F,0x9CB1,0xF652,0xF5EE,0xF58A,0xED48,0xED47,
-	0xED47,0xED27,0xED27,0xF548,0xF548,0xF548,0xF567,0xED87,
-	0xED88,0xED68,0xED48,0xED69,0xED6A,0xF56A,0xED8A,0x1274,
-	0x1296,0x12B7,0x12D9,0x12D9,0x12D9,0x12D9,0x12F9,0x12F9,
-	0x12F9,0x1B19,0x1B39,0x1359,0x1339,0x0AB4,0x09ED,0x01CC,
-	0x0A51,0x0255,0x0215,0x01B6,0x0196,0x01B8,0x0A5A,0x1B1B,
-	0x1B5A,0x135A,0x1B7B,0x23DC,0x343D,0x2C5C,0x13DA,0x0B37,
+	0xC005,0x95A4,0x630B,0x4BE4,0x0002,0xE425,0xFCC9,0xFD6C,
+	0xC003,0xB6B5,0xA454,0x000F,0xAC8F,0x1292,0x1A93,0x1AB3,
+	0x1AF3,0x5BB1,0xE4CC,0xE4CB,0xECCB,0xDC8A,0x1337,0x1338,
+	0x0B58,0x0B59,0x4394,0xFCC7,0xC00A,0xB4B5,0xAC9C,0x5CA3,
+	0xA493,0x63A4,0xBF00,0x0003,0xF610,0xF653,0xED8B,0xE4E5,
+	0xC00B,0xA3EC,0xA594,0x9C9D,0xA4A5,0x6CA6,0xACA4,0x0000,
+	0xAAC1,0xC00F,0xEC64,0x9C54,0x4B9D,0x5C93,0x5CA5,0xA3A4,
+	0xE5A4,0xAC9C,0x8002,0x91A1,0x8005,0x99A1,0x8005,0x99C1,
+	0x0003,0xA1C1,0x6921,0x38A0,0x0820,0x8005,0x0000,0x0001,
+	0x2880,0xAA02,0xC006,0xA49C,0xAC9C,0xA4AC,0x9C00,0x8002,
+	0xAA02,0x8003,0xB202,0x8004,0xB222,0x0000,0xB202,0x8005,
+	0xB222,0xC004,0x9CA4,0xECA4,0xA500,0x8002,0xBA43,0xC008,
+	0xACA4,0xECAC,0xA4AC,0xA4AC,0xA400,0x8003,0xC303,0x0000,
+	0xC302,0x8003,0xC2E3,0xC006,0x9CA4,0xA39D,0xACAC,0xE400,
+	0x8002,0xCB03,0xC007,0xED64,0xECA4,0xB4A4,0xB4AC,0x8006,
+	0xDBE4,0x0002,0xDC05,0xDC25,0x23D9,0xC00D,0x9452,0x8A52,
+	0x8951,0x928A,0x4A9B,0x9CAD,0xA5B5,0x0001,0x42CE,0xF60F,
+	0xC015,0x8851,0x9B9C,0xACA4,0x9CED,0xA4A3,0xAC6C,0x9DA4,
+	0xA5A4,0xADA5,0xE4A4,0x5B99,0x8003,0xED26,0xC006,0x9CA4,
+	0x9C64,0xD4A4,0xAD00,0x000A,0xED6C,0xF613,0xFE34,0xF5AE,
+	0xFD8A,0xFDCA,0xFE49,0xFE88,0xFE47,0xF5A5,0xECE4,0xC005,
+	0x8DA4,0x644A,0x0BDD,0x0002,0xEC25,0xF4C8,0xFD4C,0xC004,
+	0xBEB5,0xA45C,0x0B00,0x0000,0x1292,0xC003,0xE5B4,0xACB4,
+	0x0009,0x63B0,0xE4CB,0xECCB,0xA44D,0x1336,0x1338,0x0B38,
+	0x0B59,0x4394,0xF4E7,0xC009,0xF5AC,0xAC9C,0x9B64,0xA49B,
+	0x5BA4,0x0004,0xED4A,0xF631,0xEE52,0xED69,0xECE4,0xC00B,
+	0x64EC,0xA594,0x9C9D,0x9CAD,0x6CA6,0xACA4,0x0000,0xA261,
+	0xC011,0xFCAC,0xEC5C,0x9454,0x945B,0x545C,0x9CE4,0x64A4,
+	0xE5AC,0xA49C,0x8002,0x91A1,0x8002,0x99A1,0xC004,0xAC9C,
+	0xAC9C,0xAC00,0x0002,0x6920,0x38A0,0x0820,0x8008,0x0000,
+	0x0004,0x2880,0xAA02,0xAA02,0xAA22,0xAA02,0x8002,0xA9E2,
+	0x0000,0xAA02,0x8003,0xB202,0x0001,0xB222,0xB202,0x800E,
+	0xB222,0x0002,0xBA22,0xBA22,0xBA23,0x8002,0xBA43,0xC005,
+	0xECA4,0xACAC,0xA4AC,0x8002,0xC2E3,0x0001,0xCB03,0xCB03,
+	0x8002,0xC302,0x0000,0xC303,0x8002,0xC2E3,0x8002,0xC2C3,
+	0xC006,0x9CAC,0xACE4,0xA4AC,0xA500,0x8002,0xD324,0xC004,
+	0xB4AC,0xACAC,0xAC00,0x8005,0xDBE4,0x0003,0xDC04,0xDC04,
+	0xDC25,0x23DA,0xC00D,0x5392,0x924A,0x9152,0x8993,0x4A92,
+	0xA49D,0xED75,0x0001,0x42CD,0xF630,0xC006,0x8849,0x9AA3,
+	0xA59C,0xA400,0x8002,0xF548,0xC00C,0xABAD,0x6494,0xACDD,
+	0x6DAC,0xA4A5,0x9A9B,0x9200,0x8002,0xED26,0x8002,0xED06,
+	0xC003,0x9C5C,0x9CEC,0x0003,0xF54C,0xF612,0xFE33,0xF5AD,
+	0xC004,0xE1B4,0xBBB3,0x9300,0x0001,0xEDA5,0xECE4,0xC005,
+	0x55E4,0x5B0B,0x4BDD,0x0003,0xEC25,0xF4C8,0xFD2B,0xFDAE,
+	0xC003,0xB5A4,0x5463,0x0001,0x6390,0x1AB3,0xC003,0xACAC,
+	0xACA4,0x0002,0x3353,0x73F0,0x2335,0xC003,0x26A4,0x65AC,
+	0x0001,0x4394,0xF4E7,0xC009,0xF56C,0xEC9C,0x9C63,0xA45B,
+	0x9BAC,0x0003,0xED8B,0xF653,0xEE31,0xED29,0xC00C,0x48B3,
+	0xEC9D,0x8DA4,0x9C9C,0xAD6D,0xA5A4,0xAC00,0x0000,0x9A00,
+	0xC00E,0xBDEC,0xF4AC,0xE49C,0x5C54,0x5394,0x55A3,0xA59C,
+	0xA300,0x8006,0x91A1,0x8003,0x99A1,0x0002,0x6100,0x38A0,
+	0x0820,0x8008,0x0000,0x0003,0x2060,0x4900,0x81A1,0xB242,
+	0x8003,0xB222,0x0002,0xAA02,0xB202,0xAA02,0x8004,0xB202,
+	0x0001,0xB222,0xB202,0x800D,0xB222,0x8003,0xBA22,0x8002,
+	0xBA43,0xC011,0xECA4,0xACAC,0xA4AC,0xEC64,0xA4EC,0x64EC,
+	0xA45C,0xA49B,0xA5A4,0x8004,0xC2C3,0xC00C,0xACE4,0xACA4,
+	0xA5EC,0xA4AC,0xA4B4,0xACAC,0xAC00,0x8005,0xDBE4,0x0005,
+	0xDC04,0xDC04,0xDC25,0x8410,0x7BEF,0x7BF0,0x8002,0x7BEF,
+	0x000A,0x7BF0,0x7BEF,0x530D,0x324B,0x0107,0x00E6,0x00C6,
+	0x1128,0x738F,0x9CB1,0xF652,0xC006,0x8888,0x52A3,0xA49C,
+	0xA400,0x8002,0xF548,0xC008,0xAB6C,0xA59C,0x9CAD,0xA5E4,
+	0x6C00,0x0002,0x1274,0x1296,0x12B7,0x8003,0x12D9,0x8002,
+	0x12F9,0xC003,0xECAC,0x6C9C,0x0004,0x0AB4,0x09ED,0x01CC,
+	0x0A51,0x0255,0xC003,0x948D,0x9CAE,0x0001,0x0A5A,0x1B1B,
+	0xC003,0xB364,0xEDFD,0x000B,0x343D,0x2C5C,0x13DA,0x0B37,
 	0x02D3,0x7BEF,0xFDCF,0xFDCF,0xF5AF,0xEDAE,0xCD2E,0x22B2,
-	0x1AD3,0x1AF3,0x1B13,0x1B13,0x1314,0x1314,0x1315,0x1336,
-	0x1337,0x0B38,0x0B58,0x4394,0xFD07,0xFD28,0xF547,0xFD68,
-	0xFD48,0xF528,0xF527,0xF527,0xED06,0xECE5,0xED26,0xF5CD,
-	0xF653,0xEDEF,0xE507,0xE4C4,0xED04,0xED25,0xED05,0xECC6,
-	0xECA6,0xEC86,0xEC66,0xEC87,0xE4A8,0xE4A9,0xE4A9,0xE4C9,
-	0x89A0,0x91E0,0x9A20,0xA260,0xA2A1,0xAAC1,0xB2E1,0xB2E1,
-	0xB2C1,0xAA81,0xA261,0x9A21,0x99E0,0x91C1,0x91A1,0x91A0,
-	0x91A0,0x91A0,0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x99A1,
-	0x99A1,0x99A1,0x99A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0820,0x38A0,0x6961,0x9A01,0xB241,
-	0xB241,0xB242,0xB242,0xB242,0xB242,0xB221,0xB222,0xB222,
-	0xB202,0xB202,0xB202,0xB202,0xB202,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xBA22,
-	0xBA22,0xBA22,0xBA42,0xBA43,0xBA43,0xBA43,0xC263,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xC2E3,0xC2E3,0xCB03,
-	0xC303,0xCB23,0xCB23,0xCB23,0xC302,0xC302,0xC2E2,0xC2E3,
-	0xC2E3,0xC2C3,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB04,0xD324,0xD324,0xD344,0xD364,0xD384,0xD3A4,
-	0xD3C4,0xD3E4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC05,0xDC25,0xDC25,0xE467,0xE4A8,0xED0A,
-	0xED4D,0xEDAF,0xF612,0xF654,0xF696,0xCDD4,0x21A9,0x00C6,
-	0x00C7,0x320B,0xD614,0xF674,0xF610,0xEDAB,0xF549,0xED47,
-	0xED46,0xED47,0xED27,0xF548,0xF548,0xF548,0xF547,0xED67,
-	0xED67,0xED68,0xED68,0xED49,0xED69,0xED69,0xF56A,0x1295,
-	0x12B6,0x12B7,0x12D9,0x12D9,0x12D9,0x12D9,0x12D9,0x12F9,
-	0x12F9,0x1319,0x1339,0x1359,0x1339,0x0AB4,0x09EC,0x09CB,
-	0x0A51,0x0255,0x0215,0x01B6,0x0177,0x01B8,0x0A5A,0x131B,
-	0x135A,0x135A,0x1B7A,0x23DC,0x341C,0x2C5C,0x13DA,0x0B57,
-	0x02B4,0x83EF,0xFDEF,0xFDEF,0xF5AF,0xEDAE,0xE58D,0xA48F,
-	0x1AD2,0x1AF3,0x1B13,0x1B13,0x1314,0x1314,0x1315,0x1336,
-	0x1337,0x0B38,0x0B58,0x4394,0xF4E7,0xFD28,0xF567,0xFD48,
-	0xFD48,0xF528,0xF527,0xF507,0xF4E6,0xECE5,0xED27,0xF5EF,
-	0xF653,0xEDAD,0xE506,0xE4C4,0xED04,0xED05,0xED05,0xECC6,
-	0xECA6,0xEC86,0xEC86,0xEC87,0xE4A8,0xE4A9,0xE4A9,0xE4C9,
-	0x8960,0x8980,0x91C0,0x9200,0x9A20,0xA260,0xAAA1,0xB2E1,
-	0xB2E1,0xB2E1,0xB2C1,0xAAA1,0xA261,0x9A20,0x9A01,0x91C0,
-	0x91C0,0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x91A1,0x99A1,
-	0x99A1,0x99A1,0x99A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1040,0x48E0,0x7981,0xB221,0xB242,0xB241,0xBA61,0xB261,
-	0xB261,0xB262,0xB262,0xBA42,0xB242,0xB242,0xB242,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB202,0xB202,0xB222,0xB202,
-	0xB202,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xBA23,
-	0xB222,0xB222,0xB222,0xB242,0xB242,0xB222,0xB222,0xBA22,
-	0xBA42,0xBA42,0xBA42,0xBA43,0xBA43,0xBA43,0xC263,0xC263,
-	0xC283,0xC283,0xC2A3,0xC2C3,0xCAE3,0xCAE3,0xCAE3,0xCB03,
-	0xCB23,0xCB23,0xCB23,0xC323,0xCB03,0xCB03,0xC302,0xC2E3,
-	0xC2E3,0xC2E3,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB04,0xD324,0xD344,0xD344,0xD364,0xD384,0xDB84,
-	0xDBC4,0xD3E4,0xDC04,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDBE4,0xDC04,0xDC05,0xDC25,0xDC26,0xE466,0xE4A7,0xECE9,
-	0xED4C,0xED8F,0xF5F1,0xF634,0xF675,0xFEB7,0x9CB2,0x00C6,
-	0x08A6,0x00E8,0x428C,0xF694,0xF631,0xF5CD,0xED69,0xED47,
-	0xED46,0xED47,0xED27,0xF548,0xF548,0xF547,0xF547,0xED67,
-	0xED67,0xED48,0xED48,0xED48,0xED69,0xED69,0xED6A,0x1296,
-	0x0A96,0x12D8,0x12D9,0x12D8,0x12D9,0x12D9,0x12D9,0x12F9,
-	0x1319,0x1319,0x1339,0x1359,0x1339,0x12B4,0x0A0D,0x01CC,
-	0x0A31,0x0255,0x0215,0x01B6,0x0176,0x01B8,0x125A,0x1B1B,
-	0x135A,0x133A,0x1B5A,0x23DC,0x343D,0x2C3C,0x13DA,0x0B57,
-	0x02D4,0x7BEF,0xFDEF,0xFDEF,0xF5CF,0xF5AE,0xED8D,0xE56D,
-	0x9C4F,0x2B12,0x1B13,0x1B13,0x1314,0x1314,0x1315,0x1336,
-	0x1337,0x0B37,0x0B38,0x4394,0xF4E7,0xFD28,0xF568,0xFD68,
-	0xF548,0xFD28,0xF527,0xF506,0xF4E6,0xECE5,0xED48,0xF610,
-	0xF652,0xED8C,0xE4E5,0xE4E4,0xED24,0xED25,0xECE6,0xECA6,
-	0xEC86,0xEC86,0xEC86,0xEC87,0xE4A8,0xE4A9,0xE4A9,0xE4C9,
-	0x8960,0x8960,0x8980,0x89A0,0x91C0,0x9A00,0xA220,0xAA81,
-	0xAAA1,0xB2E1,0xB2E1,0xB2E1,0xAAC1,0xAAA0,0xA261,0xA241,
-	0x9A01,0x91E1,0x91C1,0x91C1,0x91A1,0x91A1,0x91A1,0x99C1,
-	0x99A1,0x99A1,0x99C1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x2060,0x48E0,0x7981,0xAA22,0xBA42,0xBA61,0xB262,
-	0xB261,0xB261,0xBA62,0xB262,0xB262,0xB262,0xB242,0xBA42,
-	0xB222,0xB222,0xB222,0xB222,0xB202,0xB202,0xB202,0xB202,
-	0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB222,0xB223,
-	0xB222,0xB222,0xB222,0xB242,0xB242,0xB222,0xB222,0xB222,
-	0xBA42,0xBA42,0xBA42,0xBA43,0xBA43,0xC263,0xC263,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCAE3,0xCB03,
-	0xCB23,0xCB23,0xCB23,0xC323,0xCB23,0xCB03,0xC302,0xC303,
-	0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC2C3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB24,0xCB24,0xD344,0xD344,0xD364,0xD384,0xDB84,
-	0xDBC4,0xD3E4,0xDC04,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDBE5,0xDC05,0xDC05,0xDC25,0xE446,0xE446,0xE487,0xECC9,
-	0xED2B,0xED6E,0xF5D1,0xF613,0xF655,0xF696,0xBD74,0x00C6,
-	0x00C6,0x08E7,0x0929,0xF695,0xF632,0xF5CE,0xF58B,0xED47,
-	0xED47,0xED47,0xED27,0xF547,0xF548,0xF547,0xED47,0xED67,
-	0xF567,0xED67,0xED48,0xED48,0xED69,0xED69,0xED69,0x1296,
-	0x0A96,0x12D8,0x12D9,0x12D9,0x12D9,0x12D9,0x12D9,0x12F9,
-	0x12F9,0x1319,0x1339,0x1359,0x1339,0x12B4,0x020D,0x01CC,
-	0x0A32,0x0255,0x0215,0x01B5,0x0176,0x01B8,0x1259,0x131A,
-	0x135A,0x1339,0x1B5A,0x23DC,0x341D,0x2C3C,0x13DA,0x0B57,
-	0x02D4,0x7BEF,0xFDEF,0xF5CF,0xF5CF,0xEDAE,0xED6D,0xE56C,
-	0xE52C,0xCCCD,0x63B0,0x1313,0x1314,0x1314,0x1315,0x1316,
-	0x1336,0x0B37,0x0B38,0x4394,0xF507,0xFD28,0xF568,0xF568,
-	0xF528,0xFD28,0xF527,0xF506,0xF4E6,0xECE5,0xED6A,0xF631,
-	0xF631,0xED6A,0xE4E5,0xECE4,0xED24,0xED25,0xECE6,0xECC6,
-	0xEC86,0xEC86,0xEC86,0xEC87,0xEC88,0xE4A9,0xE4A9,0xE4C9,
-	0x8960,0x8960,0x8960,0x8960,0x8981,0x91A1,0x91C1,0x9A01,
-	0xA241,0xAA81,0xAAA1,0xB2C1,0xB2E1,0xB2E1,0xAAC1,0xAAA1,
-	0xA261,0xA241,0x9A00,0x99E0,0x91C0,0x99A1,0x99A1,0x99C1,
-	0x99A1,0x99A1,0x99C1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x2060,0x5921,0x89C1,
-	0xBA81,0xBA81,0xBA82,0xB262,0xBA62,0xBA81,0xBA61,0xBA62,
-	0xB241,0xB242,0xB222,0xB222,0xB222,0xB202,0xB202,0xB222,
-	0xB222,0xB222,0xB222,0xB222,0xB242,0xB242,0xB222,0xBA23,
-	0xBA22,0xB222,0xB242,0xBA42,0xBA42,0xB242,0xBA42,0xB222,
-	0xBA42,0xBA42,0xBA42,0xBA43,0xBA43,0xC263,0xC263,0xC263,
-	0xC283,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCAE3,0xCB23,
-	0xCB23,0xCB23,0xCB23,0xCB43,0xCB22,0xCB03,0xCB02,0xCB02,
-	0xCB03,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB24,0xCB24,0xD344,0xD344,0xD364,0xD384,0xDB84,
-	0xDBC4,0xD3E4,0xDC04,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDBE4,0xDC05,0xDC05,0xDC25,0xDC25,0xE446,0xE467,0xE4C8,
-	0xED0A,0xED6D,0xF5B0,0xF612,0xF654,0xF696,0x634E,0x00E6,
-	0x00A7,0x00C6,0x1168,0xF6B6,0xF653,0xF610,0xF5AC,0xED68,
-	0xED47,0xED27,0xED47,0xED47,0xF548,0xF547,0xED67,0xED67,
-	0xF567,0xED67,0xED68,0xED48,0xED48,0xED49,0xED69,0x1296,
-	0x12B6,0x12D8,0x12D9,0x12D9,0x12D9,0x12D9,0x12D9,0x12F9,
-	0x1319,0x1319,0x1339,0x1359,0x1339,0x12B3,0x020D,0x01EC,
-	0x0A31,0x0255,0x0215,0x01B5,0x0176,0x01B8,0x0A59,0x131A,
-	0x133A,0x133A,0x1B5A,0x23BC,0x341D,0x2C1C,0x13BA,0x0B77,
-	0x02D5,0x7BF0,0xFDCE,0xF5CF,0xF5CF,0xEDAE,0xED6D,0xE54C,
-	0xE52C,0xE50C,0xE50C,0xE50C,0xB46D,0xB48D,0xB48D,0x4B92,
-	0x1336,0x1337,0x0B37,0x4394,0xFD08,0xFD28,0xF568,0xF568,
-	0xF528,0xFD28,0xF527,0xF506,0xECE6,0xECE6,0xED8B,0xF652,
-	0xF610,0xED28,0xE4C4,0xED04,0xED45,0xED25,0xECE6,0xECC6,
-	0xEC86,0xEC86,0xEC86,0xEC87,0xEC88,0xE4A8,0xE4C9,0xE4C9,
-	0x8960,0x8960,0x8960,0x8160,0x8980,0x8980,0x8980,0x91A0,
-	0x91E1,0x9A21,0xA241,0xAA81,0xAAC1,0xB2E1,0xB2E1,0xB2E1,
-	0xB2C1,0xAAA1,0xAA61,0xA221,0x9A01,0x99E1,0x99E1,0x99C1,
-	0x99C1,0x99C1,0x99C1,0x91A1,0x7120,0x38A0,0x1040,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x38C0,0x71A1,0xBA82,0xBA81,0xBA81,0xBA61,0xBA62,
-	0xBA42,0xBA42,0xB242,0xB242,0xB222,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB223,0xB222,0xB242,0xB222,0xBA23,
-	0xB222,0xB222,0xB242,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA42,0xBA43,0xBA43,0xBA43,0xC263,0xC263,0xC283,
-	0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAC3,0xCAE3,0xCB03,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xCB43,0xCB22,0xCB22,0xCB22,0xCB02,
-	0xCB03,0xCB03,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xCB03,
-	0xCB03,0xCB24,0xCB24,0xD344,0xD344,0xD364,0xD364,0xDB84,
-	0xDBA4,0xDBC4,0xDBE4,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDC04,0xDC05,0xDC05,0xDC25,0xDC25,0xE425,0xDC66,0xE4A8,
-	0xECEA,0xED4C,0xF5AF,0xF5F1,0xF634,0xFE75,0xBD53,0x73AE,
-	0x31EA,0x00C6,0x738F,0xF6D7,0xF675,0xF631,0xF5CD,0xED69,
-	0xED47,0xED27,0xED27,0xF547,0xF548,0xF547,0xED47,0xED67,
-	0xF567,0xED67,0xED47,0xED48,0xED48,0xED48,0xED49,0x12B6,
-	0x12B6,0x12D8,0x12D8,0x12D9,0x12D9,0x12D9,0x12D9,0x12F9,
-	0x1319,0x1319,0x1339,0x1339,0x1339,0x12B4,0x0A0D,0x01ED,
-	0x0A52,0x0255,0x0215,0x01B5,0x0176,0x01B8,0x0A59,0x131A,
-	0x133A,0x133A,0x1B5A,0x23BC,0x2C1C,0x2C1C,0x13BA,0x0B77,
-	0x02F5,0x7BEF,0xFDCE,0xFDCF,0xF5CF,0xEDAE,0xED6D,0xE54C,
-	0xE52C,0xE50C,0xE50C,0xE50B,0xECEB,0xECEA,0xECEA,0x3B73,
-	0x1336,0x0B36,0x0B37,0x4394,0xF508,0xFD28,0xF568,0xF568,
-	0xFD28,0xF528,0xF527,0xF506,0xECE6,0xED06,0xEDAD,0xF673,
-	0xF5CF,0xECE7,0xECC4,0xED05,0xED24,0xED25,0xECE6,0xECC6,
-	0xEC86,0xEC86,0xEC86,0xEC86,0xE4A8,0xE4A8,0xE4A9,0xE4C9,
-	0x8960,0x8960,0x8960,0x8960,0x8960,0x8960,0x8960,0x8980,
-	0x89A0,0x91A1,0x91E0,0x9A21,0xA261,0xAAA1,0xB2C1,0xB2E1,
-	0xB301,0xB2E1,0xB2E1,0xAAA1,0xAA61,0xA241,0xA220,0x99E1,
-	0x99E1,0x99C1,0x99C1,0xA1A1,0xA1C1,0xAA02,0xAA01,0x99C1,
-	0x6940,0x38A0,0x0820,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x3080,0xBA82,0xBA82,0xBA82,0xBA82,0xBA81,
-	0xB262,0xBA62,0xBA62,0xB242,0xB242,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB223,0xBA42,0xBA42,0xBA43,0xB222,
-	0xBA22,0xBA22,0xB222,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA43,0xBA42,0xBA43,0xBA43,0xC263,0xC263,0xC283,
-	0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCAE3,0xCAE3,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xCB43,0xCB43,0xCB43,0xCB23,0xC303,
-	0xCB03,0xCB03,0xC303,0xC2E3,0xC2E3,0xC2E3,0xCAE3,0xCB03,
-	0xCB03,0xCB23,0xCB24,0xD344,0xD364,0xD364,0xD364,0xDB84,
-	0xDBA4,0xDBC4,0xDBE4,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC04,0xDC24,0xDC05,0xDC25,0xE446,0xE487,
-	0xECE9,0xED2C,0xED8E,0xF5F1,0xF633,0xF655,0xF695,0x9CB1,
-	0x426B,0x31E9,0x5B2D,0xF6D7,0xF695,0xF632,0xF5EE,0xED8A,
-	0xED47,0xED26,0xED27,0xF528,0xF548,0xF547,0xF547,0xED67,
-	0xED67,0xED67,0xED47,0xF548,0xED48,0xED48,0xED49,0x12B6,
-	0x12B7,0x12D8,0x12D9,0x12D9,0x12D8,0x12D9,0x12F9,0x12F9,
-	0x1319,0x1339,0x1B39,0x1338,0x1339,0x12B4,0x0A0D,0x09ED,
-	0x0A31,0x0255,0x0215,0x01B5,0x0176,0x01B8,0x0A59,0x12FA,
-	0x135A,0x133A,0x1B5A,0x239B,0x2BFD,0x2C1C,0x13BA,0x0B78,
-	0x02F5,0x7BEF,0xFDCE,0xF5EF,0xF5CE,0xEDAD,0xED6D,0xE56D,
-	0xE52C,0xE52C,0xE50C,0xED0B,0xECEB,0xECEB,0xECEB,0x1315,
-	0x1316,0x1336,0x1337,0x4394,0xF508,0xF548,0xFD48,0xFD48,
-	0xFD28,0xF527,0xF527,0xF506,0xECE6,0xED26,0xF5EF,0xF673,
-	0xF5CD,0xECE6,0xE4E5,0xED24,0xED44,0xED25,0xF4C6,0xECA6,
-	0xEC86,0xF486,0xEC66,0xEC86,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8960,0x8980,0x8980,0x8960,0x8960,0x8960,0x8960,0x8980,
-	0x8980,0x8980,0x8980,0x91A1,0x91E1,0x9A21,0xA260,0xAAA0,
-	0xB2C1,0xB2E1,0xB2E1,0xB2E1,0xB2E1,0xB2C1,0xAA81,0xAA61,
-	0xA221,0xA202,0xA1E1,0xA1E1,0xAA02,0xAA01,0xAA01,0xB201,
-	0xB202,0xB201,0xB221,0x91C1,0x40C0,0x0800,0x0000,0x0000,
-	0x0000,0x0000,0x28A0,0xBA82,0xBA82,0xBAA2,0xBAA2,0xBA82,
-	0xBA82,0xBA62,0xBA62,0xBA62,0xB242,0xB242,0xB242,0xBA42,
-	0xB222,0xB222,0xB222,0xB222,0xBA42,0xBA42,0xBA43,0xBA42,
-	0xBA22,0xBA42,0xB222,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA42,0xBA42,0xBA43,0xBA43,0xC263,0xC263,0xC283,
-	0xC2A3,0xCAA3,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xCB03,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xCB43,0xCB43,0xCB43,0xCB23,0xCB23,
-	0xCB23,0xCB03,0xC303,0xCAE3,0xC2E3,0xC2E3,0xCB03,0xCB03,
-	0xCB03,0xCB24,0xCB24,0xD344,0xD364,0xD364,0xD364,0xDB85,
-	0xDBA4,0xDBC4,0xDC04,0xDC04,0xDC04,0xDC04,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC04,0xDC25,0xDC05,0xDC25,0xDC46,0xE487,
-	0xECC9,0xED2B,0xED6D,0xF5D0,0xF612,0xF654,0xF695,0x83EF,
-	0x00C7,0x00A6,0x426B,0xFEF8,0xFEB6,0xF674,0xF610,0xEDAC,
-	0xED68,0xED27,0xED47,0xF527,0xF548,0xF547,0xF547,0xED67,
-	0xED67,0xED67,0xED47,0xED47,0xED48,0xED48,0xED48,0xED49,
-	0xED28,0xED27,0xED26,0xED26,0xED26,0xED27,0xED06,0xED06,
-	0xED06,0xECE6,0xE4C6,0xECC7,0x1339,0x12B4,0x0A0D,0x09ED,
-	0x0A52,0x4332,0xFDEA,0xFE4A,0xFE89,0xFE47,0xF5A6,0xED05,
-	0xECC5,0xECE6,0xE4A5,0xAC29,0x341D,0x2C1C,0x13BA,0x0B78,
-	0x02F5,0x7BEF,0xFDCE,0xF5CF,0xF5CE,0xF5AD,0xED8D,0xE56D,
-	0xE52C,0xE50C,0xED0C,0xED0B,0xED0B,0xECEB,0xECEB,0x1315,
-	0x1316,0x0B36,0x0B37,0x63D1,0xF528,0xFD48,0xFD47,0xFD48,
-	0xF528,0xFD28,0xF527,0xF4E6,0xECE6,0xED27,0xF610,0xF653,
-	0xED8B,0xECC5,0xE4C4,0xED25,0xED45,0xED25,0xF4C6,0xECA6,
-	0xECA6,0xF486,0xEC66,0xEC86,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8980,0x8960,0x8960,0x8960,0x8960,0x8960,0x8960,0x8980,
-	0x8980,0x8980,0x8980,0x8980,0x91A0,0x91C0,0x99E1,0x9A21,
-	0xA260,0xAAA1,0xB2C1,0xB2E1,0xBB01,0xBB01,0xB301,0xB2E1,
-	0xB2A1,0xAA41,0xAA41,0xB241,0xB221,0xAA01,0xB201,0xAA02,
-	0x99A2,0x6941,0x40C0,0x0820,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x28A0,0xBAA1,0xBAA1,0xBAA1,0xBAA1,0xBAA1,
-	0xBA81,0xBA82,0xBA82,0xBA62,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA42,0xB222,0xB222,0xB222,0xBA42,0xBA42,0xBA42,
-	0xBA22,0xBA42,0xBA42,0xBA62,0xBA42,0xBA62,0xBA42,0xBA42,
-	0xBA42,0xBA42,0xBA42,0xBA43,0xC263,0xC263,0xC263,0xC283,
-	0xCAA3,0xCAA3,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xCB43,0xCB63,0xCB43,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xCB03,0xCAE3,0xCAE3,0xCAE3,0xCB03,0xCB03,
-	0xCB03,0xCB24,0xD344,0xD344,0xD364,0xD364,0xD364,0xDBA4,
-	0xDBA4,0xDBC4,0xDC04,0xDC04,0xDC24,0xDC24,0xDC04,0xDC04,
-	0xDC04,0xDC04,0xDC04,0xDC25,0xB40A,0x73F1,0x4BD4,0x4BD4,
-	0x4BB4,0x4B72,0x4B51,0x4330,0x430F,0x42ED,0x42CD,0x21EB,
-	0x00E7,0x00C6,0x1127,0x426B,0x42AC,0x530E,0xF632,0xF5CD,
-	0xED69,0xED27,0xED47,0xF527,0xF548,0xF527,0xF547,0xF567,
-	0xF567,0xED67,0xED47,0xED47,0xED27,0xED48,0xED48,0xED48,
-	0xED48,0xED27,0xED26,0xED26,0xED27,0xED26,0xED26,0xED06,
-	0xED06,0xECC6,0xECC6,0xECA6,0x1339,0x12B4,0x0A0E,0x09CD,
-	0x0A52,0x4333,0xFDEA,0xFE4A,0xFE89,0xFE48,0xF5C6,0xED05,
-	0xECA5,0xECC6,0xE4C5,0xAC29,0x33FD,0x23FC,0x13BA,0x0B78,
-	0x02F6,0x7BEF,0xFDAD,0xF5CF,0xF5CE,0xF58E,0xED8D,0xE56C,
-	0xE54C,0xE52C,0xED0C,0xED0C,0xED0B,0xECEB,0xECEB,0x1315,
-	0x1336,0x0B36,0x0B17,0x7BEF,0xFD28,0xFD48,0xFD47,0xF548,
-	0xFD28,0xFD28,0xF527,0xF4E6,0xECE6,0xED69,0xF631,0xF632,
-	0xED6A,0xE4C5,0xE4E4,0xED24,0xED45,0xED25,0xECC6,0xECA6,
-	0xEC86,0xEC86,0xEC86,0xEC86,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8980,0x8980,0x8980,0x8980,0x8960,0x8980,0x8960,0x8960,
-	0x8960,0x8960,0x8960,0x8980,0x8980,0x91A1,0x91A1,0x91C1,
-	0x99E0,0x9A21,0xA261,0xAAA1,0xB2C1,0xB301,0xBB21,0xBB21,
-	0xBB01,0xBAE1,0xBAE1,0xBAA1,0xB281,0x7981,0x48E0,0x2060,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x5121,0xBAA1,0xBAA1,0xBAA2,0xC2C1,0xBAC2,
-	0xBAA2,0xC2A2,0xBA82,0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA42,0xBA42,0xB242,0xB242,0xB222,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA43,0xBA43,0xBA42,0xBA62,0xBA62,0xBA42,0xBA42,
-	0xBA62,0xBA62,0xBA42,0xBA42,0xC263,0xC263,0xC263,0xC283,
-	0xCAA3,0xCAA3,0xCAA3,0xCAC3,0xCAC3,0xCAE3,0xCB04,0xCB24,
-	0xCB43,0xCB43,0xCB43,0xCB43,0xCB43,0xCB42,0xCB43,0xCB43,
-	0xCB23,0xCB23,0xCB23,0xCB03,0xCB03,0xCB03,0xCB03,0xCB03,
-	0xCB24,0xCB24,0xCB44,0xD344,0xD364,0xD364,0xD384,0xDB85,
-	0xDBC5,0xDBC4,0xDC04,0xDC04,0xDC24,0xDC24,0xDC04,0xDC04,
-	0xDC04,0xDC04,0xDC05,0x940D,0x23FA,0x23DA,0x1BB9,0x1B99,
-	0x1B58,0x1316,0x12B3,0x0A71,0x0A0F,0x09CC,0x018A,0x016A,
-	0x0108,0x00C7,0x00C6,0x00C6,0x0927,0x0969,0x7BEF,0xEDEF,
-	0xF58A,0xED48,0xED27,0xF547,0xF528,0xF547,0xF547,0xF567,
-	0xF567,0xF567,0xED47,0xED47,0xED27,0xED27,0xF548,0xF548,
-	0xED28,0xED27,0xED26,0xED26,0xED26,0xED26,0xED06,0xED06,
-	0xED06,0xECE6,0xECC6,0xECC7,0x1319,0x12B4,0x09EE,0x09ED,
-	0x0A52,0x4332,0xFDEA,0xFE4A,0xFE89,0xFE47,0xF5C6,0xED05,
-	0xECA5,0xECE6,0xE4C5,0xAC29,0x2BFC,0x2BFC,0x13BA,0x0B78,
-	0x02F6,0x7BEF,0xFDAD,0xF5CE,0xF5CE,0xF5AE,0xED8D,0xE56C,
-	0xE54C,0xE52C,0xED0B,0xED0C,0xED0B,0xED0B,0xECEB,0x1314,
-	0x1315,0x0B16,0x0B37,0x7BEF,0xF508,0xF548,0xFD68,0xFD48,
-	0xFD28,0xFD28,0xF527,0xF4E6,0xECE6,0xED8A,0xF632,0xF611,
-	0xED48,0xE4C5,0xE4E4,0xED24,0xED45,0xF505,0xF4C6,0xECA6,
-	0xEC86,0xEC86,0xEC66,0xEC66,0xE487,0xE4A8,0xE4A9,0xE4C9,
-	0x8980,0x8980,0x8980,0x8980,0x8960,0x8960,0x8960,0x8960,
-	0x8980,0x8980,0x8960,0x8960,0x8980,0x8981,0x8980,0x91A1,
-	0x91C0,0x91C0,0x9A01,0xA221,0xA261,0xAAA1,0xB2E1,0xB301,
-	0xBB41,0xC361,0xC362,0x30C0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2060,0x5100,
-	0x81A1,0xBA62,0xBA82,0xC2A2,0xBAA1,0xBAC1,0xBAC1,0xBAC2,
-	0xBAC1,0xBAA2,0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,
-	0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA62,0xBA42,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA62,0xBA42,0xBA42,0xC263,0xC263,0xC263,0xC283,
-	0xCAA3,0xCAA4,0xCAA3,0xCAC3,0xCAC3,0xCAE3,0xCB04,0xCB24,
-	0xCB23,0xCB43,0xCB43,0xCB63,0xCB63,0xCB63,0xCB43,0xCB43,
-	0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,0xCB03,0xCB23,
-	0xCB23,0xCB44,0xCB44,0xD344,0xD364,0xD364,0xD384,0xDBA4,
-	0xDBC4,0xDBC4,0xDC04,0xDC04,0xDC24,0xDC24,0xDC04,0xDC04,
-	0xDBE4,0xDC05,0xDC05,0x2BF9,0x23FA,0x23FA,0x23DA,0x1B99,
-	0x1B58,0x1B36,0x12D4,0x0A72,0x0A2F,0x09ED,0x09AB,0x016A,
-	0x0129,0x00E7,0x00C6,0x00C6,0x0907,0x0969,0x11EC,0xD591,
-	0xF5CC,0xED68,0xED47,0xF547,0xF528,0xF528,0xF547,0xF547,
-	0xF567,0xED67,0xED47,0xED47,0xED47,0xED27,0xF548,0xF548,
-	0xED27,0xED27,0xED26,0xED26,0xED27,0xED26,0xED26,0xED06,
-	0xECE6,0xECE6,0xECC6,0xECC7,0x1319,0x12B4,0x0A0E,0x09ED,
-	0x0252,0x4332,0xFDEA,0xFE4A,0xFE69,0xFE48,0xF5A5,0xED05,
-	0xECC6,0xECE5,0xE4C4,0xAC49,0x2BFC,0x23FC,0x13BA,0x0B58,
-	0x02F6,0x7BEF,0xFDAD,0xF5AE,0xF5CE,0xF5AE,0xED8D,0xE56C,
-	0xE54C,0xED0C,0xED0B,0xED0B,0xED0C,0xECEC,0xECEB,0x1314,
-	0x12F5,0x1316,0x0B36,0x7BEF,0xF528,0xF548,0xFD48,0xFD48,
-	0xFD28,0xFD27,0xF507,0xF4E6,0xECE6,0xF58C,0xF633,0xF60F,
-	0xED27,0xE4C5,0xE4E4,0xED24,0xED44,0xF505,0xF4C6,0xF486,
-	0xEC86,0xEC86,0xEC66,0xEC66,0xE487,0xE4A8,0xE4A9,0xE4C9,
-	0x8980,0x8980,0x8980,0x8980,0x8980,0x8960,0x8960,0x8980,
-	0x8980,0x8980,0x8980,0x8960,0x8960,0x8981,0x8980,0x8980,
-	0x8980,0x91A0,0x91A1,0x99E1,0x9A01,0xA221,0xAA61,0xB2A1,
-	0xBB22,0xC362,0xC361,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2060,0x48E1,0x7981,0xAA21,0xBA42,0xBA62,
-	0xBA62,0xBA82,0xBA82,0xC2A2,0xBAA2,0xBAC1,0xC2C2,0xC2C1,
-	0xBAC1,0xBAC2,0xBAA2,0xBAA1,0xBAA2,0xBA82,0xBA82,0xBA82,
-	0xBA62,0xBA62,0xBA42,0xBA42,0xBA62,0xBA42,0xBA42,0xBA62,
-	0xBA62,0xBA62,0xBA42,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA62,0xBA62,0xBA43,0xC263,0xC263,0xC263,0xC2A3,
-	0xC2A3,0xCAA4,0xCAC3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xCB24,
-	0xCB23,0xCB43,0xD343,0xCB43,0xCB63,0xCB63,0xCB43,0xCB43,
-	0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD344,0xD364,0xD364,0xD384,0xDBA4,
-	0xDBC4,0xDBC4,0xDC04,0xDC04,0xDC24,0xDC24,0xDC04,0xDBE4,
-	0xDC04,0xDC05,0xBC09,0x23FA,0x23FA,0x23FA,0x23DA,0x1BB9,
-	0x1B79,0x1B37,0x12F5,0x0A93,0x0A50,0x09EE,0x09CC,0x098B,
-	0x0129,0x0908,0x00C7,0x00C6,0x08E6,0x0928,0x096A,0x532E,
-	0xF5CD,0xED8A,0xED48,0xED47,0xF548,0xF548,0xF547,0xF547,
-	0xF567,0xED67,0xED47,0xED47,0xED27,0xED47,0xED27,0xED48,
-	0xED27,0xED27,0xED26,0xED26,0xED26,0xED26,0xED26,0xED06,
-	0xECE6,0xECE6,0xECC6,0xECC7,0x1318,0x12B4,0x0A0E,0x01ED,
-	0x0A52,0x4332,0xFDEA,0xFE4A,0xFE69,0xF647,0xF5A5,0xED05,
-	0xECC6,0xECE6,0xE4C5,0xAC49,0x2BFC,0x23FC,0x13B9,0x0B58,
-	0x02F6,0x7BF0,0xFD8C,0xF5AE,0xF5CE,0xF5AE,0xED8D,0xED8C,
-	0xE54C,0xED2C,0xE52C,0xED0C,0xED0C,0xECEC,0xECEC,0x1314,
-	0x1315,0x1316,0x0B16,0x53B2,0xF528,0xF568,0xFD48,0xFD48,
-	0xFD28,0xF527,0xF507,0xF4E6,0xED07,0xF5CE,0xF653,0xF5CD,
-	0xED06,0xE4C4,0xE505,0xED44,0xED44,0xED05,0xF4C6,0xF486,
-	0xEC86,0xEC86,0xEC66,0xE466,0xE487,0xE4A8,0xE4A9,0xE4C9,
-	0x8960,0x8960,0x8980,0x8980,0x8980,0x8980,0x8980,0x8980,
-	0x8980,0x8980,0x8981,0x8980,0x8960,0x8980,0x8980,0x8980,
-	0x8980,0x8980,0x91A0,0x91A1,0x99C0,0x99C1,0xA201,0xAA81,
-	0xB2C1,0xBAE1,0xC321,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x1840,0x6981,0xAA62,0xBA81,0xBA61,0xBA62,0xBA42,0xBA62,
-	0xBA61,0xBA61,0xBA82,0xC2A2,0xC2C2,0xC2C2,0xC2C2,0xBAC2,
-	0xC2C1,0xC2C1,0xBAC1,0xBAC2,0xBAC2,0xBAA2,0xBA82,0xBA82,
-	0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,0xBA42,0xBA42,0xBA42,
-	0xBA62,0xBA62,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA62,0xBA62,0xBA42,0xC263,0xC263,0xC263,0xC2A3,
-	0xC2A3,0xCAA4,0xCAC3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xCB24,
-	0xCB23,0xCB43,0xD343,0xCB63,0xCB63,0xCB63,0xCB63,0xCB43,
-	0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD344,0xD364,0xD364,0xD384,0xDBA4,
-	0xDBA4,0xDBC4,0xDC04,0xDC04,0xDC24,0xDC24,0xDC24,0xDC04,
-	0xDC04,0xDC05,0xAC0A,0x241A,0x23FA,0x23FA,0x5BF4,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7C0F,0x42CD,
-	0x014A,0x0909,0x21A9,0x7BEF,0x7BEF,0x7BF0,0x7C0F,0x7BEF,
-	0xE5AF,0xF58B,0xED48,0xED47,0xF528,0xF548,0xF547,0xF547,
-	0xF567,0xED67,0xF567,0xED47,0xED27,0xED27,0xED48,0xED48,
-	0xED28,0xED27,0xED26,0xED26,0xED27,0xED26,0xED26,0xED06,
-	0xECE6,0xE4E6,0xECC6,0xECC7,0x1319,0x12B4,0x0A0E,0x01ED,
-	0x0252,0x4332,0xFDEA,0xFE4A,0xFE69,0xFE67,0xF5C6,0xED05,
-	0xECC6,0xECE6,0xE4C4,0xAC49,0x2BFC,0x23FB,0x13B9,0x0B58,
-	0x02F7,0x7BEF,0xF5AC,0xF5AE,0xF5CE,0xF5CE,0xED8D,0xED6D,
-	0xED4C,0xED2C,0xED0C,0xED0C,0xED0C,0xED0C,0xED0C,0x2B53,
-	0x1315,0x0B15,0x0B16,0x02F6,0x8C2E,0xE529,0xFD68,0xFD48,
-	0xFD28,0xF527,0xF507,0xF4E6,0xED07,0xF60F,0xF653,0xEDAC,
-	0xE4E5,0xE4C4,0xED05,0xED44,0xED44,0xED05,0xECA6,0xF486,
-	0xEC86,0xEC66,0xEC66,0xE466,0xE487,0xE4A8,0xE4A9,0xE4C9,
-	0x8960,0x8960,0x8960,0x8960,0x8960,0x8980,0x8980,0x8980,
-	0x8980,0x8980,0x8980,0x9180,0x8980,0x8980,0x9180,0x9181,
-	0x9180,0x9180,0x9180,0x91A1,0x91A1,0x99A1,0xA1E1,0xAA21,
-	0xB241,0xB281,0xB2A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x38C0,0x6961,0xA222,0xBA62,0xBA62,
-	0xBA61,0xBA62,0xC282,0xC2A2,0xBAA2,0xC2C1,0xC2C2,0xC2C2,
-	0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xBAA2,0xBAA2,
-	0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA63,0xBA43,0xBA43,0xBA62,0xBA62,0xBA62,0xBA82,
-	0xBA82,0xBA62,0xBA62,0xBA62,0xC262,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA4,0xCAC3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xD324,
-	0xCB23,0xD344,0xD343,0xD364,0xD363,0xD383,0xCB63,0xCB63,
-	0xCB63,0xCB43,0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD344,0xD364,0xD384,0xDB84,0xDB85,
-	0xDBA5,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC24,0xDC24,0xDC04,
-	0xDC04,0xDC05,0xAC0A,0x23FA,0x23DA,0x23DA,0xDC25,0xE446,
-	0xE466,0xE4A7,0xECE9,0xED2B,0xF58D,0xF5D0,0xF632,0x840F,
-	0x014A,0x0909,0x426B,0xFF38,0xFF19,0xFF18,0xF6D6,0xF674,
-	0xF610,0xEDAC,0xED69,0xF527,0xF548,0xF528,0xF547,0xF547,
-	0xF567,0xED67,0xED67,0xED47,0xED47,0xED27,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED06,0xED26,0xED26,0xED06,0xED06,
-	0xED06,0xE4E6,0xECC6,0xECA7,0x1318,0x12B5,0x0A2E,0x09ED,
+	0xC00A,0x6DAC,0xACA4,0x65A4,0xA5AD,0xA565,0xAC00,0x0001,
+	0x4394,0xFD07,0xC009,0xAD6B,0xED9C,0x5CA3,0xA45B,0x9BB5,
+	0x0003,0xF5CD,0xF653,0xEDEF,0xE507,0xC00C,0x91F4,0xAD9C,
+	0x959C,0x9C9C,0xAD6D,0xA5A4,0xAC00,0x0000,0x89A0,0xC00D,
+	0xF4F4,0xF4B5,0xECEC,0xA49C,0x545C,0x5493,0x5D9C,0x8002,
+	0x91A0,0x8004,0x91A1,0x8003,0x99A1,0x8007,0x0000,0x0005,
+	0x0820,0x38A0,0x6961,0x9A01,0xB241,0xB241,0x8003,0xB242,
+	0x0002,0xB221,0xB222,0xB222,0x8004,0xB202,0x8011,0xB222,
+	0x8002,0xBA22,0x0000,0xBA42,0x8002,0xBA43,0xC005,0xECA4,
+	0xACAC,0xA4AC,0x8002,0xC2E3,0x0001,0xCB03,0xC303,0x8002,
+	0xCB23,0xC004,0x5BA4,0x9CA5,0xA400,0x8003,0xC2C3,0xC00C,
+	0xACE4,0xACA4,0xA5EC,0xA4AC,0xACAC,0xACAC,0xAC00,0x8005,
+	0xDBE4,0xC00C,0xACA4,0xA5AC,0xA4F6,0xB5FE,0xB7BE,0xFFB6,
+	0xB600,0x0008,0xCDD4,0x21A9,0x00C6,0x00C7,0x320B,0xD614,
+	0xF674,0xF610,0xEDAB,0xC004,0xCA62,0xA3A5,0x9C00,0x8002,
+	0xF548,0xC008,0xA36C,0xA4A5,0xA49D,0xACA4,0xE500,0x0002,
+	0x1295,0x12B6,0x12B7,0x8004,0x12D9,0xC005,0xACA4,0xACAC,
+	0xAC9C,0x0004,0x0AB4,0x09EC,0x09CB,0x0A51,0x0255,0xC003,
+	0x948D,0x95B5,0x0001,0x0A5A,0x131B,0xC003,0xB3A4,0xECFE,
+	0x0006,0x341C,0x2C5C,0x13DA,0x0B57,0x02B4,0x83EF,0xFDEF,
+	0xC003,0xA454,0x635B,0x0001,0xA48F,0x1AD2,0xC009,0xADAC,
+	0xA465,0xA4A5,0xADA5,0x65AC,0x0001,0x4394,0xF4E7,0xC009,
+	0xF573,0xDDA4,0x5CA3,0x9C9B,0x63B6,0x0003,0xF5EF,0xF653,
+	0xEDAD,0xE506,0xC00C,0x92F4,0xA5A4,0x959C,0x9CA4,0xA56D,
+	0xA5A4,0xAC00,0x0000,0x8960,0xC005,0xACF4,0xB4EC,0xF4F5,
+	0x8002,0xB2E1,0xC006,0x9C5C,0x5453,0x9D53,0xA400,0x8005,
+	0x91A1,0x8003,0x99A1,0x8004,0x0000,0x0003,0x1040,0x48E0,
+	0x7981,0xB221,0xC007,0xADA3,0xEC64,0xA4A5,0xA4DC,0x8002,
+	0xB242,0x8004,0xB222,0xC004,0x9CA4,0xAC9C,0xA400,0x8005,
+	0xB222,0x0000,0xBA23,0x8002,0xB222,0xC004,0xACA4,0x9CA4,
+	0xE400,0x8002,0xBA42,0x8002,0xBA43,0xC005,0xECA4,0xACA4,
+	0xACAC,0x8002,0xCAE3,0x0000,0xCB03,0x8002,0xCB23,0xC003,
+	0x64DC,0xA463,0x8002,0xC2E3,0x8002,0xC2C3,0xC00C,0xACE4,
+	0xACA4,0xA5EC,0xACA4,0xACAC,0xE4B4,0x6C00,0x8003,0xDC04,
+	0x8002,0xDBE4,0xC00C,0xACA5,0xACA5,0xF4B5,0xF6BF,0xB7FE,
+	0xB7B5,0xF600,0x0005,0x9CB2,0x00C6,0x08A6,0x00E8,0x428C,
+	0xF694,0xC00C,0x8988,0x489A,0xA3A5,0x9CED,0xA4A3,0xA46C,
+	0xA400,0x8002,0xED48,0x0003,0xED69,0xED69,0xED6A,0x1296,
+	0xC003,0x64F6,0xA5A3,0x8002,0x12D9,0xC005,0xACAC,0xA4AC,
+	0xAC9C,0x0004,0x12B4,0x0A0D,0x01CC,0x0A31,0x0255,0xC003,
+	0x948D,0x94B6,0x000C,0x125A,0x1B1B,0x135A,0x133A,0x1B5A,
+	0x23DC,0x343D,0x2C3C,0x13DA,0x0B57,0x02D4,0x7BEF,0xFDEF,
+	0xC004,0xA45C,0x9B5B,0x5C00,0x0001,0x9C4F,0x2B12,0xC008,
+	0x25A4,0x65A4,0xA5AD,0xA564,0xA500,0x0001,0x4394,0xF4E7,
+	0xC009,0xF574,0xE45C,0xDC63,0x9B9C,0x63BF,0x0003,0xF610,
+	0xF652,0xED8C,0xE4E5,0xC004,0xA3F4,0xA595,0x9400,0x8002,
+	0xEC86,0xC004,0xA56D,0xA5A4,0xAC00,0x0000,0x8960,0xC007,
+	0xA4AC,0xACEC,0xF4EC,0xFDAC,0x8002,0xB2E1,0xC007,0x5C9B,
+	0x559C,0x545C,0x9CA4,0x8002,0x91A1,0xC003,0xEC9C,0xA4AC,
+	0x8005,0x0000,0x0004,0x2060,0x48E0,0x7981,0xAA22,0xBA42,
+	0xC004,0xAB65,0xA3A4,0xE500,0x8002,0xB262,0x0001,0xB242,
+	0xBA42,0x8003,0xB222,0x8003,0xB202,0x8006,0xB222,0x0000,
+	0xB223,0x8002,0xB222,0x0001,0xB242,0xB242,0x8002,0xB222,
+	0x8002,0xBA42,0x0001,0xBA43,0xBA43,0x8002,0xC263,0xC007,
+	0xACAC,0xA4AC,0xE4AC,0xA4AC,0x8002,0xCB23,0xC004,0x64E4,
+	0x9C63,0xA500,0x8003,0xC2E3,0xC00D,0x9CAC,0xE4AC,0xA4AD,
+	0xA4EC,0xA4AC,0xACE4,0xB46C,0x8003,0xDC04,0xC00F,0x9CA4,
+	0xA5AC,0xA4AC,0xEDA4,0xB5F6,0xBEB7,0xFFB6,0xB6B5,0x0008,
+	0xBD74,0x00C6,0x00C6,0x08E7,0x0929,0xF695,0xF632,0xF5CE,
+	0xF58B,0x8002,0xED47,0xC009,0x9CEC,0xA5A3,0x64AC,0xE464,
+	0x9DA4,0x8002,0xED69,0x0002,0x1296,0x0A96,0x12D8,0x8004,
+	0x12D9,0xC005,0xACA4,0xACAC,0xAC9C,0x0003,0x12B4,0x020D,
+	0x01CC,0x0A32,0xC004,0x6F94,0x8C95,0xB600,0x000C,0x1259,
+	0x131A,0x135A,0x1339,0x1B5A,0x23DC,0x341D,0x2C3C,0x13DA,
+	0x0B57,0x02D4,0x7BEF,0xFDEF,0xC005,0x5CA4,0x5B93,0x6394,
+	0x0002,0xCCCD,0x63B0,0x1313,0xC006,0xA5A4,0xA5A5,0xAC65,
+	0xA500,0x0001,0x4394,0xF507,0xC008,0xED74,0xA494,0xE463,
+	0x9B9C,0x6300,0x0004,0xED6A,0xF631,0xF631,0xED6A,0xE4E5,
+	0xC004,0xE3B4,0xA595,0x9C00,0x8002,0xEC86,0xC004,0xA5A5,
+	0x6DA4,0xAC00,0x8003,0x8960,0xC016,0xADEC,0xACF4,0xF4F4,
+	0xACEC,0xACA4,0x5C9C,0x549C,0x539C,0x5CDD,0xA4AC,0x9CA4,
+	0xAC00,0x8009,0x0000,0x0003,0x2060,0x5921,0x89C1,0xBA81,
+	0xC008,0xA4A5,0x5CE4,0xAB9C,0xA55B,0xA500,0x8002,0xB222,
+	0x0001,0xB202,0xB202,0x8004,0xB222,0xC00B,0xACA4,0x9CE5,
+	0xA364,0xACE4,0xA464,0xE45C,0x8002,0xBA42,0x0001,0xBA43,
+	0xBA43,0x8002,0xC263,0xC006,0xACAC,0xA4AC,0xE4AC,0xA400,
+	0x8003,0xCB23,0xC005,0xAC9B,0x9DA3,0xA4A5,0x8004,0xC2E3,
+	0xC00B,0xE4AC,0xA4AD,0xA4EC,0xA4AC,0xACE4,0xB46C,0x8003,
+	0xDC04,0x8002,0xDBE4,0xC00C,0xADA4,0xACA4,0xEDAD,0xBDF6,
+	0xBFF7,0xBEB6,0xB600,0x0005,0x634E,0x00E6,0x00A7,0x00C6,
+	0x1168,0xF6B6,0xC012,0x8991,0x8850,0x9B9C,0xACA4,0xE5A3,
+	0x6CA4,0xE464,0xA59C,0xA4A5,0xAC00,0x0002,0x1296,0x12B6,
+	0x12D8,0x8004,0x12D9,0xC005,0xACAC,0xA4AC,0xAC9C,0x0004,
+	0x12B3,0x020D,0x01EC,0x0A31,0x0255,0xC003,0x948C,0x95B6,
+	0x0001,0x0A59,0x131A,0xC003,0xACA4,0xECFE,0x0006,0x341D,
+	0x2C1C,0x13BA,0x0B77,0x02D5,0x7BF0,0xFDCE,0xC005,0x65A4,
+	0x5B93,0x5B9C,0x8002,0xE50C,0x0008,0xB46D,0xB48D,0xB48D,
+	0x4B92,0x1336,0x1337,0x0B37,0x4394,0xFD08,0xC008,0xAC74,
+	0xA494,0xE463,0x9B5C,0xA400,0x0003,0xED8B,0xF652,0xF610,
+	0xED28,0xC005,0x48F4,0xB59C,0x959C,0x8002,0xEC86,0xC004,
+	0xA5A5,0x6CAD,0xA400,0x8002,0x8960,0x0000,0x8160,0x8002,
+	0x8980,0xC005,0xECB5,0xF4EC,0xF4B4,0x8002,0xB2E1,0xC006,
+	0x9C5C,0x9454,0x5C9C,0xA400,0x8003,0x99C1,0x0003,0x91A1,
+	0x7120,0x38A0,0x1040,0x8009,0x0000,0x0002,0x38C0,0x71A1,
+	0xBA82,0xC007,0xA3A4,0x9CA5,0x9CA4,0x64A4,0x8006,0xB222,
+	0xC007,0xA5A3,0xAC9C,0xE563,0xA4AC,0x8006,0xBA42,0x8002,
+	0xBA43,0xC009,0xECA4,0xACAC,0xA4AC,0xA4E4,0xACAC,0x8002,
+	0xCB23,0x0001,0xCB43,0xCB43,0x8002,0xCB22,0x0002,0xCB02,
+	0xCB03,0xCB03,0x8004,0xC2E3,0xC00B,0xECA4,0xADA4,0xECA4,
+	0xACA4,0xECAC,0xACAC,0x8002,0xDC04,0xC00F,0x9CA4,0xACA5,
+	0xA4AC,0xA4E4,0x75F6,0xF6BE,0xFFB6,0xB7F5,0x0005,0xBD53,
+	0x73AE,0x31EA,0x00C6,0x738F,0xF6D7,0xC00E,0x8A90,0x8848,
+	0x9A9C,0xA4EC,0xA5A3,0x64AC,0xE464,0x9C00,0x8002,0xED48,
+	0x0004,0xED49,0x12B6,0x12B6,0x12D8,0x12D8,0x8003,0x12D9,
+	0x0002,0x12F9,0x1319,0x1319,0x8002,0x1339,0x0003,0x12B4,
+	0x0A0D,0x01ED,0x0A52,0xC004,0x6794,0x8C95,0xB600,0x0001,
+	0x0A59,0x131A,0xC005,0xACA4,0xECFE,0xFCA4,0x0004,0x13BA,
+	0x0B77,0x02F5,0x7BEF,0xFDCE,0xC00B,0xA564,0x5B93,0x5B9C,
+	0x9CA4,0xA3DC,0xA3A4,0x0005,0x3B73,0x1336,0x0B36,0x0B37,
+	0x4394,0xF508,0xC008,0xEC74,0xA4D4,0x64A3,0x9B5C,0xAC00,
+	0x0003,0xEDAD,0xF673,0xF5CF,0xECE7,0xC005,0x99B5,0xABA5,
+	0x959C,0x8003,0xEC86,0xC003,0x6EA4,0xA5AC,0x8006,0x8960,
+	0xC018,0xACAC,0xE5B3,0xF5F4,0xF4EC,0xACAC,0x9CA4,0x5494,
+	0x5C9B,0x55A4,0x9CA4,0xDCAC,0xF5A3,0x1400,0x0002,0x6940,
+	0x38A0,0x0820,0x8006,0x0000,0x0000,0x3080,0x8003,0xBA82,
+	0xC005,0xA35D,0xE4A4,0x5CA4,0x8005,0xB222,0xC007,0xA5EB,
+	0xA4A5,0x5BE4,0xA464,0x8005,0xBA42,0xC00A,0xA5A3,0xA5A4,
+	0xECA4,0xACAC,0xA4AC,0xE400,0x8002,0xCAE3,0x8002,0xCB23,
+	0x8003,0xCB43,0xC004,0x9C5C,0xE4A4,0x6400,0x8002,0xC2E3,
+	0xC005,0xE4AC,0xA4AC,0xA5EC,0x8002,0xD364,0xC003,0xECAC,
+	0xACAC,0x8002,0xDC04,0x0001,0xDBE4,0xDBE4,0x8002,0xDC04,
+	0xC00B,0xAC9D,0xACED,0xB5FE,0xB7BE,0xFFB6,0xAEB4,0x0004,
+	0x9CB1,0x426B,0x31E9,0x5B2D,0xF6D7,0xC00A,0x9289,0x9048,
+	0x919B,0xA5E5,0xACA3,0xA400,0x8002,0xED67,0xC004,0x9CE5,
+	0x64A4,0xA500,0x0000,0x12B6,0xC00C,0xA5AD,0xA5A4,0xA3A5,
+	0xACA4,0xACAC,0xE463,0xA500,0x0004,0x12B4,0x0A0D,0x09ED,
+	0x0A31,0x0255,0xC003,0x948C,0x95B6,0x0001,0x0A59,0x12FA,
+	0xC005,0xBC9C,0xECF5,0xFEAB,0x0004,0x13BA,0x0B78,0x02F5,
+	0x7BEF,0xFDCE,0xC008,0x6D9B,0x5B94,0x6493,0xA49C,0xE300,
+	0x8002,0xECEB,0x0005,0x1315,0x1316,0x1336,0x1337,0x4394,
+	0xF508,0xC008,0xB4E4,0xA49C,0x63A4,0x9B5C,0xB400,0x0003,
+	0xF5EF,0xF673,0xF5CD,0xECE6,0xC00D,0x63F3,0xAC9D,0xCD5C,
+	0x9CE4,0x5CAC,0x65AD,0xADA4,0x0002,0x8960,0x8980,0x8980,
+	0x8003,0x8960,0x8003,0x8980,0xC005,0xEDB4,0xF4F3,0xF4ED,
+	0x8003,0xB2E1,0xC00D,0x9C54,0x9C54,0x9D9B,0xA4ED,0xA3A4,
+	0xE4A5,0xA3AC,0x0002,0x91C1,0x40C0,0x0800,0x8003,0x0000,
+	0x0001,0x28A0,0xBA82,0xC004,0xA4AC,0xA49C,0xA400,0x8002,
+	0xBA62,0x8002,0xB242,0x0000,0xBA42,0x8003,0xB222,0xC006,
+	0xECA4,0xA5A3,0x9CAC,0x5C00,0x8007,0xBA42,0xC00B,0xA5A4,
+	0xECA4,0xACAC,0xE4A4,0xACAC,0xA4AC,0x8002,0xCB23,0x8003,
+	0xCB43,0x8002,0xCB23,0xC004,0x9C64,0xDC64,0xA400,0x8002,
+	0xCB03,0x0002,0xCB24,0xCB24,0xD344,0x8002,0xD364,0x0002,
+	0xDB85,0xDBA4,0xDBC4,0x8003,0xDC04,0x0001,0xDBE4,0xDBE4,
+	0x8002,0xDC04,0xC00B,0xAD9C,0xACAD,0xF5F6,0xBEB6,0xFFB6,
+	0xB6B5,0x0004,0x83EF,0x00C7,0x00A6,0x426B,0xFEF8,0xC00A,
+	0x9252,0x8848,0x9093,0xACDC,0xADA3,0xA400,0x8002,0xED67,
+	0x0001,0xED47,0xED47,0x8002,0xED48,0x0002,0xED49,0xED28,
+	0xED27,0x8002,0xED26,0x0000,0xED27,0x8002,0xED06,0x0019,
+	0xECE6,0xE4C6,0xECC7,0x1339,0x12B4,0x0A0D,0x09ED,0x0A52,
+	0x4332,0xFDEA,0xFE4A,0xFE89,0xFE47,0xF5A6,0xED05,0xECC5,
+	0xECE6,0xE4A5,0xAC29,0x341D,0x2C1C,0x13BA,0x0B78,0x02F5,
+	0x7BEF,0xFDCE,0xC00B,0x65A3,0x9B5C,0x5C93,0x9CE4,0xA3A4,
+	0x9CA4,0x0005,0x1315,0x1316,0x0B36,0x0B37,0x63D1,0xF528,
+	0xC008,0xECA3,0xA55C,0xE463,0x9364,0xB500,0x0003,0xF610,
+	0xF653,0xED8B,0xECC5,0xC00D,0x63FD,0xAC9C,0xCD5C,0xA4DC,
+	0x5CAC,0x65AD,0xADA4,0x0000,0x8980,0x8005,0x8960,0x8004,
+	0x8980,0xC014,0xECAC,0xEDB4,0xF3F5,0xECAC,0xECA4,0x649C,
+	0x944C,0xA4E4,0x9C5C,0xE465,0x0C00,0x0002,0x6941,0x40C0,
+	0x0820,0x8005,0x0000,0x0000,0x28A0,0x8004,0xBAA1,0xC003,
+	0x9CA5,0xA49C,0x8005,0xBA42,0x8002,0xB222,0x8002,0xBA42,
+	0xC005,0x9CAC,0xA4AC,0x9CAC,0x8004,0xBA42,0x0000,0xBA43,
+	0x8002,0xC263,0x0000,0xC283,0x8002,0xCAA3,0xC003,0xACAC,
+	0xA4AD,0x8002,0xCB23,0xC003,0xACA4,0xAC9C,0x8003,0xCB23,
+	0x0000,0xCB03,0x8002,0xCAE3,0x8002,0xCB03,0x0002,0xCB24,
+	0xD344,0xD344,0x8002,0xD364,0xC006,0xF4A4,0xACB4,0xA4AC,
+	0xA400,0x8004,0xDC04,0x0003,0xDC25,0xB40A,0x73F1,0x4BD4,
+	0xC007,0xA49C,0x929B,0x5B9B,0x9A9C,0x0008,0x21EB,0x00E7,
+	0x00C6,0x1127,0x426B,0x42AC,0x530E,0xF632,0xF5CD,0xC00C,
+	0x4892,0xACDC,0xAD9B,0xACAC,0xA464,0x9CA4,0x9C00,0x8003,
+	0xED48,0xC00A,0x9BA3,0xA4A5,0xA3A4,0x9CA4,0x94A4,0x9C00,
+	0x0006,0x1339,0x12B4,0x0A0E,0x09CD,0x0A52,0x4333,0xFDEA,
+	0xC003,0xBCB3,0x9342,0x0005,0xED05,0xECA5,0xECC6,0xE4C5,
+	0xAC29,0x33FD,0xC003,0x2312,0x5242,0x0001,0x7BEF,0xFDAD,
+	0xC00B,0x6EA3,0x9463,0x5B9C,0x9CDC,0xA4A3,0x9CA4,0x0005,
+	0x1315,0x1336,0x0B36,0x0B17,0x7BEF,0xFD28,0xC007,0xACA3,
+	0x65DC,0xA463,0x9364,0x0004,0xED69,0xF631,0xF632,0xED6A,
+	0xE4C5,0xC005,0xABF4,0xAD9C,0x8D9C,0x8003,0xEC86,0xC003,
+	0x65AD,0xADA4,0x8003,0x8980,0x0001,0x8960,0x8980,0x8004,
+	0x8960,0xC011,0xACA4,0xEDA4,0xACEB,0xB5F4,0xF4EC,0xB4EC,
+	0xA49C,0x9CA4,0x945C,0x0002,0x7981,0x48E0,0x2060,0x8009,
+	0x0000,0x0001,0x5121,0xBAA1,0xC007,0xA4A5,0xEB65,0x9CE4,
+	0x5CA4,0x8003,0xBA62,0xC004,0x9CA4,0x64A4,0x9C00,0x8003,
+	0xBA42,0xC00A,0xA5A4,0xA3AC,0xA49C,0xA4AC,0xA49C,0xA400,
+	0x8002,0xC263,0x0000,0xC283,0x8002,0xCAA3,0xC004,0xACA4,
+	0xACAD,0xAC00,0x8004,0xCB43,0x0002,0xCB42,0xCB43,0xCB43,
+	0x8002,0xCB23,0x8004,0xCB03,0xC00D,0xADA4,0xACE4,0xACA4,
+	0xACE5,0xB4A3,0xB4A4,0xACA4,0x8003,0xDC04,0x0002,0xDC05,
+	0x940D,0x23FA,0xC010,0x9C5B,0x9C93,0x5289,0x528A,0x9152,
+	0x9C8A,0x93A3,0xA4FD,0xB600,0x0002,0x7BEF,0xEDEF,0xF58A,
+	0xC005,0x529B,0xEC9D,0xABA4,0x8002,0xF567,0xC007,0x5CA4,
+	0x9CA4,0xEDA4,0x5CA3,0x8003,0xED26,0x8002,0xED06,0x0009,
+	0xECE6,0xECC6,0xECC7,0x1319,0x12B4,0x09EE,0x09ED,0x0A52,
+	0x4332,0xFDEA,0xC003,0xBCB3,0x9243,0x000B,0xED05,0xECA5,
+	0xECE6,0xE4C5,0xAC29,0x2BFC,0x2BFC,0x13BA,0x0B78,0x02F6,
+	0x7BEF,0xFDAD,0xC00B,0x6DA4,0x9C5B,0x5B9C,0x9CDB,0xA5A3,
+	0xA49C,0x0005,0x1314,0x1315,0x0B16,0x0B37,0x7BEF,0xF508,
+	0xC007,0xB4EC,0x9C9C,0xA463,0x9364,0x0003,0xED8A,0xF632,
+	0xF611,0xED48,0xC00E,0x41AB,0xF4AD,0xD495,0x5C9C,0xA49C,
+	0xA46D,0xADA5,0xAC00,0x8003,0x8980,0x8003,0x8960,0xC012,
+	0xACA4,0x9CA4,0xACA5,0xA3ED,0xABA4,0xF5EC,0xB4F4,0xF4AC,
+	0xF4EC,0xA500,0x0000,0x30C0,0x8009,0x0000,0x0003,0x2060,
+	0x5100,0x81A1,0xBA62,0xC007,0xACEC,0x63AC,0xA4A5,0xA39D,
+	0x8003,0xBA82,0x0001,0xBA62,0xBA62,0x8007,0xBA42,0x0000,
+	0xBA62,0x8002,0xBA42,0x8005,0xBA62,0x0001,0xBA42,0xBA42,
+	0x8002,0xC263,0xC00B,0xACEC,0xA5A3,0xACA4,0xACAD,0xACA3,
+	0xACA4,0x8002,0xCB63,0x8002,0xCB43,0x8004,0xCB23,0xC014,
+	0x9CAC,0xA4AD,0xA4E4,0xACA4,0xACEC,0xACA4,0xB4A4,0xACA4,
+	0x9CA4,0x9CAD,0xA400,0x0000,0x2BF9,0xC011,0x65A4,0x9C53,
+	0x939A,0x4A4A,0x9192,0x9253,0x9392,0x9BA4,0xF5BE,0x0002,
+	0x11EC,0xD591,0xF5CC,0xC008,0x489B,0xE49D,0xA4AB,0xA4AC,
+	0x6400,0x8002,0xED47,0xC00E,0x9CED,0xA45B,0xA4A3,0xA4A5,
+	0xA3A4,0x9C9C,0xA49C,0xA500,0x0010,0x1319,0x12B4,0x0A0E,
+	0x09ED,0x0252,0x4332,0xFDEA,0xFE4A,0xFE69,0xFE48,0xF5A5,
+	0xED05,0xECC6,0xECE5,0xE4C4,0xAC49,0x2BFC,0xC003,0x6412,
+	0x4A4A,0x0001,0x7BEF,0xFDAD,0xC00B,0x65AC,0x9C5B,0x5B9C,
+	0xD4A3,0xA4A5,0x9CA3,0x0005,0x1314,0x12F5,0x1316,0x0B36,
+	0x7BEF,0xF528,0xC007,0xACE4,0xA49C,0xA35C,0x9B64,0x0003,
+	0xF58C,0xF633,0xF60F,0xED27,0xC00E,0x4AAB,0xF4AC,0xD595,
+	0x9464,0xA49C,0xA46D,0xADA5,0xAC00,0x8004,0x8980,0x0001,
+	0x8960,0x8960,0x8003,0x8980,0x0002,0x8960,0x8960,0x8981,
+	0x8002,0x8980,0xC006,0xECA5,0xF4AC,0xECF4,0xF400,0x0002,
+	0xBB22,0xC362,0xC361,0x8006,0x0000,0x0004,0x2060,0x48E1,
+	0x7981,0xAA21,0xBA42,0xC00D,0xACA4,0xACA4,0xEC64,0xABE5,
+	0xA364,0xA59C,0xA3A5,0x8002,0xBA82,0xC006,0x9CA4,0x9CA4,
+	0xAC9C,0xA400,0x8002,0xBA62,0x8002,0xBA42,0x8005,0xBA62,
+	0x0000,0xBA43,0x8002,0xC263,0xC00E,0xB4A4,0xE5AB,0xA4AC,
+	0xA4AD,0xACA3,0xACE4,0x64AC,0xA400,0x8003,0xCB43,0x8006,
+	0xCB23,0xC010,0xADE4,0xA4AC,0xA4AC,0xECAC,0xA4B4,0xA4AC,
+	0xA49C,0x9CAC,0xA500,0x0000,0xBC09,0x8002,0x23FA,0xC010,
+	0x9C5B,0x9492,0x524A,0x918A,0x9A93,0x4ADB,0x53A3,0xECB6,
+	0xB600,0x0001,0x532E,0xF5CD,0xC010,0x5192,0xA3E5,0xA4A3,
+	0xA4AC,0x649C,0xA49C,0xAC9C,0xAD9B,0xA400,0x8004,0xED26,
+	0xC004,0x9C9C,0xA49C,0xA500,0x0010,0x1318,0x12B4,0x0A0E,
+	0x01ED,0x0A52,0x4332,0xFDEA,0xFE4A,0xFE69,0xF647,0xF5A5,
+	0xED05,0xECC6,0xECE6,0xE4C5,0xAC49,0x2BFC,0xC003,0x6411,
+	0x4B4A,0x0001,0x7BF0,0xFD8C,0xC00B,0x6EAC,0x9C5B,0xA354,
+	0xDC64,0xDCA4,0x9CA4,0x0005,0x1314,0x1315,0x1316,0x0B16,
+	0x53B2,0xF528,0xC007,0xB4DC,0xA49C,0x639C,0x9B6D,0x0003,
+	0xF5CE,0xF653,0xF5CD,0xED06,0xC00E,0x52B5,0xF3A4,0x95D5,
+	0x9464,0xA49C,0x64AD,0xADA5,0xAC00,0x0001,0x8960,0x8960,
+	0x8007,0x8980,0x0002,0x8981,0x8980,0x8960,0x8004,0x8980,
+	0xC004,0xECA5,0xEBA5,0xF400,0x0003,0xAA81,0xB2C1,0xBAE1,
+	0xC321,0x8004,0x0000,0x0003,0x1840,0x6981,0xAA62,0xBA81,
+	0xC007,0x9CA5,0x9CAC,0xA3A4,0xADEC,0x8002,0xC2C2,0xC006,
+	0x64E3,0xA464,0xA5A4,0x9C00,0x8002,0xBA82,0x8003,0xBA62,
+	0x8002,0xBA42,0xC003,0xACA4,0x9CA4,0x8006,0xBA62,0x0000,
+	0xBA42,0x8002,0xC263,0xC00B,0xB4A4,0xE5AB,0xA4AC,0xA4AD,
+	0xACA3,0xACE4,0x8003,0xCB63,0x8002,0xCB43,0x8006,0xCB23,
+	0xC00A,0xADE4,0xA4AC,0xA4AC,0xECA4,0xACB4,0xA400,0x8002,
+	0xDC24,0x0007,0xDC04,0xDC04,0xDC05,0xAC0A,0x241A,0x23FA,
+	0x23FA,0x5BF4,0x8006,0x7BEF,0x0005,0x7C0F,0x42CD,0x014A,
+	0x0909,0x21A9,0x7BEF,0xC003,0xA4A5,0xAB9C,0x0001,0xE5AF,
+	0xF58B,0xC019,0x51A3,0xDDAC,0xA3A4,0xAC64,0xE45C,0x9CA4,
+	0xADA4,0x9CA3,0xA3A4,0xA5A3,0xA49C,0x9C64,0xDCA5,0x0010,
+	0x1319,0x12B4,0x0A0E,0x01ED,0x0252,0x4332,0xFDEA,0xFE4A,
+	0xFE69,0xFE67,0xF5C6,0xED05,0xECC6,0xECE6,0xE4C4,0xAC49,
+	0x2BFC,0xC003,0x6312,0x4B4B,0x0001,0x7BEF,0xF5AC,0xC006,
+	0xA6AC,0xA453,0x9C9B,0x9C00,0x8004,0xED0C,0x0007,0x2B53,
+	0x1315,0x0B15,0x0B16,0x02F6,0x8C2E,0xE529,0xFD68,0xC005,
+	0x9C9C,0x639C,0x9B6D,0x0003,0xF60F,0xF653,0xEDAC,0xE4E5,
+	0xC00E,0x9BF5,0xB3A4,0x958D,0xDC64,0x9CA4,0x64AD,0xADA5,
+	0xAC00,0x8004,0x8960,0x8005,0x8980,0xC004,0xE464,0xA4E4,
+	0xA500,0x8002,0x9180,0xC007,0xADA4,0xE4F4,0xF4EC,0xB4AC,
+	0x8007,0x0000,0x0003,0x38C0,0x6961,0xA222,0xBA62,0xC006,
+	0xA4A3,0xA5EC,0xAC64,0xEB00,0x8007,0xC2C2,0x0002,0xBAA2,
+	0xBAA2,0xBA82,0x8007,0xBA62,0x0002,0xBA63,0xBA43,0xBA43,
+	0x8002,0xBA62,0x0001,0xBA82,0xBA82,0x8002,0xBA62,0x0000,
+	0xC262,0x8002,0xC283,0xC00D,0xECA5,0xABA4,0xACA4,0xADEC,
+	0x63ED,0xA3AD,0xA3AC,0x8002,0xCB63,0x8002,0xCB43,0x8004,
+	0xCB23,0xC00A,0xADE4,0xA4AC,0xACE4,0xA5AC,0xABAC,0xAC00,
+	0x8002,0xDC24,0x0007,0xDC04,0xDC04,0xDC05,0xAC0A,0x23FA,
+	0x23DA,0x23DA,0xDC25,0xC007,0xEDAC,0xB5F6,0xB6FE,0xB7BE,
+	0x0004,0x840F,0x014A,0x0909,0x426B,0xFF38,0xC010,0x9DA3,
+	0x528A,0x8848,0x91D2,0xAD9C,0xABA4,0xAC64,0xA49C,0xA400,
+	0x8005,0xED27,0x0002,0xED06,0xED26,0xED26,0x8002,0xED06,
+	0x0013,0xE4E6,0xECC6,0xECA7,0x1318,0x12B5,0x0A2E,0x09ED,
 	0x0A52,0x4332,0xFDEA,0xFE4A,0xFE69,0xFE48,0xF5A6,0xED05,
-	0xECC6,0xECE6,0xECE4,0xAC49,0x2BDC,0x23DC,0x139A,0x0358,
-	0x0316,0x7BEF,0xFD8C,0xF5AD,0xF5AE,0xF5AE,0xEDAD,0xED6C,
-	0xE54C,0xED2C,0xED2C,0xED2C,0xED0C,0xED0C,0xED0C,0x8410,
-	0x1314,0x12F5,0x0B16,0x0AF6,0x0AB7,0x0A97,0x0297,0x02D7,
-	0x02D7,0x0AD8,0x0AF8,0x4394,0xF548,0xF610,0xF631,0xED6A,
-	0xECC5,0xE4C4,0xED05,0xED44,0xED25,0xF506,0xF4C6,0xF487,
-	0xEC86,0xEC66,0xE466,0xE466,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8140,0x8140,0x8140,0x8961,0x8960,0x8980,0x8980,0x8980,
-	0x8980,0x8980,0x8980,0x8980,0x8980,0x8980,0x9180,0x9180,
-	0x9181,0x9181,0x9181,0x91A1,0x91A1,0x99C1,0xA1E1,0xA9E1,
-	0xAA00,0xAA21,0xB241,0x40E0,0x0820,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1840,0x5121,
-	0x81C1,0xBA82,0xC282,0xBAA2,0xBAA1,0xBAC2,0xC2E2,0xC2C2,
-	0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2A2,
-	0xBA82,0xBA82,0xBA62,0xBA62,0xBA82,0xBA82,0xBA82,0xBA62,
-	0xBA62,0xBA63,0xBA63,0xBA42,0xBA62,0xBA62,0xBA62,0xBA82,
-	0xBA62,0xBA62,0xBA62,0xC262,0xC263,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA4,0xCAC3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xD324,
-	0xCB24,0xD344,0xD344,0xD364,0xD363,0xD383,0xD383,0xCB62,
-	0xCB63,0xCB63,0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD344,0xD364,0xD384,0xDB84,0xDB85,
-	0xDBA5,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC24,0xDC24,0xDC04,
-	0xDC04,0xDC05,0xDC05,0x23FA,0x23DA,0x23DA,0xC408,0xE446,
-	0xE466,0xE486,0xECC9,0xED2A,0xF56C,0xF5AF,0xF611,0x7BEF,
-	0x016A,0x0929,0x426C,0xFF38,0xFF39,0xFF19,0xFED7,0xF695,
-	0xF632,0xEDCE,0xED6A,0xF548,0xF548,0xF547,0xF527,0xF547,
-	0xF567,0xED67,0xF567,0xED47,0xED47,0xED47,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED06,0xED26,0xED26,0xED06,0xED06,
-	0xED06,0xE4E6,0xECC6,0xECA7,0x1318,0x12B5,0x0A2E,0x09EE,
-	0x0A52,0x1295,0xFDEA,0xFE4A,0xFE69,0xFE48,0xF5A6,0xED05,
-	0xECC6,0xECE6,0xECE4,0x942C,0x2BDC,0x23DC,0x1399,0x0358,
-	0x0316,0x7BF0,0xFD8C,0xF5AD,0xF5AE,0xF5AE,0xEDAD,0xED6C,
-	0xED4C,0xED2C,0xED2C,0xED0C,0xED0C,0xED0C,0xED0C,0xDCEC,
-	0x1B34,0x12F5,0x0AF6,0x02F6,0x0AB7,0x0A97,0x0A97,0x02D7,
-	0x02D7,0x02D8,0x0AF8,0x4B74,0xF56A,0xF631,0xF610,0xED48,
-	0xE4C5,0xECC4,0xED24,0xED44,0xED25,0xF4E6,0xECA6,0xF486,
-	0xEC86,0xEC66,0xE466,0xE466,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8140,0x8120,0x8140,0x8940,0x8960,0x8960,0x8960,0x8960,
-	0x8980,0x8980,0x8980,0x8980,0x8980,0x8980,0x9180,0x9180,
-	0x9181,0x9181,0x91A1,0x9180,0x99A0,0xA1C1,0xA1E1,0xA1E1,
-	0xA9E1,0xAA01,0xAA01,0xAA21,0xB242,0x9201,0x5120,0x1060,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0820,0x5121,0xC2A2,0xBAA1,0xBAC2,0xC2C2,0xC2E2,
-	0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,
-	0xC2A2,0xC282,0xBA82,0xBA82,0xBA82,0xC282,0xC282,0xBA82,
-	0xBA63,0xBA63,0xBA63,0xBA63,0xBA63,0xBA62,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xC282,0xC262,0xC262,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA4,0xCAC4,0xCAC3,0xCAE3,0xCAE4,0xCB04,0xD324,
-	0xCB24,0xD344,0xD344,0xD364,0xD363,0xD383,0xD383,0xCB83,
-	0xCB63,0xD363,0xD343,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD364,0xD364,0xD364,0xD364,0xDB85,
-	0xDBA5,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC44,0xDC24,0xDC04,
-	0xDC05,0xDC04,0xDC04,0x6BF2,0x7411,0x7BEF,0xBC09,0xE425,
-	0xE446,0xE486,0xECC8,0xED09,0xED4B,0xF5AE,0xF5F0,0xBD31,
-	0x7BEF,0x7BEF,0x9CD1,0xFF17,0xFF19,0xFF19,0xFEF8,0xF6B6,
-	0xFE53,0xF60F,0xED8B,0xF549,0xF528,0xF547,0xF547,0xF567,
-	0xF567,0xED67,0xF567,0xED47,0xED47,0xED47,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED26,0xED26,0xED26,0xED06,0xED26,
-	0xED06,0xECE6,0xECE6,0xECC7,0x2337,0x12B5,0x0A2F,0x09EE,
-	0x0A32,0x0255,0xFE0A,0xFE4A,0xFE89,0xFE48,0xF5A6,0xED05,
-	0xECC6,0xECE6,0xE4E4,0x7BEF,0x2BBC,0x23DB,0x1399,0x0358,
-	0x0317,0x7BEF,0xF58C,0xF58D,0xF5AE,0xEDCE,0xEDAD,0xED6C,
-	0xED4C,0xE52C,0xED2C,0xED2C,0xED0C,0xED2C,0xED0C,0xED0B,
-	0xAC6E,0x0AF5,0x0AF5,0x02F6,0x02B7,0x0A97,0x0297,0x0AB7,
-	0x02D7,0x0AD8,0x0AF8,0x4374,0xF58B,0xF652,0xEDEF,0xED27,
-	0xE4C4,0xECE4,0xED24,0xED45,0xED25,0xECE6,0xECA6,0xF486,
-	0xEC66,0xEC66,0xE446,0xE466,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8120,0x8140,0x8141,0x8140,0x8940,0x8960,0x8960,0x8960,
-	0x8980,0x8980,0x8980,0x8980,0x9180,0x8980,0x9180,0x9181,
-	0x91A1,0x91A1,0x9181,0x99A0,0xA1C1,0xA1E1,0xA1C1,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xAA01,0xB221,0xB261,0xBA81,
-	0x9A42,0x5141,0x1860,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x30A0,0xC2C2,0xBAA2,0xC2C2,0xC2E2,0xC2C2,
-	0xC2E2,0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,
-	0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC282,0xC282,0xC282,0xC282,
-	0xBA82,0xBA83,0xBA63,0xBA63,0xBA63,0xBA62,0xBA62,0xBA82,
-	0xBA82,0xBA82,0xC282,0xC283,0xC283,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA4,0xCAC4,0xCAE3,0xCAE3,0xCAE3,0xCB04,0xD324,
-	0xD343,0xD344,0xD344,0xD364,0xD363,0xD383,0xD383,0xD383,
-	0xD383,0xD362,0xD363,0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD364,0xD364,0xD364,0xDB84,0xDB85,
-	0xDBA5,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC44,0xDC24,0xDC04,
-	0xDC04,0xDC05,0xDC05,0xDBE5,0xDC05,0xDC25,0xDC25,0xE425,
-	0xE446,0xB42B,0xB44B,0xB46C,0xD4EC,0xED8D,0xF5CF,0xF632,
-	0xFE74,0xF6B5,0xFEF5,0xFEF7,0xFF18,0xFF19,0xFF18,0xFED7,
-	0xF674,0xF611,0xF5AD,0xED69,0xF548,0xF547,0xF547,0xF547,
-	0xF567,0xF567,0xF567,0xED47,0xED47,0xED47,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED26,0xED26,0xED26,0xED26,0xED26,
-	0xED06,0xECE6,0xECE6,0xECC7,0x4B94,0x12B5,0x0A2F,0x09EE,
+	0xECC6,0xECE6,0xECE4,0xAC49,0x2BDC,0xC003,0x6412,0x1292,
+	0x0001,0x7BEF,0xFD8C,0xC005,0x6DA5,0xA463,0x935C,0x8002,
+	0xED2C,0x8002,0xED0C,0x0001,0x8410,0x1314,0xC009,0x9D6D,
+	0x9C95,0x9C64,0xB4A4,0xE5AC,0x0005,0x4394,0xF548,0xF610,
+	0xF631,0xED6A,0xECC5,0xC00E,0x63F5,0xB39D,0xDD94,0x9563,
+	0x9C64,0xA4AD,0xADAD,0xA400,0x8002,0x8140,0x0001,0x8961,
+	0x8960,0x8008,0x8980,0x0001,0x9180,0x9180,0x8002,0x9181,
+	0xC007,0xACA4,0xECEC,0xE4AB,0xADEC,0x0001,0x40E0,0x0820,
+	0x8008,0x0000,0x0003,0x1840,0x5121,0x81C1,0xBA82,0xC004,
+	0xE46C,0xA3AD,0xEC00,0x8007,0xC2C2,0xC004,0x9C5C,0xA49C,
+	0xA400,0x8002,0xBA82,0xC004,0x9CA4,0xA5A4,0x9B00,0x8002,
+	0xBA62,0x0000,0xBA82,0x8002,0xBA62,0x0001,0xC262,0xC263,
+	0x8002,0xC283,0xC013,0xECA5,0xABA4,0xACA4,0xADEC,0x64EC,
+	0xA4AC,0xA3AC,0xA45B,0xA5A4,0x9CA4,0x8004,0xCB23,0xC00A,
+	0xADE4,0xA4AC,0xACE4,0xA5AC,0xABAC,0xAC00,0x8002,0xDC24,
+	0xC003,0x9CA4,0xA5A4,0x0004,0x23FA,0x23DA,0x23DA,0xC408,
+	0xE446,0xC006,0xACAC,0xF7BD,0xF6B7,0xBE00,0x0004,0x7BEF,
+	0x016A,0x0929,0x426C,0xFF38,0xC00E,0xA59C,0x9252,0x8948,
+	0x88DA,0xA4A3,0x9CAC,0xAC64,0xE400,0x8002,0xED47,0x8004,
+	0xED27,0x0002,0xED06,0xED26,0xED26,0x8002,0xED06,0x0013,
+	0xE4E6,0xECC6,0xECA7,0x1318,0x12B5,0x0A2E,0x09EE,0x0A52,
+	0x1295,0xFDEA,0xFE4A,0xFE69,0xFE48,0xF5A6,0xED05,0xECC6,
+	0xECE6,0xECE4,0x942C,0x2BDC,0xC003,0x6411,0x1392,0x0001,
+	0x7BF0,0xFD8C,0xC007,0x6DA5,0xA463,0x939C,0x9CA4,0x8003,
+	0xED0C,0x0001,0xDCEC,0x1B34,0xC009,0x5565,0x64D5,0x9CA4,
+	0x74A4,0xA5EC,0x0004,0x4B74,0xF56A,0xF631,0xF610,0xED48,
+	0xC00F,0x41E3,0xBCAC,0x9DD5,0x54DC,0x649C,0x64A4,0xADAD,
+	0xADA4,0x0003,0x8140,0x8120,0x8140,0x8940,0x8003,0x8960,
+	0x8005,0x8980,0xC00E,0xE4A4,0xA5A4,0xAC9B,0xECED,0xACA4,
+	0xE4AC,0xA4AC,0xED00,0x0002,0x9201,0x5120,0x1060,0x8008,
+	0x0000,0x0005,0x0820,0x5121,0xC2A2,0xBAA1,0xBAC2,0xC2C2,
+	0x8003,0xC2E2,0x8004,0xC2C2,0x0001,0xC2A2,0xC282,0x8002,
+	0xBA82,0x0002,0xC282,0xC282,0xBA82,0x8004,0xBA63,0x0000,
+	0xBA62,0x8003,0xBA82,0x0002,0xC282,0xC262,0xC262,0x8002,
+	0xC283,0xC013,0xECA5,0xACA3,0xACA5,0xACEC,0x64EC,0xA4AC,
+	0xA3AC,0xA464,0x9CE4,0x9C64,0x8004,0xCB23,0x0001,0xCB44,
+	0xD344,0x8003,0xD364,0xC00B,0xEDAC,0xABAC,0xACAC,0xAC9C,
+	0x9CA5,0xA3A4,0x0004,0x6BF2,0x7411,0x7BEF,0xBC09,0xE425,
+	0xC006,0xADB4,0xF6B5,0xB6FF,0xB600,0x0004,0xBD31,0x7BEF,
+	0x7BEF,0x9CD1,0xFF17,0xC00E,0xA6A4,0x9B52,0xC950,0x40D2,
+	0x9BAB,0xA4AC,0xA464,0xE400,0x8002,0xED47,0x8004,0xED27,
+	0x8002,0xED26,0xC005,0x9CAC,0x9C9C,0xA49D,0x0010,0x2337,
+	0x12B5,0x0A2F,0x09EE,0x0A32,0x0255,0xFE0A,0xFE4A,0xFE89,
+	0xFE48,0xF5A6,0xED05,0xECC6,0xECE6,0xE4E4,0x7BEF,0x2BBC,
+	0xC003,0x6B12,0x1393,0x0001,0x7BEF,0xF58C,0xC00C,0xA5AD,
+	0x6C9B,0x939C,0x5CE4,0xA49C,0xAC9C,0xA300,0x0001,0xAC6E,
+	0x0AF5,0xC008,0xA465,0x95DC,0x64EC,0x6CE5,0xAC00,0x0004,
+	0x4374,0xF58B,0xF652,0xEDEF,0xED27,0xC00F,0x49EC,0xB4AD,
+	0x9C95,0x94DC,0x5CA4,0x5CAC,0xADAD,0xADA4,0x0000,0x8120,
+	0xC003,0xACA5,0xA3E4,0x8002,0x8960,0x8003,0x8980,0xC00A,
+	0xE464,0xE4A5,0xACA4,0x9CEB,0xEDAC,0x9C00,0x8004,0xA9E1,
+	0xC003,0xACEC,0xB4EC,0x0002,0x9A42,0x5141,0x1860,0x8006,
+	0x0000,0x0001,0x30A0,0xC2C2,0xC003,0x5CEC,0xAC9C,0x8003,
+	0xC2E2,0x8003,0xC2C2,0x8003,0xC2A2,0x8003,0xC282,0x0001,
+	0xBA82,0xBA83,0x8002,0xBA63,0x0001,0xBA62,0xBA62,0x8002,
+	0xBA82,0x0000,0xC282,0x8004,0xC283,0x0002,0xCAA3,0xCAA4,
+	0xCAC4,0x8002,0xCAE3,0xC006,0xADEC,0xABA5,0xA4AC,0xA300,
+	0x8003,0xD383,0xC003,0x9BA5,0x5CA4,0x8003,0xCB23,0x0001,
+	0xCB44,0xD344,0x8002,0xD364,0xC012,0xECA5,0xACAB,0xACAC,
+	0xACAC,0x9C9C,0xA4A5,0xA49C,0xACAC,0xA4E4,0xAD00,0x0004,
+	0xB42B,0xB44B,0xB46C,0xD4EC,0xED8D,0xC00E,0xF6BF,0xF675,
+	0xF4A6,0xADA5,0xA393,0x4989,0x8850,0xDB00,0x8002,0xF547,
+	0x8002,0xF567,0x8002,0xED47,0x8004,0xED27,0x8004,0xED26,
+	0xC003,0x9C9C,0xA49D,0x0010,0x4B94,0x12B5,0x0A2F,0x09EE,
 	0x0A52,0x0255,0xACAD,0xFE4A,0xFE69,0xFE48,0xF5C6,0xED25,
-	0xECE6,0xED06,0xECE4,0x4397,0x2BBC,0x23BB,0x1399,0x0357,
-	0x0317,0xAC6D,0xFD6B,0xF58C,0xF5AE,0xEDCE,0xEDAD,0xED6C,
-	0xED4C,0xED2C,0xED2C,0xED2C,0xED0C,0xED2C,0xED2C,0xED0C,
-	0xC4AD,0x1B14,0x0AF5,0x0AF6,0x02B7,0x0A97,0x0A97,0x02D7,
-	0x02D7,0x0AD7,0x0AF9,0x4374,0xF5AC,0xF632,0xEDCD,0xECE6,
-	0xE4C4,0xECE4,0xED24,0xED65,0xED45,0xF4E6,0xECA6,0xEC86,
-	0xEC86,0xEC66,0xEC46,0xE466,0xE487,0xE4A8,0xE4C9,0xE4C9,
-	0x8140,0x8140,0x8140,0x8141,0x8141,0x8941,0x8960,0x8960,
-	0x8960,0x8960,0x9180,0x8980,0x9180,0x9180,0x9181,0x91A1,
-	0x91A0,0x9180,0x9980,0xA1C0,0xA1E0,0xA1E1,0xA1E1,0xA1E1,
-	0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xAA01,0xAA01,0xAA21,0xB241,
-	0xBA42,0xBA82,0xBAE1,0xA282,0x71E1,0x20A0,0x0000,0x0000,
-	0x0000,0x0000,0x30C0,0xC302,0xC2E2,0xC2E2,0xC2C2,0xC2E2,
-	0xC2E1,0xC2E2,0xC2E2,0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,
-	0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC282,0xC282,0xC2A2,
-	0xC282,0xC282,0xBA83,0xBA63,0xBA62,0xBA63,0xBA83,0xBA83,
-	0xBA82,0xBA82,0xBA82,0xBA82,0xC283,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA3,0xCAC3,0xCAC3,0xCAE3,0xCAE3,0xCB04,0xD324,
-	0xD344,0xD343,0xD344,0xD364,0xD363,0xD383,0xD383,0xCB83,
-	0xCB83,0xCB83,0xCB63,0xCB43,0xCB43,0xCB43,0xCB23,0xCB23,
-	0xCB23,0xCB44,0xD344,0xD344,0xD364,0xD364,0xDB84,0xDBA5,
-	0xDBA4,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC44,0xDC44,0xDC24,
-	0xDC04,0xDC05,0xDC04,0xDC04,0xDC05,0xDC05,0x940D,0x43F6,
-	0x1BBA,0x1B99,0x1B58,0x1337,0x0AD5,0x1AB2,0x6390,0xDD91,
-	0xFE54,0xF6B4,0xF6D5,0xF6F6,0xFF18,0xFF19,0xFF19,0xF6F8,
-	0xF695,0xF632,0xF5CE,0xED8A,0xED48,0xF548,0xF547,0xF547,
-	0xF567,0xF567,0xF567,0xED47,0xED27,0xED27,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED26,0xED26,0xED26,0xED26,0xED26,
-	0xED06,0xED06,0xE4E6,0xECC7,0x4B94,0x12B5,0x0A2F,0x09EE,
-	0x0A32,0x0255,0x32D3,0xFE2A,0xFE69,0xFE67,0xF5C6,0xED05,
-	0xECE6,0xED06,0xB46A,0x237B,0x2BBC,0x23DC,0x1399,0x0B57,
-	0x0316,0xBC8C,0xFD4B,0xF58C,0xF5AE,0xF5AE,0xEDAD,0xED8C,
-	0xE54C,0xE52C,0xED2D,0xED0D,0xED0C,0xED0C,0xED2C,0xC4AD,
-	0x1AF3,0x0AF4,0x0AF5,0x0AD6,0x0AB7,0x3314,0x4353,0x4373,
-	0x4374,0x4374,0x4394,0x73D0,0xF5EE,0xF632,0xDD6C,0x8C0E,
-	0x7BEF,0x9C2D,0xED24,0xED65,0xED45,0xF4E6,0xF4A7,0xEC86,
-	0xEC66,0xEC66,0xE446,0xE446,0xE487,0xE4A8,0xE4C9,0xECE9,
-	0x8120,0x8120,0x8121,0x8140,0x8140,0x8141,0x8941,0x8960,
-	0x8960,0x8960,0x8960,0x8980,0x9180,0x9180,0x9181,0x91A1,
-	0x9180,0x91A0,0xA1C1,0xA1C1,0xA1C0,0xA1E1,0xA1E1,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xA9E2,0xAA01,0xAA01,0xB201,
-	0xB221,0xB241,0xB261,0xBAA2,0xC2E2,0xC342,0xB302,0x7221,
-	0x20A0,0x0000,0x30E0,0xCB62,0xCB42,0xCB02,0xC302,0xC302,
-	0xC2E2,0xC2E2,0xC2E2,0xC302,0xC2E2,0xC2E2,0xC2E2,0xC2E2,
-	0xC2C2,0xC2A1,0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC2A2,
-	0xC2A2,0xC2A2,0xC283,0xBA83,0xBA83,0xBA62,0xBA83,0xBA83,
-	0xBA82,0xC2A2,0xBA82,0xC282,0xC283,0xC283,0xC283,0xC283,
-	0xCAA3,0xCAA3,0xCAC3,0xCAC3,0xCAC3,0xCAE3,0xCB04,0xD324,
-	0xD344,0xD344,0xD364,0xD364,0xD383,0xD3A3,0xD383,0xCBA3,
-	0xD383,0xCB83,0xCB63,0xCB43,0xCB43,0xCB23,0xCB23,0xCB23,
-	0xCB43,0xCB43,0xD344,0xD344,0xD364,0xD364,0xDB84,0xDBA5,
-	0xDBC4,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC44,0xDC44,0xDC24,
-	0xDC04,0xDC04,0xDC04,0xDC04,0xD406,0x53F5,0x1BDA,0x23DA,
-	0x1BBA,0x1B99,0x1B78,0x1337,0x12D6,0x0A93,0x0A51,0x0A0F,
-	0x8C50,0xF694,0xFED5,0xFED6,0xFEF7,0xFF18,0xFF19,0xFEF8,
-	0xFEB7,0xF653,0xF5F0,0xED8B,0xED49,0xF548,0xF548,0xF548,
-	0xF547,0xF567,0xF567,0xED47,0xED27,0xED26,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED26,0xED27,0xED26,0xED26,0xED26,
-	0xED06,0xED06,0xECE6,0xECC7,0x7BF0,0x12D5,0x0A2F,0x09EE,
-	0x0A52,0x0255,0x0215,0x4B31,0xEE2A,0xFE47,0xF5C6,0xED05,
-	0xECE6,0xB46B,0x2339,0x235B,0x2BBC,0x23BB,0x1379,0x0B57,
-	0x0317,0xCCCB,0xFD4B,0xF58C,0xF5AD,0xF5AE,0xEDAD,0xED8C,
-	0xE54C,0xED2C,0xED2D,0xED0D,0xED0C,0xED2D,0xED2C,0x3B52,
-	0x0AD3,0x0AF4,0x0AD5,0x1AF5,0xCCCB,0xF568,0xF548,0xFD28,
-	0xFD28,0xFD07,0xF4E7,0xED28,0xF60F,0xF611,0x3B13,0x133A,
-	0x1B3A,0x1B1B,0x8C2E,0xED65,0xED25,0xF4C6,0xF4A7,0xEC87,
-	0xEC66,0xEC66,0xEC46,0xE446,0xE467,0xE488,0xE4C9,0xECE9,
-	0x7920,0x8121,0x8121,0x8120,0x8141,0x8140,0x8141,0x8941,
-	0x8940,0x8960,0x8960,0x8980,0x9180,0x9180,0x9181,0x9181,
-	0x9980,0xA1C1,0xA1C1,0xA1C0,0xA1C0,0xA1E1,0xA1E1,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xA9E2,0xAA01,0xA9E1,
-	0xB201,0xB202,0xB222,0xBA42,0xBA82,0xC2C2,0xC302,0xCB62,
-	0xCBA3,0xBB62,0x92C1,0xD3C2,0xD3A2,0xCB62,0xCB42,0xCB22,
-	0xC302,0xC302,0xC302,0xC302,0xC2E1,0xC2E1,0xC2E2,0xC2E2,
-	0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2A2,0xC2A2,0xC2A2,0xC2A2,
-	0xC2A2,0xC2A3,0xC283,0xC283,0xC283,0xBA82,0xC282,0xC283,
-	0xC2A2,0xC2A2,0xBA82,0xC283,0xC283,0xC283,0xC283,0xC2A3,
-	0xCAA3,0xCAA3,0xCAC3,0xCAC3,0xCAC3,0xCAE3,0xCB04,0xD324,
-	0xD344,0xD344,0xD364,0xD364,0xD383,0xD383,0xD3A3,0xD3A3,
-	0xD383,0xD383,0xCB63,0xCB63,0xCB43,0xCB23,0xCB23,0xCB23,
-	0xCB43,0xCB43,0xD344,0xD344,0xD364,0xD364,0xDB84,0xDBA5,
-	0xDBC4,0xDBC4,0xDBE4,0xDC04,0xDC24,0xDC44,0xDC44,0xDC24,
-	0xDC04,0xDC04,0xDC05,0xDC04,0x43F6,0x23FA,0x1BDA,0x1BDA,
-	0x1BBA,0x1BB9,0x1B99,0x1338,0x12F6,0x1294,0x0A72,0x0A10,
-	0x09CD,0x8C50,0xFEB5,0xFED5,0xF6D6,0xF6F8,0xFF19,0xF719,
-	0xF6D7,0xF675,0xF611,0xF5AD,0xF56A,0xF548,0xF548,0xF548,
-	0xF547,0xF567,0xF567,0xED47,0xED47,0xED27,0xED27,0xED27,
-	0xED27,0xED27,0xED27,0xED26,0xED27,0xED26,0xED26,0xED26,
-	0xED06,0xED06,0xECE6,0xECC7,0xAC4C,0x12D5,0x0A2F,0x09EE,
-	0x0A52,0x0256,0x0215,0x01D5,0x11D6,0x6372,0x83EF,0x7BEF,
-	0x3B75,0x12F9,0x12FB,0x235C,0x2BBC,0x23BB,0x1379,0x0337,
-	0x0317,0xFD29,0xFD6A,0xF56C,0xF5AD,0xF5AD,0xEDAD,0xED8C,
-	0xE54C,0xE52C,0xED2D,0xED0D,0xED0C,0xED0D,0xAC6E,0x12D3,
-	0x0AF3,0x0AF4,0x0AD5,0xBCAC,0xF569,0xF568,0xF548,0xFD28,
-	0xFD28,0xFD07,0xF4E7,0xF549,0xF610,0xBCF0,0x12B6,0x1B3A,
-	0x1B3A,0x12FB,0x4B75,0xED65,0xED05,0xF4C6,0xF4A7,0xEC87,
-	0xEC66,0xEC66,0xE446,0xE446,0xE467,0xE488,0xE4C9,0xECE9,
-	0x7900,0x7900,0x7920,0x8121,0x8120,0x8120,0x8140,0x8141,
-	0x8141,0x8940,0x8960,0x8960,0x9180,0x9180,0x9181,0x9181,
-	0x99A0,0xA1C1,0xA1C1,0xA1E1,0xA1E0,0xA1E0,0xA9E0,0xA1E1,
-	0xA1E1,0xA9E1,0xA9E1,0x0000,0x0000,0x0000,0x0000,0x8161,
-	0xB202,0xB202,0xB221,0xB222,0xB222,0xBA62,0xC2A2,0xC2E2,
-	0xCB43,0xCBA2,0xD3E2,0xD402,0xD3E2,0xD3E2,0xCBA2,0xCB82,
-	0xCB22,0xCB22,0xC302,0xC302,0xC302,0xC2E1,0xC2E2,0xC2E2,
-	0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,
-	0xC2C2,0xC2C2,0xC282,0xC283,0xC2A2,0xC283,0xC283,0xC283,
-	0xC283,0xC2A2,0xC2A2,0xC282,0xC283,0xC283,0xC283,0xC2A3,
-	0xCAA3,0xCAA4,0xCAC3,0xCAC3,0xD2E3,0xCAE4,0xCB04,0xD324,
-	0xD344,0xD344,0xD364,0xD364,0xD363,0xD384,0xD383,0xD383,
-	0xD3A3,0xD383,0xCB83,0xCB63,0xCB43,0xCB43,0xCB23,0xCB23,
-	0xCB43,0xCB43,0xD344,0xD364,0xD364,0xD384,0xDB84,0xDBA5,
-	0xDBA5,0xDBC5,0xDBE4,0xDC04,0xDC25,0xDC44,0xDC44,0xDC44,
-	0xDC24,0xDC05,0xDC04,0x940D,0x23FA,0x23DA,0x1BDA,0x23FA,
-	0x1BBA,0x1BB9,0x1B99,0x1358,0x1317,0x0AD4,0x0A72,0x0A30,
-	0x09EE,0x098C,0xDE13,0xFED5,0xF6D6,0xFED7,0xF6F8,0xFF19,
-	0xFEF8,0xF6B6,0xF633,0xF5CF,0xF56B,0xF548,0xF547,0xF547,
-	0xED47,0xF567,0xF567,0xED46,0xED47,0xED47,0xED27,0xED26,
-	0xED27,0xED27,0xED27,0xED26,0xED26,0xED26,0xED26,0xED26,
-	0xED06,0xE506,0xED06,0xECC7,0xECE7,0x1AF4,0x0A2F,0x0A0E,
-	0x0A52,0x0255,0x0215,0x01B6,0x0197,0x0198,0x0A39,0x12DA,
-	0x1319,0x12F9,0x1B1A,0x235B,0x2B9C,0x23BB,0x1359,0x0B37,
-	0x5BB1,0xFD29,0xFD4A,0xF58C,0xF5AD,0xEDCD,0xEDAD,0xED8C,
-	0xED6C,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0x7BEF,0x12D2,
-	0x12D3,0x0AD4,0x0AD4,0xF54A,0xF569,0xFD88,0xF548,0xFD28,
-	0xF508,0xFCE7,0xF4E6,0xED6A,0xF611,0xBCEF,0x12F7,0x133B,
-	0x1B1A,0x1AFB,0x4B55,0xED45,0xF505,0xF4C6,0xF4A7,0xEC86,
-	0xEC66,0xEC66,0xE445,0xE446,0xE466,0xE488,0xE4C8,0xECE9,
-	0x7900,0x7901,0x7921,0x7921,0x7921,0x7920,0x8120,0x8140,
-	0x8141,0x8140,0x8960,0x8960,0x8960,0x9180,0x9180,0x9180,
-	0xA1C1,0xA1C1,0xA1C1,0xA1C1,0xA9E1,0xA9E0,0xA9E0,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0x0000,0x0000,0x0000,0x0000,0x8181,
-	0xB201,0xB201,0xB222,0xB221,0xB221,0xB242,0xBA62,0xBA82,
-	0xC2E2,0xCB22,0xCB82,0xD3C2,0xD3E2,0xDC02,0xDC02,0xD3E3,
-	0xD3A2,0xCB62,0xCB42,0xCB22,0xCB02,0xC301,0xC2E2,0xC2E2,
-	0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,
-	0xC2C2,0xC2C2,0xC2A2,0xC2A2,0xC2A2,0xC283,0xC283,0xC283,
-	0xC2A3,0xC2A2,0xC2A2,0xC2A2,0xC283,0xC283,0xC283,0xC2A3,
-	0xC2A3,0xCAC3,0xCAC3,0xCAC3,0xCAE3,0xD304,0xCB04,0xD324,
-	0xD344,0xD344,0xD364,0xD364,0xD384,0xD363,0xD383,0xD383,
-	0xD3A3,0xD383,0xD383,0xCB63,0xCB63,0xCB43,0xCB43,0xCB43,
-	0xCB43,0xCB43,0xD344,0xD364,0xD364,0xD384,0xDB84,0xDBA5,
-	0xDBA5,0xDBC5,0xDBE4,0xDC04,0xDC24,0xDC44,0xE444,0xDC44,
-	0xDC24,0xDC05,0xDC04,0x3BF8,0x23FA,0x23DA,0x23DA,0x6BF2,
-	0xBC29,0xB42B,0x1B99,0x1358,0xB46C,0xBC8D,0x5371,0x0A51,
-	0x09EF,0x01AD,0x634E,0xFED5,0xFED6,0xF6D6,0xFEF8,0xFF19,
-	0xFEF8,0xFED7,0xF674,0xF5F0,0xF58C,0xED69,0xF548,0xF548,
-	0xED47,0xF567,0xF567,0xED47,0xED47,0xED47,0xED26,0xED26,
-	0xED27,0xED27,0xED26,0xED26,0xED26,0xED26,0xED26,0xED26,
-	0xED06,0xED06,0xECE6,0xECC7,0xECE7,0x8C2F,0x0A2F,0x020E,
-	0x0A53,0x0A55,0x0215,0x01B6,0x0197,0x0198,0x0A39,0x12DA,
-	0x12F9,0x12F9,0x131A,0x233C,0x2B9C,0x239B,0x1359,0x0B37,
-	0xBC8C,0xF528,0xF54A,0xF56B,0xF5AD,0xEDCD,0xEDAD,0xED8D,
-	0xED4D,0xED4D,0xED2D,0xED2D,0xED2D,0xED2C,0x7BEF,0x12D2,
-	0x12D3,0x0AD4,0x0AB4,0x8C2F,0xFD69,0xFD69,0xF548,0xFD08,
-	0xF527,0xF4E7,0xF4E6,0xF58C,0xF611,0xC50E,0x12F8,0x133B,
-	0x133B,0x12FB,0x4B55,0xDD26,0x63B2,0x4BB4,0x53D3,0xC44A,
-	0xEC66,0xEC66,0xE445,0xE466,0xE466,0xE487,0xE4C8,0xECE9,
-	0x7901,0x7901,0x7901,0x7901,0x7901,0x7901,0x8121,0x8121,
-	0x8140,0x8140,0x8140,0x8961,0x8961,0x9160,0x9180,0x99A1,
-	0xA1A1,0xA1A1,0xA1C1,0xA1C1,0xA1C1,0xA1E0,0xA9E1,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0x0000,0x0000,0x0000,0x0000,0x8181,
-	0xB202,0xB201,0xB222,0xB221,0xB221,0xB221,0xBA42,0xBA62,
-	0xC282,0xC2C2,0xCB22,0xCB42,0xD3A2,0xD3E2,0xDC22,0xDC23,
-	0xD402,0xD3C2,0xCB82,0xCB62,0xC322,0xC302,0xCB02,0xC2E2,
-	0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2E2,
-	0xC2E2,0xC2C2,0xC2C3,0xC2A3,0xC2A2,0xC2A3,0xC2A3,0xC283,
-	0xC2A3,0xC2A2,0xC2A2,0xC2A2,0xC2A3,0xC283,0xC283,0xC283,
-	0xC2A3,0xCAC4,0xCAC4,0xCAC3,0xCAE3,0xD304,0xCB04,0xD324,
-	0xD324,0xD344,0xD364,0xD384,0xD364,0xD384,0xD383,0xD3A3,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xCB63,0xD343,0xD343,0xCB43,
-	0xD343,0xD344,0xD344,0xD364,0xD364,0xD364,0xDB84,0xDBA5,
-	0xDBA5,0xDBC5,0xDBE4,0xDC04,0xDC24,0xE444,0xE444,0xE444,
-	0xDC24,0xDC05,0xCC06,0x23FB,0x23FA,0x23FA,0x73F1,0xDC05,
-	0xE425,0xAC2A,0x1B99,0x1358,0xB46C,0xED09,0xED4B,0x4331,
-	0x0A10,0x01AE,0x220D,0xF6D4,0xFED5,0xFED6,0xF6D7,0xF718,
-	0xF719,0xFEF8,0xF6B5,0xF632,0xF5AD,0xED8A,0xED48,0xF548,
-	0xED48,0xF567,0xF567,0xED46,0xED47,0xED47,0xED26,0xED26,
-	0xED27,0xED27,0xED26,0xED26,0xED27,0xED27,0xED26,0xED26,
-	0xED06,0xED06,0xED06,0xECC7,0xECE7,0xED4A,0x3AF0,0x020F,
-	0x0A53,0x0255,0x0215,0x01B6,0x0197,0x0198,0x0A39,0x12D9,
-	0x12F9,0x12F9,0x12FA,0x233C,0x2B9C,0x239B,0x1359,0x73F1,
-	0xF4E8,0xFD28,0xF549,0xF56B,0xF5AC,0xEDCD,0xEDAD,0xED8D,
-	0xED4D,0xE52D,0xED2D,0xED2D,0xED2D,0xED0C,0x8C2F,0x12D2,
-	0x0AD3,0x0AD4,0x0AB4,0x0A95,0x6391,0x7BEF,0x7BEF,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x9C6F,0xF631,0xF58C,0x4375,0x1B3B,
-	0x133B,0x12FB,0x8C2E,0x4B55,0x12F9,0x1339,0x0B78,0x3BB5,
-	0xEC66,0xEC46,0xE445,0xE446,0xE466,0xE487,0xE4C8,0xECE9,
-	0x7901,0x7900,0x7900,0x7900,0x7901,0x7901,0x7921,0x8121,
-	0x8120,0x8121,0x8140,0x8940,0x8960,0x8960,0x9981,0xA1A1,
-	0xA1A0,0xA1A0,0xA1A0,0xA1C1,0xA1C1,0xA1E1,0xA9E1,0xA9E1,
-	0xA9E1,0xA9E1,0xA9E1,0x0000,0x0000,0x0000,0x0000,0x8181,
-	0xB201,0xB201,0xB222,0xB221,0xB221,0xBA22,0xBA22,0xBA42,
-	0xBA62,0xC282,0xC2C3,0xC2E3,0xCB42,0xD3A2,0xD3E2,0xDC22,
-	0xD422,0xD422,0xD3E2,0xD3C2,0xCB62,0xCB42,0xCB22,0xC302,
-	0xC2E2,0xC302,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xCAE2,0xCAE2,
-	0xC2E2,0xCAE2,0xC2E3,0xC2C3,0xC2C2,0xC2A2,0xC2A3,0xC283,
-	0xC2A3,0xC2A2,0xBAA2,0xC2A2,0xC2A2,0xC283,0xC283,0xC283,
-	0xC2A3,0xCAA4,0xCAC4,0xCAC3,0xCAE3,0xCAE4,0xCB04,0xD324,
-	0xD324,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,0xD3A3,
-	0xD3A3,0xD3A3,0xD3A2,0xCB83,0xCB63,0xD363,0xD343,0xCB43,
-	0xCB43,0xD343,0xD344,0xD364,0xD364,0xD384,0xDB85,0xDB85,
-	0xDBA5,0xDBC5,0xDBE5,0xDC05,0xDC24,0xE444,0xE444,0xE444,
-	0xDC24,0xDC05,0xAC0A,0x23FB,0x23FA,0x23FA,0xC407,0xDC25,
-	0xDC25,0xB42A,0x1B99,0x1B79,0xB46C,0xED08,0xED4A,0xAC8E,
-	0x0A11,0x09CE,0x096D,0xFEB4,0xFED5,0xFEB6,0xF6B7,0xF6F8,
-	0xF719,0xFF18,0xF6B6,0xF653,0xF5EF,0xF58B,0xF569,0xF548,
-	0xF548,0xF567,0xF567,0xED47,0xED47,0xED47,0xED26,0xED26,
-	0xED26,0xED26,0xED26,0xED27,0xED27,0xED27,0xED27,0xED26,
-	0xED06,0xED06,0xED06,0xECC6,0xECE7,0xED4A,0xE58F,0x32CF,
-	0x0A53,0x0255,0x0215,0x01D6,0x0197,0x0998,0x0A39,0x12DA,
-	0x12F9,0x0AD9,0x12FA,0x233B,0x239C,0x239B,0x63D2,0xF4C8,
-	0xFD08,0xFD28,0xF549,0xF56A,0xF58C,0xF5CD,0xEDAD,0xED8D,
-	0xED4D,0xED2D,0xED0D,0xED2D,0xED2D,0xED2D,0xCCED,0x12D2,
-	0x0AD3,0x0AD4,0x0AB4,0x0A95,0x0276,0x0A76,0x02B6,0x0AF7,
-	0x02F7,0x0B18,0x0AF7,0x4310,0xF611,0xF56B,0xDCA6,0x8C0E,
-	0x7BEF,0x9C4D,0xED64,0x12BA,0x0B19,0x0B58,0x0B78,0x1399,
-	0xEC66,0xEC46,0xE445,0xE446,0xE466,0xE487,0xE4C8,0xECE9,
-	0x7901,0x7901,0x7901,0x7901,0x7900,0x7900,0x7900,0x7920,
-	0x8121,0x8121,0x8941,0x8940,0x8940,0x9161,0x9981,0xA181,
-	0xA1A0,0xA1A0,0xA1A1,0xA1A1,0xA1A1,0xA1C1,0xA1C1,0xA9E1,
-	0xAA01,0xA9E1,0xA9E1,0x7980,0x7961,0x8181,0x8161,0xA1E1,
-	0xB201,0xB201,0xB221,0xB221,0xB222,0xBA22,0xBA22,0xBA42,
-	0xBA62,0xBA82,0xC282,0xC2A2,0xC2E2,0xCB22,0xD382,0xD3E3,
-	0xD402,0xD442,0xD422,0xD402,0xD3C2,0xCB82,0xCB42,0xC322,
-	0xC302,0xC302,0xC302,0xC2E2,0xC2C2,0xC2E2,0xC2E2,0xCAE2,
-	0xCAE2,0xCAE2,0xC2E2,0xC2C2,0xC2C2,0xC2A2,0xC2A3,0xC2A3,
-	0xC2A3,0xC2A3,0xBAA2,0xC2C2,0xC2A2,0xC2A2,0xC283,0xC2A3,
-	0xCAA3,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xCAE3,0xD304,0xCB24,
-	0xD324,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,0xD3A3,
-	0xD3A3,0xD3C3,0xD3A3,0xCB83,0xCB83,0xCB63,0xD343,0xD343,
-	0xCB43,0xD343,0xD344,0xD364,0xD364,0xD384,0xDB85,0xDB85,
-	0xDBA5,0xDBC5,0xDBE5,0xDC05,0xDC24,0xE444,0xE444,0xDC44,
-	0xDC24,0xDC04,0xAC0A,0x23FA,0x23FA,0x23FA,0xDC25,0xDC05,
+	0xECE6,0xED06,0xECE4,0x4397,0x2BBC,0xC003,0x631A,0x1294,
+	0x0001,0xAC6D,0xFD6B,0xC005,0x6DAE,0x6C9B,0x939C,0x8002,
+	0xED2C,0xC003,0x9CAC,0xA49C,0x0001,0xC4AD,0x1B14,0xC008,
+	0x1DA5,0x55DC,0xA474,0xA4E4,0xAE00,0x0004,0x4374,0xF5AC,
+	0xF632,0xEDCD,0xECE6,0xC00F,0x5AEC,0xB4B5,0x9CCD,0x549C,
+	0xA49C,0x9C6C,0xADAD,0xADA4,0x8002,0x8140,0x0002,0x8141,
+	0x8141,0x8941,0x8003,0x8960,0xC00A,0xEC64,0xE4A4,0xA5AC,
+	0xA39C,0xE4F4,0xAC00,0x8002,0xA1E1,0x8003,0xA9E1,0xC006,
+	0xACA4,0xACEC,0xE5B4,0xBB00,0x0002,0xA282,0x71E1,0x20A0,
+	0x8003,0x0000,0x0001,0x30C0,0xC302,0xC004,0x9CA4,0x9CAC,
+	0xA300,0x8004,0xC2E2,0x0001,0xC2C2,0xC2C2,0x8004,0xC2A2,
+	0xC00A,0x9CA4,0xAC9C,0xA465,0x9CA3,0xA5AC,0xA400,0x8003,
+	0xBA82,0x8003,0xC283,0xC00E,0xECA4,0xACA4,0xACA4,0xADEC,
+	0xACA3,0xA5AC,0xA3AC,0xA400,0x8002,0xCB83,0x0000,0xCB63,
+	0x8002,0xCB43,0x8002,0xCB23,0xC014,0xADE4,0xA4AC,0xA4EC,
+	0xADA3,0xACAC,0xACAC,0xACA4,0x9C9C,0xA5A3,0xA4A5,0xA400,
+	0x0002,0x940D,0x43F6,0x1BBA,0xC003,0x9B93,0x5B4A,0x0003,
+	0x1AB2,0x6390,0xDD91,0xFE54,0xC00E,0x7CAD,0xADEE,0xA5A4,
+	0x5B89,0x8988,0x5092,0xE4A3,0xA400,0x8002,0xF567,0x0000,
+	0xED47,0x8006,0xED27,0x8004,0xED26,0xC003,0x9CA4,0x5CDD,
+	0x000F,0x4B94,0x12B5,0x0A2F,0x09EE,0x0A32,0x0255,0x32D3,
+	0xFE2A,0xFE69,0xFE67,0xF5C6,0xED05,0xECE6,0xED06,0xB46A,
+	0x237B,0xC004,0xF56C,0x1152,0x5300,0x0001,0xBC8C,0xFD4B,
+	0xC00B,0x75AE,0xA463,0x9B54,0x9CE5,0x9CA3,0xA4AC,0x0001,
+	0xC4AD,0x1AF3,0xC003,0x25A5,0x9D9D,0x0001,0x3314,0x4353,
+	0xC003,0xACA5,0xA4AC,0x0007,0x73D0,0xF5EE,0xF632,0xDD6C,
+	0x8C0E,0x7BEF,0x9C2D,0xED24,0xC00C,0xB59C,0xCD95,0x5B9C,
+	0xA45C,0xA4B5,0xADAD,0xEC00,0x0000,0x8120,0xC005,0xA4A5,
+	0xABA4,0xA5E4,0x8003,0x8960,0xC006,0xACE4,0xA4A5,0xAC9B,
+	0xAC00,0x0000,0xA1C1,0xC003,0xA4A3,0xADA4,0x8004,0xA9E1,
+	0xC00A,0xA5AB,0xA4E4,0xACAC,0xACF5,0xF4BC,0x1400,0x0004,
+	0x7221,0x20A0,0x0000,0x30E0,0xCB62,0xC003,0x9C94,0x64A4,
+	0x8002,0xC2E2,0x0000,0xC302,0x8003,0xC2E2,0x0001,0xC2C2,
+	0xC2A1,0x8007,0xC2A2,0xC009,0x9D64,0xA49B,0xADA4,0xA3EC,
+	0x5CE4,0x8003,0xC283,0x0001,0xCAA3,0xCAA3,0x8002,0xCAC3,
+	0xC00F,0xACAD,0xECAC,0xA4AC,0xA4AB,0xAC9C,0x6CDC,0x649C,
+	0x9CA4,0x8002,0xCB23,0xC00F,0xACA4,0xE5A4,0xACA4,0xECAD,
+	0xABA4,0xACAC,0xACAC,0xA49C,0x8003,0xDC04,0x0002,0xD406,
+	0x53F5,0x1BDA,0xC008,0xE45C,0x9B9B,0x538B,0x5192,0x9200,
+	0x0001,0x8C50,0xF694,0xC008,0xF5A5,0xADAD,0xA59B,0x9348,
+	0x8900,0x0001,0xED8B,0xED49,0x8002,0xF548,0xC005,0xA3AC,
+	0xA45C,0x9CA3,0x8004,0xED27,0x0001,0xED26,0xED27,0x8002,
+	0xED26,0xC003,0x9CA4,0x9C9D,0x000E,0x7BF0,0x12D5,0x0A2F,
+	0x09EE,0x0A52,0x0255,0x0215,0x4B31,0xEE2A,0xFE47,0xF5C6,
+	0xED05,0xECE6,0xB46B,0x2339,0xC005,0xAEFD,0x6312,0x5A54,
+	0x0001,0xCCCB,0xFD4B,0xC00B,0x75AD,0xA563,0x9B54,0xDCA5,
+	0x9CA3,0xADA3,0x0006,0x3B52,0x0AD3,0x0AF4,0x0AD5,0x1AF5,
+	0xCCCB,0xF568,0xC005,0x9CDC,0xA49B,0x5C75,0x0007,0xF60F,
+	0xF611,0x3B13,0x133A,0x1B3A,0x1B1B,0x8C2E,0xED65,0xC00B,
+	0x94CD,0x9D5C,0x9BA4,0x9C64,0xADAD,0xB5EC,0x0000,0x7920,
+	0xC015,0xE5A4,0xA3AD,0xA3A5,0xE4A3,0xACA4,0xACE4,0xA4A5,
+	0xA4E3,0xF5A4,0xA3A4,0xADA4,0x8005,0xA9E1,0xC00C,0xA5AB,
+	0x9CEC,0xA5AC,0xECB4,0xF4B4,0xFCB5,0x1300,0x0001,0x92C1,
+	0xD3C2,0xC003,0x9C54,0x9C9C,0x8003,0xC302,0xC003,0x9BA4,
+	0xA5A4,0x8003,0xC2C2,0x8004,0xC2A2,0x0000,0xC2A3,0x8002,
+	0xC283,0xC005,0x63E4,0xA5AB,0xA45C,0x8003,0xC283,0x0002,
+	0xC2A3,0xCAA3,0xCAA3,0x8002,0xCAC3,0xC00F,0xACAD,0xECAC,
+	0xA4AC,0xA4AB,0xA4AC,0xA49C,0xA45C,0xA49C,0x8002,0xCB23,
+	0xC013,0xACA4,0xE5A4,0xACA4,0xECAD,0xABA4,0xACAC,0xACAC,
+	0xA49C,0x9CA4,0xA5A3,0x0001,0x43F6,0x23FA,0xC00A,0x5CA4,
+	0x9CA3,0x9C4B,0x928A,0x5A8A,0x9100,0x0001,0x8C50,0xFEB5,
+	0xC009,0xAC65,0xAEED,0x6492,0x8A88,0x8891,0x8002,0xF548,
+	0xC004,0xA3AC,0xA45C,0xA400,0x8005,0xED27,0x0001,0xED26,
+	0xED27,0x8002,0xED26,0xC003,0x9CA4,0x9C9D,0x000F,0xAC4C,
+	0x12D5,0x0A2F,0x09EE,0x0A52,0x0256,0x0215,0x01D5,0x11D6,
+	0x6372,0x83EF,0x7BEF,0x3B75,0x12F9,0x12FB,0x235C,0xC004,
+	0xFC63,0x1212,0x9C00,0x0000,0xFD29,0xC00B,0xB566,0xB5A4,
+	0x649B,0x549C,0xE59C,0xA3A5,0x0006,0xAC6E,0x12D3,0x0AF3,
+	0x0AF4,0x0AD5,0xBCAC,0xF569,0xC006,0xA39C,0xDCA4,0x9B5C,
+	0xBE00,0x0007,0xF610,0xBCF0,0x12B6,0x1B3A,0x1B3A,0x12FB,
+	0x4B75,0xED65,0xC00B,0x8CD5,0x9D5C,0x9BA4,0x5CA4,0xADAD,
+	0xB5EC,0x0000,0x7900,0xC019,0xA4AC,0xE5A3,0xA4AC,0xA5A4,
+	0xE3AC,0xA4EC,0xA4A5,0xA4EB,0xEDA4,0xACA3,0xA4E4,0x65A4,
+	0xE4A4,0x8003,0x0000,0x0001,0x8161,0xB202,0xC010,0xA4AB,
+	0xA5A4,0xF4F4,0xB4FD,0xBBF4,0xAC9C,0xA454,0x9C8C,0xA400,
+	0x8002,0xC302,0x0000,0xC2E1,0x8002,0xC2E2,0x8008,0xC2C2,
+	0x0002,0xC282,0xC283,0xC2A2,0x8003,0xC283,0x0002,0xC2A2,
+	0xC2A2,0xC282,0x8002,0xC283,0xC025,0xACE4,0xA5AB,0xA4EC,
+	0x65AC,0xECAC,0xA4AC,0xA4A3,0xADA3,0xA4AC,0x9C64,0x9C9C,
+	0xA49C,0xA4AC,0xA4E5,0xACA4,0xACE4,0xADA4,0xACAB,0xACAD,
+	0x8002,0xDC44,0x0004,0xDC24,0xDC05,0xDC04,0x940D,0x23FA,
+	0xC00C,0x9C64,0xEC54,0xA39C,0x5393,0x518A,0x9292,0x8A00,
+	0x0001,0xDE13,0xFED5,0xC013,0x65E5,0x6DED,0x9B52,0x8188,
+	0x8899,0xA3A4,0x64EC,0xA45B,0xA5A4,0x9CA3,0x8002,0xED27,
+	0x8004,0xED26,0xC004,0x9C64,0xE495,0xAC00,0x0003,0x1AF4,
+	0x0A2F,0x0A0E,0x0A52,0xC004,0x6794,0x8D9D,0xA500,0x0001,
+	0x0A39,0x12DA,0xC007,0xB39C,0xEDF5,0xF56B,0x0A5A,0x0001,
+	0x5BB1,0xFD29,0xC007,0xAD76,0xAD6C,0x9C9B,0x9C9D,0x8003,
+	0xED2D,0x0005,0x7BEF,0x12D2,0x12D3,0x0AD4,0x0AD4,0xF54A,
+	0xC006,0xABEB,0x54DC,0x5CDB,0x6300,0x0008,0xED6A,0xF611,
+	0xBCEF,0x12F7,0x133B,0x1B1A,0x1AFB,0x4B55,0xED45,0xC00B,
+	0xD495,0x9D5B,0x9CA4,0x5BA5,0xACAE,0xB4ED,0x0001,0x7900,
+	0x7901,0x8002,0x7921,0xC004,0xA3E4,0xACA5,0xA300,0x8002,
+	0x8960,0x8002,0x9180,0x8003,0xA1C1,0x0002,0xA9E1,0xA9E0,
+	0xA9E0,0x8003,0xA9E1,0x8003,0x0000,0x0001,0x8181,0xB201,
+	0xC014,0xA4AD,0xA3A4,0xADEC,0xACFC,0xF4BC,0xF4AC,0xECA4,
+	0x5D93,0x549C,0x9C9C,0x6300,0x8002,0xC2E2,0x8008,0xC2C2,
+	0x8002,0xC2A2,0x8002,0xC283,0x0000,0xC2A3,0x8002,0xC2A2,
+	0x8002,0xC283,0x0001,0xC2A3,0xC2A3,0x8002,0xCAC3,0xC010,
+	0xACED,0x64EC,0xACA4,0xACA4,0xAC9B,0xACA4,0xAC9C,0xA45C,
+	0xA400,0x8004,0xCB43,0xC010,0xE5AC,0xA4AC,0xE4AD,0xA4AC,
+	0xABAC,0xACAC,0xE464,0x9C9D,0xA300,0x0010,0x3BF8,0x23FA,
+	0x23DA,0x23DA,0x6BF2,0xBC29,0xB42B,0x1B99,0x1358,0xB46C,
+	0xBC8D,0x5371,0x0A51,0x09EF,0x01AD,0x634E,0xFED5,0xC00E,
+	0xA564,0xEEAD,0x9B9B,0x4980,0x8859,0xDBA4,0x63EC,0xA400,
+	0x8002,0xED47,0xC003,0x9BA4,0xA5A4,0x8005,0xED26,0xC004,
+	0x9CA4,0x9C9D,0xAC00,0x0003,0x8C2F,0x0A2F,0x020E,0x0A53,
+	0xC004,0xA654,0x8D9D,0xA500,0x0005,0x0A39,0x12DA,0x12F9,
+	0x12F9,0x131A,0x233C,0xC003,0xFC63,0x125A,0x0001,0xBC8C,
+	0xF528,0xC007,0xAEAD,0xB66C,0x9C9C,0x94A4,0x8002,0xED2D,
+	0x0007,0xED2C,0x7BEF,0x12D2,0x12D3,0x0AD4,0x0AB4,0x8C2F,
+	0xFD69,0xC005,0xA45B,0xD46B,0x94A3,0x000D,0xF58C,0xF611,
+	0xC50E,0x12F8,0x133B,0x133B,0x12FB,0x4B55,0xDD26,0x63B2,
+	0x4BB4,0x53D3,0xC44A,0xEC66,0xC006,0xA45B,0xADA4,0xADB5,
+	0xED00,0x8005,0x7901,0x0001,0x8121,0x8121,0x8002,0x8140,
+	0xC006,0xEDA4,0xE3AC,0xEDE4,0xA400,0x8002,0xA1C1,0x0000,
+	0xA1E0,0x8004,0xA9E1,0x8003,0x0000,0x0003,0x8181,0xB202,
+	0xB201,0xB222,0x8002,0xB221,0xC010,0xEDAC,0xECB4,0xFCAC,
+	0xFCB4,0xF4A5,0x5B94,0x549C,0x549C,0xE400,0x8003,0xC2E2,
+	0x8003,0xC2C2,0xC009,0xACA4,0x9CA5,0x9CA3,0xA5A4,0x9CAC,
+	0x8002,0xC2A2,0x0000,0xC2A3,0x8002,0xC283,0xC00E,0xACED,
+	0xA4A3,0xACED,0x64EC,0xA4AC,0xACAC,0x9CAC,0xA300,0x8002,
+	0xD3A3,0xC008,0x9CA4,0x5CDC,0xA464,0xE4A5,0xA400,0x8002,
+	0xD364,0xC006,0xECAD,0xA4AC,0xABAC,0xAC00,0x8002,0xE444,
+	0x0013,0xDC24,0xDC05,0xCC06,0x23FB,0x23FA,0x23FA,0x73F1,
+	0xDC05,0xE425,0xAC2A,0x1B99,0x1358,0xB46C,0xED09,0xED4B,
+	0x4331,0x0A10,0x01AE,0x220D,0xF6D4,0xC007,0xE5A5,0x65B5,
+	0xA5DB,0x5181,0x0000,0xF5AD,0xC012,0x5992,0xE464,0xEBA4,
+	0x5BA5,0xA49B,0xA4A5,0xA4A3,0xA4A5,0xA4A3,0xA400,0x8002,
+	0xED06,0x0005,0xECC7,0xECE7,0xED4A,0x3AF0,0x020F,0x0A53,
+	0xC004,0x6694,0x8D9D,0xA500,0x000A,0x0A39,0x12D9,0x12F9,
+	0x12F9,0x12FA,0x233C,0x2B9C,0x239B,0x1359,0x73F1,0xF4E8,
+	0xC008,0xF46D,0xAEB5,0x6D9C,0x9C94,0x5C00,0x8002,0xED2D,
+	0x0002,0xED0C,0x8C2F,0x12D2,0xC003,0x65A5,0x9C9D,0x0000,
+	0x6391,0x8005,0x7BEF,0x000D,0x9C6F,0xF631,0xF58C,0x4375,
+	0x1B3B,0x133B,0x12FB,0x8C2E,0x4B55,0x12F9,0x1339,0x0B78,
+	0x3BB5,0xEC66,0xC006,0x9C63,0xA5AC,0xADB5,0xED00,0x0000,
+	0x7901,0x8002,0x7900,0xC009,0xA5A4,0xACE4,0xA3A5,0xABE4,
+	0xACA4,0x0001,0x9981,0xA1A1,0x8002,0xA1A0,0x0002,0xA1C1,
+	0xA1C1,0xA1E1,0x8004,0xA9E1,0x8003,0x0000,0x0001,0x8181,
+	0xB201,0xC019,0xA4AD,0xA3A4,0xE5A4,0xACAC,0xECB5,0xACFB,
+	0xFCB4,0xF464,0xA494,0x9C4C,0x9C9C,0x5C9C,0xAC9C,0x8002,
+	0xC2C2,0xC00E,0xECA4,0x64E4,0x659C,0xA39C,0xA59C,0xACA3,
+	0x64E4,0xA400,0x8002,0xC283,0xC009,0xACE5,0xACA3,0xACA5,
+	0xACEC,0xA4AC,0x8002,0xD364,0x0001,0xD384,0xD383,0x8002,
+	0xD3A3,0xC012,0xA35D,0x9CE4,0x9C64,0xA4E4,0xA5AC,0xA4AC,
+	0xE5A4,0xACAC,0xACAC,0xAB00,0x8002,0xE444,0x0013,0xDC24,
+	0xDC05,0xAC0A,0x23FB,0x23FA,0x23FA,0xC407,0xDC25,0xDC25,
+	0xB42A,0x1B99,0x1B79,0xB46C,0xED08,0xED4A,0xAC8E,0x0A11,
+	0x09CE,0x096D,0xFEB4,0xC00E,0xAD9D,0x65B5,0xADE3,0x4A89,
+	0x8888,0x9A9B,0xA4AB,0xA400,0x8002,0xED47,0x8004,0xED26,
+	0x8003,0xED27,0x0000,0xED26,0x8002,0xED06,0x0005,0xECC6,
+	0xECE7,0xED4A,0xE58F,0x32CF,0x0A53,0xC004,0x6694,0x9595,
+	0xE500,0x0009,0x0A39,0x12DA,0x12F9,0x0AD9,0x12FA,0x233B,
+	0x239C,0x239B,0x63D2,0xF4C8,0xC00A,0xF4AC,0x6DAD,0xAEB5,
+	0x5C9C,0x949C,0x9C00,0x8002,0xED2D,0x0001,0xCCED,0x12D2,
+	0xC00A,0x65A5,0x9C9D,0x5DE4,0x74F5,0x64ED,0x9B00,0x0008,
+	0x4310,0xF611,0xF56B,0xDCA6,0x8C0E,0x7BEF,0x9C4D,0xED64,
+	0x12BA,0xC003,0x7BB3,0xACED,0x0000,0xEC66,0xC006,0x9C63,
+	0xA5AC,0xADB5,0xED00,0x8003,0x7901,0x8002,0x7900,0xC00A,
+	0xACE5,0xA4EC,0xA3A4,0xEDEC,0xE4AB,0xA400,0x8002,0xA1A1,
+	0xC005,0xACA4,0xECAC,0x9CA4,0x0005,0x7980,0x7961,0x8181,
+	0x8161,0xA1E1,0xB201,0xC016,0xA4AC,0xA4A5,0xE4A4,0xACAC,
+	0xACE4,0xACB4,0xF4FC,0xBDAB,0xB49C,0x9C94,0x5494,0x5C00,
+	0x8002,0xC302,0xC003,0x9C9C,0xACA4,0x8002,0xCAE2,0xC003,
+	0x649C,0xA49C,0x8003,0xC2A3,0xC008,0x63EC,0x9CA4,0x9DAC,
+	0xE4A4,0xAC00,0x8002,0xCAE3,0xC003,0xED6C,0xE4AC,0x8002,
+	0xD364,0xC01C,0xACA3,0xACA4,0xAC9C,0x5CA4,0x9CDC,0xA464,
+	0xE4A5,0xACA4,0xACE5,0xA4AC,0xACAC,0xACAB,0xECA4,0x649C,
+	0x9C00,0x0000,0xAC0A,0x8002,0x23FA,0x000D,0xDC25,0xDC05,
 	0xE425,0xB40A,0x1BB9,0x1B98,0xB44B,0xECE8,0xF54A,0xBCAE,
-	0x0A31,0x09CF,0x098D,0xFEB3,0xF6B5,0xF6D6,0xF6D6,0xFEF7,
-	0xFEF8,0xFEF9,0xF6D8,0xF694,0xF5F0,0xF5AC,0xF56A,0xF548,
-	0xF548,0xED67,0xF567,0xED47,0xED46,0xED47,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED26,0xED26,
-	0xED06,0xED06,0xECE6,0xECE6,0xECE7,0xED2A,0xF5CF,0xEDB0,
-	0x4331,0x0A76,0x0215,0x01B5,0x0196,0x01B8,0x0A39,0x12BA,
-	0x12F9,0x12D9,0x12FA,0x233B,0x239C,0x73F1,0xECC6,0xF4C7,
-	0xFD08,0xFD28,0xFD49,0xF56A,0xF58C,0xF5AD,0xEDAD,0xED8D,
-	0xED4D,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0xED2D,0x73D0,
-	0x0AD2,0x0AD3,0x0AB4,0x0295,0x0275,0x0A76,0x02D6,0x02F7,
-	0x02F7,0x0B18,0x12D7,0x42F0,0xF610,0xED49,0xECC5,0xCC87,
-	0xB46A,0xCCE7,0xED64,0x12BA,0x0B19,0x0B58,0x1379,0x1379,
-	0xEC66,0xEC46,0xE445,0xE446,0xE466,0xE487,0xE4C8,0xECE9,
-	0x7901,0x7901,0x7901,0x7900,0x7900,0x7900,0x7900,0x7901,
-	0x8121,0x8120,0x8920,0x8920,0x8940,0x9961,0x9981,0x9981,
-	0x99A1,0xA1A1,0xA1A0,0xA1A1,0xA1A1,0xA1A1,0xA9C1,0xA9C1,
-	0xA9C1,0xA9E1,0xAA01,0xAA01,0xAA01,0xAA01,0xA9E1,0xB201,
-	0xB201,0xB201,0xB221,0xB201,0xB222,0xBA22,0xBA22,0xBA42,
-	0xBA62,0xBA82,0xBA82,0xC282,0xC2A2,0xC2E2,0xCB22,0xD362,
-	0xD3C2,0xDC02,0xDC42,0xDC42,0xDC22,0xD3E2,0xCBA2,0xD362,
-	0xC321,0xC301,0xC302,0xC2E2,0xC2E2,0xC2C2,0xCAE2,0xCAE2,
-	0xCAE2,0xCAE2,0xCAE2,0xC2E2,0xC2C2,0xC2C2,0xC2A3,0xC2C2,
-	0xC2A2,0xC2A2,0xC2A2,0xC2C2,0xC2C3,0xC2A3,0xC2A3,0xC2A3,
-	0xC2A3,0xCAA3,0xCAC3,0xCAC3,0xCAE3,0xCAE4,0xD304,0xCB24,
-	0xD324,0xD344,0xD364,0xD364,0xD364,0xD384,0xD384,0xD3A3,
-	0xD3C3,0xD3C3,0xD3A3,0xCBA3,0xD383,0xCB63,0xD363,0xD343,
-	0xD343,0xD344,0xD344,0xD364,0xD364,0xD384,0xDB85,0xDB85,
-	0xDBA5,0xDBC5,0xDBE5,0xDC05,0xDC24,0xE444,0xE444,0xE444,
-	0xDC44,0xDC04,0xAC0A,0x23FB,0x23FA,0x23FA,0xB40A,0xDC05,
-	0xE425,0xAC0A,0x1BB9,0x1B99,0xB44B,0xECE8,0xF52A,0x73D0,
-	0x0A52,0x09F0,0x222E,0xFE93,0xF6B4,0xFED5,0xFEB6,0xF6D7,
-	0xF6F8,0xFF19,0xFEF8,0xF6B6,0xF632,0xF5CE,0xF56B,0xF548,
-	0xF548,0xF567,0xF567,0xED67,0xED46,0xED47,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED26,0xED26,
-	0xED06,0xED06,0xECE6,0xECE6,0xECE7,0xED29,0xF5AF,0xFDD0,
-	0xF5AC,0xAC8D,0x32D3,0x01B6,0x0196,0x01B8,0x0A39,0x12DA,
-	0x12D9,0x12D9,0x12FA,0x5BB4,0xAC49,0xDC64,0xECA6,0xF4E7,
-	0xFD08,0xFD28,0xFD49,0xF56A,0xF58C,0xF5AD,0xEDCD,0xED8E,
-	0xED4D,0xED4D,0xED2D,0xED2D,0xED0D,0xED2D,0xED2D,0xED2D,
-	0x63B0,0x0AD3,0x0AB4,0x0295,0x0276,0x0A96,0x02D6,0x02F7,
-	0x02D7,0x0B18,0x12D6,0x430F,0xF5EF,0xED29,0x73F1,0x1B3A,
-	0x1AFB,0x12BB,0xA48B,0x2B17,0x0B19,0x0B58,0x0B79,0x1B98,
-	0xEC66,0xEC46,0xE445,0xE446,0xE466,0xE487,0xE4C8,0xECE9,
-	0x7901,0x7901,0x7901,0x7901,0x7901,0x7900,0x7900,0x7900,
-	0x8121,0x8120,0x8120,0x8921,0x9941,0x9961,0x9961,0x9961,
-	0x9981,0xA181,0xA181,0xA1A1,0xA181,0xA1A1,0xA1A1,0xA9C1,
-	0xA9C1,0xA9E1,0xA9E1,0xAA01,0xAA01,0xAA01,0xA9E1,0xB1E2,
-	0xB201,0xB201,0xB221,0xB221,0xB222,0xBA22,0xBA22,0xBA42,
-	0xBA42,0xBA82,0xC282,0xC283,0xC282,0xC2A3,0xCAE2,0xCB02,
-	0xCB62,0xD3C2,0xD402,0xDC42,0xDC62,0xDC41,0xD3E2,0xD3C2,
-	0xCB61,0xCB22,0xC301,0xC2E2,0xCAE2,0xC2E2,0xC2C2,0xCAE2,
-	0xCAE2,0xCB02,0xCB02,0xCAE2,0xCAE2,0xCAC3,0xCAC3,0xC2C3,
-	0xC2C3,0xC2C2,0xC2C3,0xC2C3,0xC2C3,0xC2A3,0xC2A3,0xC2A3,
-	0xC2A3,0xC2A3,0xCAC3,0xCAC3,0xCAE3,0xCAE4,0xD304,0xCB24,
-	0xD324,0xD344,0xD364,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD3A3,0xD383,0xD363,0xD343,
-	0xD343,0xD344,0xD344,0xD364,0xD364,0xD384,0xDB85,0xDB85,
-	0xDBA4,0xDBA5,0xDBE5,0xDC05,0xDC24,0xE444,0xE445,0xE445,
-	0xE444,0xDC04,0xDC04,0x23FA,0x23FA,0x23FA,0x2BF9,0xB40A,
-	0xE425,0xAC0A,0x1BBA,0x1399,0xB44B,0xECC7,0x8C2F,0x0AB5,
-	0x0A53,0x09F0,0x636F,0xF692,0xF6B4,0xF6D5,0xF6B6,0xF6B7,
-	0xF6D7,0xFEF8,0xFEF9,0xFED7,0xF654,0xF5EF,0xF58C,0xF549,
-	0xF548,0xF567,0xF567,0xED67,0xED46,0xED47,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED26,0xED26,
-	0xED06,0xED06,0xECE7,0xECE6,0xECE7,0xED29,0xF5AF,0xFDF0,
-	0xF5AC,0xF5AA,0xFDEA,0xDDAB,0xBD2C,0x8410,0x8410,0x7BF0,
-	0x8C2E,0xB48B,0xDCE6,0xE4E4,0xDC63,0xE464,0xECC6,0xF4E7,
-	0xFD08,0xFD28,0xF529,0xF56A,0xF58C,0xF5AD,0xEDAD,0xED8E,
-	0xED6D,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0xED4D,0xE50D,
-	0x3352,0x0AB3,0x02B3,0x0295,0x0276,0x0A96,0x02D6,0x02F7,
-	0x0AD8,0x0AF8,0x0AB5,0x42EF,0xF5CE,0xD4AA,0x133A,0x1B3A,
-	0x12FB,0x12BB,0x5374,0xAC6C,0x0B18,0x0B58,0x1379,0x73F1,
-	0xEC66,0xEC45,0xE425,0xE446,0xE466,0xE4A7,0xE4C8,0xECE9,
-	0x7921,0x8101,0x8101,0x8101,0x7901,0x7901,0x7900,0x8100,
-	0x8120,0x8121,0x8121,0x8921,0x9941,0x9941,0x9961,0x9961,
-	0x9961,0xA181,0xA181,0xA181,0xA181,0xA1A1,0xA1A1,0xA1A1,
-	0xA1A1,0xA1C1,0xA1E1,0xA9E1,0xA9E1,0xA9E1,0xA9E1,0xB201,
-	0xB201,0xB201,0xB221,0xB221,0xB221,0xBA22,0xBA22,0xBA42,
-	0xBA42,0xC262,0xC282,0xC282,0xC282,0xC2A2,0xC2C2,0xCAE2,
-	0xCB23,0xCB62,0xCBA2,0xD402,0xDC42,0xDC62,0xDC42,0xD402,
-	0xD3C2,0xCB82,0xCB41,0xCB02,0xCB02,0xC2E2,0xCAE2,0xCAE2,
-	0xCAE2,0xCB02,0xCB02,0xCB02,0xCAE2,0xCAE2,0xCAC3,0xC2C2,
-	0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2C3,0xC2A3,0xC2A2,0xC2A3,
-	0xC2A3,0xC2A3,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xD304,0xCB24,
-	0xD324,0xD344,0xD364,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3C3,0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD383,0xCB63,0xD363,
-	0xCB63,0xD363,0xD364,0xD364,0xD364,0xD384,0xDB84,0xDB84,
-	0xDBA5,0xDBA5,0xDBC5,0xDC05,0xDC04,0xE444,0xE444,0xE444,
-	0xDC44,0xDC24,0xDC04,0x63F2,0x1BFA,0x1BFA,0x1BFA,0x1BFA,
-	0xAC0A,0xAC0B,0x1BDA,0x1B99,0x3BB5,0x2357,0x12F7,0x0AB5,
-	0x0A73,0x0A31,0xBD10,0xF691,0xF6B3,0xF6B5,0xF6B5,0xFEB6,
-	0xF6D7,0xF6F8,0xFEF9,0xF6D8,0xF676,0xF612,0xF5AD,0xF569,
-	0xF548,0xF567,0xF567,0xED66,0xED46,0xED47,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED26,0xED26,
-	0xED06,0xED06,0xED06,0xECE6,0xECE7,0xED29,0xF5AE,0xF5D0,
-	0xF58C,0xFDA9,0xFDCA,0xFE29,0xFE69,0xFE48,0xF5C6,0xED26,
-	0xED06,0xED26,0xED25,0xE4C4,0xDC83,0xDC64,0xECC6,0xF4E7,
-	0xFD08,0xFD28,0xFD48,0xF569,0xF58C,0xEDAD,0xEDCD,0xED8E,
-	0xED6D,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0xED4D,0x5B91,
-	0x12B2,0x0AB3,0x0293,0x0274,0x4332,0xAC8D,0xBC8C,0xBC8C,
-	0xBC8B,0xBC8B,0xBCAE,0xCD50,0xEDAC,0xB46B,0x135A,0x133B,
+	0x0A31,0x09CF,0x098D,0xFEB3,0xC007,0x66AD,0xA4ED,0xA5A5,
+	0x5B90,0x0000,0xF5F0,0xC009,0x9092,0x9AA4,0x6BE4,0x5CA3,
+	0xA59C,0x8004,0xED26,0xC009,0xA5A4,0xA3A4,0x9CA4,0x9CA4,
+	0xA5B7,0x0003,0xF5CF,0xEDB0,0x4331,0x0A76,0xC003,0x4B8C,
+	0x9DAE,0x0008,0x0A39,0x12BA,0x12F9,0x12D9,0x12FA,0x233B,
+	0x239C,0x73F1,0xECC6,0xC00A,0xE5F5,0xACAD,0x6DAE,0xAD64,
+	0x9C94,0xA400,0x8004,0xED2D,0x0001,0x73D0,0x0AD2,0xC009,
+	0xA59D,0x5D9C,0xE57C,0xADA4,0xEDD3,0x0008,0x42F0,0xF610,
+	0xED49,0xECC5,0xCC87,0xB46A,0xCCE7,0xED64,0x12BA,0xC003,
+	0x7BB3,0xEDA4,0x0000,0xEC66,0xC006,0x9C63,0xA5AC,0xADB5,
+	0xED00,0x8002,0x7901,0x8003,0x7900,0xC005,0xA5EC,0xA3E4,
+	0xA4AC,0x0000,0x9961,0xC004,0xACA4,0xACE4,0xA300,0x8002,
+	0xA1A1,0x8002,0xA9C1,0x0000,0xA9E1,0x8003,0xAA01,0x0000,
+	0xA9E1,0x8002,0xB201,0xC01B,0xAC9C,0xADE4,0xA4AC,0xACAC,
+	0xA4E4,0xACB4,0xF4F4,0xBCF4,0xB4A4,0x9C54,0x54D4,0x139C,
+	0xA59C,0xA49C,0x8004,0xCAE2,0xC004,0x649C,0xA49D,0xAB00,
+	0x8002,0xC2A2,0x0001,0xC2C2,0xC2C3,0x8003,0xC2A3,0xC008,
+	0xE4AC,0xA4AC,0xA5EC,0x6CE4,0xAC00,0x8002,0xD364,0xC017,
+	0xACA4,0xABAC,0xA49C,0x64DC,0x5CE4,0x9CA4,0xA5A4,0xACA4,
+	0xACE5,0xA4AC,0xACAC,0xACAB,0x8002,0xE444,0x0013,0xDC44,
+	0xDC04,0xAC0A,0x23FB,0x23FA,0x23FA,0xB40A,0xDC05,0xE425,
+	0xAC0A,0x1BB9,0x1B99,0xB44B,0xECE8,0xF52A,0x73D0,0x0A52,
+	0x09F0,0x222E,0xFE93,0xC012,0x6DED,0x9D6D,0xADED,0x9B52,
+	0x8088,0x8999,0xA4AB,0xA464,0x9BA5,0x9C00,0x8004,0xED26,
+	0xC009,0xA5A4,0xA3A4,0x9CA4,0x9CA4,0xA5B6,0x0010,0xF5AF,
+	0xFDD0,0xF5AC,0xAC8D,0x32D3,0x01B6,0x0196,0x01B8,0x0A39,
+	0x12DA,0x12D9,0x12D9,0x12FA,0x5BB4,0xAC49,0xDC64,0xECA6,
+	0xC00D,0xF5ED,0xACAD,0x6DAE,0xAD6C,0x9593,0xA49C,0xA49C,
+	0x8002,0xED2D,0x0001,0x63B0,0x0AD3,0xC008,0x9D5D,0x9DEC,
+	0x74AD,0x9CF5,0xD200,0x000D,0x430F,0xF5EF,0xED29,0x73F1,
+	0x1B3A,0x1AFB,0x12BB,0xA48B,0x2B17,0x0B19,0x0B58,0x0B79,
+	0x1B98,0xEC66,0xC006,0x9C63,0xA5AC,0xADB5,0xED00,0x8004,
+	0x7901,0x8002,0x7900,0xC003,0xEDA3,0xA4E5,0x0000,0x9941,
+	0x8002,0x9961,0xC00A,0xACE4,0xA4AC,0x9CAC,0xA4EC,0xA4AC,
+	0xA400,0x8002,0xAA01,0xC02B,0x9CE5,0xABA4,0xACA4,0xA5E4,
+	0xA4AC,0xA4B4,0xE4A5,0xA3AD,0xF3AC,0xBCFC,0xB4F4,0xAC9B,
+	0x4D9C,0x4B95,0x5B9D,0xE464,0x9CEC,0xA4AC,0xA49C,0xA49D,
+	0xA464,0xA4A3,0x8002,0xC2C3,0x8004,0xC2A3,0xC007,0xECA4,
+	0xACA5,0xEC6C,0xE4AC,0x8002,0xD364,0x0002,0xD384,0xD384,
+	0xD3A4,0x8002,0xD3C3,0xC017,0x9CA4,0x9C9C,0x9CA4,0xA5A4,
+	0xACA4,0xACE5,0xA4AB,0xA5B4,0xACAB,0xECA5,0xA4A3,0x54A4,
+	0x8002,0x23FA,0x000D,0x2BF9,0xB40A,0xE425,0xAC0A,0x1BBA,
+	0x1399,0xB44B,0xECC7,0x8C2F,0x0AB5,0x0A53,0x09F0,0x636F,
+	0xF692,0xC008,0xAEAD,0x9DA5,0xACED,0xA59A,0x4100,0x0000,
+	0xF5EF,0xC008,0x8991,0xA3AB,0xA464,0x9BA5,0x9C00,0x8004,
+	0xED26,0xC009,0xA5A4,0xA3A4,0x9CA4,0x9DA3,0xA5B6,0x0000,
+	0xF5AF,0xC003,0xF550,0xA2F4,0x0007,0xDDAB,0xBD2C,0x8410,
+	0x8410,0x7BF0,0x8C2E,0xB48B,0xDCE6,0xC00E,0xE243,0xE5FE,
+	0xEDED,0xAC65,0xB5AE,0xAD64,0x9D9B,0x9C00,0x8003,0xED2D,
+	0x0003,0xED4D,0xE50D,0x3352,0x0AB3,0xC008,0x649E,0x9DEC,
+	0x74AD,0xDDAC,0x9100,0x000D,0x42EF,0xF5CE,0xD4AA,0x133A,
+	0x1B3A,0x12FB,0x12BB,0x5374,0xAC6C,0x0B18,0x0B58,0x1379,
+	0x73F1,0xEC66,0xC006,0x9B5C,0xADAC,0xB5AD,0xED00,0x0000,
+	0x7921,0x8002,0x8101,0xC007,0x64A4,0xA3E4,0xACA5,0xA4E4,
+	0x0001,0x9941,0x9941,0x8002,0x9961,0x8003,0xA181,0x8003,
+	0xA1A1,0x0001,0xA1C1,0xA1E1,0x8003,0xA9E1,0x8002,0xB201,
+	0x8002,0xB221,0xC004,0xE5A4,0xACA4,0xEC00,0x8002,0xC282,
+	0xC010,0xACAC,0xECB5,0xB3B4,0xFCF4,0xAC9C,0x5494,0x5493,
+	0x95A4,0x5C00,0x8002,0xCAE2,0x8002,0xCB02,0xC003,0x9CA4,
+	0x9D63,0x8002,0xC2C3,0xC003,0xAC9C,0x9CA3,0x8002,0xC2A3,
+	0xC007,0xE4AC,0xACA4,0xED6C,0xE4AC,0x8002,0xD364,0x0002,
+	0xD384,0xD384,0xD3A4,0x8003,0xD3C3,0xC005,0x9C9C,0x5CE4,
+	0x64E4,0x8002,0xD364,0xC007,0xACE4,0xA4AD,0xA4AC,0xB4A3,
+	0x8002,0xE444,0x0003,0xDC44,0xDC24,0xDC04,0x63F2,0x8003,
+	0x1BFA,0x0005,0xAC0A,0xAC0B,0x1BDA,0x1B99,0x3BB5,0x2357,
+	0xC003,0x0C52,0x9292,0x0001,0xBD10,0xF691,0xC009,0xAEA6,
+	0xA4E5,0x6DAD,0xE55B,0x8A88,0x0000,0xF5AD,0xC007,0x909B,
+	0xABA4,0x639C,0xA59C,0x8004,0xED26,0xC003,0xA5A4,0xA3A4,
+	0x8002,0xED06,0x0003,0xECE6,0xECE7,0xED29,0xF5AE,0xC007,
+	0xAE90,0xE9AD,0xBBB4,0x9B42,0x0000,0xED26,0xC005,0x9CAC,
+	0xA34B,0x539D,0x0000,0xECC6,0xC00A,0xEDED,0xACAC,0x6DAF,
+	0x6DAC,0x959B,0x9C00,0x8003,0xED2D,0x0008,0xED4D,0x5B91,
+	0x12B2,0x0AB3,0x0293,0x0274,0x4332,0xAC8D,0xBC8C,0xC003,
+	0xA4A3,0xA4AF,0x000C,0xCD50,0xEDAC,0xB46B,0x135A,0x133B,
 	0x12FB,0x129B,0x4B55,0xED25,0xD4A9,0xBC4B,0xC469,0xF466,
-	0xEC66,0xEC45,0xE425,0xE446,0xE466,0xE4A7,0xE4C8,0xECE9,
-	0x7901,0x8101,0x8101,0x8101,0x8101,0x7921,0x8101,0x8121,
-	0x8101,0x8120,0x8921,0x9141,0x9140,0x9941,0x9961,0x9961,
-	0x9961,0x9961,0xA161,0xA181,0xA181,0xA181,0xA181,0xA181,
-	0xA1A1,0xA1C1,0xA1C1,0x50E0,0x50E0,0x50E0,0x50E0,0x5900,
-	0x5900,0x5900,0x5900,0x5900,0x5900,0x5901,0x5921,0x5921,
-	0x6121,0x5921,0x6141,0x6141,0x6141,0x6141,0x6161,0x6161,
-	0x9241,0xC323,0xCB62,0xD3A2,0xD402,0xDC42,0xDC62,0xDC42,
-	0xDC22,0xD3E2,0xCB82,0xCB22,0xCB22,0xC302,0xC2E2,0xCAE2,
-	0xCAE2,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,0xCAE2,0xCAE2,
-	0xCAC3,0xCAC3,0xC2C3,0xC2C2,0xC2C3,0xC2C2,0xC2A3,0xC2A3,
-	0xC2A3,0xC2A3,0xCAC3,0xCAC3,0xCAE4,0xD2E3,0xD304,0xD324,
-	0xD324,0xD344,0xD344,0xDB64,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3A3,0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD383,0xD383,0xD363,
-	0xD363,0xD363,0xD364,0xD364,0xD364,0xD384,0xDB84,0xDB84,
-	0xDBA5,0xDBA5,0xDBC5,0xDBE5,0xDC04,0xDC44,0xE444,0xE444,
-	0xDC44,0xDC24,0xDC04,0xC407,0x2BF9,0x1BFB,0x23FA,0x1BFA,
-	0xDC25,0xB40A,0x1BDA,0x1B99,0x1378,0x1358,0x1317,0x0AD6,
-	0x0A74,0x5351,0xF62F,0xF671,0xF6B3,0xFE94,0xFE95,0xF6B6,
-	0xF6B7,0xF6D7,0xFEF8,0xFEF8,0xF6B6,0xF653,0xF5CE,0xF56A,
-	0xF548,0xF567,0xF566,0xED66,0xED46,0xED26,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED26,0xED26,0xED26,0xED06,
-	0xED06,0xED06,0xED06,0xECE6,0xECE7,0xED29,0xF5AE,0xF5D0,
-	0xF58C,0xFDA9,0xFDEA,0xFE29,0xFE69,0xFE48,0xF5C6,0xED26,
-	0xED06,0xED46,0xED26,0xE4C4,0xDC83,0xE484,0xECC6,0xFD07,
-	0xFD28,0xFD28,0xFD28,0xF569,0xF58B,0xF5AD,0xEDCE,0xED8E,
-	0xED4E,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0xD4EE,0x12B2,
-	0x12B2,0x0A93,0x0A93,0x4352,0xF58A,0xFD69,0xF528,0xFD28,
-	0xF507,0xF507,0xF58D,0xF610,0xF58C,0xB46B,0x135A,0x133B,
-	0x12FB,0x129B,0x4B55,0xF525,0xF4C6,0xF4A6,0xEC86,0xF466,
-	0xEC46,0xE445,0xE445,0xE445,0xE466,0xE4A7,0xE4C8,0xED09,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,
-	0x8100,0x8920,0x9141,0x9141,0x9141,0x9941,0x9941,0x9961,
-	0x9961,0x9961,0x9961,0xA161,0xA181,0xA181,0xA181,0xA181,
-	0xA1A1,0xA1A1,0xA9A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x6161,0xC302,0xCB22,0xCB62,0xD3A2,0xD3E2,0xDC22,0xDC62,
-	0xDC62,0xDC42,0xD3E2,0xCB82,0xCB42,0xCB22,0xC302,0xC302,
-	0xCAE2,0xCB02,0xCB02,0xCB02,0xCB02,0xCB03,0xCB02,0xCAE2,
-	0xCAE3,0xCAC3,0xC2E3,0xC2E3,0xC2C3,0xC2C3,0xC2C2,0xC2C3,
-	0xC2A3,0xC283,0xCAC3,0xCAC3,0xCAE3,0xCAE4,0xD304,0xD304,
-	0xD324,0xD344,0xD344,0xDB64,0xD364,0xDB84,0xD384,0xD384,
-	0xD3A3,0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD383,0xD383,0xCB83,
-	0xD383,0xD363,0xD363,0xD363,0xD364,0xD384,0xDB84,0xDB84,
-	0xDBA5,0xDBA5,0xDBC5,0xDBE4,0xDC04,0xDC44,0xE444,0xE444,
-	0xDC44,0xDC24,0xDC04,0xDC04,0x940D,0x2BF9,0x1BFA,0x23FA,
-	0xDC05,0xB40B,0x1BDA,0x1BB9,0x1379,0x1338,0x1317,0x0AD6,
-	0x4352,0xE58D,0xF60E,0xF670,0xF692,0xFEB4,0xF6B5,0xF6B6,
-	0xFEB6,0xFEB7,0xF6F8,0xF6F8,0xFED7,0xF695,0xFE11,0xF58C,
-	0xF568,0xF568,0xF566,0xED66,0xED46,0xED26,0xED27,0xED27,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED06,0xED06,
-	0xED06,0xED06,0xED06,0xECE6,0xECE7,0xED29,0xEDAE,0xF5EF,
-	0xF5AC,0xFDA9,0xFDE9,0xFE29,0xFE69,0xFE48,0xF5C7,0xED26,
-	0xED26,0xED46,0xED25,0xE4C4,0xDC83,0xE484,0xF4C6,0xFD07,
-	0xFD28,0xFD28,0xFD28,0xF549,0xF58B,0xF5AD,0xEDCE,0xED8E,
-	0xED6D,0xED4D,0xED2D,0xED2D,0xED2D,0xED2D,0x8C0F,0x12B2,
-	0x0AB2,0x0A93,0x0A93,0xDD2C,0xF5AA,0xFD69,0xFD29,0xFD08,
-	0xF507,0xF528,0xF5AE,0xF5F0,0xED4A,0xE4C5,0x3377,0x1B3A,
-	0x12FB,0x12BA,0x73D1,0xF526,0xF4C6,0xF487,0xF486,0xF466,
-	0xEC46,0xE445,0xE425,0xE445,0xE466,0xE4A7,0xE4C8,0xECE9,
-	0x8101,0x8101,0x8101,0x8101,0x8101,0x8101,0x8121,0x8121,
-	0x8900,0x9121,0x9961,0x9941,0x9941,0x9961,0x9941,0x9961,
-	0x9961,0x9961,0x9961,0xA161,0xA161,0xA181,0xA181,0xA181,
-	0xA1A1,0xA1A1,0xA9A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCB02,0xCB22,0xCB42,0xCBA2,0xD3E2,0xDC42,
-	0xDC82,0xDC62,0xDC22,0xD3C2,0xD382,0xCB42,0xCB02,0xCB02,
-	0xCAE2,0xCAE2,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,0xCB03,
-	0xCAE2,0xCAC3,0xC2E3,0xC2E2,0xC2E3,0xC2C3,0xC2C3,0xC2C3,
-	0xC2A3,0xC2A3,0xC2A3,0xCAC3,0xCAE3,0xCAE4,0xD304,0xD304,
-	0xD324,0xD324,0xD344,0xD364,0xD364,0xD384,0xD384,0xD384,
-	0xD3A4,0xD3C4,0xD3C3,0xD3A3,0xD3A3,0xD383,0xD383,0xD383,
-	0xD383,0xD363,0xD363,0xD363,0xD364,0xD364,0xDB84,0xD384,
-	0xDB85,0xDBA5,0xDBC5,0xDBE4,0xDC04,0xDC24,0xE444,0xE444,
-	0xDC44,0xDC24,0xDC04,0xDC04,0xDC04,0xBC09,0x4C15,0x43F6,
+	0xC007,0x649B,0x5CAD,0xACB5,0xADED,0x0000,0x7901,0x8003,
+	0x8101,0xC008,0x6CDC,0xAC9C,0xABE5,0xECA3,0xE500,0x8003,
+	0x9961,0x0000,0xA161,0x8004,0xA181,0x0002,0xA1A1,0xA1C1,
+	0xA1C1,0x8003,0x50E0,0x8005,0x5900,0xC004,0xA5AC,0xA4E4,
+	0x6400,0x8003,0x6141,0x0003,0x6161,0x6161,0x9241,0xC323,
+	0xC00E,0xF3F4,0xBCF4,0xAC9C,0x9C54,0x4C8C,0xA45C,0x9CE4,
+	0xA400,0x8004,0xCB02,0xC007,0x9CA4,0x9DA4,0x64A3,0xA5A3,
+	0x8003,0xC2A3,0xC00E,0xECA4,0xADE3,0xADAC,0xA4AC,0xA4EC,
+	0x64AC,0xA4AC,0xA300,0x8002,0xD3C3,0x0002,0xD3A3,0xD383,
+	0xD383,0x8002,0xD363,0x8002,0xD364,0xC00D,0xACE4,0xA4AD,
+	0xA4AC,0xACAB,0xB4E4,0xA464,0x9C9C,0x0007,0xC407,0x2BF9,
+	0x1BFB,0x23FA,0x1BFA,0xDC25,0xB40A,0x1BDA,0xC005,0x935B,
+	0x9C93,0x538A,0x0001,0x5351,0xF62F,0xC00A,0xB6B6,0xDDA5,
+	0x6DA5,0xACED,0xA452,0x8900,0x0000,0xF5CE,0xC007,0x889A,
+	0xABA3,0x649C,0x9CA5,0x8007,0xED26,0x8003,0xED06,0x0003,
+	0xECE6,0xECE7,0xED29,0xF5AE,0xC007,0xAE90,0xE9B5,0xB3B4,
+	0x9B42,0x0000,0xED26,0xC006,0x9CB4,0x9C4A,0x53E5,0xF600,
+	0x0000,0xFD07,0x8002,0xFD28,0xC006,0x75AE,0xAE6D,0x9494,
+	0xA300,0x8003,0xED2D,0x0006,0xD4EE,0x12B2,0x12B2,0x0A93,
+	0x0A93,0x4352,0xF58A,0xC004,0xDB53,0xE45B,0xA400,0x0009,
+	0xF58D,0xF610,0xF58C,0xB46B,0x135A,0x133B,0x12FB,0x129B,
+	0x4B55,0xF525,0xC004,0x8D9C,0x5CDC,0x5C00,0x8002,0xE445,
+	0xC003,0xADB5,0xADF5,0x8006,0x8101,0x0002,0x8121,0x8100,
+	0x8920,0x8002,0x9141,0x0001,0x9941,0x9941,0x8003,0x9961,
+	0x0000,0xA161,0x8003,0xA181,0x0002,0xA1A1,0xA1A1,0xA9A1,
+	0x8014,0x0000,0x0001,0x6161,0xC302,0xC00E,0xECB4,0xF4B4,
+	0xF4B4,0xA49C,0x4C4C,0x949C,0x5CA4,0xDC00,0x8003,0xCB02,
+	0xC01B,0xA5A3,0x9CA5,0x9C6C,0xA49C,0xA4A3,0xA59C,0x9CF4,
+	0xA4AC,0xA5EC,0xA4AC,0xACA4,0xEC64,0xEC64,0xA4AB,0x8002,
+	0xD3C3,0xC004,0x9C9C,0xA464,0xE400,0x8002,0xD363,0xC00F,
+	0xA5AC,0xE4A4,0xADA4,0xACAB,0xACB4,0xE4A4,0x649C,0x9CA4,
+	0x0006,0x940D,0x2BF9,0x1BFA,0x23FA,0xDC05,0xB40B,0x1BDA,
+	0xC004,0x9B54,0x939B,0x5300,0x0002,0x4352,0xE58D,0xF60E,
+	0xC00B,0xBEAE,0xEE65,0xA5E4,0xA575,0xA4DB,0x52C0,0x0000,
+	0xF58C,0xC007,0x98A4,0xA264,0x9C9C,0xA5A4,0x8003,0xED26,
+	0x0001,0xED27,0xED27,0x8004,0xED06,0x0003,0xECE6,0xECE7,
+	0xED29,0xEDAE,0xC007,0xF591,0xE1B4,0xB4B4,0x9B43,0x0000,
+	0xED26,0xC005,0xA4AC,0x9B4B,0x53E5,0x0001,0xF4C6,0xFD07,
+	0x8002,0xFD28,0xC006,0x6DB6,0xAE6D,0x949B,0x9C00,0x8003,
+	0xED2D,0x0006,0x8C0F,0x12B2,0x0AB2,0x0A93,0x0A93,0xDD2C,
+	0xF5AA,0xC004,0xD394,0x9B63,0xAD00,0x0009,0xF5AE,0xF5F0,
+	0xED4A,0xE4C5,0x3377,0x1B3A,0x12FB,0x12BA,0x73D1,0xF526,
+	0xC00B,0x8C95,0xA39C,0x5C63,0x9CAC,0xADB5,0xADED,0x8005,
+	0x8101,0xC008,0xACA4,0xDBED,0xF49C,0xA4AC,0x9C00,0x8003,
+	0x9961,0x0001,0xA161,0xA161,0x8002,0xA181,0x0002,0xA1A1,
+	0xA1A1,0xA9A1,0x8014,0x0000,0x0001,0x6161,0xCAE2,0xC00F,
+	0xACAC,0xACBC,0xF4FC,0xB49C,0x944C,0x9454,0x94A4,0x9CA4,
+	0x8004,0xCB02,0xC005,0xA59B,0x9D6C,0xA3A5,0x8002,0xC2C3,
+	0x8002,0xC2A3,0xC009,0xECAC,0xA5EC,0xA4AC,0xA4AC,0xACA4,
+	0x8002,0xD384,0xC004,0xACAC,0xA39C,0xA400,0x8003,0xD383,
+	0x8002,0xD363,0xC00D,0xA5A4,0xEC64,0xE5AC,0xACAB,0xACAC,
+	0xECA4,0x649C,0x8002,0xDC04,0x000B,0xBC09,0x4C15,0x43F6,
 	0xDC05,0xB40A,0x23DA,0x1BB9,0x1399,0x1358,0x2B56,0x9C4E,
-	0xF56A,0xF5AC,0xFDEE,0xF64F,0xF691,0xF693,0xFE95,0xF695,
-	0xFEB6,0xF6B7,0xF6D8,0xF6F8,0xF6D8,0xF6B6,0xF633,0xF5AD,
-	0xF569,0xF568,0xF587,0xF566,0xED47,0xED46,0xED27,0xED27,
-	0xED26,0xED26,0xED26,0xED06,0xF527,0xED27,0xED26,0xED06,
-	0xED06,0xED06,0xE4E6,0xCCA8,0xB46B,0x8C0F,0x83F0,0x7BEF,
-	0x7BEF,0x7BEF,0x8C2F,0xBD0D,0xDDCA,0xF647,0xF5C6,0xED46,
-	0xED26,0xF547,0xED26,0xE4C4,0xDC83,0xE4A5,0xECE6,0xFD07,
-	0xFD28,0xFD28,0xFD28,0xF549,0xF56B,0xEDAD,0xEDCE,0xEDAE,
-	0xED6E,0xED4D,0xED4D,0xED2D,0xED2D,0xED2D,0x7BEF,0x12B2,
-	0x0AB2,0x0A92,0x0A93,0xD52C,0xF5AA,0xFD6A,0xF529,0xF508,
-	0xF508,0xF529,0xF5CE,0xF5EF,0xED29,0xECA5,0xCC67,0x5BB4,
-	0x4B75,0x63B2,0xDD46,0xF506,0xF4C7,0xF487,0xF486,0xEC66,
-	0xEC46,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xE4C8,0xED09,
-	0x8101,0x8101,0x8101,0x8101,0x8100,0x8121,0x8121,0x8921,
-	0x8921,0x9141,0x9940,0x9940,0x9940,0x9960,0x9961,0x9961,
-	0x9941,0x9941,0x9961,0xA161,0xA161,0xA162,0xA181,0xA181,
-	0xA181,0xA1A1,0xA1A1,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCAE2,0xCB22,0xCB42,0xCB62,0xD3A2,0xD3E1,
-	0xDC42,0xDC62,0xDC62,0xD422,0xD3E2,0xD3A2,0xCB42,0xCB02,
-	0xCB02,0xC302,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,0xCB03,
-	0xCB03,0xCAE2,0xCAE2,0xCAE3,0xC2E3,0xC2C2,0xC2C2,0xC2A2,
-	0xC2A3,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE4,0xCB04,0xD304,
-	0xD324,0xD324,0xD344,0xD364,0xD364,0xD384,0xD384,0xD384,
-	0xD3A4,0xD3C4,0xD3C3,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,
-	0xD383,0xCB63,0xD363,0xD363,0xD364,0xD384,0xD384,0xDB84,
-	0xDB85,0xDBA5,0xDBC4,0xDBE4,0xDC04,0xDC24,0xE444,0xDC64,
-	0xDC64,0xDC44,0xDC04,0xDC04,0xE405,0xE405,0xDC05,0xD406,
-	0xE405,0xCC08,0x7BEF,0x7BEF,0xA42C,0xD469,0xF4C7,0xED08,
-	0xF54A,0xF58B,0xF5CD,0xF64E,0xF690,0xFE92,0xFE94,0xF696,
-	0xF6B6,0xFEB6,0xF6D7,0xFEF8,0xF6F8,0xF6D7,0xF674,0xF5EF,
-	0xF58A,0xF568,0xF567,0xF567,0xED66,0xED46,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xED27,0xED27,0xED06,
-	0xAC6C,0x63B2,0x2318,0x1319,0x1319,0x12D6,0x0A51,0x020F,
-	0x0A53,0x0A56,0x0215,0x01D5,0x0197,0x1217,0x5353,0x9C4D,
-	0xDCE7,0xED46,0xED26,0xE4E4,0xDC83,0xE484,0xF4C6,0xF507,
-	0xFD28,0xFD28,0xFD27,0xF549,0xF56B,0xF5AD,0xEDCE,0xEDAE,
-	0xED8E,0xED4E,0xED4E,0xED2D,0xED2D,0xED2D,0x7BEF,0x12B2,
-	0x0AB2,0x0A92,0x0A73,0x32F2,0xDD4C,0xFD6A,0xF529,0xFD08,
-	0xF4E7,0xF549,0xF5CF,0xF5AF,0xED28,0xECC5,0xECA4,0xE4C4,
-	0xED24,0xED84,0xF565,0xF506,0xF4A6,0xF487,0xF486,0xEC46,
-	0xEC46,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xE4C8,0xED09,
-	0x8101,0x8101,0x8121,0x8121,0x8121,0x8121,0x8921,0x8901,
-	0x9141,0x9141,0x9940,0x9941,0x9960,0x9960,0x9961,0x9961,
-	0x9941,0x9941,0x9961,0xA161,0xA161,0xA161,0xA181,0xA161,
-	0xA181,0xA181,0xA1A1,0x0000,0x0000,0x0000,0x0800,0x2860,
-	0x2860,0x2860,0x2860,0x2880,0x0820,0x0000,0x0000,0x0000,
-	0x2880,0x2880,0x30A0,0x30A0,0x2060,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCAE2,0xCB02,0xCB22,0xCB42,0xCB62,0xCBA2,
-	0xD402,0xDC22,0xDC61,0xDC62,0xDC42,0xD3E2,0xD382,0xCB42,
-	0xCB22,0xC302,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,
-	0xCB03,0xCAE2,0xCAE2,0xCAE2,0xC2E3,0xC2E3,0xC2C3,0xC2C2,
-	0xC2A3,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCB04,0xCB24,
-	0xD324,0xD324,0xD343,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3A4,0xD3C4,0xD3C3,0xD3C3,0xD3A3,0xD3A3,0xD383,0xD383,
-	0xD383,0xCB63,0xD363,0xD363,0xD364,0xD364,0xD384,0xDB85,
-	0xDB85,0xDBA5,0xDBA4,0xDBC5,0xDC05,0xDC24,0xE444,0xDC44,
-	0xDC64,0xE444,0xDC24,0xD406,0xE405,0xE405,0xE405,0xE405,
-	0xE405,0xE405,0xE405,0xE426,0xEC66,0xECA6,0xF4C7,0xF4E8,
-	0xF549,0xF56B,0xF5CC,0xF62E,0xF66F,0xF672,0xF694,0xF695,
-	0xF6B6,0xF6B6,0xFED7,0xF6F8,0xF6F8,0xFED7,0xF696,0xF611,
-	0xF58C,0xF569,0xED87,0xF587,0xED66,0xED46,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xED27,0xF527,0x8C0E,0x2B36,
-	0x12F9,0x12F9,0x12F9,0x1319,0x1318,0x12D6,0x0A52,0x0210,
-	0x0A53,0x0A56,0x0235,0x01D5,0x0197,0x01B8,0x0A39,0x12B9,
-	0x12D9,0x63B2,0xD4C8,0xE4E4,0xDCA3,0xE484,0xF4E6,0xF508,
-	0xFD28,0xFD28,0xF528,0xF549,0xF56B,0xEDAD,0xEDAE,0xEDAE,
-	0xED6E,0xED4E,0xED4E,0xED4D,0xED4D,0xED2D,0x8C2F,0x12B2,
-	0x0AB2,0x0A92,0x0A73,0x0254,0x0255,0x0295,0x0AD6,0x0AF7,
-	0x0AF7,0x0AB5,0x0A30,0x4331,0xED07,0xECA5,0xECC4,0xE4E5,
-	0xED24,0xED84,0xF565,0xF506,0xF4A6,0xF486,0xEC86,0xF466,
-	0xEC46,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xE4C8,0xED09,
-	0x8101,0x8121,0x8121,0x8121,0x8121,0x8121,0x8921,0x9121,
-	0x9941,0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,0x9961,
-	0x9961,0xA141,0x9961,0xA161,0xA161,0xA181,0xA181,0xA161,
-	0xA162,0xA181,0xA181,0x0000,0x0000,0x0000,0x2860,0xA1A1,
-	0xA9C1,0xA9C1,0xA9E1,0xA9C1,0x2880,0x0000,0x0000,0x0000,
-	0xBA22,0xBA42,0xC262,0xC282,0x91E2,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCAE2,0xCB02,0xCB02,0xCB22,0xCB42,0xCB62,
-	0xD3A2,0xD3E2,0xDC22,0xDC62,0xDC62,0xDC42,0xD3C2,0xCB62,
-	0xCB42,0xCB22,0xCB02,0xCB02,0xCB02,0xCB02,0xCB22,0xCB22,
-	0xCB02,0xCB03,0xCB02,0xCB02,0xCB03,0xC302,0xC2E3,0xC2C3,
-	0xC2A3,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCAE4,0xD304,
-	0xD324,0xD324,0xD344,0xD364,0xD364,0xD384,0xD384,0xD384,
-	0xD3A4,0xD3C4,0xD3C3,0xD3C3,0xD3C3,0xD383,0xD383,0xD383,
-	0xD383,0xCB63,0xD363,0xD363,0xD364,0xD364,0xD384,0xDB85,
-	0xDB85,0xDB85,0xDBA5,0xDBC5,0xDC05,0xDC24,0xE444,0xDC64,
-	0xDC64,0xE444,0xDC04,0x2BF9,0xA40C,0xDC05,0xE405,0xE405,
-	0xE405,0xE405,0xE405,0xE425,0xE466,0xECA6,0xECC7,0xECE7,
-	0xF529,0xD50C,0x7BEF,0xF60D,0xF66E,0xF671,0xFE73,0xF675,
-	0xF696,0xF696,0xFEB6,0xF6D7,0xF6F8,0xFEF8,0xF6B7,0xF653,
-	0xF5AE,0xF58A,0xED68,0xF587,0xED66,0xED46,0xED27,0xED26,
-	0xED26,0xED26,0xED26,0xED26,0xC4CA,0x3B35,0x0AD8,0x12D8,
-	0x12F9,0x12F9,0x12F9,0x1319,0x1319,0x12D6,0x0A72,0x0A30,
-	0x0A53,0x0A56,0x0215,0x01D5,0x0197,0x01B8,0x0A39,0x12B9,
-	0x12D9,0x0AB9,0x1AF8,0x8C0E,0xDCA3,0xE4A5,0xF4C6,0xF508,
-	0xFD28,0xFD28,0xFD28,0xF548,0xF56A,0xEDAC,0xEDAE,0xEDAE,
-	0xED8E,0xED6E,0xED4E,0xED4D,0xED2D,0xED4D,0xD4EE,0x12B2,
-	0x0A92,0x0A92,0x0A73,0x0254,0x0255,0x0295,0x0AD6,0x02F7,
-	0x0AF7,0x0A94,0x0A30,0x4B51,0xE4E6,0xECA4,0xECC4,0xE4E5,
-	0xED25,0xED84,0xF565,0xED06,0xF4A6,0xF486,0xF486,0xEC66,
-	0xEC46,0xE425,0xE425,0xE425,0xE466,0xE4A7,0xECE8,0xED09,
-	0x8101,0x8121,0x8121,0x8120,0x8921,0x8121,0x9121,0x9141,
-	0x9941,0x9941,0x9941,0x9941,0x9961,0x9960,0x9961,0x9961,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA181,0xA181,0xA162,
-	0xA161,0xA181,0xA181,0x0000,0x0000,0x0000,0x2860,0xA9A2,
-	0xA9A1,0xA9C1,0xB1C2,0xA9E1,0x2860,0x0000,0x0000,0x0000,
-	0xBA02,0xBA22,0xBA62,0xC282,0x91E2,0x0000,0x0000,0x0000,
-	0x6161,0xCAE3,0xCAE2,0xCAE2,0xCB02,0xCB22,0xCB22,0xCB42,
-	0xCB62,0xD3A2,0xD3E2,0xD422,0xDC62,0xDC62,0xDC22,0xD3C2,
-	0xCB82,0xCB42,0xCB02,0xCB02,0xCB02,0xCB02,0xCB02,0xCB22,
-	0xCB23,0xCB03,0xCB03,0xCB03,0xCB03,0xCB03,0xC2E3,0xC2C3,
-	0xC2A3,0xC283,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCB03,0xCB04,
-	0xD324,0xD324,0xD344,0xD364,0xD364,0xD384,0xDB84,0xDB84,
-	0xDBA4,0xD3A4,0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD383,0xD383,
-	0xD383,0xCB63,0xD363,0xD363,0xD364,0xD364,0xD384,0xDB85,
-	0xDB85,0xDB85,0xDBA5,0xDBC5,0xDBE5,0xDC24,0xE444,0xE444,
-	0xDC44,0xE444,0xDC04,0x1BFB,0x23FA,0x5BF4,0xD406,0xE405,
-	0xDC05,0xE405,0xE405,0xE425,0xEC46,0xEC86,0xECA7,0xECE7,
-	0x8C0F,0x1AD5,0x4332,0xF60C,0xF64E,0xF670,0xF672,0xF674,
-	0xF695,0xF6B6,0xF6B6,0xF6D7,0xFED8,0xF6F8,0xF6D7,0xF675,
-	0xF5F0,0xF58B,0xF588,0xF587,0xED66,0xED46,0xED27,0xED47,
-	0xED27,0xED26,0xED27,0x9C4D,0x12D8,0x0AD8,0x0AD8,0x12D9,
-	0x12F8,0x12F9,0x12F9,0x1319,0x12F9,0x12D6,0x0A52,0x0A30,
-	0x0A53,0x0A56,0x0235,0x01D5,0x01B6,0x01B8,0x0A39,0x12B9,
-	0x12D9,0x0AB9,0x12D9,0x1B1B,0x5BB4,0xD486,0xF4E6,0xFD08,
-	0xFD28,0xFD28,0xFD27,0xF549,0xF56A,0xEDAC,0xEDAE,0xEDAE,
-	0xED8E,0xED6E,0xED4E,0xED4D,0xED2D,0xED2D,0xED4D,0x7BEF,
-	0x0AB2,0x0A92,0x0A53,0x0253,0x0254,0x0295,0x02D6,0x0AF7,
-	0x0AF7,0x0A73,0x0A30,0x4352,0xE4C6,0xECC5,0xE4C5,0xE4E5,
-	0xED45,0xED84,0xF545,0xF506,0xF4A6,0xF487,0xF466,0xEC46,
-	0xEC45,0xE425,0xE425,0xE425,0xE466,0xE4A7,0xECE8,0xED09,
-	0x8101,0x8121,0x8120,0x8920,0x8941,0x8921,0x9141,0x9961,
-	0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,0xA161,0xA161,
-	0xA161,0xA161,0xA162,0xA161,0xA181,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0x0000,0x0000,0x0000,0x2860,0xA9A2,
-	0xA9A1,0xA9A1,0xA9C1,0xA9C1,0x2860,0x0000,0x0000,0x0000,
-	0xBA22,0xBA22,0xBA42,0xC262,0x91E2,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCAE2,0xCAE2,0xCB02,0xCB22,0xCB22,0xCB42,
-	0xCB42,0xCB62,0xD3C2,0xD402,0xDC42,0xDC61,0xDC62,0xD422,
-	0xD3C2,0xCB62,0xCB42,0xCB22,0xCB22,0xCB02,0xCB02,0xCB22,
-	0xCB23,0xCB23,0xCB03,0xCB03,0xCB02,0xCB02,0xCB02,0xC2E3,
-	0xC2C3,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,0xCAE4,0xCB04,
-	0xD304,0xD324,0xD344,0xD344,0xD364,0xD364,0xDB84,0xDB84,
-	0xDBA4,0xD3A4,0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xD383,0xD383,
-	0xD383,0xCB63,0xCB63,0xCB63,0xD363,0xD364,0xD384,0xDB84,
-	0xDBA5,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xDC05,0xDC44,0xDC64,
-	0xDC64,0xE444,0xDC24,0x23FB,0x23FB,0x23FA,0x2BF9,0xA40B,
-	0xDC25,0xDC05,0xE405,0xE425,0xE446,0xEC86,0xD469,0x4B94,
-	0x12F7,0x0AB6,0x4332,0xF60C,0xF64D,0xF66F,0xF672,0xF674,
-	0xF695,0xF696,0xF6B6,0xF6D7,0xF6D7,0xF6D8,0xFED7,0xFE96,
-	0xF612,0xF5AC,0xF588,0xF587,0xED67,0xED46,0xED27,0xED27,
-	0xED27,0xED26,0x9C4D,0x12D8,0x12D8,0x0AD8,0x0AD8,0x12D8,
-	0x12F9,0x12F9,0x12F9,0x1319,0x12F9,0x12B6,0x0A52,0x0A30,
-	0x0A53,0x0256,0x0235,0x01D5,0x0996,0x01B7,0x0A39,0x12B9,
-	0x12D9,0x0AB8,0x12BA,0x1B1B,0x235C,0x4396,0xE4C7,0xFD07,
-	0xFD28,0xFD48,0xFD27,0xF528,0xF56A,0xED8C,0xEDCD,0xEDAE,
-	0xED8E,0xED4E,0xED4E,0xED4E,0xED2D,0xED2D,0xED4D,0xED4D,
-	0x7C0F,0x0A92,0x0253,0x0233,0x0255,0x0295,0x02D6,0x0AF7,
-	0x0AF7,0x0A72,0x0A30,0x4B52,0xECA5,0xECA5,0xE4A5,0xE4E5,
-	0xED44,0xED84,0xF545,0xF4E6,0xF4A7,0xF487,0xF466,0xEC46,
-	0xEC45,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xE4E8,0xED09,
-	0x8101,0x8121,0x8921,0x8941,0x8941,0x9141,0x9941,0x9941,
-	0x9961,0x9961,0x9941,0x9961,0x9961,0x9961,0xA161,0xA161,
-	0xA161,0xA181,0xA161,0xA161,0xA161,0xA181,0xA181,0xA181,
-	0xA182,0xA181,0xA181,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA9A2,0xA9A2,0xA9A1,0xA9A1,0x2860,0x0000,0x0000,0x0000,
-	0xB202,0xBA22,0xBA22,0xBA62,0x91E2,0x0000,0x0000,0x0000,
-	0x6161,0xCAE2,0xCAE2,0xCB02,0xCB02,0xCB02,0xCB22,0xCB42,
-	0xCB42,0xCB62,0xCB82,0xCBA2,0xD402,0xDC42,0xDC62,0xDC42,
-	0xD402,0xD3C2,0xCB62,0xCB42,0xCB22,0xCB22,0xCB22,0xCB22,
-	0xCB22,0xCB22,0xCB23,0xCB23,0xCB22,0xCB22,0xCB03,0xC2E3,
-	0xC2C3,0xC2A3,0xC2A3,0xC2C3,0xC2C3,0xCAC3,0xCAE3,0xCB04,
-	0xD304,0xD324,0xD344,0xD344,0xD364,0xD364,0xDB84,0xDB84,
-	0xDBA4,0xDBA4,0xD3C4,0xD3C3,0xD3C3,0xD3A3,0xD383,0xD383,
-	0xD383,0xD363,0xD363,0xCB63,0xD363,0xD364,0xD384,0xD384,
-	0xDB85,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xDC05,0xDC44,0xE444,
-	0xDC64,0xDC44,0xDC24,0x1BFB,0x23FB,0x23FA,0x23FA,0x23FA,
-	0x6BF2,0xD406,0xE405,0xE425,0xE446,0x8C0E,0x2377,0x0B38,
-	0x0B17,0x0AD6,0x4332,0xF5EB,0xF62C,0xF66E,0xF671,0xF653,
-	0xF675,0xF695,0xF6B6,0xF6B7,0xF6D7,0xFED8,0xFEF8,0xFED7,
-	0xF653,0xF5CE,0xF589,0xED87,0xF567,0xF547,0xED26,0xED27,
-	0xED27,0xB48B,0x12D9,0x12D9,0x12D8,0x0AD8,0x0AD8,0x12D8,
-	0x12D8,0x12F9,0x12F8,0x12F9,0x12F8,0x0AD6,0x0A52,0x0A30,
-	0x0A73,0x0256,0x0235,0x01D6,0x01B6,0x01B7,0x0A39,0x12B9,
-	0x12D9,0x12B8,0x12DA,0x1B1B,0x235B,0x1B5B,0x53B3,0xFD07,
-	0xFD28,0xFD48,0xFD27,0xF528,0xF54A,0xF58C,0xEDCD,0xEDAF,
-	0xED8E,0xED6E,0xED4E,0xED4D,0xED4D,0xED4D,0xED4D,0xED4D,
-	0xF56D,0xDD2E,0x8C2F,0x6391,0x4332,0x4352,0x4373,0x4373,
-	0x4373,0x4331,0x4330,0x73D0,0xECA5,0xE4A5,0xE4C4,0xED04,
-	0xED64,0xED84,0xF545,0xF4E6,0xF4A7,0xF467,0xF466,0xEC46,
-	0xE445,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xE4E8,0xED09,
-	0x8101,0x8120,0x8921,0x8921,0x9141,0x9961,0x9941,0x9961,
-	0x9961,0x9961,0x9941,0x9961,0x9961,0xA161,0x9960,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA161,0xA181,0xA181,0xA182,
-	0xA181,0xA181,0xA181,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA981,0xA9A2,0xA9A1,0xA9A1,0x2860,0x0000,0x0000,0x0000,
-	0xB202,0xBA02,0xBA22,0xBA62,0x91E2,0x0000,0x0000,0x0000,
-	0x6961,0xCAE2,0xCB03,0xCB02,0xCB02,0xCB23,0xCB22,0xCB42,
-	0xCB42,0xCB62,0xCB62,0xCB82,0xD3C2,0xD402,0xDC42,0xDC42,
-	0xDC42,0xDC02,0xD3A2,0xCB62,0xCB42,0xCB22,0xCB22,0xCB42,
-	0xCB23,0xCB23,0xCB22,0xCB23,0xCB23,0xCB22,0xCB22,0xC302,
-	0xC2C3,0xC2C3,0xC2A3,0xC2C3,0xC2C3,0xCAC3,0xCAE3,0xCB04,
-	0xD304,0xD324,0xD324,0xD344,0xD364,0xD364,0xDB84,0xDB84,
-	0xDB84,0xDBA4,0xD3A4,0xD3C4,0xD3C4,0xD3C4,0xD3A3,0xD383,
-	0xD383,0xD383,0xD363,0xCB63,0xD363,0xD364,0xD384,0xD384,
-	0xDB85,0xDB85,0xDBA5,0xDBC5,0xDBE5,0xDC05,0xE425,0xE444,
-	0xDC45,0xE444,0xE444,0x2BF9,0x23FB,0x23FA,0x23FB,0x23FA,
-	0x23FA,0x3BF8,0xAC0A,0xCC08,0x4BF5,0x1399,0x1359,0x0B38,
-	0x0B18,0x0AD6,0x4353,0xF5CA,0xF62B,0xF64D,0xF650,0xF652,
-	0xF654,0xF695,0xF6B5,0xF6B6,0xFEB7,0xF6D7,0xF6D8,0xFED7,
-	0xF675,0xF611,0xF5AB,0xF588,0xF567,0xF547,0xED27,0xED27,
-	0xE508,0x22F8,0x12D9,0x12D8,0x12D8,0x0AD8,0x0AD8,0x12D8,
-	0x12D8,0x12F9,0x12F9,0x1319,0x4B74,0x5392,0x7BEF,0x8410,
-	0x7BEF,0x7BEF,0x7BF0,0x42F3,0x3294,0x09B8,0x0A39,0x12B9,
-	0x12D9,0x1298,0x12BA,0x1B1B,0x233B,0x1B5A,0x0B19,0x8C2E,
-	0xFD28,0xFD48,0xFD27,0xF528,0xF54A,0xF58C,0xEDAD,0xEDAF,
-	0xED8F,0xED6F,0xED6E,0xED4D,0xED4D,0xED4D,0xED4D,0xED4D,
-	0xF56D,0xF58D,0xF5CD,0xFDCC,0xFDAB,0xFD6A,0xFD29,0xF508,
-	0xF529,0xF5CE,0xF5AE,0xED08,0xECA5,0xECC5,0xE4C5,0xED05,
-	0xED64,0xED84,0xF526,0xF4E6,0xF4A7,0xF487,0xF466,0xEC46,
-	0xE425,0xE425,0xE425,0xE445,0xE466,0xE4A7,0xECE8,0xED09,
-	0x8121,0x8921,0x8921,0x8921,0x9161,0x9961,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0x9961,0xA161,0xA161,0xA181,0xA181,
-	0xA161,0xA161,0xA161,0xA181,0xA181,0xA181,0xA182,0xA182,
-	0xA181,0xA181,0xA9A1,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA981,0xA9A1,0xA982,0xA9A2,0x2860,0x0000,0x0000,0x0000,
-	0xB202,0xBA02,0xBA22,0xBA42,0x91C2,0x0000,0x0000,0x0000,
-	0x6141,0xCAE2,0xCAE3,0xCB03,0xCB03,0xCB22,0xCB22,0xCB42,
-	0xCB42,0xD362,0xD362,0xCB62,0xCBA2,0xD3C2,0xD402,0xDC42,
-	0xDC62,0xDC42,0xD402,0xD3A2,0xCB62,0xCB42,0xCB22,0xCB22,
-	0xCB22,0xCB42,0xD323,0xCB22,0xCB22,0xCB22,0xCB22,0xCB23,
-	0xC2E3,0xC2C3,0xC2A3,0xC2C3,0xC2C3,0xCAC3,0xCAE3,0xCB04,
-	0xCB03,0xD324,0xD324,0xD324,0xD344,0xD364,0xD384,0xD384,
-	0xDB84,0xD384,0xD3A4,0xD3C4,0xD3C4,0xD3C4,0xD3A3,0xD383,
-	0xD383,0xD383,0xD363,0xD364,0xD364,0xD364,0xD364,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBC5,0xDBC5,0xE405,0xDC25,0xE444,
-	0xE464,0xE445,0xDC24,0xCC05,0x73F1,0x1BFA,0x1BFA,0x23FB,
-	0x1BFA,0x241B,0x241A,0x23F9,0x1BDA,0x13B9,0x1359,0x1338,
-	0x0B17,0x2B35,0xAC6D,0xF5AA,0xF60B,0xF64D,0xF64F,0xF651,
-	0xF653,0xF695,0xF695,0xF6B6,0xF6B7,0xF6B7,0xFED8,0xFED8,
-	0xF696,0xF632,0xF5CD,0xF588,0xF567,0xED47,0xED47,0xED27,
-	0x63B2,0x12D8,0x12D9,0x12D8,0x12D8,0x0AD8,0x0AD8,0x12D8,
-	0x22F8,0x63B2,0xB48B,0xED06,0xED06,0xED29,0xF58C,0xF5CF,
-	0xF58C,0xF589,0xFDCA,0xFE2A,0xFE69,0xEDE9,0x9C6E,0x4B74,
-	0x12D9,0x0A99,0x12BA,0x1AFB,0x233C,0x1B3B,0x0B19,0x12F6,
-	0xED09,0xFD48,0xFD27,0xF528,0xF549,0xD52C,0xB4EE,0x7BEF,
-	0x638F,0x4B30,0xED4E,0xED4E,0xED4D,0xED4D,0xED4D,0xF56D,
-	0xF56E,0xF58D,0xF5CD,0xFDEC,0xFDAC,0xFD6A,0xFD29,0xF508,
-	0xF54A,0xF5CE,0xEDAD,0xECE7,0xECA5,0xECA5,0xE4C4,0xED04,
-	0xED64,0xED65,0xF525,0xF4C6,0xF4A6,0xF486,0xF466,0xEC46,
-	0xE425,0xE424,0xE424,0xE445,0xE466,0xE4A7,0xECE8,0xED09,
-	0x8921,0x8921,0x8921,0x9141,0x9961,0x9961,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0xA161,0xA181,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA182,0xA181,0xA181,0xA181,
-	0xA982,0xA181,0xA982,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA981,0xA981,0xA9A2,0xA981,0x2860,0x0000,0x0000,0x0000,
-	0xB1E2,0xB202,0xBA02,0xBA22,0x89C2,0x0000,0x0000,0x0000,
-	0x6161,0xCAE3,0xD2E3,0xD303,0xCB03,0xCB23,0xD323,0xCB42,
-	0xCB42,0xD362,0xCB62,0xCB62,0xCB82,0xCBA2,0xD3C2,0xD402,
-	0xDC43,0xDC42,0xDC42,0xD402,0xD3A2,0xCB62,0xCB42,0xCB42,
-	0xCB22,0xCB42,0xCB43,0xCB23,0xCB43,0xCB43,0xCB42,0xCB22,
-	0xC302,0xC2E3,0xC2C3,0xC2C3,0xC2C3,0xCAC3,0xCAC3,0xCAE3,
-	0xCB03,0xD324,0xD324,0xD324,0xD344,0xD364,0xD384,0xD384,
-	0xD384,0xD384,0xD3A4,0xD3C4,0xD3C4,0xD3C4,0xD3C3,0xD3A3,
-	0xD383,0xD383,0xD363,0xD364,0xD364,0xD364,0xD364,0xD384,
-	0xD384,0xDB85,0xDBA5,0xDBC5,0xDBC5,0xE3E5,0xE405,0xE444,
-	0xDC64,0xE445,0xDC24,0xDC25,0xE405,0xCC08,0x4BF5,0x23FB,
-	0x23FA,0x241A,0x241A,0x1BFA,0x1BDA,0x1BB9,0x1379,0x1B57,
-	0x9C2D,0xF508,0xF549,0xF5A9,0xF5EA,0xF64C,0xF64E,0xF631,
-	0xF653,0xF674,0xF695,0xF696,0xF6B7,0xF6B7,0xFED8,0xFED8,
-	0xFEB6,0xFE74,0xF5EF,0xF5A9,0xF567,0xED67,0xED47,0xD4E9,
-	0x12D8,0x12D9,0x12D9,0x12D8,0x12D8,0x0AD8,0x0AD8,0x4B74,
-	0xD4E9,0xED06,0xED06,0xECE6,0xED06,0xED28,0xF58C,0xF5CF,
-	0xF58C,0xFDA9,0xFDCA,0xFE2A,0xFE49,0xF648,0xF5C6,0xED46,
-	0x8C2E,0x1AD8,0x12BA,0x1AFB,0x233C,0x1B3A,0x0AF9,0x0AD7,
-	0x7BEF,0xFD48,0xF547,0xF528,0xED49,0x83F0,0x1232,0x1231,
-	0x1250,0x1271,0xED4E,0xED4E,0xED4D,0xED4D,0xED4D,0xED4D,
-	0xF58D,0xF5AD,0xF5CD,0xF5EC,0xFDAC,0xFD6B,0xFD29,0xFD29,
-	0xF54B,0xF5CE,0xED8C,0xECC6,0xECA5,0xECC5,0xE4C4,0xED24,
-	0xED64,0xF565,0xF506,0xF4C7,0xF4A6,0xF486,0xF466,0xEC66,
-	0xE425,0xE424,0xE424,0xE445,0xE466,0xE4C7,0xECE8,0xED09,
-	0x8921,0x8921,0x9121,0x9941,0x9961,0x9961,0x9961,0x9961,
-	0x9961,0x9961,0x9961,0xA161,0xA161,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA981,0xA181,0xA982,0xA982,
-	0xA982,0xA181,0xA9A2,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA981,0xA981,0xA982,0xA9A2,0x2860,0x0000,0x0000,0x0000,
-	0xB1E2,0xB1E2,0xBA02,0xBA22,0x89A2,0x0000,0x0000,0x0000,
-	0x6141,0xCAC2,0xCAE3,0xCAE3,0xCB23,0xD322,0xD323,0xCB42,
-	0xCB42,0xD362,0xD362,0xCB62,0xCB82,0xCB82,0xCBA2,0xD3C2,
-	0xD3E2,0xDC22,0xDC42,0xDC22,0xD3E2,0xD382,0xCB62,0xCB42,
-	0xCB22,0xCB42,0xCB43,0xCB23,0xCB43,0xCB43,0xCB42,0xCB22,
-	0xCB03,0xC2E3,0xC2C3,0xC2A3,0xC2C3,0xC2C3,0xCAC3,0xCAE3,
-	0xCB04,0xD324,0xD324,0xD324,0xD344,0xD364,0xD384,0xD384,
-	0xD384,0xD384,0xD3A4,0xD3C4,0xD3C4,0xD3C4,0xD3C3,0xD3A3,
-	0xD383,0xD383,0xCB83,0xD363,0xD364,0xD364,0xD364,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBA5,0xDBC5,0xDBE5,0xE405,0xE444,
-	0xDC64,0xE445,0xDC25,0xDC24,0xDC04,0xE405,0xDC05,0x73F1,
-	0x1BFA,0x241B,0x241A,0x1BFA,0x1BDA,0x1BB9,0x3BB5,0xDC88,
-	0xF4C7,0xF508,0xF549,0xF589,0xF5EA,0xF62B,0xF62D,0xF630,
-	0xF632,0xF674,0xF695,0xF696,0xF6B7,0xF6B7,0xFED8,0xFED7,
-	0xFED7,0xF696,0xF632,0xF5CB,0xF567,0xED47,0xED47,0x7BEF,
-	0x12D8,0x12D9,0x12D9,0x12D8,0x12D8,0x12D8,0x63B2,0xED26,
-	0xED26,0xED26,0xED06,0xED06,0xED06,0xED28,0xF58C,0xF5CE,
-	0xF58C,0xFDA9,0xFDEA,0xFE09,0xFE49,0xFE48,0xF5C7,0xED46,
-	0xED26,0xC4CA,0x22F8,0x1B1B,0x233C,0x1B1B,0x0AF9,0x02D7,
-	0x12D6,0xFD48,0xF528,0xF527,0xF549,0x7BEF,0x1252,0x1230,
-	0x1270,0x1270,0xED6E,0xED4E,0xED4D,0xED4D,0xED4D,0xED6E,
-	0xF58E,0xF5AE,0xFDCD,0xFDEC,0xFDAC,0xFD6B,0xFD2A,0xF529,
-	0xF56C,0xF5CE,0xF56B,0xECC6,0xECA5,0xECC5,0xECC4,0xED24,
-	0xED84,0xF585,0xF506,0xF4C7,0xF4A7,0xF486,0xF466,0xEC46,
-	0xE425,0xE424,0xE425,0xE445,0xE466,0xE4C7,0xECE8,0xED29,
-	0x8921,0x8920,0x9941,0x9941,0x9941,0x9961,0x9961,0xA161,
-	0xA161,0xA181,0x9961,0x9961,0xA161,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA9A1,0xA181,0xA181,0xA9A2,0xA9A1,
-	0xA981,0xA981,0xA9A2,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA9A2,0xA9A2,0xA981,0xA9A2,0x2860,0x0000,0x0000,0x0000,
-	0xB1C2,0xB1E2,0xB1E2,0xBA02,0x89A2,0x0000,0x0000,0x0000,
-	0x6141,0xCAC3,0xCAE2,0xCAE3,0xCB03,0xCB03,0xCB23,0xCB42,
-	0xCB42,0xCB42,0xD362,0xCB62,0xD362,0xD382,0xCB82,0xCB82,
-	0xD3C2,0xD402,0xDC42,0xDC42,0xDC22,0xD3E2,0xD382,0xCB42,
-	0xCB42,0xCB42,0xCB23,0xCB23,0xCB23,0xCB23,0xCB42,0xCB22,
-	0xCB03,0xCB02,0xC2E3,0xC2A3,0xC2A3,0xC2C3,0xCAC3,0xCAE3,
-	0xCB04,0xD304,0xD324,0xD324,0xD344,0xD364,0xD384,0xD384,
-	0xD384,0xD384,0xDBA4,0xD3C4,0xD3C4,0xD3C4,0xD3C4,0xD3A3,
-	0xD3A3,0xD383,0xD383,0xD383,0xD383,0xD363,0xD364,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBC5,0xDBC5,0xDBE5,0xE405,0xE444,
-	0xDC64,0xE444,0xE444,0xDC24,0xE405,0xD406,0x63F2,0x23FB,
-	0x23FA,0x241B,0x1C1A,0x1BFA,0x1BFA,0x1BB9,0x1379,0x2B96,
-	0xB46B,0xECE8,0xF529,0xF589,0xF5E9,0xF62A,0xF62C,0xF62F,
-	0xF632,0xF653,0xF675,0xF696,0xF6B6,0xF6B7,0xFEB7,0xFED7,
-	0xFED7,0xFEB6,0xF673,0xF5ED,0xF5A8,0xF566,0xED47,0x2B16,
-	0x12D8,0x12D9,0x12D9,0x12D8,0x0AD8,0x2B16,0xE508,0xED27,
-	0xED26,0xED26,0xED06,0xED06,0xED06,0xED28,0xF58C,0xF5CE,
-	0xF58B,0xFDA9,0xFDCA,0xFE29,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xF546,0xF567,0x8C2E,0x1AFB,0x233C,0x12FA,0x0AF9,0x0AD7,
-	0x0AB7,0xAC6D,0xF527,0xF527,0xED48,0x7BEF,0x1232,0x1230,
-	0x124F,0x1270,0xED4E,0xED4E,0xED4E,0xED4D,0xED4D,0xED6E,
-	0xF58E,0xF5AE,0xF5ED,0xFDEC,0xFDAC,0xFD6B,0xFD49,0xF529,
-	0xF56C,0xF5AE,0xED4A,0xECA6,0xECA5,0xECC5,0xE4C4,0xED24,
-	0xED84,0xF565,0xF506,0xF4C7,0xF4A7,0xF486,0xF466,0xEC46,
-	0xE425,0xE424,0xE425,0xE445,0xE486,0xE4A7,0xECE8,0xED09,
-	0x8920,0x9121,0x9941,0x9941,0x9941,0x9961,0x9961,0xA160,
-	0xA181,0xA161,0xA161,0xA161,0xA161,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA982,0xA981,0xA9A1,0xA9A1,0xA9A2,
-	0xA9A2,0xA981,0xA9A2,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A2,0xA982,0x2860,0x0000,0x0000,0x0000,
-	0xB1C2,0xB1C2,0xB1E2,0xBA02,0x89A2,0x0000,0x0000,0x0000,
-	0x6141,0xCAA3,0xCAC3,0xCAE3,0xCB03,0xCB03,0xCB23,0xCB23,
-	0xCB42,0xD342,0xD362,0xD362,0xD362,0xCB82,0xCB82,0xCB62,
-	0xCB82,0xD3C2,0xDC02,0xDC42,0xDC42,0xDC02,0xD3A2,0xD362,
-	0xCB42,0xCB42,0xCB42,0xCB23,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xCB22,0xCB02,0xC2E3,0xC2C3,0xC2C3,0xC2C4,0xC2C3,0xCAE3,
-	0xCB03,0xCB04,0xD324,0xD324,0xD344,0xD364,0xD384,0xD384,
-	0xD384,0xD384,0xD3A4,0xD3A4,0xD3C4,0xD3C4,0xD3C3,0xD3A3,
-	0xD3A3,0xD383,0xD383,0xD383,0xD383,0xD363,0xD384,0xD384,
-	0xDB84,0xDBA5,0xDBA5,0xDBA5,0xE3C5,0xE3E5,0xE405,0xE444,
-	0xDC64,0xE444,0xE444,0xDC24,0x940D,0x2BF9,0x1BFA,0x23FB,
-	0x23FA,0x241B,0x1C1A,0x1C1A,0x1BFA,0x1BDA,0x1399,0x1358,
-	0x1338,0x5392,0xD4CA,0xF568,0xF5C9,0xF60A,0xF62B,0xF60E,
-	0xF611,0xF633,0xF674,0xF695,0xF6B6,0xF6B7,0xFEB7,0xFED7,
-	0xFED8,0xFED6,0xF694,0xF60F,0xEDA9,0xED66,0xD4E9,0x12D8,
-	0x12D9,0x12D9,0x12F9,0x12D9,0x0AD8,0xAC6C,0xF527,0xED27,
-	0xED27,0xED26,0xED06,0xED06,0xED06,0xED29,0xF58C,0xF5CE,
-	0xF58C,0xF5A9,0xFDCA,0xFE2A,0xFE29,0xFE28,0xF5C7,0xED46,
-	0xED27,0xF547,0xED46,0x3338,0x1B3B,0x1B1A,0x0AF9,0x02B7,
-	0x02B7,0x73D0,0xF527,0xF527,0xED48,0x7BEF,0x1232,0x1230,
-	0x1250,0x1270,0xED6E,0xED6E,0xED4E,0xED4E,0xED4E,0xED6E,
-	0xF58D,0xF5AD,0xFDED,0xFDEC,0xFDAC,0xFD6B,0xFD49,0xF529,
-	0xF58D,0xF58D,0xED29,0xECA5,0xECA5,0xECC5,0xE4E4,0xED44,
-	0xED84,0xF565,0xF506,0xF4C7,0xF4A7,0xF486,0xF466,0xEC46,
-	0xE425,0xE424,0xE425,0xE445,0xE486,0xE4A7,0xECE8,0xED29,
-	0x8921,0x9941,0x9961,0x9941,0x9941,0x9961,0xA161,0xA161,
-	0xA161,0xA161,0xA161,0xA161,0xA181,0xA181,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA9A1,0xA981,0xA9A1,0xA9A1,0xA9A2,
-	0xA9A2,0xA981,0xA982,0x0000,0x0000,0x0000,0x2860,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A1,0xA982,0x68E1,0x50C1,0x50C1,0x58C1,
-	0xB1C2,0xB1C2,0xB1C2,0xB9E2,0x8982,0x0000,0x0000,0x0000,
-	0x6142,0xCAA3,0xCAE3,0xCAE3,0xCAE3,0xCB03,0xCB03,0xD323,
-	0xCB42,0xD342,0xD362,0xD362,0xD362,0xCB82,0xCB82,0xCB62,
-	0xCB62,0xCBA2,0xD3C2,0xD402,0xDC22,0xDC22,0xDC03,0xD3A2,
-	0xD362,0xCB42,0xD342,0xCB42,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xCB22,0xCB22,0xC303,0xC2E3,0xC2C3,0xC2C3,0xC2C3,0xCAE3,
-	0xCB03,0xCB04,0xD304,0xD324,0xD344,0xD344,0xD364,0xD384,
-	0xDB84,0xD384,0xD384,0xD3A4,0xD3A4,0xD3C4,0xD3C4,0xD3A3,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xD383,0xD363,0xD384,0xD384,
-	0xDB84,0xDBA5,0xDBA5,0xDBA5,0xE3C5,0xE3E5,0xE404,0xE444,
-	0xE464,0xE464,0xE444,0x53F5,0x23FB,0x1BFA,0x1BFA,0x23FB,
-	0x23FA,0x241B,0x7C0F,0xC408,0x43F6,0x1BDA,0x1399,0x1378,
-	0x1358,0x0B17,0x4373,0xF568,0xF5C8,0xF609,0xF62B,0xF60D,
-	0xF610,0xF632,0xF654,0xF695,0xF696,0xF6B7,0xF6B7,0xF6D7,
-	0xFED8,0xFED7,0xFE95,0xFE51,0xF5CB,0xED86,0xB4AB,0x12D8,
-	0x12D8,0x12D9,0x12D9,0x12D9,0x2B16,0xF527,0xF527,0xED27,
-	0xED27,0xED26,0xED06,0xED06,0xED06,0xED28,0xF58C,0xF5CE,
-	0xF58C,0xF5A9,0xFDCA,0xFE2A,0xFE29,0xFE28,0xF5C7,0xED46,
-	0xED27,0xF567,0xED46,0x8C2E,0x1B1B,0x1B1A,0x0AF9,0x02D7,
-	0x02B7,0x4353,0xF547,0xF527,0xED48,0x7BEF,0x1232,0x1230,
-	0x1250,0x1270,0xED6E,0xED6E,0xED4E,0xED4D,0xED4E,0xED6E,
-	0xF58E,0xF5AE,0xFDED,0xF5EC,0xFDAC,0xFD6B,0xFD49,0xF54A,
-	0xF58D,0xF58D,0xECE8,0xECA5,0xECA5,0xECA5,0xE4E4,0xED44,
-	0xF584,0xF565,0xF506,0xF4A7,0xF4A7,0xF487,0xEC66,0xEC46,
-	0xE425,0xE424,0xE425,0xE445,0xE486,0xE4C6,0xECE8,0xED09,
-	0x9141,0x9941,0x9941,0x9941,0x9961,0xA161,0xA161,0xA161,
-	0xA181,0xA181,0xA161,0xA181,0xA181,0xA181,0xA1A1,0xA1A1,
-	0xA1A1,0xA1A1,0xA1A1,0xA9A1,0xA981,0xA9A2,0xA9A2,0xA9A2,
-	0xA9A2,0xA9A2,0xA982,0x2860,0x2860,0x2860,0x48C1,0xA9C1,
-	0xA9C1,0xA9A1,0xA9A1,0xA9A1,0xA982,0xA9A2,0xB182,0xB1A2,
-	0xB1C2,0xB1C2,0xB1C2,0xB1E2,0xA9E2,0x8982,0x91A2,0x91C2,
-	0xAA23,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xCAE3,0xCB03,0xD323,
-	0xD323,0xD342,0xD362,0xD362,0xCB82,0xD382,0xD382,0xCB62,
-	0xCB62,0xCB62,0xCBA2,0xD3C2,0xDC02,0xDC42,0xD422,0xD402,
-	0xD382,0xD362,0xD342,0xCB42,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xCB42,0xCB22,0xCB03,0xC2E3,0xC2C3,0xC2A3,0xC2C3,0xCAE3,
-	0xCB04,0xCB04,0xCB04,0xD324,0xD344,0xD344,0xD364,0xD384,
-	0xDB85,0xD384,0xD384,0xDBA4,0xDBC4,0xD3C4,0xD3C4,0xD3A3,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xD383,0xD363,0xD364,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBA5,0xDBC5,0xE3E4,0xE404,0xE444,
-	0xDC64,0xE464,0xE445,0x23DA,0x1BFA,0x1BFA,0x1BFA,0x23FB,
-	0x43F6,0xBBE9,0xE3E5,0xDBE5,0xE405,0x7BEF,0x1399,0x1378,
-	0x1358,0x0B17,0x4393,0xF548,0xF5A8,0xF608,0xF60A,0xF60C,
-	0xF5EF,0xF632,0xF653,0xF675,0xF695,0xF6B6,0xF6B7,0xF6D7,
-	0xFED8,0xFED7,0xFEB7,0xF673,0xF5ED,0xF5A7,0x8C2F,0x12D8,
-	0x12D9,0x12D9,0x12D9,0x12D8,0x5393,0xF527,0xF527,0xED27,
-	0xED27,0xED27,0xED06,0xED06,0xED06,0xED28,0xF58C,0xF5CE,
-	0xF58B,0xF5A9,0xFDCA,0xFE2A,0xFE29,0xFE28,0xF5C7,0xED46,
-	0xF547,0xF567,0xED46,0xBCA8,0x1B3C,0x12FA,0x0AF9,0x02B7,
-	0x02B7,0x22F5,0xF527,0xF527,0xED48,0x7BEF,0x1253,0x1230,
-	0x0A50,0x1270,0xC4EF,0xED6E,0xED4E,0xED4D,0xED4D,0xF56E,
-	0xF58E,0xF5AE,0xFDED,0xFDEC,0xFDAC,0xFD6B,0xF54A,0xF54B,
-	0xF5AE,0xF58D,0xECE8,0xECA5,0xECA5,0xECC5,0xECE4,0xED44,
-	0xF5A4,0xF565,0xF506,0xF4A7,0xF4A7,0xF487,0xEC66,0xEC45,
-	0xE425,0xE424,0xE425,0xE445,0xE486,0xE4C6,0xECE8,0xED29,
-	0x9941,0x9941,0x9941,0x9941,0x9961,0xA161,0xA161,0xA161,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A2,
-	0xA9A2,0xA9A1,0xA9A2,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA982,0xB1A2,0xB1A2,
-	0xB1C2,0xB1C2,0xB1C2,0xB9E2,0xB9E2,0xBA03,0xBA43,0xC263,
-	0xC263,0xC283,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xCAE3,0xCB23,
-	0xD323,0xD323,0xCB42,0xD362,0xD382,0xD382,0xD382,0xCB82,
-	0xCB62,0xCB61,0xCB62,0xD3A2,0xD3E2,0xDC02,0xDC42,0xDC22,
-	0xD3C2,0xD382,0xD362,0xCB42,0xCB42,0xD342,0xD342,0xCB42,
-	0xCB42,0xCB42,0xCB23,0xC303,0xC2C3,0xC2C3,0xC2C3,0xCAE3,
-	0xCAE3,0xCB04,0xCB04,0xD324,0xD324,0xD344,0xDB64,0xDB65,
-	0xDB84,0xD384,0xDB84,0xDB84,0xDBA4,0xD3C4,0xD3A4,0xD3A4,
-	0xD3A3,0xD383,0xD383,0xD383,0xD383,0xD364,0xD363,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBA5,0xDBC5,0xE3C5,0xDBE5,0xE424,
-	0xE464,0xE464,0xE445,0x23DB,0x1BFA,0x1BFA,0x1BFA,0x73F1,
-	0xE405,0xDBE4,0xDBE5,0xDBE5,0xE405,0xE425,0xC42A,0x3BB5,
-	0x1358,0x0B37,0x4373,0xF548,0xF588,0xF5E8,0xF609,0xF60C,
-	0xF5EE,0xF5F0,0xF633,0xF655,0xF695,0xF6B6,0xFEB6,0xFED7,
-	0xFED7,0xFED7,0xFED7,0xFE95,0xF630,0xF5A9,0x7BEF,0x12B8,
-	0x12B8,0x12D9,0x12D9,0x12D9,0x7C0F,0xED27,0xED27,0xED27,
-	0xED26,0xED06,0xED06,0xED06,0xED07,0xED28,0xF58C,0xF5AE,
-	0xF58B,0xF589,0xFDCA,0xFE2A,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xF547,0xF547,0xED46,0xE504,0x1B1B,0x1B1A,0x0AF9,0x02D7,
-	0x02B7,0x0297,0xF548,0xF527,0xED48,0x7BEF,0x1253,0x1231,
-	0x0A4F,0x1270,0x8C30,0xED6E,0xED6E,0xED4E,0xED6E,0xF58E,
-	0xF58E,0xF5CE,0xF60D,0xFE0D,0xFDAD,0xFD6B,0xF54A,0xF56B,
-	0xF5AE,0xF58C,0xECC7,0xECA5,0xECA5,0xECA5,0xECE5,0xED64,
-	0xEDA4,0xF545,0xF506,0xF4C7,0xF4A7,0xF486,0xEC66,0xE445,
-	0xE425,0xE425,0xE425,0xE445,0xE486,0xECC6,0xED08,0xED09,
-	0x9941,0x9941,0x9941,0x9961,0x9961,0x9961,0xA161,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A2,
-	0xA9A2,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,
-	0xA9C1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xB182,0xB1A2,
-	0xB1C2,0xB1C2,0xB1C2,0xB1C2,0xB9E3,0xBA03,0xBA23,0xC243,
-	0xC263,0xC283,0xCAA3,0xCAC3,0xCAE3,0xCAE3,0xD303,0xCB03,
-	0xCB23,0xCB23,0xCB42,0xD362,0xD382,0xD382,0xD382,0xCB82,
-	0xCB62,0xCB62,0xCB62,0xCB82,0xD3A2,0xD3E2,0xDC22,0xDC43,
-	0xDC03,0xD3A2,0xD382,0xD362,0xD342,0xCB42,0xCB42,0xCB42,
-	0xCB42,0xCB42,0xCB42,0xCB03,0xC2E3,0xC2C3,0xC2C3,0xC2C3,
-	0xCAE3,0xCAE3,0xCB04,0xD324,0xD324,0xD344,0xD364,0xDB65,
-	0xD364,0xDB84,0xDB84,0xDB84,0xDBA4,0xD3A4,0xD3C4,0xD3A4,
-	0xD3A3,0xD383,0xD383,0xD383,0xD383,0xD364,0xD383,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBA5,0xDBC5,0xE3C5,0xDBE5,0xDC24,
-	0xE444,0xE464,0xDC45,0x23DA,0x23DA,0x33F8,0xAC0A,0xDC04,
-	0xE405,0xDBE4,0xDBE5,0xDC05,0xDBE5,0xE405,0xEC46,0xDC68,
-	0x73F0,0x0B37,0x4373,0xF528,0xF588,0xF5C8,0xF609,0xF5EB,
-	0xF5CD,0xF5F0,0xF632,0xF654,0xF695,0xF696,0xF6B6,0xFED7,
-	0xFED7,0xFED8,0xFED7,0xF6B5,0xF651,0xF5CB,0x7BEF,0x12B8,
-	0x12B8,0x12D9,0x12D9,0x12D8,0x8410,0xED47,0xED27,0xED27,
-	0xED26,0xED06,0xED06,0xED06,0xED07,0xED28,0xF58C,0xF5CE,
-	0xF58B,0xF589,0xFDCA,0xFE2A,0xFE49,0xF628,0xF5C7,0xED46,
-	0xF527,0xF547,0xED46,0xE4E4,0x1B1B,0x131A,0x0AD9,0x02B7,
-	0x02B7,0x0297,0xF547,0xF527,0xED48,0x9C4E,0x1253,0x1251,
-	0x0A4F,0x1270,0x2AD0,0xED6F,0xED6E,0xED6E,0xED6E,0xF58E,
-	0xF5AE,0xF5CE,0xFE0D,0xFE0D,0xFDAD,0xFD6B,0xF54A,0xF58C,
-	0xF5AE,0xF56B,0xECC7,0xECA5,0xECA5,0xECA5,0xED05,0xED84,
-	0xF584,0xF545,0xF4E6,0xF4A7,0xF4A7,0xF467,0xEC66,0xE445,
-	0xE425,0xE425,0xE445,0xE465,0xE486,0xECC6,0xED08,0xED29,
-	0x9941,0x9941,0x9961,0x9961,0x9961,0xA161,0xA161,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A2,
-	0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A1,0xA9A1,0xA9A1,
-	0xA9C1,0xA9A1,0x8961,0x7121,0x50C0,0x58C1,0x58C1,0x60E1,
-	0x8141,0xA1A2,0xB1C2,0xB1C2,0xB9E2,0xBA03,0xBA23,0xC263,
-	0xC263,0xC283,0xCA83,0xCAC3,0xCAC4,0xCAE4,0xCAE3,0xCB03,
-	0xCB23,0xCB23,0xCB42,0xD362,0xD362,0xD382,0xD382,0xCB82,
-	0xD382,0xCB62,0xCB62,0xCB62,0xD382,0xD3C2,0xD402,0xDC22,
-	0xDC23,0xD402,0xD3A2,0xD382,0xD362,0xCB42,0xCB42,0xD342,
-	0xCB42,0xCB42,0xCB42,0xCB23,0xC2E3,0xC2C3,0xC2C3,0xC2C3,
-	0xCAE3,0xCAE3,0xCB04,0xCB04,0xD324,0xD344,0xD344,0xDB64,
-	0xD364,0xDB84,0xDB84,0xD384,0xDBA4,0xD3A4,0xD3C4,0xD3A4,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xD383,0xD364,0xD384,0xD384,
-	0xD384,0xDB85,0xDBA5,0xDBA5,0xDBC5,0xE3C5,0xDBE4,0xDC24,
-	0xE445,0xE464,0xE445,0x23DA,0x73F1,0xD406,0xE405,0xDC04,
-	0xDC05,0xDBE4,0xDBE5,0xDBE5,0xDBE5,0xE405,0xEC46,0xEC66,
-	0xEC87,0xB46C,0x63B2,0xF528,0xF587,0xF5C7,0xF608,0xF5EA,
-	0xF5CC,0xF5CF,0xF611,0xF634,0xF675,0xF696,0xF696,0xFEB7,
-	0xFED7,0xFED7,0xFED7,0xFED6,0xF693,0xF5EE,0x7BEF,0x12B8,
-	0x12B8,0x12D8,0x12D9,0x12D8,0x73D1,0xF547,0xED27,0xED27,
-	0xED26,0xED06,0xED06,0xED06,0xED07,0xED28,0xF58C,0xF5AE,
-	0xF58B,0xF589,0xFDCA,0xFE2A,0xFE49,0xF628,0xF5C7,0xED46,
-	0xF547,0xF547,0xED46,0xE504,0x1B1B,0x12FA,0x0AD8,0x02B7,
-	0x0AB7,0x0297,0xF547,0xF527,0xED47,0xD52B,0x1253,0x1231,
-	0x0A4F,0x1250,0x1270,0x7BEF,0xED6E,0xED6E,0xED6E,0xF58E,
-	0xF5AE,0xF5CE,0xFE0E,0xFE0D,0xFDAD,0xFD4C,0xF54A,0xF58C,
-	0xF5CE,0xF54A,0xECC6,0xECA5,0xECA5,0xECA5,0xED04,0xED84,
-	0xF585,0xF545,0xF4E6,0x73F1,0x0B78,0x0B99,0x2BB7,0xC429,
-	0xE425,0xE445,0xE425,0xE465,0xE486,0xECC6,0xED08,0xED29,
-	0x9941,0x9941,0x9961,0x9961,0xA161,0xA161,0xA161,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A2,
-	0xA9C2,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xA9A1,0xA1A1,
-	0x50E0,0x1040,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x2860,0x7121,0xB9E2,0xBA03,0xBA23,0xC243,
-	0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,0xCAE3,0xCB03,
-	0xCB03,0xD323,0xD323,0xD342,0xD363,0xD362,0xD382,0xD382,
-	0xCB82,0xCB82,0xCB61,0xCB42,0xCB62,0xCB82,0xD3C2,0xDC02,
-	0xDC23,0xDC22,0xD3E2,0xD3A2,0xD362,0xCB43,0xD342,0xD362,
-	0xD362,0xCB62,0xCB42,0xCB23,0xC303,0xC2C3,0xC2C3,0xC2C3,
-	0xCAC4,0xCAE3,0xCB04,0xCB04,0xD324,0xD324,0xD344,0xDB44,
-	0xDB64,0xDB84,0xDB84,0xD384,0xDBA4,0xD3A4,0xD3C4,0xD3C4,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xD383,0xD384,0xD384,0xD384,
-	0xDB84,0xDB85,0xDBA5,0xDBA5,0xDBA5,0xDBC5,0xE3E5,0xE424,
-	0xE445,0xE444,0xE445,0xAC0A,0xDC24,0xDC05,0xE405,0xE405,
-	0xDBE5,0xDC05,0xDBE5,0xDBE5,0xDBE5,0xE405,0xE426,0xEC46,
-	0xECA7,0xF4C7,0xF4E8,0xF528,0xF567,0xF5C7,0xF5E7,0xF5E9,
-	0xF5CC,0xF5CE,0xF5F0,0xF633,0xF654,0xF675,0xF696,0xFEB7,
-	0xFED7,0xFED8,0xFED7,0xFED6,0xF6B4,0xF610,0x9C6E,0x12B8,
-	0x12B8,0x12D9,0x12D8,0x12D8,0x3B35,0xED27,0xED27,0xED27,
-	0xED26,0xED26,0xED06,0xED06,0xED07,0xED28,0xF58C,0xF5AE,
-	0xF58B,0xFD89,0xFDCA,0xFE2A,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xF547,0xF547,0xED46,0xB46A,0x1B1B,0x12FA,0x0AD9,0x02B7,
-	0x02B7,0x02B7,0xFD47,0xF547,0xED47,0xED89,0x4B32,0x1251,
-	0x0A30,0x1270,0x1270,0x1270,0x7BEF,0xED6E,0xED6E,0xF56E,
-	0xF5AE,0xFDEE,0xFE0E,0xFE0D,0xFDAC,0xFD6C,0xF54B,0xF58D,
-	0xF5AE,0xED2A,0xECA6,0xECA5,0xECA5,0xE4A4,0xED24,0xED84,
-	0xF5A5,0xF546,0x7BEF,0x0B58,0x0B78,0x0B99,0x13B9,0x3BD6,
-	0xE425,0xE425,0xE445,0xE465,0xE486,0xECC7,0xED08,0xED29,
-	0x9941,0x9941,0x9941,0x9961,0xA161,0xA161,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA9A1,0xA9A1,0xA9A1,0xA9A1,
-	0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A1,0xA9A1,
-	0xA9A1,0xA9C2,0xA9A1,0xA9A2,0xA9A1,0xA9A1,0x8141,0x0800,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x2860,0xA1C2,0xBA02,0xC243,
-	0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,0xCAE3,0xCAE3,
-	0xCB03,0xD323,0xD323,0xD343,0xD362,0xD362,0xD382,0xD382,
-	0xD382,0xD382,0xCB81,0xCB42,0xCB42,0xCB62,0xD382,0xD3C2,
-	0xDC22,0xDC23,0xDC02,0xD3C2,0xD382,0xD342,0xD342,0xD362,
-	0xD362,0xCB42,0xCB42,0xCB42,0xCB02,0xC2E2,0xC2C3,0xC2C3,
-	0xCAE3,0xCAE3,0xCB04,0xCB04,0xD324,0xD324,0xD344,0xD364,
-	0xDB64,0xDB64,0xDB64,0xDB84,0xDBA4,0xD3A4,0xD3A4,0xD3C4,
-	0xD3A3,0xD3A3,0xD383,0xD383,0xD384,0xD384,0xD383,0xD384,
-	0xDB84,0xDB85,0xDBA4,0xDBA5,0xDBA5,0xDBC5,0xE3E5,0xE424,
-	0xE445,0xE464,0xE445,0xE444,0xDC24,0xDC05,0xE405,0xE405,
-	0xDBE5,0xDBE5,0xE405,0xDBE5,0xE3E5,0xE405,0xE426,0xEC46,
-	0xEC87,0xF4A7,0xF4E8,0xF528,0xF567,0xF5A7,0xF5E7,0xF5E8,
-	0xEDCB,0xF5CD,0xF5EF,0xF632,0xF654,0xF675,0xF695,0xFEB7,
-	0xFED8,0xFED8,0xFED7,0xFED6,0xFEB5,0xFE52,0xBCEE,0x0A98,
-	0x12B8,0x12D9,0x12D9,0x12D8,0x12D8,0xD4E9,0xF527,0xED27,
-	0xED26,0xED06,0xED06,0xED06,0xED07,0xED28,0xF58C,0xF5AE,
-	0xF58B,0xFD89,0xFDCA,0xFE2A,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xF547,0xF547,0xED26,0x73D1,0x1B1B,0x12FA,0x0AD9,0x0AB7,
-	0x0297,0x4353,0xFD47,0xF547,0xF547,0xED69,0xC4ED,0x1251,
-	0x1230,0x0A4F,0x1250,0x1270,0x1290,0x2AF1,0x73D0,0x7BEF,
-	0x83EF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x8410,0x7BEF,0x83EF,
-	0x7BEF,0x7BEF,0x7BEF,0xB44A,0xECA5,0xECC5,0xED24,0xEDA4,
-	0xF584,0xF546,0x4394,0x0B58,0x0B78,0x0B99,0x13B9,0x1BBA,
-	0xE425,0xE424,0xE445,0xE464,0xECA5,0xECC7,0xED08,0xED29,
-	0x9941,0x9941,0x9941,0x9961,0xA161,0xA161,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA181,0xA9A1,0xA9A1,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A2,0xA9C2,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,
-	0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0x6901,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0820,0x91A2,0xBA43,
-	0xC243,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,0xCAC3,0xCB03,
-	0xCB03,0xCB03,0xD323,0xCB23,0xD343,0xD363,0xCB82,0xD382,
-	0xD3A2,0xD382,0xD382,0xCB62,0xCB41,0xCB41,0xD362,0xD3A2,
-	0xD3E2,0xDC23,0xDC22,0xDBE2,0xD3A2,0xD362,0xD342,0xD342,
-	0xD342,0xD362,0xCB62,0xCB42,0xCB22,0xC2E3,0xC2C3,0xC2C3,
-	0xC2C3,0xCAE3,0xCAE4,0xCB04,0xD324,0xD324,0xD344,0xD364,
-	0xDB64,0xDB64,0xDB64,0xDB64,0xDB84,0xDBA4,0xD3A4,0xD3C4,
-	0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,0xD383,0xD383,0xD384,
-	0xD384,0xDB85,0xDBA4,0xDBA5,0xDBA5,0xDBC5,0xDBE4,0xE404,
-	0xE444,0xE444,0xE445,0xE444,0xDC24,0xDC05,0xE405,0xE405,
-	0xDBE5,0xDBE5,0xDBE4,0xDBE4,0xE3E4,0xE3E5,0xEC25,0xEC46,
-	0xEC87,0xECA7,0xF4E8,0xF508,0xF567,0xF587,0xF5C7,0xF5C8,
-	0xEDCA,0xEDAC,0xF5CF,0xF611,0xF653,0xF655,0xF695,0xF6B6,
-	0xFED7,0xFED7,0xFED8,0xFEF7,0xFED6,0xF673,0xE5AE,0x1296,
-	0x0AB8,0x12D9,0x12D9,0x12D9,0x0AD8,0x5393,0xF527,0xF527,
-	0xED27,0xED07,0xED06,0xED06,0xED07,0xF528,0xF58C,0xF5AE,
-	0xF58B,0xF589,0xFDCA,0xFE2A,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xF527,0xF547,0xE507,0x231A,0x1B1B,0x131A,0x0AD9,0x0AB7,
-	0x0296,0x63B1,0xF548,0xF547,0xED67,0xED68,0xED8B,0x8C2F,
-	0x1230,0x0A4F,0x0A50,0x0A70,0x1271,0x1291,0x0A91,0x0A71,
-	0x0A31,0x0A11,0x01F1,0x01F1,0x0252,0x0293,0x0293,0x0252,
-	0x0A72,0x1316,0x135A,0x7BEF,0xECA5,0xECC5,0xED44,0xF5A4,
-	0xEDA5,0xF526,0x4394,0x0B58,0x0B78,0x0B99,0x13B9,0x13BA,
-	0xE425,0xE425,0xE445,0xE465,0xE486,0xECC7,0xED08,0xED29,
-	0x9941,0x9941,0x9941,0xA161,0xA161,0xA161,0xA181,0xA181,
-	0xA181,0xA181,0xA181,0xA9A1,0xA9A2,0xA9A2,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,
-	0xA9C1,0xA9C1,0xA9C1,0xA9C1,0x8961,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x2860,0x2860,0x2860,0x2860,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1840,0xB202,
-	0xC243,0xC263,0xC283,0xCAA4,0xCAA4,0xCAC4,0xCAC4,0xCAE4,
-	0xCB03,0xCB04,0xD324,0xCB23,0xCB43,0xD343,0xCB62,0xCB62,
-	0xD382,0xD382,0xD382,0xCB62,0xCB61,0xCB42,0xCB42,0xD362,
-	0xD3A2,0xD402,0xDC22,0xDC02,0xDBC2,0xD383,0xD363,0xD342,
-	0xD342,0xD362,0xD362,0xCB42,0xCB23,0xCB03,0xCAE3,0xC2C3,
-	0xC2C3,0xC2C3,0xCAE4,0xCB04,0xCB04,0xD324,0xD344,0xD364,
-	0xDB64,0xDB64,0xDB64,0xDB64,0xDB84,0xDBA4,0xDBA4,0xD3C4,
-	0xD3C4,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,0xD384,0xD384,
-	0xD384,0xDB85,0xDBA4,0xDBA5,0xDBA5,0xDBC5,0xDBE4,0xE404,
-	0xE444,0xE444,0xE445,0xE444,0xDC24,0xDC05,0xE405,0xDBE5,
-	0xE405,0xDBE5,0xDBE5,0xDBE4,0xE3E4,0xE405,0xEC25,0xEC46,
-	0xEC67,0xECA7,0xF4C8,0xF508,0xF548,0xF5A7,0xF5C7,0xF5C8,
-	0xF5A9,0xEDAB,0xF5CD,0xF5F0,0xF613,0xF654,0xF675,0xFEB6,
-	0xFED7,0xFED7,0xFED8,0xFEF7,0xFEF6,0xFE95,0xF610,0x3B13,
-	0x12B8,0x12D8,0x12D9,0x12D9,0x0AD8,0x12D8,0x8C0E,0xED27,
-	0xED27,0xED26,0xED06,0xED06,0xED07,0xED28,0xF58B,0xF5AD,
-	0xF58B,0xF589,0xFDCA,0xFE09,0xFE49,0xFE28,0xF5C7,0xED46,
-	0xED27,0xF547,0x5394,0x1AFB,0x1B1B,0x12FA,0x0AD9,0x0AB7,
-	0x0A97,0x9C4E,0xF568,0xF547,0xED47,0xED88,0xEDAB,0xEDAE,
-	0x7BEF,0x0A4F,0x0A50,0x1270,0x1271,0x1291,0x1291,0x0A51,
-	0x0A31,0x0A11,0x01D0,0x01F1,0x0252,0x0293,0x0293,0x0A51,
-	0x0A72,0x0B17,0x135A,0x83EF,0xECA5,0xECC5,0xED44,0xF584,
-	0xF585,0xF526,0x63D2,0x0B58,0x0B78,0x0B99,0x13B9,0x13BA,
-	0xE425,0xE444,0xE445,0xE465,0xECA6,0xECC7,0xED08,0xF529,
-	0x9941,0x9941,0x9961,0x9961,0xA161,0xA161,0xA181,0xA181,
-	0xA181,0xA181,0xA981,0xA981,0xA9A2,0xA9A1,0xA9A1,0xA9A1,
-	0xA9A1,0xA9A1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C1,0xA9C1,0xB1C2,0x1840,0x0000,0x0000,0x0000,
-	0x0000,0x48A0,0x8961,0xA9C1,0xA9A1,0xA9A1,0xA9A1,0xB1A1,
-	0xB1A2,0x8141,0x3080,0x0000,0x0000,0x0000,0x0000,0x5901,
-	0xC243,0xC263,0xC263,0xCA83,0xCAA4,0xCAC4,0xCAC4,0xCAC4,
-	0xCAE4,0xCB03,0xCB04,0xCB23,0xCB23,0xD343,0xD363,0xD382,
-	0xD382,0xD382,0xD382,0xCB82,0xCB62,0xCB62,0xCB42,0xCB62,
-	0xCB82,0xD3C2,0xDC22,0xDC42,0xDC02,0xDBA3,0xD362,0xCB62,
-	0xD342,0xD362,0xD362,0xCB42,0xCB22,0xCB02,0xC2E3,0xC2C2,
-	0xC2C3,0xC2E3,0xCAE3,0xCB04,0xCB04,0xD324,0xD344,0xD344,
-	0xDB64,0xDB64,0xDB84,0xDB84,0xDB84,0xDBA4,0xDBC4,0xD3C4,
-	0xDBC4,0xD3C4,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD384,0xD384,
-	0xD384,0xDB85,0xDBA5,0xDBA5,0xDBA5,0xDBC5,0xDBE5,0xE404,
-	0xE424,0xE445,0xE445,0xE445,0xE444,0xDC25,0xE405,0xE405,
-	0xDC05,0xDBE5,0xE3E5,0xDBE4,0xE3E4,0xE3E5,0xEC06,0xEC46,
-	0xEC66,0xECA7,0xF4C8,0xF508,0xF548,0xF588,0xF5C7,0xEDE7,
-	0xEDA9,0xED8B,0xF5AD,0xF5F0,0xF612,0xF654,0xFE75,0xF696,
-	0xFEB7,0xFED7,0xFED7,0xF6F7,0xFEF6,0xF6D5,0xF652,0x8C2F,
-	0x12B8,0x12D9,0x12D8,0x12D8,0x12D8,0x0AD8,0x12D8,0x73D1,
-	0xE508,0xED07,0xED06,0xED07,0xED07,0xED08,0xF58B,0xF5AE,
-	0xF58B,0xFD89,0xFDC9,0xFE09,0xFE29,0xFE28,0xF5C7,0xF546,
-	0xE508,0x63B2,0x12BA,0x12FB,0x1AFB,0x131A,0x0AF9,0x0AB7,
-	0x0296,0xED49,0xF568,0xF547,0xED67,0xED88,0xED8B,0xEDAE,
-	0xF5AF,0xAC90,0x2AD0,0x1270,0x1270,0x1271,0x1271,0x0A51,
-	0x0A31,0x09F1,0x09F1,0x01F1,0x0252,0x0273,0x0A73,0x0230,
-	0x0A73,0x1317,0x135A,0x7BEF,0xECA5,0xE4E4,0xED44,0xEDA4,
-	0xF585,0xF526,0xDC89,0x1377,0x0B78,0x0B99,0x13B9,0x73F1,
-	0xE445,0xE445,0xE444,0xE465,0xECA6,0xECE7,0xED08,0xF529,
-	0x9941,0x9941,0x9961,0xA161,0xA161,0xA161,0xA181,0xA1A1,
-	0xA181,0xA181,0xA981,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9A2,
-	0xA9A1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9E1,
-	0xB1E2,0xB1C2,0xA9C1,0x7941,0x0000,0x0000,0x0000,0x0800,
-	0x9181,0xA9C1,0xA9C1,0xA9C1,0xA9A1,0xA9A1,0xA9A1,0xB1A1,
-	0xA9A1,0xB1C2,0xB1C2,0x7121,0x0000,0x0000,0x0000,0x0820,
-	0xB223,0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,0xCAC4,
-	0xCAE4,0xCAE4,0xCB04,0xCB24,0xCB23,0xCB43,0xD343,0xCB63,
-	0xD382,0xD382,0xD382,0xCB82,0xCB62,0xCB62,0xCB42,0xCB42,
-	0xCB62,0xD3A2,0xDBE2,0xDC23,0xDC22,0xDBE3,0xD3A2,0xD363,
-	0xD362,0xD362,0xD362,0xD362,0xCB42,0xCB22,0xCB02,0xC2C2,
-	0xC2C3,0xC2E3,0xC2E3,0xCB04,0xCB04,0xD304,0xD324,0xD344,
-	0xDB44,0xDB64,0xDB84,0xDB84,0xD384,0xDB84,0xDBC4,0xDBC4,
-	0xDBC4,0xD3C4,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,0xD384,
-	0xD384,0xDB84,0xDBA5,0xDBA5,0xDBA5,0xDBC5,0xDBC5,0xE404,
-	0xE424,0xE445,0xE445,0xE445,0xE424,0xDC04,0xE405,0xE405,
-	0xDC05,0xDBE5,0xE3E5,0xDBE4,0xE3E4,0xE3E5,0xE405,0xEC26,
-	0xEC66,0xECA7,0xF4C7,0xF4E8,0xF547,0xF587,0xF5C7,0xF5E6,
-	0xEDA8,0xED6A,0xF58D,0xF5CF,0xF611,0xF633,0xF674,0xF695,
-	0xFEB7,0xFED7,0xFED7,0xFED7,0xFEF7,0xF6D5,0xF673,0xE5AD,
-	0x1AD6,0x12D9,0x12D8,0x12D8,0x12D8,0x0AD8,0x12D8,0x12D9,
-	0x1AF8,0x7BEF,0xD4C9,0xED06,0xED07,0xED08,0xF56B,0xF5AD,
-	0xF58B,0xFD89,0xFDC9,0xFE09,0xFE29,0xFE28,0xE588,0x9C4D,
-	0x2B16,0x0AB8,0x12B9,0x12FB,0x1B1B,0x12FA,0x0AF9,0x02B7,
-	0x63B1,0xFD68,0xF568,0xF548,0xF546,0xED67,0xED8B,0xEDAD,
-	0xF5AF,0xEDD0,0xE56F,0x8C2F,0x3B10,0x1291,0x0A71,0x0A71,
-	0x0A30,0x01F1,0x01D0,0x01F1,0x0252,0x0273,0x0A72,0x0250,
-	0x0A94,0x1338,0x135A,0x7BEF,0xECC5,0xECE4,0xED44,0xEDA4,
-	0xF585,0xF527,0xF4C6,0xD489,0x840F,0x83EF,0x9C2D,0xE445,
-	0xE445,0xE445,0xE444,0xE465,0xECA6,0xECE7,0xED08,0xF549,
-	0x9941,0x9941,0x9941,0xA161,0xA161,0xA161,0xA181,0xA1A1,
-	0xA181,0xA9A1,0xA981,0xA981,0xA9A1,0xA9A1,0xA9A2,0xA9A2,
-	0xA9A1,0xA9C1,0xA9C1,0xA9C1,0xB1C2,0xB1C1,0xA9E2,0xB1E2,
-	0xB1E2,0xB1E2,0xA9C1,0x40A0,0x0000,0x0000,0x0000,0x6100,
-	0xB1C2,0xA9C1,0xA9C1,0xA9C1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,
-	0xB1A1,0xB1C1,0xB1C2,0xB1C2,0x3880,0x0000,0x0000,0x0000,
-	0x7962,0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,0xCAC4,
-	0xCAE4,0xCAE4,0xD304,0xCB04,0xCB23,0xD343,0xD363,0xCB63,
-	0xD382,0xD382,0xD382,0xD382,0xCB82,0xCB62,0xCB62,0xCB42,
-	0xCB42,0xCB62,0xD3A2,0xDBE2,0xDC22,0xDC02,0xDBC2,0xD383,
-	0xD363,0xD362,0xD362,0xCB63,0xCB62,0xCB42,0xCB03,0xCAE2,
-	0xCAE3,0xC2E3,0xC2E3,0xCB03,0xCB04,0xD324,0xD344,0xD344,
-	0xDB44,0xDB64,0xDB84,0xDB84,0xDB84,0xDBA4,0xDBC4,0xDBC4,
-	0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,0xD383,
-	0xD384,0xDB84,0xDBA4,0xDBA5,0xDBA5,0xDBC5,0xDBC5,0xE405,
-	0xE424,0xE445,0xE445,0xE445,0xE444,0xDC24,0xE405,0xE405,
-	0xE405,0xDBE5,0xE3E5,0xE3E4,0xE3E4,0xE3E5,0xE3E5,0xEC26,
-	0xEC66,0xECA7,0xF4C7,0xF4E7,0xF528,0xF567,0xF5A6,0xF5C6,
-	0xF5A7,0xED69,0xF58B,0xF5AE,0xF5F0,0xF613,0xF654,0xF695,
-	0xFEB6,0xFEB7,0xFED7,0xFEF7,0xFEF6,0xF6F6,0xF694,0xF60F,
-	0x8C2F,0x12D9,0x12F9,0x12D8,0x12D8,0x0AD8,0x12D8,0x12D9,
-	0x12D9,0x12F9,0x12F9,0x73F1,0xED07,0xED08,0xF56B,0xF5AD,
-	0xF58B,0xF569,0xFDC9,0xFE09,0xFE29,0xF628,0x6392,0x12B9,
-	0x0AB8,0x0AB8,0x12DA,0x1AFB,0x1AFB,0x12FA,0x0AF9,0x02B7,
-	0xDCEA,0xFD68,0xF568,0xF547,0xF546,0xED67,0xED6A,0xEDAD,
-	0xF5AF,0xEDB0,0xEDB0,0xEDAF,0xED8E,0xED8E,0xB4CF,0xBCCF,
-	0xBCEF,0xBD0F,0xBD0F,0xBD0F,0xBCCF,0xBCCE,0xBCCE,0xBCCF,
-	0xB4AD,0xB44B,0xB44A,0xD468,0xECA5,0xECE5,0xED64,0xF5A4,
-	0xF565,0xF507,0xF4C7,0xF4A7,0xF487,0xEC66,0xEC46,0xE445,
-	0xE445,0xE445,0xE465,0xE465,0xECA6,0xECE7,0xED08,0xED49,
-	0x9941,0x9941,0x9941,0xA161,0xA161,0xA161,0xA181,0xA181,
-	0xA9A1,0xA9A1,0xA981,0xA9A1,0xA9A1,0xA9A2,0xA9A2,0xA9A2,
-	0xA9C1,0xA9C1,0xA9C1,0xB1C1,0xB1E2,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x2040,0x0000,0x0000,0x0000,0xA1C2,
-	0xB1E2,0xB1C2,0xA9C2,0xB1C2,0xA9C1,0xA9A1,0xA9C1,0xB1A1,
-	0xB1A1,0xB1A2,0xB1C2,0xB1C2,0x7941,0x0000,0x0000,0x0000,
-	0x50E1,0xC263,0xC263,0xC283,0xCAA3,0xCAC4,0xCAC4,0xCAE4,
-	0xD2E4,0xCAE4,0xD2E4,0xCB04,0xCB04,0xCB23,0xCB43,0xCB63,
-	0xCB82,0xD382,0xD382,0xCB82,0xD382,0xD362,0xCB42,0xCB42,
-	0xCB42,0xCB62,0xD382,0xD3C2,0xDC23,0xDC22,0xDBE2,0xD3A2,
-	0xD363,0xD362,0xD362,0xD362,0xD362,0xCB42,0xCB22,0xCB02,
-	0xC2E3,0xC2E3,0xC2E3,0xCAE4,0xCB04,0xCB04,0xD324,0xD344,
-	0xD344,0xDB64,0xDB84,0xDB84,0xDB84,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD383,0xD383,0xD383,
-	0xD384,0xDBA4,0xDBA4,0xDBA4,0xDBA5,0xDBA5,0xDBC5,0xE405,
-	0xE425,0xE444,0xE465,0xE445,0xE444,0xDC24,0xE405,0xE405,
-	0xE405,0xDC05,0xE3E5,0xE3E4,0xE3E4,0xE3E5,0xE405,0xEC26,
-	0xEC46,0xEC87,0xF4A7,0xF4E8,0xF528,0xF567,0xF5A7,0xF5C6,
-	0xF5A7,0xED49,0xED6A,0xF5AD,0xF5CF,0xF611,0xF633,0xF675,
-	0xFEB6,0xFED7,0xFED7,0xFEF7,0xFEF7,0xFEF6,0xF6B5,0xF631,
-	0xED8B,0x4B54,0x12D9,0x12D8,0x12D8,0x12D8,0x12D8,0x12D9,
-	0x12D9,0x12F9,0x12F9,0x9C4D,0xED07,0xED08,0xF56B,0xF5AD,
-	0xF58B,0xF589,0xFDC9,0xFE09,0xFE29,0xF608,0x9C6D,0x12B9,
-	0x12D8,0x0AB8,0x12DA,0x1AFB,0x1B1B,0x12FA,0x0AF9,0x7BF0,
-	0xFD48,0xFD68,0xF568,0xF547,0xF547,0xED67,0xED6A,0xED8C,
-	0xEDAF,0xEDB0,0xEDB0,0xED8F,0xED8F,0xED8E,0xED8E,0xF5AE,
-	0xF5CE,0xFE0F,0xFE2F,0xFE0E,0xFDAE,0xFD8D,0xFDAE,0xFDAF,
-	0xF54A,0xECA6,0xECA5,0xECA5,0xECA5,0xECE5,0xED64,0xF5C4,
-	0xF565,0xF506,0xF4C7,0xF487,0xF487,0xEC66,0xEC46,0xE445,
-	0xE445,0xE445,0xE465,0xE465,0xECA6,0xECE7,0xED08,0xED49,
-	0x9961,0x9941,0xA141,0xA141,0xA161,0xA161,0xA161,0xA181,
-	0xA981,0xA981,0xA981,0xA981,0xA9A1,0xA9A2,0xA9A2,0xA9A2,
-	0xA9C1,0xA9C1,0xA9C1,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x0000,0x0000,0x0000,0x2860,0xB1E2,
-	0xB1E2,0xB1C2,0xB1C2,0xB1C2,0xA9C1,0xA9C1,0xA9C1,0xA9A1,
-	0xB1A1,0xB1A2,0xB1C2,0xB1C2,0xB1C2,0x0000,0x0000,0x0000,
-	0x3080,0xC243,0xC264,0xC283,0xC283,0xCAA4,0xCAC4,0xCAC4,
-	0xD2E4,0xCAE4,0xD2E4,0xD304,0xCB04,0xCB23,0xCB43,0xCB63,
-	0xD363,0xCB63,0xCB82,0xCB82,0xCB82,0xCB62,0xCB62,0xCB42,
-	0xCB42,0xCB42,0xD362,0xD3A2,0xDBE3,0xDC22,0xDC03,0xDBC3,
-	0xD382,0xD362,0xD362,0xD362,0xD362,0xCB42,0xCB22,0xCB02,
-	0xC2E3,0xC2E3,0xC2E3,0xCAE3,0xCB04,0xCB24,0xD324,0xD324,
-	0xD344,0xDB64,0xDB84,0xDB85,0xDB64,0xDB85,0xDBA4,0xDBC4,
-	0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD383,
-	0xD384,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xE3A5,0xE3E4,0xE405,
-	0xDC24,0xE444,0xE465,0xE464,0xE445,0xDC24,0xE405,0xE405,
-	0xE405,0xE405,0xDC05,0xDBE4,0xDBC4,0xE3C5,0xE405,0xEC26,
-	0xEC46,0xEC67,0xECA7,0xF4C8,0xF508,0xF567,0xF5A6,0xF5C6,
-	0xED87,0xED48,0xED6A,0xED8C,0xEDAE,0xF5F0,0xF633,0xF654,
-	0xFE95,0xFEB6,0xFED7,0xFED7,0xFEF7,0xF6F6,0xF6B5,0xF653,
-	0xF5CD,0xDD29,0x3B36,0x12D8,0x12D8,0x0AD8,0x12D8,0x12D8,
-	0x0AD8,0x12F9,0x12F9,0xDCE7,0xED07,0xED27,0xF56B,0xF5AC,
-	0xF58B,0xF589,0xF5C9,0xFE09,0xFE29,0xFE08,0xE568,0x12B9,
-	0x0AB8,0x0A99,0x12D9,0x12FA,0x1B1B,0x12FA,0x5393,0xFD48,
-	0xF568,0xFD69,0xF568,0xF547,0xED46,0xED47,0xED6A,0xED8C,
-	0xF5AF,0xF5B0,0xEDB0,0xED8F,0xED8F,0xED8E,0xF58E,0xF5AF,
-	0xF5CE,0xF60E,0xFE0F,0xFDEE,0xFDAE,0xFD8D,0xF5CE,0xF5AF,
-	0xF52A,0xECA6,0xECA5,0xECA5,0xECA5,0xECE4,0xED64,0xEDC4,
-	0xF565,0xF507,0xF4C7,0xF4A7,0xF466,0xEC66,0xEC46,0xE445,
-	0xE445,0xE444,0xE465,0xE485,0xECA6,0xECE7,0xED08,0xF549,
-	0x9961,0x9961,0xA141,0xA161,0xA141,0xA161,0xA181,0xA181,
-	0xA981,0xA981,0xA981,0xA981,0xA9A1,0xA9A2,0xA9A1,0xA9C2,
-	0xA9C1,0xA9C1,0xA9C1,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x0000,0x0000,0x0000,0x2860,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0xB1C2,0xB1C2,0xA9C1,0xA9C1,0xB1A1,
-	0xA9A1,0xB1A2,0xB1C2,0xB1C2,0xB1C2,0x0000,0x0000,0x0000,
-	0x3080,0xC243,0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,
-	0xD2E4,0xD2E4,0xCAE4,0xD2E4,0xCB04,0xD324,0xCB43,0xCB43,
-	0xD363,0xCB63,0xCB82,0xCB82,0xCB82,0xCB62,0xCB61,0xCB62,
-	0xCB42,0xCB42,0xCB62,0xCB82,0xD3C2,0xDC02,0xDC03,0xDBE3,
-	0xDBA3,0xD382,0xD362,0xD362,0xD362,0xCB62,0xCB42,0xCB03,
-	0xCB03,0xC2E3,0xC2E3,0xCAE3,0xCB04,0xCB04,0xD324,0xD324,
-	0xD344,0xDB64,0xDB64,0xDB85,0xDB64,0xDB85,0xDBA4,0xDBC4,
-	0xDBC4,0xDBC4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD383,
-	0xD3A4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xE3A5,0xE3E4,0xE3E5,
-	0xDC24,0xE444,0xE465,0xE464,0xE444,0xDC24,0xE405,0xE405,
-	0xE405,0xDC05,0xDBE5,0xDBC4,0xDBC4,0xDBC5,0xE3E5,0xE405,
-	0xEC26,0xF467,0xF487,0xF4A7,0xF4E7,0xF547,0xF5A6,0xF5C6,
-	0xED86,0xED48,0xED49,0xED6B,0xF5AD,0xEDEF,0xF612,0xF654,
-	0xFE75,0xFEB6,0xFED7,0xFED7,0xFEF7,0xF6F6,0xFED6,0xF674,
-	0xF5EF,0xED69,0xDD07,0x3B55,0x12D8,0x0AD8,0x0AD8,0x12D8,
-	0x0AD8,0x12D9,0x4B74,0xED06,0xED07,0xED08,0xF56B,0xF5AC,
-	0xF58B,0xF589,0xFDA9,0xFE09,0xFE29,0xFE08,0xF5A7,0x3B35,
-	0x0AD8,0x0A99,0x12D9,0x12FA,0x1B1B,0x53B4,0xE4E8,0xFD48,
-	0xFD69,0xFD88,0xF568,0xF547,0xF546,0xED47,0xD50B,0xB4CE,
-	0x8C2F,0x7BEF,0xEDD0,0xEDAF,0xED8E,0xED8E,0xF58F,0xF5AF,
-	0xF5EE,0xFE0F,0xFE2F,0xFDEE,0xFDAE,0xFD8D,0xF5CF,0xF5AF,
-	0xF509,0xECA6,0xECA5,0xECA5,0xE4A5,0xECE5,0xED84,0xEDA4,
-	0xF566,0xF4E7,0xF4A7,0xF4A7,0xF486,0xEC46,0xEC45,0xE445,
-	0xE445,0xE445,0xE465,0xE485,0xECA6,0xECE7,0xED08,0xF549,
-	0x9961,0x9961,0xA141,0xA161,0xA161,0xA181,0xA181,0xA181,
-	0xA981,0xA981,0xA981,0xA9A1,0xA9A1,0xA9A2,0xA9A1,0xA9C2,
-	0xA9C1,0xA9C1,0xA9C1,0xB1C1,0xB1E2,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x0000,0x0000,0x0000,0x1020,0xB1E2,
-	0xB1E1,0xB1E2,0xB1E2,0xB1E2,0xB1C2,0xB1C2,0xA9C1,0xB1A1,
-	0xA9A1,0xB1A2,0xB1A2,0xB1C2,0x9982,0x0000,0x0000,0x0000,
-	0x2880,0xBA43,0xC263,0xC263,0xC283,0xCAA4,0xCAC4,0xCAC4,
-	0xD2E4,0xCAE4,0xD2E4,0xD2E4,0xCB04,0xCB04,0xCB23,0xCB43,
-	0xD363,0xCB63,0xCB62,0xCB82,0xCB82,0xCB62,0xCB82,0xCB62,
-	0xCB62,0xCB42,0xCB43,0xCB62,0xD382,0xDBC2,0xDC02,0xDC03,
-	0xDBC2,0xD3A2,0xD383,0xD362,0xD382,0xD362,0xCB42,0xCB23,
-	0xCB03,0xCB03,0xCAE3,0xCAE3,0xCB03,0xCB04,0xD324,0xD324,
-	0xD344,0xD364,0xDB64,0xDB84,0xDB85,0xDB85,0xDBA4,0xDBC4,
-	0xDBC4,0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A4,0xD3A3,0xD383,
-	0xD3A4,0xDBA4,0xDBA4,0xDBA4,0xDBA5,0xDBC5,0xE3E4,0xE3E5,
-	0xE404,0xE444,0xE465,0xE464,0xE444,0xDC24,0xE405,0xE405,
-	0xE405,0xDBE5,0xDBE5,0xDBC4,0xDBC4,0xDBC5,0xDBC5,0xE3E5,
-	0xEC26,0xEC46,0xEC87,0xF4A8,0xF4E7,0xF547,0xF5A6,0xF5C6,
-	0xED86,0xED47,0xED28,0xED4A,0xED8D,0xEDCE,0xF611,0xF634,
-	0xF675,0xFE96,0xFEB6,0xFED7,0xFEF7,0xF6F6,0xFED6,0xFE95,
-	0xF631,0xED8A,0xED27,0xED07,0x7BEF,0x1AF7,0x12D8,0x0AD8,
-	0x0AD8,0x12D9,0x8C2E,0xED06,0xED07,0xED08,0xF56B,0xF5AC,
-	0xF58B,0xF569,0xFDA9,0xFE09,0xFE29,0xFE08,0xF5A7,0x73D1,
-	0x0AB8,0x0A99,0x12D9,0x12FA,0x7BEF,0xECE5,0xF527,0xF568,
-	0xFD69,0xFD88,0xF568,0xF547,0xF566,0x7BEF,0x1296,0x1273,
-	0x0A51,0x0A2F,0xEDAF,0xEDAF,0xF58F,0xED8E,0xF5AE,0xF5AE,
-	0xF5EF,0xFE2F,0xFE2F,0xFDEF,0xDD2E,0xBCCE,0xBCEF,0xBCCF,
-	0xC4AB,0xECA6,0xECA5,0xECA5,0xECA5,0xE505,0xED84,0xEDC4,
-	0xF565,0xF4E7,0xF4A7,0xF487,0xF466,0xEC66,0xEC46,0xE445,
-	0xE445,0xE445,0xE465,0xE485,0xECA6,0xECE7,0xED08,0xF549,
-	0x9941,0xA161,0xA161,0xA161,0xA161,0xA161,0xA161,0xA981,
-	0xA981,0xA981,0xA9A1,0xA9A1,0xA9A2,0xA9A1,0xA9C2,0xA9C2,
-	0xA9C1,0xB1C1,0xB1C2,0xB1C1,0xB1E1,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x2060,0x0000,0x0000,0x0000,0x8161,
-	0xB1E2,0xB202,0xB202,0xB1E2,0xB1E2,0xB1C1,0xA9C1,0xA9C1,
-	0xA9A1,0xA9A1,0xA9A1,0xA9C2,0x6101,0x0000,0x0000,0x0000,
-	0x50E1,0xBA23,0xC243,0xC263,0xC263,0xCAA4,0xCAC4,0xCAE4,
-	0xCAE4,0xCAE4,0xCAE4,0xD304,0xCB04,0xCB04,0xCB24,0xCB44,
-	0xCB43,0xCB63,0xCB62,0xCB82,0xD382,0xCB82,0xCB61,0xCB62,
-	0xCB62,0xCB42,0xCB42,0xCB42,0xD362,0xD3A2,0xDC02,0xDC02,
-	0xDC02,0xDBC3,0xD382,0xD362,0xD362,0xD362,0xCB62,0xCB43,
-	0xCB03,0xCB03,0xCAE3,0xCAE3,0xCAE3,0xCB04,0xD324,0xD324,
-	0xD344,0xD344,0xDB65,0xDB64,0xDB85,0xDB85,0xDB85,0xDBA4,
-	0xDBC4,0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A3,0xDBA4,0xDBA4,0xDBA4,0xDBA5,0xDBC5,0xE3E4,0xE3E4,
-	0xE404,0xDC24,0xE465,0x23BB,0x1BBB,0x1BDA,0x1BFA,0x1BFB,
-	0x1C1B,0x1C1A,0x241B,0x243B,0x243B,0x245A,0x1C3A,0x1C1A,
-	0x13D9,0x13B9,0x0B78,0x0B57,0x0B17,0x0AB8,0x0A79,0x0A39,
-	0x840F,0xED47,0xED28,0xED4A,0xF56C,0xEDAE,0xF5F0,0xF613,
-	0xF675,0xFE96,0xFEB6,0xFED7,0xFEF7,0xFEF6,0xF6D6,0xF6B6,
-	0xF653,0xF5CD,0xED47,0xED07,0xED27,0xD4E9,0x63B2,0x1AF7,
-	0x0AD8,0x12D9,0xD4C9,0xED06,0xED07,0xED27,0xF56B,0xF5AC,
-	0xF58B,0xFD89,0xFDC9,0xFE09,0xFE29,0xFE08,0xF5A7,0xBCAB,
-	0x12B9,0x1AD8,0x63B2,0xCCC7,0xE4E4,0xED05,0xF527,0xF548,
-	0xFD69,0xFD88,0xF588,0xF567,0xF566,0x7BEF,0x1297,0x1273,
-	0x0A51,0x0A2F,0xEDB0,0xEDB0,0xEDAF,0xF5AF,0xF5AF,0xF5AF,
-	0xFDEF,0xEDEF,0x7BEF,0x2270,0x0251,0x0251,0x020F,0x0A51,
-	0x1316,0x1379,0x4396,0x8C0E,0xDC86,0xED24,0xED84,0xEDA5,
-	0xF546,0xF4E6,0xF4A7,0xF4A7,0xF486,0xEC46,0xEC46,0xE425,
-	0xE445,0xE465,0xE465,0xEC85,0xECC6,0xECE7,0xED28,0xF549,
-	0xA141,0xA161,0xA161,0xA161,0xA161,0xA161,0xA181,0xA981,
-	0xA982,0xA981,0xA9A1,0xA9A1,0xA9A2,0xA9A1,0xA9C2,0xA9C1,
-	0xA9C1,0xB1C1,0xB1C2,0xB1C1,0xB1E1,0xB1E2,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0x40C0,0x0000,0x0000,0x0000,0x1040,
-	0xA9C2,0xB202,0xB202,0xB1E2,0xB1E1,0xB1C1,0xA9C1,0xA9C1,
-	0xA9C1,0xA9A1,0xA9A1,0x8961,0x0800,0x0000,0x0000,0x0000,
-	0x7141,0xBA23,0xBA43,0xC263,0xC263,0xCA83,0xCAC4,0xCAE4,
-	0xCAE4,0xCAE4,0xD304,0xCB04,0xCB04,0xCB04,0xCB24,0xCB24,
-	0xCB43,0xCB63,0xCB63,0xCB83,0xCB82,0xCB82,0xCB82,0xCB62,
-	0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,0xD382,0xDBC2,0xDC02,
-	0xDC02,0xDBC3,0xD3A2,0xD382,0xD362,0xD382,0xD362,0xCB42,
-	0xCB03,0xCB03,0xCB03,0xCB03,0xCAE3,0xCB04,0xD324,0xD324,
-	0xD344,0xD344,0xDB65,0xDB64,0xDB85,0xDB85,0xDB85,0xDBA4,
-	0xDBC4,0xDBC4,0xD3C3,0xD3A3,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A4,0xD3A4,0xDBA4,0xDBA4,0xDBA5,0xDBC5,0xE3C5,0xE3E5,
-	0xE405,0xE424,0xE445,0x1BBB,0x1BBB,0x1BDA,0x1BFA,0x1C1B,
-	0x1C1B,0x1C1A,0x1C1A,0x243B,0x243B,0x245A,0x1C3A,0x1C1A,
-	0x13D9,0x13B9,0x0B98,0x0B57,0x0B17,0x0AD8,0x0A79,0x0A39,
-	0x83F0,0xED47,0xED27,0xED29,0xED6B,0xED8D,0xF5CF,0xF612,
-	0xF654,0xFE95,0xFEB6,0xFED7,0xFEF7,0xFEF7,0xFED6,0xF6B6,
-	0xF674,0xF5EF,0xF569,0xED27,0xED27,0xED27,0xED27,0xE508,
-	0x9C4D,0x73D1,0xED06,0xED06,0xED07,0xED27,0xF56B,0xF5AC,
-	0xF58B,0xFD89,0xFDC9,0xFE09,0xFE29,0xFE08,0xF587,0xED46,
-	0x9C4D,0xE527,0xED45,0xE504,0xE4E4,0xECE5,0xF507,0xF548,
-	0xFD69,0xFD88,0xF588,0xF567,0xED66,0x7BEF,0x1297,0x1274,
-	0x0A51,0x124F,0xF5D0,0xEDAF,0xEDAF,0xF5AF,0xF5AF,0xF5CF,
-	0xE5AF,0x32B0,0x01D0,0x01F0,0x0231,0x0231,0x020F,0x0A72,
-	0x1317,0x1359,0x137A,0x135A,0x3377,0xBCC9,0xED84,0xF5A5,
-	0xF566,0xF4E6,0xF4A7,0xF487,0xF466,0xEC46,0xEC46,0xE425,
-	0xE445,0xE445,0xE465,0xEC85,0xECC6,0xECE7,0xED28,0xF549,
-	0xA141,0xA161,0xA161,0xA161,0xA161,0xA161,0xA181,0xA981,
-	0xA981,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9C2,0xA9C2,
-	0xB1C1,0xB1C1,0xB1C2,0xB1E1,0xB1E2,0xB1E2,0xB1E2,0xB202,
-	0xB202,0xB202,0xB202,0x8981,0x0000,0x0000,0x0000,0x0000,
-	0x0820,0x6921,0xB202,0xB201,0xB1E1,0xB1C2,0xA9C1,0xB1C1,
-	0xA9C1,0xA9A2,0x6901,0x0800,0x0000,0x0000,0x0000,0x0800,
-	0xA9E2,0xBA23,0xBA43,0xC263,0xC263,0xC283,0xCAC4,0xCAC4,
-	0xCAE4,0xCAE4,0xD304,0xCB04,0xD304,0xCB04,0xCB04,0xCB04,
-	0xD343,0xD343,0xCB62,0xCB62,0xCB62,0xCB62,0xCB82,0xCB82,
-	0xCB62,0xCB42,0xCB42,0xCB22,0xCB42,0xD362,0xD3A2,0xDBE2,
-	0xE403,0xDBE3,0xDBC3,0xD382,0xD382,0xD382,0xD382,0xCB43,
-	0xCB22,0xCB23,0xCB03,0xCB03,0xCAE3,0xCAE3,0xCB04,0xD324,
-	0xD344,0xD344,0xDB64,0xDB64,0xDB85,0xDB85,0xDB85,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A4,0xDBA4,0xDBA4,0xDBA4,0xDBA5,0xE3A5,0xE3C5,0xE3C5,
-	0xE3E5,0xDC24,0xE445,0x1BBB,0x1BDB,0x1BDA,0x1BFA,0x1C1B,
-	0x1BFB,0x1C1A,0x1C1A,0x1C1B,0x243B,0x245B,0x243A,0x1C1A,
-	0x13F9,0x13B9,0x0B98,0x0B78,0x0B17,0x0AD8,0x0A98,0x0A39,
-	0x7BEF,0xED46,0xED07,0xED29,0xED4B,0xED8C,0xEDCF,0xF5F1,
-	0xF654,0xFE95,0xFE96,0xFEB6,0xFEF7,0xFEF7,0xFEF6,0xFED6,
-	0xF695,0xF611,0xF58B,0xED27,0xED27,0xED27,0xED27,0xED27,
-	0xED27,0xED07,0xED06,0xED06,0xED07,0xED07,0xF56B,0xF5AC,
-	0xF58B,0xFD89,0xFDC9,0xFE09,0xFE29,0xFE08,0xF5A7,0xF546,
-	0xED46,0xF546,0xED45,0xED04,0xE504,0xED05,0xF507,0xF548,
-	0xFD69,0xFD88,0xF588,0xF567,0xF566,0x7BEF,0x1297,0x0A94,
-	0x0A51,0x0A2F,0xF5D0,0xF5B0,0xF5AF,0xF5AF,0xF5AF,0xF5CF,
-	0x6390,0x01D0,0x01D0,0x01F0,0x0231,0x0230,0x0A0F,0x0A72,
-	0x0B17,0x1359,0x135A,0x135A,0x135A,0x22F9,0xDD65,0xF5A5,
-	0xF546,0xFCE7,0xF4A7,0xF487,0xF466,0xEC46,0xEC25,0xE445,
-	0xE445,0xE465,0xE465,0xECA5,0xECC6,0xECE7,0xED28,0xF549,
-	0x9961,0xA161,0xA161,0xA161,0xA161,0xA161,0xA181,0xA981,
-	0xA981,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xA9C2,0xA9C1,
-	0xB1C1,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0x2880,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0820,0x99C1,0xB1E1,0xB1E2,0xA9E2,0xA9E2,
-	0xA9C1,0x60E1,0x0000,0x0000,0x0000,0x0000,0x0000,0x58E1,
-	0xB1E2,0xBA23,0xBA23,0xC263,0xC263,0xC283,0xCAA3,0xCAC4,
-	0xCAE4,0xCAE4,0xD304,0xD304,0xD304,0xD304,0xD304,0xD324,
-	0xD343,0xCB43,0xCB63,0xCB63,0xCB62,0xCB62,0xCB82,0xCB82,
-	0xCB62,0xCB42,0xCB42,0xCB22,0xCB22,0xCB42,0xD382,0xDBC3,
-	0xDBE2,0xDBE3,0xDBC3,0xD3A2,0xD382,0xD382,0xD382,0xD362,
-	0xCB42,0xCB22,0xCB03,0xCB03,0xCB03,0xCAE3,0xCB04,0xD324,
-	0xD324,0xD344,0xDB64,0xDB64,0xDB85,0xDB85,0xDB85,0xDBA4,
-	0xDBA4,0xDBC4,0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA5,0xE3A5,0xE3C5,
-	0xE3E5,0xE404,0xE445,0x1BBB,0x1BDB,0x1BDA,0x1BFA,0x23FB,
-	0x1C1B,0x1BFA,0x1C1A,0x243B,0x243B,0x245A,0x243A,0x1C3A,
-	0x13F9,0x13B9,0x0B98,0x0B78,0x0B17,0x0AD8,0x0A98,0x0A39,
-	0x7BEF,0xF546,0xED06,0xED08,0xED2A,0xED6C,0xEDAE,0xEDF1,
-	0xF633,0xFE75,0xFEB6,0xFEB6,0xFEF7,0xFEF7,0xFEF7,0xF6D6,
-	0xF6B5,0xF632,0xED8C,0xED27,0xED27,0xED27,0xED27,0xED27,
-	0xED27,0xED07,0xED06,0xED06,0xED07,0xED07,0xF56A,0xF5AC,
-	0xF58B,0xFD89,0xF5A9,0xFE09,0xFE29,0xFE08,0xF587,0xF546,
-	0xED46,0xF546,0xED45,0xED04,0xE504,0xED05,0xF527,0xF548,
-	0xFD69,0xFD89,0xF588,0xF567,0xF546,0x7BEF,0x1297,0x0A74,
-	0x0A51,0x0A2F,0xF5D1,0xF5D0,0xEDAF,0xF5AF,0xF5AF,0xD54F,
-	0x09F0,0x01D0,0x01D0,0x01F0,0x0231,0x022F,0x020F,0x0A72,
-	0x1337,0x1359,0x135A,0x137A,0x133A,0x12DB,0x9C6D,0xF5A5,
-	0xF546,0xF4E7,0xF4A7,0xF487,0xF466,0xEC46,0xEC25,0xE445,
-	0xE445,0xE465,0xE465,0xEC85,0xECC6,0xECE7,0xED28,0xF569,
-	0x9941,0x9961,0xA161,0xA161,0xA162,0xA181,0xA181,0xA981,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1E2,0xB1E2,0xB1C2,0xB1E2,0xB202,0xB202,0xB202,
-	0xB202,0xB202,0xB202,0xB202,0x99E1,0x0820,0x0000,0x0000,
-	0x0000,0x0000,0x1040,0xB201,0xB201,0xB1E1,0xA9E2,0xA9E1,
-	0xA9C1,0x7941,0x0000,0x0000,0x0000,0x0000,0x2060,0xB1C2,
-	0xB1E2,0xBA03,0xBA23,0xBA63,0xC283,0xC283,0xCAA4,0xCAC4,
-	0xCAE4,0xCAE4,0xD304,0xD304,0xD304,0xCB04,0xD324,0xCB24,
-	0xD343,0xD343,0xCB63,0xCB63,0xCB63,0xCB62,0xCB62,0xCB62,
-	0xCB62,0xCB62,0xCB42,0xCB42,0xCB22,0xCB42,0xD362,0xD3A2,
-	0xDBE2,0xDC02,0xDC02,0xDBC2,0xD3A2,0xD382,0xD382,0xD362,
-	0xCB62,0xCB22,0xCB23,0xCB03,0xCB03,0xCB03,0xCB24,0xCB24,
-	0xD324,0xD344,0xD364,0xDB64,0xDB85,0xDB85,0xDB85,0xDB85,
-	0xDBA4,0xDBC4,0xDBC4,0xD3A4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A3,0xD3A3,0xDBA4,0xDBA4,0xDBA5,0xDBA4,0xE3A5,0xE3A5,
-	0xE3E4,0xE405,0xE445,0xAC2A,0xAC0A,0xB40A,0xB40A,0xB3EA,
-	0xABEA,0xB3EA,0xABEA,0xABEA,0xABEA,0xB3EA,0xB3EA,0xB3EA,
+	0xF56A,0xC00D,0xB6F6,0x7DB6,0xA6E6,0x64ED,0x65AD,0xAC9C,
+	0x9A81,0x0000,0xF5AD,0xC007,0x90A3,0xAB9B,0x5DA3,0x9DA4,
+	0x8002,0xED26,0xC003,0x9CED,0x64A3,0x8002,0xED06,0x0004,
+	0xE4E6,0xCCA8,0xB46B,0x8C0F,0x83F0,0x8002,0x7BEF,0x0003,
+	0x8C2F,0xBD0D,0xDDCA,0xF647,0xC008,0x8344,0x9CED,0x5B4A,
+	0x53EE,0xF500,0x0000,0xFD07,0x8002,0xFD28,0xC007,0x6DAE,
+	0x76AD,0x9C94,0x9BA4,0x8002,0xED2D,0x0006,0x7BEF,0x12B2,
+	0x0AB2,0x0A92,0x0A93,0xD52C,0xF5AA,0xC004,0xD453,0x9BA4,
+	0xAD00,0x0009,0xF5CE,0xF5EF,0xED29,0xECA5,0xCC67,0x5BB4,
+	0x4B75,0x63B2,0xDD46,0xF506,0xC00B,0x9594,0xA35C,0x9C5B,
+	0xA4AC,0xADB5,0xADF5,0x8003,0x8101,0xC005,0xA3AD,0xA4E4,
+	0xA4EC,0x8002,0x9940,0xC008,0xACA5,0xA49C,0xA4AC,0xE4A4,
+	0xA500,0x8002,0xA181,0x0001,0xA1A1,0xA1A1,0x8014,0x0000,
+	0x0001,0x6161,0xCAE2,0xC00F,0xA4B4,0xACAC,0xF4B3,0xFDAC,
+	0xA454,0x9494,0x4C94,0xA464,0x8004,0xCB02,0xC008,0xA5A4,
+	0x9BA4,0xA564,0x9BA4,0x9C00,0x8002,0xC2A3,0xC009,0xACE4,
+	0xADAC,0xE4AC,0xA4AC,0xACA4,0x8002,0xD384,0x0002,0xD3A4,
+	0xD3C4,0xD3C3,0x8002,0xD3A3,0x8002,0xD383,0xC016,0x5CE4,
+	0xA4A5,0xACA4,0xE4A5,0xACAB,0xACAC,0xACEC,0x6CA4,0x9C94,
+	0xA4E5,0xA464,0x6500,0x0006,0xE405,0xCC08,0x7BEF,0x7BEF,
+	0xA42C,0xD469,0xF4C7,0xC003,0x75F6,0xB5B6,0x0000,0xF64E,
+	0xC00A,0xB6E6,0xA666,0xACE4,0x6DED,0x649B,0x8900,0x0001,
+	0xF5EF,0xF58A,0xC005,0x9AA3,0xA463,0x9C9D,0x8004,0xED26,
+	0x8002,0xED27,0x0009,0xED06,0xAC6C,0x63B2,0x2318,0x1319,
+	0x1319,0x12D6,0x0A51,0x020F,0x0A53,0xC003,0xA753,0x9496,
+	0x0004,0x1217,0x5353,0x9C4D,0xDCE7,0xED46,0xC003,0x9C52,
+	0x4BE5,0x0000,0xF4C6,0xC00B,0xB5ED,0xA4A3,0x6EAE,0xB66D,
+	0x9C9C,0x94A4,0x8002,0xED2D,0x0007,0x7BEF,0x12B2,0x0AB2,
+	0x0A92,0x0A73,0x32F2,0xDD4C,0xFD6A,0xC003,0x53DB,0x5BBE,
+	0x0002,0xF5CF,0xF5AF,0xED28,0xC012,0x899B,0x6CFC,0xBCDD,
+	0x8D8C,0x9DA3,0x54A4,0x5BA4,0xACAD,0xB5AD,0xF500,0x0001,
+	0x8101,0x8101,0x8003,0x8121,0xC00C,0xE49C,0xF4A4,0xE3A5,
+	0xABA4,0xA5A4,0x9CA4,0xAC00,0x8002,0xA161,0xC004,0xAC9C,
+	0xACA4,0xAC00,0x8002,0x0000,0x0000,0x0800,0x8003,0x2860,
+	0x0001,0x2880,0x0820,0x8002,0x0000,0x0000,0x2880,0xC003,
+	0xA4EC,0xA414,0x8002,0x0000,0x0001,0x6161,0xCAE2,0xC00F,
+	0xA4AC,0xACAC,0xACB4,0xFCEC,0xB3A5,0x9C4C,0x8C54,0x9C5C,
+	0x8005,0xCB02,0x0000,0xCB03,0x8002,0xCAE2,0xC003,0x65A4,
+	0x9CA3,0x8002,0xC2A3,0xC012,0xACE4,0xACAD,0xACE4,0xA4AB,
+	0xADA4,0xACA4,0xACA4,0xACA3,0xA49C,0xA400,0x8002,0xD383,
+	0xC012,0x5CE4,0xA4A5,0xA4AC,0xE5A4,0xACA3,0xADB4,0xABEC,
+	0x64AC,0xDC5C,0x5E00,0x8006,0xE405,0xC013,0xADF4,0xB4ED,
+	0xADBD,0xAEBD,0xBEB5,0xA7AE,0xA5AD,0xA4ED,0x6DA4,0xDB53,
+	0x0001,0xF611,0xF58C,0xC005,0x996A,0xE45B,0x9C9D,0x8004,
+	0xED26,0x0003,0xED27,0xF527,0x8C0E,0x2B36,0x8002,0x12F9,
+	0xC00A,0xACA3,0x9240,0x52F7,0xA75B,0x8C96,0xAD00,0x0008,
+	0x0A39,0x12B9,0x12D9,0x63B2,0xD4C8,0xE4E4,0xDCA3,0xE484,
+	0xF4E6,0xC00E,0xAEEC,0xA464,0xADAE,0x76A5,0xA494,0x9CA4,
+	0xA3A4,0x9C00,0x0001,0x8C2F,0x12B2,0xC009,0x649C,0x9D5D,
+	0xA5B4,0xF5AD,0xA492,0x0002,0x0A30,0x4331,0xED07,0xC012,
+	0x8AAB,0x6DF3,0xBCDD,0x8D8C,0x9C64,0xDC5C,0x5BA4,0xACAD,
+	0xB5AD,0xF500,0x0000,0x8101,0x8004,0x8121,0x0001,0x8921,
+	0x9121,0x8003,0x9941,0x8004,0x9961,0xC009,0xDC6C,0xE4A4,
+	0xACA4,0x9CA5,0xABA4,0x8002,0x0000,0x0001,0x2860,0xA1A1,
+	0xC003,0xECA4,0xAC9C,0x0000,0x2880,0x8002,0x0000,0x0004,
+	0xBA22,0xBA42,0xC262,0xC282,0x91E2,0x8002,0x0000,0x0001,
+	0x6161,0xCAE2,0xC00F,0xA4AC,0xA4AC,0xACAC,0xF4B4,0xF4B4,
+	0xA49C,0x444C,0x9C9C,0x8003,0xCB02,0xC009,0xACA4,0x9CA5,
+	0xA3A4,0xA563,0x9D9C,0x8002,0xC2A3,0xC009,0xACE4,0xACA5,
+	0xECAC,0xA4AC,0xACA4,0x8002,0xD384,0x0001,0xD3A4,0xD3C4,
+	0x8002,0xD3C3,0x8003,0xD383,0xC005,0x5CE4,0xA4A5,0xA4AC,
+	0x8002,0xDB85,0xC008,0xACAC,0xB4AB,0xEC6C,0xA4DC,0x5400,
+	0x0002,0x2BF9,0xA40C,0xDC05,0x8004,0xE405,0xC005,0xACB5,
+	0xF4AD,0xACF6,0x0002,0xD50C,0x7BEF,0xF60D,0xC00B,0xBDA7,
+	0xE666,0xADA4,0xEC6D,0xADE4,0x5388,0x0000,0xF5AE,0xC005,
+	0x985A,0xEB5B,0x9C9D,0x8004,0xED26,0x0003,0xC4CA,0x3B35,
+	0x0AD8,0x12D8,0x8002,0x12F9,0xC00A,0xACA4,0x9148,0x92AF,
+	0xA753,0x9496,0xAD00,0x0009,0x0A39,0x12B9,0x12D9,0x0AB9,
+	0x1AF8,0x8C0E,0xDCA3,0xE4A5,0xF4C6,0xF508,0x8002,0xFD28,
+	0xC00A,0x6CAE,0x76A6,0xA49C,0x9C9C,0xA39C,0xAC00,0x0001,
+	0xD4EE,0x12B2,0xC00A,0x5CA4,0x9D5D,0xA5B4,0xF56D,0xE489,
+	0x8800,0x0001,0x4B51,0xE4E6,0xC00B,0xD2AC,0x6DF4,0xBBDD,
+	0x4DCC,0x9CA4,0x5C9C,0x8002,0xE425,0xC003,0xB5B5,0xF5AD,
+	0x0000,0x8101,0xC004,0xACA4,0xA3E5,0x6400,0x0001,0x9121,
+	0x9141,0x8003,0x9941,0xC003,0xACA3,0xA5A4,0x8004,0xA161,
+	0xC005,0xACA4,0x9DA3,0xACA4,0x8002,0x0000,0x0001,0x2860,
+	0xA9A2,0xC003,0xA3AC,0xE56B,0x0000,0x2860,0x8002,0x0000,
+	0x0004,0xBA02,0xBA22,0xBA62,0xC282,0x91E2,0x8002,0x0000,
+	0x0001,0x6161,0xCAE3,0xC00F,0xA3A4,0xACAC,0xA4AC,0xACF4,
+	0xB4B4,0xF4A4,0x944C,0x5494,0x8004,0xCB02,0x0001,0xCB22,
+	0xCB23,0x8004,0xCB03,0xC013,0x5C9C,0x9C9C,0xACAC,0xE4AC,
+	0xACA5,0xECA4,0xACAC,0xA4AC,0xE4A4,0xAC64,0x8002,0xD3C3,
+	0x0000,0xD3A3,0x8002,0xD383,0xC005,0x5CE4,0xA4A5,0xA4AC,
+	0x8002,0xDB85,0xC008,0xACAC,0xACB3,0xECA4,0x64E4,0x5400,
+	0x0004,0x1BFB,0x23FA,0x5BF4,0xD406,0xE405,0xC007,0x64E4,
+	0xA4AC,0xEDB4,0xADB4,0x0003,0x8C0F,0x1AD5,0x4332,0xF60C,
+	0xC00B,0xB6AE,0xA6A6,0xADAD,0xA4AD,0xE56C,0x9B8A,0x0001,
+	0xF5F0,0xF58B,0xC008,0xA1A3,0x5B9C,0x9DAC,0x9CA3,0xA500,
+	0x0001,0x9C4D,0x12D8,0xC010,0x64A4,0xE5AB,0xA5A4,0xAC9C,
+	0x9940,0x9AAF,0xA75B,0x8C9D,0xA600,0x0001,0x0A39,0x12B9,
+	0xC003,0xAC5C,0xECF6,0x0002,0x5BB4,0xD486,0xF4E6,0xC00F,
+	0xEEAC,0xA4A3,0x6EAD,0x76A6,0xA49C,0x9C9C,0xA39C,0xA4AC,
+	0x0001,0x7BEF,0x0AB2,0xC009,0x9C95,0x64A5,0xB5B5,0xEDA4,
+	0x8091,0x0001,0x4352,0xE4C6,0xC00B,0xE364,0xACFC,0xB3D5,
+	0x958C,0x9D9B,0x5CA3,0x8002,0xE425,0xC003,0xB5B5,0xF5AD,
+	0x0000,0x8101,0xC006,0xACA3,0xE4AD,0x9CEC,0xEC00,0x8002,
+	0x9941,0x8002,0x9961,0x8003,0xA161,0x0001,0xA162,0xA161,
+	0x8006,0xA181,0x8002,0x0000,0x0001,0x2860,0xA9A2,0xC003,
+	0xA3A4,0xACA4,0x0000,0x2860,0x8002,0x0000,0x0004,0xBA22,
+	0xBA22,0xBA42,0xC262,0x91E2,0x8002,0x0000,0x0000,0x6161,
+	0x8002,0xCAE2,0xC017,0xACAC,0xA4AC,0xA4AC,0xFCB4,0xF4AB,
+	0xA554,0x8C4C,0x9C9C,0xA49C,0xA4AC,0xA5A4,0x9CA4,0x8002,
+	0xCB02,0xC012,0x5D9C,0x9CA4,0xACE4,0xACA5,0xACE4,0xACAC,
+	0xA4AC,0xA4EC,0xA4AC,0x6400,0x8002,0xD3C3,0x0000,0xD3A3,
+	0x8002,0xD383,0x8002,0xCB63,0xC00E,0xE4A5,0xACE4,0xAD9C,
+	0xACAC,0xEC6C,0xB3AC,0xA4DC,0x5C00,0x0005,0x23FB,0x23FB,
+	0x23FA,0x2BF9,0xA40B,0xDC25,0xC004,0x9CE4,0xACAD,0xF400,
+	0x0005,0xD469,0x4B94,0x12F7,0x0AB6,0x4332,0xF60C,0xC00C,
+	0xB5AE,0xA7A6,0xADA5,0xACAD,0xA4A5,0xE393,0x4000,0x0000,
+	0xF5AC,0xC003,0x98A3,0x5C9B,0x8002,0xED27,0x0002,0xED26,
+	0x9C4D,0x12D8,0xC003,0xA464,0xA4E4,0x8002,0x12F9,0xC00A,
+	0xAC9C,0x9148,0x9AAF,0x679B,0x8CD5,0x6D00,0x0001,0x0A39,
+	0x12B9,0xC004,0xAC5B,0xE6FD,0xF500,0x0002,0x4396,0xE4C7,
+	0xFD07,0xC008,0xADAC,0x9B65,0xB66E,0xB59D,0x9C00,0x8002,
+	0xED4E,0xC003,0x9BA4,0xACA4,0x0001,0x7C0F,0x0A92,0xC006,
+	0x559C,0xAEB4,0xB5ED,0xA400,0x0003,0x0A72,0x0A30,0x4B52,
+	0xECA5,0xC012,0xA464,0xB4FB,0xB4D5,0x8D95,0x9C9B,0x5CA3,
+	0x5CA4,0xACAD,0xB5B5,0xED00,0x0000,0x8101,0xC009,0xACE4,
+	0xACA4,0xE4E4,0xA4AC,0xA49C,0x8002,0x9961,0x8002,0xA161,
+	0x0000,0xA181,0x8002,0xA161,0x8002,0xA181,0x0002,0xA182,
+	0xA181,0xA181,0x8002,0x0000,0x0001,0x2860,0xA9A1,0xC003,
+	0xA5A4,0xA3A4,0x0000,0x2860,0x8002,0x0000,0x0004,0xB202,
+	0xBA22,0xBA22,0xBA62,0x91E2,0x8002,0x0000,0x0002,0x6161,
+	0xCAE2,0xCAE2,0x8002,0xCB02,0xC00D,0xACAC,0xA4AC,0xACAC,
+	0xFCF4,0xAC9C,0x5494,0x4C9C,0x8005,0xCB22,0xC01B,0xA5A4,
+	0xA3A4,0x9D5C,0x9C9C,0xA4AC,0xA4E4,0xACAD,0xE4AC,0xACA4,
+	0xACA4,0xECA4,0xACA4,0x6CA3,0xA49C,0x8002,0xD383,0xC011,
+	0x9CA4,0x64E4,0xA5AC,0xA4E5,0xA4AC,0xACEC,0x6CB3,0xE46C,
+	0x9C9C,0x0001,0x1BFB,0x23FB,0x8002,0x23FA,0x000B,0x6BF2,
+	0xD406,0xE405,0xE425,0xE446,0x8C0E,0x2377,0x0B38,0x0B17,
+	0x0AD6,0x4332,0xF5EB,0xC00C,0xB5B6,0xA79E,0xAEAC,0xADA5,
+	0xACE5,0xAC9B,0x4000,0x0001,0xF5CE,0xF589,0xC005,0x62DC,
+	0x9C5B,0xA5A4,0x0001,0xB48B,0x12D9,0xC012,0xA4A3,0x64A4,
+	0xE4A4,0xADA3,0xA5A3,0x5A80,0x9AB7,0x5F9B,0x8D9C,0xA500,
+	0x0001,0x0A39,0x12B9,0xC005,0xAC9B,0xAEF5,0xF464,0x0001,
+	0x53B3,0xFD07,0xC00A,0xADAC,0x9B65,0xAEB6,0x759E,0x9B9C,
+	0x9C00,0x8004,0xED4D,0x0005,0xF56D,0xDD2E,0x8C2F,0x6391,
+	0x4332,0x4352,0x8002,0x4373,0x0003,0x4331,0x4330,0x73D0,
+	0xECA5,0xC012,0x64AB,0xF4BC,0xACD5,0x8D95,0x94A3,0x5C63,
+	0x9CA4,0xACAD,0xB5B5,0xED00,0x0000,0x8101,0xC005,0xABE5,
+	0xA4EC,0xEC9C,0x8002,0x9961,0xC004,0x9CAC,0xA4E4,0x6300,
+	0x8004,0xA181,0xC003,0x9CAC,0xA4A5,0x8002,0xA181,0x8002,
+	0x0000,0x0001,0x2860,0xA9A1,0xC003,0x9CAD,0xA3A4,0x0000,
+	0x2860,0x8002,0x0000,0x0004,0xB202,0xBA02,0xBA22,0xBA62,
+	0x91E2,0x8002,0x0000,0x0001,0x6961,0xCAE2,0xC00B,0xADA3,
+	0xA4AD,0xA3AC,0xA4AC,0xA4AC,0xF4B4,0x8002,0xDC42,0xC01C,
+	0x944C,0x549C,0x9CA4,0xAC9D,0xA4A3,0xA5A4,0xA3A4,0x5C95,
+	0xA49C,0xACA4,0xE4AC,0xADE4,0xACA4,0xACAC,0xA400,0x8002,
+	0xDB84,0x0001,0xDBA4,0xD3A4,0x8002,0xD3C4,0x0000,0xD3A3,
+	0x8002,0xD383,0xC010,0x9C64,0xE4A5,0xACA4,0xE5A4,0xACAC,
+	0xACAC,0xECAB,0x65E3,0xA400,0x0000,0x2BF9,0xC004,0x66A3,
+	0xA5A3,0xA400,0x0004,0x3BF8,0xAC0A,0xCC08,0x4BF5,0x1399,
+	0xC003,0x945B,0x9C92,0x0001,0x4353,0xF5CA,0xC00D,0xBDAE,
+	0xA7A6,0xA6B5,0xACA5,0xE56C,0xA5E3,0x4A88,0x0000,0xF5AB,
+	0xC005,0x999B,0x9C5C,0xA45D,0x0000,0x22F8,0xC009,0x1DA3,
+	0xA464,0xA4E4,0xA4AD,0xA4AC,0x0002,0x4B74,0x5392,0x7BEF,
+	0xC003,0xED5B,0xA4A5,0x0004,0x42F3,0x3294,0x09B8,0x0A39,
+	0x12B9,0xC006,0xAC93,0xAEFD,0xEC6B,0x1300,0x0001,0x8C2E,
+	0xFD28,0xC009,0xAC9B,0x65AE,0xB66D,0xA69C,0x9CA3,0x8004,
+	0xED4D,0xC008,0xECAC,0xB4E3,0x9B93,0x935B,0xAD00,0x0002,
+	0xF5CE,0xF5AE,0xED08,0xC00B,0x89AC,0x64F4,0xBBAC,0xCE94,
+	0x959C,0x9B5C,0x8002,0xE425,0xC004,0xACAD,0xB5F5,0xAD00,
+	0x0000,0x8121,0x8002,0x8921,0x0000,0x9161,0x8006,0x9961,
+	0xC003,0xE4A4,0xACA4,0x8002,0xA161,0x8002,0xA181,0xC004,
+	0xA5A4,0xA3A4,0xEC00,0x8002,0x0000,0x0001,0x2860,0xA9A1,
+	0xC003,0x9CAC,0x9DAC,0x0000,0x2860,0x8002,0x0000,0x0004,
+	0xB202,0xBA02,0xBA22,0xBA42,0x91C2,0x8002,0x0000,0x0001,
+	0x6141,0xCAE2,0xC013,0xA5AC,0xA4AB,0xA4AC,0xA4EC,0xA464,
+	0xB4EC,0xB4F4,0xAC9C,0x548C,0x549C,0x8002,0xCB22,0x0001,
+	0xCB42,0xD323,0x8003,0xCB22,0xC009,0xA554,0x9C9C,0xACA4,
+	0xE4AC,0xADA3,0x8002,0xD324,0xC006,0xACAC,0xACA4,0xE464,
+	0xAC00,0x8002,0xD3C4,0x0000,0xD3A3,0x8002,0xD383,0x0000,
+	0xD363,0x8003,0xD364,0xC00C,0xACE4,0xA5AC,0xACA4,0xF46C,
+	0xEBAC,0x9D5B,0x1D00,0x0001,0x73F1,0x1BFA,0xC00A,0xA4E5,
+	0x63ED,0xA39B,0x5D5B,0x8C9B,0x5B00,0x0002,0x2B35,0xAC6D,
+	0xF5AA,0xC00D,0xBDB6,0xA6A6,0xA6B6,0xA4AD,0xA5A4,0xEDA4,
+	0x5288,0x0001,0xF5CD,0xF588,0xC003,0x9B5C,0xA49C,0x0001,
+	0x63B2,0x12D8,0xC005,0xA5A3,0xA464,0xA4E4,0x0003,0x22F8,
+	0x63B2,0xB48B,0xED06,0xC009,0xA4AF,0xFFB7,0x91A1,0xF5BC,
+	0xB304,0x0002,0x9C6E,0x4B74,0x12D9,0xC006,0x54ED,0xF5F5,
+	0x631A,0xD900,0x000B,0xED09,0xFD48,0xFD27,0xF528,0xF549,
+	0xD52C,0xB4EE,0x7BEF,0x638F,0x4B30,0xED4E,0xED4E,0x8002,
+	0xED4D,0xC009,0xECA5,0xABB4,0xEB94,0x9293,0x5BB6,0x0002,
+	0xF5CE,0xEDAD,0xECE7,0xC013,0x92A4,0x6BF4,0xBCA5,0xD48D,
+	0x9C9C,0x9C5C,0x5BA3,0xA4AD,0xADB5,0xF5AD,0x8002,0x8921,
+	0x0000,0x9141,0x8006,0x9961,0x0000,0xA161,0x8007,0xA181,
+	0x0000,0xA182,0x8002,0xA181,0x0002,0xA982,0xA181,0xA982,
+	0x8002,0x0000,0x0001,0x2860,0xA9A1,0xC003,0x9CA4,0xAD9B,
+	0x0000,0x2860,0x8002,0x0000,0x0004,0xB1E2,0xB202,0xBA02,
+	0xBA22,0x89C2,0x8002,0x0000,0x0001,0x6161,0xCAE3,0xC01F,
+	0xE4AC,0x64AC,0xE46B,0xA4EC,0x64A4,0xACAC,0xECB4,0xF5A3,
+	0xA454,0x8C54,0x9CA4,0x9CAC,0xA59C,0xACA4,0xA39C,0x5C9D,
+	0x8002,0xC2C3,0xC003,0xE4A4,0xACAC,0x8002,0xD324,0x0001,
+	0xD344,0xD364,0x8003,0xD384,0x0000,0xD3A4,0x8002,0xD3C4,
+	0xC004,0xA39C,0x9CA4,0x9C00,0x8003,0xD364,0xC00D,0xACA4,
+	0xE5AC,0xACA4,0xECAC,0xB36C,0xDD5B,0xA5DC,0x0002,0xCC08,
+	0x4BF5,0x23FB,0xC007,0xA3AC,0xA45C,0x9C9B,0x54DA,0x0001,
+	0x9C2D,0xF508,0xC00F,0xB5BC,0xB5BE,0xA69F,0xAEAD,0xADA5,
+	0xADA4,0xEDA4,0x9A92,0x0006,0xF5EF,0xF5A9,0xF567,0xED67,
+	0xED47,0xD4E9,0x12D8,0xC005,0xA5A4,0xA3A4,0x64A4,0x0002,
+	0x4B74,0xD4E9,0xED06,0xC003,0xA49C,0xACAE,0x0000,0xF58C,
+	0xC008,0xB791,0xE9AD,0xBCAB,0x6382,0x4400,0x0001,0x8C2E,
+	0x1AD8,0xC005,0x5EF5,0xF562,0x139A,0x000B,0x7BEF,0xFD48,
+	0xF547,0xF528,0xED49,0x83F0,0x1232,0x1231,0x1250,0x1271,
+	0xED4E,0xED4E,0x8003,0xED4D,0xC008,0xF4AC,0xACAB,0xD493,
+	0x92A4,0x6E00,0x0002,0xF5CE,0xED8C,0xECC6,0xC013,0x9BAC,
+	0x63FC,0xB4E5,0x8D95,0x9B9C,0x9C64,0x53A3,0xA4AD,0xADBD,
+	0xEDAD,0x0003,0x8921,0x8921,0x9121,0x9941,0x8006,0x9961,
+	0x0001,0xA161,0xA161,0x8006,0xA181,0x0001,0xA981,0xA181,
+	0x8002,0xA982,0x0001,0xA181,0xA9A2,0x8002,0x0000,0x0001,
+	0x2860,0xA9A1,0xC003,0x9CA4,0xA5AC,0x0000,0x2860,0x8002,
+	0x0000,0x0004,0xB1E2,0xB1E2,0xBA02,0xBA22,0x89A2,0x8002,
+	0x0000,0x0001,0x6141,0xCAC2,0xC026,0xADA4,0xB4E3,0xA56B,
+	0xA4EC,0xA464,0xACA4,0xACEC,0xACF4,0xAC9C,0x548C,0x5C9C,
+	0x9CAC,0xA59C,0xACA4,0xA39C,0x9D5C,0x9C9C,0xACA4,0xE4AC,
+	0xAD00,0x8002,0xD324,0x0001,0xD344,0xD364,0x8003,0xD384,
+	0x0000,0xD3A4,0x8002,0xD3C4,0xC005,0xA39C,0x9CA4,0x64DC,
+	0x8002,0xD364,0xC00F,0xACE4,0xA5AC,0xA4AC,0xACEC,0xB36C,
+	0xDD5C,0xA39C,0xE564,0x0001,0x73F1,0x1BFA,0xC004,0xEDA3,
+	0x5C9C,0x9B00,0x0002,0x3BB5,0xDC88,0xF4C7,0xC011,0xB5B5,
+	0xB4BD,0xB5A6,0xA7A6,0xB6AD,0xA5AD,0xA4ED,0xA3A4,0x5388,
+	0x0007,0xF5CB,0xF567,0xED47,0xED47,0x7BEF,0x12D8,0x12D9,
+	0x12D9,0x8002,0x12D8,0x0000,0x63B2,0x8002,0xED26,0x8002,
+	0xED06,0x0001,0xED28,0xF58C,0xC009,0xB692,0xE9B5,0xABB4,
+	0xA343,0x439C,0x0001,0xC4CA,0x22F8,0xC004,0x6FED,0x5B1A,
+	0x5A00,0x000B,0x12D6,0xFD48,0xF528,0xF527,0xF549,0x7BEF,
+	0x1252,0x1230,0x1270,0x1270,0xED6E,0xED4E,0x8002,0xED4D,
+	0xC00B,0xADEC,0xACEB,0xAB94,0x9393,0x63B7,0xBE89,0x0000,
+	0xECC6,0xC013,0x9BAC,0xA3BC,0xBCE5,0x8595,0x9C9B,0x9C5C,
+	0x5BA3,0xA5AC,0xADBD,0xEDB5,0x0001,0x8921,0x8920,0x8002,
+	0x9941,0xC007,0xACA4,0xE4A4,0xAC5C,0xA4E4,0x8005,0xA181,
+	0xC007,0xEC5C,0xA4ED,0xA39C,0xA4AD,0x8002,0x0000,0x0001,
+	0x2860,0xA9A1,0xC003,0xA5A4,0x9BAD,0x0000,0x2860,0x8002,
+	0x0000,0x0004,0xB1C2,0xB1E2,0xB1E2,0xBA02,0x89A2,0x8002,
+	0x0000,0x0001,0x6141,0xCAC3,0xC004,0xABA5,0xACA4,0xAC00,
+	0x8002,0xCB42,0xC00C,0xEC64,0xE4AC,0x64A4,0xF4B4,0xF4A4,
+	0x9C54,0x8C00,0x8002,0xCB42,0x8003,0xCB23,0xC00F,0xAB9C,
+	0x9DA3,0x5D94,0xA4AC,0xE4AC,0xADE4,0xACA4,0xACAC,0x8003,
+	0xD384,0x0000,0xDBA4,0x8003,0xD3C4,0x0001,0xD3A3,0xD3A3,
+	0x8003,0xD383,0xC010,0x9CA5,0xACE4,0xA5AC,0xACA4,0xACEC,
+	0xB36C,0xDCA4,0x5CDD,0x2500,0x0001,0x63F2,0x23FB,0xC006,
+	0xA3AD,0x639C,0xA493,0x5400,0x0002,0x2B96,0xB46B,0xECE8,
+	0xC010,0xF5BC,0xBCB5,0xA6A7,0xA7AD,0xAEAD,0xACA5,0xE4AC,
+	0xA49B,0x5100,0x0005,0xF5ED,0xF5A8,0xF566,0xED47,0x2B16,
+	0x12D8,0xC003,0xA5A4,0xA364,0x0004,0x2B16,0xE508,0xED27,
+	0xED26,0xED26,0x8002,0xED06,0x0001,0xED28,0xF58C,0xC00A,
+	0xB691,0xEAAD,0xBBAC,0x9B4B,0x43E4,0xAD00,0x0001,0x8C2E,
+	0x1AFB,0xC004,0xF512,0x639A,0x9C00,0x0008,0xAC6D,0xF527,
+	0xF527,0xED48,0x7BEF,0x1232,0x1230,0x124F,0x1270,0x8002,
+	0xED4E,0xC00D,0xA3A4,0xADEC,0xACB3,0xE394,0x939A,0x5CB7,
+	0xB648,0x0000,0xECA6,0xC013,0xA3AC,0x63FC,0xBCDD,0x8D95,
+	0x9C9B,0x9C5C,0x5BA3,0xA5AC,0xB5AD,0xF5AD,0x0001,0x8920,
+	0x9121,0x8002,0x9941,0xC003,0xACA4,0xE3AD,0x8003,0xA161,
+	0x8005,0xA181,0xC007,0xE5A3,0xACA4,0xA5A4,0x9BAD,0x8002,
+	0x0000,0x0000,0x2860,0x8002,0xA9A1,0x0002,0xA9A2,0xA982,
+	0x2860,0x8002,0x0000,0x0004,0xB1C2,0xB1C2,0xB1E2,0xBA02,
+	0x89A2,0x8002,0x0000,0x0001,0x6141,0xCAA3,0xC007,0xACAC,
+	0xACA4,0xACA4,0xABE4,0x8002,0xD362,0xC00A,0x6CA4,0x9CAC,
+	0xF4F4,0xB4A4,0x944C,0x9400,0x8002,0xCB42,0x0000,0xCB23,
+	0x8003,0xCB42,0xC00D,0x9C9C,0x5D9C,0xA4A5,0xA3EC,0xACA5,
+	0xECA4,0xACAC,0x8003,0xD384,0xC006,0xACA4,0xACA4,0xA39C,
+	0xA400,0x8003,0xD383,0xC003,0x9CAD,0xA4E4,0x8002,0xDBA5,
+	0xC007,0xECAC,0xACB3,0x6CDC,0xA45C,0x0001,0x940D,0x2BF9,
+	0xC00A,0x25E5,0xA3AD,0x63A4,0x9C9C,0x5393,0x9C00,0x0002,
+	0x5392,0xD4CA,0xF568,0xC00E,0xBDB5,0xAD9F,0xA7AE,0xB5AD,
+	0xADA5,0xE4AC,0xA5A2,0x5200,0x0004,0xF60F,0xEDA9,0xED66,
+	0xD4E9,0x12D8,0xC004,0xA5A4,0xAC9C,0x6300,0x0004,0xAC6C,
+	0xF527,0xED27,0xED27,0xED26,0x8002,0xED06,0xC00D,0xAFFF,
+	0xB692,0xA9ED,0xBCA3,0xA34B,0x439D,0xEC63,0x0001,0x3338,
+	0x1B3B,0xC003,0x9B1B,0x52A4,0x000A,0x73D0,0xF527,0xF527,
+	0xED48,0x7BEF,0x1232,0x1230,0x1250,0x1270,0xED6E,0xED6E,
+	0x8002,0xED4E,0xC008,0xACEB,0xACF4,0xA394,0x939A,0x5C00,
+	0x0000,0xF58D,0xC016,0xA448,0x80A4,0xAC6B,0xFCB4,0xDD8D,
+	0x959C,0x9B9C,0x5C5B,0xA3A5,0xACB5,0xADF5,0xB500,0x0001,
+	0x8921,0x9941,0xC003,0xAC9C,0xA4AC,0x8005,0xA161,0x8006,
+	0xA181,0xC007,0xEC9C,0xACA4,0xA5A4,0x9BA5,0x8002,0x0000,
+	0x0000,0x2860,0x8003,0xA9A1,0x0004,0xA982,0x68E1,0x50C1,
+	0x50C1,0x58C1,0x8002,0xB1C2,0x0001,0xB9E2,0x8982,0x8002,
+	0x0000,0x0001,0x6142,0xCAA3,0x8002,0xCAE3,0xC004,0xACA4,
+	0xEC6B,0xE400,0x8002,0xD362,0xC00D,0x6CA4,0x9CA4,0xB4EC,
+	0xB4EC,0xA49D,0x4B94,0x5CE4,0x8004,0xCB42,0xC003,0x9CA4,
+	0x5D9C,0x8002,0xC2C3,0xC00F,0xECAC,0xA5E4,0xACAC,0xA4AC,
+	0xACE4,0x64A4,0xACA4,0xACA4,0x8002,0xD3A3,0x8002,0xD383,
+	0xC003,0x9CAD,0xA4E4,0x8002,0xDBA5,0xC006,0xECAC,0xABB4,
+	0xACA4,0x9C00,0x0001,0x53F5,0x23FB,0xC004,0x63A4,0xE5A3,
+	0xAD00,0x0003,0x7C0F,0xC408,0x43F6,0x1BDA,0xC003,0x539B,
+	0x9C53,0x0001,0x4373,0xF568,0xC00F,0xBCB5,0xAE9E,0xA7AE,
+	0xAEB5,0xA5AD,0xA4AC,0xE5A3,0x9290,0x0004,0xF5CB,0xED86,
+	0xB4AB,0x12D8,0x12D8,0x8002,0x12D9,0x0001,0x2B16,0xF527,
+	0xC003,0xA464,0xA4A3,0x8002,0xED06,0x0001,0xED28,0xF58C,
+	0xC00B,0xB692,0xA9ED,0xBCA3,0xA34B,0x439D,0xF45B,0x0001,
+	0x8C2E,0x1B1B,0xC003,0xA31B,0x5A9C,0x0009,0x4353,0xF547,
+	0xF527,0xED48,0x7BEF,0x1232,0x1230,0x1250,0x1270,0xED6E,
+	0xC00E,0xA49C,0xA3A5,0xACEC,0xACF3,0x63D4,0x939A,0x65B7,
+	0xA400,0x0000,0xECE8,0x8002,0xECA5,0xC011,0x73FC,0xF49D,
+	0x8D8D,0xA49C,0x5B9C,0x5BA3,0xA5AC,0xB5B4,0xEEAD,0x0000,
+	0x9141,0x8002,0x9941,0x0000,0x9961,0x8002,0xA161,0x0002,
+	0xA181,0xA181,0xA161,0x8002,0xA181,0x8004,0xA1A1,0x0001,
+	0xA9A1,0xA981,0x8004,0xA9A2,0x0000,0xA982,0x8002,0x2860,
+	0x0002,0x48C1,0xA9C1,0xA9C1,0x8002,0xA9A1,0xC003,0x9DAC,
+	0xDCAC,0x8002,0xB1C2,0x0007,0xB1E2,0xA9E2,0x8982,0x91A2,
+	0x91C2,0xAA23,0xCAA3,0xCAC3,0x8002,0xCAE3,0xC008,0xACEC,
+	0xA4AB,0xACA4,0x6CE4,0xA400,0x8002,0xCB62,0xC008,0xB4EC,
+	0xF4B4,0x5C9C,0x849C,0x9C00,0x8005,0xCB42,0xC006,0x9C9D,
+	0x5C9C,0x9CAC,0xEC00,0x8002,0xCB04,0xC00B,0xECAC,0xA4AC,
+	0xACE5,0x63A4,0xECAC,0x64A4,0x8002,0xD3A3,0x8002,0xD383,
+	0xC00D,0x9CA5,0xACE4,0xA5AC,0xA4AC,0xEBAC,0xB46C,0xE49D,
+	0x0000,0x23DA,0x8002,0x1BFA,0x000C,0x23FB,0x43F6,0xBBE9,
+	0xE3E5,0xDBE5,0xE405,0x7BEF,0x1399,0x1378,0x1358,0x0B17,
+	0x4393,0xF548,0xC00F,0xBCBC,0xA6A6,0x9FB7,0xADAE,0xACAD,
+	0xA5AC,0xE5A3,0x9C50,0x0003,0xF5ED,0xF5A7,0x8C2F,0x12D8,
+	0x8002,0x12D9,0x0003,0x12D8,0x5393,0xF527,0xF527,0x8002,
+	0xED27,0x8002,0xED06,0x0001,0xED28,0xF58C,0xC00B,0xB691,
+	0xAAED,0xBCA3,0xA34B,0x43E5,0xAC5B,0x0001,0xBCA8,0x1B3C,
+	0xC003,0x5263,0x52A4,0x000A,0x22F5,0xF527,0xF527,0xED48,
+	0x7BEF,0x1253,0x1230,0x0A50,0x1270,0xC4EF,0xED6E,0xC00D,
+	0x9CA3,0xA4ED,0xACAC,0xF3A3,0x9493,0x5BA5,0xBF9B,0x0000,
+	0xECE8,0xC014,0x91A4,0xACAB,0xBCFC,0x958D,0x8DA4,0x9C5B,
+	0x9B5C,0xA3A5,0xACB5,0xB4EE,0xB500,0x8003,0x9941,0x0000,
+	0x9961,0x8002,0xA161,0x8007,0xA181,0x8005,0xA9A1,0x8002,
+	0xA9A2,0x0001,0xA9A1,0xA9A2,0x8009,0xA9A1,0x0002,0xA982,
+	0xB1A2,0xB1A2,0x8002,0xB1C2,0xC008,0xECA4,0xADB4,0xECA4,
+	0xACEC,0xAC00,0x8002,0xCAE3,0xC004,0xB4E4,0xA46B,0xEC00,
+	0x8002,0xD382,0xC00F,0x649C,0xA3A5,0xF4B4,0xECB4,0x9C4C,
+	0x949C,0x5CA4,0xE4A4,0x8002,0xCB42,0x0001,0xCB23,0xC303,
+	0x8002,0xC2C3,0xC011,0xECA4,0xADA4,0xECA4,0xACEC,0xA5AB,
+	0x64E4,0xA4AC,0x6C9C,0xA4A3,0x8003,0xD383,0xC00D,0x9DA3,
+	0xADE4,0xA5AC,0xA4AC,0xE46C,0xF3B4,0xA49D,0x0000,0x23DB,
+	0x8002,0x1BFA,0x0001,0x73F1,0xE405,0xC004,0x5BA5,0xA4EC,
+	0xAC00,0x0005,0xC42A,0x3BB5,0x1358,0x0B37,0x4373,0xF548,
+	0xC00A,0xB4BC,0xADA7,0x9EA6,0xB7AE,0xB4AD,0xE400,0x8003,
+	0xFED7,0x0005,0xFE95,0xF630,0xF5A9,0x7BEF,0x12B8,0x12B8,
+	0x8002,0x12D9,0x0000,0x7C0F,0x8002,0xED27,0x0000,0xED26,
+	0x8002,0xED06,0x0002,0xED07,0xED28,0xF58C,0xC00C,0xAE99,
+	0xA2F5,0xBCAB,0x9B4B,0x43E5,0xA463,0x5200,0x0000,0x1B1B,
+	0xC004,0xA31B,0x5A9C,0x9C00,0x0009,0xF548,0xF527,0xED48,
+	0x7BEF,0x1253,0x1231,0x0A4F,0x1270,0x8C30,0xED6E,0xC00D,
+	0xA49C,0xACEC,0xA4B4,0xB3E4,0x8C92,0x5BAD,0xB79A,0x0000,
+	0xECC7,0x8002,0xECA5,0x0001,0xECE5,0xED64,0xC007,0xB4CD,
+	0x9595,0x9C9B,0x5C5B,0x8002,0xE425,0xC004,0xACB5,0xF4B6,
+	0xA500,0x8002,0x9941,0x8002,0x9961,0x0000,0xA161,0x8007,
+	0xA181,0x8006,0xA9A1,0x8002,0xA9A2,0x8006,0xA9A1,0x0000,
+	0xA9C1,0x8003,0xA9A1,0x0002,0xA9A2,0xB182,0xB1A2,0x8003,
+	0xB1C2,0xC00F,0xEDAC,0xACEC,0xACAC,0xECAC,0xACA4,0xEC64,
+	0xACA4,0xABEC,0x8002,0xD382,0x0000,0xCB82,0x8002,0xCB62,
+	0xC009,0xACEC,0xB4F4,0xAD94,0x4B9C,0x9C9C,0x8005,0xCB42,
+	0x0001,0xCB03,0xC2E3,0x8002,0xC2C3,0xC008,0xECA4,0xADEC,
+	0xA4AC,0xACE5,0x6300,0x8002,0xDB84,0xC004,0xAC64,0xAC9C,
+	0xA300,0x8003,0xD383,0xC00D,0x9DAB,0xA5E4,0xA5AC,0xA4AC,
+	0xE46C,0xB3EC,0xAC5D,0x0004,0x23DA,0x23DA,0x33F8,0xAC0A,
+	0xDC04,0xC007,0xE55B,0xA5AC,0x9CEC,0xF52E,0x0003,0x73F0,
+	0x0B37,0x4373,0xF528,0xC010,0xBCB4,0xB59E,0x9EAF,0xB6AE,
+	0xB5A5,0xACED,0xA4A5,0xA35A,0x8800,0x0002,0xF5CB,0x7BEF,
+	0x12B8,0xC003,0xA4AD,0xA4A3,0x0004,0x8410,0xED47,0xED27,
+	0xED27,0xED26,0x8002,0xED06,0x0002,0xED07,0xED28,0xF58C,
+	0xC00C,0xB691,0xA2F5,0xBCAB,0x5B8B,0x43DD,0xAC63,0x4A00,
+	0x0000,0x1B1B,0xC004,0x6353,0x5AA4,0x9C00,0x0009,0xF547,
+	0xF527,0xED48,0x9C4E,0x1253,0x1251,0x0A4F,0x1270,0x2AD0,
+	0xED6F,0x8002,0xED6E,0xC00A,0xECAC,0xACF3,0xA48C,0x925B,
+	0xB6AE,0x9100,0x0000,0xECC7,0x8002,0xECA5,0x0001,0xED05,
+	0xED84,0xC00F,0xE495,0x8D95,0xA494,0x635B,0x9CA4,0xACAC,
+	0xADF4,0xB6AD,0x0001,0x9941,0x9941,0x8002,0x9961,0x0001,
+	0xA161,0xA161,0x8006,0xA181,0x8007,0xA9A1,0x8006,0xA9A2,
+	0x8002,0xA9A1,0x000A,0xA9C1,0xA9A1,0x8961,0x7121,0x50C0,
+	0x58C1,0x58C1,0x60E1,0x8141,0xA1A2,0xB1C2,0xC015,0xA4EC,
+	0xADAC,0xF4A4,0xACE4,0xB4A5,0xACA3,0xACAC,0xA4AB,0xECA4,
+	0xACA4,0x64E4,0x8002,0xCB62,0xC00B,0xECB4,0xB4EC,0xA55B,
+	0x8C9C,0x9C5C,0xA4E4,0x8002,0xCB42,0x0001,0xCB23,0xC2E3,
+	0x8002,0xC2C3,0xC011,0xECA4,0xADA4,0xECAC,0xA4EC,0x64EC,
+	0xA464,0xEC64,0xAC9C,0xA3A4,0x8002,0xD383,0x0000,0xD364,
+	0x8002,0xD384,0xC009,0xE5AC,0xA4AC,0xE46B,0xB4ED,0xAB9D,
+	0x0006,0x23DA,0x73F1,0xD406,0xE405,0xDC04,0xDC05,0xDBE4,
+	0x8002,0xDBE5,0xC003,0xECF5,0xACAD,0x0002,0xB46C,0x63B2,
+	0xF528,0xC00B,0xBBB4,0xB59E,0x9EA7,0xB6AF,0xB5AD,0xA4ED,
+	0x8002,0xFED7,0x0004,0xFED6,0xF693,0xF5EE,0x7BEF,0x12B8,
+	0xC003,0xA4AC,0xA5A3,0x0004,0x73D1,0xF547,0xED27,0xED27,
+	0xED26,0x8002,0xED06,0x0002,0xED07,0xED28,0xF58C,0xC00C,
+	0xAE99,0xA2F5,0xBCAB,0x5B8B,0x43E5,0xA463,0x5200,0x0000,
+	0x1B1B,0xC004,0x5B5A,0x5BE4,0x5C00,0x0004,0xF547,0xF527,
+	0xED47,0xD52B,0x1253,0xC003,0x9A6A,0xE5AC,0x0000,0x7BEF,
+	0x8002,0xED6E,0xC00B,0xECAC,0xACF4,0xA38C,0x8B62,0xB6B6,
+	0x8040,0x8002,0xECA5,0x000A,0xED04,0xED84,0xF585,0xF545,
+	0xF4E6,0x73F1,0x0B78,0x0B99,0x2BB7,0xC429,0xE425,0xC006,
+	0xAC9C,0xB4AD,0xF4B6,0xAD00,0x0003,0x9941,0x9941,0x9961,
+	0x9961,0x8002,0xA161,0x8006,0xA181,0x8003,0xA9A1,0x8005,
+	0xA9A2,0x0000,0xA9C2,0x8004,0xA9A2,0x0003,0xA9A1,0xA1A1,
+	0x50E0,0x1040,0x8007,0x0000,0x0002,0x2860,0x7121,0xB9E2,
+	0xC027,0xADAC,0xECAC,0xA4AC,0xEDAC,0xA4AB,0xACA4,0xECA4,
+	0xABAD,0xA3AC,0xA464,0xA49B,0x9DAC,0xACF4,0xF4AD,0xA354,
+	0x9494,0x5DE3,0xACA4,0x649C,0x9D5C,0x8002,0xC2C3,0xC011,
+	0xE5AB,0xADA4,0xECA4,0xACE4,0xACAC,0xA464,0xEC64,0xACA4,
+	0x9BA4,0x8002,0xD383,0x8002,0xD384,0x0001,0xDB84,0xDB85,
+	0x8002,0xDBA5,0xC005,0xACEC,0xB3AD,0xA3A5,0x0001,0xAC0A,
+	0xDC24,0xC004,0x9DE4,0xA45C,0xAC00,0x8002,0xDBE5,0xC017,
+	0xECAD,0xECBD,0xECAD,0xB4B3,0xBCAC,0xA69F,0xA6AE,0xB7AD,
+	0xADAD,0xEDAC,0xA5A3,0xA35A,0x0002,0xF610,0x9C6E,0x12B8,
+	0xC003,0xA4AD,0xA3A4,0x0000,0x3B35,0x8002,0xED27,0xC005,
+	0xA3A4,0x9CA4,0xA5AD,0x0000,0xF58C,0xC00B,0xAE99,0xE2B5,
+	0xBCAB,0x9B4B,0x43E5,0xA463,0x0003,0xB46A,0x1B1B,0x12FA,
+	0x0AD9,0x8002,0x02B7,0x0006,0xFD47,0xF547,0xED47,0xED89,
+	0x4B32,0x1251,0x0A30,0x8002,0x1270,0x0001,0x7BEF,0xED6E,
+	0xC00F,0xA4E4,0xB4F4,0xACA3,0x8B94,0x5BB6,0xAD40,0x80A3,
+	0xA463,0x000A,0xED24,0xED84,0xF5A5,0xF546,0x7BEF,0x0B58,
+	0x0B78,0x0B99,0x13B9,0x3BD6,0xE425,0xC006,0xA4AC,0xACAD,
+	0xF5B5,0xAD00,0x8002,0x9941,0x0002,0x9961,0xA161,0xA161,
+	0x8005,0xA181,0x8003,0xA9A1,0x0000,0xA981,0x8003,0xA9A1,
+	0x0000,0xA9A2,0x8002,0xA9A1,0xC004,0xAD9B,0xA5A3,0xA400,
+	0x0001,0x8141,0x0800,0x800B,0x0000,0x0002,0x2860,0xA1C2,
+	0xBA02,0xC00E,0xF5AC,0xA4AC,0xEDAC,0xA4AB,0xA4AC,0xECA4,
+	0xACAB,0xA400,0x8003,0xD382,0xC00E,0x6395,0xA4AC,0xECB4,
+	0xFCA5,0x9B54,0x9494,0xA4AC,0xA400,0x8002,0xCB42,0xC00B,
+	0x945C,0x9DA4,0xECA4,0xADA4,0xECA4,0xACAC,0x8002,0xDB64,
+	0xC03A,0xACAC,0x64A4,0xAC9B,0xA49C,0xA4A5,0xA4A3,0xA5E4,
+	0xA5AB,0xA5A4,0xACEC,0xB3AD,0xAB9D,0xA35C,0x9DE4,0xA45C,
+	0xA4EC,0x5CE4,0xACAD,0xECB5,0xECB5,0xB4B3,0xB4B4,0xA55F,
+	0xE6AE,0xB7AE,0xADAC,0xEEAD,0xA4A3,0xA39B,0x8900,0x0001,
+	0xBCEE,0x0A98,0xC004,0xECAD,0xA4A3,0xA400,0x0003,0xD4E9,
+	0xF527,0xED27,0xED26,0x8002,0xED06,0x0002,0xED07,0xED28,
+	0xF58C,0xC00B,0xAE99,0xE2B5,0xBCAB,0x9B4B,0x43E5,0xA45B,
+	0x0001,0x73D1,0x1B1B,0xC003,0x5B5B,0x9A5C,0x0006,0x4353,
+	0xFD47,0xF547,0xF547,0xED69,0xC4ED,0x1251,0xC004,0x9B6B,
+	0xE5AC,0xAC00,0x0003,0x2AF1,0x73D0,0x7BEF,0x83EF,0x8003,
+	0x7BEF,0x0002,0x8410,0x7BEF,0x83EF,0x8002,0x7BEF,0x0008,
+	0xB44A,0xECA5,0xECC5,0xED24,0xEDA4,0xF584,0xF546,0x4394,
+	0x0B58,0xC003,0xACAD,0xECE5,0x0000,0xE425,0xC006,0xA3AD,
+	0xABF5,0xAEB5,0xAD00,0x8002,0x9941,0x0002,0x9961,0xA161,
+	0xA161,0x8005,0xA181,0x8004,0xA9A1,0x0001,0xA9A2,0xA9C2,
+	0x8009,0xA9C1,0x0000,0x6901,0x800E,0x0000,0x0002,0x0820,
+	0x91A2,0xBA43,0xC006,0xE4AC,0xACED,0xACA4,0xA300,0x8002,
+	0xCB03,0xC013,0xEC64,0xECAC,0x6BE4,0xAC9C,0xA45C,0x9BA4,
+	0xEDB4,0xB4F5,0xA394,0x5494,0x8002,0xD342,0xC004,0xAC64,
+	0x9C9C,0x5500,0x8002,0xC2C3,0xC006,0xECA5,0xACEC,0xA4AC,
+	0xAC00,0x8003,0xDB64,0xC003,0xACAC,0x64AC,0x8002,0xD3A3,
+	0x8003,0xD383,0xC02E,0xA5A4,0xE5AB,0xA5A4,0xACAB,0xECB4,
+	0xA4A5,0xA35C,0x9DE4,0xA45C,0xA4A3,0xA4E4,0xA5F4,0xADB5,
+	0xACF5,0xACBB,0xACB4,0xA566,0x9EEF,0xB6B6,0xA6B4,0xADED,
+	0xA4A5,0xAB9B,0x4900,0x0002,0xE5AE,0x1296,0x0AB8,0x8002,
+	0x12D9,0x0002,0x0AD8,0x5393,0xF527,0xC006,0xA464,0x9CA3,
+	0xA4A5,0xED00,0x0000,0xF58C,0xC00B,0xAE99,0xA2F5,0xBCAB,
+	0x9B4B,0x43DD,0xAC14,0x0000,0x231A,0xC004,0x6563,0x539A,
+	0x5B00,0x0001,0x63B1,0xF548,0xC003,0xA36C,0xA5AF,0x0001,
+	0x8C2F,0x1230,0xC00F,0x6BA5,0xACE5,0xAC64,0x9C94,0x9C5C,
+	0xA4BD,0xB5A4,0x93EC,0x000A,0x1316,0x135A,0x7BEF,0xECA5,
+	0xECC5,0xED44,0xF5A4,0xEDA5,0xF526,0x4394,0x0B58,0xC003,
+	0xACAD,0xECA5,0x0000,0xE425,0xC006,0xA4AC,0xACAD,0xF5B5,
+	0xAD00,0x8002,0x9941,0x8002,0xA161,0x8004,0xA181,0x0002,
+	0xA9A1,0xA9A2,0xA9A2,0x8003,0xA9A1,0x8009,0xA9C1,0x0000,
+	0x8961,0x8006,0x0000,0x8003,0x2860,0x8005,0x0000,0x0002,
+	0x1840,0xB202,0xC243,0xC00E,0xACAC,0xEDA4,0xACA4,0xACAB,
+	0xA5EC,0x63AC,0xE46B,0xA400,0x8002,0xD382,0xC013,0x5CA3,
+	0x9DA4,0xECB4,0xBCEC,0x9C94,0x559C,0x9BA4,0xACA4,0x5C9D,
+	0x9C9C,0x8002,0xC2C3,0xC005,0xEDAC,0xA4EC,0xACAC,0x8003,
+	0xDB64,0xC004,0xACAC,0xA46C,0xA400,0x8002,0xD3A3,0x0001,
+	0xD383,0xD383,0x8002,0xD384,0xC02C,0xE5AB,0xA5A4,0xACAB,
+	0xECB4,0xA4A5,0xA35C,0x9DE4,0x5CEC,0x5CA4,0xA3E4,0xADEC,
+	0xADAD,0xB4ED,0xB4B4,0xBBAC,0xA59D,0x66EE,0xAFAF,0xB5AD,
+	0xF5AD,0xA4A5,0xABA3,0x8B00,0x0002,0xF610,0x3B13,0x12B8,
+	0xC004,0xACA5,0xA463,0xE400,0x0001,0x8C0E,0xED27,0xC011,
+	0xA4A3,0x9CA4,0xA5AD,0xFFAE,0x9AA2,0xF5B3,0xB49B,0x4B43,
+	0x9DEC,0x0001,0x5394,0x1AFB,0xC004,0xAC5B,0x5B9A,0x9C00,
+	0x0001,0x9C4E,0xF568,0xC004,0x9B64,0xB5AF,0xA700,0x0001,
+	0x7BEF,0x0A4F,0xC00E,0xA5EC,0xA5AC,0xA454,0x9C9C,0x53AD,
+	0xBDB5,0xA4D2,0xAD00,0x000A,0x0B17,0x135A,0x83EF,0xECA5,
+	0xECC5,0xED44,0xF584,0xF585,0xF526,0x63D2,0x0B58,0xC003,
+	0xACAD,0xECA5,0x0000,0xE425,0xC006,0xABA5,0xACF5,0xADB5,
+	0xED00,0x0000,0x9941,0xC004,0xA4AC,0xA4E4,0xA400,0x8003,
+	0xA181,0x0002,0xA981,0xA981,0xA9A2,0x8004,0xA9A1,0x8004,
+	0xA9C1,0xC004,0xE4A5,0xA364,0xE500,0x0000,0x1840,0x8003,
+	0x0000,0x0002,0x48A0,0x8961,0xA9C1,0x8002,0xA9A1,0x0003,
+	0xB1A1,0xB1A2,0x8141,0x3080,0x8003,0x0000,0x0001,0x5901,
+	0xC243,0xC003,0xACA4,0xECAD,0x8002,0xCAC4,0xC006,0xACAB,
+	0xA5AB,0xA4EC,0xAC00,0x8003,0xD382,0xC01E,0x649C,0xA49C,
+	0xACAC,0xF4FC,0xAC94,0x8D53,0x64DC,0xACA4,0x5C9C,0x9C5D,
+	0x9BA5,0xACE4,0xADA4,0xECAC,0xA4EC,0xA400,0x8002,0xDB84,
+	0xC004,0xACAC,0x64E4,0x6400,0x8002,0xD3A3,0x0000,0xD383,
+	0x8002,0xD384,0x0000,0xDB85,0x8002,0xDBA5,0xC003,0xACAC,
+	0xEBAC,0x8002,0xE445,0xC022,0xA35D,0xDCA4,0x649C,0xE463,
+	0xE4A5,0xEDB4,0xACB5,0xEDB4,0xB4B4,0xB36C,0x969E,0xEEB7,
+	0xAEB6,0xED6D,0xEDAC,0xA46C,0xE35B,0x8100,0x0002,0x8C2F,
+	0x12B8,0x12D9,0x8002,0x12D8,0x0003,0x0AD8,0x12D8,0x73D1,
+	0xE508,0xC004,0xE3A3,0xA5A4,0xA500,0x0000,0xF58B,0xC009,
+	0xAF99,0xE2B4,0xB4AC,0xA34B,0x8316,0x0001,0x63B2,0x12BA,
+	0xC005,0xB5E4,0x6B5B,0x925B,0x0000,0xED49,0xC006,0xEB9B,
+	0x6CAD,0xA7AF,0xE500,0x0002,0xAC90,0x2AD0,0x1270,0xC00C,
+	0xA4A5,0xA45C,0x9C94,0xA464,0xBDAD,0xE451,0xF700,0x0003,
+	0x1317,0x135A,0x7BEF,0xECA5,0xC004,0x73FC,0xBCDD,0x8D00,
+	0x0006,0xDC89,0x1377,0x0B78,0x0B99,0x13B9,0x73F1,0xE445,
+	0xC006,0xA4A3,0xADF5,0xB5AD,0xED00,0x0002,0x9941,0x9941,
+	0x9961,0x8002,0xA161,0xC005,0xACAC,0x9CA4,0xE4A4,0x8002,
+	0xA9A1,0x0001,0xA9A2,0xA9A1,0x8005,0xA9C1,0xC003,0xACE5,
+	0x9C63,0x0000,0x7941,0x8002,0x0000,0x0001,0x0800,0x9181,
+	0x8002,0xA9C1,0x8002,0xA9A1,0xC003,0xE464,0xEDA4,0x0000,
+	0x7121,0x8002,0x0000,0x0005,0x0820,0xB223,0xC263,0xC263,
+	0xC283,0xCAA4,0x8002,0xCAC4,0xC007,0xACA4,0xACAC,0xA3AC,
+	0xE46C,0x8002,0xD382,0xC00C,0x649C,0xA49C,0xA4AC,0xF4F4,
+	0xB5A3,0x9553,0x9500,0x8003,0xD362,0xC011,0x5C9C,0x9C54,
+	0xA5AC,0xA4ED,0xA4E4,0xACAC,0xE4AC,0xACA4,0x64E4,0x8002,
+	0xDBC4,0x0000,0xD3C4,0x8002,0xD3A3,0xC004,0x9CA4,0xA5A4,
+	0xE400,0x8002,0xDBA5,0xC003,0xACA4,0xF3AC,0x8002,0xE445,
+	0xC01C,0x9B5C,0xE5A4,0x649C,0xE463,0xE4A5,0xACED,0xB4B5,
+	0xECAD,0xBBB4,0xB4AB,0x5696,0xEFB6,0xB6AE,0xB5AD,0xEE00,
+	0x8002,0xFED7,0x0005,0xFEF7,0xF6D5,0xF673,0xE5AD,0x1AD6,
+	0x12D9,0x8002,0x12D8,0xC003,0x64E4,0xA5EB,0x0002,0x7BEF,
+	0xD4C9,0xED06,0xC009,0xA5A5,0xFFB6,0x9AE2,0xB4B4,0xACA3,
+	0x0003,0xE588,0x9C4D,0x2B16,0x0AB8,0xC005,0xE5B6,0xEC5B,
+	0x6352,0x0001,0x63B1,0xFD68,0xC003,0x649C,0xA26D,0x0000,
+	0xED8B,0xC003,0xAEE6,0x6D4B,0x0002,0x8C2F,0x3B10,0x1291,
+	0xC009,0x5CA4,0x9355,0x9BAD,0xBDAD,0xE35A,0x0004,0x0A94,
+	0x1338,0x135A,0x7BEF,0xECC5,0xC005,0xABBC,0xBCDD,0x8E8B,
+	0x0003,0xD489,0x840F,0x83EF,0x9C2D,0x8002,0xE445,0xC005,
+	0xA3AD,0xF5B5,0xADF5,0x8002,0x9941,0x8002,0xA161,0xC00A,
+	0xACAC,0x9CEC,0x9CA4,0xACA4,0xA5A4,0xA300,0x8002,0xA9C1,
+	0x0002,0xB1C2,0xB1C1,0xA9E2,0x8002,0xB1E2,0x0001,0xA9C1,
+	0x40A0,0x8002,0x0000,0x0001,0x6100,0xB1C2,0x8002,0xA9C1,
+	0x8003,0xA9A1,0xC003,0xE4AC,0xA5A4,0x0000,0x3880,0x8002,
+	0x0000,0x0004,0x7962,0xC263,0xC263,0xC283,0xCAA4,0x8002,
+	0xCAC4,0xC007,0xACA4,0xEC64,0xABEC,0xAC64,0x8003,0xD382,
+	0xC01D,0x649C,0xA49C,0xA4AC,0xF4F4,0xB49C,0x9455,0x9CA3,
+	0xA465,0xA39C,0x959B,0xA564,0xA4EC,0xA5EC,0xACA4,0xE4AC,
+	0x8002,0xDB84,0x0000,0xDBA4,0x8002,0xDBC4,0x0000,0xD3A4,
+	0x8002,0xD3A3,0x8002,0xD383,0xC008,0xA5E4,0xACA5,0xA4AC,
+	0xA4F4,0xAB00,0x8002,0xE445,0x0001,0xE444,0xDC24,0x8002,
+	0xE405,0xC01D,0x5CE4,0xA3A4,0xA5A4,0xF5B4,0xB5EC,0xACB5,
+	0xB3B3,0xAC9D,0x56EE,0xAFB6,0xAFB5,0xB5ED,0xA5AC,0xACA3,
+	0x648A,0x0002,0xF60F,0x8C2F,0x12D9,0xC008,0xAC9B,0xA464,
+	0xE4A5,0xA4AC,0xA400,0x0001,0x73F1,0xED07,0xC008,0xA5FF,
+	0xB69A,0x9AFC,0xB4AC,0x6300,0x0001,0x6392,0x12B9,0xC007,
+	0x63A4,0xEEED,0xA463,0x6352,0x0001,0xDCEA,0xFD68,0xC00B,
+	0x649B,0xA36D,0xA7B7,0xE665,0xA4A3,0x9BA4,0x0002,0xB4CF,
+	0xBCCF,0xBCEF,0x8002,0xBD0F,0xC006,0x94A3,0xA4A5,0x5A8A,
+	0xA300,0x0003,0xD468,0xECA5,0xECE5,0xED64,0xC007,0xF495,
+	0x8E94,0x9C9C,0x5B9C,0x8002,0xE445,0xC005,0xACA4,0xF5B5,
+	0xADB5,0x8002,0x9941,0x8002,0xA161,0xC006,0xACA4,0xECA4,
+	0x9CAC,0xA400,0x8002,0xA9A2,0x8002,0xA9C1,0x0000,0xB1C1,
+	0x8006,0xB1E2,0x0000,0x2040,0x8002,0x0000,0x0001,0xA1C2,
+	0xB1E2,0xC00A,0x9C64,0xE463,0x9CAC,0xDCA4,0xA5AC,0xA400,
+	0x0000,0x7941,0x8002,0x0000,0x0001,0x50E1,0xC263,0xC013,
+	0xA4AC,0xECAD,0xA4AC,0xE464,0xE46C,0xA4AB,0xACAC,0xABE4,
+	0xA464,0xE49C,0x8002,0xCB42,0xC007,0xACEC,0xB4FD,0xA394,
+	0x5495,0x8003,0xD362,0x0002,0xCB42,0xCB22,0xCB02,0x8002,
+	0xC2E3,0xC006,0xE5AC,0xA4EC,0xACA4,0xEC00,0x8002,0xDB84,
+	0xC004,0xACA4,0xACA4,0x5C00,0x8002,0xD3A3,0x8002,0xD383,
+	0x0000,0xD384,0x8002,0xDBA4,0xC009,0xA5A4,0xACF4,0xACAB,
+	0xAD9C,0xA35C,0x8002,0xE405,0xC01E,0x64DC,0xA3A4,0xA5AC,
+	0xEDAC,0xB5EC,0xB5B4,0xB3B4,0xAB9D,0x4EAD,0xF7AE,0xB6AE,
+	0xB6F5,0xADA4,0xACA4,0xA353,0x8000,0x0002,0xED8B,0x4B54,
+	0x12D9,0x8003,0x12D8,0xC003,0xA5A4,0xACA4,0x0001,0x9C4D,
+	0xED07,0xC008,0xA5FF,0xB69A,0xA2F4,0xB4AC,0x5B00,0x0001,
+	0x9C6D,0x12B9,0xC006,0xAB5C,0xEEED,0xAC5B,0x6300,0x0001,
+	0x7BF0,0xFD48,0xC016,0xAC64,0x9BA4,0x6CA7,0xAEAF,0xA5A4,
+	0x9BA4,0xA3A4,0xECAC,0xF5AC,0x9B8C,0x9BAD,0xA500,0x0001,
+	0xF54A,0xECA6,0x8002,0xECA5,0x0001,0xECE5,0xED64,0xC007,
+	0xFC8D,0x8D95,0x94A4,0x5B9C,0x8002,0xE445,0xC005,0xACA4,
+	0xF5B5,0xADB5,0x0003,0x9961,0x9941,0xA141,0xA141,0x8002,
+	0xA161,0x0000,0xA181,0x8003,0xA981,0x0000,0xA9A1,0x8002,
+	0xA9A2,0x8002,0xA9C1,0x8007,0xB1E2,0x8002,0x0000,0x0002,
+	0x2860,0xB1E2,0xB1E2,0x8002,0xB1C2,0x8002,0xA9C1,0x0002,
+	0xA9A1,0xB1A1,0xB1A2,0x8002,0xB1C2,0x8002,0x0000,0x0001,
+	0x3080,0xC243,0xC00F,0xADAB,0xA4ED,0xACA4,0xEC64,0xE4AC,
+	0x64AB,0xACAC,0xE464,0x8002,0xCB82,0x0001,0xCB62,0xCB62,
+	0x8002,0xCB42,0xC006,0xECB4,0xF5B3,0x9D94,0x5300,0x8003,
+	0xD362,0x0002,0xCB42,0xCB22,0xCB02,0x8002,0xC2E3,0xC00E,
+	0xE4AD,0xACE4,0xA4AC,0xECAC,0xA59B,0xADAB,0xACA4,0x5C00,
+	0x8004,0xD3A3,0x0001,0xD383,0xD384,0x8003,0xDBA4,0xC008,
+	0xE5B3,0xAD6B,0xECAD,0xA39D,0x5B00,0x8003,0xE405,0xC01D,
+	0x649B,0x9CE5,0xB4ED,0xACAD,0xB4ED,0xB4BB,0xB3AC,0x5595,
+	0xAEAE,0xAEF6,0xB7AD,0xF5AD,0xADA4,0xAC63,0x938A,0x0003,
+	0xF5CD,0xDD29,0x3B36,0x12D8,0xC006,0xA464,0xE4A4,0x64ED,
+	0xA400,0x0003,0xDCE7,0xED07,0xED27,0xF56B,0xC006,0xB59B,
+	0xA2B4,0xF4AC,0x9B00,0x0001,0xE568,0x12B9,0xC005,0x639D,
+	0xF4AD,0xED5B,0x0001,0x5393,0xFD48,0xC017,0x6CE5,0x639B,
+	0x63A5,0xAFAE,0xEFA5,0x649B,0xA4A3,0xE4AD,0xABB4,0xE59B,
+	0x949B,0x759D,0x0001,0xF52A,0xECA6,0x8002,0xECA5,0x0001,
+	0xECE4,0xED64,0xC010,0xBCCD,0x8E94,0x9C93,0x649C,0x63A4,
+	0xA3AD,0xACED,0xB5AD,0xF500,0x0000,0x9961,0xC006,0xA4DC,
+	0xAC9C,0xACAC,0xA400,0x8003,0xA981,0xC003,0xACA5,0xA3AD,
+	0x8002,0xA9C1,0x8007,0xB1E2,0x8002,0x0000,0x0000,0x2860,
+	0x8003,0xB1E2,0xC006,0x9CA4,0x63A4,0xDC64,0xE500,0x8002,
+	0xB1C2,0x8002,0x0000,0x0001,0x3080,0xC243,0xC00F,0xACA4,
+	0xACED,0xACA4,0xECA4,0x64E4,0x6CEC,0x6BA4,0xEC64,0x8002,
+	0xCB82,0xC00C,0x9CA3,0xA59C,0xA4AC,0xACF4,0xF4A5,0x9C94,
+	0x5B00,0x8002,0xD362,0xC011,0x649C,0x95A4,0x5CA4,0xE4AD,
+	0xA4EC,0xA4AC,0xECA4,0xAD9B,0xADAB,0x8002,0xDBC4,0x8004,
+	0xD3A3,0x0001,0xD383,0xD3A4,0x8003,0xDBA4,0xC008,0xE5B3,
+	0xA573,0xECAD,0xA39C,0x5C00,0x8002,0xE405,0xC01E,0x649C,
+	0x9BA4,0xA5EC,0xACED,0xF5AC,0xACB4,0xBCBB,0xAC54,0x96A5,
+	0xAEF6,0x76EF,0xB6ED,0xB5AD,0xA4AC,0x63DC,0x4A00,0x0004,
+	0xF5EF,0xED69,0xDD07,0x3B55,0x12D8,0xC004,0x64A4,0xE464,
+	0xE500,0x0001,0x4B74,0xED06,0xC00A,0xA5A5,0xFFB5,0x9BA2,
+	0xECBC,0xAC9B,0x4B00,0x0001,0x3B35,0x0AD8,0xC003,0x95F4,
+	0xADED,0x0002,0x53B4,0xE4E8,0xFD48,0xC005,0xADAB,0x5C9B,
+	0xA365,0x0004,0xD50B,0xB4CE,0x8C2F,0x7BEF,0xEDD0,0xC00C,
+	0x9B9B,0xA4E5,0xACB3,0xEDAC,0x9394,0x9B76,0x9C00,0x0000,
+	0xF509,0xC004,0x49A3,0xA464,0xF400,0x0000,0xED84,0xC007,
+	0xACD6,0x8594,0xA49B,0x54A3,0x8002,0xE445,0xC005,0xACAC,
+	0xEDB5,0xADF5,0x0000,0x9961,0xC003,0xA4DC,0xACA4,0x8002,
+	0xA181,0x8002,0xA981,0xC004,0xACA4,0xA5A3,0xAD00,0x8002,
+	0xA9C1,0x0000,0xB1C1,0x8006,0xB1E2,0x8002,0x0000,0x0002,
+	0x1020,0xB1E2,0xB1E1,0x8002,0xB1E2,0xC007,0x9CA4,0x63DC,
+	0x64E5,0xA4AC,0x0000,0x9982,0x8002,0x0000,0x0001,0x2880,
+	0xBA43,0xC034,0xECA4,0xACED,0xACA4,0xEC64,0xE4A4,0x6CA4,
+	0xABAC,0xEC64,0xA3AC,0xA49C,0xAC9C,0xA49C,0xA5AB,0xECF4,
+	0xB4A5,0x935C,0x9D9B,0xAC9C,0x5C9D,0x9CA4,0x9CA4,0xACA5,
+	0xECA4,0xACAC,0xE4AC,0xA5A4,0xAB00,0x8002,0xDBC4,0xC006,
+	0x5CA3,0xA4A5,0xA39C,0xAD00,0x8002,0xDBA4,0xC009,0xA5AC,
+	0xEBA5,0xABB4,0xADA3,0x9C5C,0x8002,0xE405,0xC01F,0x5CA4,
+	0x9BA4,0xA5A4,0xECF5,0xACB5,0xEDB3,0xBCBB,0xAC54,0x959D,
+	0xAEB7,0xB5F7,0xAFB5,0xEDAC,0xADAC,0x63DC,0x9348,0x0004,
+	0xED8A,0xED27,0xED07,0x7BEF,0x1AF7,0xC003,0x5D64,0xA4E5,
+	0x0001,0x8C2E,0xED06,0xC00A,0xA5A5,0xFFB5,0x9B9A,0xF4BC,
+	0xAC9B,0x4B00,0x0006,0x73D1,0x0AB8,0x0A99,0x12D9,0x12FA,
+	0x7BEF,0xECE5,0xC006,0xF6B5,0xE5AB,0x5C9B,0xAB00,0x0005,
+	0x7BEF,0x1296,0x1273,0x0A51,0x0A2F,0xEDAF,0xC008,0xA4DC,
+	0x63EC,0xA4B5,0xF4A4,0x9400,0x0005,0xDD2E,0xBCCE,0xBCEF,
+	0xBCCF,0xC4AB,0xECA6,0x8002,0xECA5,0x0001,0xE505,0xED84,
+	0xC007,0xB4CD,0x8694,0x9C9B,0x649C,0x8002,0xE445,0xC005,
+	0xACAC,0xEDB5,0xADF5,0x0000,0x9941,0x8005,0xA161,0x8002,
+	0xA981,0xC00A,0xACA4,0xA5A3,0xADA4,0xA3E4,0xA5A3,0xAC00,
+	0x8005,0xB1E2,0x0000,0x2060,0x8002,0x0000,0x0001,0x8161,
+	0xB1E2,0xC006,0xACA4,0x9CA4,0x9B64,0xA400,0x8002,0xA9A1,
+	0x0001,0xA9C2,0x6101,0x8002,0x0000,0x0001,0x50E1,0xBA23,
+	0xC004,0xECAC,0xA4F5,0xAC00,0x8003,0xCAE4,0xC00D,0xEC64,
+	0xA4AC,0xACA3,0xACA3,0xACE4,0x649B,0xA5A4,0x8002,0xCB42,
+	0x0001,0xD362,0xD3A2,0x8002,0xDC02,0x0001,0xDBC3,0xD382,
+	0x8002,0xD362,0xC003,0x649D,0x94A4,0x8002,0xCAE3,0xC006,
+	0xADEC,0xA4AC,0xA4ED,0xA300,0x8002,0xDB85,0xC003,0xABAC,
+	0xA45C,0x8005,0xD3A3,0x8002,0xDBA4,0xC006,0xA5AC,0xEBA4,
+	0xAC6C,0xF500,0x0000,0x23BB,0xC013,0x64AB,0xACA5,0xACA3,
+	0xE5AC,0xA4AB,0x5C9C,0x539C,0x539B,0x948D,0x9594,0x0001,
+	0x840F,0xED47,0xC00E,0x9DAE,0xEE76,0xF6AF,0xBEED,0xACAD,
+	0xACA3,0x5C9C,0x8900,0x000D,0xF5CD,0xED47,0xED07,0xED27,
+	0xD4E9,0x63B2,0x1AF7,0x0AD8,0x12D9,0xD4C9,0xED06,0xED07,
+	0xED27,0xF56B,0xC007,0xB59B,0xE2B4,0xB4AC,0x9B4B,0x0005,
+	0xBCAB,0x12B9,0x1AD8,0x63B2,0xCCC7,0xE4E4,0xC007,0xEDEE,
+	0xADED,0xAB64,0x9BA3,0x0007,0x7BEF,0x1297,0x1273,0x0A51,
+	0x0A2F,0xEDB0,0xEDB0,0xEDAF,0x8002,0xF5AF,0x000D,0xFDEF,
+	0xEDEF,0x7BEF,0x2270,0x0251,0x0251,0x020F,0x0A51,0x1316,
+	0x1379,0x4396,0x8C0E,0xDC86,0xED24,0xC011,0xBCAD,0xCD8C,
+	0x95A4,0x9B54,0xA45B,0xACAC,0xA4EC,0xB5AD,0xB5ED,0x0000,
+	0xA141,0x8004,0xA161,0xC00E,0xACE4,0xA5A3,0xACA4,0xA5A3,
+	0xADA3,0xA4E4,0xA5A3,0xAC00,0x8005,0xB1E2,0x0000,0x40C0,
+	0x8002,0x0000,0x0001,0x1040,0xA9C2,0xC004,0xF4A4,0x9CA3,
+	0x9C00,0x8002,0xA9C1,0x0003,0xA9A1,0xA9A1,0x8961,0x0800,
+	0x8002,0x0000,0x0001,0x7141,0xBA23,0xC004,0xACEC,0xA4EC,
+	0xB500,0x8002,0xCAE4,0x0000,0xD304,0x8002,0xCB04,0xC005,
+	0xACA4,0xABAC,0xA4AC,0x8002,0xCB82,0x0001,0xCB62,0xCB62,
+	0x8003,0xCB42,0xC00A,0xF4F4,0xB4A4,0x955B,0x9C9C,0xAC9C,
+	0x5C00,0x8003,0xCB03,0xC007,0x9CAD,0xECA4,0xACA4,0xEDA3,
+	0x8002,0xDB85,0xC003,0xABAC,0xA463,0x8004,0xD3A3,0xC00A,
+	0xA5A4,0xE4A4,0xA5AC,0xE4AC,0xACAB,0xAD00,0x0000,0x1BBB,
+	0xC013,0xA4AB,0xACAD,0xA4A3,0xA4ED,0xA4AB,0x5C9C,0x539C,
+	0x5B93,0x9495,0x8D94,0x0001,0x83F0,0xED47,0xC00E,0x9CA6,
+	0xB6AE,0xF6B7,0xB6F5,0xADAD,0xACA4,0x9B5C,0x9200,0x0001,
+	0xF5EF,0xF569,0x8003,0xED27,0x0007,0xE508,0x9C4D,0x73D1,
+	0xED06,0xED06,0xED07,0xED27,0xF56B,0xC008,0xB59B,0xE2B4,
+	0xB4AC,0x9B43,0x5300,0x0001,0x9C4D,0xE527,0xC00A,0xEA53,
+	0x9CE5,0xEEB5,0xEDAB,0x649B,0x6300,0x0005,0x7BEF,0x1297,
+	0x1274,0x0A51,0x124F,0xF5D0,0xC005,0x5BA4,0xE4A4,0xAC1C,
+	0x0001,0x32B0,0x01D0,0xC004,0xACB5,0xA49A,0xFF00,0x0006,
+	0x1317,0x1359,0x137A,0x135A,0x3377,0xBCC9,0xED84,0xC010,
+	0xED95,0x8495,0x9C9B,0x5CA4,0x5BAC,0xA4AC,0xECB5,0xADB5,
+	0xED00,0x0000,0xA141,0x8004,0xA161,0x0000,0xA181,0x8002,
+	0xA981,0x8003,0xA9A1,0xC005,0xADA4,0xE3A4,0xA5AB,0x8002,
+	0xB1E2,0x8003,0xB202,0x0000,0x8981,0x8003,0x0000,0x0002,
+	0x0820,0x6921,0xB202,0xC006,0xA39C,0x9D63,0xE464,0x9D00,
+	0x0001,0x6901,0x0800,0x8002,0x0000,0x0002,0x0800,0xA9E2,
+	0xBA23,0xC00A,0xACEC,0xA4AC,0xF5A4,0xACA4,0xEC64,0xE400,
+	0x8002,0xCB04,0x0001,0xD343,0xD343,0x8003,0xCB62,0xC00C,
+	0xACA4,0x9C9C,0xA49C,0xACEC,0xB4F4,0xED5C,0x9C00,0x8003,
+	0xD382,0xC00C,0x559B,0xA59C,0xA49C,0xA4AD,0xECAC,0xA4EC,
+	0xA400,0x8002,0xDB85,0x0000,0xDBA4,0x8002,0xDBC4,0x0000,
+	0xD3A4,0x8003,0xD3A3,0x0000,0xD3A4,0x8002,0xDBA4,0xC006,
+	0xA5E4,0xACA4,0xAC73,0xED00,0x0000,0x1BBB,0xC013,0xACA3,
+	0xACAD,0x9CAB,0xA4A5,0xECAC,0x9B5C,0x5B94,0x5B9C,0x8B95,
+	0x948D,0x0001,0x7BEF,0xED46,0xC00F,0x95AE,0xAEB5,0xB7EE,
+	0xBFF5,0xA5AC,0xB5A4,0xA39C,0x5380,0x0000,0xF58B,0x8005,
+	0xED27,0xC004,0x9CA3,0xA4A5,0xA400,0x0000,0xF56B,0xC015,
+	0xB59B,0xE2B4,0xB4AC,0x9B4B,0x8B64,0xE463,0x9364,0xE5E6,
+	0xB5ED,0xAB64,0x9BA3,0x0006,0x7BEF,0x1297,0x0A94,0x0A51,
+	0x0A2F,0xF5D0,0xF5B0,0x8002,0xF5AF,0x0002,0xF5CF,0x6390,
+	0x01D0,0xC005,0xA4AC,0xB5A3,0xDBBF,0x0001,0x0B17,0x1359,
+	0x8002,0x135A,0x0002,0x22F9,0xDD65,0xF5A5,0xC00F,0x8DCD,
+	0x549C,0x9B5C,0x9B6C,0xA4AC,0xA4F4,0xADAD,0xB5ED,0x0000,
+	0x9961,0x8004,0xA161,0x0000,0xA181,0x8002,0xA981,0x8002,
+	0xA9A1,0xC003,0xACA5,0xA3E4,0x8004,0xB1E2,0x8005,0xB202,
+	0x0000,0x2880,0x8004,0x0000,0x0002,0x0820,0x99C1,0xB1E1,
+	0xC003,0xA564,0xA49B,0x0000,0x60E1,0x8004,0x0000,0x0001,
+	0x58E1,0xB1E2,0xC008,0xF5A4,0xF4A4,0xACEC,0xADAC,0xA400,
+	0x8004,0xD304,0xC014,0xACAB,0x64AC,0xA4A3,0xA4AC,0xA49C,
+	0x9CA4,0x9CA4,0xACF4,0xF5AB,0xA59C,0x5B00,0x8002,0xD382,
+	0x0002,0xD362,0xCB42,0xCB22,0x8002,0xCB03,0xC006,0x9CAD,
+	0xECA4,0xACEC,0xA400,0x8002,0xDB85,0xC004,0xABA4,0xACA4,
+	0x5C00,0x8003,0xD3A3,0x0000,0xD3A4,0x8003,0xDBA4,0xC005,
+	0xA5E4,0xACAC,0xABB5,0x0000,0x1BBB,0xC013,0xACA3,0xACE5,
+	0x6C9B,0xACED,0xA4AB,0x9C64,0x5394,0x5B9C,0x8B95,0x948D,
+	0x0001,0x7BEF,0xF546,0xC009,0x54A6,0xAEB6,0xB6B7,0xF6F6,
+	0xB5A4,0x8002,0xFEF7,0x0003,0xF6D6,0xF6B5,0xF632,0xED8C,
+	0x8005,0xED27,0xC01B,0x9CA3,0xA4A5,0xA4FF,0xB69B,0xE26C,
+	0xFCAC,0x9B43,0x9364,0xE463,0x9364,0xE5EE,0xADED,0xAC63,
+	0x9B9B,0x0005,0x7BEF,0x1297,0x0A74,0x0A51,0x0A2F,0xF5D1,
+	0xC003,0xA35B,0xE4A4,0x0001,0xD54F,0x09F0,0xC006,0x5CA4,
+	0xACB5,0xA29C,0xFF00,0x0000,0x1337,0xC004,0xAEA5,0xAC94,
+	0x8D00,0x0001,0x9C6D,0xF5A5,0xC00F,0x8D8D,0x949C,0x9B5C,
+	0x9B6C,0xA4AC,0xA4EC,0xB5AD,0xB5F5,0x0000,0x9941,0xC006,
+	0xACE4,0xA4A5,0xABA4,0xE400,0x8004,0xA9A1,0xC007,0xACA4,
+	0xE4A5,0xACA4,0x9CAC,0x8006,0xB202,0x0001,0x99E1,0x0820,
+	0x8003,0x0000,0x0001,0x1040,0xB201,0xC004,0xA49C,0x65A3,
+	0x9C00,0x0000,0x7941,0x8003,0x0000,0x0001,0x2060,0xB1C2,
+	0xC009,0xACED,0xACB4,0xECA4,0xEDAC,0xACA4,0x8002,0xD304,
+	0xC004,0x64EC,0x64EB,0xA400,0x8002,0xCB63,0x8004,0xCB62,
+	0xC010,0x9CA4,0x9CAC,0xECB4,0xF4AC,0xA494,0x5C9C,0xA49C,
+	0x6494,0xA500,0x8002,0xCB03,0xC005,0xADA4,0xE4AC,0xACE4,
+	0x8003,0xDB85,0xC003,0xABAC,0xA45C,0x8005,0xD3A3,0xC008,
+	0xE5A4,0xA5A3,0xE5A4,0xB3AD,0xB400,0x0000,0xAC2A,0xC005,
+	0x9CE4,0xA49C,0x64E4,0x8002,0xABEA,0x8002,0xB3EA,0x0009,
 	0xB40B,0xA40C,0x7BEF,0x43B4,0x0B38,0x02F8,0x0A98,0x0A59,
-	0x7BEF,0xED46,0xED06,0xECE7,0xED49,0xED6B,0xED8D,0xEDD0,
-	0xF632,0xFE74,0xFE96,0xFED6,0xFEF7,0xFEF7,0xFEF7,0xF6F7,
-	0xF6B6,0xF653,0xF5CE,0xED49,0xED07,0xF527,0xED27,0xED27,
-	0xF527,0xED26,0xED26,0xED06,0xED07,0xED07,0xF56A,0xF5AC,
-	0xF58B,0xFD89,0xFDA9,0xFE09,0xFE49,0xFE08,0xF5A7,0xED46,
-	0xF546,0xF546,0xED46,0xED24,0xE504,0xED05,0xF547,0xF568,
-	0xFD89,0xFD88,0xFD88,0xF567,0xED66,0x7BEF,0x1297,0x1274,
-	0x0A71,0x0A4F,0xE590,0xF5D0,0xEDAF,0xEDAF,0xF5AF,0x8C2F,
-	0x09F0,0x09D0,0x09D0,0x01F0,0x0230,0x430F,0x7BEF,0x7BEF,
-	0x3B74,0x1359,0x1359,0x135A,0x135B,0x12BB,0x73D1,0xF5A5,
-	0xF546,0xFCC7,0xF4A7,0xF487,0xEC66,0xEC46,0xEC25,0xE445,
-	0xE445,0xE465,0xE485,0xECA5,0xECA6,0xECE7,0xED28,0xF569,
-	0x9961,0x9961,0xA161,0xA161,0xA162,0xA181,0xA181,0xA982,
-	0xA981,0xA9A1,0xA981,0xA9A1,0xA9A1,0xA9C1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xB202,0xB222,0xBA22,0xBA22,0xB222,0x91A1,0x1040,0x0000,
-	0x0000,0x0000,0x40C0,0xB201,0xB201,0xA9E2,0xB1E2,0xA9E2,
-	0xA9C1,0xA1A1,0x0000,0x0000,0x0000,0x2860,0xA1A2,0xB1C2,
-	0xB1E2,0xBA03,0xBA23,0xBA43,0xC263,0xC283,0xC283,0xCAC4,
-	0xCAC4,0xCAE4,0xD304,0xD304,0xD304,0xD304,0xCB24,0xCB24,
-	0xD343,0xD344,0xCB43,0xCB63,0xCB63,0xCB62,0xCB62,0xCB82,
-	0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,0xCB42,0xD382,
-	0xDBC2,0xDBE2,0xDC02,0xDBE2,0xDBC2,0xD3A2,0xD382,0xD382,
-	0xD363,0xCB42,0xCB23,0xCB03,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD324,0xD344,0xD364,0xDB64,0xDB84,0xDB85,0xDB85,0xDB85,
-	0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A3,0xD3A3,0xD3A4,0xDBA4,0xDBA5,0xE3A4,0xE3A5,0xE3C5,
-	0xE3E5,0xE405,0xE445,0xE464,0xE444,0xE424,0xE405,0xE404,
-	0xE3E4,0xE404,0xDBE4,0xDBE4,0xDBC4,0xD3C6,0xA3EC,0x7411,
-	0x3BF6,0x13D9,0x0BB8,0x0B78,0x0B38,0x0AF8,0x0A98,0x0A59,
-	0x8410,0xF566,0xED06,0xECE7,0xED29,0xED4A,0xED6C,0xF5CF,
-	0xF612,0xFE54,0xFE95,0xFEB6,0xFED6,0xFEF6,0xFEF7,0xF6F7,
-	0xF6D6,0xF674,0xF5EF,0xED6A,0xED27,0xF527,0xED27,0xF527,
-	0xF527,0xED26,0xED26,0xED06,0xED07,0xED07,0xF56A,0xF5AD,
-	0xF58B,0xFD89,0xF5A9,0xFDE9,0xFE29,0xFE08,0xF5A7,0xF546,
-	0xF526,0xF546,0xED45,0xED24,0xE504,0xED05,0xF547,0xF568,
-	0xFD89,0xFD88,0xFD88,0xF567,0xED66,0x7BEF,0x1298,0x1275,
-	0x1272,0x0A4F,0xACB0,0xF5D0,0xF5CF,0xF5AF,0xF5AF,0x5350,
-	0x01D0,0x01B0,0x01CF,0x01F0,0x8C2F,0xFDF0,0xFE11,0xF56C,
-	0xECE8,0x9C2D,0x1359,0x135A,0x133A,0x12BB,0x4315,0xF5A5,
-	0xF546,0xFCC7,0xF4A7,0xF487,0xF466,0xEC46,0xEC25,0xE445,
-	0xE445,0xE465,0xEC85,0xECA5,0xECC6,0xECE7,0xF528,0xF569,
-	0x9961,0x9961,0xA161,0xA161,0xA162,0xA181,0xA182,0xA982,
-	0xA981,0xA9A1,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xBA22,0xB202,0xB221,0xBA21,0xBA22,0xB222,0xA9E2,0x5901,
-	0x0820,0x0000,0x7961,0xB202,0xB201,0xB1E1,0xB1E2,0xA9E1,
-	0xA9C1,0xA9C1,0x1040,0x1040,0x6921,0xA9C2,0xB1C2,0xB1C2,
-	0xB1E2,0xB202,0xBA23,0xBA43,0xC263,0xC283,0xC283,0xCAC4,
-	0xCAC4,0xCAE4,0xD304,0xD304,0xD304,0xD304,0xD324,0xD324,
-	0xD343,0xD343,0xCB43,0xCB63,0xCB63,0xCB63,0xCB82,0xCB82,
-	0xCB62,0xCB62,0xCB62,0xCB62,0xCB42,0xCB22,0xCB42,0xD362,
-	0xD3A2,0xDBE2,0xDC02,0xDC03,0xDBE2,0xD3A2,0xD3A2,0xD382,
-	0xD363,0xCB42,0xCB22,0xCB03,0xCB03,0xCB04,0xCB04,0xCB04,
-	0xD324,0xD344,0xD364,0xDB64,0xDB84,0xDB85,0xDB85,0xDB85,
-	0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xDBA3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A3,0xD3A3,0xDBA4,0xDBA4,0xDBA5,0xE3A4,0xE3A5,0xE3A5,
-	0xE3E4,0xE405,0xE445,0xE464,0xE444,0xE424,0xE405,0xE404,
-	0xE3E4,0xD406,0xA40C,0x73F1,0x4417,0x243B,0x245A,0x1C39,
-	0x1C1A,0x13D9,0x0BB8,0x1378,0x0B38,0x0AF8,0x0AB8,0x0A59,
-	0x840F,0xED66,0xED06,0xECE7,0xED28,0xED29,0xED6B,0xEDAE,
-	0xF5F1,0xFE54,0xFE75,0xFEB6,0xFED6,0xFEF7,0xFF17,0xF6F7,
-	0xF6D7,0xFE96,0xF611,0xF58C,0xED48,0xED27,0xED27,0xF527,
-	0xF527,0xED26,0xED26,0xED06,0xED07,0xED07,0xF56A,0xF5AD,
-	0xF58B,0xFD89,0xFDA9,0xFDE9,0xFE29,0xFE08,0xF5A7,0xF546,
-	0xF526,0xF546,0xF546,0xED24,0xED04,0xED05,0xF547,0xF568,
-	0xFD69,0xFD88,0xF568,0xF567,0xED66,0x9C4D,0x1298,0x1295,
-	0x0A52,0x0A30,0x534F,0xF5D0,0xF5CF,0xF5AF,0xF5AF,0x4310,
-	0x01F0,0x01D0,0x01B0,0x1230,0xFDCF,0xFE11,0xF610,0xF56C,
-	0xF4C8,0xECC6,0x3397,0x137A,0x133B,0x129A,0x4315,0xEDA5,
-	0xF526,0xFCC7,0xF4A7,0xF487,0xF466,0xEC46,0xEC25,0xE445,
-	0xE445,0xE465,0xE485,0xECA5,0xECA6,0xF4E7,0xED28,0xF569,
-	0x9941,0x9961,0xA161,0xA161,0xA161,0xA181,0xA182,0xA981,
-	0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xBA22,0xB221,0xBA22,0xB222,0xB222,0xB222,0xB222,0xB222,
-	0xA201,0x7141,0xB221,0xB221,0xB202,0xB202,0xA9E1,0xB1E2,
-	0xB1E2,0xA9C1,0x9981,0xA9C2,0xA9C2,0xA9C2,0xA9C2,0xB1C2,
-	0xB1E2,0xB1E2,0xBA23,0xBA23,0xBA63,0xC263,0xC283,0xCAA4,
-	0xCAC4,0xCAE4,0xD2E4,0xD304,0xD304,0xD304,0xD324,0xD324,
-	0xCB43,0xCB43,0xCB43,0xCB63,0xCB63,0xCB63,0xCB62,0xCB82,
-	0xCB62,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xD382,0xDBC2,0xDC02,0xE403,0xDC03,0xDBC2,0xD3A2,0xD382,
-	0xD362,0xD362,0xCB22,0xCB23,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD324,0xD344,0xD344,0xDB64,0xDB85,0xDB85,0xDB85,0xDB85,
-	0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xD383,0xD383,0xD3A3,0xD3A3,
-	0xD3A3,0xDBA4,0xD3A4,0xDBA4,0xDBA4,0xDBA4,0xE3A5,0xE3A5,
-	0xE3C5,0xE405,0xE445,0xE445,0xE444,0xCC27,0x9C0D,0x6BF2,
-	0x33F8,0x1BFA,0x1BFB,0x1C1A,0x243B,0x243A,0x1C5A,0x1C3A,
-	0x1C1A,0x13F9,0x13B9,0x0B98,0x0B38,0x1B17,0x5393,0x8C2F,
-	0xD548,0xED86,0xED06,0xECC7,0xED07,0xED29,0xED6B,0xED8D,
-	0xF5D0,0xFE33,0xFE75,0xFEB6,0xFED6,0xFEF6,0xFEF7,0xF6F7,
-	0xF6F7,0xF6B6,0xF653,0xF5AD,0xED48,0xED27,0xED27,0xED27,
-	0xF527,0xED26,0xED26,0xED26,0xED27,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xF589,0xF5A9,0xFDE9,0xFE29,0xFE08,0xF5A7,0xED46,
-	0xED26,0xF566,0xF546,0xED25,0xED04,0xED06,0xF547,0xFD68,
-	0xFD69,0xF588,0xF568,0xF587,0xED66,0xD508,0x1298,0x1295,
-	0x1272,0x0A30,0x120F,0x9C70,0xF5D0,0xF5CF,0xF5D0,0x0A10,
-	0x01D0,0x01D0,0x01B0,0x42F0,0xFDF0,0xFE32,0xFE11,0xF54B,
-	0xECE8,0xECC6,0x2378,0x135A,0x131A,0x129B,0x4315,0xF5A5,
-	0xF526,0xFCC7,0xF4A7,0xF487,0xEC66,0xEC46,0xE445,0xE445,
-	0xE445,0xE465,0xEC85,0xECA5,0xECC6,0xF4E7,0xF548,0xF589,
-	0x9941,0xA141,0xA161,0xA161,0xA161,0xA182,0xA182,0xA981,
-	0xA981,0xA981,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xB222,0xBA22,0xB222,0xB222,0xBA22,0xB222,0xBA22,0xB222,
-	0xB222,0xB221,0xB221,0xB221,0xB221,0xB202,0xA9E1,0xB1E2,
-	0xB1E2,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C2,0xA9C2,0xB1C2,
-	0xB1E2,0xB1E2,0xBA02,0xBA23,0xBA43,0xC263,0xC283,0xCAA4,
-	0xCAC4,0xCAE4,0xCAE4,0xD2E4,0xD304,0xD304,0xD324,0xCB24,
-	0xCB24,0xCB43,0xCB43,0xCB43,0xCB63,0xCB62,0xCB62,0xCB82,
-	0xCB63,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xD362,0xDBA3,0xDBE3,0xE422,0xDC03,0xDBE2,0xDBA2,0xD3A2,
-	0xD382,0xD362,0xCB42,0xCB03,0xCB23,0xCB23,0xCB03,0xCB04,
-	0xCB24,0xD324,0xD344,0xDB64,0xDB85,0xDB85,0xDB85,0xDB85,
-	0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA3,0xD383,0xD383,0xD3A3,
-	0xD3A3,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xE3A5,0xE3C5,
-	0xE3C5,0xE405,0xE424,0x63F2,0x33D8,0x1BDB,0x1BFB,0x1BFA,
-	0x1BFA,0x1BFA,0x1BFB,0x1C1B,0x243B,0x243B,0x1C5A,0x1C5A,
-	0x1C3A,0x23F8,0x53F3,0x8C0E,0xC46A,0xF4E7,0xF547,0xF586,
-	0xF5A5,0xED85,0xED26,0xECC7,0xECE7,0xED08,0xED4A,0xED8D,
-	0xF5CF,0xF633,0xFE55,0xFE95,0xFED6,0xFEF6,0xFEF7,0xFF17,
-	0xF6F7,0xF6B6,0xF654,0xF5CF,0xED4A,0xED27,0xF527,0xED27,
-	0xED27,0xED26,0xED26,0xED27,0xED26,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xF589,0xE58A,0x0216,0x01F6,0x01F7,0x0A58,0x12B9,
-	0x1AF8,0xF546,0xF545,0xED04,0xED04,0xED06,0xF547,0xFD68,
-	0xFD69,0xF588,0xF568,0xF587,0xF566,0xED66,0x3B35,0x1296,
-	0x0A72,0x0A30,0x0A2F,0x122F,0x9C50,0xF5CF,0xF5CF,0x0A10,
+	0x7BEF,0xED46,0xC009,0x949D,0xBEAE,0xAEB7,0xFEF6,0xAEB4,
+	0x8002,0xFEF7,0x0004,0xF6F7,0xF6B6,0xF653,0xF5CE,0xED49,
+	0xC020,0x92EC,0x64A4,0xE463,0xA49C,0xA5A4,0xFFB6,0x9BE2,
+	0xACBC,0xB493,0x4B4B,0xE4A4,0x649A,0x5CE5,0xF6AD,0xEDA3,
+	0xA45B,0x6300,0x000B,0x7BEF,0x1297,0x1274,0x0A71,0x0A4F,
+	0xE590,0xF5D0,0xEDAF,0xEDAF,0xF5AF,0x8C2F,0x09F0,0xC003,
+	0x9CA4,0x6CB4,0x000A,0x430F,0x7BEF,0x7BEF,0x3B74,0x1359,
+	0x1359,0x135A,0x135B,0x12BB,0x73D1,0xF5A5,0xC00F,0x8DC5,
+	0x5C9C,0x5B9C,0x9B6C,0xA4AC,0xACEC,0xA5B5,0xB5F5,0x0000,
+	0x9961,0xC00E,0xA4E4,0xA4A5,0xABA4,0xE5A3,0xAC9C,0xACA4,
+	0xACA4,0xE400,0x8002,0xB1C2,0x0001,0xB1E2,0xB1E2,0x8003,
+	0xB202,0xC003,0xACE4,0xA464,0x0001,0x91A1,0x1040,0x8002,
+	0x0000,0x0001,0x40C0,0xB201,0xC005,0xA45D,0xE464,0x9B5C,
+	0x8002,0x0000,0x0002,0x2860,0xA1A2,0xB1C2,0xC009,0xACED,
+	0xACAC,0xECAC,0xA4F5,0xA4AC,0x8003,0xD304,0xC00B,0x6CA4,
+	0xEBA5,0x63AC,0xA4A3,0xA4AC,0x9CA4,0x8004,0xCB42,0xC00B,
+	0xF4F4,0xACAC,0x9C9C,0x5C9C,0xA49D,0x5B9D,0x8002,0xCB03,
+	0xC006,0xA5A4,0xECAC,0xACE4,0xAC00,0x8002,0xDB85,0xC003,
+	0xABAC,0xA49C,0x8005,0xD3A3,0xC013,0xA5E4,0xA5E3,0xA5AC,
+	0xACAC,0xB4AB,0x9C9C,0x9DA3,0x9CAC,0x5CA4,0x9C66,0x0003,
+	0xA3EC,0x7411,0x3BF6,0x13D9,0xC005,0x5B94,0x9494,0x8C95,
+	0x0001,0x8410,0xF566,0xC00F,0x4C9D,0xB6AD,0xAEFF,0xB7F6,
+	0xB5AD,0xACAC,0xA564,0x9B8A,0x0001,0xF5EF,0xED6A,0xC020,
+	0x91E4,0x64E4,0xA463,0xA49C,0xA5A4,0xFFB7,0x9AE2,0x6CF4,
+	0xB49B,0x4B8B,0x9CAC,0x639B,0x5CE5,0xF6AD,0xEDA3,0xA45B,
+	0x6300,0x001A,0x7BEF,0x1298,0x1275,0x1272,0x0A4F,0xACB0,
+	0xF5D0,0xF5CF,0xF5AF,0xF5AF,0x5350,0x01D0,0x01B0,0x01CF,
+	0x01F0,0x8C2F,0xFDF0,0xFE11,0xF56C,0xECE8,0x9C2D,0x1359,
+	0x135A,0x133A,0x12BB,0x4315,0xF5A5,0xC00F,0x8DC5,0x5C9C,
+	0x9B5C,0x9B6C,0xA4AC,0xECAC,0xADAD,0xF5B5,0x0000,0x9961,
+	0xC009,0xA4E4,0xA4A5,0xABA5,0xE4A3,0xAC9C,0x8002,0xA9A1,
+	0x0001,0xA9C1,0xB1C1,0x8002,0xB1C2,0x0001,0xB1E2,0xB1E2,
+	0x8002,0xB202,0xC006,0xEC5C,0xABE4,0xA564,0x5400,0x0004,
+	0x5901,0x0820,0x0000,0x7961,0xB202,0xC005,0xA39C,0xA563,
+	0x9CA4,0x0003,0x1040,0x1040,0x6921,0xA9C2,0xC00B,0xE4A4,
+	0xACAC,0xEDAC,0xECAC,0xA4F5,0xA4AC,0x8003,0xD304,0xC004,
+	0xACA4,0xABA4,0x6400,0x8002,0xCB63,0x0001,0xCB82,0xCB82,
+	0x8003,0xCB62,0xC010,0x9C9C,0xACEC,0xB4F4,0xACA5,0x9B54,
+	0xA49C,0x9D5B,0x9C9D,0xA400,0x8002,0xCB04,0xC004,0xECAC,
+	0xACE4,0xAC00,0x8002,0xDB85,0xC004,0xABAC,0xA49C,0xA300,
+	0x8004,0xD3A3,0xC00F,0xE5A4,0xA5E3,0xA5A4,0xB3AD,0xB4AB,
+	0x9C9C,0x9DA3,0x9C2E,0x0003,0xA40C,0x73F1,0x4417,0x243B,
+	0xC009,0xAB5B,0x9D53,0x5BD4,0x5494,0x948D,0x0001,0x840F,
+	0xED66,0xC00F,0x8C9D,0xB5A5,0xB6B7,0xF7FF,0xADB5,0xACAD,
+	0xAC5C,0x9CD3,0x0001,0xF611,0xF58C,0xC020,0x509B,0xA4E4,
+	0xA463,0xA49C,0xA5A4,0xFFB7,0x9AE2,0xACB4,0xB49B,0x4B8B,
+	0x9CAC,0xA45A,0x9CA5,0xF6AD,0xE5AB,0x5CA3,0x6300,0x001A,
+	0x9C4D,0x1298,0x1295,0x0A52,0x0A30,0x534F,0xF5D0,0xF5CF,
+	0xF5AF,0xF5AF,0x4310,0x01F0,0x01D0,0x01B0,0x1230,0xFDCF,
+	0xFE11,0xF610,0xF56C,0xF4C8,0xECC6,0x3397,0x137A,0x133B,
+	0x129A,0x4315,0xEDA5,0xC00F,0xC5CD,0x5C9C,0x9B5C,0x9B6C,
+	0xA4AC,0xACEC,0xA5F5,0x75F5,0x0001,0x9941,0x9961,0x8002,
+	0xA161,0xC003,0xACA5,0xE3A4,0x8004,0xA9A1,0xC003,0xACE4,
+	0xA5A4,0x8002,0xB1E2,0x8002,0xB202,0x0002,0xBA22,0xB221,
+	0xBA22,0x8004,0xB222,0x0002,0xA201,0x7141,0xB221,0xC007,
+	0xA49D,0xA45B,0xE5A4,0x5B14,0x8003,0xA9C2,0xC00B,0xE4AC,
+	0xA4F5,0xA4B4,0xE4AC,0xEDAC,0xACE4,0x8002,0xD304,0x0001,
+	0xD324,0xD324,0x8002,0xCB43,0x8002,0xCB63,0x0001,0xCB62,
+	0xCB82,0x8003,0xCB62,0x8003,0xCB42,0xC013,0xF4F4,0xB4E5,
+	0x6493,0x5C9C,0x9CA4,0x54A5,0x9CA4,0xA5A4,0xECAC,0xA4EC,
+	0x8003,0xDB85,0xC005,0xABAC,0xA49C,0x5BA4,0x8002,0xD3A3,
+	0x0001,0xDBA4,0xD3A4,0x8002,0xDBA4,0xC006,0xE5A4,0xACB4,
+	0xB4A4,0xA300,0x0004,0xCC27,0x9C0D,0x6BF2,0x33F8,0x1BFA,
+	0xC00A,0xA5AB,0xEDA3,0x6C9C,0x9C5B,0x945B,0x8C00,0x0004,
+	0x1B17,0x5393,0x8C2F,0xD548,0xED86,0xC010,0x8495,0xB4AE,
+	0xB6AE,0xF7FF,0xB6B5,0xACAC,0xA564,0xA493,0x8900,0x0001,
+	0xF5AD,0xED48,0x8002,0xED27,0x0000,0xF527,0x8002,0xED26,
+	0xC018,0xA5A4,0xF7B7,0x9AA2,0xACF4,0xB49B,0x4B4B,0x9CF4,
+	0x9C5B,0x9BA6,0xF5ED,0xA56B,0x9CAB,0x5B00,0x0001,0xD508,
+	0x1298,0xC003,0xA199,0x52DB,0x0014,0x9C70,0xF5D0,0xF5CF,
+	0xF5D0,0x0A10,0x01D0,0x01D0,0x01B0,0x42F0,0xFDF0,0xFE32,
+	0xFE11,0xF54B,0xECE8,0xECC6,0x2378,0x135A,0x131A,0x129B,
+	0x4315,0xF5A5,0xC005,0x85CD,0x5C9C,0x5B9C,0x8002,0xE445,
+	0xC006,0xACEC,0xACAD,0xEDBD,0xB500,0x0001,0x9941,0xA141,
+	0x8002,0xA161,0x0001,0xA182,0xA182,0x8003,0xA981,0x8002,
+	0xA9A1,0xC003,0xACE4,0xA5A4,0x8002,0xB1E2,0x8002,0xB202,
+	0xC008,0xACE4,0x64A4,0xE464,0xE464,0xA400,0x8003,0xB221,
+	0xC003,0x9D5B,0xE5A4,0x8003,0xA9C1,0xC013,0xA5A4,0xE4AC,
+	0xA4EC,0xADAC,0xECAC,0xEDAC,0xACA4,0xE4AC,0xA4AC,0x64A4,
+	0x8002,0xCB43,0xC004,0xACA3,0xA4AC,0x9D00,0x8002,0xCB62,
+	0x8003,0xCB42,0xC013,0xECF5,0xB4F3,0x5D9B,0x9464,0x9C9C,
+	0x5C95,0xACA4,0x9CA5,0xACE4,0xACEC,0x8003,0xDB85,0x8003,
+	0xDBA4,0xC004,0xA35C,0xA4AC,0xA400,0x8004,0xDBA4,0xC004,
+	0xE5AC,0xA4B4,0xAB00,0x0003,0x63F2,0x33D8,0x1BDB,0x1BFB,
+	0x8002,0x1BFA,0xC007,0xA5AC,0xECA4,0x6BA4,0x9CD2,0x0003,
+	0x53F3,0x8C0E,0xC46A,0xF4E7,0xC00A,0xBCB3,0xAB5C,0x8D8D,
+	0xACAD,0xB6B7,0xF600,0x0000,0xF633,0xC008,0xEEB4,0xB5AC,
+	0xA5AC,0x5C93,0x8A00,0x0001,0xF5CF,0xED4A,0xC00D,0x99E4,
+	0x64A4,0xA3A4,0xA5A3,0xA5F7,0xB79A,0xA225,0x0000,0x0216,
+	0xC004,0x9CA5,0xFDFD,0xF300,0x0000,0xF546,0xC00B,0xA353,
+	0xA4A6,0xF5ED,0xA56B,0x9CAB,0x9B64,0x0001,0x3B35,0x1296,
+	0xC003,0x5892,0xA3E4,0x0013,0x9C50,0xF5CF,0xF5CF,0x0A10,
 	0x01D0,0x01B0,0x01CF,0x7BEF,0xFDF0,0xFE32,0xFE10,0xF54B,
 	0xECE8,0x7BEF,0x135A,0x135A,0x131A,0x127B,0x4315,0xF5A6,
-	0xF526,0xFCC7,0xF4A7,0xF487,0xEC66,0xEC45,0xE445,0xE445,
-	0xE465,0xE465,0xEC85,0xECA5,0xECC6,0xECE7,0xF548,0xF589,
-	0xA141,0xA141,0xA161,0xA161,0xA161,0xA182,0xA182,0xA981,
-	0xA981,0xA981,0xA981,0xA9A1,0xA9A1,0xA9A1,0xA9C1,0xB1C1,
-	0xB1C2,0xB1C2,0xB1E2,0xB1C2,0xB1E2,0xB202,0xB202,0xB202,
-	0xBA22,0xBA22,0xBA22,0x2060,0x6941,0xA1E2,0xBA22,0xBA22,
-	0xB242,0xB222,0xB221,0xB221,0xB221,0xB201,0xB201,0xB1E2,
-	0xB1E2,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xA9C2,0xA9C2,0xB1C2,
-	0xA9C1,0xB1E2,0xB202,0xBA23,0xBA43,0xC263,0xC263,0xCAA3,
-	0xCAA4,0xCAC4,0xCAE4,0xD304,0xD304,0xD304,0xD324,0xD324,
-	0xCB24,0xD344,0xCB43,0xCB43,0xCB43,0xCB63,0xCB83,0xCB83,
-	0xCB62,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xD342,0xD383,0xDBC3,0xE402,0xDC03,0xDC03,0xDBE2,0xD3C2,
-	0xD3A2,0xD362,0xCB42,0xCB23,0xCB23,0xCB23,0xCB03,0xCB03,
-	0xCB24,0xD323,0xD324,0xD344,0xDB64,0xDB85,0xDB85,0xDB85,
-	0xDB84,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xD383,0xD3A3,0xDBA4,
-	0xDBA4,0xDBA4,0xD3A4,0xDBA4,0xDBA4,0xE3A5,0xE3C4,0xE3C5,
-	0xE3C5,0xE404,0xE424,0x1BBA,0x1BBB,0x1BDB,0x1BFB,0x1BFA,
-	0x1BFA,0x1BFA,0x1BFB,0x1C1B,0x243B,0x2C39,0x5C13,0x8BEE,
-	0xBBE9,0xEC06,0xEC27,0xF467,0xF4A7,0xF4E8,0xF527,0xF5A6,
-	0xF5C6,0xED85,0xED06,0xECC6,0xECE7,0xED08,0xED29,0xED6B,
-	0xF5AE,0xF612,0xF654,0xFE95,0xFEB6,0xFED6,0xFEF7,0xFF17,
-	0xF6F7,0xF6D7,0xF675,0xF611,0xED8B,0xED27,0xED27,0xED27,
-	0xF547,0xED26,0xED26,0xED27,0xED26,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xFD89,0xF5A9,0x5332,0x01F6,0x09F7,0x0A58,0x0AB9,
-	0x12B9,0x9C4D,0xF545,0xED25,0xED04,0xED06,0xF547,0xFD68,
-	0xFD89,0xFD88,0xF568,0xF587,0xF586,0xED66,0x9C4D,0x1296,
-	0x0A73,0x1250,0x0A2F,0x0A2F,0x0A2F,0x4B10,0x9C6F,0x09F0,
-	0x01CF,0x01B0,0x01AF,0x5B6F,0xBD10,0xBD31,0xBCF0,0xAC6E,
-	0x53B2,0x1339,0x1359,0x135A,0x131A,0x127B,0x7BEF,0xF585,
-	0xF526,0xFCC7,0xF4A7,0xF487,0xEC66,0xEC45,0xE445,0xE445,
-	0xE465,0xE465,0xEC85,0xECA5,0xECC6,0xF507,0xF548,0xF589,
-	0xA141,0xA161,0xA161,0xA161,0xA161,0xA182,0xA182,0xA181,
-	0xA981,0xA981,0xA9A1,0xA9A1,0xA9C2,0xA9A1,0xA9C2,0xB1C1,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xB202,0xB202,
-	0xBA02,0xBA22,0xB222,0x0000,0x0000,0x0000,0x2880,0x7161,
-	0xAA02,0xB222,0xB222,0xB221,0xB221,0xB201,0xB202,0xB202,
-	0xB1E2,0xA9C1,0xA9C2,0xA9C1,0xA9C1,0xA9C2,0xA9C2,0xA9C2,
-	0xB1C2,0xB1E2,0xB202,0xBA23,0xBA43,0xBA63,0xC263,0xC2A3,
-	0xCAA3,0xCAC4,0xCAE4,0xD304,0xD304,0xD324,0xD324,0xD324,
-	0xD324,0xD324,0xD344,0xCB43,0xCB43,0xCB63,0xCB63,0xCB83,
-	0xCB83,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xD342,0xD363,0xD3A2,0xDBE2,0xE403,0xE403,0xDBE2,0xDBC2,
-	0xD3A2,0xD382,0xD362,0xD323,0xCB23,0xCB03,0xCB03,0xCB03,
-	0xCB04,0xD324,0xD324,0xD344,0xDB64,0xDB85,0xDB84,0xDB65,
-	0xDB85,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA3,0xD3A3,0xDBA4,
-	0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBC4,0xDBC5,0xE3A5,0xE3C5,
-	0xE3C5,0xE3E5,0xE405,0x1BBA,0x1B9B,0x1BBA,0x1BFB,0x1BFA,
-	0x1BFA,0x2BF9,0x5BF4,0x8BEE,0xBBE8,0xDBC5,0xDBA5,0xE3A5,
-	0xE3C5,0xEC06,0xEC47,0xF467,0xF4A7,0xF4E8,0xF547,0xF586,
-	0xF5C6,0xF585,0xED06,0xECC6,0xECC6,0xECE7,0xED29,0xED4B,
-	0xF58E,0xF5F1,0xF633,0xFE75,0xFEB6,0xFED6,0xFEF7,0xFF17,
-	0xFEF7,0xF6D7,0xF696,0xF632,0xF5AC,0xED28,0xED27,0xED27,
-	0xF547,0xED26,0xED26,0xED26,0xED26,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xFD89,0xF5A9,0xBD0D,0x01F6,0x09F7,0x0A78,0x0AB9,
-	0x0AB9,0x2B17,0xED46,0xED25,0xE4E4,0xED25,0xF547,0xF568,
-	0xFD89,0xF588,0xF568,0xF588,0xF566,0xED66,0xED67,0x4B52,
-	0x1273,0x1250,0x0A2F,0x0A2F,0x0A2F,0x0A2F,0x0A10,0x09EF,
-	0x09D0,0x01B0,0x01AF,0x01EF,0x01EF,0x01AD,0x0A0F,0x0AB4,
-	0x1317,0x1339,0x1339,0x135A,0x12FA,0x127B,0xD547,0xF585,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xF466,0xEC45,0xE445,0xE445,
-	0xE465,0xEC85,0xEC85,0xECA5,0xECC6,0xED07,0xED48,0xF589,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA182,0xA182,0xA982,
-	0xA982,0xA982,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB201,0xB202,0xBA22,
-	0xBA22,0xBA22,0xB222,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x38A1,0x7161,0xB241,0xB222,0xB221,0xB201,0xB201,
-	0xAA01,0xA9E2,0xA9E2,0xA9C1,0xA9A1,0xA9C2,0xA9C2,0xA9C2,
-	0xB1C2,0xB1E2,0xB1E2,0xB202,0xBA23,0xBA43,0xC263,0xC283,
-	0xCAA3,0xCAC3,0xCAE4,0xCB04,0xCB04,0xD324,0xD324,0xD324,
-	0xD324,0xCB24,0xD344,0xD343,0xD364,0xCB63,0xCB83,0xCB83,
-	0xCB83,0xCB82,0xCB62,0xCB62,0xCB42,0xCB42,0xCB42,0xCB42,
-	0xCB42,0xD342,0xD382,0xDBC3,0xE402,0xDC03,0xDC03,0xDBC2,
-	0xD3A2,0xD3A2,0xD362,0xD322,0xCB23,0xCB03,0xCB03,0xCB03,
-	0xCB03,0xD324,0xD323,0xD344,0xDB64,0xDB85,0xDB85,0xE385,
-	0xDB85,0xDB84,0xDBA4,0xDBC4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,
-	0xD3A3,0xD3A3,0xDBA4,0xDBC4,0xDBC4,0xDBC4,0xE3C5,0xDBC5,
-	0xE3E5,0xE3E5,0xE404,0x1BBA,0x1B9B,0x1B9B,0x1BDA,0x1BFA,
-	0x1BFB,0x1BFA,0x23F9,0x5C14,0x8BEE,0xBBC8,0xDBA5,0xE3A5,
-	0xE3E5,0xEC25,0xEC27,0xF467,0xF487,0xF4C7,0xF527,0xF586,
-	0xF5C6,0xEDA5,0xED06,0xECC6,0xECC6,0xECE7,0xED28,0xED2B,
-	0xED8D,0xF5EF,0xFE33,0xFE74,0xFEB5,0xFED6,0xF6F6,0xFF17,
-	0xFEF8,0xFED7,0xF6B6,0xF654,0xF5AE,0xED49,0xED27,0xF547,
-	0xF547,0xED27,0xED26,0xED26,0xED26,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xF569,0xFDA9,0xFDE9,0x42F3,0x09F7,0x0A78,0x12B9,
-	0x0AB9,0x0AB9,0x7BEF,0xED24,0xE505,0xED26,0xF547,0xF568,
-	0xFD89,0xFD89,0xF588,0xF587,0xF586,0xED66,0xED67,0xE549,
-	0x3B12,0x0A50,0x0A2F,0x0A0E,0x0A0F,0x0A0F,0x0A0F,0x09EF,
-	0x09CF,0x0190,0x01AF,0x020F,0x01EE,0x01AC,0x020F,0x0AB4,
-	0x1317,0x1338,0x1339,0x135A,0x12FA,0x73D1,0xF5C5,0xF586,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE445,
-	0xE465,0xEC85,0xECA5,0xECC5,0xECC6,0xF507,0xF548,0xF5A9,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA182,0xA182,0xA981,
-	0xA982,0xA982,0xA9A1,0xA9A1,0xA9A1,0xA9C2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB201,0xB202,0xBA22,
-	0xBA22,0xBA22,0xB242,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0820,0x40C0,0x7961,0xB201,0xAA21,
-	0xAA02,0xA9E2,0xA9E2,0xA9C1,0xA9C2,0xA9C2,0xA9C2,0xA9C2,
-	0xA9C2,0xA9E2,0xB1E2,0xB202,0xBA23,0xBA43,0xC263,0xC283,
-	0xCAA3,0xCAC4,0xCAE4,0xCB04,0xCB04,0xD324,0xD324,0xD324,
-	0xD324,0xD344,0xD344,0xD344,0xD343,0xCB63,0xCB63,0xCB63,
-	0xCB83,0xCB83,0xCB62,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,
-	0xCB42,0xD342,0xD363,0xDBA2,0xDBE3,0xE403,0xE403,0xDC03,
-	0xD3C2,0xDBA2,0xD382,0xD342,0xCB22,0xCB23,0xCB03,0xCB03,
-	0xCB03,0xD324,0xD323,0xD344,0xDB44,0xDB85,0xDB85,0xDB85,
-	0xDB85,0xDBA5,0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xDBA4,0xDBA3,
-	0xD3C3,0xD3C3,0xDBA4,0xDBC4,0xDBC4,0xDBC4,0xE3C5,0xE3C5,
-	0xE3E5,0xE3E5,0xE405,0x1BBA,0x1B9B,0x1BBB,0x1BDA,0x1BFA,
-	0x1BFA,0x1BFA,0x1BFA,0x1C1A,0x241B,0x243B,0x2C39,0x5C13,
-	0x8BEE,0xC409,0xEC47,0xF467,0xF487,0xF4C8,0xF527,0xF586,
-	0xF5C6,0xEDA6,0xED26,0xECC6,0xECA6,0xECC6,0xED08,0xED2A,
-	0xED6C,0xF5CF,0xF612,0xFE54,0xFEB5,0xFED6,0xFEF6,0xFEF7,
-	0xFEF8,0xFED7,0xF6B6,0xF675,0xF5F0,0xF56A,0xF548,0xF547,
-	0xF547,0xED27,0xED26,0xED27,0xED27,0xED27,0xF56A,0xF5AC,
-	0xF58B,0xF569,0xFDA9,0xFDE9,0xBD0C,0x09F7,0x0A78,0x12B9,
-	0x0AB9,0x0AB9,0x12BA,0xC4A9,0xED25,0xED26,0xF547,0xF568,
-	0xFD89,0xFD88,0xF588,0xF587,0xF586,0xED66,0xED67,0xED68,
-	0xE56C,0x5350,0x122F,0x0A0E,0x0A0F,0x0A0F,0x0A0F,0x09EF,
-	0x01AF,0x0190,0x01AF,0x020F,0x01CE,0x01AC,0x0A0F,0x0AB4,
-	0x1317,0x1338,0x1339,0x135A,0x63B2,0xED84,0xF5C5,0xF586,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC86,0xEC45,0xE445,0xE445,
-	0xE465,0xEC85,0xECA5,0xECA5,0xECC6,0xF507,0xF548,0xF5A9,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA182,0xA182,0xA981,
-	0xA982,0xA982,0xA9A2,0xA9A2,0xA9A2,0xA9A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xB202,0xBA22,
-	0xBA22,0xBA42,0xBA42,0x38A0,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1040,0x48E0,
-	0x89A1,0xA9E1,0xA9E2,0xA9C1,0xA9C2,0xA9C2,0xA9C2,0xA9C2,
-	0xA9C2,0xA9E2,0xB1E2,0xB202,0xBA23,0xBA43,0xBA43,0xC283,
-	0xC283,0xCAA4,0xCAC4,0xCAE4,0xCB04,0xD324,0xD324,0xD324,
-	0xD324,0xD344,0xD344,0xD364,0xD364,0xCB63,0xCB63,0xCB62,
-	0xCB83,0xCB82,0xCB83,0xCB62,0xCB62,0xCB62,0xCB42,0xCB42,
-	0xCB42,0xD343,0xD343,0xD382,0xDBC3,0xDC03,0xE403,0xE403,
-	0xDBE2,0xDBC2,0xD382,0xD342,0xCB22,0xCB23,0xCB23,0xCB03,
-	0xCB03,0xCB24,0xD323,0xD324,0xD344,0xDB64,0xDB85,0xDB85,
-	0xDB85,0xDBA5,0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xDBA4,0xDBA4,
-	0xD3C3,0xDBC3,0xDBC4,0xDBC4,0xDBC4,0xDBC5,0xE3C5,0xE3C5,
-	0xE3E5,0xE3E5,0xE425,0x940D,0x63F2,0x33B8,0x1BDA,0x1BFA,
-	0x1BFA,0x1BFA,0x1BFB,0x1C1A,0x1C1A,0x243B,0x245A,0x1C5A,
-	0x1C3A,0x13F9,0x1BD8,0x53D3,0x8C0F,0xCC8B,0xF528,0xF587,
-	0xF5A6,0xF5A6,0xED25,0xECA6,0xECA6,0xECC6,0xECE7,0xED29,
-	0xED4B,0xF5AE,0xFE12,0xFE53,0xFE95,0xFED6,0xFEF6,0xFEF6,
-	0xF6F7,0xF6F7,0xF6B7,0xF696,0xF612,0xF58C,0xF548,0xF547,
-	0xF547,0xF547,0xED26,0xED26,0xED27,0xED27,0xF56A,0xF5AD,
-	0xF58B,0xF589,0xFDA9,0xFDE9,0xFE09,0x73B0,0x0A78,0x12B9,
-	0x0AB9,0x0A99,0x12BA,0x3B56,0xDCE6,0xED26,0xF547,0xF568,
-	0xFD89,0xFD89,0xF588,0xF587,0xF586,0xED66,0xED67,0xF568,
-	0xED8B,0xEDAE,0xBCF0,0x430F,0x0A0F,0x0A0F,0x0A0F,0x09CF,
-	0x01AF,0x018F,0x01AF,0x01EF,0x01CD,0x01AC,0x0A0F,0x12D4,
-	0x0AF7,0x1318,0x3B95,0x9C2D,0xED05,0xEDA4,0xF5C5,0xF586,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE445,
-	0xE465,0xEC85,0xECA5,0xECC5,0xECC6,0xF507,0xF568,0xF5A9,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA161,0xA962,0xA181,
-	0xA982,0xA982,0xA982,0xA9A2,0xA9A2,0xA9A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA02,
-	0xBA02,0xBA42,0xBA42,0xBA42,0xAA02,0x7161,0x38A0,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x1040,0x6101,0x9181,0xA9C1,0xA9C2,0xA9A2,0xA9A2,
-	0xA9C2,0xA9C2,0xB1E2,0xB202,0xBA02,0xBA22,0xBA63,0xC263,
-	0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,0xD325,0xD324,0xD325,
-	0xD324,0xD324,0xD344,0xD344,0xD344,0xD363,0xCB63,0xCB63,
-	0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,0xCB42,0xCB42,0xD362,
-	0xD342,0xD363,0xD343,0xD362,0xDBA3,0xDBE3,0xE403,0xE422,
-	0xDC02,0xD3C2,0xD3A2,0xD362,0xCB42,0xCB23,0xCB23,0xCB03,
-	0xCB23,0xCB23,0xD324,0xD324,0xDB44,0xDB64,0xDB85,0xDB85,
-	0xDB85,0xDB85,0xDBA4,0xDBC4,0xDBC4,0xDBA4,0xDBA4,0xDBA4,
-	0xDBA4,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xE3E4,0xE3E5,
-	0xE3E5,0xE3E5,0xE425,0xE445,0xE464,0xE464,0xCC27,0x940D,
-	0x63F2,0x43F6,0x1BFA,0x1BFB,0x1C1B,0x243B,0x243B,0x1C5A,
-	0x1C3A,0x13F9,0x13D9,0x13B9,0x0B78,0x0B37,0x1AF7,0x5373,
-	0xBCEB,0xF5A5,0xED25,0xECC6,0xECA6,0xECC6,0xECE7,0xED09,
-	0xED4B,0xF5AD,0xF5F0,0xFE33,0xF694,0xFED5,0xFEF6,0xFEF6,
-	0xFEF7,0xFEF7,0xFED7,0xF6B6,0xF653,0xF5AD,0xF548,0xF527,
-	0xED27,0xED27,0xED27,0xED26,0xED27,0xF547,0xED6A,0xF5AD,
-	0xF58B,0xFD89,0xFDA9,0xFE09,0xFE29,0xE5C9,0x3AF5,0x12DA,
-	0x0AB9,0x0A99,0x12BA,0x12DB,0x3B36,0xDD07,0xF547,0xF568,
-	0xFD89,0xFD89,0xF588,0xF587,0xF586,0xED66,0xED66,0xF568,
-	0xED8B,0xF5AE,0xEDD0,0xF5F1,0xD570,0x9C70,0x7BEF,0x09CF,
+	0xC00F,0x84CD,0x5C9C,0x5B9B,0x64A4,0xACA4,0xECAC,0xADAD,
+	0xFDB5,0x0001,0xA141,0xA141,0x8002,0xA161,0x0001,0xA182,
+	0xA182,0x8003,0xA981,0x8002,0xA9A1,0xC006,0xACE4,0xA5A4,
+	0xAC9C,0xAC00,0x8002,0xB202,0x8002,0xBA22,0x0006,0x2060,
+	0x6941,0xA1E2,0xBA22,0xBA22,0xB242,0xB222,0x8002,0xB221,
+	0xC003,0x9CA4,0x9DA4,0x8003,0xA9C1,0xC00D,0xA5A4,0xE463,
+	0xEDAC,0xEDAC,0xECA4,0xF4A5,0xACAC,0x8002,0xD304,0xC003,
+	0xACA4,0x64EC,0x8002,0xCB43,0x0002,0xCB63,0xCB83,0xCB83,
+	0x8003,0xCB62,0x8003,0xCB42,0xC00A,0xE4B5,0xF4F3,0x65A4,
+	0x9B5C,0x9C94,0x5C00,0x8002,0xCB23,0xC006,0x9CA4,0xADE3,
+	0xA5AC,0xEC00,0x8002,0xDB85,0x0000,0xDB84,0x8003,0xDBA4,
+	0x0001,0xD383,0xD3A3,0x8002,0xDBA4,0xC008,0x64E4,0xA4E5,
+	0xABA5,0xA4B3,0xAC00,0x0003,0x1BBA,0x1BBB,0x1BDB,0x1BFB,
+	0x8002,0x1BFA,0xC003,0xA5AC,0xECE2,0x0003,0x5C13,0x8BEE,
+	0xBBE9,0xEC06,0xC004,0xADF4,0xB4B5,0xB300,0x0000,0xF5A6,
+	0xC008,0xAC53,0x8594,0xADAD,0xADB6,0xF700,0x0000,0xF612,
+	0xC009,0xB6F5,0xADAC,0xADAC,0x5C9C,0x8A88,0x0000,0xED8B,
+	0x8002,0xED27,0xC00A,0xEC5B,0xA4A5,0xA3A5,0xF7B7,0x9AE2,
+	0x6C00,0x0001,0x5332,0x01F6,0xC003,0xE5BD,0xBDE4,0x0001,
+	0x9C4D,0xF545,0xC00A,0x5C9B,0xA6F5,0xEDAD,0xA35C,0xABA3,
+	0x5C00,0x0003,0x9C4D,0x1296,0x0A73,0x1250,0x8002,0x0A2F,
+	0x0012,0x4B10,0x9C6F,0x09F0,0x01CF,0x01B0,0x01AF,0x5B6F,
+	0xBD10,0xBD31,0xBCF0,0xAC6E,0x53B2,0x1339,0x1359,0x135A,
+	0x131A,0x127B,0x7BEF,0xF585,0xC00F,0x8DCD,0x5C9C,0x5B9B,
+	0x64A4,0xACA4,0xECAC,0xADF5,0xB5B5,0x0000,0xA141,0x8003,
+	0xA161,0xC00C,0xADA4,0xA3E4,0xA4AC,0xA4AD,0x9BAD,0xE3A5,
+	0xA400,0x8002,0xB1E2,0x8002,0xB202,0x0002,0xBA02,0xBA22,
+	0xB222,0x8002,0x0000,0x0002,0x2880,0x7161,0xAA02,0xC00B,
+	0xECA4,0xA3A4,0x9CA5,0xA49C,0x5BA5,0xA3A4,0x8002,0xA9C2,
+	0xC00C,0xE4AC,0xACED,0xACAC,0xE4B4,0xE4AD,0xACEC,0xA400,
+	0x8004,0xD324,0xC006,0xAC63,0xA4AC,0xA4AC,0xA400,0x8002,
+	0xCB62,0x8003,0xCB42,0xC00C,0xE4AD,0xB3F4,0xEDA4,0x5B9C,
+	0x5C9C,0x9C95,0x6400,0x8002,0xCB03,0xC008,0xA5EC,0xA4AC,
+	0xECAD,0xA39D,0xAC00,0x8003,0xDBA4,0x0001,0xDBA3,0xD3A3,
+	0x8004,0xDBA4,0xC006,0xACA5,0xDCAC,0xA4AC,0xAC00,0x0000,
+	0x1BBA,0xC004,0x9DAB,0xB5A3,0xA400,0x0004,0x2BF9,0x5BF4,
+	0x8BEE,0xBBE8,0xDBC5,0xC01D,0x9CE4,0xACF5,0xB5EC,0xB4B5,
+	0xBBB3,0xB493,0x4594,0xA4AD,0xB6AE,0xF7BF,0xB6F6,0xB5AC,
+	0xADAC,0x9C5C,0x9388,0x0000,0xF5AC,0xC003,0x40A3,0xA4EC,
+	0x8003,0xED26,0xC005,0xA5F7,0xB79A,0xE26C,0x0007,0xBD0D,
+	0x01F6,0x09F7,0x0A78,0x0AB9,0x0AB9,0x2B17,0xED46,0xC00B,
+	0x9B53,0xF5EE,0xADED,0x639C,0xAC9A,0x64A5,0x0002,0x4B52,
+	0x1273,0x1250,0x8003,0x0A2F,0xC008,0x9D9B,0x9D5C,0xA3B4,
+	0xA492,0xFE00,0x0000,0x0AB4,0xC005,0xFFAE,0xA4AD,0x8C85,
+	0x0001,0xD547,0xF585,0xC00F,0xC654,0x9C9B,0x9C5B,0x64A4,
+	0xACEC,0xA4AC,0xADB5,0xB5F5,0x8004,0xA161,0x0001,0xA182,
+	0xA182,0x8002,0xA982,0x8003,0xA9A1,0x8003,0xB1C2,0x8002,
+	0xB1E2,0x0001,0xB201,0xB202,0x8002,0xBA22,0x0000,0xB222,
+	0x8005,0x0000,0x0002,0x38A1,0x7161,0xB241,0xC008,0x9DA3,
+	0x9CA4,0x649D,0xA49B,0x9C00,0x8002,0xA9C2,0xC00C,0xE4AC,
+	0xA4AC,0xEDAC,0xECAC,0xECAC,0xADAC,0xA400,0x8003,0xD324,
+	0xC004,0x64EC,0xA3AD,0x6300,0x8002,0xCB83,0x0002,0xCB82,
+	0xCB62,0xCB62,0x8004,0xCB42,0xC00B,0xE4B4,0xF5F3,0x65A4,
+	0x935C,0xA494,0x9465,0x8003,0xCB03,0xC00A,0xEDA3,0xADEC,
+	0xADA4,0xE464,0xA3AC,0xAC00,0x8003,0xDBA4,0x0002,0xD3A3,
+	0xD3A3,0xDBA4,0x8002,0xDBC4,0xC004,0xE564,0xECA4,0xAB00,
+	0x0000,0x1BBA,0xC006,0x9DA4,0xB3AC,0xA5A3,0xE300,0x0003,
+	0x5C14,0x8BEE,0xBBC8,0xDBA5,0xC00A,0xE4B4,0xF4A6,0xF4AC,
+	0xB4BC,0xBBB4,0x5B00,0x0000,0xED06,0xC006,0x94A4,0xADB5,
+	0xA7BE,0xFE00,0x0000,0xFE33,0xC008,0xB5B5,0xAD6C,0xED9D,
+	0x9B5B,0x8A00,0x0001,0xF5AE,0xED49,0xC003,0x9AEC,0xA45C,
+	0x8002,0xED26,0xC006,0xA5F7,0xB79A,0x9AF4,0xB400,0x0007,
+	0x42F3,0x09F7,0x0A78,0x12B9,0x0AB9,0x0AB9,0x7BEF,0xED24,
+	0xC00B,0x5DED,0xEDAD,0xEDA4,0x63A3,0xA35C,0xA55E,0x0003,
+	0x3B12,0x0A50,0x0A2F,0x0A0E,0x8002,0x0A0F,0xC007,0x9C9C,
+	0x55AB,0xBC9B,0x92BF,0x0000,0x0AB4,0xC004,0xFFAD,0xA5AD,
+	0x8C00,0x0001,0x73D1,0xF5C5,0xC010,0x95C5,0x945C,0x9B5C,
+	0x9B64,0xA4AC,0xECAC,0xACA5,0xF5B5,0xBD00,0x8004,0xA161,
+	0xC004,0xADA4,0xE3A5,0xA400,0x8002,0xA9A1,0x0000,0xA9C2,
+	0x8003,0xB1C2,0x8002,0xB1E2,0x0001,0xB201,0xB202,0x8002,
+	0xBA22,0x0000,0xB242,0x8007,0x0000,0x0003,0x0820,0x40C0,
+	0x7961,0xB201,0xC004,0x6C9D,0x9CA4,0x9B00,0x8004,0xA9C2,
+	0xC00B,0xACE4,0xACED,0xACEC,0xACEC,0xADAC,0xACA4,0x8003,
+	0xD324,0x8002,0xD344,0x0000,0xD343,0x8002,0xCB63,0x0001,
+	0xCB83,0xCB83,0x8003,0xCB62,0x8002,0xCB42,0xC00C,0xE4AD,
+	0xF3B5,0xECA4,0x6453,0xDC5C,0x945C,0xA500,0x8002,0xCB03,
+	0xC003,0xEDA3,0xADE4,0x8003,0xDB85,0xC009,0xACA3,0xACA4,
+	0x9CA4,0xA36C,0xA4DD,0x8002,0xDBC4,0xC004,0xE5A4,0xACA4,
+	0xAC00,0x0003,0x1BBA,0x1B9B,0x1BBB,0x1BDA,0x8003,0x1BFA,
+	0xC003,0xACE5,0xACE2,0x0003,0x5C13,0x8BEE,0xC409,0xEC47,
+	0xC018,0xECAC,0xB5BB,0xBBB4,0x5C84,0x8C9C,0xACB6,0xAEB6,
+	0xFFB7,0xF6BD,0xADAC,0xA5A5,0x9B5B,0x9300,0x0001,0xF5F0,
+	0xF56A,0xC004,0x9AA3,0xA45C,0xA300,0x8002,0xED27,0xC005,
+	0xF7B6,0x9B9A,0xF4B4,0x0002,0xBD0C,0x09F7,0x0A78,0xC003,
+	0xF564,0xA4E5,0x0001,0xC4A9,0xED25,0xC00A,0xA5ED,0xADED,
+	0xA364,0xA3A3,0x5CA5,0xA500,0x0003,0xE56C,0x5350,0x122F,
+	0x0A0E,0x8002,0x0A0F,0xC007,0x9C54,0x9DAB,0xBC93,0x9AFF,
+	0x0000,0x0AB4,0xC003,0xFFAD,0xA5AD,0x0001,0x63B2,0xED84,
+	0xC011,0xF595,0xC594,0x5C9B,0x6493,0x64A4,0xACEC,0xACA4,
+	0xADF5,0xB5BD,0x8004,0xA161,0xC004,0xADA4,0xE3A5,0xA400,
+	0x8003,0xA9A2,0x8003,0xB1C2,0x8002,0xB1E2,0xC005,0xACA4,
+	0xECA4,0xACA4,0x0000,0x38A0,0x8009,0x0000,0x0005,0x1040,
+	0x48E0,0x89A1,0xA9E1,0xA9E2,0xA9C1,0x8004,0xA9C2,0xC00B,
+	0xACE4,0xACED,0xACA4,0xF4A4,0xEDAC,0xACAC,0x8003,0xD324,
+	0xC009,0xACA4,0xACA4,0x63A4,0xA3AD,0xA3A5,0x8002,0xCB62,
+	0x8002,0xCB42,0xC014,0xE5A4,0xB3F5,0xB4E4,0xA45B,0x9C54,
+	0x945C,0xA5A4,0x9CA4,0xADE3,0xA5AC,0xEC00,0x8002,0xDB85,
+	0xC003,0xACA3,0xACA4,0x8002,0xDBA4,0x0001,0xD3C3,0xDBC3,
+	0x8002,0xDBC4,0xC005,0xA5E4,0xA4AC,0xA4B4,0x0003,0x940D,
+	0x63F2,0x33B8,0x1BDA,0x8002,0x1BFA,0xC008,0xA5AB,0xA4ED,
+	0xAB64,0x9C53,0xDB00,0x0003,0x53D3,0x8C0F,0xCC8B,0xF528,
+	0xC00A,0xBBAB,0xA443,0x85A4,0xACAD,0xB6AE,0xFF00,0x0000,
+	0xFE12,0xC009,0xB5B6,0xB5AC,0xA465,0xA494,0x9B80,0x0001,
+	0xF58C,0xF548,0x8002,0xF547,0xC00A,0x5BA4,0xA5A4,0xF7B7,
+	0x9AA2,0xECB4,0xAC00,0x0001,0x73B0,0x0A78,0xC003,0xF564,
+	0x9CED,0x0002,0x3B56,0xDCE6,0xED26,0xC00B,0xEDAD,0xEDA4,
+	0x63A3,0xA35C,0xA5E5,0x6FAF,0x0001,0xBCF0,0x430F,0x8002,
+	0x0A0F,0xC007,0x945C,0x9CAC,0xB49A,0x9BFF,0x0006,0x12D4,
+	0x0AF7,0x1318,0x3B95,0x9C2D,0xED05,0xEDA4,0xC011,0xED95,
+	0xC594,0x5C9B,0x5C9B,0x64A4,0xACEC,0xACAC,0xA5F5,0xBDB5,
+	0x8005,0xA161,0x0001,0xA962,0xA181,0x8002,0xA982,0x8002,
+	0xA9A2,0x8003,0xB1C2,0x8002,0xB1E2,0x0000,0xB202,0x8002,
+	0xBA02,0x8002,0xBA42,0x0002,0xAA02,0x7161,0x38A0,0x8009,
+	0x0000,0x0003,0x1040,0x6101,0x9181,0xA9C1,0xC014,0xA59C,
+	0xA4AC,0xA4EC,0xACE4,0xACB5,0xE4AC,0xACED,0xACAC,0xEDA3,
+	0xA5A3,0xA400,0x8002,0xD344,0xC020,0xAB64,0xA4AC,0xA4A3,
+	0x9CA4,0x9CA4,0xEC9C,0xAD9C,0xABF5,0xB4EC,0xAB5C,0x549C,
+	0x945C,0x9DA4,0x9CAC,0xA4E5,0xA4EC,0xAC00,0x8003,0xDB85,
+	0x0002,0xDBA4,0xDBC4,0xDBC4,0x8003,0xDBA4,0x8004,0xDBC4,
+	0x0000,0xE3E4,0x8002,0xE3E5,0xC003,0xB4AC,0xABA4,0x0004,
+	0xCC27,0x940D,0x63F2,0x43F6,0x1BFA,0xC00A,0xA5AC,0xECA4,
+	0x6B9C,0x539C,0x9C53,0x9300,0x0003,0x1AF7,0x5373,0xBCEB,
+	0xF5A5,0xC012,0x448D,0x9CAC,0xADAE,0xB6FE,0xB7F7,0x7DF5,
+	0xADA4,0xA5A4,0x9C5B,0x8900,0x0002,0xF5AD,0xF548,0xF527,
+	0x8002,0xED27,0xC009,0xA3A5,0xEC6F,0xF79A,0xE2AC,0xBCAC,
+	0x0002,0xE5C9,0x3AF5,0x12DA,0xC003,0x5B9C,0xEDAD,0x0002,
+	0x3B36,0xDD07,0xF547,0xC00C,0xADED,0xA463,0xA3A3,0x5CA4,
+	0xE66F,0xEF6E,0xED00,0x0011,0xD570,0x9C70,0x7BEF,0x09CF,
 	0x01AF,0x018F,0x01AF,0x42EF,0x83EF,0x7BEF,0x83EF,0xB48D,
-	0xB48C,0xECC8,0xECC6,0xECC5,0xED24,0xEDA4,0xF5C5,0xF586,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE465,
-	0xE465,0xEC85,0xECA5,0xECC5,0xECE6,0xF527,0xF568,0xF5A9,
-	0xA161,0xA161,0xA161,0xA161,0xA161,0xA161,0xA962,0xA981,
-	0xA981,0xA981,0xA982,0xA9A2,0xB1A2,0xB1A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA22,
-	0xBA02,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xA202,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x1840,0x6901,0xA1A2,0xA9C2,
-	0xA9C2,0xA9C2,0xB1E2,0xB202,0xB202,0xBA23,0xBA43,0xC263,
-	0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,0xD305,0xCB04,0xD324,
-	0xD324,0xD324,0xD344,0xD344,0xD344,0xD363,0xCB63,0xCB63,
-	0xCB83,0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,0xCB62,0xD362,
-	0xD362,0xD343,0xD343,0xD363,0xDB83,0xDBC3,0xE403,0xE422,
-	0xDC03,0xDBE2,0xDBA2,0xD382,0xD362,0xCB43,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xD324,0xD344,0xDB44,0xDB85,0xDB85,0xDB85,
-	0xDB85,0xDB85,0xDBA5,0xDBC4,0xDBC4,0xDBA4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xE3E4,0xE3E5,
-	0xE3E5,0xE3E5,0xE425,0xE465,0xE464,0xE464,0xE445,0xE424,
-	0xE405,0xE405,0xDC06,0xA40B,0x7411,0x4417,0x243B,0x1C5A,
-	0x1C3A,0x1419,0x13F9,0x13B9,0x0B78,0x0B37,0x0AF7,0x0A98,
-	0x83EF,0xEDA5,0xED45,0xECC6,0xECA6,0xECC6,0xECC7,0xE4C8,
-	0xED2A,0xF58D,0xF5F0,0xF612,0xFE74,0xFED5,0xF6F6,0xF6F7,
-	0xFEF7,0xFEF7,0xFED7,0xFED6,0xF674,0xF5EF,0xF569,0xED47,
-	0xED27,0xED47,0xED46,0xED26,0xED27,0xED47,0xED6A,0xF5AC,
-	0xF58B,0xFD89,0xF5A9,0xFE09,0xF609,0xF608,0xC50A,0x1AF8,
-	0x0AB8,0x0A99,0x12BA,0x12DB,0x1ADA,0x3B36,0xE528,0xF568,
-	0xFD89,0xFD88,0xFD88,0xF587,0xF586,0xED66,0xED66,0xED68,
-	0xED8B,0xF5AE,0xF5D0,0xF5F1,0xF5F1,0xF5F0,0xF5F0,0x09EF,
-	0x01AF,0x018F,0x01CF,0x7BF0,0xFE32,0xFE53,0xF5CF,0xF54B,
-	0xED09,0xECC8,0xECC6,0xECE5,0xED44,0xEDC4,0xF5C6,0xF567,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE465,
-	0xE485,0xECA5,0xECA5,0xECC5,0xECE6,0xF527,0xF568,0xF5A9,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA181,0xA981,0xA981,
-	0xA981,0xA982,0xA9A2,0xA9A1,0xB1A2,0xB1A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA22,
-	0xBA02,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0x0000,0x0000,0x0000,0x1040,0x2060,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3080,
-	0x8141,0xA9C2,0xA9C2,0xB1E2,0xB202,0xB223,0xBA43,0xBA63,
-	0xC283,0xC283,0xC2A3,0xCAE4,0xCAE4,0xD305,0xD324,0xD324,
-	0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD363,0xCB63,
-	0xCB83,0xCB83,0xCB82,0xCB82,0xCB62,0xCB62,0xCB62,0xCB62,
-	0xD362,0xD342,0xD342,0xD343,0xDB83,0xDBA3,0xE3E3,0xE422,
-	0xE422,0xDC02,0xDBC2,0xD382,0xD362,0xD343,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xD324,0xD324,0xD344,0xDB64,0xDB85,0xDB85,
-	0xDB85,0xE3A5,0xDBA5,0xDBC4,0xDBC4,0xDBC4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xE3E4,0xE3E4,0xE3E5,
-	0xE3C5,0xE3E5,0xE425,0xE445,0xE464,0xE464,0xE445,0xE425,
-	0xE405,0xE404,0xE405,0xE405,0xE3E5,0xDBE4,0xD3C6,0xA3EC,
-	0x7411,0x3C16,0x13D9,0x13B9,0x0B78,0x0B38,0x0AF8,0x0A98,
-	0x7BEF,0xEDA5,0xED45,0xECC6,0xECA6,0xECA6,0xECC7,0xECE8,
-	0xED29,0xF56C,0xF5CF,0xFE11,0xF653,0xFEB5,0xFED5,0x7BEF,
-	0x7BF0,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BF0,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7BEF,
-	0x83EF,0x7BEF,0x7BEF,0x7BF0,0x7BEF,0x7BEF,0x7BEF,0x5393,
-	0x0AB9,0x0A99,0x12BA,0x12DB,0x12DA,0x12D9,0x2B16,0xBCAC,
-	0xF589,0xFD88,0xFD88,0xF588,0xF586,0xED66,0xED66,0xED48,
-	0xF58A,0xF5AE,0xF5D0,0xF611,0xF5F1,0xF5F1,0xF5F0,0x09CF,
-	0x01AF,0x018F,0x01AF,0x7BEF,0xFE52,0xFE53,0xF5CF,0xF54B,
-	0xED29,0xECE8,0xECC6,0xE4E5,0xED45,0xF5C4,0xF5C5,0xF566,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE465,
-	0xE485,0xECA5,0xECC5,0xECC5,0xECE6,0xF527,0xF568,0xF5A9,
-	0xA181,0xA181,0xA9A1,0xA181,0xA981,0xA981,0xA981,0xA981,
-	0xA981,0xA982,0xA9A2,0xA9A1,0xB1A2,0xB1A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA22,
-	0xBA22,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,
-	0x0000,0x0000,0x0000,0x2880,0xB242,0x9A01,0x6141,0x1040,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x50E1,0xA9C2,0xA9C2,0xB1E2,0xB202,0xB222,0xBA43,0xBA43,
-	0xC263,0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB05,0xCB04,0xD324,
-	0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,0xD383,
-	0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,0xCB62,0xCB62,0xCB62,
-	0xCB42,0xCB42,0xD342,0xD342,0xD363,0xDB83,0xDBC3,0xE402,
-	0xE422,0xDC02,0xDBE2,0xD3A2,0xD362,0xD342,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xCB23,0xD323,0xD344,0xDB84,0xDB85,0xDB85,
-	0xDB85,0xE3A5,0xE3A5,0xDBC5,0xDBE4,0xDBC4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xE3E4,0xE3E5,0xE3E5,
-	0xE3C5,0xE3E5,0xE425,0x8410,0x7BEF,0x7BEF,0x8410,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0x8410,0x7C10,0x7C10,0x7C10,0x7C10,
-	0x7C10,0x7C10,0x7C0F,0x4BD4,0x0B78,0x0B37,0x0AF8,0x0A98,
-	0x840F,0xEDA5,0xED45,0xECC6,0xECA6,0xECA6,0xECC6,0xE4C7,
-	0xED08,0xF56B,0xF5AE,0xFDF1,0xFE53,0xFEB4,0xFED5,0x0909,
-	0x0909,0x0108,0x0128,0x0128,0x0949,0x09CD,0x0A53,0x0AB7,
-	0x0AB8,0x0AB8,0x0AD8,0x12D9,0x12D8,0x12D8,0x0A95,0x0A53,
-	0x0A74,0x0276,0x0236,0x01F6,0x01D6,0x09F7,0x0A59,0x0AB9,
-	0x0AB9,0x0A99,0x12BA,0x12DB,0x12DA,0x12B9,0x0A97,0x0A96,
-	0x4353,0xCCEB,0xF588,0xF587,0xF586,0xED66,0xED66,0xED67,
-	0xED6A,0xF58E,0xF5D0,0xF611,0xF5F1,0xF5F1,0xF610,0x09CF,
-	0x01AF,0x018F,0x01AE,0x73D0,0xFE53,0xFE53,0xF5CF,0xF54B,
-	0xED29,0xED08,0xECC6,0xECE5,0xED45,0xF5C4,0xF5E5,0xF566,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC66,0xEC45,0xE445,0xE465,
-	0xEC85,0xECA5,0xECC5,0xECC5,0xECE6,0xF527,0xF588,0xF5C9,
-	0xA1A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA981,
-	0xA981,0xA9A2,0xA9A2,0xA9A2,0xB1A2,0xB1A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1E2,0xB1C2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA02,
-	0xBA22,0xBA22,0xBA42,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,
-	0x0000,0x0000,0x0000,0x2880,0xB262,0xB242,0xB242,0xB242,
-	0x91C1,0x48E0,0x1040,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x50E1,0xA9C2,0xA9C2,0xA9C2,0xB1E2,0xB202,0xBA43,0xBA63,
-	0xBA63,0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,0xCB04,0xD304,
-	0xD324,0xD324,0xD344,0xD344,0xD344,0xD364,0xD364,0xD383,
-	0xD383,0xCB83,0xCB83,0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,
-	0xCB42,0xCB42,0xD343,0xD343,0xD363,0xDB83,0xDBC3,0xE403,
-	0xE422,0xE402,0xDBE2,0xDBC2,0xD382,0xD362,0xCB42,0xCB43,
-	0xCB23,0xCB23,0xCB23,0xCB24,0xD344,0xD364,0xDB84,0xE385,
-	0xE385,0xE385,0xE3A5,0xE3C4,0xDBC4,0xDBC4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xE3E4,0xE3E4,0xE3E5,
-	0xE3E5,0xE405,0xE425,0x1BBA,0x1B9A,0x1B7B,0x1BBA,0x1BBA,
-	0x1BFA,0x1BFA,0x1BFA,0x1BFA,0x23FB,0x1C1B,0x1C3B,0x243B,
-	0x1C3A,0x1C19,0x13F9,0x13B9,0x0B98,0x0B58,0x02F8,0x0AB8,
-	0x7BEF,0xF5A5,0xED65,0xECE6,0xECA6,0xECA6,0xECA6,0xECC7,
-	0xED08,0xED4B,0xF5AD,0xFDF0,0xFE32,0xFE93,0xFED5,0x0109,
-	0x0108,0x0128,0x0127,0x0127,0x0949,0x09AB,0x0A31,0x0AB6,
-	0x0AB9,0x12D8,0x12D8,0x12D9,0x12D9,0x12D8,0x1295,0x0A53,
-	0x0A75,0x0A76,0x0256,0x0216,0x09D6,0x09F7,0x0A59,0x0AB9,
-	0x0AB9,0x0A99,0x12B9,0x12DA,0x12DA,0x12D9,0x0AB8,0x0296,
-	0x0276,0x7BEF,0xF588,0xF587,0xF586,0xED66,0xED66,0xED47,
-	0xED6A,0xF58D,0xF5F0,0xF611,0xF611,0xF611,0xF610,0x01CE,
-	0x018F,0x018F,0x01AE,0x42EF,0xFE53,0xFE53,0xF5AF,0xED4B,
-	0xED29,0xED08,0xECE6,0xECE5,0xED45,0xF5C5,0xF5C6,0xFD67,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC66,0xE445,0xE445,0xE465,
-	0xEC85,0xECA5,0xECC5,0xF4C6,0xECE6,0xF547,0xF588,0xF5A9,
-	0xA1A1,0xA9A1,0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A2,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A2,0xA9A2,0xA9A2,0xB1C2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1E2,0xB1C2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA02,
-	0xBA22,0xBA22,0xBA42,0xBA42,0xBA62,0xBA42,0xBA62,0xBA62,
-	0x0000,0x0000,0x0000,0x2880,0xBA42,0xB262,0xB242,0xB242,
-	0xB221,0x7961,0x40C0,0x0820,0x0000,0x0000,0x0000,0x0000,
-	0x50E1,0xA9C2,0xA9C2,0xA9C2,0xA9E2,0xB202,0xB223,0xBA43,
-	0xBA63,0xC283,0xC2A3,0xCAA4,0xCAE4,0xCAE4,0xD304,0xD324,
-	0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,0xD383,
-	0xD383,0xCB83,0xCB83,0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,
-	0xCB42,0xCB42,0xD343,0xD342,0xD343,0xDB63,0xDBA3,0xDBE3,
-	0xE422,0xE422,0xE402,0xDBE2,0xDBA2,0xD362,0xD342,0xD343,
-	0xCB43,0xCB23,0xCB23,0xCB24,0xD324,0xD364,0xDB85,0xE385,
-	0xE385,0xE385,0xE3A5,0xE3C4,0xDBC4,0xDBC4,0xDBC4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xE3E4,0xE3E4,0xE405,
-	0xE3E5,0xE405,0xE425,0x1BBA,0x1B9B,0x1B7B,0x1B9A,0x1BBA,
-	0x1BDA,0x1BFA,0x1BFA,0x1BFA,0x1BFB,0x1C1B,0x243B,0x243B,
-	0x1C1A,0x1C19,0x13F9,0x13B9,0x0B98,0x0B58,0x0AF8,0x0AB8,
-	0x7BEF,0xF5A5,0xED65,0xECE6,0xECA6,0xECA6,0xECA6,0xECC7,
-	0xECE8,0xF52A,0xF58D,0xFDCF,0xFE11,0xFE93,0xF6D4,0x0129,
-	0x0129,0x0108,0x0908,0x0928,0x0929,0x018A,0x0A10,0x1296,
-	0x0AB8,0x12D9,0x12B8,0x12D9,0x12D8,0x12D8,0x1295,0x0A53,
-	0x0A75,0x0A76,0x0256,0x0216,0x01D6,0x09F7,0x0A59,0x0AB9,
-	0x0AB9,0x0A99,0x12B9,0x12DA,0x12DA,0x12D9,0x0AB8,0x0296,
-	0x0276,0x8410,0xF588,0xF587,0xF586,0xED86,0xED66,0xF567,
-	0xED6A,0xF58D,0xF5EF,0xF611,0xF5F1,0xF611,0xF611,0x120F,
-	0x018F,0x018E,0x01AE,0x01CD,0x5B6F,0x7BEF,0x7BEF,0x8410,
-	0x8C2F,0xC4AB,0xECE6,0xECE6,0xED65,0xF5C5,0xF5C6,0xFD67,
-	0xFD07,0xF4C7,0xF4A7,0xEC86,0xEC65,0xE445,0xEC65,0xE485,
-	0xEC85,0xECA5,0xECC5,0xF4C6,0xF4E6,0xF547,0xF588,0xF5C9,
-	0xA9C1,0xA9C1,0xA9A1,0xA9C1,0xA9C1,0xA9C1,0xA9C2,0xA9A1,
-	0xA9A1,0xA9A1,0xA9A1,0xA9A2,0xA9A2,0xA9A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1E2,0xB1C2,0xB1E2,0xB9E2,0xB202,0xB202,0xBA02,
-	0xBA02,0xBA22,0xBA42,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,
-	0x0000,0x0000,0x0000,0x2880,0xB242,0xB262,0x91E2,0x4900,
-	0x1040,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x50E1,0xA9A2,0xA9C2,0xA9C2,0xA9E2,0xB1E2,0xB222,0xBA43,
-	0xBA63,0xC263,0xC283,0xCAA4,0xCAC4,0xCAE4,0xCB04,0xD324,
-	0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,0xD363,
-	0xD383,0xCB83,0xCB83,0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,
-	0xCB42,0xCB43,0xD343,0xD342,0xD363,0xDB63,0xDBA3,0xDBC3,
-	0xE402,0xE423,0xE423,0xDC02,0xDBA2,0xDB83,0xD362,0xD343,
-	0xCB43,0xCB43,0xCB24,0xCB24,0xD324,0xD344,0xDB64,0xE385,
-	0xE385,0xE385,0xE3A5,0xE3C4,0xDBC4,0xDBE4,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xE3E5,0xE3E5,
-	0xE3E5,0xE405,0xE425,0x1BBA,0x1B9B,0x1B7A,0x1B9A,0x1BBA,
-	0x1BDA,0x1BFA,0x1BFA,0x1BFA,0x1BFB,0x1C1B,0x1C1B,0x1C3A,
-	0x1C3A,0x1C19,0x13F9,0x13B9,0x0B98,0x0B58,0x0B18,0x0AB8,
-	0x840F,0xF5C6,0xF586,0xECE6,0xECA6,0xEC85,0xECA6,0xECA6,
-	0xECC7,0xED09,0xF58C,0xF5AF,0xFE11,0xFE72,0xF6D4,0x012A,
-	0x0929,0x0128,0x0108,0x0128,0x0128,0x0169,0x09CE,0x0A75,
-	0x0AB8,0x0AD8,0x12B8,0x12D8,0x12D8,0x12D8,0x0A95,0x0A53,
-	0x0A74,0x0A76,0x0256,0x01F6,0x01D6,0x09F7,0x0A59,0x0AB9,
-	0x0AB9,0x0A99,0x12B9,0x12DA,0x12DA,0x12B9,0x0AB8,0x0296,
-	0x0276,0x7BEF,0xF588,0xF588,0xF586,0xF586,0xED66,0xED47,
-	0xED69,0xF58D,0xF5CF,0xF611,0xF611,0xF611,0xF631,0x42CF,
-	0x018F,0x016E,0x01AE,0x01CD,0x018B,0x01AC,0x0A51,0x0A94,
-	0x12D5,0x12F7,0x3336,0x9C2D,0xED65,0xF5C5,0xF5C6,0xFD67,
-	0xFD07,0xF4C7,0xF4A7,0xF486,0xEC65,0xEC45,0xEC65,0xE485,
-	0xEC85,0xECA5,0xECC5,0xF4E6,0xED06,0xF547,0xF5A8,0xF5C9,
-	0xA9E1,0xA9C1,0xA9C1,0xA9C1,0xA9C1,0xB1E2,0xB1C1,0xA9C1,
-	0xA9C1,0xA9C1,0xA9A1,0xA9A2,0xA9A2,0xA9A2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xBA02,0xBA02,
-	0xBA22,0xBA22,0xBA42,0xBA42,0xBA62,0xBA62,0xBA62,0xBA62,
-	0x0000,0x0000,0x0000,0x2060,0x5101,0x1840,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1040,
-	0x7121,0xA9A1,0xA9C2,0xA9C2,0xA9E2,0xB1E2,0xB222,0xBA43,
-	0xBA43,0xC263,0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,0xD324,
-	0xD324,0xD324,0xD324,0xD344,0xD364,0xD364,0xD364,0xD363,
-	0xD383,0xCB83,0xCB83,0xCB83,0xCB83,0xCB82,0xCB62,0xCB62,
-	0xCB62,0xCB42,0xD343,0xD342,0xDB43,0xDB63,0xDB83,0xDBC3,
-	0xE403,0xE423,0xE422,0xDC02,0xDBE2,0xDBA2,0xD362,0xD343,
-	0xD343,0xCB43,0xCB24,0xCB24,0xD344,0xD344,0xDB64,0xDB85,
-	0xE385,0xE3A5,0xE3A5,0xE3A5,0xE3E4,0xDBE4,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xDBE5,0xE3E5,
-	0xE405,0xE405,0xE425,0x4BF5,0x4BD5,0x4BD5,0x4BD5,0x4BD5,
-	0x4BF5,0x4BF5,0x4BF5,0x4BF5,0x53F5,0x4C15,0x5415,0x5415,
-	0x4C15,0x4C14,0x4BF4,0x4BD4,0x43D4,0x43B4,0x4394,0x4354,
-	0x9C6D,0xF5C6,0xED85,0xECE6,0xECA5,0xEC85,0xECA6,0xECC6,
-	0xECC7,0xED09,0xF56B,0xF5AE,0xF5F0,0xFE52,0xF6B3,0x092A,
-	0x0129,0x0129,0x0108,0x0107,0x0908,0x0148,0x09AC,0x0A33,
-	0x0AB7,0x0AB8,0x0AB8,0x12D8,0x12D8,0x12D8,0x0A95,0x0A53,
-	0x0A75,0x0A76,0x0256,0x0216,0x01D6,0x09F7,0x0A59,0x0AB9,
-	0x0AB9,0x0A99,0x0AB9,0x12DA,0x12DA,0x12D9,0x0AB8,0x0296,
-	0x0276,0x7BEF,0xF588,0xF587,0xF586,0xF586,0xF566,0xF547,
-	0xF569,0xF58C,0xF5CF,0xF611,0xF611,0xF611,0xF631,0x8C50,
-	0x016E,0x016E,0x01AE,0x01CD,0x018B,0x01AC,0x0A51,0x0A94,
-	0x0AB5,0x12F7,0x1318,0x12F9,0x4B55,0xE5A6,0xF5C6,0xFD47,
-	0xF4E7,0xF4C7,0xF4C7,0xF486,0xEC65,0xEC45,0xEC65,0xE465,
-	0xECA5,0xECA5,0xECC5,0xF4E6,0xED06,0xF567,0xF5A8,0xF5C9,
-	0xA9E2,0xA9E1,0xB1E1,0xA9E1,0xA9E1,0xB1E2,0xB1E1,0xB1E2,
-	0xB1E1,0xA9C1,0xA9C1,0xA9C1,0xA9C2,0xA9A2,0xB1C1,0xB1C2,
-	0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,0xBA02,
-	0xBA02,0xBA42,0xBA22,0xBA22,0xBA42,0xBA42,0xBA62,0xBA63,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0820,0x38C0,0x8981,0xA9C1,
-	0xA1C2,0xA9A2,0xA1C2,0xA9C1,0xA9E2,0xA9E2,0xB202,0xB223,
-	0xBA43,0xBA63,0xC283,0xC2A3,0xCAA4,0xCAC4,0xCAE4,0xCB04,
-	0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,0xD383,
-	0xD383,0xD383,0xD383,0xCB63,0xCB82,0xCB82,0xCB83,0xCB62,
-	0xCB62,0xCB62,0xCB43,0xD343,0xDB43,0xDB63,0xDB83,0xDBC3,
-	0xE3E3,0xE422,0xE422,0xDC22,0xDC02,0xDBC2,0xD383,0xD343,
-	0xD343,0xD343,0xD344,0xCB44,0xD344,0xD364,0xDB84,0xDB85,
-	0xE3A5,0xE3A5,0xE3A5,0xE3A5,0xE3E4,0xDBE4,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE3,0xDBE4,0xDBE4,0xDC04,0xE3E4,0xE3E5,
-	0xE3E5,0xE405,0xE425,0xE445,0xE465,0xE465,0xE465,0xE445,
-	0xE425,0xE425,0xE425,0xDC24,0xE405,0xE3E5,0xDBE4,0xDBC4,
-	0xE3C5,0xE3E5,0xEC06,0xEC46,0xF467,0xF487,0xF4E7,0xF547,
-	0xF5A6,0xF5C6,0xED85,0xECE5,0xEC86,0xEC86,0xECA6,0xECA6,
-	0xECC7,0xECE8,0xF56B,0xFDAD,0xF5EF,0xFE51,0xF693,0x092A,
-	0x0129,0x0129,0x0128,0x0107,0x0907,0x0929,0x09AB,0x0A31,
-	0x1297,0x0AB8,0x12D8,0x12D8,0x12D8,0x12D8,0x0A95,0x0A53,
-	0x0A74,0x0A76,0x0236,0x0216,0x01F6,0x09F7,0x0A79,0x0AB9,
-	0x0AB9,0x0A99,0x0AB9,0x12DA,0x12DA,0x12B9,0x0AB8,0x0A97,
-	0x0276,0x7BEF,0xF588,0xF5A7,0xED86,0xED86,0xF566,0xF547,
-	0xED68,0xF58C,0xF5CF,0xF611,0xF611,0xF611,0xF631,0x7BEF,
-	0x016E,0x016E,0x01AE,0x01AD,0x016B,0x01AD,0x0A31,0x0A94,
-	0x12B5,0x12D7,0x1318,0x12F9,0x127A,0x4315,0xF5E6,0xFD67,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC65,0xEC45,0xEC65,0xE485,
-	0xEC85,0xECC5,0xECC5,0xF4E6,0xF506,0xF567,0xF5A8,0xF5A9,
-	0xA9E2,0xB202,0xB201,0xB1E1,0xB201,0xB201,0xB201,0xB1E1,
-	0xB1E1,0xB1E1,0xB1E1,0xB1E2,0xB1C2,0xB1C2,0xB1C1,0xB1C2,
-	0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,
-	0xBA02,0xBA22,0xBA22,0xBA42,0xBA42,0xA202,0x6961,0x2060,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x40C0,0x7961,0xAA01,0xA9E1,0xA9E1,0xA9C1,
-	0xA9C1,0xA9C2,0xA9C2,0xA9C1,0xA9E2,0xA9E2,0xB202,0xB223,
-	0xBA43,0xBA63,0xC283,0xC2A3,0xCAA4,0xCAC4,0xCAE4,0xCB04,
-	0xD324,0xD324,0xD324,0xD344,0xD364,0xD364,0xD364,0xD364,
-	0xD363,0xD363,0xD383,0xCB83,0xCB83,0xCB82,0xCB83,0xCB83,
-	0xCB62,0xCB62,0xD343,0xD343,0xD343,0xDB63,0xDB83,0xDBA3,
-	0xE3E3,0xE423,0xE442,0xE422,0xE402,0xDBC2,0xD382,0xD363,
-	0xD343,0xD343,0xD343,0xD344,0xD344,0xD344,0xDB84,0xDB85,
-	0xE3A5,0xE3A5,0xE3A5,0xE3A5,0xE3E5,0xE3E4,0xE3E4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE3,0xE3E4,0xE3E4,0xDC04,0xE404,0xE405,
-	0xE405,0xE405,0xE425,0xE445,0xE464,0xE465,0xE465,0xE445,
-	0xE425,0xE425,0xE425,0xE425,0xE405,0xE3E5,0xE3E4,0xE3C5,
-	0xE3C5,0xE3C6,0xEC06,0xEC26,0xF466,0xF487,0xF4C8,0xFD48,
-	0xF5A6,0xF5A5,0xED85,0xED05,0xEC86,0xEC86,0xEC86,0xECA6,
-	0xECA6,0xECE8,0xF54A,0xF58C,0xF5CE,0xFE51,0xFE92,0xF6B4,
-	0xF6D5,0xF6D6,0xFED7,0xFEF8,0xFEF8,0xFED7,0xFE75,0xF5F0,
-	0xF589,0xF548,0xF546,0xED27,0xED27,0xED27,0xF56A,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFDE9,0xFE29,0xF608,0xF586,0xF546,
-	0xF566,0xF566,0xF546,0xED45,0xED25,0xED46,0xF547,0xFD69,
-	0xF589,0xF588,0xF588,0xF587,0xF587,0xF586,0xED66,0xF547,
-	0xED68,0xED8C,0xF5CE,0xF611,0xF611,0xF611,0xE5D1,0x19EE,
-	0x016E,0x016E,0x01AE,0x01AD,0x018B,0x224D,0x4310,0x2AD2,
-	0x12B5,0x12D6,0x12F8,0x12D9,0x127A,0x0A1A,0xBCEB,0xFD67,
-	0xF507,0xFCC7,0xF4A7,0xF486,0xEC65,0xEC65,0xEC65,0xE485,
-	0xECA5,0xECC5,0xECC5,0xF4E6,0xF506,0xF567,0xF5A8,0xF5A9,
-	0xA9E2,0xB202,0xB201,0xB201,0xB201,0xB201,0xB201,0xB201,
-	0xB1E2,0xB1E1,0xB1E2,0xB1E2,0xB1E2,0xB1C2,0xB1C2,0xB1C2,
-	0xB1C2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,0xBA02,
-	0xBA02,0xBA22,0xBA22,0x7161,0x38A0,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2880,
-	0x7181,0xAA22,0xB241,0xB221,0xAA01,0xA9E1,0xA9E1,0xA9C1,
-	0xA9C1,0xA9C2,0xA1C2,0xA9C1,0xA9C2,0xA9E2,0xB202,0xB202,
-	0xBA43,0xBA43,0xBA83,0xC2A3,0xCAA4,0xCAC4,0xCAE4,0xCB04,
-	0xD324,0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,
-	0xD364,0xD383,0xD383,0xD383,0xCB83,0xCB82,0xCB82,0xCB83,
-	0xCB62,0xCB62,0xCB63,0xD343,0xD343,0xD363,0xDB83,0xDBA3,
-	0xDBC3,0xE403,0xE442,0xE442,0xE422,0xDBE2,0xDBA2,0xD383,
-	0xD363,0xD343,0xD343,0xD344,0xD344,0xD344,0xD384,0xDB85,
-	0xE3A5,0xE3A5,0xE3A5,0xE3A5,0xE3E5,0xE3E4,0xE3E4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xE3E4,0xE3E4,0xDC04,0xE404,0xE405,
-	0xE405,0xE405,0xE425,0xE445,0xE465,0xE465,0xDC66,0x9C0D,
-	0x6BF2,0xBC29,0xE425,0xE425,0xE405,0xE3E5,0xE3E4,0xE3E5,
-	0xE3C5,0xE3C5,0xCC08,0xDC27,0xEC66,0xF4A7,0xF4E8,0xF527,
-	0xF587,0xF5C6,0xED85,0xED05,0xEC85,0xEC85,0xEC86,0xEC86,
-	0xECA6,0xECC7,0xF52A,0xF58C,0xF5CE,0xFE30,0xFE92,0xF6B4,
-	0xF6D5,0xF6D6,0xFED7,0xFEF7,0xFEF8,0xFEF8,0xF696,0xF631,
-	0xF5AA,0xF568,0xF546,0xED27,0xED27,0xED27,0xF56A,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFDE9,0xFE29,0xF608,0xF586,0xF546,
-	0xF546,0xF566,0xF546,0xED45,0xED45,0xED46,0xF547,0xFD69,
-	0xFD89,0xF588,0xF588,0xF5A7,0xF587,0xF586,0xED66,0xED46,
-	0xED68,0xED8B,0xF5CE,0xF611,0xF632,0xF612,0xACD0,0x09AE,
-	0x016E,0x016E,0x018D,0x11ED,0xBD32,0xF632,0xF5AE,0xF56B,
-	0xD50C,0x3B34,0x12D8,0x12D9,0x125A,0x0A1A,0x73B1,0xFD67,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC65,0xEC65,0xEC65,0xEC85,
-	0xECA5,0xECC5,0xECC5,0xF4E6,0xF506,0xF567,0xF5A8,0xF5C9,
-	0xA9E1,0xB202,0xAA01,0xB221,0xB221,0xB201,0xB201,0xB201,
-	0xB201,0xB201,0xB1E2,0xB201,0xB1E2,0xB1E2,0xB1C2,0xB1E2,
-	0xB1E2,0xB1C2,0xB1E2,0xB1E2,0xB202,0xB1E2,0xB1E2,0xB202,
-	0xBA22,0xBA22,0xBA42,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x2060,0x6941,0x9A02,0xB262,
-	0xB262,0xB262,0xB242,0xB242,0xAA22,0xAA02,0xAA02,0xA9E1,
-	0xA1E2,0xA1C1,0xA9C1,0xA9C1,0xA9C2,0xA9E2,0xAA02,0xB202,
-	0xB223,0xBA43,0xBA63,0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,
-	0xD324,0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,
-	0xD364,0xD364,0xD383,0xD383,0xD383,0xCB83,0xCB82,0xCB82,
-	0xCB62,0xCB62,0xCB62,0xD343,0xD343,0xD343,0xDB63,0xDB83,
-	0xDBC3,0xE3E3,0xE442,0xE462,0xE442,0xDC02,0xDBC3,0xD383,
-	0xD363,0xD363,0xD343,0xD344,0xD344,0xD344,0xD364,0xDB85,
-	0xE3A5,0xE3A5,0xE3A5,0xE3A5,0xE3C5,0xE3E4,0xE3E4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xE404,0xE404,0xE405,
-	0xE405,0xE405,0xE425,0xE445,0xE465,0x9C2D,0x2379,0x1B9A,
-	0x1BDA,0x8BEE,0xE405,0xE424,0xE405,0xE404,0xE3E4,0xE3C5,
-	0xE3C5,0xE3E5,0x83EF,0x13D9,0x43D4,0xBC4B,0xF4C8,0xFD27,
-	0xF587,0xF5C6,0xEDA5,0xED06,0xEC85,0xEC85,0xEC86,0xEC86,
-	0xECA6,0xECC6,0xF529,0xF56B,0xF5AD,0xFE0F,0xF671,0xF6B3,
-	0xFED5,0xFED6,0xFED7,0xF6F7,0xFEF8,0xFEF8,0xFED6,0xF653,
-	0xF5CC,0xF548,0xF547,0xED27,0xED27,0xED27,0xF569,0xF5AC,
-	0xF58B,0xF589,0xFDC9,0xFE09,0xF629,0xF608,0xF5A6,0xF546,
-	0xF566,0xF567,0xF546,0xED25,0xED25,0xED46,0xF568,0xFD69,
-	0xFDA9,0xFDA8,0xF588,0xF587,0xF5A7,0xF586,0xED66,0xED47,
-	0xF568,0xF58B,0xF5CE,0xF610,0xF631,0xF612,0x7BEF,0x018E,
-	0x016E,0x016E,0x018E,0x9C90,0xFE74,0xF632,0xF5AF,0xF56C,
-	0xED6B,0xCCEB,0x12D7,0x12D9,0x125A,0x0A1A,0x4314,0xF547,
-	0xFD07,0xFCC7,0xF4A7,0xF486,0xEC65,0xEC65,0xE465,0xEC85,
-	0xECA5,0xECC5,0xECE6,0xF4E6,0xF526,0xF567,0xF5A8,0xF5C9,
-	0xAA01,0xB202,0xB201,0xB221,0xB221,0xB201,0xB221,0xB221,
-	0xB221,0xB201,0xB201,0xB201,0xB202,0xB202,0xB1E2,0xB1E2,
-	0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,
-	0xBA22,0xBA22,0xBA22,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x1840,0x5121,0x9A02,0xBA62,0xBA62,0xBA62,0xB262,
-	0xB262,0xB262,0xB242,0xB242,0xAA21,0xAA01,0xAA02,0xA9E1,
-	0xA1E2,0xA1C1,0xA9C1,0xA1C1,0xA1C2,0xA9C2,0xA9E2,0xB202,
-	0xB223,0xBA43,0xBA63,0xC283,0xC2A3,0xCAC4,0xCAE4,0xCB04,
-	0xD304,0xD324,0xD324,0xD344,0xD344,0xD364,0xD364,0xD364,
-	0xD364,0xD364,0xD383,0xD383,0xD383,0xCB83,0xCBA3,0xCB82,
-	0xCB62,0xCB63,0xCB62,0xD363,0xD343,0xD343,0xDB63,0xDB83,
-	0xDBA3,0xE3C3,0xE423,0xE442,0xE442,0xE422,0xDBE2,0xDB82,
-	0xD383,0xD363,0xD363,0xD363,0xD344,0xD364,0xD364,0xDB84,
-	0xE3A5,0xE3A5,0xE3A5,0xE3A5,0xE3C5,0xE3E5,0xE3E4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xE404,0xE404,0xE405,
-	0xE405,0xE405,0xEC25,0xE445,0x9C0D,0x137A,0x137A,0x1B7A,
-	0x1BBA,0x7BEF,0xE425,0xE425,0xE424,0xE405,0xE3E4,0xE3E4,
-	0xE3C5,0xE3C5,0x63F2,0x13D9,0x0B98,0x0B78,0x63D2,0xFD27,
-	0xF587,0xF5C6,0xF5A5,0xED25,0xEC85,0xEC85,0xEC86,0xEC86,
-	0xEC86,0xECC7,0xED09,0xF56B,0xFDAC,0xFE0F,0xF671,0xF692,
-	0xF6B4,0xFEB5,0xF6D7,0xF6F7,0xFEF8,0xFEF8,0xFED7,0xF694,
-	0xF5EE,0xF568,0xF547,0xED27,0xED27,0xED27,0xF569,0xF5AC,
-	0xF58B,0xF589,0xFDC9,0xFE09,0xF629,0xF608,0xF586,0xF546,
-	0xF566,0xF566,0xF546,0xED25,0xED45,0xED46,0xF568,0xFD89,
-	0xFD89,0xFDA8,0xF588,0xF5A7,0xF5A6,0xF586,0xED66,0xED66,
-	0xF568,0xF58B,0xF5CE,0xF610,0xF632,0xF632,0x7BEF,0x018E,
-	0x016E,0x016E,0x018D,0xFE53,0xFE94,0xFE32,0xF5AF,0xF56C,
-	0xED6B,0xED4A,0x4B73,0x12B9,0x125A,0x09FA,0x4314,0xFD47,
-	0xFD07,0xF4C8,0xF4A7,0xF486,0xEC65,0xEC65,0xE485,0xEC85,
-	0xECA5,0xECC5,0xECE6,0xECE6,0xED26,0xF587,0xF5A8,0xF5C9,
-	0xA9E2,0xB202,0xB201,0xB221,0xB221,0xB221,0xB221,0xB221,
-	0xB221,0xBA22,0xB201,0xB201,0xB201,0xB202,0xB202,0xB201,
-	0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,
-	0xBA22,0xBA22,0xBA22,0x0000,0x0000,0x0000,0x0820,0x40E1,
-	0x81C2,0xBA82,0xBA82,0xBA62,0xBA82,0xBA82,0xBA62,0xBA82,
-	0xBA82,0xB262,0xB242,0xB242,0xB221,0xAA21,0xAA02,0xAA01,
-	0xA9E1,0xA1C1,0xA9E1,0xA1C1,0xA1C1,0xA1C1,0xA9E2,0xB202,
-	0xB223,0xBA43,0xBA43,0xBA63,0xC2A3,0xC2C4,0xCAE4,0xCAE4,
-	0xCB04,0xD304,0xD304,0xD344,0xD344,0xD364,0xD384,0xD364,
-	0xD364,0xD384,0xD383,0xD383,0xD383,0xCBA3,0xCBA3,0xCBA2,
-	0xCB83,0xCB83,0xCB63,0xD363,0xD343,0xD343,0xD363,0xDB83,
-	0xDBA3,0xE3C3,0xE403,0xE442,0xE462,0xE423,0xE402,0xDBC2,
-	0xDB83,0xD363,0xD363,0xD364,0xD344,0xD364,0xD364,0xDB84,
-	0xE3A5,0xE3C5,0xE3A5,0xE3A5,0xE3C5,0xE3E4,0xE3E5,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDC04,0xE404,0xE404,0xE405,
-	0xE405,0xE405,0xE425,0xB42A,0x1B9A,0x137A,0x137A,0x1B7A,
-	0x1BBA,0x63F2,0xE425,0xE424,0xE425,0xE405,0xDBE5,0xE3E4,
-	0xDBC4,0xE3C5,0x4C14,0x13D9,0x0BB8,0x0B78,0x0B38,0x8C2F,
-	0xF587,0xF5C6,0xF5A5,0xED25,0xEC85,0xEC85,0xEC85,0xEC86,
-	0xEC86,0xECA6,0xECE8,0xF54A,0xF58C,0xFDED,0xF650,0xFE92,
-	0xF694,0xF6B5,0xFED6,0xFED7,0xFEF8,0xFEF8,0xF6F7,0xF6B5,
-	0xFDEF,0xF589,0xF547,0xF547,0xF547,0xF547,0xF569,0xF5AC,
-	0xF58B,0xF589,0xFDC9,0xFE09,0xF629,0xF608,0xF586,0xF546,
-	0xF566,0xF567,0xF546,0xED45,0xED45,0xF546,0xF568,0xFD89,
-	0xFD89,0xFDA8,0xF588,0xF5A7,0xF5A7,0xF586,0xED66,0xF566,
-	0xF568,0xF58B,0xF5CD,0xF610,0xF631,0xF632,0x7BEF,0x01AD,
-	0x016E,0x016D,0x01AD,0xCD72,0xFE94,0xFE32,0xF5CE,0xF58C,
-	0xED6B,0xED4A,0x22F6,0x12B9,0x0A3A,0x09FA,0x4314,0xF547,
-	0xFD07,0xF4C8,0xF4A7,0xEC86,0xEC65,0xE465,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECC6,0xF4E6,0xF526,0xF587,0xF5A8,0xF5C9,
-	0xA9E1,0xB201,0xB201,0xB221,0xB221,0xB221,0xB221,0xB221,
-	0xBA21,0xBA22,0xBA21,0xB221,0xB221,0xB202,0xB202,0xB202,
-	0xB201,0xB202,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB202,
-	0xBA22,0xBA22,0xBA22,0x0000,0x38A0,0x7161,0xBA62,0xBA82,
-	0xBA83,0xBA83,0xBA83,0xBA82,0xBA82,0xBA82,0xBA62,0xBA82,
-	0xBA82,0xB282,0xB262,0xB242,0xB221,0xAA21,0xAA01,0xAA01,
-	0xA9E1,0xA1E1,0xA9E1,0xA1E1,0xA1C1,0xA1E2,0xA9E2,0xAA02,
-	0xB223,0xB243,0xBA43,0xBA63,0xC283,0xC2A4,0xCAC4,0xCAE4,
-	0xCB04,0xD304,0xD304,0xD344,0xD344,0xD364,0xD364,0xD384,
-	0xD364,0xD384,0xD384,0xD383,0xD383,0xCBA2,0xCBA2,0xCBA3,
-	0xCB83,0xCB83,0xCB83,0xD363,0xD363,0xD343,0xDB63,0xDB63,
-	0xDBA3,0xE3A3,0xE403,0xE443,0xE463,0xE442,0xE402,0xDBC2,
-	0xDB83,0xD383,0xD363,0xD364,0xD344,0xD364,0xD364,0xDB84,
-	0xDBA5,0xE3C5,0xE3A5,0xE3A5,0xE3C5,0xE3E5,0xE404,0xE3E5,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDC04,0xE404,0xE404,0xE405,
-	0xE405,0xE405,0xEC25,0x4BF4,0x1B9A,0x137A,0x137A,0x1B7A,
-	0x43D6,0x940D,0xE425,0xE425,0xE425,0xE405,0xE3E5,0xDBC5,
-	0xDBC4,0xE3C5,0x23F8,0x13D9,0x0BB8,0x0B78,0x0B38,0x12F7,
-	0xF587,0xF5C6,0xF5C5,0xED25,0xEC85,0xEC86,0xEC86,0xEC86,
-	0xEC86,0xEC86,0xECE8,0xF54A,0xFD8B,0xFDCD,0xF62F,0xF671,
-	0xF693,0xF6B5,0xFEB6,0xFED7,0xFEF8,0xFEF9,0xFEF8,0xFEB6,
-	0xF631,0xF5AA,0xED47,0xED47,0xED47,0xF547,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFE09,0xF629,0xF608,0xF586,0xF546,
-	0xF567,0xF566,0xED66,0xED45,0xED45,0xF546,0xF568,0xFD89,
-	0xFD89,0xF588,0xF588,0xF5A8,0xF5A7,0xF586,0xED66,0xED66,
-	0xF568,0xED8A,0xF5CD,0xF5F0,0xF632,0xF632,0x9C90,0x098D,
-	0x016E,0x016D,0x01AD,0x326D,0xEE34,0xF632,0xF5CE,0xF58C,
-	0xF56B,0x63B1,0x12D7,0x12B9,0x0A39,0x09FA,0x6392,0xFD47,
-	0xFD07,0xF4C7,0xF4A7,0xEC86,0xEC65,0xE465,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECE6,0xF4E6,0xF546,0xF587,0xF5A8,0xF5AA,
-	0xA9E1,0xB201,0xB201,0xB221,0xB221,0xB221,0xB221,0xBA21,
-	0xBA41,0xBA41,0xBA21,0xBA21,0xBA21,0xB221,0xB221,0xB221,
-	0xB201,0xB201,0xB202,0xB1E2,0xB1E2,0xB1E2,0xB1E2,0xB1E2,
-	0xBA02,0xBA22,0xBA22,0xAA02,0xBA42,0xBA42,0xBA62,0xBA82,
-	0xBA83,0xBA83,0xBA83,0xBA82,0xBA82,0xBA82,0xBA62,0xBA82,
-	0xBA82,0xB282,0xB282,0xB242,0xB241,0xB221,0xAA22,0xAA02,
-	0xA9E1,0xA1E1,0xA1E1,0xA9E1,0xA1C1,0xA1E2,0xA9E2,0xA9E2,
-	0xB202,0xB243,0xBA63,0xBA63,0xC283,0xC2A4,0xCAC4,0xCAE4,
-	0xCB04,0xD304,0xD324,0xD345,0xD344,0xD364,0xD364,0xD384,
-	0xD384,0xD384,0xD384,0xD383,0xD383,0xD3A3,0xCBA3,0xCBA3,
-	0xCB82,0xCB82,0xCB82,0xCB63,0xD363,0xD363,0xD383,0xDB83,
-	0xDBA3,0xE3A3,0xE3E3,0xE423,0xE463,0xE462,0xE422,0xDBE2,
-	0xDBA3,0xD383,0xD383,0xD363,0xD364,0xD364,0xD384,0xDB84,
-	0xDBA5,0xE3C5,0xE3C5,0xE3C5,0xE3C5,0xE3E5,0xE405,0xE404,
-	0xE3E4,0xDBC4,0xDBE4,0xDC04,0xE404,0xE404,0xE404,0xE425,
-	0xE425,0xE425,0xD426,0x13BA,0x1B9A,0x1B7A,0x1B5A,0x9C2D,
-	0xE465,0xE445,0xE425,0xE425,0xE425,0xE405,0xDC04,0xDBC5,
-	0xDBC4,0xE3C5,0xDBE7,0x9C0D,0x1BB7,0x0B78,0x0337,0x0AD8,
-	0xAC8C,0xF5C6,0xF5C5,0xED45,0xECA5,0xEC86,0xEC85,0xEC86,
-	0xEC86,0xEC86,0xF4E8,0xF529,0xFD6B,0xFDCC,0xF62F,0xF671,
-	0xF692,0xFE95,0xFEB6,0xFED7,0xFEF8,0xFF19,0xFF19,0xFED7,
-	0xF653,0xF5CC,0xED68,0xED47,0xF547,0xF547,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFE09,0xF629,0xF608,0xF586,0xF546,
-	0xF567,0xF587,0xED66,0xED45,0xED45,0xED46,0xF568,0xFD89,
-	0xFD89,0xFDA9,0xF588,0xF5A7,0xF5A7,0xF586,0xF566,0xF567,
-	0xF547,0xF58A,0xF5AD,0xF610,0xF632,0xF632,0xD5B1,0x016D,
-	0x014E,0x016D,0x018D,0x016B,0x11CB,0x636F,0x7BEF,0x6390,
-	0x2AF3,0x12B5,0x0AD7,0x1298,0x0A19,0x09FA,0xACAC,0xFD47,
-	0xFD07,0xF4E7,0xF4A6,0xEC86,0xEC85,0xEC85,0xEC84,0xEC85,
-	0xECA5,0xECE6,0xECE5,0xED06,0xED46,0xF587,0xF5C8,0xF5A9,
-	0xA9E1,0xB201,0xB201,0xB221,0xB221,0xB221,0xB221,0xBA21,
-	0xBA41,0xBA41,0xBA41,0xBA21,0xBA21,0xBA21,0xBA21,0xBA21,
-	0xB202,0xB202,0xB202,0xB202,0xB202,0xB1E2,0xB1E2,0xB1E2,
-	0xBA02,0xBA22,0xBA22,0xBA42,0xBA42,0xBA42,0xBA62,0xBA82,
-	0xBA83,0xBA83,0xBA83,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xB282,0xB282,0xB282,0xB242,0xB241,0xAA22,0xAA02,
-	0xA9E1,0xA9E1,0xA1E1,0xA1E1,0xA1C1,0xA1E2,0xA9E2,0xA9E2,
-	0xB202,0xB223,0xB243,0xBA63,0xBA83,0xC2A4,0xCAC4,0xCAC4,
-	0xCB04,0xD304,0xD324,0xD345,0xD344,0xD364,0xD364,0xD384,
-	0xD384,0xD384,0xD384,0xD384,0xD383,0xD3A3,0xD3A3,0xD3A3,
-	0xCB82,0xCBA3,0xCB83,0xCB63,0xD363,0xD363,0xD363,0xDB83,
-	0xDB83,0xE3A3,0xE3E3,0xE423,0xE463,0xE462,0xE442,0xE402,
-	0xDBC3,0xD3A3,0xD383,0xD383,0xD363,0xD364,0xD384,0xDB84,
-	0xDBA5,0xE3A5,0xE3C5,0xE3C5,0xE3C5,0xE3E5,0xE405,0xE405,
-	0xE3E4,0xDBC4,0xE3E4,0xE3E4,0xE404,0xE404,0xE424,0xE425,
-	0xE425,0xE425,0xB40A,0x13BA,0x1B9A,0x1B7A,0x63D2,0xE4A5,
-	0xE465,0xE445,0xE425,0xE425,0x8C0E,0x33F8,0x4BF5,0x4C15,
-	0xDBC4,0xE3C5,0xE3E5,0xEC26,0x9C0D,0x0B78,0x0B58,0x0AF8,
-	0x83EF,0xF5A6,0xF5A5,0xED45,0xECA5,0xEC86,0xEC85,0xEC85,
-	0xEC86,0xEC86,0xECE7,0xF529,0xF56B,0xFDCC,0xF62E,0xF670,
-	0xF672,0xF694,0xFEB5,0xFED7,0xFEF7,0xFF18,0xFF19,0xFEF8,
-	0xF674,0xF5CD,0xF568,0xED47,0xF547,0xF547,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFE09,0xFE29,0xF608,0xF586,0xF546,
-	0xF567,0xF587,0xED66,0xED46,0xED45,0xF546,0xF568,0xFD89,
-	0xFD89,0xFDA9,0xF588,0xF5A8,0xF5A7,0xF586,0xF566,0xED66,
-	0xF547,0xF58A,0xF5AD,0xF610,0xF631,0xF632,0xFE52,0x636F,
-	0x014E,0x016D,0x018D,0x016B,0x016B,0x01CD,0x0A30,0x0A52,
-	0x1274,0x1295,0x12B7,0x1298,0x0A19,0x42F5,0xFDC6,0xFD48,
-	0xFD07,0xF4E7,0xF4C7,0xEC86,0xEC85,0xEC85,0xEC85,0xDC87,
-	0xB44A,0xECE6,0xECE6,0xF506,0xF546,0xF5A7,0xF5A8,0xF5A9,
-	0xA9E1,0xA9E1,0xB201,0xB221,0xB221,0xB221,0xB221,0xBA21,
-	0xBA41,0xBA41,0xBA41,0xBA41,0xBA41,0xBA21,0xBA21,0xBA21,
-	0xBA22,0xBA22,0xB202,0xB202,0xB202,0xB1E2,0xB1E2,0xB202,
-	0xBA22,0xBA22,0xBA22,0xBA42,0xBA42,0xBA42,0xBA62,0xBA82,
-	0xBA83,0xBA83,0xBA83,0xBA82,0xBA83,0xBA82,0xBA82,0xBA82,
-	0xBAA2,0xB282,0xB282,0xB282,0xB262,0xAA41,0xAA22,0xAA02,
-	0xAA02,0xA9E1,0xA9E1,0xA1E1,0xA1C1,0xA9E2,0xA9E2,0xA9E2,
-	0xB202,0xB222,0xBA43,0xBA63,0xBA63,0xC2A3,0xC2A3,0xCAC4,
-	0xCAE4,0xD304,0xD324,0xD344,0xD344,0xD364,0xD364,0xDB84,
-	0xD384,0xD384,0xD384,0xD384,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xCBA3,0xCBA3,0xCBA3,0xCB83,0xD363,0xD363,0xD363,0xD383,
-	0xDBA3,0xDBA3,0xDBE3,0xE423,0xE443,0xE462,0xE462,0xE422,
-	0xDBC3,0xDBA3,0xDBA3,0xD383,0xD384,0xD364,0xD383,0xDB84,
-	0xDBA5,0xE3C5,0xE3C6,0xE3C6,0xE3E5,0xE405,0xE425,0xE405,
-	0xE3E5,0xE3E4,0xE3E4,0xE3E4,0xE404,0xE404,0xE424,0xE425,
-	0xE425,0xEC25,0xB40A,0x13BA,0x1B9A,0x1B7A,0x7BEF,0xE4A5,
-	0xE485,0xE445,0xE424,0xE425,0xB40A,0x1BFA,0x241A,0x1C3A,
-	0xC3C7,0xE3C5,0xE3E6,0xEC26,0xB42B,0x0B98,0x0B58,0x0AF8,
-	0x83EF,0xF5C6,0xF5C5,0xED45,0xECA5,0xEC65,0xEC85,0xEC85,
-	0xEC65,0xEC86,0xECC7,0xF508,0xF54A,0xF5AB,0xF62D,0xF64F,
-	0xF671,0xFE93,0xF695,0xF6D7,0xFEF7,0xFEF8,0xFF19,0xFEF8,
-	0xFE95,0xF5EE,0xF569,0xED47,0xF547,0xF547,0xF569,0xF5AD,
-	0xF5AB,0xF589,0xFDC9,0xFE09,0xFE29,0xF608,0xF586,0xF546,
-	0xF567,0xF587,0xED66,0xED45,0xED45,0xF546,0xF568,0xFD89,
-	0xFD89,0xF589,0xF588,0xF5A8,0xF5A7,0xF586,0xF566,0xED66,
-	0xF567,0xED8A,0xF5AC,0xF60F,0xF631,0xF652,0xFE52,0xEE31,
-	0x324E,0x014D,0x018D,0x016C,0x016A,0x01CD,0x0A30,0x0A52,
-	0x1273,0x1295,0x12B6,0x1278,0x3AD5,0xE5C6,0xFDC6,0xFD48,
-	0xFD08,0xF4E7,0xF4C7,0xEC86,0xEC85,0xEC85,0xECA5,0x9C2D,
-	0x135A,0x2B57,0xBC6B,0xF526,0xED66,0xF5A7,0xF5C8,0xF5A9,
-	0xAA01,0xB202,0xB202,0xB201,0xB221,0xB242,0xB221,0xBA21,
-	0xB242,0xBA41,0xBA41,0xBA41,0xBA41,0xBA42,0xBA41,0xBA41,
-	0xBA21,0xBA22,0xBA21,0xB202,0xB202,0xB202,0xB202,0xB202,
-	0xB202,0xBA22,0xBA22,0x89A2,0x89A2,0x89C2,0x89C2,0xB242,
-	0xC283,0xC283,0xC283,0xBA83,0xBA83,0xBA83,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xB282,0xB281,0xB262,0xAA41,0xAA22,0xAA21,
-	0xAA02,0xA9E2,0xA1E1,0xA1E1,0xA1E1,0xA9E1,0xA1E2,0xA9E2,
-	0xAA02,0xB202,0xB243,0xBA63,0xBA63,0xC283,0xC2A3,0xCAC4,
-	0xCAE4,0xCB04,0xD304,0xD324,0xD345,0xD364,0xD364,0xD384,
-	0xDB84,0xD384,0xD384,0xD384,0xD383,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A2,0xCBA2,0xCB83,0xCB83,0xD383,0xD383,0xD363,0xDB83,
-	0xDB84,0xDBA3,0xE3E3,0xE423,0xE443,0xEC62,0xE462,0xE422,
-	0xE3E2,0xDBA3,0xDBA3,0xDBA3,0xD383,0xD384,0xD384,0xD384,
-	0xDBA5,0xE3C5,0xE3C5,0xE3C5,0xE3C5,0xE3E5,0xE405,0xE405,
-	0xE405,0xE3E5,0xE3E4,0xE3E4,0xE404,0xE404,0xE424,0xE424,
-	0xE425,0xE425,0xC429,0x13BA,0x1B9A,0x137A,0x4BB5,0xE4A5,
-	0xE485,0xE465,0xEC25,0xE425,0x940D,0x1BFA,0x1BFA,0x1C1A,
+	0xB48C,0xECC8,0xECC6,0xECC5,0xED24,0xEDA4,0xC011,0xED95,
+	0xC554,0x9C9B,0x5C9B,0x64AC,0xA4EC,0xACAC,0xADF5,0xB5B5,
+	0x8005,0xA161,0x0000,0xA962,0x8002,0xA981,0xC003,0xA5AC,
+	0xE4A4,0x8003,0xB1C2,0x8002,0xB1E2,0xC003,0xACE4,0xAC9C,
+	0x8005,0xBA42,0x0000,0xA202,0x800B,0x0000,0x0002,0x1840,
+	0x6901,0xA1A2,0x8002,0xA9C2,0xC00C,0xECAC,0xA4ED,0xACEC,
+	0xACAC,0xEDAC,0xACE5,0x6300,0x8002,0xD324,0x8002,0xD344,
+	0x0002,0xD363,0xCB63,0xCB63,0x8002,0xCB83,0x0000,0xCB82,
+	0x8002,0xCB62,0xC00E,0xE4A4,0x9DA4,0xACEC,0xB4F4,0xAB5D,
+	0x9B94,0x5C9C,0x5D00,0x8003,0xCB23,0x0002,0xD324,0xD344,
+	0xDB44,0x8004,0xDB85,0x0002,0xDBA5,0xDBC4,0xDBC4,0x8002,
+	0xDBA4,0x8005,0xDBC4,0x0000,0xE3E4,0x8002,0xE3E5,0xC008,
+	0xB4B4,0xA3A4,0x9D9B,0x9DA4,0x6500,0x0003,0xA40B,0x7411,
+	0x4417,0x243B,0xC008,0x6B9C,0x5B9C,0x9453,0x9394,0x8D00,
+	0x0001,0x83EF,0xEDA5,0xC012,0x8C85,0x9CAC,0xA565,0xFEFF,
+	0xBFAE,0xFEBD,0x6DA5,0xE4A4,0x9CA3,0x4A00,0x0001,0xF5EF,
+	0xF569,0xC00E,0x5A9C,0xACA3,0x9CA5,0xACAF,0xF69B,0xE26C,
+	0xFC64,0xA300,0x0001,0xC50A,0x1AF8,0xC004,0x149D,0xEDAD,
+	0xE300,0x0002,0x3B36,0xE528,0xF568,0xC00E,0xEDA3,0xA463,
+	0xA35C,0xA4A6,0xAFEF,0xAEAD,0xA4A3,0xA400,0x0005,0x09EF,
+	0x01AF,0x018F,0x01CF,0x7BF0,0xFE32,0xC007,0xAD40,0x8052,
+	0x93A2,0xABBB,0x0000,0xEDC4,0xC011,0xE68D,0xCC54,0x9C9B,
+	0x5C9B,0x64AC,0xACEC,0xA4AC,0xADF5,0xB5B5,0x8005,0xA181,
+	0x8002,0xA981,0xC004,0xA5AC,0xA3E5,0xA400,0x8003,0xB1C2,
+	0x8002,0xB1E2,0xC003,0xACE4,0xAC9C,0x8006,0xBA42,0x8002,
+	0x0000,0x0001,0x1040,0x2060,0x8009,0x0000,0x0002,0x3080,
+	0x8141,0xA9C2,0xC00B,0xA4EC,0xACAD,0xECAC,0xECA4,0xACF5,
+	0xA4ED,0x8003,0xD324,0xC009,0xACA4,0xACA4,0xA364,0xACA4,
+	0xA3A4,0x8003,0xCB62,0xC00D,0xE49C,0xA4A5,0xF4AC,0xF4B3,
+	0xA45C,0x9454,0x9C9D,0x8003,0xCB23,0xC003,0xE5A4,0xACEC,
+	0x8002,0xDB85,0x0001,0xE3A5,0xDBA5,0x8002,0xDBC4,0x0001,
+	0xDBA4,0xDBA4,0x8004,0xDBC4,0xC011,0xECA4,0xA59C,0xACB4,
+	0xACAB,0xA49D,0x9C9C,0xA3A5,0xA49C,0x635E,0x0003,0xA3EC,
+	0x7411,0x3C16,0x13D9,0xC004,0x9C53,0x9494,0x8C00,0x0001,
+	0x7BEF,0xEDA5,0xC00C,0x8C85,0x9CA4,0xADAD,0xB5F7,0xBFF6,
+	0x76FE,0xAC00,0x0001,0x7BEF,0x7BF0,0x8005,0x7BEF,0x0000,
+	0x7BF0,0x8007,0x7BEF,0xC003,0xE464,0xA4A5,0x8002,0x7BEF,
+	0x0001,0x5393,0x0AB9,0xC004,0x9CED,0xADA3,0xA300,0x0002,
+	0x2B16,0xBCAC,0xF589,0xC007,0xE3A4,0x64A2,0x5CA4,0x9EF6,
+	0x0000,0xF5AE,0xC004,0xAEB5,0x9CA4,0xA300,0x0005,0x09CF,
+	0x01AF,0x018F,0x01AF,0x7BEF,0xFE52,0xC007,0xA540,0x805A,
+	0x939A,0x6BFC,0x0000,0xF5C4,0xC011,0xA58D,0xCD54,0x9C9B,
+	0x5C9B,0x64AC,0xACEC,0xACA4,0xADF5,0xB5B5,0x0003,0xA181,
+	0xA181,0xA9A1,0xA181,0x8004,0xA981,0xC004,0xA5AC,0xA3E5,
+	0xA400,0x8003,0xB1C2,0x8002,0xB1E2,0xC003,0xACE4,0xACA4,
+	0x8006,0xBA42,0x8002,0x0000,0x0004,0x2880,0xB242,0x9A01,
+	0x6141,0x1040,0x8007,0x0000,0x0001,0x50E1,0xA9C2,0xC00C,
+	0xA4EC,0xACAC,0xEDA4,0xECAC,0xACED,0xACAD,0xA300,0x8002,
+	0xD324,0x0001,0xD344,0xD344,0x8002,0xD364,0xC003,0xAB64,
+	0xA4A3,0x8004,0xCB62,0xC00D,0x9CA4,0xE4A4,0xADEC,0xB4F3,
+	0xAC5C,0x9C54,0x949C,0x8004,0xCB23,0x0002,0xD323,0xD344,
+	0xDB84,0x8002,0xDB85,0xC006,0xECA4,0x6CAB,0x9C9C,0xA400,
+	0x8003,0xDBC4,0xC006,0xACE4,0xA5A4,0x9CAC,0xB400,0x0003,
+	0x8410,0x7BEF,0x7BEF,0x8410,0x8003,0x7BEF,0x0000,0x8410,
+	0x8005,0x7C10,0x0007,0x7C0F,0x4BD4,0x0B78,0x0B37,0x0AF8,
+	0x0A98,0x840F,0xEDA5,0xC00C,0x8C85,0x9CA4,0xAC65,0xF5FF,
+	0xB7F7,0xBEBD,0xAD00,0x0000,0x0909,0xC004,0xA463,0xACA4,
+	0xED00,0x0002,0x09CD,0x0A53,0x0AB7,0xC017,0xA5A4,0xACE5,
+	0xA3A4,0x5192,0xAD66,0x9494,0x9CED,0xBEBC,0xA49C,0xEDAD,
+	0xA39B,0x5AA3,0x0002,0x4353,0xCCEB,0xF588,0xC005,0xA3A3,
+	0x5CA4,0xA5A7,0x0000,0xF58E,0xC004,0xB6B5,0x9CA4,0xAB00,
+	0x0005,0x09CF,0x01AF,0x018F,0x01AE,0x73D0,0xFE53,0xC007,
+	0xA440,0x805A,0x9B92,0xABBC,0x0000,0xF5C4,0xC011,0xAD85,
+	0xCD54,0x9C9B,0x5C9B,0x64AC,0xECAC,0xACA4,0xADF5,0xBDB5,
+	0x0000,0xA1A1,0x8004,0xA9A1,0x0002,0xA9A2,0xA981,0xA981,
+	0x8002,0xA9A2,0x0001,0xB1A2,0xB1A2,0x8002,0xB1C2,0xC008,
+	0xAC9C,0xACA4,0xACE4,0xA4AC,0xA400,0x8002,0xBA42,0x8002,
+	0xBA62,0x8002,0x0000,0x0001,0x2880,0xB262,0x8002,0xB242,
+	0x0002,0x91C1,0x48E0,0x1040,0x8004,0x0000,0x0000,0x50E1,
+	0x8002,0xA9C2,0xC00D,0xECAC,0xF5AC,0xA4EC,0xACED,0xACAC,
+	0xA4E4,0xACA4,0x8002,0xD344,0xC003,0xACA4,0xABA4,0x8003,
+	0xCB83,0xC012,0xA39C,0xA49C,0xA4E5,0xA4AC,0xECB4,0xF4AB,
+	0x9C5C,0x9C54,0x9C5C,0xA500,0x8002,0xCB23,0xC003,0xA5EC,
+	0xACEC,0x8002,0xE385,0xC005,0xACAB,0x64A4,0x9CA4,0x8002,
+	0xDBC4,0xC007,0xACA4,0xE4A4,0xA5A4,0xACAC,0x0000,0x1BBA,
+	0xC003,0x9C9D,0xB3A4,0x8003,0x1BFA,0xC00B,0xE56C,0xACE4,
+	0x639B,0x5C94,0x5B94,0x4CD4,0x0003,0x7BEF,0xF5A5,0xED65,
+	0xECE6,0x8002,0xECA6,0xC007,0xADB5,0xB7FE,0xF7B6,0xBDB6,
+	0x0000,0x0109,0xC005,0xA3AC,0xA3A4,0xEEBE,0x0001,0x0A31,
+	0x0AB6,0xC018,0xA7EB,0xA4A5,0xA4A3,0x9152,0xAEA5,0x5C94,
+	0xD4AD,0xBEBC,0xA49C,0xECAD,0xA4A3,0x5B5A,0x9C00,0x0001,
+	0x7BEF,0xF588,0xC007,0xA3A3,0x5CA4,0x9DAF,0xEFBF,0x8002,
+	0xF611,0x0008,0xF610,0x01CE,0x018F,0x018F,0x01AE,0x42EF,
+	0xFE53,0xFE53,0xF5AF,0xC005,0x489A,0x9B9A,0xA3BC,0x0000,
+	0xF5C5,0xC011,0xA5CD,0x8C54,0x9C9B,0x5C5B,0xA4AC,0xECAC,
+	0xACE5,0x6CFD,0xB5AD,0x0000,0xA1A1,0x8003,0xA9A1,0x0001,
+	0xA9A2,0xA9A2,0x8002,0xA9A1,0x8002,0xA9A2,0x8003,0xB1C2,
+	0xC00E,0xAC9C,0xACA4,0xACE4,0xA4AC,0xA4AC,0xA4AC,0x9CAC,
+	0xA400,0x8002,0x0000,0x0001,0x2880,0xBA42,0xC003,0x6C9C,
+	0xA49B,0x0002,0x7961,0x40C0,0x0820,0x8003,0x0000,0x0000,
+	0x50E1,0x8002,0xA9C2,0xC00A,0xACEC,0xADEC,0xACEC,0xACE5,
+	0xB4A4,0xEC00,0x8002,0xD324,0x0001,0xD344,0xD344,0x8002,
+	0xD364,0x0001,0xD383,0xD383,0x8003,0xCB83,0xC019,0xA39C,
+	0xA49C,0xA4E5,0xA3A5,0xECB4,0xB4F3,0xA49C,0x5C94,0x549C,
+	0xA564,0x9CA4,0xA5E4,0xB4ED,0x8002,0xE385,0x0001,0xE3A5,
+	0xE3C4,0x8002,0xDBC4,0x0002,0xDBA4,0xDBC4,0xDBC4,0x8002,
+	0xDBE4,0xC005,0xE4A4,0xAD9C,0xACAC,0x0000,0x1BBA,0xC004,
+	0x9D9C,0xABAC,0xAC00,0x8002,0x1BFA,0xC00B,0xA5AC,0xECA4,
+	0x5BA3,0x5C94,0x5B94,0x8C94,0x0003,0x7BEF,0xF5A5,0xED65,
+	0xECE6,0x8002,0xECA6,0xC005,0xADAD,0xF6BF,0xF6B6,0x0002,
+	0xFE93,0xF6D4,0x0129,0xC005,0xA49B,0xE4AC,0xA57D,0x0001,
+	0x0A10,0x1296,0xC018,0x6EED,0x9BAD,0xA3A4,0x9152,0xAEA5,
+	0x5C94,0x94ED,0xBEBC,0xA49C,0xECAD,0xA4A3,0x5B5A,0x9C00,
+	0x0001,0x8410,0xF588,0xC00B,0xA3A3,0x649C,0xE567,0xEFBE,
+	0xAE9C,0xACA4,0x0000,0x120F,0xC003,0x04A3,0xACAB,0x0008,
+	0x5B6F,0x7BEF,0x7BEF,0x8410,0x8C2F,0xC4AB,0xECE6,0xECE6,
+	0xED65,0xC012,0xFCA5,0xCD8C,0x549C,0x5B9B,0x5CEC,0x6CE4,
+	0xACAC,0xE5AC,0xBDB5,0xB500,0x0002,0xA9C1,0xA9C1,0xA9A1,
+	0x8002,0xA9C1,0x0000,0xA9C2,0x8003,0xA9A1,0x8002,0xA9A2,
+	0x8002,0xB1C2,0xC008,0xAC9C,0xACE4,0x6CA4,0xE4A4,0xAC00,
+	0x8002,0xBA42,0x8002,0xBA62,0x8002,0x0000,0x0005,0x2880,
+	0xB242,0xB262,0x91E2,0x4900,0x1040,0x8006,0x0000,0x0001,
+	0x50E1,0xA9A2,0xC00C,0xACA4,0xACE4,0xB4ED,0xACE4,0xACED,
+	0xACAC,0xAC00,0x8002,0xD324,0x0001,0xD344,0xD344,0x8002,
+	0xD364,0x0001,0xD363,0xD383,0x8003,0xCB83,0xC019,0xA39C,
+	0xA49C,0xA5E4,0xA3AD,0xE4B4,0xACF3,0xADA4,0x5B8C,0x9D5B,
+	0x9D64,0xA49D,0xA4E4,0xACEC,0x8002,0xE385,0xC003,0xACAB,
+	0x64AC,0x8003,0xDBC4,0x8002,0xDBE4,0x0000,0xDC04,0x8002,
+	0xE3E5,0x0002,0xE405,0xE425,0x1BBA,0xC004,0x9D9B,0xACAC,
+	0xAC00,0x8002,0x1BFA,0xC00B,0xA5AC,0xA4AB,0xA49B,0x5C94,
+	0x5B94,0x948C,0x0003,0x840F,0xF5C6,0xF586,0xECE6,0xC005,
+	0x949B,0xADA4,0xADB6,0x0000,0xF58C,0xC003,0xAFFE,0xBD7E,
+	0x0000,0x012A,0xC005,0xE363,0x9CAC,0xA4B5,0x0004,0x09CE,
+	0x0A75,0x0AB8,0x0AD8,0x12B8,0x8002,0x12D8,0xC012,0x5192,
+	0xADA6,0x5C8C,0x9CED,0xBEBC,0xA49C,0xECAD,0xA49B,0x635A,
+	0x9C00,0x0001,0x7BEF,0xF588,0xC005,0xA4A2,0xA45C,0x9DAE,
+	0x0001,0xF58D,0xF5CF,0x8002,0xF611,0x0002,0xF631,0x42CF,
+	0x018F,0xC004,0x9BB4,0xAB92,0xAD00,0x0006,0x0A51,0x0A94,
+	0x12D5,0x12F7,0x3336,0x9C2D,0xED65,0xC012,0xFCA5,0xCD8C,
+	0x549C,0x9B5B,0x9CAC,0x6CE4,0xACAC,0xED6C,0xF5BD,0xAD00,
+	0x0000,0xA9E1,0x8003,0xA9C1,0x0001,0xB1E2,0xB1C1,0x8002,
+	0xA9C1,0x0000,0xA9A1,0x8002,0xA9A2,0x8002,0xB1C2,0x8004,
+	0xB1E2,0xC005,0xECA4,0xACA4,0xACA4,0x8003,0xBA62,0x8002,
+	0x0000,0x0002,0x2060,0x5101,0x1840,0x8008,0x0000,0x0002,
+	0x1040,0x7121,0xA9A1,0xC00C,0xADA4,0xACE4,0xB4ED,0xA4EC,
+	0xACAC,0xEDAC,0xAC00,0x8003,0xD324,0x0000,0xD344,0x8002,
+	0xD364,0x0001,0xD363,0xD383,0x8003,0xCB83,0x0000,0xCB82,
+	0x8002,0xCB62,0xC017,0x9CE5,0xA3E5,0xACAC,0xB4F4,0xACA3,
+	0x5C9C,0x9454,0x9DA4,0x649D,0xA4EC,0xA4EC,0xADE4,0x8002,
+	0xE3A5,0x0001,0xE3E4,0xDBE4,0x8003,0xDBC4,0x8002,0xDBE4,
+	0xC005,0xAC9D,0xE4AC,0xA4AC,0x0000,0x4BF5,0x8003,0x4BD5,
+	0x8003,0x4BF5,0xC00B,0xE46C,0xE4A4,0x64A3,0x9C9C,0x649C,
+	0x9C94,0x0003,0x9C6D,0xF5C6,0xED85,0xECE6,0xC00A,0x939C,
+	0xADAC,0xA5B6,0xFEB7,0xB6FE,0x7D00,0x0000,0x092A,0xC005,
+	0x63A4,0x9BA3,0xE574,0x0004,0x09AC,0x0A33,0x0AB7,0x0AB8,
+	0x0AB8,0x8002,0x12D8,0xC012,0x5192,0xAEA5,0x5C94,0x94ED,
+	0xBEBC,0xA49C,0xACED,0xA4A3,0x5B5A,0x9C00,0x0001,0x7BEF,
+	0xF588,0xC007,0xA3A3,0xA49C,0x9DAE,0xAFB7,0x8002,0xF611,
+	0x0002,0xF631,0x8C50,0x016E,0xC004,0xA4B4,0xAB92,0xAD00,
+	0x0000,0x0A51,0xC004,0xB7AD,0xF6AD,0x9D00,0x0002,0x4B55,
+	0xE5A6,0xF5C6,0xC010,0xC54C,0x9CA4,0x935B,0x9CAC,0x64F4,
+	0xA4AC,0xED6C,0xFDB5,0xAD00,0x0000,0xA9E2,0xC007,0xA3E4,
+	0x64A4,0xE5A3,0xA5A3,0x8002,0xA9C1,0xC004,0xA59C,0xEBA5,
+	0xA400,0x8003,0xB1E2,0x0000,0xB202,0x8002,0xBA02,0xC006,
+	0xB49C,0xA4AC,0xA4AC,0xA500,0x800B,0x0000,0x0003,0x0820,
+	0x38C0,0x8981,0xA9C1,0xC013,0x65DC,0x6CE3,0xADA4,0xECAD,
+	0xECAC,0xECAC,0xE5AC,0xACAC,0xECA4,0xACA4,0x8002,0xD364,
+	0x8003,0xD383,0xC003,0x5CAB,0xA4A5,0x8002,0xCB62,0xC00C,
+	0x9DE4,0xE4AC,0xACB4,0xECB3,0xA464,0x9C94,0x5500,0x8002,
+	0xD343,0xC005,0xA564,0xE4AC,0xECA5,0x8003,0xE3A5,0x0001,
+	0xE3E4,0xDBE4,0x8003,0xDBC4,0xC009,0xABA5,0xA4AC,0xDCA5,
+	0xA4AC,0xACAC,0x8002,0xE465,0x0000,0xE445,0x8002,0xE425,
+	0xC00F,0x63DD,0x9C63,0x9CE5,0xACED,0xB4ED,0xACBC,0xBCBB,
+	0xAC53,0x0000,0xECE5,0xC005,0x8DA4,0xACA4,0xADAD,0x0000,
+	0xF56B,0xC003,0xF676,0xFE76,0x0000,0x092A,0xC005,0x63A4,
+	0xA39B,0xE4AE,0x0003,0x09AB,0x0A31,0x1297,0x0AB8,0x8003,
+	0x12D8,0xC007,0x5192,0xADA6,0x549C,0x9CE5,0x0000,0x0A79,
+	0xC009,0xB4A4,0x9CAC,0xEDA4,0x9B63,0x9B5B,0x0001,0x7BEF,
+	0xF588,0xC005,0xAB5B,0xA4DC,0x9D6D,0x0001,0xF58C,0xF5CF,
+	0x8002,0xF611,0x0002,0xF631,0x7BEF,0x016E,0xC004,0xA4B4,
+	0xA392,0xB600,0x0000,0x0A31,0xC005,0xBFED,0xAEB5,0x9D85,
+	0x0001,0x4315,0xF5E6,0xC010,0xC58C,0x945C,0x9B5B,0x9CAC,
+	0x6CE4,0xB4A4,0xEDAC,0xBDB5,0xA500,0x0003,0xA9E2,0xB202,
+	0xB201,0xB1E1,0x8002,0xB201,0x8003,0xB1E1,0xC005,0xA59C,
+	0xA4A3,0xA5A4,0x8004,0xB1E2,0xC006,0xACE4,0xA4AC,0xA4AC,
+	0xA400,0x0002,0xA202,0x6961,0x2060,0x8009,0x0000,0x0002,
+	0x40C0,0x7961,0xAA01,0xC012,0x9CA4,0x9CA4,0xA5A4,0xA3AD,
+	0xA4EC,0xADEC,0xACEC,0xACE5,0xACAC,0xAC00,0x8002,0xD324,
+	0x0000,0xD344,0x8003,0xD364,0xC009,0xA3A4,0xAC64,0xA4A3,
+	0xA5A4,0x9BA4,0x8002,0xD343,0xC00A,0xECAC,0xACF4,0xB4AB,
+	0x9C9C,0x5454,0x9D00,0x8002,0xD343,0x8002,0xD344,0x0001,
+	0xDB84,0xDB85,0x8003,0xE3A5,0x0002,0xE3E5,0xE3E4,0xE3E4,
+	0x8002,0xDBC4,0xC004,0xABE5,0xA46C,0xE400,0x8002,0xE405,
+	0xC005,0xACAC,0xABA5,0xA49C,0x8003,0xE425,0xC00A,0x9C9C,
+	0xA39D,0xA4A5,0xF4AC,0xF4AD,0xB500,0x0000,0xFD48,0xC003,
+	0x7AA3,0x5C84,0x8002,0xEC86,0xC005,0xACA4,0xB6FE,0xB6B6,
+	0x0000,0xFE51,0xC008,0xB56E,0xADA5,0xE5AD,0xA49B,0x8A00,
+	0x0003,0xF5F0,0xF589,0xF548,0xF546,0x8002,0xED27,0xC01A,
+	0xF7B6,0xA39A,0xF4AC,0xB45B,0x8294,0xACA4,0x9C63,0x9CAD,
+	0xE5EE,0x6CA3,0xA4A3,0xA4A3,0x5CDD,0x6D00,0x0001,0xED8C,
+	0xF5CE,0x8002,0xF611,0x0002,0xE5D1,0x19EE,0x016E,0xC003,
+	0xA4B4,0xA39A,0x0003,0x224D,0x4310,0x2AD2,0x12B5,0xC004,
+	0xADAE,0x9D8D,0x4C00,0x0001,0xBCEB,0xFD67,0xC003,0x4CD4,
+	0x5C9B,0x8002,0xEC65,0xC008,0x6CEC,0xACA4,0xEDAC,0xBDB5,
+	0xA500,0x0001,0xA9E2,0xB202,0x8005,0xB201,0x0001,0xB1E2,
+	0xB1E1,0x8002,0xB1E2,0x8003,0xB1C2,0x8004,0xB1E2,0xC004,
+	0xACE4,0xA4AC,0xA400,0x0001,0x7161,0x38A0,0x8009,0x0000,
+	0x0002,0x2880,0x7181,0xAA22,0xC015,0xEB9C,0x5C9C,0xA49C,
+	0xA4A5,0x64E3,0xA5AC,0xECA4,0xF5A4,0xB4EC,0xE5AC,0xACAC,
+	0x8002,0xD324,0x0001,0xD344,0xD344,0x8003,0xD364,0x8002,
+	0xD383,0xC016,0x64A3,0xA4A5,0x9BA4,0xA5DC,0xA4AC,0xECAC,
+	0xACF4,0xB3A4,0x9C54,0x945D,0x9C9C,0xA400,0x8002,0xD344,
+	0x0001,0xD384,0xDB85,0x8003,0xE3A5,0x0002,0xE3E5,0xE3E4,
+	0xE3E4,0x8002,0xDBC4,0xC004,0xACE4,0xA46C,0xE400,0x8002,
+	0xE405,0xC004,0xACAC,0xACA4,0x6500,0x0003,0x9C0D,0x6BF2,
+	0xBC29,0xE425,0xC006,0xA49C,0x9CA3,0xA59C,0xA400,0x0002,
+	0xCC08,0xDC27,0xEC66,0xC019,0xF5B5,0xB3BC,0xB353,0x8484,
+	0xA4A5,0xA4AC,0xADFF,0xBEB6,0xFEBE,0x6EAD,0xA5E5,0xACA5,
+	0xA44A,0x0003,0xF631,0xF5AA,0xF568,0xF546,0x8002,0xED27,
+	0xC01F,0xF7B6,0xA39A,0xF4AC,0xB45B,0x8294,0xA4AC,0x9C63,
+	0xA4A5,0xE5EE,0xAC63,0xA4AB,0x9CA3,0x5C9C,0xAEAF,0xF7B7,
+	0xAD9C,0x0011,0xACD0,0x09AE,0x016E,0x016E,0x018D,0x11ED,
+	0xBD32,0xF632,0xF5AE,0xF56B,0xD50C,0x3B34,0x12D8,0x12D9,
+	0x125A,0x0A1A,0x73B1,0xFD67,0xC003,0x8C94,0x5C9B,0x8002,
+	0xEC65,0xC008,0xACAC,0xACA4,0xEDAC,0xBDB5,0xAD00,0x0000,
+	0xA9E1,0xC003,0xED63,0xECA4,0x8004,0xB201,0xC010,0x9DAB,
+	0x9DA4,0x9CAC,0xA49C,0xACA4,0xAC9C,0xA4AC,0xECA4,0xAC00,
+	0x8008,0x0000,0x0002,0x2060,0x6941,0x9A02,0x8002,0xB262,
+	0xC015,0x9CA4,0x5C9C,0xA49B,0x659B,0xE4A4,0xA5AC,0xACE4,
+	0xADEC,0xACEC,0xACED,0xACAC,0x8002,0xD324,0x0001,0xD344,
+	0xD344,0x8004,0xD364,0x8002,0xD383,0x0002,0xCB83,0xCB82,
+	0xCB82,0x8002,0xCB62,0x8002,0xD343,0xC00C,0xECAC,0xB4EC,
+	0xBBAC,0x9C54,0x9554,0x9CA4,0x9C00,0x8002,0xD344,0x0001,
+	0xD364,0xDB85,0x8003,0xE3A5,0x0002,0xE3C5,0xE3E4,0xE3E4,
+	0x8002,0xDBC4,0x8002,0xDBE4,0x0001,0xE404,0xE404,0x8002,
+	0xE405,0x0008,0xE425,0xE445,0xE465,0x9C2D,0x2379,0x1B9A,
+	0x1BDA,0x8BEE,0xE405,0xC006,0xAB9D,0xA39C,0x9DA4,0xAC00,
+	0x0004,0x83EF,0x13D9,0x43D4,0xBC4B,0xF4C8,0xC003,0xFB7C,
+	0xB35B,0x0000,0xED06,0xC013,0x83A4,0xA5A4,0xACAC,0xFFB6,
+	0xB6FE,0x7EB6,0xEEA5,0xA56C,0xE5A4,0x9A41,0x0002,0xF5CC,
+	0xF548,0xF547,0x8002,0xED27,0xC01F,0xF6B7,0x9BA2,0xF4B4,
+	0x6C9B,0x8A8C,0xACA5,0x9B5B,0xA4AD,0xEEE5,0xB4A3,0x5CA3,
+	0xAC9B,0x5C9D,0xEDAF,0xB7B6,0xAD9D,0x0006,0x7BEF,0x018E,
+	0x016E,0x016E,0x018E,0x9C90,0xFE74,0xC003,0x5281,0x9163,
+	0x0006,0xCCEB,0x12D7,0x12D9,0x125A,0x0A1A,0x4314,0xF547,
+	0xC00F,0xD494,0x5C9B,0x5BA4,0x64EC,0xACAC,0xADE4,0xB4B5,
+	0xB5AD,0x0000,0xAA01,0xC004,0xE5A3,0xACA4,0x9C00,0x8002,
+	0xB221,0x8002,0xB201,0x0001,0xB202,0xB202,0x8008,0xB1E2,
+	0x0000,0xB202,0x8002,0xBA22,0x8005,0x0000,0x0002,0x1840,
+	0x5121,0x9A02,0x8002,0xBA62,0x8002,0xB262,0xC01A,0x9CA4,
+	0x5B9C,0xA59B,0x659B,0xE464,0xA5E4,0xACEC,0xADEC,0xACEC,
+	0xACED,0xACAC,0xE4AC,0xA4AC,0xA400,0x8004,0xD364,0x8002,
+	0xD383,0xC013,0x64AC,0x9B9C,0xA5A3,0xE59C,0xA4EC,0xACAC,
+	0xECBC,0xABA4,0x9C54,0x8C65,0x8002,0xD363,0xC003,0x9DAC,
+	0xA4EC,0x8003,0xE3A5,0x0002,0xE3C5,0xE3E5,0xE3E4,0x8002,
+	0xDBC4,0x8002,0xDBE4,0x0001,0xE404,0xE404,0x8002,0xE405,
+	0x0008,0xEC25,0xE445,0x9C0D,0x137A,0x137A,0x1B7A,0x1BBA,
+	0x7BEF,0xE425,0xC006,0xA4A3,0x9D9B,0xA49D,0xA400,0x0005,
+	0x63F2,0x13D9,0x0B98,0x0B78,0x63D2,0xFD27,0xC003,0x7CB3,
+	0x9B44,0x0001,0xEC85,0xEC85,0x8002,0xEC86,0xC00E,0xB5B6,
+	0xFEF5,0xBF7E,0xADAE,0xE56E,0xACE5,0xA49B,0x5100,0x0002,
+	0xF5EE,0xF568,0xF547,0x8002,0xED27,0xC01F,0xF6B7,0x9BA2,
+	0xF4B4,0x6C9B,0x8294,0xACA4,0x9C5B,0xACA5,0xEEED,0xA4AB,
+	0x5CAB,0xA39C,0x5CA4,0xE6AF,0xB7B6,0xAEA4,0x0005,0x7BEF,
+	0x018E,0x016E,0x016E,0x018D,0xFE53,0xC005,0xB58A,0x4191,
+	0x639B,0x0005,0x4B73,0x12B9,0x125A,0x09FA,0x4314,0xFD47,
+	0xC00F,0x9455,0x9B9B,0x5BA4,0x6CE4,0xACAC,0xADA4,0xB4FD,
+	0xADAD,0x0002,0xA9E2,0xB202,0xB201,0x8005,0xB221,0x0000,
+	0xBA22,0x8002,0xB201,0x0002,0xB202,0xB202,0xB201,0x8006,
+	0xB1E2,0x0000,0xB202,0x8002,0xBA22,0x8002,0x0000,0x0003,
+	0x0820,0x40E1,0x81C2,0xBA82,0xC010,0xA49C,0xACA4,0x9CAC,
+	0xA45C,0x9CA4,0x9B64,0x9DA3,0x9C5C,0xEC00,0x8002,0xA1C1,
+	0xC013,0xEDEC,0xADEC,0xA4AC,0xF4AD,0xECA4,0xACE4,0xA4B4,
+	0xA4AC,0xAC9C,0xA4AC,0x8002,0xD383,0xC021,0x6CA4,0xA39D,
+	0xA49C,0xE49C,0xA4AC,0xECAC,0xECB4,0xB3AC,0x959B,0x5495,
+	0x5CA4,0xA59C,0xACA4,0xECED,0xAC9C,0xA4AC,0xABA5,0x8002,
+	0xDBC4,0xC004,0xACA4,0xACE4,0xA400,0x8002,0xE405,0x0002,
+	0xE425,0xB42A,0x1B9A,0xC003,0x5CA4,0xE4B4,0x0001,0x63F2,
+	0xE425,0xC006,0xA3A5,0x9C5C,0xE35C,0xE500,0x0009,0x4C14,
+	0x13D9,0x0BB8,0x0B78,0x0B38,0x8C2F,0xF587,0xF5C6,0xF5A5,
+	0xED25,0x8002,0xEC85,0xC010,0xA5A4,0xACB6,0xFEB6,0xFD7F,
+	0xF666,0xADED,0xA5AD,0xA463,0x9200,0x0001,0xFDEF,0xF589,
+	0x8003,0xF547,0xC01F,0xAEB7,0x9BA2,0xF4B4,0x6C9B,0x8294,
+	0xACA5,0x9B63,0xA4E5,0xAEED,0xA4AB,0x5CAB,0xA49B,0x5CE4,
+	0xA6AF,0xB6B7,0xADA5,0x0006,0x7BEF,0x01AD,0x016E,0x016D,
+	0x01AD,0xCD72,0xFE94,0xC004,0x8A48,0x925B,0x9B00,0x0005,
+	0x22F6,0x12B9,0x0A3A,0x09FA,0x4314,0xF547,0xC00F,0xD455,
+	0x9B5B,0x9B64,0xECA4,0xACAC,0xA5EC,0xB4BD,0xADAD,0x0002,
+	0xA9E1,0xB201,0xB201,0x8004,0xB221,0xC004,0xE4A5,0xA364,
+	0xA400,0x8002,0xB202,0x0001,0xB201,0xB202,0x8004,0xB1E2,
+	0x0000,0xB202,0x8002,0xBA22,0x0004,0x0000,0x38A0,0x7161,
+	0xBA62,0xBA82,0x8002,0xBA83,0x8002,0xBA82,0xC029,0x9CAC,
+	0xA464,0x9C9C,0x9B64,0x9CA4,0x9C64,0xE464,0x9CAD,0xE4AC,
+	0xEDAC,0xE4AC,0xECAD,0xECAC,0xACE4,0xA4B4,0xA4AC,0xA4AC,
+	0x9CAC,0xA4A3,0xA46B,0xA4A5,0x8002,0xCB83,0xC023,0xDCA4,
+	0x9CEC,0xA4B4,0xE4BC,0xB4AC,0x9B94,0x5495,0x649C,0xA59C,
+	0xACA4,0xECAD,0xEC9C,0xA4AC,0xACAB,0x9D5B,0xA4AC,0xA4AC,
+	0xE4A4,0x8002,0xE405,0x0007,0xEC25,0x4BF4,0x1B9A,0x137A,
+	0x137A,0x1B7A,0x43D6,0x940D,0x8002,0xE425,0xC004,0x9C9C,
+	0x5CA3,0xE500,0x0000,0x23F8,0xC004,0x1D5B,0x9494,0xD300,
+	0x0004,0xF587,0xF5C6,0xF5C5,0xED25,0xEC85,0x8004,0xEC86,
+	0xC00D,0xBEFE,0xF5B6,0x7EB6,0xAEAE,0xE5AD,0xADA5,0xA392,
+	0x0001,0xF631,0xF5AA,0x8002,0xED47,0xC020,0xE4AE,0xB7A3,
+	0x9AF4,0xB46C,0x9B82,0x94AD,0xA364,0x9BA4,0xE5AE,0xEDA4,
+	0x63A4,0xACA3,0x9B5C,0xA4E6,0x6EF7,0xAFB6,0xA400,0x0006,
+	0x9C90,0x098D,0x016E,0x016D,0x01AD,0x326D,0xEE34,0xC003,
+	0xE288,0x929B,0x0006,0x63B1,0x12D7,0x12B9,0x0A39,0x09FA,
+	0x6392,0xFD47,0xC00F,0x9454,0x9C5B,0x9B64,0xECA4,0xACAC,
+	0xADE4,0xBCB5,0xADA6,0x0002,0xA9E1,0xB201,0xB201,0x8003,
+	0xB221,0x0002,0xBA21,0xBA41,0xBA41,0x8002,0xBA21,0x8002,
+	0xB221,0x0002,0xB201,0xB201,0xB202,0x8004,0xB1E2,0xC003,
+	0xECAC,0xA41C,0x0003,0xBA42,0xBA42,0xBA62,0xBA82,0x8002,
+	0xBA83,0x8002,0xBA82,0xC020,0x9CAC,0xA464,0xA494,0xA39C,
+	0x659C,0x9B64,0xA4E4,0x5CAD,0xE4A4,0xECB5,0xECA4,0xECAD,
+	0xECAC,0xACE4,0xACAD,0xA3AC,0xA400,0x8003,0xD384,0xC004,
+	0xA3A4,0xAC64,0xA400,0x8002,0xCB82,0xC015,0x9DE4,0xA4AC,
+	0xE4AC,0xE4B4,0xB4B4,0xA394,0x5495,0x5CA4,0x9CA5,0xA4AC,
+	0xE4AD,0x8003,0xE3C5,0xC006,0xACAC,0xA39C,0x5CAC,0xAC00,
+	0x8002,0xE404,0x8002,0xE425,0x0007,0xD426,0x13BA,0x1B9A,
+	0x1B7A,0x1B5A,0x9C2D,0xE465,0xE445,0x8002,0xE425,0xC005,
+	0x9C63,0x95A3,0xE56E,0x000B,0x9C0D,0x1BB7,0x0B78,0x0337,
+	0x0AD8,0xAC8C,0xF5C6,0xF5C5,0xED45,0xECA5,0xEC86,0xEC85,
+	0x8002,0xEC86,0xC00E,0xFEB5,0xF6BD,0x7FB6,0xADE7,0xADAD,
+	0xADAD,0xA492,0x4000,0x0000,0xF5CC,0xC023,0x489B,0xE4A4,
+	0xAEB7,0xA39A,0xF4B4,0x6C9B,0x8294,0xADAC,0x5B9B,0xA4A5,
+	0xEEED,0xA4AC,0x5BAB,0xA49B,0x9CA5,0x9CB7,0xAFBF,0xAEA4,
+	0x0001,0xD5B1,0x016D,0xC003,0x9DAB,0xAC9A,0x0005,0x11CB,
+	0x636F,0x7BEF,0x6390,0x2AF3,0x12B5,0xC003,0x6ED5,0x459D,
+	0x0001,0xACAC,0xFD47,0xC00F,0x945C,0x935C,0xA3A4,0xA3A5,
+	0xACB5,0xA3AD,0xB4F5,0xB59D,0x0002,0xA9E1,0xB201,0xB201,
+	0x8003,0xB221,0x0000,0xBA21,0x8002,0xBA41,0x8004,0xBA21,
+	0x8004,0xB202,0x8002,0xB1E2,0x0002,0xBA02,0xBA22,0xBA22,
+	0x8002,0xBA42,0x0001,0xBA62,0xBA82,0x8002,0xBA83,0x8005,
+	0xBA82,0x8002,0xB282,0xC01A,0x94A3,0x5D9C,0x9BA4,0x64A4,
+	0x9CAD,0xE4A4,0xECAD,0xACEC,0xACED,0xECA4,0xB4E4,0xACAD,
+	0xA3AC,0xA400,0x8004,0xD384,0x0000,0xD383,0x8002,0xD3A3,
+	0xC003,0x5BAD,0x9C9C,0x8002,0xD363,0xC012,0xECA4,0xECB4,
+	0xB4B4,0xA39C,0x9455,0x5C9C,0xA49C,0xA5AC,0xE4AD,0xE400,
+	0x8002,0xE3C5,0xC009,0xACAC,0xA49B,0x5CEC,0xA4AC,0xA4AC,
+	0x8002,0xE425,0x0005,0xB40A,0x13BA,0x1B9A,0x1B7A,0x63D2,
+	0xE4A5,0xC003,0x949C,0x9CA4,0x0010,0x8C0E,0x33F8,0x4BF5,
+	0x4C15,0xDBC4,0xE3C5,0xE3E5,0xEC26,0x9C0D,0x0B78,0x0B58,
+	0x0AF8,0x83EF,0xF5A6,0xF5A5,0xED45,0xECA5,0xC013,0x9DA3,
+	0xA4A5,0xA4BD,0xF6B6,0xFD7E,0xB6A6,0xAEED,0xAEAC,0xADA5,
+	0x9B40,0x0001,0xF5CD,0xF568,0xC023,0x5BE4,0xA4AE,0xB7A3,
+	0x9AF4,0xB4AC,0x5B82,0x94AD,0xAC5B,0x9CA3,0xE5AE,0xEDA4,
+	0xAC5B,0xACA3,0x9B9C,0x64DD,0xB7AF,0xBFAD,0xA5EC,0x0001,
+	0x636F,0x014E,0xC00B,0xABAC,0x9AA4,0xBEFF,0xAEEE,0xADAE,
+	0x9D45,0x0001,0x42F5,0xFDC6,0xC004,0x8693,0x5C9C,0x5300,
+	0x8002,0xEC85,0x0002,0xDC87,0xB44A,0xECE6,0xC005,0xA4EC,
+	0xB4BD,0xA5A5,0x0002,0xA9E1,0xA9E1,0xB201,0x8003,0xB221,
+	0x0000,0xBA21,0x8004,0xBA41,0x8002,0xBA21,0x0001,0xBA22,
+	0xBA22,0x8002,0xB202,0x0002,0xB1E2,0xB1E2,0xB202,0x8002,
+	0xBA22,0x8002,0xBA42,0x0001,0xBA62,0xBA82,0x8002,0xBA83,
+	0x0001,0xBA82,0xBA83,0x8002,0xBA82,0x0000,0xBAA2,0x8002,
+	0xB282,0xC008,0x9C5B,0x9D9C,0xA49B,0xA464,0x9C00,0x8002,
+	0xA9E2,0xC00F,0xECAC,0xEDAC,0xA4F4,0xA4ED,0xACEC,0xACAC,
+	0xA4AC,0xA4EC,0x8003,0xD384,0x8003,0xD3A3,0x8002,0xCBA3,
+	0x0000,0xCB83,0x8002,0xD363,0xC019,0xACEC,0xA4B4,0xF4AC,
+	0xABA4,0x944D,0x9CA4,0x5CA5,0x9CAB,0xE5AD,0xECA5,0xA4AB,
+	0xACAC,0x9C9C,0x8002,0xE3E4,0xC005,0xACA4,0xACA5,0xA4E4,
+	0x0005,0xB40A,0x13BA,0x1B9A,0x1B7A,0x7BEF,0xE4A5,0xC003,
+	0x9C94,0x9BA5,0x0010,0xB40A,0x1BFA,0x241A,0x1C3A,0xC3C7,
+	0xE3C5,0xE3E6,0xEC26,0xB42B,0x0B98,0x0B58,0x0AF8,0x83EF,
+	0xF5C6,0xF5C5,0xED45,0xECA5,0xC008,0x94AC,0xA49C,0xADB5,
+	0xF5B6,0xBD00,0x0000,0xF62D,0xC009,0xAEAE,0xEE66,0xB6EC,
+	0xA5AD,0x9B89,0x0001,0xF5EE,0xF569,0xC003,0x5AE4,0xA4AE,
+	0x0000,0xF5AD,0xC01F,0xA29A,0xF4B4,0xAC5B,0x8294,0xADAC,
+	0x5B9B,0xA4E5,0xAEED,0xA464,0xA3AC,0xA39B,0x9C64,0xE56F,
+	0xEEBF,0xAEAD,0xE41B,0x0001,0x324E,0x014D,0xC009,0xB49B,
+	0xA2BF,0xFFAE,0xEDAE,0xAD96,0x0002,0x3AD5,0xE5C6,0xFDC6,
+	0xC007,0x8694,0x5B9C,0x53A3,0xA4AC,0x0004,0x9C2D,0x135A,
+	0x2B57,0xBC6B,0xF526,0xC003,0x74F5,0xAD9D,0x0000,0xAA01,
+	0xC007,0xE5A4,0xA3AC,0xAD9B,0xE46D,0x8003,0xBA41,0xC005,
+	0xA5A3,0xA49C,0xA5A3,0x8005,0xB202,0x0006,0xBA22,0xBA22,
+	0x89A2,0x89A2,0x89C2,0x89C2,0xB242,0x8002,0xC283,0x8002,
+	0xBA83,0x8003,0xBA82,0xC007,0x64A3,0x9D5B,0x9DA3,0x9D9C,
+	0x8002,0xA1E1,0xC013,0xE465,0xE4AC,0xE4B5,0xECA4,0xECAC,
+	0xEDAC,0xACE4,0xACAD,0xABA4,0xACE4,0x8002,0xD384,0x0000,
+	0xD383,0x8002,0xD3A3,0xC010,0xA364,0x9DA4,0xE4A4,0x9CEC,
+	0xA5AB,0xF4B4,0xACEB,0x6494,0x9400,0x8002,0xDBA3,0x0000,
+	0xD383,0x8002,0xD384,0x0000,0xDBA5,0x8003,0xE3C5,0x0000,
+	0xE3E5,0x8002,0xE405,0xC008,0x9CA3,0xA4AC,0xA4AC,0xA4A5,
+	0xA400,0x0005,0xC429,0x13BA,0x1B9A,0x137A,0x4BB5,0xE4A5,
+	0xC003,0x9C9C,0xD464,0x0010,0x940D,0x1BFA,0x1BFA,0x1C1A,
 	0x6C12,0xE3C5,0xE3E5,0xEC26,0x53F3,0x0B78,0x0B58,0x02F7,
-	0x942E,0xF5A6,0xF5C5,0xED45,0xECA5,0xEC65,0xEC86,0xEC86,
-	0xEC65,0xEC86,0xECC7,0xF508,0xF54A,0xF5AA,0xF60C,0xF64E,
-	0xF650,0xF673,0xF695,0xFED6,0xFED7,0xFEF8,0xFF39,0xFF18,
-	0xFEB6,0xF610,0xF58A,0xF547,0xF546,0xF547,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xF5C9,0xFE09,0xFE29,0xF608,0xF5A6,0xF566,
-	0xF567,0xF587,0xF566,0xED46,0xED45,0xF566,0xF568,0xFD89,
-	0xFDA9,0xFDA9,0xF5A8,0xF5A8,0xF5A7,0xF586,0xF566,0xF546,
-	0xF547,0xF589,0xF5AC,0xF5EF,0xF631,0xF632,0xF652,0xFE92,
-	0xEE52,0x6BAF,0x018C,0x016A,0x016A,0x01CD,0x0A30,0x0A52,
-	0x0A73,0x1294,0x1296,0x73D1,0xE5A7,0xF606,0xFDC7,0xFD48,
-	0xFD28,0xF4E7,0xF4A6,0xEC86,0xEC85,0xEC85,0xEC85,0x3BB6,
-	0x133A,0x1319,0x1319,0x63B2,0xED66,0xF5A7,0xF5C8,0xF5A9,
-	0xB221,0xB221,0xB221,0xB221,0xB221,0xB241,0xB221,0xB222,
-	0xB241,0xBA41,0xBA41,0xBA41,0xBA42,0xBA41,0xBA41,0xBA41,
-	0xBA42,0xBA22,0xBA22,0xBA21,0xBA21,0xB202,0xB202,0xBA22,
-	0xBA22,0xBA22,0xBA22,0x0000,0x0000,0x0000,0x0000,0x89C2,
-	0xBA83,0xC282,0xC283,0xBA62,0xC283,0xBA83,0xBA83,0xBA82,
-	0xBA82,0xBA82,0xB282,0xB282,0xB262,0xB262,0xB241,0xAA21,
-	0xAA02,0xAA02,0xA9E2,0xA9E2,0xA1E1,0xA9E1,0xA1E2,0xA9E2,
-	0xAA02,0xAA02,0xB243,0xB263,0xBA63,0xC283,0xC2A3,0xCAC4,
-	0xCAE4,0xCB04,0xD304,0xD324,0xD344,0xD364,0xD364,0xDB84,
-	0xDB84,0xDB84,0xDB84,0xDB84,0xD3A3,0xD3A3,0xD3A3,0xD3A3,
-	0xD3A2,0xD3C2,0xCBA3,0xD383,0xD383,0xCB63,0xD363,0xDB83,
-	0xDB83,0xDBA4,0xE3C3,0xE403,0xE443,0xE462,0xEC62,0xE442,
-	0xE3E2,0xDBC2,0xDBA3,0xDBA3,0xD383,0xD384,0xD384,0xD384,
-	0xDBA4,0xDBC5,0xE3C5,0xE3C5,0xE3C5,0xE3E5,0xE405,0xE425,
-	0xE405,0xE3E4,0xE3E4,0xE3E4,0xE404,0xE424,0xE424,0xE425,
-	0xE445,0xE445,0xE445,0x23B8,0x1B9A,0x137A,0x135A,0x8C0E,
-	0xEC85,0xE465,0xE425,0xC429,0x2BD9,0x1BFA,0x1BFA,0x1C1A,
-	0x243A,0x2C39,0x4C14,0x33F6,0x0BB8,0x0B78,0x0358,0x02F7,
-	0xDD09,0xF5C6,0xF5C6,0xED45,0xECA5,0xEC65,0xEC65,0xEC65,
-	0xEC65,0xEC86,0xECC7,0xF508,0xF54A,0xFD8A,0xF60C,0xF62D,
-	0xF630,0xF672,0xF694,0xF6B6,0xFED7,0xFEF8,0xFF39,0xFF19,
-	0xF6D6,0xF632,0xF5AB,0xED48,0xF546,0xED47,0xF569,0xF5AC,
-	0xF58B,0xF589,0xFDC9,0xFE09,0xFE29,0xF608,0xF5A6,0xF546,
-	0xF567,0xED87,0xED67,0x12B9,0x12BA,0x0A99,0x0A97,0x0276,
-	0x0A76,0xFDA9,0xF5A8,0xF5A8,0xF5C7,0xF586,0xF587,0xED66,
-	0xF547,0xF569,0xF5AC,0xF60F,0xF631,0xF632,0xF672,0xFE92,
-	0xFEB2,0xFEB2,0xEE32,0x9CB1,0x634E,0x42EE,0x4310,0x4331,
-	0x6390,0x8C2F,0xD50B,0xED87,0xF606,0xF606,0xFDA7,0xFD47,
-	0xFD28,0xF4E7,0xF4C6,0xEC86,0xEC86,0xEC85,0xCC68,0x137A,
-	0x133A,0x1319,0x0B19,0x12D9,0x7BEF,0xF5A7,0xF5C8,0xF5A9,
-	0xB281,0xB261,0xB241,0xB221,0xB241,0xB221,0xBA21,0xB222,
-	0xB242,0xB241,0xBA41,0xBA41,0xBA41,0xBA41,0xBA41,0xBA41,
-	0xBA42,0xBA41,0xBA22,0xBA22,0xBA22,0xBA22,0xB222,0xB222,
-	0xBA22,0xB202,0xBA22,0x0000,0x0000,0x0000,0x0000,0x89C2,
-	0xBA83,0xC283,0xC283,0xBA83,0xC283,0xBAA3,0xBA83,0xBA83,
-	0xBA82,0xBAA2,0xB2A2,0xB282,0xB262,0xB262,0xB241,0xB221,
-	0xAA21,0xAA02,0xAA02,0xA9E2,0xA1E1,0xA9E2,0xA1E2,0xA9E2,
-	0xA9E2,0xAA02,0xB223,0xB243,0xBA63,0xC283,0xC2A4,0xC2C4,
-	0xCAE4,0xCAE4,0xD324,0xD324,0xD324,0xD344,0xD364,0xDB84,
-	0xDB84,0xDB84,0xDB84,0xDB84,0xD3A3,0xD3A3,0xD3A3,0xD3C3,
-	0xD3C3,0xD3C2,0xCBA2,0xCB82,0xCB83,0xD383,0xD383,0xDB83,
-	0xDB83,0xDBA4,0xE3C3,0xE403,0xE423,0xEC63,0xEC82,0xEC62,
-	0xE422,0xDBE2,0xDBC3,0xDBA3,0xD383,0xD383,0xD384,0xD384,
-	0xDBA5,0xDBC5,0xE3C5,0xE3E6,0xE3E5,0xEBE5,0xE405,0xE425,
-	0xE405,0xE3E4,0xE3E5,0xE3E4,0xE404,0xE424,0xE424,0xE425,
-	0xE445,0xE445,0xE445,0x63F2,0x1B9A,0x137A,0x135A,0x135A,
-	0x2379,0x4BD5,0x3BD6,0x1BBA,0x1BDA,0x1BFA,0x43F6,0x1C1A,
-	0x1C3A,0x1C3A,0x1C19,0x13F9,0x13B8,0x0B78,0x0B57,0x4373,
-	0xF567,0xF5A6,0xF5C5,0xED65,0xECC5,0xEC65,0xEC65,0xEC65,
-	0xEC65,0xEC86,0xECC6,0xF508,0xF529,0xF58A,0xF5EA,0xF62C,
-	0xF64F,0xF632,0xF674,0xF6B5,0xFED7,0xFEF8,0xFF39,0xFF39,
-	0xFEF7,0xF653,0xF5CC,0xF568,0xF547,0xED47,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFDE9,0xFE29,0xF5E8,0xFDA6,0xF566,
-	0xF567,0xF587,0xF566,0x1299,0x12B9,0x0A99,0x0A97,0x0276,
-	0x0256,0xFDA9,0xF5A8,0xF5A8,0xF5A7,0xF586,0xF586,0xF566,
-	0xF547,0xF569,0xF58C,0xF60E,0xF631,0xFE52,0xF652,0xFE92,
-	0xFEB2,0xFEB2,0xFE73,0xFE95,0xFE95,0xFE32,0xF5CF,0xF5AD,
-	0xF5AC,0xED8B,0xED69,0xF5A7,0xF606,0xF606,0xF5A7,0xFD47,
-	0xFD28,0xF4E7,0xF4C6,0xEC86,0xEC85,0xEC85,0x7BEF,0x135A,
-	0x133A,0x1319,0x0AF9,0x0AD9,0x1AB8,0xE568,0xF5A8,0xF5A9,
-	0xBAE1,0xBAC2,0xBAA2,0xB262,0xB241,0xB241,0xBA42,0xBA42,
-	0xBA42,0xB241,0xBA41,0xBA41,0xBA41,0xBA41,0xBA41,0xBA41,
-	0xBA62,0xBA41,0xBA41,0xBA42,0xBA42,0xBA22,0xBA22,0xBA22,
-	0xBA22,0xBA22,0xBA22,0x0000,0x0000,0x0000,0x0000,0x89C2,
-	0xBA83,0xBA83,0xBA83,0xBA83,0xBA83,0xBA83,0xBA83,0xBA83,
-	0xBA82,0xBAA2,0xBAA2,0xB282,0xB282,0xB262,0xB261,0xAA41,
-	0xAA21,0xAA02,0xA9E2,0xA9E2,0xA1E1,0xA1E2,0xA9E1,0xA9E2,
-	0xA9E2,0xAA02,0xB223,0xB243,0xBA63,0xBA83,0xC2A3,0xC2C4,
-	0xCAE4,0xCB04,0xD324,0xD324,0xD324,0xD344,0xD364,0xDB84,
-	0xDB84,0xDB84,0xDB84,0xDB84,0xD3A3,0xD3A3,0xD3A3,0xD3C3,
-	0xD3C2,0xD3C2,0xCBC2,0xCBA3,0xCB83,0xD383,0xD383,0xDB83,
-	0xDB83,0xDB84,0xDBC3,0xE3E3,0xE423,0xEC42,0xEC82,0xEC62,
-	0xE422,0xE3E2,0xDBC3,0xDBA3,0xDB83,0xD384,0xD384,0xDBA4,
-	0xDBA4,0xDBC5,0xE3E6,0xE3E6,0xE3E5,0xE405,0xE405,0xE425,
-	0xE425,0xE405,0xE3E5,0xE3E4,0xE404,0xE424,0xE424,0xE424,
-	0xE445,0xE425,0xEC45,0xCC28,0x23B8,0x137A,0x133A,0x133A,
-	0x137A,0x1B9A,0x1BBA,0x1BBA,0x1BDA,0x23F9,0xD406,0x4416,
-	0x243A,0x1C3A,0x1C1A,0x13F9,0x0BB8,0x0B98,0x1B77,0xD4AA,
-	0xF567,0xF5A6,0xF5C5,0xED65,0xECC5,0xEC65,0xEC65,0xEC65,
-	0xE465,0xEC65,0xECA6,0xF508,0xF529,0xF569,0xF5EA,0xF62C,
-	0xF62E,0xF631,0xF654,0xF695,0xFED6,0xF6F8,0xFF39,0xFF3A,
-	0xFF18,0xF694,0xF5EE,0xED68,0xF546,0xED47,0xF569,0xF5AC,
-	0xF5AB,0xF589,0xF5A9,0xFE09,0xFE29,0xF608,0xFDA6,0xF566,
-	0xF567,0xF587,0xF587,0x1299,0x12BA,0x0A99,0x0A97,0x0276,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5A7,0xF5A6,0xF586,0xED66,
-	0xF547,0xED69,0xF5AB,0xF5EE,0xF631,0xF651,0xF672,0xFE92,
-	0xFEB2,0xFEB2,0xFE73,0xFE95,0xFE95,0xFE32,0xF5CF,0xF5AE,
-	0xF5AC,0xED8B,0xED89,0xF5C7,0xF606,0xF606,0xFDA7,0xFD47,
-	0xFD08,0xF4E7,0xF4C6,0xEC85,0xEC85,0xEC85,0xCC68,0x4BB5,
-	0x1339,0x0B19,0x0AF9,0x0AD9,0x0A98,0xBCCB,0xF5C8,0xF5A9,
-	0xC341,0xC341,0xC301,0xBAE1,0xBAA1,0xBA62,0xBA42,0xBA42,
-	0xBA41,0xB241,0xBA41,0xBA42,0xBA41,0xBA41,0xBA41,0xBA41,
-	0xBA61,0xBA61,0xBA41,0xBA41,0xBA42,0xBA42,0xBA22,0xBA22,
-	0xBA22,0xBA22,0xBA22,0x0000,0x0000,0x0000,0x0000,0x89C2,
-	0xBA83,0xBA83,0xC283,0xC283,0xBAA3,0xBAA3,0xBAA3,0xC283,
-	0xBA82,0xBA82,0xBAA2,0xB282,0xB282,0xB282,0xB262,0xAA41,
-	0xAA21,0xAA22,0xAA02,0xA9E2,0xA9E2,0xA1E1,0xA1E1,0xA1E1,
-	0xA9E2,0xAA02,0xB222,0xB243,0xB243,0xBA63,0xC283,0xC2C4,
-	0xCAC4,0xCB04,0xCB04,0xD324,0xD345,0xD344,0xDB65,0xDB84,
-	0xDB84,0xDB84,0xDBA4,0xDB84,0xD3A3,0xD3A4,0xD3A4,0xD3A3,
-	0xD3C3,0xD3C2,0xD3C3,0xCBA3,0xCBA3,0xD383,0xD383,0xD383,
-	0xDB83,0xDB84,0xE3C3,0xE3E3,0xE423,0xEC43,0xEC82,0xE482,
-	0xE442,0xE402,0xDBC3,0xDBA3,0xDBA3,0xD384,0xD384,0xDBA4,
-	0xDBA4,0xDBC5,0xE3E5,0xE3E5,0xE3E5,0xE405,0xE405,0xEC25,
-	0xE425,0xE404,0xE3E5,0xE3E4,0xE404,0xE404,0xE424,0xE424,
-	0xE425,0xE425,0xEC45,0xEC45,0xC429,0x2399,0x133A,0x133A,
-	0x135A,0x1B7A,0x1BBA,0x1BBA,0x1BBA,0x7BEF,0xE405,0xD3E6,
-	0x4C15,0x1C3A,0x1C3A,0x13F9,0x13B9,0x3BB5,0xC46A,0xF4E8,
-	0xFD67,0xF5A6,0xF5E5,0xED85,0xECC5,0xEC65,0xEC65,0xEC65,
-	0xEC65,0xEC86,0xECA6,0xF4E7,0xFD08,0xF569,0xF5CA,0xF60B,
-	0xF60D,0xF630,0xF653,0xFE95,0xFED6,0xF6F7,0xFF19,0xFF5A,
-	0xFF19,0xFEB6,0xF60F,0xF589,0xF567,0xED47,0xF589,0xF5AC,
-	0xF5AB,0xF5A9,0xFDC9,0xFE09,0xFE29,0xF5E8,0xF586,0xF546,
-	0xF587,0xF587,0xF587,0x1299,0x12BA,0x0A99,0x0A97,0x0256,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5A7,0xF5A6,0xF586,0xF567,
-	0xF547,0xF569,0xF5AB,0xF5EE,0xF631,0xF652,0xF652,0xFE92,
-	0xFEB2,0xFEB2,0xFE73,0xFE95,0xFE95,0xFE32,0xF5EF,0xF5CE,
-	0xF5AC,0xF58B,0xED89,0xEDC8,0xF627,0xF607,0xFDC7,0xFD48,
-	0xF508,0xF4E7,0xF4C6,0xEC85,0xEC85,0xEC85,0xECA5,0xECA5,
-	0x53B3,0x0B19,0x0AF9,0x0AB9,0x0A79,0x7BEF,0xF5C8,0xF58A,
-	0xC341,0xC361,0xC341,0xC341,0xC302,0xBAC2,0xBA81,0xBA61,
-	0xB241,0xBA41,0xBA42,0xBA42,0xBA41,0xBA41,0xBA41,0xBA41,
-	0xBA61,0xBA61,0xBA61,0xBA41,0xBA42,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA22,0xBA22,0xBA22,0xBA42,0xBA43,0xBA62,0xBA83,
-	0xBA63,0xC263,0xC283,0xC283,0xBAA3,0xBAA3,0xBAA3,0xBA82,
-	0xBA82,0xBA82,0xBAA2,0xB282,0xB282,0xB282,0xB262,0xAA61,
-	0xAA22,0xAA02,0xAA02,0xAA02,0xA9E1,0xA202,0xA1E1,0xA9E1,
-	0xA9E2,0xAA02,0xB222,0xB243,0xBA43,0xBA63,0xC283,0xC2A3,
-	0xCAC4,0xCAE4,0xCB04,0xD324,0xD344,0xD344,0xDB65,0xDB85,
-	0xDB84,0xDB84,0xDB84,0xDBA4,0xDBA4,0xD3A3,0xD3A3,0xD3C3,
-	0xD3C3,0xD3C3,0xD3C3,0xD3A3,0xCBA3,0xCB83,0xD383,0xD383,
-	0xDB83,0xDB84,0xDBA3,0xE3E3,0xE403,0xEC43,0xEC82,0xEC82,
-	0xE462,0xE422,0xDBC3,0xDBC3,0xDBA3,0xD3A3,0xD3A4,0xD3A4,
-	0xDBA4,0xDBC5,0xE3E5,0xE406,0xE3E6,0xE406,0xE405,0xEC25,
-	0xE425,0xE405,0xE405,0xE404,0xE404,0xE424,0xE424,0xE425,
-	0xE425,0xE445,0xEC45,0xEC45,0xEC65,0xC449,0x3B96,0x1B3A,
-	0x135A,0x1B7A,0x1BBA,0x1BBA,0x8410,0xE425,0xE404,0xE3E4,
-	0xE3E4,0xB3EA,0x7C0F,0x7BEF,0xC42A,0xF467,0xF4A7,0xF508,
-	0xFD67,0xF5A6,0xF5E5,0xED85,0xECC5,0xEC65,0xEC65,0xEC65,
-	0xEC65,0xEC65,0xECA6,0xF4E7,0xFD08,0xF569,0xF5C9,0x7BEF,
-	0x8410,0xACAF,0xBD31,0xDDD3,0xFEB6,0xF6F7,0xFF19,0xFF5A,
-	0xFF39,0xFED6,0xF631,0xF5AB,0xF567,0xF547,0xF589,0xF5AC,
-	0xF5AB,0xF589,0xFDC9,0xFE09,0xFE29,0xF5E8,0xF586,0xF546,
-	0xF587,0xF587,0xF587,0x1299,0x12BA,0x0A99,0x0A97,0x0256,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5A7,0xF587,0xF586,0xF567,
-	0xF547,0xF568,0xF58B,0xF5EE,0xF631,0xF652,0xF652,0xFE92,
-	0xFEB2,0xFEB2,0xFE93,0xFEB5,0xFE95,0xFE32,0xF5CF,0xF5CE,
-	0xF5AC,0xF5AB,0xF58A,0xEDC8,0xF627,0xF607,0xFDA7,0xFD48,
-	0xFD28,0xF4E7,0xF4A6,0xECA5,0xEC85,0xEC85,0xECA5,0xECA5,
+	0x942E,0xF5A6,0xF5C5,0xED45,0xECA5,0xC013,0x94AD,0xA49B,
+	0xADB5,0xF5B6,0xBCBE,0xB6A6,0xAFAE,0xF5A5,0xADB5,0x9B8A,
+	0x0001,0xF610,0xF58A,0xC025,0x91A3,0xA5AE,0xB7A3,0x9AB4,
+	0xF4AC,0x5B8A,0x94A5,0xAC9B,0x5CA3,0xEDA6,0xEDAC,0xA463,
+	0xA4A3,0x9B9C,0x9CA5,0xB6AF,0xB7B6,0xA5AC,0xF414,0x0001,
+	0x6BAF,0x018C,0xC007,0x9AA4,0xBFFF,0xAEAD,0xEDA6,0x0002,
+	0x73D1,0xE5A7,0xF606,0xC005,0xD585,0x9C53,0x935C,0x8002,
+	0xEC85,0x0008,0x3BB6,0x133A,0x1319,0x1319,0x63B2,0xED66,
+	0xF5A7,0xF5C8,0xF5A9,0x8004,0xB221,0xC003,0xAC9C,0xA5AB,
+	0x8002,0xBA41,0x0000,0xBA42,0x8002,0xBA41,0xC006,0xA59C,
+	0xA4A3,0xA45D,0xA400,0x8003,0xBA22,0x8003,0x0000,0x0001,
+	0x89C2,0xBA83,0xC005,0xE3A5,0x5BED,0x64A4,0x8002,0xBA82,
+	0xC01C,0x64A4,0x9CA4,0x9B5C,0x9DA4,0x9CA4,0x63E4,0x65E4,
+	0xACA4,0xF5AC,0xE4EC,0xACED,0xACAC,0xE4AC,0xACAC,0xA400,
+	0x8004,0xDB84,0x8003,0xD3A3,0xC014,0xA3AC,0x5DDC,0xA45C,
+	0xE4EC,0xA4AD,0xEBB4,0xB4AB,0xE45C,0x8C5C,0x9DA4,0x5C00,
+	0x8002,0xD384,0x0001,0xDBA4,0xDBC5,0x8002,0xE3C5,0xC003,
+	0xACAC,0xAC9C,0x8002,0xE3E4,0xC003,0xACAC,0xA4A5,0x8002,
+	0xE445,0x0009,0x23B8,0x1B9A,0x137A,0x135A,0x8C0E,0xEC85,
+	0xE465,0xE425,0xC429,0x2BD9,0xC004,0x2DA4,0xACEC,0xE300,
+	0x000A,0x4C14,0x33F6,0x0BB8,0x0B78,0x0358,0x02F7,0xDD09,
+	0xF5C6,0xF5C6,0xED45,0xECA5,0x8003,0xEC65,0xC004,0xADB5,
+	0xF5B6,0xF400,0x0000,0xF60C,0xC009,0xADA7,0xB6AE,0xAEED,
+	0xADB5,0x9C51,0x0001,0xF632,0xF5AB,0xC00F,0x49E2,0x65EE,
+	0xB79B,0xA2F4,0xB4AC,0x5B8A,0x8CAD,0x6C9C,0x0000,0x12B9,
+	0xC004,0xA55B,0xA25B,0xE400,0x0000,0xFDA9,0xC010,0x63A4,
+	0xAB93,0xA55B,0xDDAE,0xB7BF,0xAEA5,0xB4EC,0xACA4,0x0400,
+	0x0009,0x9CB1,0x634E,0x42EE,0x4310,0x4331,0x6390,0x8C2F,
+	0xD50B,0xED87,0xF606,0xC008,0xA4CD,0x8C9D,0x539B,0x54A4,
+	0xA300,0x0001,0xCC68,0x137A,0xC003,0x949B,0x64D4,0x0004,
+	0x7BEF,0xF5A7,0xF5C8,0xF5A9,0xB281,0xC008,0x9C9C,0x9CAC,
+	0x9CE4,0x65AC,0xA300,0x8005,0xBA41,0x0001,0xBA42,0xBA41,
+	0x8003,0xBA22,0xC004,0x64A4,0xE45C,0xEC00,0x8003,0x0000,
+	0x0001,0x89C2,0xBA83,0xC020,0xE4A4,0x64E4,0x6C9C,0xA4A3,
+	0xAC64,0x9C9C,0xA49B,0x9C64,0x9DA4,0x9C63,0xE564,0xE4A4,
+	0xACED,0xACEC,0xECAD,0xACEC,0xA400,0x8002,0xD324,0x0001,
+	0xD344,0xD364,0x8004,0xDB84,0x8002,0xD3A3,0xC028,0xACA4,
+	0xA35C,0x9CA5,0xE4A4,0xE4A4,0xADEB,0xB4AC,0xF4AB,0x9C54,
+	0x549D,0x9C5C,0xA4A5,0xA4ED,0xACE4,0xADA3,0xE46C,0xAC9C,
+	0x9BA5,0xA3AC,0xACA4,0xA500,0x8002,0xE445,0x000C,0x63F2,
+	0x1B9A,0x137A,0x135A,0x135A,0x2379,0x4BD5,0x3BD6,0x1BBA,
+	0x1BDA,0x1BFA,0x43F6,0x1C1A,0xC006,0xACA4,0x9B5C,0x9354,
+	0x9B00,0x0005,0x4373,0xF567,0xF5A6,0xF5C5,0xED65,0xECC5,
+	0x8003,0xEC65,0xC00F,0xADB4,0xF6AD,0xBDBC,0xB6AF,0x9FB6,
+	0xB5EE,0xADB5,0xA492,0x0001,0xF653,0xF5CC,0xC00F,0x889B,
+	0x64EE,0xB7A3,0x9AF4,0xACB4,0x53D2,0x54A5,0xAC9B,0x0000,
+	0x1299,0xC004,0xAC5C,0xA25B,0x9C00,0x0000,0xFDA9,0xC008,
+	0x63A4,0xA39B,0xA49C,0x9DAE,0xAF00,0x0000,0xF60E,0xC019,
+	0xAFED,0x64F4,0xACA4,0x95AE,0xA489,0x499A,0xA35B,0x9AF2,
+	0xBBA4,0x8DCC,0x9D53,0x9B54,0xA3A4,0x0001,0x7BEF,0x135A,
+	0xC003,0x9C9B,0x5C9C,0x0004,0x1AB8,0xE568,0xF5A8,0xF5A9,
+	0xBAE1,0xC004,0x9D9C,0x549B,0xA400,0x8002,0xBA42,0x0000,
+	0xB241,0x8005,0xBA41,0xC004,0xAD9B,0xA4A5,0xA400,0x8005,
+	0xBA22,0x8003,0x0000,0x0000,0x89C2,0x8007,0xBA83,0xC019,
+	0xA3AC,0xA45C,0xA49C,0xA35C,0x9C9D,0x9CA4,0x63A5,0xE3A5,
+	0xA4AC,0xEDAC,0xECAC,0xECAD,0xECAC,0x8002,0xD324,0x0001,
+	0xD344,0xD364,0x8004,0xDB84,0x8002,0xD3A3,0xC025,0xACA3,
+	0xA464,0x9D9C,0xE4A4,0xE4A4,0xA5B3,0xECB4,0xEBB4,0x9C54,
+	0x945D,0x9C9C,0x65A4,0xECA4,0xADED,0xA4A3,0xACA4,0xACA4,
+	0x9C9C,0xA3AC,0x8002,0xE424,0x0004,0xE445,0xE425,0xEC45,
+	0xCC28,0x23B8,0xC008,0x1694,0xA4B4,0xECAC,0xA4AC,0xEB00,
+	0x0002,0xD406,0x4416,0x243A,0xC004,0x649C,0x5B53,0x9C00,
+	0x0006,0x1B77,0xD4AA,0xF567,0xF5A6,0xF5C5,0xED65,0xECC5,
+	0x8002,0xEC65,0xC005,0x64E4,0xB5FE,0xADB4,0x0000,0xF5EA,
+	0xC00A,0xB6A6,0xA7AF,0xB5F5,0x6EF5,0xA59A,0x4000,0x0001,
+	0xF5EE,0xED68,0xC00E,0xDA65,0xEEB7,0xA39A,0xACFC,0xAC5B,
+	0xCA54,0xA5AC,0xA400,0x0000,0x1299,0xC004,0xAD5B,0xA25B,
+	0x9C00,0x0000,0xF5A8,0xC020,0xA4A3,0xA4A3,0x9C5C,0xDD6E,
+	0xF6B7,0xB7AC,0xADEC,0xACA4,0x95AE,0xA489,0x499B,0xA25B,
+	0xA2F2,0xB3A4,0xCD8C,0x955B,0x9B00,0x8002,0xEC85,0x0002,
+	0xCC68,0x4BB5,0x1339,0xC003,0x5C9C,0x9C93,0x0003,0xBCCB,
+	0xF5C8,0xF5A9,0xC341,0xC00A,0xA494,0x5C94,0x959C,0xA4A3,
+	0x64E4,0xA500,0x8003,0xBA41,0xC005,0xACA4,0x9CA4,0xA5A4,
+	0x8004,0xBA22,0x8003,0x0000,0x0004,0x89C2,0xBA83,0xBA83,
+	0xC283,0xC283,0x8002,0xBAA3,0xC003,0xDC63,0xA4AC,0x8002,
+	0xB282,0xC006,0x9C5B,0x9CA5,0x9C9C,0xA400,0x8002,0xA1E1,
+	0xC00E,0xE5AC,0xECAD,0xA4EC,0xECB5,0xE4B4,0xA4EC,0xADA3,
+	0xED00,0x8002,0xDB84,0xC00A,0xAC9C,0x6BA5,0xA4A3,0xACA3,
+	0xA55C,0xA400,0x8002,0xD383,0xC011,0xE4A5,0xF3AC,0xB4EC,
+	0xB364,0x9494,0x559C,0xA45D,0xA4EC,0xA4AD,0x8002,0xE3E5,
+	0xC00E,0xACA4,0xEC64,0x9B9D,0xA3AC,0xA4AC,0xA4A5,0xA4EC,
+	0xA400,0x0001,0xC429,0x2399,0xC003,0x0DA4,0xACEC,0x8002,
+	0x1BBA,0x000F,0x7BEF,0xE405,0xD3E6,0x4C15,0x1C3A,0x1C3A,
+	0x13F9,0x13B9,0x3BB5,0xC46A,0xF4E8,0xFD67,0xF5A6,0xF5E5,
+	0xED85,0xECC5,0x8003,0xEC65,0xC010,0xADAC,0xF5ED,0x7DBD,
+	0xB5A6,0xAFAF,0xF6B5,0x6DEE,0xB593,0x8900,0x0001,0xF60F,
+	0xF589,0xC00B,0x9A5C,0xF6AF,0xA3A2,0xECB4,0xAC53,0x8A94,
+	0x8002,0xF587,0x0000,0x1299,0xC004,0xAD5B,0xA253,0xA400,
+	0x0000,0xF5A8,0xC020,0xA4A3,0xA4A3,0x9C9D,0x9CAE,0xB6B7,
+	0xB7AD,0xA4F4,0xACA4,0x95AE,0xA489,0x519B,0x9A9B,0x62B3,
+	0xFB9C,0xD485,0x549B,0x9B00,0x8002,0xEC85,0x000A,0xECA5,
+	0xECA5,0x53B3,0x0B19,0x0AF9,0x0AB9,0x0A79,0x7BEF,0xF5C8,
+	0xF58A,0xC341,0xC00A,0xAC9C,0xA495,0x5493,0x9C5C,0xE4A5,
+	0xA400,0x8003,0xBA41,0x8002,0xBA61,0x0000,0xBA41,0x8004,
+	0xBA42,0x8002,0xBA22,0xC007,0xACA5,0xABAD,0x9CE4,0xACA4,
+	0x8002,0xBAA3,0x8002,0xBA82,0x0000,0xBAA2,0x8002,0xB282,
+	0x0002,0xB262,0xAA61,0xAA22,0x8002,0xAA02,0xC013,0x9B6D,
+	0x9BE4,0xA5AC,0xECAD,0xE4AC,0xECAC,0xEDAC,0xACEC,0xACA4,
+	0xEDAC,0x8002,0xDB84,0xC003,0xACA4,0x63A4,0x8003,0xD3C3,
+	0xC029,0x9C64,0x9CE4,0xA4E4,0xA5AB,0xF4AC,0xF4B3,0xA45C,
+	0x944D,0xA49C,0x64A5,0xA4E4,0xADEC,0xAD9C,0xACA3,0xEC64,
+	0x9CA4,0xA3A4,0xACA4,0xA5A4,0xACE4,0xA4AC,0x0002,0xC449,
+	0x3B96,0x1B3A,0xC003,0x6CEC,0xB4A4,0x0009,0x8410,0xE425,
+	0xE404,0xE3E4,0xE3E4,0xB3EA,0x7C0F,0x7BEF,0xC42A,0xF467,
+	0xC005,0xB4BD,0xFB73,0xB34C,0x0000,0xECC5,0x8004,0xEC65,
+	0xC004,0xB5F5,0xED7D,0xBC00,0x0005,0x7BEF,0x8410,0xACAF,
+	0xBD31,0xDDD3,0xFEB6,0xC004,0x75EE,0xB59B,0x8900,0x0001,
+	0xF631,0xF5AB,0xC00B,0x909C,0xB6AF,0xA39A,0xF4B4,0xAC53,
+	0x8A94,0x8002,0xF587,0x0000,0x1299,0xC004,0xAD5B,0xA253,
+	0xA400,0x0000,0xF5A8,0xC025,0xA4A3,0xA49C,0xA39D,0x9CAD,
+	0xAFBF,0xB7AD,0xA4F4,0xACA4,0x9DAE,0x9C89,0x49A3,0x9AA3,
+	0x9B72,0xFB9C,0xCC8D,0x9C53,0x9363,0x9CA4,0xACA4,0x0008,
 	0xB46B,0x0B19,0x0AF9,0x0AB9,0x0A59,0x7BEF,0xF5C8,0xF58A,
-	0xBAE1,0xC342,0xC362,0xCB81,0xC362,0xC321,0xBAE1,0xBAA1,
-	0xBA81,0xBA41,0xBA41,0xBA41,0xBA41,0xBA61,0xBA62,0xBA62,
-	0xBA61,0xBA61,0xBA61,0xBA61,0xBA62,0xBA42,0xBA42,0xBA42,
-	0xBA42,0xBA42,0xBA42,0xBA42,0xBA22,0xBA42,0xBA62,0xBA62,
-	0xBA62,0xBA83,0xC283,0xC2A3,0xBAA3,0xBAA3,0xBAA3,0xBA82,
-	0xBAA2,0xBAA2,0xBAA3,0xBAA2,0xBAA2,0xB282,0xB281,0xB261,
-	0xB241,0xAA21,0xAA22,0xA202,0xA201,0xA202,0xA1E1,0xA1E1,
-	0xA9E2,0xAA02,0xB222,0xB223,0xBA43,0xBA63,0xBA83,0xC2A3,
-	0xCAC4,0xCAE4,0xCB04,0xD324,0xD344,0xD344,0xDB65,0xDB85,
-	0xDB84,0xDB84,0xDBA4,0xDBA4,0xDBA4,0xD3A3,0xD3A3,0xD3C3,
-	0xD3C3,0xD3E3,0xD3C3,0xD3C3,0xD3A3,0xCBA3,0xD383,0xD383,
-	0xDB83,0xDB84,0xDBA3,0xE3C4,0xE404,0xE423,0xEC62,0xECA2,
-	0xEC82,0xE442,0xE3E3,0xDBC3,0xDBC3,0xDBA3,0xD3A4,0xD3A4,
-	0xDBA4,0xDBC4,0xE3E5,0xE406,0xE406,0xE406,0xEC05,0xEC26,
-	0xE425,0xE425,0xE405,0xE404,0xE404,0xE424,0xE424,0xE425,
-	0xE425,0xE445,0xEC45,0xEC45,0xEC65,0xEC85,0xE4A5,0xC489,
-	0x7BEF,0x7BEF,0x9C0D,0xCC28,0xE445,0xE425,0xE405,0xE405,
-	0xE3E4,0xE3C5,0xE3C5,0xEC06,0xEC46,0xF487,0xF4A7,0xF4E8,
-	0xFD47,0xF5A6,0xF5E5,0xF585,0xECC5,0xEC65,0xEC65,0xE465,
-	0xEC65,0xEC65,0xECA6,0xF4E7,0xFD08,0xFD49,0xF5C9,0x09F5,
-	0x09F3,0x09F1,0x09CD,0x09AC,0x094A,0x322B,0x632D,0x9CD2,
-	0xDE77,0xFEF7,0xF652,0xF5CB,0xF567,0xF547,0xF589,0xF5AC,
-	0xF5AB,0xF5A9,0xF5C9,0xFE09,0xFE29,0xF5E8,0xF5A6,0xF546,
-	0xF587,0xF587,0xF587,0x1299,0x12BA,0x0A99,0x0A97,0x0276,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5A7,0xF586,0xF586,0xF566,
-	0xF546,0xF568,0xF5AB,0xF5EE,0xF631,0xF652,0xF672,0xFE92,
-	0xFEB2,0xFEB2,0xFE93,0xFE95,0xFE94,0xF632,0xF5F0,0xF5CE,
-	0xF5CC,0xF5AC,0xF5AA,0xF5E8,0xF627,0xF607,0xFDA7,0xFD48,
-	0xFD28,0xF507,0xF4A7,0xECA5,0xEC85,0xEC85,0xECA5,0xECA5,
-	0xD488,0x0B19,0x0AF9,0x0AB9,0x0A79,0x7BEF,0xF5A8,0xF5AA,
-	0xB281,0xBAE1,0xC321,0xCB62,0xCBA2,0xCB82,0xC341,0xC321,
-	0xBAC1,0xBA82,0xBA62,0xBA62,0xBA62,0xBA42,0xBA41,0xBA62,
-	0xBA62,0xBA81,0xBA82,0xBA62,0xBA61,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA42,0xBA42,0xBA22,0xBA22,0xBA42,0xBA42,0xBA63,
-	0xBA62,0xC283,0xC283,0xC283,0xBAA3,0xBAA3,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA3,0xBAA3,0xBAA2,0xB2A2,0xB2A2,0xB282,0xB262,
-	0xAA41,0xAA21,0xAA22,0xA202,0xA202,0xA201,0xA201,0xA9E1,
-	0xA9E2,0xA9E2,0xAA22,0xB222,0xB243,0xBA63,0xBA83,0xC2A3,
-	0xC2C4,0xCAE4,0xCB04,0xD324,0xD324,0xD345,0xDB65,0xDB84,
-	0xDB85,0xDB84,0xDBA4,0xDBA4,0xDBA4,0xDBA3,0xD3A4,0xD3C3,
-	0xD3E3,0xD3E3,0xD3E3,0xD3C3,0xD3C3,0xCBA3,0xD383,0xD383,
-	0xD383,0xDBA4,0xDBA4,0xDBC4,0xE3E4,0xE423,0xEC62,0xECA2,
-	0xEC82,0xE442,0xE403,0xDBE3,0xDBC3,0xD3C3,0xD3A4,0xD3C4,
-	0xDBC4,0xDBC4,0xE3E5,0xE406,0xEC06,0xEC06,0xEC06,0xEC26,
-	0xE445,0xE425,0xE405,0xE405,0xE404,0xE424,0xE425,0xE445,
-	0xE445,0xE425,0xEC45,0xEC46,0xEC65,0xEC85,0xECC5,0xECC5,
-	0xECC5,0xE485,0xE445,0xE445,0xE425,0xE425,0xE425,0xE405,
-	0xE3E4,0xE3C5,0xE3C5,0xEC06,0xEC46,0xF487,0xF4A7,0xF4E8,
-	0xFD47,0xF5A7,0xF5E6,0xF585,0xECE5,0xEC86,0xEC65,0xEC65,
-	0xE465,0xEC65,0xECA6,0xF4E7,0xF508,0xF549,0xF5A9,0x0A15,
-	0x0A14,0x09F1,0x09CF,0x09AC,0x016A,0x0128,0x00E7,0x00C5,
-	0x00A5,0x21A9,0x636E,0xACAE,0xED67,0xF567,0xF569,0xF5AC,
-	0xF5AB,0xF5A9,0xFDC9,0xFE09,0xFE29,0xFDE8,0xF586,0xF566,
-	0xF567,0xF588,0xF587,0x1299,0x12B9,0x0A99,0x0A77,0x0276,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5A7,0xF586,0xF586,0xF566,
-	0xF547,0xF568,0xEDAA,0xF5ED,0xF630,0xF652,0xF672,0x7BEF,
-	0x7BEF,0x8410,0x7BEF,0x7BEF,0x7BEF,0x7BEF,0x7C0F,0x7BEF,
-	0x7BEF,0x7BF0,0x7BEF,0x7C0F,0x7BEF,0x7BEF,0x7C0F,0x7BEF,
-	0x7BEF,0x7BEF,0x7C0F,0x7BEF,0x7BEF,0x7BEF,0x8410,0x9C2D,
-	0xECC5,0x0B19,0x0AD9,0x0AB9,0x0A79,0x7BEF,0xF5A8,0xFD8A,
-	0xAA21,0xB261,0xBAC1,0xC321,0xC362,0xCB82,0xCB82,0xCB62,
-	0xC322,0xC2E2,0xBAA2,0xBA82,0xBA61,0xBA62,0xBA62,0xBA62,
-	0xBA61,0xBA61,0xBA81,0xBA82,0xBA81,0xBA61,0xBA61,0xBA62,
-	0xBA62,0xBA42,0xBA42,0xBA42,0xBA42,0xBA42,0xBA43,0xC263,
-	0xBA63,0xBA83,0xC283,0xC283,0xC283,0xBAA3,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA3,0xBAA3,0xBAC2,0xBAC2,0xB2A2,0xB282,0xB282,
-	0xAA41,0xAA41,0xAA21,0xA201,0xAA02,0xAA02,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xAA02,0xB222,0xB243,0xBA63,0xBA83,0xC2A3,
-	0xC2C4,0xCAE4,0xCB04,0xCB04,0xD324,0xD345,0xDB65,0xDB85,
-	0xDB85,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xD3C4,
-	0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3C3,0xCBC3,0xCBA3,0xD383,
-	0xD3A3,0xDBA4,0xDBA4,0xE3C4,0xE3E4,0xEC03,0xEC62,0xEC82,
-	0xEC82,0xE462,0xE422,0xDBE3,0xDBC3,0xDBC3,0xD3C4,0xD3C4,
-	0xDBC4,0xDBC4,0xE3E5,0xE405,0xEC06,0xEC06,0xE406,0xEC26,
-	0xE445,0xE425,0xE425,0xE405,0xE405,0xE424,0xE445,0xE444,
-	0xE445,0xE445,0xE465,0xEC65,0xEC65,0xECA6,0xECA5,0xE4E5,
-	0xE4C4,0xECA5,0xEC45,0xE445,0xE445,0xE425,0xE425,0xE405,
-	0xE3E4,0xE3C5,0xE3C5,0xE406,0xEC46,0xF467,0xFCA8,0xF4E8,
-	0xF547,0xF5A7,0xF5E6,0xF5A5,0xECE5,0xEC86,0xEC65,0xEC65,
-	0xEC65,0xEC65,0xECA6,0xF4E7,0xF508,0xF548,0xF5A8,0x0A16,
-	0x0A14,0x0A12,0x09EF,0x09AC,0x016A,0x0149,0x0107,0x00A5,
-	0x00A5,0x00E6,0x016A,0x0A11,0x1AB6,0x73D1,0xC4EC,0xF5CD,
-	0xF5AC,0xF5A9,0xF5C9,0xFE09,0xFE29,0xF5E8,0xF586,0xF566,
-	0xF587,0xF588,0xF587,0x1299,0x129A,0x0A99,0x0A77,0x0276,
-	0x0256,0xFDA9,0xF5A8,0xF5C7,0xF5C7,0xF587,0xF586,0xF587,
-	0xF547,0xF568,0xF5AA,0xF5ED,0xF610,0xF652,0xF672,0x014C,
-	0x014C,0x014D,0x016C,0x016A,0x016B,0x09CE,0x0A10,0x0A10,
-	0x0A32,0x0A33,0x1235,0x0A17,0x09D8,0x01D8,0x0238,0x0297,
-	0x02D7,0x0B18,0x0B39,0x135A,0x135A,0x137A,0x135A,0x4B95,
-	0xECE6,0x0AF9,0x0AD9,0x0A99,0x0A59,0x7BEF,0xF5A9,0xFD8B,
-	0xA9E1,0xAA21,0xB261,0xBAC1,0xC302,0xC342,0xCB82,0xCBA2,
-	0xCB82,0xCB42,0xC302,0xBAC1,0xBA81,0xBA61,0xBA62,0xBA62,
-	0xBA61,0xBA61,0xBA61,0xBA82,0xBA82,0xBA81,0xBA62,0xBA62,
-	0xBA62,0xBA62,0xBA42,0x2880,0x2880,0x2880,0x2880,0x2880,
-	0x2880,0x2880,0x2880,0x30A0,0x30A0,0x28A0,0x28A0,0x28A0,
-	0x30A0,0x28A0,0x5121,0xBAA2,0x9222,0x28A0,0x28A0,0x2880,
-	0x7181,0xAA41,0xAA41,0xAA21,0xAA02,0xA9E2,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xAA02,0xB222,0xB243,0xBA63,0xBA83,0xC283,
-	0xC2C4,0xCAE4,0xCB04,0xCB04,0xD324,0xD345,0xD365,0xDB85,
-	0xDB85,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBA4,0xDBC4,0xD3C4,
-	0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3C3,0xD3A3,0xD383,
-	0xD383,0xDBA4,0xDBA4,0xE3C4,0xE3E4,0xE403,0xEC43,0xEC82,
-	0xECA2,0xEC62,0xE423,0xE3E3,0xDBC3,0xDBC3,0xDBC4,0xD3C4,
-	0xDBC4,0xDBC4,0xE3E5,0xE405,0xEC06,0xEC06,0xE406,0xE426,
-	0xE445,0xE445,0xE425,0xE425,0xE425,0xE424,0xE445,0xE465,
-	0xE444,0xEC45,0xEC65,0xEC65,0xEC65,0xEC85,0xECA5,0xECE5,
-	0xECC5,0xECA5,0xE465,0xEC45,0xEC45,0xE425,0xE425,0xE404,
-	0xDBE4,0xE3C4,0xE3C5,0xE406,0xEC46,0xF467,0xF4A8,0xFCE8,
-	0xF547,0xFDA7,0xF5E6,0xF5A5,0xECE5,0xEC86,0xEC65,0xEC65,
-	0xE465,0xE465,0xECA6,0xF4E7,0xF508,0xF548,0xF5A8,0x0A16,
-	0x0A15,0x0A13,0x0A10,0x09CD,0x018B,0x0149,0x0107,0x00C6,
-	0x00A5,0x00C6,0x0149,0x09F0,0x0A76,0x0A98,0x0A76,0x32D1,
-	0xA46E,0xF5A9,0xF5C9,0xFE09,0xFE29,0xF5E8,0xF586,0xF566,
-	0xF587,0xF588,0xF587,0x1299,0x129A,0x0A99,0x0A77,0x0276,
-	0x0256,0xF5A8,0xF5A8,0xF5C7,0xF5A7,0xF587,0xF586,0xF566,
-	0xF547,0xF568,0xEDA9,0xF5ED,0xF610,0xF652,0xF672,0x014C,
-	0x014C,0x014D,0x016C,0x014A,0x016B,0x09CE,0x0A10,0x0A30,
-	0x0A32,0x0A33,0x1255,0x0A16,0x09D8,0x01D8,0x0237,0x0297,
-	0x02D7,0x0B18,0x0B39,0x135A,0x135A,0x137A,0x135A,0x4B94,
-	0xECC6,0x12F9,0x0AD9,0x0A99,0x0A59,0x7BEF,0xF5A9,0xFD8B,
-	0xA9C1,0xA9E1,0xAA01,0xB242,0xBAA2,0xBAE2,0xC342,0xCB81,
-	0xCBA1,0xCBA2,0xC362,0xC322,0xC2E2,0xC2A2,0xBA62,0xBA62,
-	0xBA61,0xBA61,0xBA61,0xBA82,0xC282,0xBA82,0xBA81,0xBA62,
-	0xBA62,0xBA62,0xBA62,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x28A0,0xBAA2,0x8A01,0x0000,0x0000,0x0000,
-	0x5941,0xAA41,0xAA41,0xAA21,0xAA22,0xAA02,0xA9E2,0xA9E2,
-	0xA9E2,0xA9E2,0xAA02,0xAA22,0xB243,0xB243,0xBA63,0xBA83,
-	0xC2A4,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,0xD365,0xDB85,
-	0xDBA5,0xDBA4,0xDBA4,0xDBA4,0xDBC4,0xDBA4,0xDBC4,0xDBC4,
-	0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3C3,0xD3C3,0xD3A3,
-	0xD3A4,0xDBA4,0xDBA4,0xE3A4,0xE3C4,0xEC03,0xEC43,0xEC82,
-	0xECA2,0xECA2,0xE443,0xE403,0xDBE3,0xDBC3,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xE405,0xEC26,0xEC26,0xEC06,0xEC26,
-	0xEC45,0xE445,0xE425,0xE425,0xE425,0xE425,0xE445,0xE465,
-	0xE465,0xEC65,0xEC65,0xEC65,0xEC65,0xEC85,0xECC5,0xECC5,
-	0xECE5,0xECA5,0xE465,0xE445,0xEC45,0xE445,0xE425,0xE405,
-	0xE3E4,0xE3C5,0xE3C5,0xE405,0xEC46,0xF467,0xF4A7,0xFCE8,
-	0xF548,0xF5A7,0xF5E6,0xF5A5,0xECE5,0xEC85,0xEC65,0xEC65,
-	0xEC65,0xE465,0xECA6,0xF4E7,0xFD08,0xF548,0xF588,0x0A37,
-	0x0A16,0x0A33,0x0A11,0x09CE,0x098C,0x014A,0x0108,0x00C6,
-	0x00A4,0x00A5,0x0128,0x09AF,0x0A76,0x0A97,0x0A76,0x0A32,
-	0x0A33,0x2AB4,0x9C6E,0xFE09,0xFE29,0xFDE8,0xF586,0xF566,
-	0xF587,0xF588,0xF587,0x1299,0x1299,0x1299,0x0A77,0x0256,
-	0x0256,0xFDA9,0xF5A8,0xF5A7,0xF5A7,0xF587,0xF586,0xF566,
-	0xF567,0xF568,0xED89,0xF5CD,0xF610,0xF651,0xF672,0x016C,
-	0x012D,0x014D,0x016C,0x014A,0x016B,0x09CE,0x0A0F,0x0A10,
-	0x0A12,0x0A33,0x1235,0x0A16,0x09D8,0x01D8,0x0237,0x0297,
-	0x02D7,0x0AF8,0x0B39,0x135A,0x137A,0x137A,0x135A,0x43B5,
-	0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A39,0x7BF0,0xF5A9,0xF58A,
-	0xA9C1,0xA9E1,0xAA01,0xB221,0xB242,0xBA82,0xC2E2,0xC321,
-	0xCB82,0xCBA2,0xCBA2,0xCB82,0xC342,0xC2E2,0xBAA2,0xBA62,
-	0xBA62,0xBA62,0xBA61,0xBA81,0xBA81,0xC281,0xBA81,0xBA82,
-	0xBA82,0xBA62,0xBA62,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x28A0,0xBAA2,0x8A01,0x0000,0x0000,0x0000,
-	0x5941,0xAA62,0xAA42,0xAA22,0xAA22,0xAA02,0xAA02,0xA202,
-	0xA9E2,0xA9E2,0xAA02,0xAA22,0xB243,0xB243,0xBA63,0xBA83,
-	0xC2A3,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,0xDB65,0xDB85,
-	0xDBA5,0xDBA5,0xDBA4,0xDBA4,0xDBC4,0xDBA4,0xDBC4,0xDBC4,
-	0xDBE4,0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3E3,0xD3C3,0xD3A3,
-	0xD3A4,0xDBA4,0xDBA4,0xE3C4,0xE3C4,0xE404,0xEC43,0xEC82,
-	0xECA2,0xECA2,0xE462,0xE423,0xDBE3,0xDBC3,0xDBC4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xE405,0xEC06,0xEC26,0xEC26,0xEC25,
-	0xEC46,0xEC45,0xE445,0xE425,0xE425,0xE425,0xE445,0xE465,
-	0xE465,0xE465,0xEC65,0xEC86,0xEC85,0xEC85,0xECC5,0xECE5,
-	0xECC5,0xECA5,0xEC85,0xEC65,0xE445,0xE445,0xE424,0xE404,
-	0xE3E5,0xE3C5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xFD87,0xF5E6,0xF5A5,0xECE5,0xEC86,0xEC65,0xEC65,
-	0xEC66,0xEC66,0xEC86,0xF4C7,0xF508,0xFD48,0xF588,0x0A36,
-	0x0A36,0x0A35,0x0A12,0x09EF,0x09AC,0x096A,0x0128,0x00C6,
-	0x00A4,0x00A5,0x0107,0x098E,0x0A55,0x0A97,0x0A76,0x0A32,
-	0x0A34,0x0A56,0x0236,0x2274,0x9C8E,0xFDE8,0xF586,0xF566,
-	0xF568,0xF588,0xF587,0x1299,0x1299,0x0A99,0x0A77,0x0256,
-	0x0256,0xF5A8,0xF5A8,0xF5A7,0xF5C7,0xF587,0xF586,0xF567,
-	0xF567,0xF567,0xF589,0xF5ED,0xF610,0xFE52,0xF672,0x096D,
-	0x012D,0x012D,0x016C,0x014A,0x016B,0x01CD,0x0A0F,0x0A10,
-	0x0A11,0x0A13,0x0A34,0x0A16,0x09D7,0x01D7,0x0237,0x0A77,
-	0x02D7,0x0AF8,0x1359,0x135A,0x135A,0x137A,0x135A,0x4395,
-	0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A38,0x7BEF,0xF5A8,0xF58A,
-	0xA9C1,0xA9E1,0xAA01,0xAA01,0xB221,0xB241,0xBA81,0xBAC1,
-	0xC322,0xC361,0xCBA2,0xCBC1,0xCB82,0xC341,0xC302,0xBAA1,
-	0xBA82,0xBA82,0xBA61,0xBA61,0xBA81,0xBA81,0xBAA1,0xBA82,
-	0xBA81,0xBA62,0xBA62,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x28A0,0xBAA2,0x8A02,0x0000,0x0000,0x0000,
-	0x5941,0xAA62,0xAA42,0xAA22,0xAA22,0xAA02,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xAA02,0xAA02,0xB222,0xB243,0xBA62,0xBA83,
-	0xC2A3,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,0xD345,0xDB85,
-	0xDBA5,0xDBA5,0xDBA4,0xDBA4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,
-	0xDBE4,0xDBE4,0xDC03,0xDC03,0xD403,0xD3E3,0xD3C3,0xD3A3,
-	0xD3A3,0xDBA4,0xDBA4,0xDBA4,0xE3C4,0xE3E4,0xEC23,0xEC63,
-	0xECA2,0xECA2,0xEC82,0xE422,0xE3E3,0xDBE3,0xDBC4,0xDBC4,
-	0xDBC4,0xDBE4,0xDBE5,0xE405,0xEC06,0xEC26,0xEC26,0xEC46,
-	0xEC46,0xEC65,0xE445,0xE445,0xE425,0xE445,0xE445,0xE465,
-	0xE485,0xEC65,0xEC65,0xEC86,0xEC86,0xEC85,0xECC5,0xECE5,
-	0xECE5,0xECC4,0xEC85,0xE465,0xE445,0xE445,0xE425,0xE404,
-	0xE3E5,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xF5A7,0xF5E6,0xF5A5,0xED05,0xEC85,0xEC65,0xEC65,
-	0xEC66,0xEC66,0xEC86,0xF4C7,0xFD08,0xF548,0xF5A8,0xF5C8,
-	0xF5C9,0xE58B,0xBCCE,0xBD0F,0x7C10,0x634E,0x322B,0x00E6,
-	0x0084,0x00A4,0x00E7,0x098C,0x0A33,0x1278,0x0A76,0x0A32,
-	0x0A34,0x0A56,0x0216,0x01F6,0x01D6,0x42F4,0xCD0A,0xF586,
-	0xF587,0xF588,0xF587,0x1299,0x0A99,0x0A98,0x0A77,0x0256,
-	0x0256,0xFDA9,0xF5A8,0xF5A7,0xF5C7,0xF587,0xF586,0xF567,
-	0xF567,0xF567,0xF589,0xF5EC,0xF60F,0xF652,0xF672,0xBD51,
-	0xBD71,0xBD51,0xBD51,0xC552,0xBD52,0xBD11,0xBCF0,0xBD0F,
-	0xBD0E,0xBCEE,0xBCED,0xBD0C,0xBD2C,0xBD0C,0xBCEC,0xBCCC,
-	0xBCAC,0xBC8B,0xBC6B,0xB44B,0xB44A,0xB44A,0xB46B,0xC489,
-	0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A39,0x7BEF,0xF5A8,0xF58A,
-	0xA9C1,0xA9E1,0xAA01,0xAA01,0xB221,0xB221,0xB261,0xBA82,
-	0xBAA1,0xC301,0xCB62,0xCBA2,0xD3C2,0xCBA1,0xCB42,0xC301,
-	0xBAC1,0xBAA2,0xBA62,0xBA81,0xBA81,0xBA81,0xC2A2,0xC2A2,
-	0xBAA1,0xBA82,0xBA82,0x5921,0x5921,0x5921,0x5921,0x5921,
-	0x5921,0x5921,0x5921,0x6141,0x6141,0x6141,0x6161,0x6161,
-	0x6141,0x5941,0x71A1,0xBAA2,0xA262,0x5941,0x5961,0x5941,
-	0x81E1,0xB262,0xAA62,0xAA42,0xAA21,0xAA02,0xAA02,0xAA02,
-	0xAA02,0xAA02,0xAA02,0xAA02,0xB222,0xB243,0xBA62,0xBA83,
-	0xC2A3,0xC2C4,0xCAE4,0xCB04,0xD324,0xD344,0xD345,0xDB65,
-	0xDB85,0xDBA4,0xDBA4,0xDBA4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,
-	0xDBE4,0xDBE4,0xDC03,0xDC03,0xD403,0xD403,0xD3E3,0xD3C3,
-	0xD3A3,0xDBA4,0xDBA4,0xE3A4,0xE3C4,0xE3E4,0xE423,0xEC63,
-	0xECA2,0xECA2,0xEC82,0xE442,0xE403,0xDBE3,0xDBC4,0xDBC4,
-	0xDBC4,0xDBE4,0xDBE4,0xE405,0xE426,0xEC26,0xEC26,0xEC26,
-	0xEC46,0xEC66,0xE445,0xE445,0xE445,0xE425,0xE445,0xE465,
-	0xE485,0xEC85,0xEC85,0xEC86,0xEC86,0xEC85,0xECC5,0xECE5,
-	0xECE4,0xECC4,0xEC85,0xEC65,0xEC45,0xEC45,0xE425,0xE405,
-	0xE405,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xF548,0xFDA7,0xF5E6,0xF5C5,0xED05,0xEC86,0xEC65,0xEC65,
-	0xEC66,0xEC65,0xEC86,0xF4C7,0xFD08,0xFD28,0xF588,0xF5A7,
-	0xF5C8,0xF5AA,0xF5CC,0xF5EE,0xF632,0xF694,0xFEB6,0xFF18,
-	0xBDB5,0x7BEF,0x3209,0x016A,0x0A12,0x1277,0x0A76,0x0A32,
-	0x0A33,0x0A56,0x0236,0x01F6,0x01D6,0x0217,0x0A59,0x6BD1,
-	0xE549,0xF588,0xED87,0x1299,0x0A99,0x0A98,0x0A77,0x0256,
-	0x0256,0xFDA9,0xF5A8,0xF5A7,0xF5A7,0xF587,0xF587,0xF567,
-	0xF567,0xF567,0xF589,0xF5EC,0xF60F,0xF651,0xF672,0xFEB2,
-	0xFED2,0xFED2,0xFE93,0xFEB5,0xFEB5,0xFE32,0xF5F0,0xF5EF,
-	0xF60E,0xF5ED,0xF5EB,0xF609,0xF648,0xFE28,0xFDE8,0xFD88,
-	0xFD48,0xF507,0xF4C6,0xECA5,0xECA5,0xECA5,0xECC5,0xECC6,
-	0xF4E6,0x0AF9,0x0AB9,0x0A79,0x0A39,0x7BEF,0xF5A8,0xF58A,
-	0xA9C1,0xA9E1,0xAA01,0xAA01,0xB201,0xB221,0xB241,0xB242,
-	0xBA62,0xBAA1,0xC302,0xCB62,0xCBA2,0xCBC2,0xCBA2,0xCB62,
-	0xC302,0xC2C2,0xBA82,0xBA81,0xBA81,0xBA82,0xC2A1,0xC2A2,
-	0xBAA1,0xBA82,0xC282,0xBA82,0xBA62,0xBA62,0xBA62,0xBA62,
-	0xBA62,0xBA63,0xBA83,0xC283,0xC283,0xC2A3,0xC2A3,0xC2A3,
-	0xC2A3,0xBAA2,0xBAC2,0xBAC2,0xBAC2,0xBAA2,0xBAC2,0xBAA2,
-	0xB282,0xB282,0xB262,0xB262,0xAA42,0xAA22,0xAA21,0xAA21,
-	0xAA02,0xA9E2,0xAA02,0xAA02,0xB222,0xB243,0xB262,0xBA83,
-	0xC2A3,0xC2C4,0xCAE4,0xCB04,0xD324,0xD344,0xD345,0xDB65,
-	0xDB85,0xDBA5,0xDBC5,0xDBC4,0xDBC4,0xDBC4,0xDBC4,0xDBE4,
-	0xDBE4,0xDBE4,0xDC04,0xDC03,0xD403,0xD403,0xD3E3,0xD3C3,
-	0xD3A4,0xDBA4,0xDBA4,0xE3C4,0xE3A4,0xE3E4,0xE423,0xEC43,
-	0xECA2,0xECA2,0xECA2,0xE463,0xDC03,0xDBE3,0xDBC4,0xDBC4,
-	0xDBC4,0xDBE4,0xDBE4,0xE405,0xE426,0xEC26,0xEC26,0xEC46,
-	0xEC66,0xEC65,0xE485,0xE445,0xE445,0xE425,0xE445,0xE465,
-	0xE465,0xEC85,0xEC85,0xEC86,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xECA5,0xE465,0xE445,0xE445,0xE445,0xE425,
-	0xE3E5,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xFDA7,0xF5E6,0xF5C5,0xED25,0xEC85,0xEC65,0xEC65,
-	0xEC45,0xEC65,0xEC86,0xF4C7,0xFD08,0xFD28,0xFD87,0xF5C7,
-	0xF5A8,0xF589,0xF5AB,0xF5CE,0xF630,0xF674,0xF6B6,0xFEF8,
-	0xFF7B,0xFF7B,0xFF39,0xE655,0x9C6F,0x4333,0x0A76,0x0A12,
-	0x0A13,0x0A56,0x0236,0x01F6,0x01D6,0x0A17,0x0A59,0x0A98,
-	0x3B15,0xC4EA,0xF587,0x1299,0x0A99,0x0A78,0x0A77,0x0256,
-	0x0256,0xFDA9,0xFDA8,0xF5A7,0xF5C7,0xF5A7,0xF5A7,0xF587,
-	0xF567,0xF568,0xF589,0xF5CC,0xF60F,0xF651,0xFE72,0xFE92,
-	0xFED2,0xFED3,0xFE94,0xFEB5,0xFE95,0xF632,0xF610,0xF60F,
-	0xF60E,0xF5ED,0xEDCB,0xF60A,0xF648,0xFE28,0xFDE8,0xFD88,
-	0xFD48,0xF507,0xF4C7,0xECA5,0xECA5,0xECA5,0xECA5,0xECC6,
-	0xECE6,0x0AD9,0x1299,0x0A79,0x0A39,0x7BEF,0xF5A9,0xF58A,
-	0xA9C1,0xA9E1,0xA9E1,0xAA01,0xB201,0xB221,0xB241,0xB241,
-	0xB241,0xBA82,0xBAA1,0xC302,0xC362,0xCBA2,0xCBC2,0xCBA1,
-	0xCB41,0xC302,0xC2C1,0xBAA1,0xBA82,0xBA82,0xBAA2,0xC2A1,
-	0xC2A1,0xC282,0xBA82,0xBA82,0xBA82,0xBA62,0xBA82,0xBA62,
-	0xBA62,0xBA62,0xBA83,0xC283,0xC2A3,0xC2A3,0xC2A3,0xC2A3,
-	0xC2A3,0xC2C2,0xC2C2,0xBAC2,0xBAC2,0xBAC2,0xBAC2,0xBAC2,
-	0xB2A2,0xB281,0xB262,0xAA62,0xAA42,0xAA21,0xAA21,0xAA21,
-	0xAA02,0xAA02,0xAA02,0xAA02,0xAA22,0xB243,0xB262,0xBA83,
-	0xC283,0xC2A3,0xCAE4,0xCB04,0xD324,0xD324,0xD345,0xDB65,
-	0xDB85,0xDBA5,0xDBC5,0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xDBE4,
-	0xDBE4,0xDBE4,0xDC03,0xDC03,0xD403,0xD403,0xD3E3,0xD3E3,
-	0xD3C3,0xD3A4,0xDBA4,0xDBA4,0xE3A4,0xE3E4,0xE404,0xEC43,
-	0xEC82,0xECA2,0xECA2,0xE462,0xE423,0xDC03,0xDBE4,0xDBC4,
-	0xDBE4,0xDBE4,0xDBE4,0xDBE5,0xE425,0xEC46,0xEC46,0xEC46,
-	0xEC66,0xEC85,0xEC85,0xE465,0xE445,0xE445,0xE465,0xE465,
-	0xEC85,0xEC85,0xEC86,0xEC86,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xECA5,0xE465,0xE445,0xEC45,0xE445,0xE425,
-	0xE405,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xFDA7,0xF5E6,0xF5C5,0xED25,0xECA6,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC86,0xF4C7,0xFD08,0xFD28,0xF587,0xF5A7,
-	0xF5A7,0xF588,0xF5AB,0xF5CD,0xF610,0xF653,0xFE95,0xFEF7,
-	0xFF5A,0xFF7B,0xFF5A,0xF6D6,0xF610,0xF58A,0xD52B,0x8410,
-	0x1273,0x0A76,0x0236,0x01F6,0x01D6,0x09F8,0x0A59,0x0A78,
-	0x0A77,0x0A77,0x9C4E,0x1299,0x1299,0x0A78,0x0A77,0x0256,
-	0x0256,0xFDA9,0xF5A8,0xF5A7,0xF5C7,0xF5A7,0xF587,0xF587,
-	0xF587,0xF567,0xF588,0xF5CB,0xF60E,0xF651,0xFE72,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFEB5,0xFE95,0xFE32,0xF5F0,0xF60F,
-	0xF60E,0xF5ED,0xF60C,0xF60A,0xF648,0xFE28,0xFDE8,0xFD89,
-	0xFD48,0xF507,0xF4C6,0xECA5,0xECA5,0xECA5,0xECA5,0xECC6,
-	0xECE6,0x0AD9,0x0A99,0x0A79,0x0A38,0x7BEF,0xFDA9,0xF58A,
-	0xA9E1,0xA9E1,0xA9E1,0xAA01,0xB201,0xB221,0xB221,0xB242,
-	0xB241,0xB281,0xBA82,0xBAA1,0xC302,0xCB62,0xCBA2,0xD3C2,
-	0xCBA1,0xCB62,0xC301,0xC2C1,0xBA81,0xBA82,0xBAA2,0xC2A1,
-	0xC2A1,0xC2A2,0xC282,0xBA82,0xBA82,0xBA82,0xBA82,0xC262,
-	0xBA62,0xBA62,0xBA83,0xBA83,0xC283,0xC2A3,0xC2A3,0xC2A3,
-	0xC2A3,0xC2C3,0xC2C2,0xC2C2,0xC2C2,0xBAC2,0xBAC2,0xBAC2,
-	0xBAA2,0xB282,0xB282,0xB261,0xAA42,0xAA21,0xAA22,0xAA21,
-	0xAA02,0xAA02,0xAA02,0xAA02,0xAA22,0xB242,0xB262,0xBA83,
-	0xBA83,0xC2A3,0xCAE4,0xCB04,0xCB04,0xD324,0xD345,0xDB65,
-	0xDB85,0xDBA5,0xDBC5,0xDBC4,0xE3E4,0xE3E4,0xDBE4,0xDBE4,
-	0xDC04,0xDC04,0xDC03,0xDC03,0xDC03,0xD403,0xD3E3,0xD3E3,
-	0xD3C3,0xD3C4,0xDBA4,0xDBC4,0xE3A4,0xE3E4,0xE404,0xEC44,
-	0xEC83,0xECA2,0xECA2,0xEC82,0xE443,0xDC03,0xDBE4,0xDBE4,
-	0xDBE4,0xDBE4,0xDBE4,0xDBE5,0xE425,0xEC46,0xEC46,0xEC46,
-	0xEC66,0xEC86,0xEC86,0xE465,0xE445,0xE445,0xE465,0xE465,
-	0xEC85,0xEC85,0xEC85,0xECA6,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xED05,0xECE4,0xECA5,0xEC65,0xE445,0xEC45,0xE445,0xE425,
-	0xE405,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xFDA7,0xF5E6,0xF5C5,0xED25,0xECA5,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC86,0xF4C7,0xFCE8,0xFD28,0xF587,0xF5A7,
-	0xF5A7,0xF588,0xF58A,0xF5AC,0xF5EF,0xF632,0xFE95,0xFED7,
-	0xFF5A,0xFF9C,0xFF7B,0xF6F7,0xF630,0xF58A,0xF58A,0xF5ED,
-	0xF5CC,0x9C4E,0x2295,0x01F6,0x09D7,0x09F8,0x0A59,0x0A78,
-	0x0A77,0x0A78,0x1278,0x0A79,0x0A99,0x0A78,0x0A77,0x0256,
-	0x0256,0xFDA8,0xF5A8,0xF5A7,0xF5C7,0xF5A7,0xF587,0xF587,
-	0xF567,0xF567,0xF588,0xF5CB,0xF60E,0xF651,0xFE92,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFEB5,0xFE95,0xFE32,0xF5F0,0xF5EF,
-	0xF60E,0xF5ED,0xF5EC,0xF60A,0xF649,0xFE28,0xFDE9,0xFD89,
-	0xFD48,0xF507,0xF4E6,0xECC5,0xECA5,0xECA5,0xECC5,0xECE6,
-	0xF505,0x12D9,0x0A99,0x0A59,0x0A38,0x7BEF,0xFDA9,0xF58A,
-	0xA9E1,0xA9E1,0xA9E1,0xAA01,0xAA01,0xB221,0xB221,0xBA41,
-	0xB241,0xB241,0xB262,0xBA81,0xBAA1,0xC301,0xC362,0xCBA2,
-	0xD3C2,0xCBA2,0xCB41,0xC301,0xC2C1,0xBAA2,0xBA81,0xBAA1,
-	0xC2A1,0xC2A2,0xC2A2,0x6140,0x6141,0x5941,0x6121,0x5941,
-	0x5941,0x5941,0x5921,0x5921,0x6141,0x6141,0x6161,0x6161,
-	0x6161,0x6161,0x79A1,0xC2C2,0xC2C3,0xBAC2,0xBAE3,0xBAC2,
-	0xBAC2,0xB2A2,0xB282,0xB262,0xAA62,0xAA42,0xAA22,0xAA22,
-	0xAA02,0xAA02,0xAA02,0xAA22,0xAA22,0xB242,0xB242,0xBA63,
-	0xBA83,0xC2A3,0xC2C4,0xCAE4,0xCB04,0xD324,0xD345,0xDB65,
-	0xDB85,0xDBA5,0xDBC5,0xDBC5,0xE3E4,0xE3E4,0xE3E4,0xE3E4,
-	0xDBE4,0xDC04,0xDC04,0xDC04,0xDC03,0xDC03,0xD3E3,0xD3E3,
-	0xD3C3,0xD3C4,0xD3A4,0xDBC4,0xDBA4,0xE3C4,0xE404,0xEC43,
-	0xEC83,0xECA2,0xECC2,0xECA2,0xE442,0xDC03,0xDBE4,0xDBE4,
-	0xDBE4,0xDBE4,0xDBE4,0xDBE5,0xE425,0xEC46,0xEC46,0xEC46,
-	0xEC66,0xEC86,0xEC86,0xE465,0xE465,0xEC45,0xE465,0xEC65,
-	0xECA5,0xECA5,0xECA5,0xECA6,0xECA6,0xECA6,0xECE6,0xED05,
-	0xED05,0xECE4,0xECA4,0xEC85,0xEC45,0xEC65,0xE445,0xE425,
-	0xE405,0xE3E5,0xE3E5,0xE405,0xEC26,0xF467,0xF4A7,0xFCC8,
-	0xFD28,0xFDA7,0xF5E6,0xF5C5,0xED25,0xEC85,0xEC65,0xEC65,
-	0xEC65,0xEC45,0xEC66,0xF4C7,0xFCE8,0xF528,0xF587,0xF5A7,
-	0xF5A7,0xF567,0xF56A,0xF5AC,0xF5EE,0xF632,0xFE74,0xFEB6,
-	0xFF5A,0xFF9C,0xFF7C,0xFF18,0xF652,0xF5AB,0xF589,0xF5ED,
-	0xF5CC,0xF5A9,0xFDC9,0x9C8E,0x2255,0x09F8,0x0A59,0x0A78,
-	0x0A77,0x0A57,0x0A78,0x0A79,0x0A99,0x0A78,0x0A77,0x0256,
-	0x0256,0xFDA8,0xF5A8,0xF5A7,0xF5C7,0xF5A7,0xF587,0xF587,
-	0xF567,0xF567,0xF588,0xF5CB,0xF60E,0xF651,0xFE92,0xFEB3,
-	0xFED3,0xFED3,0xFEB4,0xFEB5,0xFE94,0xFE32,0xF610,0xF60F,
-	0xF60E,0xF60D,0xF60C,0xF62A,0xF649,0xFE28,0xFDE9,0xFDA9,
-	0xFD49,0xF527,0xF4E6,0xF4C6,0xECA5,0xECA5,0xECC5,0xF4E6,
-	0xED05,0x7BF0,0x7BEF,0x7BF0,0x7BEF,0xBCEC,0xFDA9,0xF58A,
-	0xA9E1,0xA9E1,0xAA01,0xAA01,0xAA01,0xB221,0xB221,0xB242,
-	0xB242,0xB241,0xB262,0xBA62,0xBA81,0xBAA1,0xC302,0xCB62,
-	0xCBA2,0xCBC2,0xCBA2,0xCB61,0xC302,0xC2C2,0xBAA1,0xBAA1,
-	0xC2A2,0xC2C2,0xC2C2,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x30A0,0xC2C2,0xC2C3,0xBAC2,0xBAC2,0xBAE2,
-	0xBAC2,0xB2A2,0xB2A2,0xB282,0xB262,0xAA42,0xAA42,0xAA22,
-	0xAA22,0xAA02,0xAA02,0xAA22,0xAA42,0xB242,0xB242,0xBA63,
-	0xBA83,0xBAA3,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,0xD345,
-	0xDB85,0xDBA5,0xDBC5,0xDBC5,0xE3C5,0xE3E5,0xE3E4,0xDBE4,
-	0xDBE4,0xDC04,0xDBE4,0xDC03,0xDC23,0xD423,0xD403,0xD403,
-	0xD3E3,0xD3C3,0xD3C4,0xDBA4,0xE3C4,0xE3C4,0xE3E4,0xEC24,
-	0xEC63,0xF4A2,0xECC2,0xECA2,0xE462,0xE423,0xE3E4,0xDBE4,
-	0xDBE4,0xDBE4,0xDBE4,0xDC05,0xE425,0xEC46,0xEC46,0xEC66,
-	0xEC67,0xEC86,0xECA6,0xEC86,0xE465,0xE465,0xE465,0xE485,
-	0xECA5,0xE4A5,0xECA5,0xECA5,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xED25,0xED05,0xECC5,0xE485,0xE465,0xE445,0xE445,0xE425,
-	0xE405,0xE3E5,0xE3E5,0xE3E5,0xEC26,0xF447,0xF487,0xFCC8,
-	0xFD28,0xFD87,0xFDE6,0xF5E5,0xED45,0xECA5,0xE465,0xEC65,
-	0xEC65,0xEC65,0xEC65,0xF4C7,0xF4E7,0xFD28,0xF567,0xF5C6,
-	0xF5A7,0xED67,0xF569,0xF58B,0xF5EE,0xF611,0xFE74,0xFEB6,
-	0xFF39,0xFF9C,0xFF7C,0xFF39,0xF674,0xF5CC,0xF5AA,0xF5ED,
-	0xF5CC,0xF5A9,0xFDC9,0xFE09,0xEDC9,0x8410,0x0A59,0x0A78,
-	0x0A77,0x0A78,0x0A78,0x0A79,0x0A99,0x0A79,0x0A77,0x0256,
-	0x0256,0xF5A8,0xF5C8,0xF5C7,0xF5C7,0xF5A7,0xF5A7,0xF587,
-	0xF567,0xF567,0xF588,0xF5CB,0xF5EE,0xFE31,0xFE72,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFED5,0xFEB5,0xF631,0xF610,0xF60F,
-	0xF60E,0xF60E,0xF5EC,0xF62B,0xF649,0xFE29,0xFDE9,0xFDA9,
-	0xFD48,0xF527,0xF4E6,0xECC5,0xECA5,0xECC5,0xECC6,0xECE6,
-	0xED06,0xF526,0xF586,0xF5C6,0xF5C6,0xFDC8,0xFDA9,0xF58A,
-	0xA9E1,0xA9E1,0xA9E1,0xAA01,0xAA01,0xB221,0xB221,0xB242,
-	0xB242,0xB241,0xB262,0xB261,0xBA61,0xBA81,0xBAC1,0xC302,
-	0xCB61,0xCBA2,0xD3C2,0xCB82,0xCB42,0xC302,0xC2C1,0xC2A1,
-	0xC2C2,0xC2C1,0xC2C2,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x30A0,0xC2C2,0xC2C3,0xC2C3,0xBAC2,0xBAC2,
-	0xBAC2,0xBAC2,0xB2A2,0xB282,0xB262,0xAA41,0xAA42,0xAA22,
-	0xAA22,0xAA22,0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xBA63,
-	0xBA83,0xC2A3,0xC2C4,0xCAE4,0xCB04,0xD324,0xD345,0xDB65,
-	0xDB85,0xDBA5,0xDBC5,0xDBC5,0xE3E5,0xE3E5,0xE3E5,0xE3E4,
-	0xDC04,0xE3E4,0xDC04,0xDC04,0xDC23,0xDC23,0xDC03,0xD3E3,
-	0xD3E3,0xD3E3,0xD3C4,0xDBC4,0xDBC4,0xE3C4,0xE404,0xEC24,
-	0xEC63,0xECA2,0xECC2,0xECA2,0xE462,0xE423,0xE3E4,0xDBE4,
-	0xDBE4,0xDBE4,0xDBE4,0xDC05,0xE425,0xE426,0xEC46,0xEC66,
-	0xEC66,0xEC86,0xECA6,0xEC86,0xEC85,0xE465,0xE465,0xEC85,
-	0xECA5,0xECA5,0xECA5,0xECA6,0xECA6,0xECC6,0xECC6,0xED06,
-	0xED25,0xED05,0xECE5,0xEC85,0xE465,0xEC45,0xE445,0xE425,
-	0xE405,0xE3E5,0xE3E5,0xE3E5,0xEC26,0xF467,0xF487,0xFCC8,
-	0xFD28,0xFD87,0xFDE6,0xF5E5,0xED45,0xECA5,0xEC85,0xEC65,
-	0xEC65,0xEC65,0xEC65,0xF4C7,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF567,0xF568,0xF58B,0xF5CD,0xF610,0xF673,0xFEB6,
-	0xFF38,0xFF7C,0xFF9D,0xFF59,0xF694,0xF5CD,0xF5AA,0xF5ED,
-	0xF5CC,0xF5A9,0xFDC9,0xFE09,0xF609,0xF608,0xDD29,0x4334,
-	0x0A77,0x0A78,0x0A78,0x0A79,0x0A99,0x0A78,0x0A77,0x0256,
-	0x0256,0xF5A8,0xF5C8,0xF5C7,0xF5C7,0xF5A7,0xF5A7,0xF587,
-	0xF567,0xF567,0xF588,0xF5CA,0xF5ED,0xFE30,0xFE72,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFED5,0xFEB5,0xF652,0xF610,0xF60F,
-	0xF60E,0xF60E,0xF60D,0xF62B,0xF649,0xFE49,0xFE09,0xFDA9,
-	0xFD48,0xF527,0xF4E6,0xECC5,0xECC5,0xECC5,0xECC5,0xECE6,
-	0xED06,0xF526,0xF586,0xF5C6,0xF5E6,0xF5C8,0xFDA9,0xF58A,
-	0xA9E1,0xA9E1,0xA9E1,0xAA01,0xAA01,0xB221,0xB221,0xB242,
-	0xB241,0xB261,0xB262,0xB261,0xB261,0xBA61,0xBA81,0xBAC1,
-	0xC301,0xCB62,0xCBA2,0xD3C2,0xCBA2,0xCB42,0xC301,0xC2C1,
-	0xC2C1,0xC2C2,0xC2C2,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x30A0,0xC2C3,0xC2C3,0xC2C3,0xBAE3,0xBAE3,
-	0xBAE2,0xBAC2,0xB2C2,0xB282,0xB262,0xAA42,0xAA41,0xAA42,
-	0xAA22,0xAA22,0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xBA63,
-	0xBA83,0xBAA3,0xC2C4,0xCAE4,0xCB04,0xD324,0xD324,0xD345,
-	0xDB85,0xDBA5,0xDBC5,0xE3C5,0xE3E5,0xE3E5,0xE3E5,0xE3E4,
-	0xDC04,0xE404,0xDC04,0xDC24,0xDC23,0xDC23,0xDC03,0xDC03,
-	0xD3E3,0xD3E3,0xD3C3,0xDBC4,0xDBA5,0xE3C5,0xE404,0xEC04,
-	0xEC43,0xECA2,0xECC2,0xECC2,0xEC82,0xE423,0xE404,0xDBE4,
-	0xDBE4,0xDC04,0xDBE5,0xDC05,0xE425,0xE426,0xEC46,0xEC66,
-	0xEC66,0xEC86,0xECA6,0xEC86,0xEC85,0xEC85,0xE465,0xEC85,
-	0xECA5,0xECA5,0xECA5,0xECC6,0xECA6,0xECC6,0xECC6,0xECE6,
-	0xED25,0xED05,0xECC5,0xECA5,0xE465,0xEC45,0xE445,0xE445,
-	0xE405,0xE405,0xE3E5,0xE3E5,0xEC26,0xF447,0xF487,0xFCC8,
-	0xFD28,0xFD87,0xFDE6,0xF5E5,0xF545,0xECA5,0xE465,0xEC65,
-	0xEC65,0xEC65,0xEC65,0xF4C7,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF566,0xF548,0xF56A,0xF5AC,0xF60F,0xFE52,0xFE95,
-	0xFF18,0xFF9C,0xFF9D,0xFF7A,0xFEB6,0xF5EE,0xF5AA,0xF5ED,
-	0xFDCC,0xF5A9,0xF5C9,0xFE09,0xFE29,0xF608,0xF5A6,0xF587,
-	0x8C2F,0x1A97,0x0A78,0x0A79,0x1299,0x0A78,0x0A77,0x0256,
-	0x0A56,0xF5A8,0xF5C8,0xF5C7,0xF5A7,0xF5A7,0xF5A7,0xF587,
-	0xF587,0xF567,0xF588,0xF5CA,0xF5ED,0xF630,0xF672,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFED5,0xFEB5,0xF652,0xF610,0xF60F,
-	0xF60F,0xF60E,0xF60D,0xF62B,0xF64A,0xFE49,0xFE09,0xFDA9,
-	0xFD69,0xF527,0xF4E6,0xECC6,0xECA5,0xECC5,0xECC5,0xECE6,
-	0xED26,0xF546,0xF586,0xF5C6,0xF5E6,0xF5C8,0xFDA9,0xF58A,
-	0xA9C1,0xA9E1,0xA9E1,0xAA01,0xB201,0xB221,0xB221,0xB241,
-	0xB241,0xB241,0xB262,0xB261,0xB261,0xBA62,0xBA62,0xBA81,
-	0xC2E1,0xC321,0xCB62,0xCBA2,0xCBC2,0xCB82,0xCB41,0xC2E1,
-	0xC2E2,0xC2C1,0xC2C1,0x30A0,0x30A0,0x30A0,0x30A0,0x30A0,
-	0x30A0,0x30A0,0x30A0,0x0820,0x0000,0x0000,0x0000,0x0000,
-	0x0820,0x28A0,0x5141,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2E2,
-	0xBAE2,0xBAC2,0xB2C2,0xB2A2,0xB282,0xB262,0xAA42,0xAA42,
-	0xAA42,0xAA22,0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xBA63,
-	0xBA83,0xBA83,0xC2C3,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,
-	0xDB85,0xDBA5,0xDBC5,0xE3C5,0xE3E5,0xDBE5,0xE3E5,0xE405,
-	0xE404,0xE404,0xDC04,0xDC24,0xDC23,0xDC43,0xDC23,0xDC03,
-	0xD403,0xD3E3,0xD3E4,0xDBC4,0xDBC4,0xE3C4,0xE3E4,0xEC04,
-	0xEC43,0xF4A3,0xF4C2,0xECC2,0xEC82,0xE442,0xE404,0xDBE4,
-	0xDBE4,0xDC04,0xDC05,0xDC05,0xE405,0xE426,0xEC46,0xEC66,
-	0xEC67,0xEC87,0xECA6,0xECA6,0xEC86,0xEC85,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECC5,0xECC6,0xECC6,0xECC6,0xECE6,0xECE6,
-	0xED25,0xED25,0xECE5,0xECA5,0xE465,0xEC45,0xEC45,0xE425,
-	0xE405,0xE405,0xE3E5,0xE3E5,0xEC26,0xF447,0xF487,0xFCC8,
-	0xFD28,0xFD87,0xFDE6,0xF605,0xF565,0xECA5,0xEC85,0xEC65,
-	0xEC65,0xEC65,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF567,0xF548,0xF56A,0xF5AC,0xF5EF,0xFE31,0xFE74,
-	0xFF18,0xFF7C,0xFFBD,0xFF7B,0xFED7,0xF60F,0xF5AA,0xF5ED,
-	0xFDED,0xF5A9,0xFDC9,0xFE09,0xFE29,0xFE08,0xF5A6,0xF587,
-	0xF588,0xC50A,0x3B15,0x1279,0x0A79,0x0A78,0x0A77,0x0256,
-	0x0236,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF587,0xF587,
-	0xF587,0xF587,0xF588,0xF5CA,0xF5ED,0xF630,0xF672,0xFEB2,
-	0xFED3,0xFED2,0xFEB4,0xFED5,0xFEB5,0xFE52,0xF610,0xF60F,
-	0xF62F,0xF60E,0xF60C,0xF62B,0xF64A,0xFE4A,0xFE09,0xFDA9,
-	0xF568,0xF527,0xF4E6,0xECC6,0xECC5,0xECC5,0xECC6,0xF4E6,
-	0xED06,0xF546,0xF5A6,0xF5C6,0xF5E7,0xF5C8,0xFDA9,0xF58A,
-	0xA1C1,0xA9C1,0xA9E1,0xA9E1,0xAA01,0xB201,0xB221,0xB241,
-	0xB241,0xB242,0xB262,0xB261,0xB261,0xBA62,0xBA62,0xBA61,
-	0xBAA1,0xC2E1,0xCB21,0xCB82,0xCBC2,0xD3C2,0xCB82,0xCB22,
-	0xC2E1,0xC2C2,0xC2C2,0xC2E2,0xC2C2,0xC2A2,0xC2A2,0xC2A2,
-	0xC2A2,0xC2A2,0xC282,0xC282,0xB263,0x6962,0x0820,0x0000,
-	0x0000,0x4101,0xB283,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2E3,
-	0xBAE2,0xBAE2,0xBAC2,0xBAA2,0xB281,0xB262,0xB262,0xAA62,
-	0xAA42,0xAA42,0xAA21,0xAA22,0xAA42,0xB242,0xB242,0xB262,
-	0xBA83,0xBA83,0xC2C3,0xCAC4,0xCAE4,0xCB04,0xD324,0xD345,
-	0xDB65,0xDB85,0xDBC5,0xE3C5,0xE3E5,0xDBE5,0xE405,0xE405,
-	0xE405,0xE404,0xE404,0xDC24,0xDC43,0xDC43,0xDC23,0xDC23,
-	0xD403,0xD403,0xD3E4,0xDBC4,0xDBC4,0xDBC4,0xE3E5,0xEC04,
-	0xEC44,0xF4A3,0xF4C2,0xECC2,0xECA2,0xE462,0xDC03,0xDBE4,
-	0xDC04,0xDC05,0xDC05,0xDC05,0xE405,0xE425,0xEC46,0xEC66,
-	0xEC67,0xEC67,0xECA6,0xECA5,0xECA5,0xEC85,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECC5,0xECC6,0xECC6,0xECC6,0xECE6,0xF505,
-	0xED25,0xED24,0xED05,0xECC5,0xEC85,0xEC65,0xEC45,0xE425,
-	0xE405,0xE405,0xE3E5,0xE3E5,0xEC26,0xF447,0xF487,0xFCC8,
-	0xFD28,0xFD87,0xFE07,0xF5E5,0xF565,0xECC5,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF567,0xF547,0xF549,0xF58B,0xF5EE,0xF631,0xFE74,
-	0xFEF8,0xFF7B,0xFFBD,0xFF9B,0xFEF7,0xF630,0xF5AB,0xF5ED,
-	0xFDED,0xF5A9,0xFDC9,0xFE09,0xFE28,0xF607,0xF5A6,0xF587,
-	0xF588,0xF587,0xE567,0x3B16,0x0A79,0x0A79,0x0A57,0x0A56,
-	0x0A56,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF587,0xF587,
-	0xF587,0xF587,0xF588,0xF5AA,0xF5ED,0xF630,0xF672,0xFEB2,
-	0xFED3,0xFED2,0xFEB4,0xFED5,0xFEB5,0xFE52,0xF610,0xF60F,
-	0xF62F,0xF62E,0xF60D,0xF62B,0xF64B,0xFE4A,0xFE09,0xFDC9,
-	0xFD69,0xF527,0xF506,0xECE6,0xECC6,0xECC5,0xECC6,0xECE6,
-	0xED26,0xF566,0xF5A6,0xF5E6,0xFDE7,0xF5C8,0xFDA9,0xFD8A,
-	0xA1A1,0xA1C1,0xA9C1,0xA9E1,0xA9E1,0xAA01,0xB221,0xB241,
-	0xB241,0xB242,0xB262,0xB261,0xB261,0xBA62,0xBA61,0xBA61,
-	0xBA81,0xBAA1,0xC2E1,0xCB42,0xCBA1,0xD3C2,0xD3C2,0xD382,
-	0xCB21,0xC2E1,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2A2,0xC2A2,
-	0xC2A2,0xC2A2,0xC282,0xC2A2,0xC2A2,0xC2A3,0x6141,0x0000,
-	0x0000,0x0000,0x5121,0xC2C3,0xC2C3,0xC2C3,0xC2E3,0xC2E2,
-	0xC302,0xBAE2,0xBAE2,0xBAC2,0xB2A2,0xB282,0xB262,0xB262,
-	0xAA42,0xAA42,0xAA21,0xAA22,0xAA42,0xAA42,0xB242,0xB262,
-	0xBA83,0xBA83,0xC2A3,0xC2C3,0xCAE4,0xCB04,0xD324,0xD345,
-	0xDB65,0xDB85,0xDBA5,0xE3C5,0xE3E5,0xE405,0xE405,0xE405,
-	0xE405,0xE404,0xDC24,0xDC24,0xDC43,0xDC43,0xDC43,0xD423,
-	0xD403,0xD403,0xD3E3,0xD3E4,0xDBC4,0xDBC4,0xE3E4,0xE404,
-	0xEC24,0xEC83,0xF4C2,0xECC2,0xECC2,0xEC83,0xE424,0xDBE4,
-	0xDC04,0xDC04,0xDC04,0xDC05,0xE405,0xE425,0xEC46,0xEC66,
-	0xEC67,0xEC87,0xECA6,0xF4C5,0xECA6,0xEC86,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECC5,0xECC5,0xECC6,0xF4C6,0xECE6,0xF506,
-	0xED25,0xED45,0xED05,0xECC5,0xEC85,0xE465,0xE445,0xE425,
-	0xE405,0xE405,0xE3E5,0xE3E5,0xEC26,0xEC47,0xF487,0xFCC8,
-	0xFD28,0xFD88,0xF5E7,0xF605,0xF565,0xECA5,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF586,0xF566,0xF547,0xF548,0xF58A,0xF5CD,0xF610,0xFE73,
-	0xFEF7,0xFF7B,0xFFBD,0xFF9C,0xFF19,0xF631,0xF5CB,0xF5EE,
-	0xFDED,0xF5C9,0xFDC9,0xFE09,0xFE28,0xF608,0xF5A6,0xF587,
-	0xF588,0xF5A7,0xF587,0xE567,0x7BEF,0x7BEF,0x83EF,0x7BEF,
-	0x7BEF,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF587,
-	0xF587,0xF588,0xF588,0xF5A9,0xF5EC,0xF62F,0xF672,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFED5,0xFEB5,0xFE53,0xF610,0xF60F,
-	0xF62F,0xF62E,0xF62D,0xF62B,0xF66B,0xFE4A,0xFE0A,0xFDCA,
-	0xFD69,0xF527,0xF506,0xECE6,0xECC6,0xECC6,0xECC6,0xF4E6,
-	0xF526,0xF566,0xF5A6,0xF5E6,0xF5E7,0xFDC8,0xFD89,0xFD8A,
-	0xA1A1,0xA1A1,0xA9C1,0xA9C1,0xA9E1,0xA9E1,0xB221,0xB241,
-	0xB241,0xB241,0xB262,0xB261,0xB261,0xBA62,0xBA61,0xBA61,
-	0xBA81,0xBA82,0xBAC2,0xC301,0xCB61,0xD3C2,0xD3C2,0xD3A2,
-	0xCB61,0xCB21,0xC2E1,0xC2C2,0xC2E2,0xC2C2,0xC2C2,0xC2A2,
-	0xC2A2,0xC2A3,0xC2A2,0xC2A2,0xC2A3,0xC2A3,0x9202,0x0000,
-	0x0000,0x0000,0x0000,0xC2E3,0xC2C3,0xC2C3,0xC2E3,0xC303,
-	0xBB02,0xBAE2,0xBAE2,0xBAC2,0xB2A2,0xB282,0xB262,0xB262,
-	0xAA42,0xAA42,0xAA42,0xAA42,0xAA42,0xAA42,0xB242,0xB262,
-	0xBA82,0xBA83,0xC2A3,0xC2C3,0xCAE4,0xCB04,0xD324,0xD344,
-	0xDB65,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xE405,0xE405,0xE405,
-	0xE405,0xE404,0xDC24,0xDC24,0xDC43,0xDC43,0xDC43,0xDC23,
-	0xD423,0xD423,0xD3E3,0xDBE4,0xDBC4,0xE3C5,0xE3E4,0xE404,
-	0xEC24,0xEC83,0xF4C2,0xECC2,0xECC2,0xEC83,0xE423,0xDC04,
-	0xDC04,0xDC04,0xDC04,0xDC05,0xE405,0xE425,0xEC46,0xEC66,
-	0xEC66,0xEC87,0xEC86,0xECC5,0xECC5,0xECA6,0xEC86,0xEC85,
-	0xECA5,0xECC5,0xECC5,0xECC6,0xF4C6,0xF4C6,0xF4E6,0xF506,
-	0xED25,0xED45,0xED05,0xECC5,0xE4A5,0xE465,0xE445,0xE445,
-	0xE425,0xE405,0xE3E5,0xE3E5,0xEC26,0xF447,0xF487,0xFCA8,
-	0xFD08,0xFD88,0xFE07,0xF605,0xF565,0xECC5,0xEC86,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF586,0xF566,0xF547,0xF547,0xF569,0xF5AC,0xF60F,0xF652,
-	0xFED6,0xFF5B,0xFFBD,0xFFBC,0xFF39,0xF652,0xF5CB,0xF5EE,
-	0xF5ED,0xF5C9,0xFDC9,0xFE09,0xFE28,0xF608,0xF5A6,0xF567,
-	0xF5A8,0xF5A7,0xF587,0xED86,0xF586,0xF587,0xF5A8,0xF5A9,
-	0xF5A9,0xF5A9,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A6,0xF587,
-	0xF587,0xF588,0xF588,0xF5C9,0xF5EC,0xF62F,0xF672,0xFEB2,
-	0xFED3,0xFED3,0xFEB4,0xFED5,0xFEB5,0xFE53,0xF630,0xF62F,
-	0xF62F,0xF62E,0xF62D,0xF62C,0xF66B,0xFE4A,0xFE2A,0xFDCA,
-	0xFD69,0xF527,0xF4E6,0xECE6,0xECC6,0xECC6,0xECC6,0xF4E6,
-	0xF526,0xF566,0xF5C6,0xF5E6,0xFDE7,0xF5C8,0xFD89,0xF58A,
-	0xA1A1,0xA1A1,0xA1A1,0xA9C1,0xA9C1,0xA9E1,0xAA01,0xB221,
-	0xB241,0xB241,0xB262,0xB262,0xB261,0xBA62,0xBA62,0xBA62,
-	0xBA61,0xBA82,0xBAA2,0xC2E2,0xC322,0xCB82,0xD3C2,0xD3C2,
-	0xD3A1,0xCB62,0xC301,0xC2E2,0xCAE2,0xC2C2,0xC2C2,0xC2C2,
-	0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC2A2,0xC2A3,0x6141,0x0000,
-	0x0000,0x0000,0x0000,0xC2C3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xBB02,0xBB02,0xBAE2,0xBAC2,0xBAA2,0xB2A2,0xB282,0xB262,
-	0xAA41,0xAA41,0xAA42,0xAA42,0xAA42,0xAA42,0xB242,0xB242,
-	0xBA82,0xBA83,0xBAA3,0xC2C3,0xCAE4,0xCB04,0xD324,0xD344,
-	0xDB64,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xE3E5,0xE405,0xE425,
-	0xE405,0xE404,0xE424,0xE444,0xE444,0xE443,0xDC43,0xDC43,
-	0xDC23,0xDC23,0xD403,0xDBE4,0xDBC4,0xDBC4,0xE3E4,0xE3E4,
-	0xEC24,0xEC63,0xF4C2,0xF4C2,0xECC2,0xECA2,0xE463,0xDC04,
-	0xDC05,0xDC05,0xDC04,0xDC25,0xDC05,0xE425,0xE446,0xEC87,
-	0xF487,0xEC67,0xECA7,0xECA6,0xECA6,0xECA6,0xEC85,0xEC85,
-	0xECA5,0xECC5,0xECC6,0xECE6,0xECE6,0xF4E6,0xED06,0xF526,
-	0xED25,0xED45,0xED25,0xECE5,0xECA6,0xEC85,0xE465,0xE445,
-	0xE425,0xE405,0xE3E5,0xE3E5,0xEC06,0xEC46,0xF487,0xFCA8,
-	0xFD08,0xFD87,0xFE06,0xF605,0xED65,0xECC5,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF566,0xED26,0xF528,0xF569,0xF5AC,0xF5EE,0xF652,
-	0xFEB5,0xFF7A,0xFFDE,0xFFBD,0xFF59,0xF673,0xF5CD,0xF60E,
-	0xF5ED,0xFDA9,0xFDC9,0xFE09,0xFE29,0xFDE8,0xF5C7,0xF587,
-	0xF588,0xF587,0xED86,0xED86,0xF586,0xF587,0xF5A8,0xFDC9,
-	0xFDC9,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF587,
-	0xF587,0xF587,0xF587,0xF5A9,0xF5EC,0xF62F,0xFE71,0xFEB2,
-	0xFED3,0xFED3,0xFEB3,0xFED5,0xFEB5,0xFE53,0xF610,0xF62F,
-	0xF62F,0xF64E,0xF62E,0xF64C,0xF66B,0xFE6A,0xFE2A,0xFDC9,
-	0xFD69,0xF527,0xF4E6,0xECE6,0xECC6,0xECC6,0xF4E6,0xECE6,
-	0xED26,0xF566,0xF5C6,0xF5E6,0xFDC7,0xF5C8,0xFD8A,0xF58A,
-	0xA181,0xA1A1,0xA1A1,0xA1C1,0xA9C1,0xA9C1,0xA9E2,0xAA21,
-	0xB221,0xB221,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA62,
-	0xBA82,0xBA82,0xBA82,0xBAC1,0xC2E2,0xC341,0xCB82,0xD3C2,
-	0xD3C2,0xD3A2,0xCB42,0xC301,0xC2E1,0xC2E2,0xC2E2,0xC2C2,
-	0xC2C2,0xC2A2,0xC2A2,0xC2A2,0xC2A3,0xC2A3,0x6961,0x2080,
-	0x0000,0x0000,0x38E0,0xC2C3,0xC2E3,0xC303,0xC2E3,0xC303,
-	0xC302,0xC302,0xC302,0xBAE2,0xBAC2,0xB2A2,0xB282,0xB262,
-	0xB262,0xAA42,0xAA42,0xAA42,0xAA42,0xAA42,0xB242,0xB263,
-	0xBA83,0xBA83,0xBAA3,0xC2C3,0xCAE4,0xCB04,0xD324,0xD344,
-	0xD365,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xE405,0xE405,0xE405,
-	0xE425,0xE425,0xE424,0xE444,0xE444,0xE444,0xDC43,0xDC43,
-	0xDC43,0xD423,0xDC03,0xDBE4,0xDBC4,0xDBC4,0xE3C4,0xE3E5,
-	0xEC24,0xEC63,0xF4A2,0xF4C2,0xF4C2,0xECA2,0xE463,0xDC04,
-	0xDC05,0xDC05,0xDC04,0xDC25,0xDC25,0xE425,0xE446,0xEC86,
-	0xF487,0xEC87,0xECA7,0xECC6,0xECC6,0xECA5,0xECA6,0xECA6,
-	0xECA5,0xECC5,0xECE6,0xECE6,0xECE6,0xECE6,0xF506,0xF526,
-	0xED25,0xED45,0xED25,0xECE5,0xECA6,0xEC86,0xE465,0xE445,
-	0xE425,0xE405,0xE3E5,0xE3E5,0xEC06,0xEC46,0xF487,0xFCA8,
-	0xFD08,0xFD87,0xFE06,0xF605,0xF565,0xECC5,0xEC86,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF566,0xED26,0xF527,0xF549,0xF58B,0xF5CE,0xFE31,
-	0xFEB4,0xFF5A,0xFFDD,0xFFDD,0xFF5A,0xF694,0xF5EE,0xF60E,
-	0xF5ED,0xFDA9,0xFDC9,0xFE09,0xFE29,0xFDE8,0xF5C7,0xF587,
-	0xF588,0xF5A8,0xF586,0xED86,0xF586,0xF587,0xF588,0xFDC9,
-	0xF5A9,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF5A7,
-	0xF587,0xF587,0xF587,0xF5A9,0xF5CC,0xF60F,0xFE71,0xFEB2,
-	0xFED2,0xFED3,0xFEB3,0xFED5,0xFED6,0xFE73,0xF610,0xF62F,
-	0xF64E,0xF62E,0xF62E,0xF62C,0xFE4B,0xFE6A,0xFE2A,0xFDCA,
-	0xFD89,0xF527,0xF506,0xECE6,0xECE6,0xECE6,0xECE6,0xED06,
-	0xED26,0xF586,0xF5C6,0xF5E6,0xF5E7,0xF5A8,0xFD89,0xF56B,
-	0xA181,0xA181,0xA1A1,0xA1A1,0xA1C1,0xA9C1,0xA9E1,0xAA01,
-	0xB221,0xB221,0xB241,0xB241,0xB262,0xB261,0xBA62,0xBA82,
-	0xBA81,0xBA81,0xBA81,0xBAA1,0xBAC2,0xC301,0xCB41,0xD3A2,
-	0xD3E2,0xD3C2,0xCB82,0xCB21,0xC301,0xCAE2,0xCAE2,0xC2E2,
-	0xC2C2,0xC2C2,0xC2C2,0xC2A2,0xC2A2,0xC2A3,0xC2A3,0xC2C3,
-	0xBA83,0x89E2,0xAA83,0xC2E3,0xC2E3,0xC303,0xC2E3,0xC2E3,
-	0xC303,0xC302,0xC302,0xBAE2,0xBAC2,0xB2A2,0xB282,0xB262,
-	0xB262,0xAA42,0xAA42,0xAA42,0xAA42,0xAA42,0xB242,0xB263,
-	0xBA82,0xBA83,0xBAA3,0xC2C3,0xC2E3,0xCB04,0xD324,0xD344,
-	0xD364,0xDB85,0xDBA5,0xDBC5,0xE3E5,0xE405,0xE405,0xE405,
-	0xE425,0xE425,0xE424,0xE444,0xE444,0xE444,0xDC43,0xDC43,
-	0xDC43,0xD423,0xDC03,0xDC03,0xDBE4,0xDBC4,0xE3E4,0xE3E4,
-	0xEC24,0xEC63,0xF4A3,0xF4C2,0xF4C2,0xECC2,0xE483,0xDC24,
-	0xDC05,0xDC05,0xDC24,0xDC25,0xDC25,0xE425,0xE446,0xEC86,
-	0xF487,0xF487,0xEC86,0xECC6,0xECC6,0xECC6,0xECA6,0xECA6,
-	0xECA5,0xECC5,0xECE6,0xECE6,0xECE6,0xECE6,0xF506,0xF526,
-	0xED45,0xED45,0xED25,0xECE5,0xECC5,0xEC86,0xE465,0xE445,
-	0xE425,0xE405,0xE3E5,0xE3E5,0xEC06,0xEC46,0xF487,0xFCC8,
-	0xFD08,0xFD87,0xFE07,0xF605,0xF565,0xECC5,0xEC86,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xF5A6,0xF566,0xED27,0xF527,0xF548,0xF58B,0xF5CD,0xF610,
-	0xFE94,0xFF5A,0xCE58,0xC5F7,0x9CD2,0x7BEF,0x7BEF,0x7BEF,
-	0x7BEF,0x7BEF,0x83EF,0xBD0C,0xBD0C,0xEDA9,0xF5C7,0xF587,
-	0xF5A8,0xF5A8,0xF586,0xF586,0xF586,0xF587,0xF5A8,0xFDC9,
-	0xFDC9,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF587,
-	0xF587,0xF587,0xF5A7,0xF5A9,0xF5EC,0xF60F,0xFE51,0xF6B2,
-	0xFED3,0xEE72,0xBD51,0xDE14,0xFEB5,0xFE73,0xF630,0xF62F,
-	0xF62F,0xF62F,0xF62E,0xF62C,0xFE4B,0xFE6B,0xFE2A,0xFDCA,
-	0xFD89,0xF547,0xF527,0xED06,0xECE6,0xECE6,0xF4E6,0xED06,
-	0xED46,0xF586,0xF5E6,0xF5E6,0xF5E7,0xF5A8,0xFD89,0xFD6B,
-	0xA181,0xA181,0xA181,0xA1A1,0xA1A1,0xA9C1,0xA9C1,0xA9E1,
-	0xAA01,0xAA21,0xB221,0xB241,0xB242,0xB262,0xBA62,0xBA62,
-	0xBA81,0xBA81,0xBA82,0xBA82,0xBAA2,0xC2E2,0xC321,0xCB82,
-	0xD3C2,0xD3E2,0xD3A1,0xCB62,0xCB02,0xC301,0xCAE1,0xC2C1,
-	0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2A2,0xC2A3,0xC2C3,
-	0xC2C3,0xC2C4,0xCAC3,0xC2E3,0xC303,0xC303,0xC2E3,0xC2E3,
-	0xC303,0xC302,0xC302,0xC302,0xBAE2,0xBAC2,0xBAA2,0xB282,
-	0xB262,0xB262,0xB262,0xAA42,0xB242,0xAA42,0xB242,0xB242,
-	0xBA62,0xBA82,0xC2A3,0xC2C3,0xC2E4,0xCB04,0xD324,0xD344,
-	0xD364,0xDB85,0xDBA5,0xE3C5,0xE3E5,0xE405,0xE405,0xE425,
-	0xE425,0xE425,0xE425,0xE444,0xE444,0xE444,0xE464,0xDC43,
-	0xDC43,0xDC23,0xD423,0xD403,0xDBE4,0xDBE4,0xE3E4,0xE405,
-	0xE404,0xEC64,0xF4A2,0xF4C2,0xF4E2,0xECC2,0xE483,0xDC24,
-	0xDC04,0xDC04,0xDC04,0xDC25,0xE425,0xE425,0xE446,0xEC66,
-	0xF487,0xF487,0xECA6,0xECA6,0xECC6,0xECC6,0xECA6,0xECA6,
-	0xECA6,0xECC5,0xECE6,0xECE6,0xECE6,0xF4E6,0xF506,0xF526,
-	0xF545,0xF545,0xED45,0xED05,0xECC5,0xECA5,0xEC85,0xE465,
-	0xE425,0xE405,0xE405,0xE3E5,0xEC06,0xEC46,0xF487,0xF4C8,
-	0xFD08,0xFD67,0xFE07,0xF605,0xF565,0xECC5,0xEC85,0xEC65,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFD07,0xFD28,0xFD67,0xF5A6,
-	0xF5A6,0xF546,0xF506,0xF506,0xF548,0xF56A,0xACAE,0x73B0,
-	0x326D,0x00C6,0x0042,0x0021,0x0063,0x0129,0x09F0,0x0A10,
-	0x09F2,0x0A36,0x0236,0x01F6,0x01D6,0x0217,0x1A77,0x4334,
-	0x8C2F,0xD529,0xED86,0xF586,0xF586,0xF5A7,0xF5A8,0xFDC9,
-	0xFDC9,0xF5C8,0xF5A8,0xF5C7,0xF5C7,0xF5A7,0xF5A7,0xF5A7,
-	0xF587,0xF587,0xF5A7,0xF5A9,0xF5CB,0xF60E,0xFE71,0x42AE,
-	0x012D,0x012D,0x014C,0x7BF0,0xFEB6,0xFE73,0xF630,0xF62F,
-	0xF64F,0xF62F,0xF62E,0xF62D,0xF64C,0xFE8B,0xFE4A,0xFDEA,
-	0xFD89,0xF547,0xF527,0xED06,0xECE6,0xECE6,0xECE6,0xED26,
-	0xED46,0xF5A6,0xF5E6,0xF5E6,0xF5E7,0xF5A8,0xFD8A,0xFD6B,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA1A2,0xA9C1,0xA9E1,
-	0xAA02,0xAA22,0xB221,0xB221,0xB242,0xB262,0xBA62,0xBA62,
-	0xBA81,0xBA61,0xBA81,0xBA81,0xBA82,0xBAA2,0xC2E2,0xCB21,
-	0xD382,0xD3C2,0xD3C2,0xD382,0xCB42,0xCB21,0xC301,0xCAE1,
-	0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C2,0xC2A3,0xC2A3,0xC2C3,
-	0xC2A3,0xC2C3,0xC2C3,0xC2E3,0xC303,0xC2E3,0xC2E3,0xC303,
-	0xC303,0xC302,0xC322,0xBB02,0xBAE2,0xBAC2,0xBAA2,0xB282,
-	0xB262,0xB262,0xB262,0xB242,0xAA42,0xB242,0xB242,0xB262,
-	0xB262,0xBA82,0xBAA3,0xC2C3,0xC2E4,0xCB04,0xCB24,0xD344,
-	0xD364,0xDB65,0xDB85,0xDBC5,0xE3E5,0xE405,0xE405,0xE425,
-	0xE425,0xE425,0xE425,0xE444,0xE444,0xE444,0xE463,0xDC43,
-	0xDC43,0xDC43,0xDC23,0xDC04,0xDBE4,0xDBE4,0xDBE4,0xE3E5,
-	0xEC24,0xEC44,0xF483,0xF4C2,0xF4E2,0xECC2,0xEC83,0xE444,
-	0xDC24,0xDC05,0xDC04,0xDC25,0xE425,0xE425,0xE446,0xEC66,
-	0xEC87,0xF487,0xEC87,0xF4C6,0xECE6,0xECE6,0xECC6,0xECA5,
-	0xECA6,0xECC5,0xECE6,0xECE6,0xF4E6,0xF4E6,0xED06,0xF526,
-	0xED46,0xF565,0xED65,0xED25,0xECC5,0xECA5,0xEC85,0xE465,
-	0xE425,0xE425,0xE405,0xE3E5,0xE405,0xEC46,0xF487,0xF4C8,
-	0xFD08,0xFD67,0xFDE7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFD07,0xFD28,0xFD67,0xFDA6,
-	0xF5A6,0xF566,0xF506,0xF506,0x9C4E,0x2AF4,0x0A53,0x0A11,
-	0x018D,0x00E6,0x0042,0x0021,0x0063,0x0108,0x09EF,0x01F1,
-	0x09F1,0x0A56,0x0236,0x01F6,0x01D6,0x0218,0x0A58,0x0A58,
-	0x0A57,0x0A78,0x4B34,0xBCCB,0xF5A6,0xF5A7,0xF5A8,0xFDC9,
-	0xFDC9,0xF5C8,0xF5A8,0xF5C7,0xF5C7,0xF5A7,0xF5A7,0xF5A7,
-	0xF5A7,0xF587,0xF587,0xF5A9,0xF5EB,0xFE2E,0xFE51,0x016D,
-	0x012D,0x012D,0x014C,0x7BF0,0xFEB6,0xFE73,0xF630,0xF630,
-	0xF64F,0xF64F,0xF62E,0xF62D,0xF64C,0xFE8B,0xFE4A,0xFDEA,
-	0xFD89,0xF548,0xF506,0xED06,0xECE6,0xECE5,0xED06,0xED26,
-	0xF566,0xF5A6,0xF5E6,0xFE06,0xF5E7,0xF5A9,0xFD8A,0xFD6B,
-	0xA181,0xA181,0xA181,0xA181,0xA181,0xA1A1,0xA1A1,0xA1C1,
-	0xAA02,0xAA02,0xAA21,0xB221,0xB241,0xB242,0xB262,0xB261,
-	0xBA61,0xBA82,0xBA82,0xBA81,0xBA81,0xBA81,0xC2C1,0xC2E1,
-	0xCB42,0xD3A2,0xDBC2,0xD3A2,0xD382,0xCB41,0xCB22,0xCAE2,
-	0xCAE2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xC2C3,0xC2C3,0xC2C3,
-	0xC2A3,0xC2A3,0xC2C3,0xC2E3,0xCAE3,0xC2E3,0xC303,0xC303,
-	0xC303,0xC323,0xC323,0xC302,0xBAE2,0xBAC2,0xBAA2,0xB2A2,
-	0xB282,0xB282,0xB262,0xB262,0xB242,0xB242,0xB242,0xB262,
-	0xBA62,0xBA82,0xBAA3,0xC2C3,0xC2C3,0xCAE4,0xCB24,0xD324,
-	0xD344,0xDB65,0xDB85,0xDBC5,0xE3E5,0xE405,0xE405,0xE425,
-	0xE425,0xE425,0xE425,0xE465,0xE444,0xE464,0xE464,0xE463,
-	0xDC63,0xDC43,0xDC23,0xDC04,0xDC04,0xDBE4,0xDBE4,0xE3E5,
-	0xEC04,0xEC44,0xF4A3,0xF4C2,0xF4E2,0xECC2,0xECA3,0xE464,
-	0xDC24,0xDC25,0xDC04,0xDC25,0xE425,0xE425,0xE445,0xEC66,
-	0xEC87,0xF487,0xEC87,0xECC6,0xECE6,0xECE6,0xECC6,0xECA6,
-	0xECC6,0xECC6,0xECE6,0xECE6,0xF4E6,0xF4E6,0xED06,0xF526,
-	0xED46,0xF565,0xF565,0xED25,0xECE5,0xECA5,0xEC85,0xE465,
-	0xE445,0xE425,0xE3E5,0xE3E5,0xE405,0xEC46,0xF487,0xF4C8,
-	0xFD08,0xFD67,0xFDE7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC65,0xEC45,0xEC65,0xF4A6,0xFD07,0xFD28,0xFD67,0xFDA6,
-	0xF586,0xF546,0xC4AA,0x3B55,0x0AD8,0x0A96,0x0A74,0x0A11,
-	0x01AD,0x00E7,0x0042,0x0000,0x0042,0x00E7,0x09CE,0x01F0,
-	0x09F1,0x0A56,0x0236,0x01F6,0x01D7,0x0218,0x0A58,0x0A78,
-	0x0A77,0x0A57,0x0A79,0x0A59,0x5373,0xE568,0xF5A8,0xFDA9,
-	0xFDC9,0xF5C8,0xF5A8,0xF5C7,0xF5C7,0xF5A7,0xF5A7,0xF5A7,
-	0xF5A7,0xF5A7,0xF588,0xF5A9,0xF5CB,0xFE0E,0xFE50,0x016D,
-	0x012D,0x012D,0x014C,0x7BEF,0xFEB5,0xFE73,0xF630,0xF62F,
-	0xF64F,0xF64F,0xF62E,0xF64D,0xFE6C,0xFE8B,0xFE4B,0xFDEA,
-	0xFD89,0xF548,0xF506,0xED06,0xECE6,0xECE6,0xED06,0xF526,
-	0xF546,0xF5A6,0xF5E6,0xFE06,0xF5E7,0xF5A8,0xFD8A,0xFD6B,
-	0xA1A1,0xA181,0xA181,0xA181,0xA181,0xA1A1,0xA1A2,0xA1C2,
-	0xA9E2,0xAA02,0xAA22,0xB222,0xB221,0xB241,0xB241,0xB261,
-	0xBA61,0xBA81,0xBA82,0xBA81,0xBA82,0xBA81,0xC2A1,0xC2C1,
-	0xCB22,0xCB82,0xD3C1,0xDBE2,0xD3A2,0xD362,0xCB42,0xCB02,
-	0xCAE2,0xCAE2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C3,0xC2C3,
-	0xC2A3,0xC2A3,0xC2C3,0xCAE3,0xCB03,0xC2E3,0xC303,0xCB03,
-	0xC303,0xC323,0xC322,0xC302,0xBB02,0xBAE2,0xBAC2,0xB2A2,
-	0xB282,0xB282,0xB262,0xB262,0xB242,0xB242,0xB242,0xB262,
-	0xBA62,0xBA62,0xBAA3,0xC2C3,0xC2C3,0xCAE4,0xCB04,0xD324,
-	0xD344,0xDB65,0xDB85,0xDBC5,0xE3E5,0xE405,0xE405,0xE426,
-	0xE425,0xE425,0xE425,0xE445,0xE464,0xE464,0xE464,0xDC63,
-	0xDC63,0xDC43,0xDC43,0xDC23,0xDC04,0xDBE4,0xE3E4,0xE3E5,
-	0xE404,0xEC44,0xF483,0xF4C2,0xF4E2,0xF4E2,0xECC3,0xE464,
-	0xDC24,0xDC25,0xDC25,0xE425,0xE425,0xE425,0xE445,0xEC66,
-	0xEC87,0xF487,0xF487,0xECA7,0xECE6,0xECE6,0xECC6,0xECC6,
-	0xECC6,0xECC6,0xECE6,0xECE6,0xF4E6,0xF4E6,0xF506,0xF526,
-	0xF546,0xF565,0xF565,0xED25,0xECE5,0xECA5,0xECA5,0xE465,
-	0xE445,0xE425,0xE3E5,0xE3E5,0xE405,0xEC46,0xF487,0xF4C8,
-	0xFD08,0xFD68,0xF5E7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC65,0xEC45,0xEC65,0xF4A7,0xFD07,0xFD28,0xF567,0xFDA6,
-	0xF5A6,0xC4EA,0x1AF8,0x0AF9,0x0AD8,0x12B7,0x0A75,0x0A32,
-	0x01CE,0x0108,0x0042,0x0000,0x0042,0x00E7,0x09AD,0x09EF,
-	0x09F1,0x0A56,0x0A36,0x01F6,0x01D6,0x0A18,0x0A58,0x0A78,
-	0x0A77,0x0A57,0x0A78,0x0A59,0x0A79,0x32F5,0xE589,0xFDC9,
-	0xFDC9,0xF5C8,0xF5A8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF5A7,
-	0xF5A7,0xF5A7,0xF588,0xF5A8,0xF5CB,0xF60E,0xFE51,0x016D,
-	0x012D,0x012D,0x014D,0x7BEF,0xFED5,0xFE73,0xF630,0xF62F,
-	0xF64F,0xF64F,0xF62E,0xF64D,0xF66C,0xFE8C,0xFE4B,0xFDEA,
-	0xFD89,0xF548,0xF527,0xED06,0xECE6,0xECE6,0xF506,0xF526,
-	0xF566,0xF5A6,0xF5E6,0xFE06,0xF5E7,0xF5A9,0xFD8A,0xFD6B,
-	0xA1A2,0xA181,0xA181,0xA181,0xA181,0xA1A1,0xA1A1,0xA1C2,
-	0xA9E1,0xAA02,0xAA02,0xAA21,0xB221,0xB241,0xB242,0xB261,
-	0xB262,0xB281,0xBA82,0xBA81,0xBA81,0xBAA1,0xBAA1,0xBAA1,
-	0xC2E2,0xCB42,0xD3A2,0xDBE2,0xD3E2,0xD3A1,0xCB62,0xCB22,
-	0xCB01,0xCB01,0xCAE2,0xCAE2,0xC2E2,0xC2E2,0xC2E3,0xC2C3,
-	0xC2C3,0xCAC4,0xCAC4,0xCAE3,0xCAE3,0xCAE3,0xCAE3,0xCAE3,
-	0xCB03,0xC303,0xC303,0xC322,0xBB02,0xBAE2,0xBAC2,0xBAC2,
-	0xB282,0xB282,0xB282,0xB262,0xB242,0xB242,0xB242,0xB242,
-	0xB282,0xBA82,0xBAA3,0xC2C3,0xC2E3,0xCB03,0xCB04,0xCB24,
-	0xD344,0xDB64,0xDB85,0xDBC5,0xE3E5,0xE405,0xE405,0xE445,
-	0xE445,0xE445,0xE445,0xE445,0xE464,0xE464,0xE464,0xDC63,
-	0xDC63,0xDC43,0xDC43,0xDC23,0xDC04,0xDBE4,0xDBE4,0xE3E5,
-	0xE404,0xEC44,0xF483,0xF4A2,0xF4E2,0xF4E2,0xECC3,0xE483,
-	0xDC44,0xDC04,0xDC04,0xE425,0xE425,0xE425,0xE425,0xE466,
-	0xEC87,0xF487,0xF487,0xF4A7,0xF4C7,0xECE6,0xECC6,0xECC6,
-	0xECC6,0xECC6,0xECE6,0xED06,0xF506,0xED06,0xF526,0xF526,
-	0xF546,0xF565,0xED65,0xED45,0xECE5,0xECC5,0xEC85,0xEC85,
-	0xE465,0xE425,0xE405,0xE405,0xE405,0xEC46,0xF487,0xFCC8,
-	0xFD08,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC65,0xEC45,0xEC66,0xF4A7,0xFCE7,0xFD28,0xF567,0xF5A6,
-	0xC4EA,0x1AD8,0x0AF9,0x12F9,0x12D8,0x0AB7,0x0A76,0x0A33,
-	0x09CF,0x0109,0x0042,0x0000,0x0021,0x00C6,0x09AD,0x09CF,
-	0x09D1,0x0A55,0x0236,0x01F6,0x09F7,0x0A18,0x0A38,0x0A78,
-	0x0A77,0x0A58,0x0A79,0x1259,0x0A79,0x0A58,0x32F4,0xED8A,
-	0xFDC9,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF5A7,
-	0xF5A7,0xF5A7,0xF5A8,0xF5A8,0xF5CB,0xF60E,0xFE50,0x014D,
-	0x012C,0x012D,0x014C,0x7BEF,0xFED6,0xFE94,0xF631,0xF62F,
-	0xF66F,0xF66F,0xF64F,0xF64E,0xFE6C,0xFEAB,0xFE6B,0xFDEA,
-	0xFD89,0xF547,0xF527,0xED06,0xECE6,0xECE6,0xF506,0xF526,
-	0xF566,0xF5A6,0xFE06,0xF607,0xF5E7,0xFDA9,0xFD8A,0xFD6B,
-	0xA1A1,0xA181,0xA181,0xA181,0xA181,0xA1A1,0xA1A1,0xA1C1,
-	0xA9E2,0xA9E2,0xAA02,0xAA22,0xAA21,0xB221,0xB242,0xB242,
-	0xB262,0xB262,0xBA81,0xBA82,0xBA82,0xBA81,0xBAA1,0xBAA1,
-	0xC2C2,0xC302,0xD362,0xD3C2,0xDBE2,0xD3C2,0xD382,0xCB41,
-	0xCB22,0xCB01,0xCAE2,0xC2E2,0xC2E2,0xC2E2,0xC2E3,0xC2C3,
-	0xC2C3,0xC2C3,0xCAE3,0xCAE3,0xCAE3,0xCAE3,0xCAE3,0xCB03,
-	0xCB03,0xCB23,0xCB23,0xC323,0xC322,0xC302,0xBAE2,0xBAC2,
-	0xB2A2,0xB282,0xB282,0xB262,0xB262,0xB242,0xB242,0xB242,
-	0xB282,0xBA82,0xBAA2,0xC2C3,0xC2E3,0xCB03,0xCB04,0xCB24,
-	0xD344,0xD364,0xDB85,0xDBA5,0xE3E5,0xE405,0xE425,0xE425,
-	0xE445,0xE425,0xE445,0xE445,0xE464,0xE464,0xE464,0xE483,
-	0xDC63,0xDC63,0xDC43,0xDC23,0xDC23,0xDBE4,0xDBE4,0xE3E5,
-	0xE404,0xEC44,0xF483,0xF4C2,0xF4C2,0xF4E2,0xECC3,0xE483,
-	0xE444,0xDC04,0xDC04,0xE425,0xE425,0xE425,0xE425,0xEC66,
-	0xEC87,0xEC87,0xF487,0xF4A7,0xF4C7,0xF4E6,0xECC6,0xECC5,
-	0xECC6,0xECC6,0xECE6,0xED06,0xF506,0xED06,0xF526,0xF526,
-	0xF546,0xF565,0xF565,0xED45,0xED05,0xECC5,0xEC85,0xEC85,
-	0xE465,0xE425,0xE405,0xE405,0xE405,0xEC46,0xF487,0xF4E8,
-	0xFD08,0xFD68,0xF5E7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC66,0xEC65,0xEC66,0xF4A7,0xFCE7,0xFD08,0xF567,0xF5A6,
-	0x32F5,0x0AB9,0x0AF9,0x12F9,0x12D8,0x0AD7,0x0A96,0x0A53,
-	0x09D0,0x0129,0x0062,0x0000,0x0021,0x00C5,0x098C,0x09EF,
-	0x09F1,0x0A56,0x0A36,0x01F6,0x09D7,0x0A18,0x0A38,0x0A78,
-	0x0A57,0x0A78,0x0A78,0x0A59,0x0A79,0x0A78,0x0A57,0x73B0,
-	0xFDC9,0xFDC8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF5A7,
-	0xF5A7,0xF5A8,0xF5A8,0xF5A8,0xF5CA,0xFE0D,0xFE50,0x014D,
-	0x012D,0x012D,0x012C,0x7BF0,0xFED5,0xFE94,0xFE51,0xF630,
-	0xF64F,0xF66F,0xFE4F,0xF62E,0xFE6C,0xCDAD,0x3292,0x32B3,
-	0xED69,0xF548,0xF527,0xED06,0xECE6,0xED06,0xF506,0xF526,
-	0xF566,0xF5C6,0xF606,0xF607,0xF5E8,0xFDA9,0xFD8A,0xFD6B,
-	0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1A2,
-	0xA1C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xB242,0xB242,
-	0xB262,0xB262,0xBA62,0xBA81,0xBA81,0xBA82,0xBA81,0xBAA2,
-	0xBAC2,0xC2E1,0xCB42,0xD3A2,0xDBC2,0xDBC2,0xD3A2,0xD362,
-	0xCB42,0xCB22,0xCAE2,0xCAE2,0xCAE2,0xCAE2,0xCAE2,0xCAE3,
-	0xCAC3,0xC2C3,0xCAC3,0xCAE3,0xCAE3,0xCAE3,0xCB03,0xCB03,
-	0xCB03,0xCB23,0xC323,0xC323,0xC323,0xC302,0xC2E2,0xBAE2,
-	0xBAA2,0xBAA2,0xB282,0xB282,0xB262,0xB262,0xB262,0xB262,
-	0xB282,0xBA82,0xBAA2,0xC2C3,0xC2C3,0xC2E3,0xCB04,0xCB24,
-	0xD344,0xD365,0xDB85,0xDBA5,0xE3E5,0xE405,0xE425,0xE445,
-	0xEC45,0xEC45,0xE445,0xE465,0xE464,0xE464,0xE484,0xE483,
-	0xDC83,0xDC63,0xDC43,0xDC43,0xDC24,0xDC04,0xDBE4,0xE3E4,
-	0xE405,0xEC25,0xF463,0xF4A2,0xF4C2,0xF4E2,0xECC3,0xE4A4,
-	0xE464,0xDC24,0xE424,0xE424,0xE425,0xE425,0xE445,0xE446,
-	0xEC87,0xF4A7,0xF487,0xF4A7,0xF4E6,0xF4E6,0xECE6,0xECC6,
-	0xECE6,0xECE6,0xECE6,0xED06,0xF506,0xF506,0xF527,0xF546,
-	0xF546,0xF566,0xF585,0xF566,0xED25,0xECC5,0xECA5,0xEC85,
-	0xE465,0xE445,0xE405,0xE405,0xE406,0xEC27,0xF487,0xF4E8,
-	0xFD08,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xEC86,0xEC86,
-	0xEC65,0xEC66,0xEC66,0xF4A7,0xFCE8,0xFD28,0xF567,0x9C6D,
-	0x0A79,0x0AB9,0x0AF9,0x0B19,0x0AF8,0x0AD7,0x0A96,0x0A54,
-	0x09F0,0x014A,0x0063,0x0000,0x0021,0x00A4,0x018B,0x01CE,
-	0x09D1,0x0A56,0x32D4,0x7BEF,0x73B1,0x42F4,0x2AB6,0x0A78,
-	0x0A77,0x0A78,0x0A78,0x0A59,0x0A59,0x0A78,0x0257,0x0236,
-	0xBCEC,0xFDC8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5A7,0xF5A7,
-	0xF5A7,0xF5A8,0xF5A8,0xF5A8,0xF5CA,0xF60D,0xFE4F,0x016E,
-	0x012D,0x012D,0x014D,0x7BEF,0xFED5,0xFE94,0xFE51,0xF650,
-	0xF66F,0xF66F,0xFE4F,0xF64E,0xCD8D,0x11B3,0x0194,0x01F5,
-	0x32F4,0xE529,0xF547,0xF506,0xED06,0xED06,0xF506,0xED26,
-	0xF586,0xF5E6,0xFE26,0xFE07,0xFDE8,0xF5A9,0xF58A,0xFD6B,
-	0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A2,0xA1A2,0xA1A2,
-	0xA1C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xB222,0xB241,
-	0xB242,0xB242,0xB262,0xBA81,0xBA81,0xBA82,0xBA81,0xBAA2,
-	0xBAA1,0xC2E2,0xCB21,0xD362,0xD3A2,0xDBC2,0xDBC2,0xD381,
-	0xCB62,0xCB22,0xCB02,0xCAE2,0xCAE2,0xCAE2,0xCAE2,0xCAE3,
-	0xCAC3,0xC2C3,0xCAC3,0xCAE3,0xCAE3,0xCB03,0xCB03,0xCB04,
-	0xCB23,0xCB23,0xCB23,0xC323,0xC322,0xC302,0xC302,0xBAE2,
-	0xBAC2,0xBAA2,0xB282,0xB282,0xB282,0xB282,0xB262,0xB262,
-	0xB282,0xBA82,0xBA82,0xC2C3,0xC2C3,0xC2E3,0xCB04,0xCB24,
-	0xD344,0xD365,0xDB65,0xDBA5,0xE3E5,0xE405,0xE425,0xE445,
-	0xEC45,0xEC45,0xEC45,0xE465,0xE465,0xE484,0xE484,0xE483,
-	0xE483,0xDC63,0xDC43,0xDC43,0xDC24,0xDC04,0xDBE4,0xE3E5,
-	0xE405,0xEC24,0xF463,0xF4A2,0xF4C2,0xF4E2,0xECC3,0xE4C4,
-	0xDC64,0xDC24,0xDC24,0xDC25,0xE425,0xE425,0xE445,0xE445,
-	0xEC86,0xF4A7,0xF487,0xF4A7,0xF4C6,0xF4E6,0xECE6,0xECC6,
-	0xECE6,0xECE6,0xED06,0xED06,0xF506,0xF506,0xF527,0xF546,
-	0xF546,0xF586,0xF585,0xF565,0xED25,0xECE5,0xECA5,0xEC85,
-	0xE465,0xE445,0xE405,0xE405,0xE405,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xECA6,0xEC86,
-	0xEC65,0xEC66,0xEC66,0xF4A7,0xFCE8,0xFD28,0xF567,0x22B7,
-	0x0A79,0x0AB9,0x12F9,0x0B19,0x0AF8,0x12D7,0x2AF5,0x8C2F,
-	0xBCEF,0xFEB5,0xFF9C,0xFFFF,0xCE79,0x8C71,0x220C,0x09CE,
-	0x09F0,0x0A36,0x0236,0x9C8E,0xF628,0xF5E8,0xF5C7,0xD529,
-	0x9C4D,0x32F5,0x0A58,0x0A59,0x0A79,0x0A58,0x0257,0x0236,
-	0x5352,0xF5C8,0xFDC8,0xF5C7,0xF5C7,0xF5A6,0xF5A7,0xFDC7,
-	0xF5A7,0xF5A8,0xF5A8,0xF5A8,0xF5CA,0xF5ED,0xFE4F,0x016E,
-	0x012D,0x012D,0x014D,0x7BEF,0xFED5,0xFE94,0xFE51,0xF64F,
-	0xF66F,0xF66F,0xF64F,0xCD6E,0x11D2,0x0153,0x0194,0x01F5,
-	0x0256,0x1AB6,0xF547,0xF526,0xED06,0xED06,0xED06,0xF526,
-	0xF586,0xF5E6,0xFE27,0xFE07,0xFDE8,0xFDA9,0xF58A,0xFD6B,
-	0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A2,
-	0xA9C2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xB222,
-	0xB242,0xB262,0xB262,0xB262,0xBA82,0xBA82,0xBAA2,0xBAA1,
-	0xBAA1,0xC2C2,0xC301,0xCB41,0xD3A2,0xDBC2,0xDBE2,0xD3C2,
-	0xD382,0xCB41,0xCB01,0xCAE2,0xCAE2,0xCAE2,0xCAE2,0xCAE2,
-	0xCAE3,0xCAC3,0xCAC3,0xCAC3,0xCB04,0xCB03,0xCB03,0xCB24,
-	0xCB23,0xCB23,0xCB23,0xCB23,0xC322,0xC302,0xC302,0xBAE3,
-	0xBAC2,0xBAA2,0xB282,0xB282,0xB282,0xB282,0xB282,0xB262,
-	0xB282,0xBA82,0xBA83,0xBAA3,0xC2C3,0xC2E3,0xCB04,0xCB24,
-	0xD345,0xD365,0xDB65,0xDBA5,0xE3E5,0xE405,0xE425,0xE445,
-	0xEC45,0xEC45,0xEC45,0xE465,0xE465,0xE484,0xE484,0xE484,
-	0xE483,0xDC63,0xDC63,0xDC43,0xDC23,0xDC24,0xDBE4,0xDBE5,
-	0xE405,0xEC24,0xF463,0xF4A2,0xF4C2,0xF4E2,0xECE3,0xECC3,
-	0xE484,0xDC25,0xE424,0xE425,0xE445,0xE445,0xE445,0xE465,
-	0xEC66,0xF487,0xF487,0xF4A7,0xF4C6,0xF4E6,0xF4E6,0xECE6,
-	0xECE6,0xECE6,0xED06,0xED06,0xF526,0xF526,0xF527,0xF547,
-	0xF566,0xF586,0xED85,0xED65,0xED25,0xECE5,0xECA5,0xEC85,
-	0xE485,0xE445,0xE425,0xE405,0xE405,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xECA6,0xEC86,
-	0xEC65,0xEC45,0xEC65,0xF4C6,0xFD08,0xFD28,0xDD29,0x0A59,
-	0x0A79,0x0AB9,0x0AF9,0x0AF9,0x0AF9,0x63B1,0xE529,0xF58A,
-	0xFDCD,0xFEB4,0xFF9C,0xFFFF,0xFFFF,0xFF7B,0xE674,0x3A8E,
-	0x01F0,0x0255,0x0237,0x01F6,0xDD8A,0xF608,0xF5C7,0xF587,
-	0xF5A8,0xF5A8,0x7BEF,0x0A59,0x0A59,0x0A58,0x0A57,0x0236,
-	0x0236,0xF5C8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5C7,0xF5A7,
-	0xF5A7,0xF5A8,0xF5A8,0xF5A8,0xF5CA,0xF60D,0xFE4F,0x016E,
-	0x012D,0x012D,0x014D,0x7C0F,0xFEB5,0xFEB4,0xF651,0xF62F,
-	0xF66F,0xF66F,0xACEF,0x1211,0x0192,0x0173,0x0174,0x01F4,
-	0x0256,0x3314,0xF547,0xED26,0xED26,0xED06,0xF526,0xF526,
-	0xF5A6,0xF5E6,0xF626,0xFE27,0xFDE8,0xFDAA,0xFD8A,0xFD6B,
-	0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1A2,
-	0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA22,0xB222,
-	0xB242,0xB242,0xB242,0xB262,0xBA82,0xBA82,0xBA82,0xBA81,
-	0xBAA1,0xC2C1,0xC2E2,0xCB22,0xD382,0xDBC2,0xDBE2,0xDBE2,
-	0xDBA2,0xD362,0xCB22,0xCB02,0xCB02,0xCB02,0xCAE2,0xCAE2,
-	0xCAE3,0xCAE3,0xCAC3,0xCAC3,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xCB23,0xCB23,0xCB23,0xCB23,0xC323,0xC322,0xC302,0xBB02,
-	0xBAC2,0xBAC2,0xBAA2,0xB282,0xB282,0xB282,0xB282,0xB282,
-	0xB282,0xBA82,0xBA83,0xBAA3,0xC2C3,0xC2E3,0xCB03,0xCB24,
-	0xD344,0xD345,0xDB65,0xDBA5,0xDBC5,0xE406,0xE405,0xE425,
-	0xEC45,0xEC45,0xEC45,0xE465,0xE465,0xE484,0xE484,0xE4A4,
-	0xE483,0xE483,0xDC63,0xDC63,0xDC44,0xDC04,0xDC04,0xDBE4,
-	0xE3E5,0xEC25,0xF463,0xF4A3,0xF4C2,0xF4E2,0xECE3,0xECE3,
-	0xE4A4,0xDC45,0xE424,0xE425,0xE445,0xE445,0xE445,0xE465,
-	0xEC66,0xEC87,0xF4A7,0xF4A7,0xF4C7,0xF4E6,0xF506,0xECE6,
-	0xECE6,0xECE6,0xED06,0xED06,0xED06,0xF526,0xF527,0xF547,
-	0xF566,0xF586,0xF5A5,0xF586,0xED25,0xED06,0xECC5,0xECA5,
-	0xEC85,0xE445,0xE425,0xE405,0xE405,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xECA6,0xECA6,
-	0xEC65,0xEC65,0xEC65,0xF4E7,0xFD08,0xFD28,0xAC8C,0x0A59,
-	0x0A79,0x0AB9,0x0AF9,0x0AF9,0x4374,0xF507,0xF548,0xF569,
-	0xFDCD,0xFE93,0xFF7B,0xFFFF,0xFFFF,0xFF9C,0xFED6,0xEE12,
-	0x1210,0x0A35,0x0237,0x01F6,0x6371,0xF608,0xF5C7,0xF5A7,
-	0xF588,0xF5A8,0xF5A7,0x5353,0x0A59,0x0A58,0x0A37,0x0236,
-	0x0236,0xBCCC,0xF5C8,0xF5C7,0xF5C7,0xF5A7,0xF5C7,0xFDC7,
-	0xFDC7,0xFDA7,0xF5A8,0xF5A8,0xFDCA,0xF60D,0xFE4F,0x016E,
-	0x012D,0x012D,0x014D,0x7BEF,0xFEB5,0xFEB4,0xFE51,0xF62F,
-	0xF66F,0x9CAF,0x01AF,0x01D0,0x0192,0x0173,0x0173,0x01F4,
-	0x32F4,0xE549,0xF546,0xF526,0xED06,0xED06,0xF526,0xF546,
-	0xF5A6,0xF606,0xF626,0xF627,0xFDE8,0xFDA9,0xFD8A,0xFD6B,
-	0xA1C1,0xA1C1,0xA1C1,0xA1A1,0xA1A1,0xA1A1,0xA1A1,0xA1C2,
-	0xA1C2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xB222,
-	0xB242,0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA82,0xBA82,
-	0xBAA2,0xBAA2,0xC2C2,0xC302,0xCB42,0xD3A1,0xDBE1,0xDBE2,
-	0xDBC2,0xD382,0xCB42,0xCB22,0xCB01,0xCB02,0xCAE2,0xCAE2,
-	0xCAE2,0xCAE3,0xCAE3,0xCAC3,0xCB03,0xCB03,0xCB04,0xCB03,
-	0xCB23,0xCB23,0xCB23,0xCB43,0xC343,0xC322,0xC322,0xBB02,
-	0xBAE2,0xBAC2,0xBAA2,0xB2A2,0xBA82,0xB282,0xB282,0xB282,
-	0xB282,0xB282,0xBA83,0xBAA3,0xC2C3,0xC2E3,0xCB03,0xCB24,
-	0xD344,0xD365,0xDB85,0xDBA5,0xDBC5,0xE406,0xE425,0xE425,
-	0xEC45,0xEC45,0xEC65,0xEC65,0xE465,0xEC85,0xE484,0xE4A4,
-	0xE4A3,0xE483,0xE463,0xDC63,0xDC44,0xDC24,0xDC04,0xDBE4,
-	0xE3E5,0xEC24,0xF463,0xF4A3,0xF4C2,0xF4E2,0xF4E3,0xECE3,
-	0xE4A5,0xDC65,0xDC24,0xE425,0xE445,0xE445,0xE445,0xE445,
-	0xEC66,0xEC87,0xF4A7,0xF4A7,0xF4C7,0xF507,0xF506,0xF4E6,
-	0xECE6,0xECE6,0xED06,0xED06,0xED06,0xF526,0xF527,0xF547,
-	0xF566,0xF586,0xF5A5,0xED85,0xED45,0xED05,0xECC5,0xECA5,
-	0xEC85,0xE445,0xE425,0xE405,0xE405,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF5A5,0xECE5,0xECA6,0xECA6,
-	0xEC65,0xEC45,0xEC86,0xF4C7,0xFD08,0xFD28,0x8410,0x0A59,
-	0x0A79,0x0AB9,0x0AF9,0x0AF9,0xBC8B,0xF507,0xF528,0xF569,
-	0xF5CC,0xFE93,0xFF7A,0xFFFF,0xFFFF,0xFF9D,0xFED6,0xF653,
-	0x636F,0x0235,0x0237,0x01F6,0x09D7,0xF608,0xF5C7,0xF5A7,
-	0xF5A8,0xF5A7,0xF5A7,0xD549,0x0A59,0x0A58,0x0A37,0x0236,
-	0x0236,0x8C2F,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5C7,0xFDC7,
-	0xFDC7,0xFDA7,0xF5A8,0xF5A8,0xF5CA,0xF5EC,0xF62F,0x016E,
-	0x012D,0x012D,0x012C,0x7BEF,0xFEB5,0xFEB4,0xFE51,0xF62F,
-	0x9C8F,0x0990,0x01B0,0x01B0,0x0191,0x0173,0x0173,0x2AB2,
-	0xED8A,0xF568,0xF547,0xF526,0xED26,0xED06,0xF526,0xF546,
-	0xF5A6,0xF606,0xF627,0xF627,0xFDE8,0xFDA9,0xFD8A,0xFD6B,
-	0xA1E1,0xA1C1,0xA1C1,0xA1A2,0xA1A1,0xA1A1,0xA1A2,0xA1C2,
-	0xA1C2,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xB222,0xB222,0xB242,0xB242,0xB262,0xBA62,0xBA62,0xBA82,
-	0xC2A2,0xC2A2,0xC2A1,0xC2E2,0xCB22,0xD382,0xD3C1,0xDC01,
-	0xDBE1,0xDBA2,0xD362,0xCB22,0xCB02,0xCB02,0xCAE2,0xCAE2,
-	0xCAE2,0xCAE3,0xCAE3,0xCAE3,0xCAE3,0xCB03,0xCB04,0xCB03,
-	0xCB04,0xCB03,0xCB23,0xCB43,0xCB43,0xC322,0xC323,0xC322,
-	0xBB02,0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xB282,0xB282,0xB282,
-	0xB282,0xBA82,0xBA83,0xBAA3,0xC2C3,0xC2E3,0xC303,0xCB24,
-	0xD344,0xD344,0xDB85,0xDB85,0xDBC5,0xE3E5,0xE405,0xE425,
-	0xEC45,0xEC65,0xEC65,0xEC65,0xEC85,0xEC85,0xEC84,0xE4A4,
-	0xE4A3,0xDC83,0xDC83,0xDC63,0xDC43,0xDC24,0xDBE4,0xDBE5,
-	0xE3E5,0xE424,0xF463,0xF4A2,0xF4A2,0xF4C2,0xF4E3,0xECE4,
-	0xE4C4,0xDC65,0xE444,0xE444,0xE445,0xE445,0xE445,0xE465,
-	0xEC66,0xEC86,0xF4A7,0xF4A7,0xF4A7,0xF4E7,0xF506,0xED06,
-	0xF4E6,0xF4E6,0xECE6,0xED06,0xED06,0xED26,0xF527,0xF547,
-	0xF546,0xF586,0xF5A6,0xF5A5,0xF565,0xED05,0xECC5,0xECA5,
-	0xEC65,0xE445,0xE425,0xE425,0xE425,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xECA5,0xEC86,
-	0xEC65,0xEC45,0xEC86,0xF4C7,0xFD08,0xFD28,0x7BEF,0x0A39,
-	0x0A59,0x0AB9,0x0AF9,0x0B19,0xF4E6,0xF507,0xF527,0xF569,
-	0xFDAB,0xFE72,0xFF7B,0xFFDE,0xFFFF,0xFFBD,0xFEF7,0xFE73,
-	0x7BEF,0x0235,0x0216,0x01F6,0x09D7,0xBD0B,0xF5C7,0xF5A7,
-	0xF5A8,0xF5A8,0xF5A7,0xF5A6,0x0A58,0x0A38,0x0A37,0x0236,
-	0x0236,0x7BEF,0xF5C8,0xF5C7,0xF5C6,0xF5C6,0xF5C7,0xFDC7,
-	0xF5C7,0xF5C7,0xFDA8,0xF5A8,0xF5C9,0xF5EC,0xF62F,0x016E,
-	0x014D,0x012D,0x012D,0x7BEF,0xFEB5,0xFEB4,0xFE51,0x944F,
-	0x0990,0x0990,0x0990,0x01B0,0x0191,0x0152,0x5311,0xEDCC,
-	0xFDA9,0xF588,0xF567,0xF527,0xED26,0xED26,0xED26,0xF566,
-	0xF5C6,0xF606,0xF626,0xFE07,0xFDE9,0xFDAA,0xFD8A,0xFD6B,
-	0xA1E1,0xA1C1,0xA1C1,0xA1C1,0xA1A2,0xA1A1,0xA1A2,0xA1C2,
-	0xA1C2,0xA1C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xB222,0xAA22,0xB222,0xB242,0xB242,0xB262,0xBA82,0xBA82,
-	0xBAA2,0xC2A2,0xC2C2,0xC2E2,0xCB02,0xCB42,0xD3A2,0xDC01,
-	0xDBE1,0xDBC2,0xD382,0xD342,0xCB22,0xCB01,0xCAE2,0xCAE2,
-	0xCAE2,0xCAE3,0xCAE3,0xCAE3,0xCAE3,0xCB04,0xCB04,0xCB04,
-	0xCB04,0xCB03,0xCB23,0xCB43,0xCB43,0xC343,0xC323,0xC322,
-	0xBB02,0xBAC2,0xBAA2,0xBAA2,0xB282,0xB282,0xB282,0xB282,
-	0xB282,0xBA82,0xBA82,0xBAA3,0xC2C3,0xC2E3,0xC303,0xCB04,
-	0xD344,0xD364,0xD365,0xDB85,0xDBC5,0xE3E5,0xE405,0xE425,
-	0xEC45,0xEC66,0xEC65,0xEC85,0xEC85,0xEC85,0xEC84,0xE4A4,
-	0xE4A3,0xE483,0xDC83,0xDC63,0xDC43,0xDC24,0xDBE4,0xDBE4,
-	0xE3E5,0xE405,0xF463,0xF482,0xF4A2,0xF4C2,0xF4E2,0xECE4,
-	0xE4C4,0xDC84,0xE445,0xE445,0xE445,0xE465,0xE445,0xE465,
-	0xE465,0xEC86,0xF4A7,0xF4A8,0xF4A7,0xF4E7,0xF4E6,0xED06,
-	0xED06,0xF4E6,0xED06,0xED06,0xED06,0xF527,0xF547,0xF547,
-	0xF566,0xF586,0xF5A6,0xEDA5,0xF566,0xED25,0xECC5,0xECA5,
-	0xEC85,0xE465,0xE425,0xE425,0xE425,0xEC46,0xF487,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF5A5,0xECE5,0xECA5,0xECA6,
-	0xEC66,0xEC65,0xEC66,0xF4C7,0xFD08,0xFD48,0x8410,0x0A38,
-	0x0A59,0x0AB9,0x0AF9,0x0B19,0xE4C7,0xF507,0xF527,0xF568,
-	0xFD8A,0xFE72,0xFF5A,0xFFFE,0xFFFF,0xFFBD,0xFEF7,0xFE73,
-	0x636F,0x0235,0x0216,0x01F6,0x09F7,0xBD0B,0xF5C7,0xF5A7,
-	0xF5A8,0xF5A8,0xF5A7,0xE567,0x0A59,0x0A38,0x0A37,0x0216,
-	0x0236,0x7BEF,0xFDE8,0xF5C7,0xF5C7,0xF5C7,0xF5C7,0xF5C7,
-	0xF5C7,0xF5C7,0xFDA8,0xF5A8,0xF5C9,0xF5EC,0xF62E,0x016E,
-	0x014D,0x012D,0x012D,0x6BAF,0xFEB5,0xFEB4,0x636F,0x09AF,
-	0x0990,0x0990,0x0990,0x01B0,0x0991,0x5B50,0xFE8C,0xFE2B,
-	0xF5A9,0xF588,0xF567,0xED27,0xED26,0xED26,0xF526,0xF566,
-	0xF5C6,0xF626,0xF626,0xFE07,0xFDE9,0xFDAA,0xFD8B,0xFD6B,
-	0xA9E1,0xA1E1,0xA1E1,0xA1C1,0xA1A1,0xA1A1,0xA1C1,0xA1C1,
-	0xA1C2,0xA1C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA02,
-	0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xB262,0xBA82,0xBA82,
-	0xBAA2,0xC2A2,0xC2C2,0xC2C2,0xCB01,0xCB21,0xD382,0xDBE2,
-	0xDC01,0xDBE2,0xDBC2,0xD362,0xD322,0xCB02,0xCB02,0xCB02,
-	0xCB02,0xCB03,0xCAE3,0xCAE3,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD304,0xCB04,0xCB23,0xCB43,0xCB43,0xCB42,0xC343,0xC323,
-	0xC302,0xBAE3,0xBAC2,0xBAA2,0xBAA2,0xB282,0xB282,0xB282,
-	0xB282,0xBA82,0xBAA2,0xBAA3,0xC2C3,0xC2E3,0xC303,0xCB04,
-	0xD344,0xD364,0xDB85,0xDB85,0xDBA5,0xE3E5,0xE405,0xE425,
-	0xE445,0xEC66,0xEC65,0xEC85,0xEC85,0xEC85,0xECA5,0xECA4,
-	0xE4C4,0xE4A3,0xE483,0xDC63,0xDC43,0xDC24,0xDC04,0xDC04,
-	0xE3E5,0xE404,0xF463,0xF482,0xF4A2,0xF4C2,0xF4E2,0xED04,
-	0xE4E4,0xE484,0xE445,0xE445,0xE445,0xE445,0xE465,0xE465,
-	0xE465,0xEC86,0xF4A7,0xF4A8,0xF4A7,0xF4E7,0xF506,0xF506,
-	0xED06,0xF4E6,0xED06,0xED06,0xF526,0xF547,0xF527,0xF547,
-	0xF566,0xF586,0xF5A6,0xEDA6,0xF586,0xED25,0xECE5,0xECA5,
-	0xEC85,0xE465,0xE445,0xE425,0xE425,0xEC46,0xF4A7,0xF4E8,
-	0xFD28,0xFD68,0xFDE7,0xF606,0xF585,0xECE5,0xECA5,0xECA6,
-	0xEC86,0xEC66,0xEC86,0xF4E8,0xFD29,0xFD49,0xAC8D,0x0A38,
-	0x0A59,0x0AB9,0x0AF9,0x0B19,0x9C2D,0xF507,0xF527,0xF547,
-	0xF58A,0xF651,0xFF5A,0xFFDE,0xFFFF,0xFFDD,0xFF18,0xEE33,
-	0x11EF,0x0235,0x0216,0x01F6,0x09D7,0xBD0B,0xF5C7,0xF5A7,
-	0xF5A8,0xF5A8,0xF5A7,0x840F,0x0A38,0x0A58,0x0A37,0x0216,
-	0x0236,0x8C2F,0xF5C8,0xF5C7,0xF5C6,0xF5C6,0xF5C7,0xF5C7,
-	0xF5C7,0xF5C7,0xFDC8,0xF5A8,0xF5A9,0xF5EC,0xF62E,0x018E,
-	0x014D,0x012D,0x014D,0x11AD,0x9CB1,0x42AD,0x01AE,0x01B0,
-	0x0990,0x098F,0x0190,0x01B0,0x6370,0xFEAD,0xFE8D,0xFE2B,
-	0xFDCA,0xF588,0xF567,0xF547,0xED46,0xED26,0xF546,0xF566,
-	0xF5C6,0xF626,0xF626,0xFE07,0xFDC9,0xFDA9,0xFD8B,0xFD6B,
-	0xA9E1,0xA9E1,0xA1E1,0xA1C1,0xA1C1,0xA1C1,0xA1C1,0xA1C1,
-	0xA1C1,0xA1C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA02,
-	0xAA22,0xAA02,0xAA22,0xB222,0xB242,0xB262,0xB282,0xBA81,
-	0xBAA2,0xBAA2,0xC2A2,0xC2C2,0xC2E2,0xCB02,0xD362,0xDBC1,
-	0xDC01,0xDC02,0xDBE2,0xD382,0xD342,0xCB22,0xCB02,0xCB02,
-	0xCB02,0xCB03,0xCAE3,0xCB03,0xCB04,0xCAE4,0xCB04,0xCB04,
-	0xD324,0xCB24,0xCB23,0xCB63,0xCB43,0xCB63,0xC343,0xC343,
-	0xC322,0xC2E3,0xBAE2,0xBAC2,0xBAC2,0xBAA3,0xB282,0xB282,
-	0xB282,0xBA82,0xBAA2,0xBAA3,0xC2C3,0xC2E3,0xCB03,0xCB24,
-	0xD324,0xD364,0xD364,0xDB85,0xDBA5,0xE3E5,0xE405,0xE446,
-	0xEC45,0xEC65,0xEC65,0xEC85,0xEC85,0xECA5,0xECA5,0xECA4,
-	0xE4C4,0xE4A3,0xE4A3,0xDC83,0xDC63,0xDC44,0xDC24,0xDBE4,
-	0xE3E5,0xE405,0xF463,0xF482,0xF4A2,0xF4C2,0xF4E2,0xED03,
-	0xE4E4,0xDCA4,0xE465,0xE445,0xE465,0xE465,0xE465,0xE465,
-	0xE465,0xEC86,0xF4A7,0xF4A8,0xF4A7,0xF4E7,0xF506,0xF506,
-	0xED06,0xF4E6,0xED06,0xED06,0xF526,0xF527,0xF547,0xF547,
-	0xF566,0xF586,0xF5A6,0xF5A6,0xF585,0xF546,0xECE5,0xECC6,
-	0xECA5,0xE485,0xE445,0xE425,0xE425,0xEC46,0xF4A7,0xFCE8,
-	0xFD29,0xFD88,0xFDE7,0xF606,0xF585,0xF505,0xECC5,0xECA6,
-	0xEC86,0xEC66,0xECA7,0xF508,0xFD29,0xFD69,0xDD2A,0x0A18,
-	0x0A59,0x0AB9,0x0AF9,0x0B19,0x1B18,0xC4AA,0xF527,0xF548,
-	0xF569,0xFE50,0xFF3A,0xFFFE,0xFFFF,0xFFBD,0xEEB7,0x324D,
-	0x09AE,0x0235,0x0237,0x01F7,0x09D7,0xF608,0xF5C7,0xF5A7,
-	0xF5A8,0xE569,0x7BF0,0x0A59,0x0A59,0x0A38,0x0237,0x0216,
-	0x0236,0xBCEC,0xF5C8,0xF5C7,0xF5C7,0xF5C6,0xF5C7,0xF5C7,
-	0xF5E7,0xF5C7,0xFDC8,0xF5A8,0xF5C9,0xFDEC,0xF62E,0x326F,
-	0x014E,0x012D,0x014D,0x016D,0x014A,0x014A,0x018D,0x01B0,
-	0x0990,0x0970,0x0990,0x6370,0xFE4F,0xFEAD,0xFE8C,0xFE2B,
-	0xFDC9,0xF588,0xF547,0xF546,0xED46,0xF526,0xF546,0xF586,
-	0xF5E6,0xF647,0xFE46,0xFE27,0xFDC9,0xFDA9,0xFD8B,0xFD6B,
-	0xAA02,0xA9E1,0xA9E1,0xA9E1,0xA1E1,0xA1C1,0xA1C2,0xA1C1,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xAA02,0xAA22,0xAA22,0xB222,0xB242,0xB262,0xB262,0xBA82,
-	0xBAA2,0xBAA2,0xC2A2,0xC2A2,0xC2C2,0xCB02,0xCB41,0xD3A1,
-	0xDBE1,0xE402,0xDBE2,0xDBA2,0xD361,0xCB21,0xCB22,0xCB02,
-	0xCB02,0xCB03,0xCB02,0xCB03,0xCAE3,0xCAE4,0xCB04,0xCB24,
-	0xCB24,0xCB23,0xCB43,0xCB43,0xCB43,0xCB63,0xC363,0xC343,
-	0xC322,0xBB02,0xBAE2,0xBAC2,0xBAA2,0xBAA2,0xBAA2,0xB282,
-	0xB2A2,0xBA82,0xBA83,0xBAA3,0xC2C3,0xC2C3,0xC303,0xCB24,
-	0xCB44,0xD344,0xDB64,0xDB85,0xDBA5,0xE3C6,0xE405,0xE425,
-	0xEC65,0xEC65,0xEC65,0xEC85,0xEC86,0xECA5,0xECA5,0xECA4,
-	0xE4A4,0xE4C4,0xE4A3,0xDC83,0xDC83,0xDC44,0xDC24,0xDBE4,
-	0xDBE4,0xE404,0xEC63,0xF482,0xF4A2,0xFCC2,0xF4C2,0xECE4,
-	0xE504,0xDCC4,0xE465,0xE465,0xE465,0xE465,0xE465,0xE465,
-	0xE466,0xEC86,0xF4A7,0xF4A7,0xF4A7,0xF4E7,0xF506,0xF526,
-	0xF507,0xED06,0xED06,0xF526,0xED26,0xF526,0xF547,0xF547,
-	0xF567,0xF586,0xF5A6,0xF5A5,0xF585,0xF546,0xED06,0xECC6,
-	0xEC85,0xE485,0xE445,0xE425,0xE426,0xEC46,0xF487,0xFCE8,
-	0xFD29,0xFD88,0xFDE7,0xF626,0xF5A5,0xED05,0xECC5,0xECA5,
-	0xEC65,0xEC66,0xF4A7,0xF529,0xFD4A,0xFD8A,0xF5C9,0x2295,
-	0x0A58,0x0A99,0x0AF9,0x0AF9,0x0AF9,0x0AF8,0x6BD0,0xBCAC,
-	0xE54A,0xFE10,0xFF59,0xFFDE,0xBDF7,0x7BF0,0x1148,0x014A,
-	0x09AE,0x0214,0x0217,0x01F7,0x32B4,0xFE08,0xF5C7,0xF5A7,
-	0x73D0,0x0A58,0x0A58,0x0A59,0x0A59,0x0A38,0x0237,0x0236,
-	0x1255,0xF5C9,0xFDC8,0xF5C7,0xF5C7,0xF5C7,0xF5C7,0xF5E7,
-	0xF5E7,0xF5C7,0xF5C8,0xF5C8,0xF5C9,0xF5EB,0xF60E,0x7BEF,
-	0x014E,0x012D,0x012D,0x014C,0x014B,0x014A,0x018D,0x098F,
-	0x0970,0x0990,0x73B0,0xFE4F,0xFE6E,0xFEAE,0xFEAD,0xFE2B,
-	0xFDCA,0xF588,0xF567,0xF546,0xED46,0xF546,0xF546,0xF586,
-	0xF5E6,0xF646,0xFE46,0xFE07,0xFDC9,0xFDAA,0xFD6B,0xFD6B,
-	0xAA02,0xAA01,0xA9E1,0xA9E1,0xA9E1,0xA1C1,0xA1C1,0xA1C1,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xAA02,0xAA22,0xAA22,0xB222,0xB242,0xB242,0xB262,0xB262,
-	0xBA82,0xBA82,0xC2A2,0xC2A2,0xC2C2,0xC2E2,0xCB21,0xD382,
-	0xDBC2,0xE402,0xE402,0xDBC2,0xD382,0xD342,0xCB22,0xCB22,
-	0xCB02,0xCB03,0xCB03,0xCB03,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xCB24,0xCB23,0xCB43,0xCB43,0xCB43,0xCB63,0xCB63,0xC343,
-	0xC323,0xC322,0xBAE2,0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xB282,
-	0xB2A2,0xBAA3,0xBA83,0xBAC3,0xC2C3,0xC2C3,0xC303,0xCB24,
-	0xCB44,0xD344,0xD364,0xDB84,0xDBA5,0xE3C6,0xE405,0xE425,
-	0xEC65,0xEC65,0xEC65,0xEC86,0xEC85,0xECA5,0xECA5,0xECA4,
-	0xE4C4,0xE4C4,0xE4A3,0xDC83,0xDC63,0xDC64,0xDC24,0xDC04,
-	0xDBE5,0xE405,0xF463,0xF482,0xF4A2,0xFCC2,0xF4C2,0xECE4,
-	0xE505,0xE4C4,0xE485,0xE465,0xE445,0xE465,0xE465,0xE465,
-	0xE466,0xEC86,0xF4A7,0xF4A7,0xF4A8,0xF4C7,0xF527,0xF526,
-	0xF506,0xED06,0xED06,0xF526,0xED26,0xF526,0xF527,0xF547,
-	0xF567,0xF586,0xF5A6,0xF5C5,0xF5A5,0xED45,0xED05,0xECC5,
-	0xE4A5,0xE485,0xE465,0xE445,0xE445,0xEC46,0xF487,0xFCE8,
-	0xFD49,0xFD88,0xFDE8,0xF626,0xF5A5,0xED05,0xECC5,0xECA5,
-	0xEC66,0xEC86,0xECC7,0xF529,0xFD6B,0xFD8A,0xFDC9,0x9C6E,
-	0x0A37,0x0A98,0x12D8,0x0AF8,0x0AF9,0x0AF8,0x0AF8,0x0AB8,
-	0x0A96,0x01F0,0x00C6,0x0021,0x0000,0x0021,0x00C6,0x014A,
+	0xBAE1,0xC007,0xFDAC,0xEB5D,0x9354,0x949C,0x8003,0xBA41,
+	0x0002,0xBA61,0xBA62,0xBA62,0x8003,0xBA61,0x0000,0xBA62,
+	0x8006,0xBA42,0x0001,0xBA22,0xBA42,0x8002,0xBA62,0x0002,
+	0xBA83,0xC283,0xC2A3,0x8002,0xBAA3,0xC022,0x9BAC,0xA4A5,
+	0xA3A4,0x5CA3,0x9C9C,0x5CA5,0x5CA3,0xA59B,0xA4E5,0xACEC,
+	0xA5EC,0xACAC,0xECED,0xACAC,0xECAC,0xA4ED,0xACA3,0xA400,
+	0x8002,0xDBA4,0xC01D,0x63A4,0xACA4,0xAC9C,0xA49C,0x64DC,
+	0xA4E4,0xA5AB,0xEDB4,0xABF3,0xB49C,0x548D,0x5CA4,0x9C65,
+	0xA4E4,0xACED,0x8002,0xE406,0xC010,0xE3AD,0x63A4,0x9CA3,
+	0xA4AC,0xA4A5,0xA4AC,0xE4A4,0xACAC,0x6C00,0x0005,0xC489,
+	0x7BEF,0x7BEF,0x9C0D,0xCC28,0xE445,0xC00E,0x9C9C,0xA49B,
+	0x9DA4,0xF5B4,0xF5AC,0xB5FB,0x7BB3,0x8C00,0x0000,0xECC5,
+	0xC008,0x8CA4,0x64E4,0xA4B5,0xF5ED,0xB500,0x0001,0xF5C9,
+	0x09F5,0xC004,0xA2A2,0x989B,0x8A00,0x0006,0x322B,0x632D,
+	0x9CD2,0xDE77,0xFEF7,0xF652,0xF5CB,0xC00B,0x889C,0xB6AF,
+	0xA3A2,0xACF4,0xAC53,0x928C,0x8002,0xF587,0x0000,0x1299,
+	0xC004,0xAD5B,0xA25B,0x9C00,0x0000,0xF5A8,0xC025,0xA4A3,
+	0xA49B,0xA49C,0x9CAE,0xB7B7,0xB7AD,0xACEC,0xACA4,0x9DA6,
+	0xA34A,0x929A,0xA29C,0xA2B2,0xB39C,0xCC8D,0x9C5B,0x8C62,
+	0x9CA4,0xACA4,0x0008,0xD488,0x0B19,0x0AF9,0x0AB9,0x0A79,
+	0x7BEF,0xF5A8,0xF5AA,0xB281,0xC008,0xFCF4,0xF5B4,0x9C53,
+	0x9C4C,0x9500,0x8002,0xBA62,0xC007,0x9CA3,0xADA4,0xABA5,
+	0x9CA3,0x8003,0xBA62,0xC007,0x9CA4,0x9CA4,0xACA4,0xADA3,
+	0x8002,0xC283,0x8006,0xBAA3,0xC01E,0xA364,0xA49C,0x9C5B,
+	0x9CA5,0x5CA4,0xA3A4,0xDCA5,0xA4B4,0xE4AD,0xECAC,0xECAD,
+	0xECAC,0xECA4,0xADEC,0xABA5,0xA300,0x8002,0xDBA4,0x0002,
+	0xDBA3,0xD3A4,0xD3C3,0x8002,0xD3E3,0x0002,0xD3C3,0xD3C3,
+	0xCBA3,0x8002,0xD383,0xC012,0xEDA4,0xACEC,0xB3F3,0xB49C,
+	0x5495,0x5C9C,0x649D,0xACE4,0xA4ED,0xAD00,0x8002,0xEC06,
+	0xC00E,0xAC6B,0x9C9C,0xA4A3,0xACA5,0xACA4,0x9CEC,0xA5AB,
+	0xAC00,0x8002,0xECC5,0x0002,0xE485,0xE445,0xE445,0x8002,
+	0xE425,0xC00C,0x9C9B,0x9DA4,0xF5B4,0xF5AC,0xB5FB,0x7CB3,
+	0x8B00,0x0000,0xECE5,0xC009,0x8D9B,0xA464,0xE4B5,0xF5AD,
+	0xB5BC,0x0000,0x0A15,0xC008,0xA399,0x9A99,0x5292,0x939A,
+	0x9C00,0x0003,0x21A9,0x636E,0xACAE,0xED67,0xC00D,0xE4A6,
+	0xB7A3,0xA2EC,0xB4AC,0x934A,0x9CA5,0xADA3,0x0000,0x1299,
+	0xC004,0xAC5C,0x9A63,0x9C00,0x0000,0xF5A8,0xC00C,0xA4A3,
+	0xA49B,0xA49C,0x9DAD,0x76F7,0xB7AE,0xAC00,0x0002,0x7BEF,
+	0x7BEF,0x8410,0x8003,0x7BEF,0xC008,0xAC9C,0xA4A5,0xA3AC,
+	0x9CA4,0xAC00,0x8002,0x7BEF,0x0000,0x7C0F,0x8002,0x7BEF,
+	0x000A,0x8410,0x9C2D,0xECC5,0x0B19,0x0AD9,0x0AB9,0x0A79,
+	0x7BEF,0xF5A8,0xFD8A,0xAA21,0xC00B,0xF4FC,0xFCB5,0xECA4,
+	0x9C54,0x9454,0x9C9B,0x8002,0xBA62,0xC008,0xA3A4,0xACA5,
+	0xA39C,0xA4A5,0xA400,0x8004,0xBA42,0xC003,0xA5EC,0x64AC,
+	0x8002,0xC283,0x8005,0xBAA3,0xC00A,0xABA4,0x5C9C,0xA453,
+	0xA49C,0x5CE5,0xA400,0x8003,0xA9E2,0xC00E,0xACEC,0xADEC,
+	0xACEC,0xADEC,0xACA4,0xECAD,0xECAC,0xA400,0x8005,0xDBA4,
+	0x0000,0xD3C4,0x8003,0xD3E3,0xC03F,0x9C64,0x9CDC,0xACE5,
+	0xA4EC,0xACEB,0xBBAC,0xA45C,0x9455,0x9CA4,0x65A4,0xE4A4,
+	0xEDAC,0xE5A4,0x64EC,0x6B9C,0xA49C,0xA4AB,0xADA3,0xA5A4,
+	0xACE4,0xA4B5,0xA374,0x9BDD,0x8C64,0xA49C,0xA49C,0x9B9D,
+	0xA4B5,0xF4ED,0xF574,0xBBBC,0xB393,0x0001,0xECE5,0xEC86,
+	0x8003,0xEC65,0xC004,0xB5F5,0xADB4,0xBC00,0x0000,0x0A16,
+	0xC009,0xA2A2,0x9991,0x529B,0x928A,0xA4B5,0x0005,0x016A,
+	0x0A11,0x1AB6,0x73D1,0xC4EC,0xF5CD,0xC00A,0x9BA1,0xACF4,
+	0xAC53,0x8A9C,0xADA5,0xA300,0x0000,0x1299,0xC004,0xA563,
+	0x9A63,0x9C00,0x0000,0xFDA9,0xC00C,0x63AB,0xA494,0xA3A5,
+	0x94AD,0xB6B7,0xAFB6,0xAC00,0x0000,0x014C,0xC016,0xA4A5,
+	0xABA2,0xA5FF,0xB6A4,0xAEA5,0xE65E,0x9564,0xBCBB,0xB4F5,
+	0xADED,0xA4AC,0x9C00,0x0009,0x4B95,0xECE6,0x0AF9,0x0AD9,
+	0x0A99,0x0A59,0x7BEF,0xF5A9,0xFD8B,0xA9E1,0xC00E,0xB4F4,
+	0xFCF5,0xB4F4,0xAC9C,0x9454,0x5394,0x9CA5,0xA400,0x8002,
+	0xBA61,0x0002,0xBA82,0xBA82,0xBA81,0x8003,0xBA62,0x0000,
+	0xBA42,0x8007,0x2880,0x0001,0x30A0,0x30A0,0x8002,0x28A0,
+	0x000C,0x30A0,0x28A0,0x5121,0xBAA2,0x9222,0x28A0,0x28A0,
+	0x2880,0x7181,0xAA41,0xAA41,0xAA21,0xAA02,0x8004,0xA9E2,
+	0xC00E,0xACEC,0xADEC,0xACE4,0xB5EC,0xACA4,0xECAD,0xACEC,
+	0xA400,0x8004,0xDBA4,0x0001,0xDBC4,0xD3C4,0x8004,0xD3E3,
+	0xC01C,0x9C9C,0x9CA4,0xEDA4,0xECAC,0xABF4,0xB3AC,0x9455,
+	0x945C,0xA4A5,0x64E4,0xA4ED,0xACE5,0xA464,0xACAB,0xA400,
+	0x8002,0xE425,0xC004,0xA3AD,0xAC9B,0xE500,0x8002,0xEC65,
+	0xC016,0xACAC,0xB49C,0x9C54,0xDCA4,0x5CA4,0x9B5C,0xDCA5,
+	0xB5F4,0xEDB5,0xF47B,0xFC73,0x9300,0x0000,0xECE5,0xC009,
+	0x8D9B,0xA464,0xA4F5,0xF5AD,0xB4BC,0x0000,0x0A16,0xC009,
+	0xA3A2,0xA191,0x5292,0x9293,0x9BAD,0x0007,0x0149,0x09F0,
+	0x0A76,0x0A98,0x0A76,0x32D1,0xA46E,0xF5A9,0xC008,0xACF4,
+	0xAC53,0x8A9C,0xADA5,0xA300,0x0000,0x1299,0xC004,0xA563,
+	0x9A63,0x9C00,0x0000,0xF5A8,0xC008,0xA4AB,0x9C9C,0xA39C,
+	0x9DAD,0x7500,0x0004,0xF5ED,0xF610,0xF652,0xF672,0x014C,
+	0xC016,0xA4A5,0xAB9A,0xADFF,0xB6AC,0xA6A5,0xEE55,0x9664,
+	0xBBBC,0xB4F5,0xADED,0xA4AC,0x9C00,0x0009,0x4B94,0xECC6,
+	0x12F9,0x0AD9,0x0A99,0x0A59,0x7BEF,0xF5A9,0xFD8B,0xA9C1,
+	0xC00E,0xACAC,0xF5FC,0xB4FC,0xF3AC,0xA554,0x9494,0x9454,
+	0xA400,0x8002,0xBA61,0xC003,0xADE4,0x64A3,0x8003,0xBA62,
+	0x800E,0x0000,0x0002,0x28A0,0xBAA2,0x8A01,0x8002,0x0000,
+	0x0001,0x5941,0xAA41,0xC003,0xA49C,0xA59C,0x8003,0xA9E2,
+	0xC00E,0xACAC,0xEDA4,0xECAC,0xEDEC,0xACAC,0xECAD,0xACEC,
+	0xAC00,0x8002,0xDBA4,0xC003,0xAC9C,0xACA4,0x8004,0xD3E3,
+	0xC010,0x9CA4,0x9CA5,0xE4A4,0xE4AC,0xF3B4,0xB3AC,0xA44D,
+	0x945C,0x9C00,0x8003,0xDBC4,0xC007,0xACED,0xEDA4,0x9CAC,
+	0xAB64,0x8003,0xE425,0x0002,0xE445,0xE465,0xE465,0x8003,
+	0xEC65,0xC016,0xACB4,0xA4AC,0x9454,0x9CE4,0x649C,0x9C9B,
+	0x9DA4,0xB4F5,0xEDB4,0xF57C,0xBBB3,0x9300,0x0001,0xECE5,
+	0xEC85,0x8002,0xEC65,0xC005,0x64F5,0xF5ED,0x74B4,0x0000,
+	0x0A37,0xC009,0x9BA9,0x9A91,0x9252,0x9292,0x9AA5,0x0002,
+	0x0128,0x09AF,0x0A76,0xC003,0xAD9B,0x90A5,0x0002,0x2AB4,
+	0x9C6E,0xFE09,0xC006,0xAC93,0x4A9C,0xADA5,0xA300,0x8002,
+	0x1299,0x0003,0x0A77,0x0256,0x0256,0xFDA9,0xC008,0x63A3,
+	0xA49C,0xA39C,0xA5A5,0x6D00,0x0004,0xF5CD,0xF610,0xF651,
+	0xF672,0x016C,0xC016,0x95AC,0xAB9A,0xADFF,0xB5A5,0xA6AD,
+	0xE65D,0x9664,0xBBBC,0xB4ED,0xB5ED,0xACA4,0x9C00,0x0009,
+	0x43B5,0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A39,0x7BF0,0xF5A9,
+	0xF58A,0xA9C1,0xC00D,0xACAC,0xECAD,0xF4FC,0xB3FD,0xACA4,
+	0x9C54,0x8C54,0x8002,0xBA62,0xC008,0xA3AC,0xA4E4,0x64A5,
+	0xA49C,0xA400,0x800E,0x0000,0x0002,0x28A0,0xBAA2,0x8A01,
+	0x8002,0x0000,0x0001,0x5941,0xAA62,0xC01E,0x9C9C,0xA49C,
+	0xA464,0xDCA4,0xACAC,0xEDA4,0xECAC,0xECED,0xACAC,0xECAD,
+	0xECAC,0xACA4,0xA3A4,0xAC9C,0xACA4,0xAC00,0x8004,0xD3E3,
+	0xC00F,0x9C9C,0xA5E4,0xA4EC,0xA4B4,0xF3B3,0xACA4,0x5495,
+	0x549C,0x8003,0xDBC4,0xC008,0xACED,0xE5AC,0xA4A3,0xADA3,
+	0x6400,0x8002,0xE425,0x0000,0xE445,0x8002,0xE465,0xC019,
+	0xE4AD,0xA3A4,0xB4AC,0x9C9C,0x9C9C,0x5CA4,0x9B9C,0x9D9C,
+	0xACAC,0xEDF5,0xB4ED,0xBCBB,0x7B93,0x0000,0xECE5,0xC009,
+	0x8D9B,0xA4A5,0xA4AC,0xF5B5,0xF474,0x0000,0x0A36,0xC00A,
+	0xA4A3,0x9999,0x9192,0x528A,0x9AA5,0xBE00,0x0001,0x098E,
+	0x0A55,0xC005,0xB69B,0x90A6,0xAE5C,0x0002,0x2274,0x9C8E,
+	0xFDE8,0xC004,0x4A9C,0xA6AC,0xA300,0x0000,0x1299,0xC004,
+	0xA464,0x9A5B,0xA400,0x0000,0xF5A8,0xC004,0xA4A3,0xAC94,
+	0xA300,0x8002,0xF567,0x0005,0xF589,0xF5ED,0xF610,0xFE52,
+	0xF672,0x096D,0xC016,0x54A4,0xB39A,0xADBE,0xF6A5,0xA5A6,
+	0xAD9E,0x9564,0xBCF4,0x7CED,0xFDA5,0xA4AC,0x9C00,0x0009,
+	0x4395,0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A38,0x7BEF,0xF5A8,
+	0xF58A,0xA9C1,0xC019,0xACAC,0xA4EC,0xACF4,0xB4FD,0xB3F5,
+	0xAB95,0x5395,0x4B9D,0xA49B,0xA4AC,0xA4AC,0x9DA3,0x9DA4,
+	0x800E,0x0000,0x0002,0x28A0,0xBAA2,0x8A02,0x8002,0x0000,
+	0x0004,0x5941,0xAA62,0xAA42,0xAA22,0xAA22,0x8006,0xAA02,
+	0xC00F,0xECAD,0xEBAD,0xECED,0xACAC,0xECAD,0xA4F4,0xACA4,
+	0xA3A4,0x8002,0xDBC4,0x8002,0xDBE4,0xC006,0xABA4,0x649C,
+	0x9C9C,0xA400,0x8002,0xDBA4,0xC009,0xECAC,0xF3B4,0xB3A4,
+	0x9C4C,0x9564,0x8002,0xDBC4,0xC01E,0xACA5,0xECE5,0xACA4,
+	0xACA4,0xAB5C,0xA49C,0xACA4,0xACAC,0xDCA4,0xADA4,0xA3B4,
+	0xACA4,0x9B95,0x5C9C,0xA49C,0x9B00,0x8002,0xE3E5,0xC005,
+	0xACED,0xF5B4,0xEDBC,0x0003,0xF5A7,0xF5E6,0xF5A5,0xED05,
+	0xC00C,0x849C,0xA4A5,0xA4AC,0xF5F5,0x74BC,0xACA5,0x1600,
+	0x000B,0xBCCE,0xBD0F,0x7C10,0x634E,0x322B,0x00E6,0x0084,
+	0x00A4,0x00E7,0x098C,0x0A33,0x1278,0xC006,0x6290,0xA6AE,
+	0x549C,0x9C00,0x0006,0x42F4,0xCD0A,0xF586,0xF587,0xF588,
+	0xF587,0x1299,0xC004,0x64A3,0x9B5B,0xA400,0x0000,0xFDA9,
+	0xC004,0x63A3,0xAC94,0xA300,0x8002,0xF567,0xC004,0xAEBF,
+	0xAFB7,0xAC00,0x0000,0xBD51,0xC016,0xAC9C,0xA4E5,0x6493,
+	0x9BAB,0xA39C,0xA3AB,0xAC9C,0x9C9C,0x9C9B,0x9C5C,0xA3A4,
+	0xAD00,0x0009,0xC489,0xECE6,0x0AF9,0x0AB9,0x0A79,0x0A39,
+	0x7BEF,0xF5A8,0xF58A,0xA9C1,0xC011,0xACAC,0xA4EC,0xA4B4,
+	0xEDAB,0xFCFD,0xB4EC,0x5B8D,0x5354,0x9D94,0x8002,0xBA81,
+	0xC004,0xEDA4,0x639D,0xA400,0x8007,0x5921,0x8002,0x6141,
+	0xC003,0xACA4,0x9C64,0x000A,0x71A1,0xBAA2,0xA262,0x5941,
+	0x5961,0x5941,0x81E1,0xB262,0xAA62,0xAA42,0xAA21,0x8006,
+	0xAA02,0xC00C,0xECAD,0xEBAD,0xECAD,0xECAC,0xECAC,0xA5EC,
+	0xAC00,0x8002,0xDBA4,0x8002,0xDBC4,0x8002,0xDBE4,0xC013,
+	0xABA4,0x64A4,0x9C9C,0x9CE5,0xA4E4,0xACAC,0xB3F4,0xB3A4,
+	0x9C54,0x955C,0x8002,0xDBC4,0xC003,0xACA4,0xEDAD,0x8002,
+	0xEC26,0x0001,0xEC46,0xEC66,0x8002,0xE445,0xC01A,0x9CAC,
+	0xACAC,0xE4A4,0xA5A4,0xA3B4,0xACA3,0x9C95,0x9C9C,0xA45C,
+	0x9CA4,0x9CA4,0xACED,0xF5B4,0xED00,0x0004,0xF548,0xFDA7,
+	0xF5E6,0xF5C5,0xED05,0xC00E,0x859B,0xA4A5,0xA3AD,0xF5F5,
+	0xAC7C,0xABAD,0x9EAE,0xAE00,0x0009,0xF632,0xF694,0xFEB6,
+	0xFF18,0xBDB5,0x7BEF,0x3209,0x016A,0x0A12,0x1277,0xC008,
+	0x6390,0xA5AF,0x5C94,0x9CB5,0xF600,0x0004,0x6BD1,0xE549,
+	0xF588,0xED87,0x1299,0xC004,0x64A3,0x9B5B,0xA400,0x0000,
+	0xFDA9,0xC004,0x63A3,0xA49C,0xA400,0x8002,0xF567,0xC018,
+	0xAEBF,0xAFB6,0xADF4,0xACA4,0x95AE,0xA481,0x52A3,0xAB9B,
+	0xA2AA,0xB3DC,0x948C,0x9453,0x9300,0x8002,0xECA5,0x000A,
+	0xECC5,0xECC6,0xF4E6,0x0AF9,0x0AB9,0x0A79,0x0A39,0x7BEF,
+	0xF5A8,0xF58A,0xA9C1,0xC01A,0xACAC,0xA4E4,0xACAC,0xA5EC,
+	0xB3FD,0xFCB4,0xAC9C,0x944C,0x9454,0xA3A4,0xA5EB,0xA563,
+	0x9DE4,0x6400,0x8004,0xBA62,0xC003,0xA5AC,0xE4A4,0x8003,
+	0xC2A3,0x0000,0xBAA2,0x8002,0xBAC2,0xC01D,0x9CAC,0x9C5C,
+	0xA49C,0xA45C,0x9CA3,0xA49D,0x9CAC,0xA4EC,0xADAB,0xEDEC,
+	0xADEC,0xACEC,0xACA5,0xECAC,0xACAC,0x8003,0xDBC4,0x8002,
+	0xDBE4,0xC00D,0xACA3,0x64A4,0x9C9C,0x9DE4,0xA4EC,0x9CB4,
+	0xB3EC,0x8002,0xECA2,0x0002,0xE463,0xDC03,0xDBE3,0x8002,
+	0xDBC4,0xC01A,0xACA4,0xEDAD,0xE4A4,0xACAC,0xA36C,0x94A4,
+	0x9CAC,0xACA4,0xECA4,0xA5AC,0xA4AB,0xACA4,0xA395,0x5400,
+	0x8002,0xE445,0x0000,0xE425,0x8002,0xE3E5,0xC005,0xACED,
+	0xF5B4,0xEDBC,0x0004,0xFDA7,0xF5E6,0xF5C5,0xED25,0xEC85,
+	0xC00E,0x9CA4,0x9CAC,0xADF5,0xF5AC,0xBB74,0x9D9D,0xAEAF,
+	0xBE00,0x0009,0xF674,0xF6B6,0xFEF8,0xFF7B,0xFF7B,0xFF39,
+	0xE655,0x9C6F,0x4333,0x0A76,0xC008,0x88A5,0xB75C,0x949C,
+	0xF5B6,0xB300,0x0003,0x3B15,0xC4EA,0xF587,0x1299,0xC004,
+	0x649B,0xA35B,0xA400,0x0000,0xFDA9,0xC020,0xA363,0xAC9C,
+	0xA49C,0x9CA5,0xADB7,0xB7B6,0xEDAC,0xB4A5,0x95AD,0x9C49,
+	0x9AA3,0xA39B,0x5AF3,0xB2DC,0x948C,0x9453,0x9400,0x8003,
+	0xECA5,0x0009,0xECC6,0xECE6,0x0AD9,0x1299,0x0A79,0x0A39,
+	0x7BEF,0xF5A9,0xF58A,0xA9C1,0xC004,0xACA4,0xACE4,0xAC00,
+	0x8002,0xB241,0xC010,0xF5AB,0xFDBC,0xF4AC,0x9B8C,0x5593,
+	0x5C9D,0xA4AC,0xE3A4,0x9D00,0x8002,0xBA82,0x0001,0xBA62,
+	0xBA82,0x8002,0xBA62,0x0001,0xBA83,0xC283,0x8004,0xC2A3,
+	0x0001,0xC2C2,0xC2C2,0x8004,0xBAC2,0xC004,0x5C9B,0x9D64,
+	0x9C00,0x8002,0xAA21,0x8003,0xAA02,0xC00E,0xACED,0xABED,
+	0xE4AC,0xF5AC,0xECA4,0xADEC,0xACAC,0xAC00,0x8002,0xDBC4,
+	0x8003,0xDBE4,0xC015,0xABA4,0x64A4,0x9CA4,0x9C9D,0xE4A4,
+	0xE4B4,0xACF3,0xB3AC,0xA454,0x955C,0x9D9C,0x8002,0xDBE4,
+	0x0001,0xDBE5,0xE425,0x8002,0xEC46,0xC020,0xACAB,0xA45C,
+	0x9CA4,0xACA4,0xECA4,0xA5A4,0xACA4,0xABAC,0xA4A3,0x9554,
+	0x9CE4,0x649C,0x9C9C,0xA4AC,0xEDF5,0xB4ED,0xBC00,0x0003,
+	0xFDA7,0xF5E6,0xF5C5,0xED25,0xC016,0x859B,0x9CA4,0x9CB5,
+	0xF5F5,0xAC7B,0xACA4,0x9DAF,0xAEB7,0xB7F6,0xBEBF,0xAD9B,
+	0x4000,0x0004,0xF610,0xF58A,0xD52B,0x8410,0x1273,0xC008,
+	0x6754,0x949C,0xEEBD,0xABA3,0xA400,0x0001,0x9C4E,0x1299,
+	0xC004,0xA45B,0xA35B,0xA400,0x0000,0xFDA9,0xC003,0x63A3,
+	0xAC9C,0x8002,0xF587,0xC019,0x9CAD,0xB7B7,0xB7ED,0xB4AD,
+	0xA49D,0xA59C,0x8952,0xABA3,0x9BAB,0xA2B2,0xDC94,0x8D93,
+	0x5393,0x8003,0xECA5,0x0008,0xECC6,0xECE6,0x0AD9,0x0A99,
+	0x0A79,0x0A38,0x7BEF,0xFDA9,0xF58A,0x8002,0xA9E1,0xC017,
+	0xACE4,0xACA4,0xADA3,0xB4E5,0xABFD,0xFCB4,0xEC5B,0x954B,
+	0x9454,0xA5AC,0xE3A4,0xA59C,0x8003,0xBA82,0xC005,0xDC64,
+	0xA4AD,0xA4E4,0x8003,0xC2A3,0x0000,0xC2C3,0x8002,0xC2C2,
+	0x8002,0xBAC2,0xC007,0x9C5C,0xA49B,0x5D9B,0xA5A3,0x8003,
+	0xAA02,0xC015,0xACEC,0xACED,0xA4EC,0xF5AC,0xA4EC,0xADEC,
+	0xACAC,0xACA3,0xECA4,0x64A4,0xACA4,0x8002,0xDC03,0xC010,
+	0x649C,0xA49C,0xA5DC,0xACDC,0xB4AC,0xF4B3,0xABA4,0x9C55,
+	0x5400,0x8004,0xDBE4,0x0001,0xDBE5,0xE425,0x8002,0xEC46,
+	0xC007,0xACAC,0xA45B,0x9CA4,0xACA4,0x8002,0xEC85,0x8002,
+	0xECA6,0xC012,0xABAC,0xAC9B,0x9594,0x5CE4,0x649C,0x9C9C,
+	0xA4AC,0xEDF5,0xB4ED,0xBC00,0x0003,0xFDA7,0xF5E6,0xF5C5,
+	0xED25,0xC012,0x849C,0x9CA4,0x9CB5,0xF5ED,0xB47B,0xACA4,
+	0x9DA6,0xAEB7,0xB7FF,0xB600,0x000B,0xFF5A,0xFF9C,0xFF7B,
+	0xF6F7,0xF630,0xF58A,0xF58A,0xF5ED,0xF5CC,0x9C4E,0x2295,
+	0x01F6,0xC00C,0xDDAD,0xBDAB,0xA3A5,0xE465,0xAC9B,0xA35B,
+	0xA400,0x0000,0xFDA8,0xC026,0x64A3,0xAC9C,0x9CA4,0x9CA4,
+	0xADB7,0xB7B7,0xF5AC,0xADA4,0x9DA5,0x9C89,0x52A3,0xAB9B,
+	0xA3AA,0xB3DB,0x958C,0x9353,0x9B5B,0x9CA4,0xACAD,0xEB00,
+	0x0006,0x12D9,0x0A99,0x0A59,0x0A38,0x7BEF,0xFDA9,0xF58A,
+	0x8002,0xA9E1,0xC017,0xACA4,0xECA4,0xEC64,0xA4AD,0xEBAC,
+	0xFCBD,0xF4EC,0x5C8B,0x5494,0x5D9B,0xACE4,0xA5A4,0x0003,
+	0x6140,0x6141,0x5941,0x6121,0x8002,0x5941,0xC003,0x9CA4,
+	0xECA4,0x8003,0x6161,0x0001,0x79A1,0xC2C2,0xC00B,0xA563,
+	0xAD9B,0xA45C,0x9C9C,0x649C,0x9CA4,0x8002,0xAA02,0xC010,
+	0xACA4,0xECA4,0xEDAC,0xECAD,0xECAC,0xECAD,0xECAC,0xACAC,
+	0xA400,0x8003,0xE3E4,0x0000,0xDBE4,0x8002,0xDC04,0xC011,
+	0xA3A4,0x5CA4,0x9CA5,0x9CEC,0x9CEC,0xB4F3,0xB4AB,0xAC9C,
+	0x4C55,0x8004,0xDBE4,0x0001,0xDBE5,0xE425,0x8002,0xEC46,
+	0xC007,0xACAC,0xA45B,0xA4DC,0x6CE4,0x8002,0xECA5,0x8002,
+	0xECA6,0xC012,0xB4AB,0xA49B,0x949D,0x94AC,0x5C9C,0x9C9C,
+	0xA4AC,0xEDF5,0xB4ED,0xBC00,0x0004,0xFDA7,0xF5E6,0xF5C5,
+	0xED25,0xEC85,0x8002,0xEC65,0xC00B,0x9CAD,0xFDED,0x74BB,
+	0xACA4,0x94A7,0xB6B6,0x0010,0xF632,0xFE74,0xFEB6,0xFF5A,
+	0xFF9C,0xFF7C,0xFF18,0xF652,0xF5AB,0xF589,0xF5ED,0xF5CC,
+	0xF5A9,0xFDC9,0x9C8E,0x2255,0x09F8,0xC00A,0xBDAB,0xA39C,
+	0xADA5,0xAC9B,0xA35B,0xA400,0x0000,0xFDA8,0xC026,0x64A3,
+	0xAC9C,0x9CA4,0x9CA4,0xADB7,0xB7B7,0xF5AD,0xACA4,0x9DA5,
+	0x9B8A,0x5AA3,0xA3A3,0xA3AA,0xABDB,0x9594,0x8C5A,0x939C,
+	0x5BA4,0xACED,0x6B00,0x0008,0x7BF0,0x7BEF,0x7BF0,0x7BEF,
+	0xBCEC,0xFDA9,0xF58A,0xA9E1,0xA9E1,0x8002,0xAA01,0xC015,
+	0xECA4,0xADA4,0xA3AD,0xE4AB,0xACFD,0xFCB4,0xAC9C,0x934D,
+	0x945B,0xA4E5,0xACA4,0x800E,0x0000,0x0001,0x30A0,0xC2C2,
+	0xC015,0xA563,0xA4AC,0x9C5C,0xA49C,0x9C5C,0xA49C,0xA49C,
+	0xA4AC,0xACE4,0xA4ED,0xACAC,0x0000,0xCAC4,0xC023,0xACAC,
+	0xECAD,0xA4F4,0xACAC,0xA4E4,0xACA3,0x64A4,0xAC9C,0xABAC,
+	0x649C,0xA49C,0x9CA5,0xDCEC,0xA4AC,0xF4B3,0xF36C,0x9C54,
+	0x9595,0x8003,0xDBE4,0xC008,0xADEC,0xEDA4,0xACA5,0xABAC,
+	0x9C00,0x8002,0xE465,0xC011,0xACEC,0x64E4,0xA4A5,0xA4AB,
+	0xACB4,0x9C94,0x549C,0x9CA4,0x9C9C,0x8002,0xE3E5,0xC007,
+	0xF5ED,0xB4F5,0xBCBB,0xBB63,0x0002,0xED45,0xECA5,0xE465,
+	0x8003,0xEC65,0xC00C,0xFEAC,0xF573,0xBB9D,0x54E6,0xAEBF,
+	0xAFFF,0xB600,0x0005,0xFF39,0xFF9C,0xFF7C,0xFF39,0xF674,
+	0xF5CC,0xC006,0x9AB7,0x9B99,0xECB4,0x1400,0x0001,0x8410,
+	0x0A59,0xC009,0xABA3,0xA5A4,0xA5AC,0x9CA2,0x5BA4,0x0000,
+	0xF5A8,0xC02D,0xACA3,0xA49C,0xA49C,0x9CA4,0xADB7,0xAFF7,
+	0xB5B4,0xADA4,0x9DAD,0x9C40,0x9BA3,0xA3A4,0x9AB3,0xAADC,
+	0x9494,0x8B5B,0x935B,0x9CAC,0xA5AC,0xACEC,0xBCB4,0xA4E6,
+	0x9D5D,0x8002,0xA9E1,0xC017,0xACA4,0xECA4,0xADA4,0xA3AD,
+	0xA3E4,0xACB4,0xF5FB,0xB5EC,0x5494,0x5493,0x9CAD,0xA3A5,
+	0x800E,0x0000,0x0003,0x30A0,0xC2C2,0xC2C3,0xC2C3,0x8003,
+	0xBAC2,0xC004,0x5C9C,0x9C5B,0xA500,0x8005,0xAA22,0xC00E,
+	0xECA4,0xEDAC,0xECAD,0xECAC,0xECAD,0xECAC,0xACAC,0xA400,
+	0x8002,0xE3E5,0xC007,0xA36C,0xDC6C,0xA4AB,0xA49C,0x8002,
+	0xD3E3,0xC00C,0x9DE4,0xA4E4,0xB4EC,0xB3B3,0xAC9C,0x5495,
+	0x9500,0x8003,0xDBE4,0xC00C,0xADEC,0xA5EC,0xACA4,0xACAC,
+	0x9CA3,0x5CA4,0xEC00,0x8002,0xECA5,0xC00D,0xA5A4,0xACA4,
+	0xB4AB,0x9C9C,0x8C5C,0xDC64,0x9C9C,0x8002,0xE3E5,0xC007,
+	0xF5F5,0xACF5,0xBCBB,0xBB63,0x0002,0xED45,0xECA5,0xEC85,
+	0x8003,0xEC65,0xC00C,0xFEEC,0xB573,0xB3A4,0x95A5,0xAFB6,
+	0xB7BF,0xF700,0x0005,0xFF38,0xFF7C,0xFF9D,0xFF59,0xF694,
+	0xF5CD,0xC007,0x99B7,0x9B99,0xECB4,0x64A3,0x0002,0xDD29,
+	0x4334,0x0A77,0xC007,0xA5A4,0xA5AC,0x9BA3,0x5BA4,0x0000,
+	0xF5A8,0xC020,0xACA3,0xA49C,0xA49C,0x9CA4,0xADB6,0xAFF7,
+	0xB6B4,0xADA4,0x9DAD,0x9C49,0x92A3,0xA3A4,0xA3AA,0xAAE4,
+	0x948C,0x8B5B,0x9300,0x8003,0xECC5,0xC008,0xADAC,0xECBC,
+	0xB4AC,0x9EDD,0x5D00,0x8002,0xA9E1,0xC017,0xACA4,0xECA4,
+	0xADA3,0xACA5,0xA3A4,0xE4AC,0xB4F4,0xFDB4,0xEC5C,0x8C53,
+	0x94A4,0xA5A4,0x800E,0x0000,0x0000,0x30A0,0x8002,0xC2C3,
+	0xC009,0x6CA4,0xA39C,0x6494,0x9C5C,0xA3A5,0x8004,0xAA22,
+	0xC00E,0xECA4,0xEDAC,0xACED,0xECAC,0xECA4,0xADF4,0xACAC,
+	0xE400,0x8002,0xE3E5,0xC028,0xA36C,0xE464,0xACA3,0xA49C,
+	0xA45C,0xA49C,0xE59D,0xECB3,0xE4B3,0xBBAC,0xA494,0x4D9D,
+	0x5CA4,0xAC9D,0xACEC,0xA5EC,0xACA4,0xACAC,0x9CA3,0xA45C,
+	0xEC00,0x8002,0xECA5,0xC018,0xAD9C,0xACA4,0xACB3,0x9C94,
+	0x9C54,0xDC64,0xA494,0xA49C,0xA4F5,0xEDB4,0xF5BC,0xBBBB,
+	0x6300,0x0002,0xF545,0xECA5,0xE465,0x8003,0xEC65,0xC00C,
+	0xFEEC,0xB573,0xB3A4,0x949E,0xAEB6,0xBFF7,0xB700,0x0005,
+	0xFF18,0xFF9C,0xFF9D,0xFF7A,0xFEB6,0xF5EE,0xC009,0x90B7,
+	0xDB59,0xACF4,0xAC5B,0x8A9D,0x0001,0x8C2F,0x1A97,0xC006,
+	0x1DA5,0xEC5B,0xA35B,0xE400,0x0002,0xF5A8,0xF5C8,0xF5C7,
+	0x8002,0xF5A7,0xC028,0x9CA4,0x9CAD,0xB6AF,0xB7B6,0xF4AD,
+	0xA49D,0xAD9C,0x4992,0xA3A4,0xA3A3,0xAAAB,0xE394,0x8C94,
+	0x5293,0x5C9B,0xACA4,0xADB4,0xECB4,0xB4AC,0x9EDD,0x5D00,
+	0x0000,0xA9C1,0xC005,0xACA4,0xACE4,0xACA4,0x8002,0xB241,
+	0xC010,0xADA3,0xA4E5,0xA4AB,0xFCB4,0xF5B4,0xAC94,0x934C,
+	0xA59B,0xA400,0x8007,0x30A0,0x0000,0x0820,0x8003,0x0000,
+	0x0002,0x0820,0x28A0,0x5141,0x8002,0xC2C3,0xC007,0xACA3,
+	0x649C,0x649C,0x9C9C,0x8002,0xAA42,0x8003,0xAA22,0xC037,
+	0xECA4,0xEDAC,0xA4F4,0xE5AC,0xACEC,0xADF4,0xACAC,0xE4AC,
+	0x64E4,0xACA3,0xA464,0xACA3,0xAC9C,0x9C64,0x9CA5,0xDCA4,
+	0xE4AC,0xECB3,0xFCAB,0x6494,0x5496,0x5CA4,0xACA5,0xA4E4,
+	0xADEC,0xACA5,0xACAB,0xA49C,0x8002,0xEC85,0x0002,0xECA5,
+	0xECC5,0xECC5,0x8002,0xECC6,0xC015,0xACA4,0xB3A4,0x9494,
+	0x54DC,0xA45C,0x9CA4,0x9CA4,0xF5ED,0xB4F5,0xBCBB,0xBB6B,
+	0x0002,0xF565,0xECA5,0xEC85,0x8003,0xEC65,0xC00C,0xF5F5,
+	0xB573,0xB3A4,0x959D,0xAEB6,0xB7F6,0xB700,0x0006,0xFF18,
+	0xFF7C,0xFFBD,0xFF7B,0xFED7,0xF60F,0xF5AA,0xC009,0xB7E4,
+	0x50EC,0xB4AC,0x9B4A,0x9DA5,0x0002,0xC50A,0x3B15,0x1279,
+	0xC004,0x64A3,0xA35B,0x9C00,0x0001,0xF5C8,0xF5C8,0x8002,
+	0xF5C7,0x8003,0xF587,0xC025,0xA5B6,0xAFB7,0xB6F4,0xADA3,
+	0x9EAD,0x9C89,0x52A3,0xAC9B,0xA2AB,0xABE4,0x938C,0x5393,
+	0x935C,0xA3A4,0xA5EC,0x6CF4,0xBCAC,0xAD9D,0xDD5D,0x0000,
+	0xA1C1,0xC01B,0xE4AC,0xA4AC,0xE4AC,0xACA4,0xA5AC,0xA3A4,
+	0xE5A4,0xA3B4,0xF4F4,0xBDB4,0xE454,0x8C53,0x9DA4,0xAC9C,
+	0x8004,0xC2A2,0x0008,0xC282,0xC282,0xB263,0x6962,0x0820,
+	0x0000,0x0000,0x4101,0xB283,0x8002,0xC2C3,0xC01F,0xACA4,
+	0x63A4,0x9C9C,0x5B9D,0xA464,0x9CA4,0x9BA5,0xACE4,0xA4AC,
+	0xEDA4,0xF4E5,0xACAC,0xECAD,0xECAC,0xB4E4,0xAC64,0x8002,
+	0xE405,0xC009,0xA3A4,0x6CAB,0xA49C,0xA45C,0xA49D,0x8002,
+	0xDBC4,0xC00A,0xEDEB,0xB4FB,0xAB64,0x9C54,0x4D9D,0xAC00,
+	0x8002,0xDC05,0xC008,0xE4AC,0xEDAC,0xA5A4,0xB3A3,0xA400,
+	0x8002,0xEC85,0x0002,0xECA5,0xECC5,0xECC5,0x8002,0xECC6,
+	0xC013,0xACEB,0x6CA3,0x9D94,0x949C,0x9C5C,0x9CA4,0x9CA4,
+	0xF5ED,0xB4F5,0xBCBB,0x0003,0xFE07,0xF5E5,0xF565,0xECC5,
+	0xC011,0x949C,0xA49C,0xACF5,0xF5B5,0x73B3,0xA495,0x9CA6,
+	0xB6BF,0xB7F7,0x0006,0xFEF8,0xFF7B,0xFFBD,0xFF9B,0xFEF7,
+	0xF630,0xF5AB,0xC00B,0xB6E4,0x50EC,0xB4AB,0x5B8B,0x9DA5,
+	0xA31C,0x0001,0x3B16,0x0A79,0xC003,0xA49A,0xA3A4,0x0001,
+	0xF5C8,0xF5C8,0x8002,0xF5C7,0x8003,0xF587,0xC025,0xA5AE,
+	0xB7B7,0xB6F4,0xADA3,0x9EAD,0x9C89,0x52A3,0xACA3,0x9BAA,
+	0xACE3,0x9394,0x8C52,0x9B5C,0x9CA3,0xA5AC,0xB4F4,0xB4B4,
+	0xE55D,0xDD9D,0x0000,0xA1A1,0xC01C,0xACE4,0xACA4,0xACEC,
+	0xACA4,0xA5AC,0xA3A4,0xE5A3,0xA4AC,0xACF4,0xFDBB,0xEDA4,
+	0x944B,0x54A5,0xA49C,0xA400,0x8003,0xC2A2,0xC003,0x9CAC,
+	0xA4A5,0x0000,0x6141,0x8002,0x0000,0x0000,0x5121,0x8002,
+	0xC2C3,0xC01E,0xACA3,0xAC5C,0xA49C,0x5C9C,0x9CA4,0x5CA4,
+	0x9BA5,0xACA4,0xE4AC,0xEDA4,0xECAC,0xEDAC,0xECAD,0xECAC,
+	0xACEC,0xAC00,0x8003,0xE405,0x0002,0xE404,0xDC24,0xDC24,
+	0x8002,0xDC43,0xC010,0x5C9C,0xA49C,0xA5DC,0xA4EC,0xACEC,
+	0xBBF3,0x64A4,0x954D,0x5400,0x8002,0xDC04,0xC00D,0xA5E4,
+	0xACED,0xACA5,0xACAB,0xEB5D,0x9CA3,0xA4AC,0x8002,0xECC5,
+	0xC017,0xA5E4,0x6CEC,0x6BAC,0x9494,0x945C,0x9C9C,0x9CA4,
+	0x9CA4,0xF5AD,0xF4F5,0xBCBC,0x7BAA,0x0001,0xF565,0xECA5,
+	0xC011,0x9C9C,0xA49C,0xACF5,0xF5B5,0x73B3,0x9C9C,0x9DA5,
+	0xB6B7,0xB7FF,0x0006,0xFEF7,0xFF7B,0xFFBD,0xFF9C,0xFF19,
+	0xF631,0xF5CB,0xC00C,0xAFE3,0x58E4,0xB4AB,0x5C8A,0x9DA5,
+	0xAB9C,0x1C00,0x0000,0x7BEF,0xC003,0xA4E4,0x64A4,0x0001,
+	0xF5C8,0xF5C8,0x8002,0xF5C7,0xC01D,0x9C9C,0xA4A5,0xA4AD,
+	0xB7B7,0xB7F4,0xADA4,0x9DAD,0x9C8A,0x51A3,0xACA3,0xA3A2,
+	0xB4DB,0x9494,0x8B52,0x9B5C,0x8002,0xECC6,0xC008,0xECB4,
+	0xB4B4,0xB4A5,0xDD95,0xA500,0x0000,0xA1A1,0xC005,0xA4EC,
+	0xA4AC,0xA4F4,0x8002,0xB241,0xC01B,0xADA3,0xA4E5,0xA3A4,
+	0xACA5,0xB4F3,0xFCFD,0xA49C,0x5394,0x549D,0xAC9C,0xA49C,
+	0xA4A5,0xA3A4,0xA5A4,0x0000,0x9202,0x8003,0x0000,0x0000,
+	0xC2E3,0xC00B,0x9CA4,0xACAC,0x639C,0xA49C,0x5C9C,0x9CA4,
+	0x8005,0xAA42,0xC00E,0xE4AC,0xECA5,0xECAC,0xEDAC,0xECAC,
+	0xEDAC,0xACAC,0xEC00,0x8003,0xE405,0x0002,0xE404,0xDC24,
+	0xDC24,0x8002,0xDC43,0xC00F,0x9C64,0xA494,0xE59C,0xE5AB,
+	0xACEC,0xBBF3,0x64A4,0x954C,0x8003,0xDC04,0xC025,0xA5E4,
+	0xACED,0xACA4,0xADA3,0xB3A4,0x9D9C,0xA3AC,0xACA4,0xA5E4,
+	0xA4AC,0xAC6B,0xAC94,0x945C,0x949C,0xA49C,0x9C9C,0xA4F5,
+	0xEDB4,0xEDBC,0x0004,0xFD88,0xFE07,0xF605,0xF565,0xECC5,
+	0xC011,0x959B,0xA49C,0xACF5,0xF5B5,0x73B3,0x9C9C,0x9DA4,
+	0xAEB7,0xBFB7,0x0006,0xFED6,0xFF5B,0xFFBD,0xFFBC,0xFF39,
+	0xF652,0xF5CB,0xC00F,0xAFA3,0x98E4,0xB4AB,0x5C8A,0x95B5,
+	0xA39C,0x63E4,0xA5AD,0x8002,0xF5A9,0x0000,0xF5C8,0x8002,
+	0xF5C7,0xC01D,0x9B9D,0xA4A5,0xA4B5,0xAFB7,0xB7F4,0xADA4,
+	0x9DAD,0x9C8A,0x59A3,0xA4A3,0xA3A3,0xB3DB,0x9C8C,0x8B52,
+	0x9364,0x8002,0xECC6,0xC008,0xECB4,0xB4BC,0xACE5,0x5DD5,
+	0x6500,0x8002,0xA1A1,0xC009,0xECA4,0xACAC,0xECAC,0xA4AD,
+	0xA4A3,0x8002,0xBA62,0xC00C,0xA3AD,0xACF4,0xB4FC,0xF4A4,
+	0x9B55,0x4B9D,0xE400,0x8002,0xC2C2,0x8004,0xC2A2,0x0001,
+	0xC2A3,0x6141,0x8003,0x0000,0x0000,0xC2C3,0x8003,0xC2E3,
+	0xC009,0x6BA4,0x9C9C,0x9C64,0x9C9C,0x5BA4,0x8003,0xAA42,
+	0xC034,0xE4A4,0xF4A5,0xACEC,0xEDAC,0xECAC,0xECAD,0xACAC,
+	0xECA4,0xACAC,0x9CA3,0xACAC,0xA4A3,0x64A4,0x9CA4,0x5CDD,
+	0x9CA4,0xECA4,0xF4B3,0xFBA4,0x649C,0x554D,0xA5A4,0xA3AD,
+	0x9CEC,0xADF5,0xE45C,0xB400,0x8002,0xECA6,0xC01A,0x9BA4,
+	0xACAC,0xA5AC,0xA4E4,0x6CEC,0x63AC,0x9C94,0x959B,0x5C9C,
+	0x9C9C,0x9CA4,0xEDB4,0xF5ED,0xBC00,0x0004,0xFD87,0xFE06,
+	0xF605,0xED65,0xECC5,0xC010,0x949C,0xA49C,0xACF5,0xF5B5,
+	0x73B3,0xA494,0x54E6,0xB5B7,0xB600,0x0007,0xF652,0xFEB5,
+	0xFF7A,0xFFDE,0xFFBD,0xFF59,0xF673,0xF5CD,0xC013,0xB59B,
+	0xD0AC,0xB4AC,0x935B,0x94A5,0xA363,0xA4E4,0xA5AD,0xEDA4,
+	0x63A4,0x8002,0xF5C7,0x0000,0xF5A7,0x8003,0xF587,0xC024,
+	0xAEB7,0xB7F6,0xB5AD,0xA49C,0xAE9C,0x8A51,0xABA4,0xAB9C,
+	0xAAAB,0xE394,0x8B8C,0x5293,0x649C,0xA4EC,0x64B4,0xF4BC,
+	0xACDD,0x65D6,0x6400,0x0000,0xA181,0xC00E,0xACA4,0xACE4,
+	0xA4AD,0xB3E4,0xA4AD,0xA4AC,0xA4E4,0xA400,0x8002,0xBA82,
+	0xC00D,0xB3ED,0xBBF5,0xF4A4,0x9C4C,0x539C,0xA5A4,0x9CA4,
+	0x8002,0xC2A2,0x0007,0xC2A3,0xC2A3,0x6961,0x2080,0x0000,
+	0x0000,0x38E0,0xC2C3,0xC003,0xACAC,0x9CAC,0x8002,0xC302,
+	0xC005,0x5C9C,0x5C9C,0x9CA4,0x8004,0xAA42,0xC00E,0xE4AD,
+	0xECA4,0xACEC,0xEDAC,0xECAC,0xADEC,0xACAC,0xEC00,0x8002,
+	0xE405,0x0002,0xE425,0xE425,0xE424,0x8002,0xE444,0x8002,
+	0xDC43,0xC020,0x5CDC,0x9D9C,0xA4E4,0xADF3,0xB3F3,0xACA4,
+	0x5C55,0x4DA5,0xA4A3,0xADA4,0xE4AD,0xF4E5,0x64AC,0xABA4,
+	0x9BA5,0xA4A3,0xAC00,0x8003,0xECE6,0xC012,0xECAC,0x63AC,
+	0x9C94,0x959C,0x5B9C,0x9C9C,0x9CA4,0xEDB4,0xF5ED,0xBC00,
+	0x0004,0xFD87,0xFE06,0xF605,0xF565,0xECC5,0xC011,0x959B,
+	0xA49C,0xACF5,0xF5B5,0x73B3,0xA494,0x54E5,0xAEB6,0xB7FF,
+	0x0006,0xFEB4,0xFF5A,0xFFDD,0xFFDD,0xFF5A,0xF694,0xF5EE,
+	0xC013,0xAC9B,0xD0AC,0xB4AC,0x935B,0x94A5,0xAC9A,0x64E4,
+	0xA5A5,0xF55C,0xABA4,0x8002,0xF5C7,0x0001,0xF5A7,0xF5A7,
+	0x8002,0xF587,0xC017,0xAEAF,0xB7FE,0xB5AC,0xA59C,0xAEA5,
+	0x8949,0xABAB,0x9CA4,0xA2EB,0xAB94,0x8C93,0x4A9B,0x8003,
+	0xECE6,0xC008,0xACAC,0xFCB4,0xACA5,0x95DD,0x5E00,0x0000,
+	0xA181,0xC00E,0xA4AC,0xA4AC,0xE4AC,0xACEC,0xA4AC,0xA4AD,
+	0xA3E5,0xAC00,0x8002,0xBA81,0xC00C,0xACAD,0xF3F4,0xFDB4,
+	0x9C54,0x8B5C,0xDDA4,0x6400,0x8002,0xC2C2,0xC005,0x9CA4,
+	0xA5A4,0xAC54,0x0002,0x89E2,0xAA83,0xC2E3,0xC00C,0xA4AC,
+	0x9CA4,0xACA3,0xA45C,0x9C5C,0x9C9C,0xA400,0x8004,0xAA42,
+	0xC00E,0xE4AD,0xEBA5,0xACEC,0xACED,0xECAC,0xACED,0xACAC,
+	0xEC00,0x8002,0xE405,0x0002,0xE425,0xE425,0xE424,0x8002,
+	0xE444,0x8002,0xDC43,0xC019,0x5CDC,0xA49D,0x9CEC,0xA4F4,
+	0xB3F4,0xABA4,0x6455,0x4D9D,0xA4AB,0xA5A4,0xE4AD,0xF4E5,
+	0xA463,0x8002,0xECC6,0xC003,0x9CA4,0xA3AC,0x8003,0xECE6,
+	0xC012,0xECAC,0x6BA4,0x9C94,0x9C95,0x5B9C,0x9C9C,0x9CA4,
+	0xEDB4,0xF5F5,0xB400,0x0004,0xFD87,0xFE07,0xF605,0xF565,
+	0xECC5,0xC011,0x959B,0xA49C,0xACF5,0xF5B5,0x73B3,0xA494,
+	0x55E4,0xADB7,0xB6B7,0x0004,0xFE94,0xFF5A,0xCE58,0xC5F7,
+	0x9CD2,0x8004,0x7BEF,0x0003,0x83EF,0xBD0C,0xBD0C,0xEDA9,
+	0xC003,0xEA94,0xADA4,0x8002,0xF586,0xC005,0xA5AD,0xEDA4,
+	0x63A4,0x8002,0xF5C7,0x0000,0xF5A7,0x8002,0xF587,0xC007,
+	0xACA6,0xB7AF,0xF67D,0xED0B,0x0004,0xBD51,0xDE14,0xFEB5,
+	0xFE73,0xF630,0x8002,0xF62F,0xC015,0xA3A2,0xEBAC,0x938C,
+	0x9352,0x9C5B,0x9CA4,0xE46C,0xB4F4,0xBCA4,0xA595,0xDD9E,
+	0x8002,0xA181,0xC01C,0xACA4,0xECA4,0xACAC,0xACE4,0xACA5,
+	0xACE4,0xA4AB,0xA4A5,0xA4AC,0xF4B3,0xFDF4,0xAC93,0x558C,
+	0x63DC,0x5C00,0x8004,0xC2C2,0xC00B,0x9CA5,0xACA4,0xA5E3,
+	0x6CAC,0xA49C,0xA4AC,0x8002,0xC302,0xC003,0x5C9C,0x9C5C,
+	0x8002,0xB262,0xC013,0x5CE4,0x64E4,0xA4EC,0xACED,0xACAD,
+	0xECEC,0xACAC,0xEDAC,0xECAC,0xACA4,0x8003,0xE425,0x8002,
+	0xE444,0xC011,0xAC5B,0xA49C,0x649C,0xDDA4,0xE4AD,0xA3FC,
+	0xF2AC,0xAC5C,0x554D,0x8002,0xDC04,0xC00A,0xADE4,0xA4AD,
+	0xECED,0xA46B,0xA4AC,0xA400,0x8002,0xECA6,0x0000,0xECC5,
+	0x8002,0xECE6,0xC014,0xE4AC,0xACAB,0xA464,0x9494,0x9C9C,
+	0x5C94,0x9CA4,0x9CED,0xB4F5,0xB5F4,0xBB00,0x0003,0xFE07,
+	0xF605,0xF565,0xECC5,0xC00F,0x949C,0xA49C,0xACF5,0xFDAD,
+	0xB373,0xA48C,0x94A4,0xB6AE,0x000B,0xACAE,0x73B0,0x326D,
+	0x00C6,0x0042,0x0021,0x0063,0x0129,0x09F0,0x0A10,0x09F2,
+	0x0A36,0xC003,0x6494,0x9CB5,0x0004,0x1A77,0x4334,0x8C2F,
+	0xD529,0xED86,0xC009,0xE4A4,0xADA5,0xEDA4,0x639C,0xABA4,
+	0x8002,0xF5A7,0xC006,0x9CA4,0xACA6,0xAEB7,0xFF00,0x0005,
+	0x42AE,0x012D,0x012D,0x014C,0x7BF0,0xFEB6,0xC00E,0x9151,
+	0xA3AC,0x9CA3,0xA3AB,0xF393,0x8C8B,0x529C,0x5B00,0x8002,
+	0xECE6,0xC008,0xB4AC,0xFCB4,0xA4A5,0x95DE,0x9D00,0x8004,
+	0xA181,0xC01B,0xADEB,0xACAD,0xACE3,0xA4AD,0xACE4,0xA4AB,
+	0x9CAC,0xA4A5,0xACF4,0xF3FD,0xB4A4,0x9454,0x9B5C,0xDC65,
+	0x8003,0xC2C2,0xC012,0x9DA4,0xAC9C,0xACA4,0xACAC,0x9CA4,
+	0xACA4,0xA3AC,0x5C9C,0x9C9C,0x5C00,0x8002,0xB262,0xC013,
+	0x9C64,0xE4A4,0xACA4,0xECAD,0xECAD,0xECAC,0xECAC,0xE5AC,
+	0xB4EC,0xACA4,0x8003,0xE425,0x8002,0xE444,0x0000,0xE463,
+	0x8002,0xDC43,0x0001,0xDC23,0xDC04,0x8002,0xDBE4,0xC032,
+	0xE5F3,0xACF3,0xB3AC,0x5C95,0x555C,0x9DA3,0xADE4,0xA4AD,
+	0xECAD,0xE464,0xF36C,0xA49C,0x9BA5,0xABAD,0xA4E4,0xA46C,
+	0xEC6C,0xEB64,0x948C,0x9C9C,0x5C94,0xA49C,0x9CAC,0xF5F5,
+	0xB5F4,0xBB00,0x0003,0xFDE7,0xF606,0xF585,0xECE5,0xC00D,
+	0x8DA4,0x9B9C,0xACF5,0xFDAD,0xB3B3,0x6494,0x8CA4,0x000D,
+	0x9C4E,0x2AF4,0x0A53,0x0A11,0x018D,0x00E6,0x0042,0x0021,
+	0x0063,0x0108,0x09EF,0x01F1,0x09F1,0x0A56,0xC007,0x5C94,
+	0x9CB6,0xF4A4,0xA3AD,0x0002,0x4B34,0xBCCB,0xF5A6,0xC007,
+	0xA5A5,0xEDA4,0x639C,0xABA4,0x8003,0xF5A7,0xC005,0x9CA4,
+	0xAEB6,0xF7AF,0x0005,0x016D,0x012D,0x012D,0x014C,0x7BF0,
+	0xFEB6,0xC01A,0x9151,0xA4AB,0xA49B,0xA3AB,0xF393,0x8C8B,
+	0x5392,0x649C,0xA3AD,0xACF4,0xB4B4,0xEC5D,0x96DD,0x9D00,
+	0x8004,0xA181,0xC00D,0xACA4,0xACF5,0xA4AB,0xE4AC,0xA5AC,
+	0xA3E4,0xADA4,0x8002,0xBA81,0xC00B,0xF4AC,0xFDFC,0xEC5C,
+	0x9C53,0x9D94,0xA464,0x8002,0xC2C2,0x8002,0xC2C3,0xC005,
+	0x9CA4,0xACAC,0xE464,0x8002,0xC303,0xC00A,0xACA4,0x9B5C,
+	0x9C9C,0x649C,0xA49C,0xA400,0x8002,0xB242,0xC00F,0xACE4,
+	0xACAD,0xECA4,0xEDB4,0xE4AC,0xEDAC,0xB4EC,0xACA4,0x8003,
+	0xE425,0xC03E,0xB49B,0xACA4,0xA364,0x9C9C,0x9DA4,0x9CA4,
+	0xE5EB,0xB4FB,0xABAC,0x5C9D,0x5554,0xA59B,0xADE4,0xA4AC,
+	0xEDAD,0xE464,0xB3AC,0xA49C,0x9CAC,0xA4AC,0xA4E4,0xA46C,
+	0xEC6C,0xEBA4,0x5494,0x949C,0x5C9C,0x9C94,0xA4AC,0xF5F5,
+	0xB5F4,0xBB00,0x0003,0xFDE7,0xF606,0xF585,0xECE5,0xC00B,
+	0x8DA4,0x9B9C,0xACF5,0xFDAD,0xB3B3,0x5C94,0x0002,0xC4AA,
+	0x3B55,0x0AD8,0xC003,0x929A,0x8948,0x0008,0x00E7,0x0042,
+	0x0000,0x0042,0x00E7,0x09CE,0x01F0,0x09F1,0x0A56,0xC009,
+	0x5C94,0x9DB5,0xF4AC,0xA39C,0xAE9C,0x0002,0x5373,0xE568,
+	0xF5A8,0xC005,0xE5AC,0x639C,0xABA4,0x8004,0xF5A7,0xC004,
+	0x9DAD,0xAEF7,0xB600,0x0005,0x016D,0x012D,0x012D,0x014C,
+	0x7BEF,0xFEB5,0xC01A,0x9251,0xA3AC,0xA49B,0xABEB,0xAB94,
+	0x8B8B,0x5392,0x649C,0xA4AC,0xECAC,0xBCB4,0xEC5D,0x95DE,
+	0x9D00,0x0000,0xA1A1,0x8003,0xA181,0xC036,0xACA5,0xACEC,
+	0xACAC,0xE4A3,0xACA4,0xACE4,0xACA5,0xA3A5,0xA3EC,0xACFD,
+	0xBCF3,0xED54,0x945C,0x949C,0xA464,0xA49C,0xA4A5,0xA49C,
+	0xA4AC,0xECAC,0x5CAC,0xE464,0xACA3,0x9C64,0x9C9C,0x5C9C,
+	0xA49C,0xA400,0x8002,0xB242,0xC010,0xACE4,0xA4B5,0xECA4,
+	0xEDAC,0xECAC,0xEDAC,0xB4EC,0xACA4,0xAD00,0x8002,0xE425,
+	0x0000,0xE445,0x8002,0xE464,0xC013,0x63A4,0x9CA4,0x9C9D,
+	0x9CE4,0xA5AB,0xF4F3,0xB3AC,0xA45D,0x4D54,0xA5A4,0x8002,
+	0xE425,0xC007,0xACED,0xADE4,0xA46C,0xB3A4,0x8003,0xECC6,
+	0xC017,0xACA4,0xE4A4,0xACAC,0xACAB,0xA454,0x9494,0xA454,
+	0x9C9C,0x94A4,0xACF5,0xF5B5,0xF4BC,0x0003,0xF5E7,0xF606,
+	0xF585,0xECE5,0xC00A,0x8DA4,0x9B9C,0xACF6,0xFCAD,0x73F3,
+	0x6400,0x0001,0xC4EA,0x1AF8,0xC005,0x259B,0xDB52,0x9148,
+	0x0008,0x0108,0x0042,0x0000,0x0042,0x00E7,0x09AD,0x09EF,
+	0x09F1,0x0A56,0xC00A,0x9C54,0x9CF6,0xB4AC,0xA39C,0xAD9D,
+	0xAC00,0x0005,0x32F5,0xE589,0xFDC9,0xFDC9,0xF5C8,0xF5A8,
+	0x8002,0xF5C7,0x8003,0xF5A7,0xC004,0x9DAC,0xAFB7,0xF700,
+	0x0005,0x016D,0x012D,0x012D,0x014D,0x7BEF,0xFED5,0xC01A,
+	0x8A51,0xA3AC,0xA49B,0xABAB,0xEC93,0x8B8B,0x539B,0x5B9C,
+	0xA4EC,0xACB4,0xB4B4,0xEC5D,0x96DD,0x9D00,0x0000,0xA1A2,
+	0x8003,0xA181,0xC00F,0xACA4,0xADEB,0xADA4,0xABE4,0xACA5,
+	0xABA5,0xABE5,0xA3A4,0x8002,0xBAA1,0xC012,0xF5FC,0xFCF4,
+	0x6493,0x5594,0x9BA4,0x9DA4,0x64A4,0xA59C,0xA4E5,0xA400,
+	0x8004,0xCAE3,0xC007,0xAC64,0xA4AB,0x5C9C,0x9CA4,0x8002,
+	0xB282,0x0000,0xB262,0x8003,0xB242,0xC00E,0xB4E4,0xADEC,
+	0xACEC,0xA5AC,0xECEC,0xADB4,0xECAC,0xA400,0x8004,0xE445,
+	0x8002,0xE464,0xC013,0x63A4,0x9CA4,0x9C9D,0x9CA4,0xE5AB,
+	0xF4F3,0xABB4,0xA45D,0x5455,0x94A4,0x8003,0xE425,0xC006,
+	0xB5ED,0xE4A4,0xACAC,0x6B00,0x8003,0xECC6,0xC00F,0xACAC,
+	0xE464,0xECA4,0xACAB,0x649C,0x8C9C,0x94A4,0x5C94,0x8002,
+	0xE405,0xC004,0xF5F5,0xF5B4,0xBC00,0x0003,0xFDE7,0xF606,
+	0xF585,0xECE5,0xC009,0x8DA4,0x9B9C,0xADF5,0xF4B5,0x73B3,
+	0x0001,0xC4EA,0x1AD8,0xC006,0x2DE4,0x9B5B,0x9391,0x8800,
+	0x0008,0x0109,0x0042,0x0000,0x0021,0x00C6,0x09AD,0x09CF,
+	0x09D1,0x0A55,0xC00B,0x5D94,0xE5AD,0xACB4,0xA39D,0xADDC,
+	0x6C9B,0x0004,0x32F4,0xED8A,0xFDC9,0xF5C8,0xF5C8,0x8002,
+	0xF5C7,0x8003,0xF5A7,0xC004,0xA5A4,0xAFB7,0xF600,0x0005,
+	0x014D,0x012C,0x012D,0x014C,0x7BEF,0xFED6,0xC01A,0x9249,
+	0xA2B4,0xA49C,0xA3EA,0xB394,0x838B,0x529C,0x5B9C,0xA4EC,
+	0xACB4,0xB4FC,0x659C,0xD69D,0x9D00,0x0000,0xA1A1,0x8003,
+	0xA181,0xC014,0xACA4,0xACED,0xA4AC,0xACA3,0xE4AD,0xA4AC,
+	0xA4EB,0xA5A4,0xA3AC,0xA4ED,0xB400,0x0000,0xD362,0xC007,
+	0xBCEC,0x5C94,0x539D,0x9B9D,0x8002,0xC2E2,0x0000,0xC2E3,
+	0x8002,0xC2C3,0x8004,0xCAE3,0xC00D,0xACA4,0xACA4,0x64A3,
+	0x9C5C,0x9C5C,0x9CA4,0x9CA4,0x8002,0xB242,0xC013,0xB4E4,
+	0xACED,0xACEC,0xA5AC,0xECAC,0xEDAC,0xF4AC,0xACA4,0xAC9C,
+	0xACA4,0x8002,0xE464,0xC013,0xAB5C,0xA49C,0x9CA4,0x95A4,
+	0xE5AB,0xF4F3,0xB3A4,0xAC5D,0x5495,0x54A4,0x8003,0xE425,
+	0xC01A,0xF5AD,0xA4E4,0xACAC,0xAB5C,0xA3A5,0xA4AC,0xACE4,
+	0x64EC,0xA4AC,0xABA4,0x5C94,0x9494,0xA45C,0x9400,0x8002,
+	0xE405,0xC004,0xF5F5,0xBDEC,0xBC00,0x0003,0xF5E7,0xF606,
+	0xF585,0xECE5,0xC009,0x8DA4,0x9CA3,0xA5F5,0xF4AD,0x7BB3,
+	0x0001,0x32F5,0x0AB9,0xC006,0xB4E4,0x9B63,0x9391,0x8100,
+	0x0008,0x0129,0x0062,0x0000,0x0021,0x00C5,0x098C,0x09EF,
+	0x09F1,0x0A56,0xC00C,0x9C54,0xDDB5,0xACB4,0x9BAD,0xA49D,
+	0xACA3,0x9B00,0x0003,0x73B0,0xFDC9,0xFDC8,0xF5C8,0x8002,
+	0xF5C7,0x8002,0xF5A7,0x8002,0xF5A8,0x0008,0xF5CA,0xFE0D,
+	0xFE50,0x014D,0x012D,0x012D,0x012C,0x7BF0,0xFED5,0xC007,
+	0x9391,0x5BAB,0xACDC,0x5BF2,0x0003,0xCDAD,0x3292,0x32B3,
+	0xED69,0xC00E,0xDB9B,0x5B9C,0xACE4,0xACB4,0xBCB4,0xA59D,
+	0xD59D,0x9D00,0x8004,0xA1A1,0x8002,0xA1A2,0xC019,0xACEC,
+	0xA4AC,0xA4AC,0xECA4,0xACA4,0xE4AB,0xA4A5,0xA3AD,0xACEB,
+	0xFDFC,0xECA4,0x5C94,0x5C9C,0x8004,0xCAE2,0xC003,0xA59C,
+	0x64E4,0x8002,0xCAE3,0x8002,0xCB03,0x0000,0xCB23,0x8002,
+	0xC323,0xC006,0x9B9C,0x6494,0xA45C,0xA400,0x8003,0xB262,
+	0xC037,0xACE4,0xACED,0xA4AC,0xEDAC,0xECAD,0xECAC,0xF4AC,
+	0xACAC,0xE4A4,0x64AC,0xA3A4,0xACA3,0x649C,0x9CA4,0x9D9C,
+	0x9CE4,0xADEC,0xF2B3,0xACAC,0x5D5D,0x9454,0xE4A4,0xA5A4,
+	0xACA5,0xF5EC,0x9CAC,0xB3A4,0x649C,0x8002,0xECE6,0xC016,
+	0xACE4,0xA4AD,0xABA4,0xACAB,0x9D53,0x8C9C,0x9C5C,0x9C94,
+	0xA4A5,0xEDFC,0xBDEC,0xBC00,0x0003,0xFDE7,0xF606,0xF585,
+	0xECE5,0xC008,0x8DA4,0x9BA5,0xA4F5,0xF5B4,0x7300,0x0001,
+	0x9C6D,0x0A79,0xC007,0xB4B4,0xAC9B,0x9B93,0x9288,0x000E,
+	0x014A,0x0063,0x0000,0x0021,0x00A4,0x018B,0x01CE,0x09D1,
+	0x0A56,0x32D4,0x7BEF,0x73B1,0x42F4,0x2AB6,0x0A78,0xC007,
+	0xA3A5,0xA49D,0xA4AB,0x5B9B,0x0002,0xBCEC,0xFDC8,0xF5C8,
+	0x8002,0xF5C7,0x8002,0xF5A7,0x8002,0xF5A8,0x0008,0xF5CA,
+	0xF60D,0xFE4F,0x016E,0x012D,0x012D,0x014D,0x7BEF,0xFED5,
+	0xC006,0x9391,0x63AB,0xA4DC,0x6300,0x0006,0xCD8D,0x11B3,
+	0x0194,0x01F5,0x32F4,0xE529,0xF547,0xC00C,0x9364,0xA4E4,
+	0x6CFC,0xBCF4,0x9D9D,0x559D,0xDD00,0x8004,0xA1A1,0x8002,
+	0xA1A2,0xC01A,0xACEC,0xA4AC,0xA4AC,0xE4AB,0xA5A4,0xACEB,
+	0xA4A5,0xA3AD,0xA3F5,0xF3F5,0xB4EC,0xA453,0x5D94,0x9C00,
+	0x8003,0xCAE2,0xC008,0xA59C,0x64E4,0xACA4,0xACA4,0xA500,
+	0x8002,0xCB23,0xC006,0x64A3,0x9CA4,0x5C9C,0x9C00,0x8003,
+	0xB282,0xC011,0x9CA4,0xACE4,0xA4F5,0xA4AC,0xEDAC,0xECAD,
+	0xE4B4,0xF4AC,0xACAC,0x8002,0xEC45,0xC036,0x6CA4,0xABA4,
+	0xA3A4,0x5C9C,0xA49D,0x9C9C,0xE5AC,0xEBF3,0xB3AC,0xAC5D,
+	0x654C,0x94A4,0xA5E4,0xA4AC,0xA4F5,0xED9C,0xACAB,0xAC64,
+	0x9CAC,0xA4AC,0xA4E4,0xA4AD,0xABA4,0xB4A3,0x9C54,0x9494,
+	0x9C5C,0x9C00,0x8002,0xE405,0xC004,0xF5F5,0xBDF4,0xB400,
+	0x0003,0xFDE7,0xF606,0xF585,0xECE5,0xC008,0x959C,0x9BA5,
+	0xA4F5,0xF5B4,0x7300,0x0001,0x22B7,0x0A79,0xC004,0xB4F4,
+	0x6C9B,0xDB00,0x0014,0x2AF5,0x8C2F,0xBCEF,0xFEB5,0xFF9C,
+	0xFFFF,0xCE79,0x8C71,0x220C,0x09CE,0x09F0,0x0A36,0x0236,
+	0x9C8E,0xF628,0xF5E8,0xF5C7,0xD529,0x9C4D,0x32F5,0x0A58,
+	0xC004,0xA5AC,0x9B63,0x9B00,0x0001,0x5352,0xF5C8,0xC006,
+	0xE463,0xA49B,0xA5EC,0x5C00,0x8002,0xF5A8,0x0008,0xF5CA,
+	0xF5ED,0xFE4F,0x016E,0x012D,0x012D,0x014D,0x7BEF,0xFED5,
+	0xC005,0x9391,0x62AC,0xA49C,0x0001,0xCD6E,0x11D2,0xC003,
+	0x05B5,0xBDBD,0x0002,0x1AB6,0xF547,0xF526,0x8002,0xED06,
+	0xC008,0xECBC,0xBCF5,0x9C9D,0x955D,0xDD00,0x8006,0xA1A1,
+	0x0001,0xA1A2,0xA9C2,0x8002,0xA9E2,0xC004,0xACA4,0xACE4,
+	0xAC00,0x8002,0xB262,0xC00E,0xECA4,0xACA3,0xA4ED,0xB3F4,
+	0xFDEC,0xAC5C,0x9453,0x9400,0x8004,0xCAE2,0x0000,0xCAE3,
+	0x8002,0xCAC3,0xC003,0xB5A3,0xA4AD,0x8003,0xCB23,0xC005,
+	0x639C,0xA45D,0x9B9C,0x8004,0xB282,0xC010,0x9CAC,0xE4A5,
+	0xACEC,0xACED,0xACED,0xACE4,0xB4F4,0xACAC,0xAC00,0x8002,
+	0xEC45,0x0001,0xE465,0xE465,0x8002,0xE484,0xC013,0xA35C,
+	0xA49C,0x9CA5,0x94A5,0xECEB,0xF3B3,0xACAC,0x659C,0x554D,
+	0xE3A5,0x8002,0xE445,0xC007,0xACE5,0xEDA4,0xACAB,0xACA4,
+	0x8002,0xECE6,0xC017,0xACA4,0xECA4,0xA5AC,0xABAC,0x639C,
+	0x9494,0x949C,0x6494,0x9C9C,0xA4F5,0xF5BD,0xF4B4,0x0003,
+	0xFDE7,0xF606,0xF585,0xECE5,0xC007,0x959C,0x9B9C,0xACFD,
+	0xF6AC,0x0003,0xDD29,0x0A59,0x0A79,0x0AB9,0x8002,0x0AF9,
+	0x0010,0x63B1,0xE529,0xF58A,0xFDCD,0xFEB4,0xFF9C,0xFFFF,
+	0xFFFF,0xFF7B,0xE674,0x3A8E,0x01F0,0x0255,0x0237,0x01F6,
+	0xDD8A,0xF608,0xC003,0x9394,0xADA4,0x0001,0x7BEF,0x0A59,
+	0xC004,0xA4A3,0xA35B,0xA400,0x0001,0xF5C8,0xF5C8,0x8003,
+	0xF5C7,0x0001,0xF5A7,0xF5A7,0x8002,0xF5A8,0x0008,0xF5CA,
+	0xF60D,0xFE4F,0x016E,0x012D,0x012D,0x014D,0x7C0F,0xFEB5,
+	0xC004,0xA349,0x9AB4,0xA400,0x0008,0xACEF,0x1211,0x0192,
+	0x0173,0x0174,0x01F4,0x0256,0x3314,0xF547,0xC004,0x5BA4,
+	0x9CEC,0xA400,0x0000,0xF5A6,0xC006,0xB4B4,0xE595,0x969C,
+	0x9D00,0x8006,0xA1A1,0x0001,0xA1A2,0xA1C2,0x8003,0xA9E2,
+	0x0002,0xAA02,0xAA22,0xB222,0x8002,0xB242,0x0000,0xB262,
+	0x8002,0xBA82,0xC00B,0xA3AC,0xECAD,0xF4FC,0xF4AC,0xA494,
+	0x5454,0x8002,0xCB02,0xC009,0x9CA4,0xA5A4,0x9CA4,0xB4A4,
+	0xA5A4,0x8003,0xCB23,0xC006,0x64A3,0x9C64,0x94A4,0x9C00,
+	0x8005,0xB282,0xC00E,0xE4A5,0xACEC,0xACEC,0xADEC,0xA5EC,
+	0xB4AC,0xF5A3,0xAC00,0x8002,0xEC45,0xC018,0x6CA4,0xABA4,
+	0xAC9B,0xA45C,0xA49D,0x94A4,0x9CE5,0xF4F2,0xB4AB,0xAC65,
+	0xA455,0x4DDB,0xA500,0x8002,0xE445,0xC007,0xACE5,0xADEC,
+	0xA4AC,0xABAC,0x8002,0xECE6,0x8002,0xED06,0xC014,0xECA5,
+	0xACAB,0xACAB,0x9D4B,0x9D93,0x9C9C,0x549C,0x9CA4,0xF5F5,
+	0xBDF4,0xB400,0x0005,0xFDE7,0xF606,0xF585,0xECE5,0xECA6,
+	0xECA6,0x8002,0xEC65,0x0004,0xF4E7,0xFD08,0xFD28,0xAC8C,
+	0x0A59,0xC003,0xACB4,0xB4A4,0x0011,0x4374,0xF507,0xF548,
+	0xF569,0xFDCD,0xFE93,0xFF7B,0xFFFF,0xFFFF,0xFF9C,0xFED6,
+	0xEE12,0x1210,0x0A35,0x0237,0x01F6,0x6371,0xF608,0xC004,
+	0x939C,0x9DAC,0xA300,0x0001,0x5353,0x0A59,0xC003,0xA39B,
+	0x63A4,0x0001,0xBCCC,0xF5C8,0xC00B,0xA3A4,0x9CAC,0xE4A4,
+	0x9C65,0xA4EE,0x77F6,0x0005,0x016E,0x012D,0x012D,0x014D,
+	0x7BEF,0xFEB5,0xC003,0xA389,0x5AB4,0x0001,0x9CAF,0x01AF,
+	0xC003,0xAD96,0x9DA4,0x0003,0x01F4,0x32F4,0xE549,0xF546,
+	0xC00C,0x9C5C,0xA4EC,0xACBC,0xBCAC,0xA5D5,0x959D,0x9D00,
+	0x8002,0xA1C1,0x8003,0xA1A1,0x0001,0xA1C2,0xA1C2,0x8002,
+	0xA9E2,0xC003,0xACA4,0xACE4,0x8002,0xB242,0xC012,0xACA4,
+	0xE4AC,0xA4AC,0xA4EC,0xB4F4,0xFBF4,0xA59C,0x5454,0x9C9B,
+	0xA500,0x8002,0xCAE2,0xC006,0xA5A4,0x9CB4,0xA4A5,0xA300,
+	0x8002,0xCB23,0xC009,0xAC64,0x9BA4,0x5C9C,0x9C9C,0x64DC,
+	0x8004,0xB282,0xC029,0xE5AC,0xECAC,0xECAD,0xECAD,0xECAC,
+	0xACF5,0xABA4,0xECA4,0xACA4,0x64EC,0x63AC,0xA39C,0x9C64,
+	0x9D9C,0x9C9C,0xE5F3,0xF3B4,0xABAC,0xA564,0x5654,0x93E5,
+	0x8003,0xE445,0xC009,0xEDAD,0xECA4,0xACB4,0xA39C,0x64A4,
+	0x8002,0xED06,0xC014,0xECA5,0xACAB,0xACAB,0x5C94,0x9494,
+	0x9C9C,0x549C,0x9CA4,0xF5F5,0xBDF4,0xB400,0x0003,0xFDE7,
+	0xF606,0xF5A5,0xECE5,0xC007,0x95A4,0x939C,0xB5F5,0xF5AC,
+	0x0001,0x8410,0x0A59,0xC003,0xACB4,0xB4A4,0x0011,0xBC8B,
+	0xF507,0xF528,0xF569,0xF5CC,0xFE93,0xFF7A,0xFFFF,0xFFFF,
+	0xFF9D,0xFED6,0xF653,0x636F,0x0235,0x0237,0x01F6,0x09D7,
+	0xF608,0xC004,0x939C,0xA5A3,0xA400,0x0001,0xD549,0x0A59,
+	0xC003,0xA39B,0x63A4,0x0001,0x8C2F,0xF5C8,0x8003,0xF5C7,
+	0xC007,0xE4A4,0x9C65,0xA4AE,0xAEB7,0x000A,0x016E,0x012D,
+	0x012D,0x012C,0x7BEF,0xFEB5,0xFEB4,0xFE51,0xF62F,0x9C8F,
+	0x0990,0xC004,0x6CA4,0x9D9E,0xA400,0x0001,0x2AB2,0xED8A,
+	0xC00E,0xDA9B,0x9B64,0x9CEC,0xACBC,0xBCAD,0xA4D5,0x959D,
+	0x9D00,0x0000,0xA1E1,0xC00A,0x9CA4,0x9DA3,0xA4A5,0xACA4,
+	0xE4AC,0xA400,0x8002,0xAA02,0xC016,0xACE4,0xA4AC,0xA4AC,
+	0xE4A4,0xACEC,0xA4A3,0xB5F4,0xFCB3,0xF49C,0x9554,0x549C,
+	0xA400,0x8002,0xCAE2,0x8003,0xCAE3,0xC00F,0xACA5,0xA3A5,
+	0xA3AC,0xACA4,0x5BA5,0xA35C,0x94A4,0x9CA4,0x8003,0xB282,
+	0xC00F,0xE4A5,0xACEC,0xACAC,0xEDEC,0xA4F5,0xA4B4,0xECAC,
+	0xACEC,0x8002,0xEC65,0xC00D,0xACA4,0xA36C,0xA35C,0xA49C,
+	0x9C9D,0x94A5,0xE4B3,0x0000,0xF463,0xC008,0xB3A4,0xACAD,
+	0x655C,0x4DDB,0xA400,0x8002,0xE445,0x0002,0xE465,0xEC66,
+	0xEC86,0x8002,0xF4A7,0xC014,0xB4AB,0x64DC,0xA464,0xACA4,
+	0xACE5,0xACA3,0xB4AC,0xA394,0x4C94,0x9C94,0x5C00,0x8002,
+	0xE425,0xC004,0xEDF5,0xBDF4,0xB400,0x0003,0xFDE7,0xF606,
+	0xF585,0xECE5,0xC007,0x949D,0x9B9C,0xB5F5,0xF5AC,0x0001,
+	0x7BEF,0x0A39,0xC003,0xACBC,0xB4AC,0x0000,0xF4E6,0xC003,
+	0xADAC,0xB6F6,0x000D,0xFE72,0xFF7B,0xFFDE,0xFFFF,0xFFBD,
+	0xFEF7,0xFE73,0x7BEF,0x0235,0x0216,0x01F6,0x09D7,0xBD0B,
+	0xF5C7,0xC004,0x9CA5,0xA4A3,0xA300,0x0000,0x0A58,0xC003,
+	0x9CA3,0x63A4,0x0001,0x7BEF,0xF5C8,0xC00B,0xA3A3,0xA4A5,
+	0xE464,0xA4DD,0x64AD,0xAFB7,0x0008,0x016E,0x014D,0x012D,
+	0x012D,0x7BEF,0xFEB5,0xFEB4,0xFE51,0x944F,0x8002,0x0990,
+	0x0008,0x01B0,0x0191,0x0152,0x5311,0xEDCC,0xFDA9,0xF588,
+	0xF567,0xF527,0x8002,0xED26,0xC008,0xF4BC,0xB4AC,0xDD9E,
+	0x959C,0x9D00,0x0000,0xA1E1,0x8002,0xA1C1,0x0002,0xA1A2,
+	0xA1A1,0xA1A2,0x8002,0xA1C2,0x0001,0xA9E2,0xA9E2,0x8002,
+	0xAA02,0xC016,0xACE4,0x64E4,0xACA4,0xACEC,0xA4AC,0xE4AC,
+	0xACEC,0xB4FC,0xFB9C,0x9D54,0x945C,0x9B00,0x8002,0xCAE2,
+	0x8003,0xCAE3,0x8003,0xCB04,0xC00A,0xA3AC,0xACA4,0x649C,
+	0xA35C,0x949C,0xA400,0x8004,0xB282,0xC011,0xE4A4,0xADEC,
+	0xACAC,0xE5F4,0xACA5,0xECB4,0xECAC,0xACEC,0xADA3,0x8002,
+	0xEC85,0xC00B,0xA36C,0xA39C,0x649C,0x9C9D,0x94A4,0xE5AC,
+	0x0000,0xF463,0xC006,0xABAC,0xACAC,0x665C,0x5400,0x8002,
+	0xE445,0xC00C,0xAC9C,0xACA4,0xEDED,0xA5A3,0xB4A3,0x6CA4,
+	0xDC00,0x8002,0xED06,0xC00C,0xEDAC,0xA4AB,0xACAC,0x63D5,
+	0x538C,0x9C9C,0x5C00,0x8002,0xE425,0xC004,0xEDF5,0xBDF4,
+	0xB400,0x0003,0xFDE7,0xF606,0xF5A5,0xECE5,0xC007,0x94A5,
+	0x94A3,0xA5FD,0xF5B4,0x0001,0x8410,0x0A38,0xC003,0xADBC,
+	0xB4AC,0x0012,0xE4C7,0xF507,0xF527,0xF568,0xFD8A,0xFE72,
+	0xFF5A,0xFFFE,0xFFFF,0xFFBD,0xFEF7,0xFE73,0x636F,0x0235,
+	0x0216,0x01F6,0x09F7,0xBD0B,0xF5C7,0xC004,0x9CA5,0xA4A3,
+	0x1400,0x0000,0x0A59,0xC003,0x9BA3,0x5BAC,0x0001,0x7BEF,
+	0xFDE8,0x8006,0xF5C7,0xC004,0xDD64,0xADAF,0xB600,0x0008,
+	0x016E,0x014D,0x012D,0x012D,0x6BAF,0xFEB5,0xFEB4,0x636F,
+	0x09AF,0x8002,0x0990,0x0003,0x01B0,0x0991,0x5B50,0xFE8C,
+	0xC010,0x8B42,0x9B9B,0x54A3,0xA4E4,0xB4BC,0xBCA4,0xDD9E,
+	0x959D,0x9C00,0x0000,0xA9E1,0xC00A,0x64A4,0x9C9C,0xA4AC,
+	0xA4A5,0xA4EC,0xA400,0x8003,0xAA02,0x8002,0xAA22,0xC011,
+	0xECA4,0xACEC,0xA4AC,0xE4AC,0xA4F3,0xACFD,0xFCAB,0x9D9C,
+	0x4C94,0x8003,0xCB02,0xC013,0xA59C,0xA4AC,0xA4A5,0xA4E4,
+	0x64AB,0xACA4,0xA365,0x9C9B,0x5D9B,0x9CA4,0x8003,0xB282,
+	0xC011,0xE4AC,0xA5EC,0xACAC,0xE5F4,0xACED,0xA4AC,0xF4AC,
+	0xACAC,0xEDA3,0x8002,0xEC85,0xC00B,0xACA3,0x6C9B,0x9C5C,
+	0x9C9D,0x9CA4,0xDDAB,0x0000,0xF463,0xC006,0xABAC,0xACAC,
+	0x6E5C,0x8C00,0x8003,0xE445,0x8002,0xE465,0xC020,0xEDED,
+	0xA5A3,0xB4AB,0xA464,0xDC6C,0xA4EC,0xAD9C,0xACAB,0xACAC,
+	0x64DC,0x4B94,0x949C,0x5C9C,0x9CA4,0xEDFD,0xB5F4,0xB400,
+	0x0003,0xFDE7,0xF606,0xF585,0xECE5,0xC007,0x94A5,0x9C9C,
+	0xACFE,0xF5AC,0x0001,0xAC8D,0x0A38,0xC003,0xADBC,0xB4AC,
+	0x0012,0x9C2D,0xF507,0xF527,0xF547,0xF58A,0xF651,0xFF5A,
+	0xFFDE,0xFFFF,0xFFDD,0xFF18,0xEE33,0x11EF,0x0235,0x0216,
+	0x01F6,0x09D7,0xBD0B,0xF5C7,0xC003,0x9CA5,0xA4A3,0x0001,
+	0x840F,0x0A38,0xC003,0xAC9B,0x5BAC,0x0004,0x8C2F,0xF5C8,
+	0xF5C7,0xF5C6,0xF5C6,0x8003,0xF5C7,0xC004,0xE55C,0xA5B7,
+	0xB600,0x0007,0x018E,0x014D,0x012D,0x014D,0x11AD,0x9CB1,
+	0x42AD,0x01AE,0xC004,0xA6DC,0xA365,0xAC00,0x0001,0x6370,
+	0xFEAD,0xC011,0x9C8A,0x8B52,0x9B9C,0x639C,0xECAC,0xBCBC,
+	0xA4DD,0x969C,0x9E9C,0x0002,0xA9E1,0xA9E1,0xA1E1,0x8005,
+	0xA1C1,0x0002,0xA1C2,0xA9E2,0xA9E2,0x8003,0xAA02,0xC015,
+	0xAC9C,0xACE4,0xACAC,0xACE3,0xADA4,0xE4AC,0xACEC,0xFCFB,
+	0xB4A5,0x9C4C,0x945C,0x8002,0xCB02,0xC014,0xA59C,0xACA5,
+	0x9CAC,0xA4EC,0x64A3,0xB49C,0xAC5C,0xA49B,0x9563,0x9CA4,
+	0x9D00,0x8002,0xB282,0xC020,0xE4AC,0xA5EC,0xACEC,0xADE4,
+	0xB4A4,0xEDAC,0xF4AC,0xB5E3,0xACA4,0xACA4,0xACA4,0xA36C,
+	0x9BA4,0x5C9C,0x9D9C,0x94E5,0xAC00,0x0000,0xF463,0xC008,
+	0xABAC,0xACAC,0x6D5D,0x54D5,0x9C00,0x8004,0xE465,0xC02C,
+	0xEDED,0xA5A3,0xB4AB,0xA464,0xDC6C,0xA4EC,0xA5AC,0xA4AB,
+	0xACAC,0xA49B,0x954B,0x9D9B,0x5C94,0x9CA4,0xEDFD,0xF5B5,
+	0xBBBB,0x6B83,0x8454,0x9D9C,0x9CB5,0xFDED,0xB400,0x0001,
+	0xDD2A,0x0A18,0xC003,0xB5BC,0xB4AC,0x0011,0x1B18,0xC4AA,
+	0xF527,0xF548,0xF569,0xFE50,0xFF3A,0xFFFE,0xFFFF,0xFFBD,
+	0xEEB7,0x324D,0x09AE,0x0235,0x0237,0x01F7,0x09D7,0xF608,
+	0xC003,0x939C,0xA515,0x0001,0x7BF0,0x0A59,0xC004,0xA49B,
+	0x639B,0xAC00,0x0001,0xBCEC,0xF5C8,0xC00B,0xA3A4,0xA3A5,
+	0xA4AC,0x9CE5,0x5CAD,0xEF76,0x0001,0x326F,0x014E,0xC009,
+	0x9BAC,0xAC99,0xA4B7,0xAFDC,0x9CAC,0x0001,0x6370,0xFE4F,
+	0xC012,0xBA9B,0x8B8A,0x5393,0xA364,0xDCAC,0xB4BC,0xBDE3,
+	0x9D8E,0x9C9E,0x9C00,0x0000,0xAA02,0x8002,0xA9E1,0xC007,
+	0x649C,0xA5A3,0xE5A4,0xACA4,0x8002,0xAA02,0xC022,0xAC9C,
+	0xACA4,0xE4AC,0xACA4,0xECAC,0xA4E4,0xA4AC,0xF4B3,0xFCF4,
+	0xED5C,0x9453,0x54A5,0x9CA4,0xA5A3,0xA59C,0xA5AC,0xACA4,
+	0xA300,0x8002,0xCB43,0xC006,0xAC64,0x9C9B,0x5C9C,0x9C00,
+	0x8002,0xBAA2,0xC010,0x5CAC,0xDCA5,0xACEC,0xA4B4,0xEDAC,
+	0xE4EC,0xADAC,0xEDB3,0xAC00,0x8002,0xEC65,0xC016,0xACA5,
+	0xABA4,0xA364,0xAC9B,0x5CA4,0x959C,0x94A4,0xECFB,0xEBAC,
+	0xEC64,0x6E6C,0x5400,0x8005,0xE465,0x0001,0xE466,0xEC86,
+	0x8002,0xF4A7,0xC01F,0xB4AB,0xAC9D,0x63A4,0xEC64,0xE4AD,
+	0xA4AC,0xABAC,0xA39C,0x9554,0x9493,0x6494,0x9CA5,0xECF5,
+	0xFDB5,0xBBBB,0x7383,0x0000,0xED05,0xC004,0x949C,0x94A5,
+	0xF500,0x0006,0xF529,0xFD4A,0xFD8A,0xF5C9,0x2295,0x0A58,
+	0x0A99,0x8002,0x0AF9,0x0014,0x0AF8,0x6BD0,0xBCAC,0xE54A,
+	0xFE10,0xFF59,0xFFDE,0xBDF7,0x7BF0,0x1148,0x014A,0x09AE,
+	0x0214,0x0217,0x01F7,0x32B4,0xFE08,0xF5C7,0xF5A7,0x73D0,
+	0x0A58,0xC005,0xA4A5,0xA49B,0x63A3,0x0002,0x1255,0xF5C9,
+	0xFDC8,0x8003,0xF5C7,0xC007,0xACA4,0x9CA5,0xA4A5,0xAEAF,
+	0x0001,0x7BEF,0x014E,0xC008,0x9BA4,0xABA3,0xA3B7,0xE69D,
+	0xAC00,0x0001,0x73B0,0xFE4F,0xC013,0xABB4,0xA382,0x8B52,
+	0x9B9B,0x64E4,0xA4B4,0xBCBC,0xE495,0x969D,0x95A4,0x0001,
+	0xAA02,0xAA01,0x8002,0xA9E1,0x8002,0xA1C1,0xC003,0xE5A4,
+	0xACA4,0x8002,0xAA02,0xC019,0xAC9C,0xACA4,0xE4AC,0xA4AC,
+	0xA4EC,0xA4EC,0xA4AC,0xACF3,0xFDF4,0xF4A4,0x5454,0x945C,
+	0xA49C,0x8004,0xCB03,0xC003,0xA5A4,0xACA3,0x8002,0xCB43,
+	0xC01A,0xACA4,0x5C9C,0xA354,0x9CA4,0x9CA4,0x5CAC,0xE59C,
+	0xB4E4,0xA4B4,0xEDAC,0xE4AC,0xECAD,0xEDB3,0xAC00,0x8002,
+	0xEC65,0xC00E,0xADA3,0xACA4,0xA36C,0xA49B,0x5C9C,0xA594,
+	0x9C9D,0xEC00,0x0000,0xF463,0xC009,0xABAC,0xEC64,0x6E6D,
+	0x9395,0x9C9C,0x8002,0xE465,0xC024,0xA5EC,0xEDA4,0xA5AB,
+	0xBCA3,0x9C64,0xA4EC,0x64E4,0xA5AC,0xACAB,0xACAB,0x9C4C,
+	0x9494,0x5C9C,0x9C9C,0xA4E5,0xF5FD,0xBDB3,0xBC72,0x8300,
+	0x0000,0xED05,0xC008,0x949C,0x95AC,0xB5FE,0xF6AB,0xB300,
+	0x0001,0x9C6E,0x0A37,0xC007,0xBDF4,0x6CA5,0xA3A4,0x949A,
+	0x0010,0x01F0,0x00C6,0x0021,0x0000,0x0021,0x00C6,0x014A,
 	0x018E,0x0214,0x0216,0x01F6,0x9C8E,0xF608,0xF5E7,0xF5A7,
-	0x6391,0x0A57,0x0A58,0x0A59,0x0A59,0x0A38,0x0237,0x0236,
-	0x6391,0xF5C9,0xFDC8,0xF5C8,0xF5C7,0xF5C7,0xF5C7,0xF5E7,
-	0xF5E7,0xF5C7,0xF5A8,0xF5C8,0xF5C9,0xF5EB,0xFE0E,0xEE10,
-	0x220E,0x012D,0x012D,0x014D,0x014B,0x014A,0x018D,0x09AF,
-	0x0990,0x9C8F,0xFE6F,0xFE4F,0xFE6E,0xFEAE,0xFEAD,0xFE4B,
-	0xFDCA,0xF588,0xF567,0xF547,0xED46,0xED46,0xF546,0xF586,
-	0xF607,0xF646,0xFE46,0xFE28,0xFDC9,0xFDAA,0xFD8B,0xFD4B,
-	0xAA21,0xAA01,0xAA01,0xAA01,0xA9E1,0xA1E1,0xA1C1,0xA1C1,
-	0xA9C2,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xB222,
-	0xAA02,0xAA22,0xAA02,0xB222,0xB242,0xB242,0xB242,0xB262,
-	0xBA62,0xBA82,0xBA82,0xC2A2,0xC2C2,0xC2C2,0xCB01,0xD362,
-	0xDBC2,0xDC01,0xE422,0xDBE2,0xDBA2,0xD362,0xD342,0xCB22,
-	0xD302,0xCB02,0xCB03,0xCB03,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD323,0xCB24,0xCB43,0xCB43,0xCB63,0xCB63,0xCB62,0xCB63,
-	0xC342,0xC323,0xC302,0xBAE2,0xBAC2,0xBAC3,0xBAA3,0xBAA3,
-	0xBAA2,0xBA83,0xBA83,0xBAA3,0xBAC3,0xC2C3,0xC303,0xCB24,
-	0xCB44,0xD344,0xD364,0xDB84,0xDBA5,0xE3C5,0xE405,0xE425,
-	0xEC65,0xEC65,0xEC65,0xEC86,0xEC85,0xECA5,0xECA5,0xECA4,
-	0xE4C4,0xE4C4,0xE4C4,0xDCA3,0xDC83,0xDC64,0xDC24,0xDC04,
-	0xDBE5,0xE405,0xF463,0xF4A2,0xF4A2,0xFCC2,0xF4C2,0xECE4,
-	0xED05,0xE4E4,0xE485,0xE465,0xDC44,0xE465,0xE465,0xE465,
-	0xE465,0xEC86,0xECA7,0xF4A7,0xF4A8,0xF4C8,0xF527,0xF526,
-	0xF506,0xED06,0xED06,0xF526,0xED26,0xED26,0xF547,0xF547,
-	0xF567,0xF586,0xF5A6,0xF5C5,0xF5A5,0xED45,0xED25,0xECE6,
-	0xECA5,0xEC85,0xE465,0xE445,0xEC45,0xEC66,0xF4A7,0xF4E8,
-	0xFD49,0xFD88,0xFDE7,0xF606,0xF5A5,0xED05,0xECC5,0xECA6,
-	0xEC86,0xECA7,0xECE8,0xF54A,0xFD6B,0xFDAB,0xFDE9,0xF5E9,
-	0x32D4,0x0A97,0x0AD8,0x0AF8,0x0AF8,0x12F9,0x0AF8,0x0AB8,
-	0x0A76,0x09D0,0x00C6,0x0021,0x0000,0x0021,0x00C6,0x012A,
-	0x018D,0x0A14,0x0216,0x32B3,0xFE29,0xFE08,0xF5E7,0xF5C8,
-	0x7BEF,0x0A37,0x0A38,0x0A38,0x0A38,0x0A38,0x0216,0x1255,
-	0xEDAA,0xFDC9,0xFDE8,0xF5C7,0xF5C7,0xF5C7,0xF5C7,0xF5C7,
-	0xFDE7,0xFDE7,0xF5C8,0xF5A8,0xF5C9,0xF5EC,0xF60E,0xFE70,
-	0xCDB1,0x322E,0x012E,0x014D,0x014B,0x014A,0x018D,0x222F,
-	0xACF0,0xF66F,0xFE6F,0xFE4F,0xFE6E,0xFEAE,0xFEAD,0xFE4B,
-	0xFDEA,0xF589,0xF567,0xF547,0xED46,0xF546,0xF546,0xF586,
-	0xF607,0xF646,0xFE46,0xFE08,0xFDC9,0xFDAA,0xFD8B,0xFD4B,
-	0xB241,0xAA21,0xAA01,0xAA01,0xAA01,0xA1E1,0xA1E1,0xA1C1,
-	0xA9E1,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xAA02,0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xB242,0xB262,
-	0xB262,0xBA62,0xBA82,0xC2A2,0xC2A2,0xC2C2,0xCB02,0xD342,
-	0xD382,0xDBE2,0xE421,0xE401,0xDBC2,0xD382,0xD342,0xCB22,
-	0xD322,0xCB22,0xCB03,0xCB03,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD323,0xCB24,0xCB43,0xD343,0xCB43,0xCB63,0xCB63,0xCB63,
-	0xC343,0xC323,0xC323,0xBAE2,0xBAC2,0xBAC2,0xBAA2,0xBAA3,
-	0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xC2C3,0xC303,0xCB23,
-	0xCB24,0xD344,0xD364,0xDB84,0xDBA5,0xE3C5,0xE3E5,0xE425,
-	0xEC46,0xEC65,0xEC86,0xEC86,0xECA5,0xECA5,0xECA5,0xECC5,
-	0xECC4,0xE4C4,0xE4C4,0xE4A3,0xDC83,0xDC63,0xDC24,0xDC04,
-	0xDBE5,0xE405,0xEC43,0xF482,0xFCA3,0xF4C3,0xF4C2,0xF4E4,
-	0xED05,0xE504,0xE4A5,0xE465,0xDC45,0xE465,0xE465,0xE465,
-	0xE465,0xEC86,0xECA7,0xF4A7,0xF4A8,0xF4C8,0xF507,0xF526,
-	0xF526,0xED06,0xED06,0xF526,0xED26,0xF546,0xF546,0xF567,
-	0xF587,0xF5A6,0xF5C6,0xF5E5,0xF5A6,0xF566,0xED05,0xECE5,
-	0xECA5,0xE485,0xE465,0xE445,0xE445,0xEC66,0xF4A7,0xF4E8,
-	0xFD49,0xFD88,0xFDE7,0xFE06,0xF585,0xED06,0xECC5,0xECA5,
-	0xECA6,0xECA8,0xED09,0xF56B,0xFD8C,0xFDCB,0xFDEA,0xF60A,
-	0xC52C,0x1AB6,0x0AB7,0x0AD7,0x12D8,0x0AD7,0x0AB7,0x0A97,
-	0x0A76,0x01D0,0x00C6,0x0041,0x0000,0x0021,0x00A5,0x0129,
-	0x098C,0x0213,0x1235,0xCD6C,0xFE2A,0xF608,0xF608,0xF5C8,
-	0x8C2F,0x0A37,0x0A37,0x0A38,0x0A18,0x0A17,0x0A16,0xACAD,
-	0xFDE9,0xFDE9,0xFDE8,0xF5E7,0xF5E7,0xF5C7,0xF5E7,0xF5E7,
-	0xFDE7,0xFDC8,0xFDC8,0xF5C8,0xF5C9,0xFDEB,0xF60E,0xFE70,
-	0xFEB1,0xFED2,0xBD71,0x840F,0x7BEF,0x9450,0xCD91,0xF670,
-	0xF66F,0xF66F,0xF650,0xFE30,0xFE6F,0xFEAD,0xFEAC,0xFE4C,
-	0xF5EA,0xF5A9,0xF567,0xF547,0xF546,0xF546,0xF546,0xF5A6,
-	0xF607,0xFE66,0xFE47,0xFE08,0xFDC9,0xFDAA,0xFD8B,0xF54C,
-	0xB241,0xAA21,0xAA21,0xAA01,0xAA01,0xA9E1,0xA1E1,0xA9E1,
-	0xA9E1,0xA9C2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xAA22,0xAA02,0xAA22,0xAA22,0xAA22,0xB242,0xB242,0xB262,
-	0xB262,0xBA82,0xBA82,0xC2A2,0xC2A2,0xC2C2,0xCAE1,0xD322,
-	0xD361,0xDBC2,0xE401,0xE421,0xDBE2,0xDBA2,0xD362,0xD322,
-	0xD322,0xCB22,0xCB02,0xCB03,0xCB03,0xCB03,0xCB04,0xCB24,
-	0xD323,0xD324,0xD344,0xD343,0xCB43,0xCB63,0xCB63,0xCB63,
-	0xC363,0xC323,0xC323,0xC2E3,0xBAC2,0xBAC2,0xBAA2,0xBAA3,
-	0xBAA3,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xC2C3,0xC303,0xCB03,
-	0xCB24,0xD344,0xD364,0xDB84,0xDBA5,0xE3C5,0xE3E5,0xE425,
-	0xEC46,0xEC65,0xEC86,0xEC86,0xECA5,0xECA5,0xECA5,0xECC5,
-	0xECC4,0xE4C4,0xE4C4,0xE4C3,0xDC83,0xDC64,0xDC23,0xDC04,
-	0xDBE5,0xE405,0xEC43,0xF482,0xF4A3,0xF4C3,0xF4C2,0xECE4,
-	0xED05,0xE504,0xE4A4,0xE484,0xDC45,0xE465,0xE465,0xE465,
-	0xEC65,0xEC86,0xECA7,0xF4A7,0xF4A7,0xF4C8,0xF4E7,0xF527,
-	0xED26,0xED06,0xED06,0xF526,0xED26,0xF546,0xF547,0xF567,
-	0xF567,0xF5A6,0xF5C6,0xF5E5,0xF5C6,0xF566,0xED25,0xECE5,
-	0xECC5,0xE485,0xE465,0xE445,0xE445,0xEC66,0xF4A7,0xFD08,
-	0xFD49,0xFD89,0xFDE7,0xFE06,0xF585,0xED06,0xECE6,0xECA6,
-	0xECC7,0xECE9,0xF52A,0xFD6C,0xFDAC,0xFDCC,0xFE0C,0xFE0B,
-	0xF5EA,0xC50B,0x1AB5,0x0AB7,0x0AD7,0x0AB7,0x0AB7,0x0AB7,
-	0x0A96,0x01F0,0x00E6,0x0041,0x0000,0x0021,0x00A5,0x0128,
-	0x016C,0x1253,0xCD2C,0xFE29,0xFE2A,0xF609,0xF5E9,0xF5C8,
-	0xBCEC,0x0A36,0x0A37,0x0A38,0x0A18,0x1A56,0x9C6E,0xFDEA,
-	0xFE0A,0xFDEA,0xFDE9,0xF5E8,0xF5E7,0xF5E7,0xF5E7,0xF5E7,
-	0xDD6A,0xBCEC,0xFDC9,0xF5C9,0xF5C9,0xFDEB,0xF60E,0xFE50,
-	0xFE91,0xFED2,0xFED2,0xFEB2,0xFEB3,0xFEB5,0xFE93,0xF670,
-	0xF66F,0xFE6F,0xF650,0xFE30,0xFE6F,0xFEAE,0xFEAD,0xFE4C,
-	0xFDEA,0xF5A9,0xF567,0xF547,0xF546,0xF547,0xF566,0xF5A6,
-	0xF627,0xFE67,0xFE67,0xFE28,0xFDE9,0xFDAA,0xFD8B,0xF54B,
-	0xB221,0xAA21,0xAA21,0xAA22,0xAA01,0xAA01,0xA9E1,0xA9E1,
-	0xA9E1,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xB222,0xAA22,0xAA22,0xAA22,0xAA22,0xB222,0xB242,0xB242,
-	0xB262,0xBA62,0xBA82,0xBA82,0xC2A2,0xC2C2,0xCAE2,0xCB02,
-	0xCB41,0xDBA2,0xE402,0xE422,0xE402,0xDBC2,0xD382,0xD342,
-	0xD322,0xCB22,0xD322,0xCB03,0xCB03,0xCB03,0xCB04,0xCB04,
-	0xD323,0xD324,0xD344,0xD344,0xD364,0xCB63,0xCB63,0xCB63,
-	0xC362,0xC343,0xC323,0xC302,0xC2E2,0xC2C2,0xBAA2,0xBAA2,
-	0xBAA3,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xC2C3,0xC2E3,0xCB03,
-	0xCB24,0xD344,0xD364,0xDB84,0xDBA5,0xE3C5,0xE3E5,0xE425,
-	0xEC46,0xEC65,0xEC86,0xEC86,0xECA6,0xECA5,0xECA5,0xECC5,
-	0xECE4,0xECE4,0xE4E4,0xE4C4,0xDCA3,0xDC63,0xDC44,0xDC24,
-	0xDBE5,0xE3E5,0xEC43,0xF482,0xF4A3,0xF4C3,0xF4C2,0xECC4,
-	0xED05,0xE524,0xE4C5,0xE484,0xE464,0xE465,0xE465,0xE465,
-	0xE465,0xEC86,0xECA7,0xF4A8,0xF4C8,0xF4C8,0xF4E7,0xF527,
-	0xF526,0xF526,0xF526,0xF526,0xED26,0xF546,0xF546,0xF567,
-	0xF567,0xF587,0xF5C6,0xF5C5,0xF5C5,0xF586,0xED25,0xECE5,
-	0xECC5,0xEC85,0xE465,0xE445,0xE446,0xEC66,0xF4A7,0xFCE8,
-	0xFD49,0xFDA9,0xFE08,0xF606,0xF5A6,0xF526,0xECE6,0xECE7,
-	0xECE9,0xED0A,0xF54B,0xFDAC,0xFDCD,0xFDED,0xFE2C,0xFE2B,
-	0xF60B,0xF5CA,0xCCEC,0x3B34,0x0AB6,0x0AB7,0x02B7,0x0AB7,
-	0x0A76,0x09F0,0x00C6,0x0022,0x0000,0x0022,0x00A5,0x0128,
-	0x326D,0xCD4E,0xF5E9,0xFE29,0xFE2A,0xF609,0xF5E9,0xF5C9,
-	0xBCEC,0x0A16,0x0A37,0x0A17,0x6392,0xDD6A,0xFDEA,0xFE0A,
-	0xFE0A,0xF5EA,0xF609,0xF608,0xF5E8,0x9C6E,0x42F4,0x0A17,
-	0x0A16,0x09F6,0xFDE9,0xFDE9,0xF5EA,0xFDEB,0xF60D,0xFE50,
-	0xFE91,0xFED2,0xFED2,0xFEB2,0xFEB3,0xFEB5,0xFE93,0xF670,
-	0xF66F,0xF690,0xFE70,0xF630,0xFE6F,0xFEAE,0xFEAD,0xFE4C,
-	0xFDEA,0xF5A9,0xF587,0xF547,0xF547,0xF546,0xF566,0xF5C6,
-	0xF627,0xFE67,0xFE67,0xFE28,0xFDEA,0xFDAA,0xFD8B,0xF54B,
-	0xB221,0xB221,0xB222,0xB242,0xAA21,0xAA01,0xA9E1,0xA9E1,
-	0xA9E1,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA02,0xAA02,0xAA22,
-	0xB222,0xAA22,0xAA22,0xAA22,0xB222,0xB222,0xB222,0xB242,
-	0xB262,0xBA62,0xBA82,0xBA82,0xC2A2,0xC2C2,0xCAC2,0xCB02,
-	0xCB41,0xD3A2,0xDBE1,0xE422,0xE421,0xDBE2,0xDBA2,0xD342,
-	0xD322,0xD322,0xD322,0xD322,0xCB03,0xD303,0xCB04,0xD324,
-	0xD323,0xD324,0xD344,0xD344,0xD364,0xCB63,0xCB63,0xCB63,
-	0xCB63,0xC343,0xC343,0xC302,0xC2E2,0xC2C2,0xBAC2,0xBAC2,
-	0xBAA3,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xC2C3,0xC2E3,0xCB23,
-	0xCB24,0xD344,0xD364,0xDB85,0xDBA5,0xE3C5,0xE3E5,0xE425,
-	0xEC45,0xEC65,0xEC86,0xECA6,0xECA5,0xECA5,0xECC5,0xECC5,
-	0xECE4,0xECE4,0xE4C4,0xE4C4,0xDCA3,0xDC63,0xDC43,0xDC24,
-	0xDC05,0xE3E4,0xEC43,0xF482,0xF4A2,0xF4A2,0xF4C2,0xF4C4,
-	0xED05,0xED24,0xE4C5,0xE484,0xE464,0xE465,0xE465,0xE465,
-	0xEC85,0xEC86,0xECA7,0xF4A7,0xF4C8,0xF4C8,0xF4E7,0xF527,
-	0xF546,0xF526,0xF526,0xF526,0xED26,0xF546,0xF546,0xF547,
-	0xF567,0xF587,0xF5C6,0xF5E5,0xF5C5,0xF585,0xED45,0xECE6,
-	0xECC5,0xEC85,0xE465,0xE445,0xE445,0xEC66,0xF4A7,0xFD08,
-	0xFD49,0xFDA9,0xFE08,0xF607,0xF5A6,0xF546,0xED27,0xED07,
-	0xED09,0xED2B,0xF56C,0xFDAD,0xFDCD,0xFE0D,0xFE2C,0xF62C,
-	0xF60B,0xF5EB,0xF58B,0xF56A,0x9C4E,0x3334,0x0AB7,0x0A97,
-	0x0A76,0x09F0,0x00E7,0x0022,0x0000,0x0042,0x31E9,0x9CB1,
-	0xFEB4,0xFE0C,0xF5E9,0xFE29,0xFE2A,0xFE29,0xF5E9,0xF5C9,
-	0xEDAA,0x6371,0x9C6E,0xD56A,0xF5E8,0xF5E9,0xFDEA,0xFE0B,
-	0xFE0A,0xF5EA,0xFE09,0xF5E9,0xF5E8,0x7BEF,0x0A17,0x09F7,
-	0x09F6,0x09F6,0xFDE9,0xF5E9,0xF5EA,0xFDEC,0xF60E,0xFE70,
-	0xFE91,0xFEB2,0xFED2,0xFEB2,0xFEB4,0xFEB5,0xFEB3,0xF670,
-	0xF66F,0xF690,0xFE50,0xFE50,0xFE4F,0xFEAE,0xFEAD,0xFE4C,
-	0xFDEA,0xF5A9,0xF587,0xF547,0xF547,0xF566,0xF566,0xF5C6,
-	0xF647,0xFE67,0xFE67,0xFE08,0xFDE9,0xFDAA,0xFD8B,0xF54B,
-	0xB222,0xB221,0xB221,0xB241,0xAA21,0xAA01,0xAA01,0xA9E2,
-	0xA9E2,0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xAA22,
-	0xAA22,0xAA22,0xB222,0xB242,0xB222,0xB222,0xB222,0xB242,
-	0xB262,0xB262,0xBA62,0xBA82,0xC2A2,0xC2C2,0xC2C2,0xCB02,
-	0xCB22,0xD382,0xDBC1,0xE402,0xE422,0xE401,0xDBC2,0xD382,
-	0xD342,0xD322,0xD323,0xD322,0xD323,0xD323,0xCB03,0xCB24,
-	0xD323,0xD344,0xD344,0xD344,0xD364,0xD363,0xD363,0xCB83,
-	0xCB82,0xCB83,0xC343,0xC322,0xC2E2,0xBAE2,0xBAC2,0xBAC2,
-	0xBAC3,0xBAA2,0xBAA3,0xBAA3,0xBAC2,0xC2E3,0xC2E3,0xC303,
-	0xCB44,0xD344,0xD344,0xDB85,0xDB85,0xDBC5,0xE3E6,0xE405,
-	0xE445,0xEC66,0xEC86,0xECA6,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xE4E4,0xE4C3,0xDCA3,0xDC83,0xDC43,0xDC24,
-	0xDC04,0xE404,0xEC43,0xF482,0xFCA3,0xF4A3,0xF4A3,0xF4C4,
-	0xECE5,0xE524,0xE504,0xE4A5,0xE465,0xE465,0xE465,0xE485,
-	0xE485,0xEC86,0xECA6,0xF4C7,0xF4C8,0xF4C8,0xF4E7,0xF527,
-	0xF546,0xED26,0xED26,0xED26,0xED25,0xF545,0xF546,0xF546,
-	0xF567,0xF587,0xF5C6,0xF5C6,0xF5C6,0xF5A5,0xED45,0xED06,
-	0xECC6,0xECA5,0xEC85,0xE465,0xE466,0xEC86,0xF4C7,0xF509,
-	0xFD6A,0xFDCA,0xFE09,0xFE08,0xF5A7,0xF547,0xED27,0xED28,
-	0xED2A,0xED4C,0xF58D,0xFDCD,0xFDED,0xFE0D,0xFE2C,0xF62C,
-	0xF60B,0xF5CB,0xF58B,0xF58A,0xF56A,0xF569,0xE529,0xBCCC,
-	0x7BEF,0x7BEF,0x7BEF,0x7BEF,0xBDF7,0xEF5B,0xFF5A,0xFF18,
-	0xFEB4,0xFE0C,0xFDE9,0xFE29,0xFE2A,0xF609,0xF5E9,0xF5C8,
-	0xFDC9,0xFDE9,0xF5C8,0xFDE8,0xFDE8,0xF5E9,0xFE0A,0xFE0A,
-	0xFE0A,0xFE0A,0xFDE9,0xF609,0xF5E9,0x7BEF,0x09F7,0x09F6,
-	0x01F6,0x01F6,0xFE0A,0xF5EA,0xF5EA,0xFDEC,0xFE2E,0xFE70,
-	0xFEB1,0xFED2,0xFED2,0xFED2,0xFEB3,0xFED5,0xFE93,0xF670,
-	0xF66F,0xF68F,0xFE70,0xFE50,0xFE4F,0xFEAE,0xFE8D,0xFE4C,
-	0xF60B,0xF5C9,0xF588,0xF567,0xF547,0xF566,0xF587,0xF5E6,
-	0xF646,0xFE87,0xFE67,0xFE28,0xFDEA,0xFDAB,0xFD8B,0xF54B,
-	0xB222,0xB222,0xB242,0xB241,0xB221,0xAA21,0xAA01,0xAA01,
-	0xA9E2,0xA9E2,0xA9E2,0xAA02,0xAA02,0xAA22,0xAA22,0xAA22,
-	0xAA22,0xAA22,0xB222,0xB222,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB262,0xBA62,0xBA82,0xBA82,0xC2C2,0xC2C2,0xCAE2,
-	0xCB22,0xD362,0xDBC2,0xE402,0xE422,0xE401,0xDBC2,0xD382,
-	0xD361,0xD322,0xD322,0xD322,0xD323,0xD323,0xCB03,0xCB24,
-	0xD323,0xD344,0xD344,0xD364,0xD364,0xD364,0xD383,0xCB83,
-	0xCB83,0xCB83,0xC363,0xC323,0xC302,0xC2E3,0xBAC2,0xBAC2,
-	0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xBAC2,0xC2E3,0xC2E3,0xC303,
-	0xCB24,0xCB44,0xD364,0xDB84,0xDBA5,0xDBC5,0xE3E5,0xE406,
-	0xE445,0xEC66,0xEC86,0xECA6,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xE4E4,0xE4E4,0xDCC3,0xDC83,0xDC44,0xDC24,
-	0xDC04,0xDC04,0xEC43,0xF482,0xF483,0xF4A3,0xF4A3,0xF4C4,
-	0xED05,0xED25,0xE504,0xE4C4,0xE465,0xE465,0xE465,0xE485,
-	0xE485,0xEC86,0xECA6,0xF4C7,0xF4C8,0xF4A8,0xF4E7,0xF527,
-	0xF546,0xED46,0xED26,0xED26,0xED26,0xF546,0xF546,0xF547,
-	0xF567,0xF586,0xF5C6,0xF5C6,0xF5C5,0xF5A5,0xED46,0xED26,
-	0xECE6,0xECA6,0xEC86,0xE486,0xEC86,0xECA7,0xF4E8,0xFD2A,
-	0xFD8A,0xFDCA,0xFE09,0xF608,0xF5A7,0xF547,0xED27,0xED29,
-	0xF54B,0xF56C,0xF58D,0xFDCE,0xFDED,0xFE0D,0xFE2C,0xFE4C,
-	0xF60C,0xF5CC,0xF58B,0xF58B,0xF58A,0xF56A,0xF569,0xF568,
-	0xF589,0xF62E,0xFF18,0xFFBD,0xFFFE,0xFFBD,0xFF5A,0xFEF8,
-	0xFEB4,0xFE0D,0xFDE9,0xFE29,0xFE2A,0xF609,0xF5E9,0xF5C8,
-	0xF5C9,0xF5E9,0xF5C8,0xF5C8,0xFDE8,0xF5E9,0xFE0A,0xFE0A,
-	0xFE0A,0xFE0A,0xFE09,0xF609,0xF5E8,0x7BEF,0x09F7,0x01F6,
-	0x09F6,0x01F6,0xFE0A,0xFE0A,0xFE0A,0xFE0C,0xFE2E,0xFE50,
-	0xFE91,0xFED2,0xFED2,0xFED2,0xFEB4,0xFED5,0xFEB3,0xF690,
-	0xF66F,0xF690,0xFE70,0xFE50,0xFE50,0xFEAE,0xFEAD,0xFE4D,
-	0xF60A,0xF5C9,0xF588,0xF547,0xF566,0xF566,0xF587,0xF5E7,
-	0xFE66,0xFE87,0xFE67,0xFE28,0xFDCA,0xFDAB,0xFD8B,0xF56B,
-	0xB222,0xB221,0xB242,0xB241,0xB241,0xAA21,0xAA21,0xAA01,
-	0xAA02,0xAA02,0xA9E2,0xAA02,0xAA02,0xAA22,0xAA22,0xAA22,
-	0xAA22,0xAA22,0xB222,0xB222,0xB222,0xB222,0xB222,0xB242,
-	0xB242,0xB262,0xB262,0xBA62,0xBA82,0xC2A2,0xC2C2,0xC2E2,
-	0xCB02,0xD342,0xDBA2,0xE402,0xE422,0xE421,0xDBE1,0xDBA2,
-	0xD362,0xD322,0xD322,0xD342,0xD323,0xD323,0xCB23,0xCB23,
-	0xD344,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xCB83,
-	0xCB83,0xCB83,0xCB63,0xC343,0xC303,0xC303,0xBAE2,0xBAC3,
-	0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xBAC2,0xC2E3,0xC2E3,0xC303,
-	0xCB24,0xCB44,0xD364,0xDB84,0xDBA5,0xDBC5,0xE3E5,0xE405,
-	0xE445,0xEC66,0xEC86,0xECA6,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xECE4,0xE4E4,0xE4C3,0xDCA3,0xDC64,0xDC23,
-	0xDC04,0xDC04,0xEC43,0xF482,0xF483,0xF4A3,0xF4A3,0xECC4,
-	0xED06,0xED25,0xED04,0xE4C4,0xDC85,0xE465,0xE465,0xE485,
-	0xE485,0xEC86,0xEC86,0xF4A7,0xF4C8,0xF4C8,0xF4E8,0xF527,
-	0xF547,0xF546,0xF526,0xF526,0xF546,0xF546,0xF546,0xF547,
-	0xF567,0xF586,0xF5C6,0xF5C6,0xF5C5,0xF5A5,0xF566,0xED26,
-	0xED06,0xECC6,0xECA6,0xEC87,0xEC87,0xECA7,0xF4E8,0xF52A,
-	0xFD8A,0xFDCA,0xFE09,0xF608,0xF5A7,0xF547,0xF548,0xED4A,
-	0xF56C,0xF56C,0xF5AE,0xFDCE,0xFDED,0xFE0D,0xFE2C,0xFE4C,
-	0xF60C,0xF5EC,0xF5AC,0xF58B,0xF58B,0xF56A,0xF569,0xF568,
-	0xF589,0xF60E,0xFF18,0xFFBD,0xFFDE,0xFFBD,0xFF3A,0xFF18,
-	0xFEB4,0xFE0D,0xFDE9,0xF629,0xFE2A,0xF609,0xF609,0xF5C8,
-	0xFDC9,0xFDE9,0xF5C8,0xFDE8,0xFDE8,0xFDE9,0xFE09,0xFE0A,
-	0xFE0B,0xFE0A,0xFE09,0xF609,0xF5E8,0x7BEF,0x09F7,0x01F6,
-	0x01F6,0x01F6,0xFE0A,0xF60A,0xF60A,0xFE0C,0xFE2E,0xFE71,
-	0xFE92,0xFEF2,0xFED2,0xFED2,0xFEB4,0xFED5,0xFED3,0xFE91,
-	0xF690,0xF690,0xFE70,0xFE50,0xFE70,0xFEAF,0xFECE,0xFE4D,
-	0xFE0B,0xF5C9,0xF588,0xF567,0xF547,0xF566,0xF587,0xF5E7,
-	0xF666,0xF687,0xFE68,0xFE29,0xFDEA,0xFDAB,0xFD8B,0xF56B,
-	0xB222,0xB222,0xB221,0xB221,0xB242,0xB241,0xAA21,0xAA21,
-	0xAA02,0xAA02,0xAA02,0xAA02,0xAA02,0xAA02,0xAA22,0xAA22,
-	0xAA22,0xAA22,0xB222,0xB222,0xB242,0xB222,0xB222,0xB242,
-	0xB242,0xB242,0xB262,0xBA62,0xBA82,0xBAA2,0xC2A2,0xC2E2,
-	0xCB02,0xD322,0xDB82,0xDBE2,0xE422,0xE421,0xE402,0xDBC2,
-	0xD382,0xD342,0xD342,0xD322,0xD323,0xD323,0xCB23,0xCB24,
-	0xD343,0xD344,0xD344,0xD344,0xD364,0xD364,0xD383,0xD383,
-	0xCB83,0xCB83,0xCB83,0xC343,0xC323,0xC303,0xBAE3,0xBAE3,
-	0xBAC2,0xBAC2,0xBAC2,0xBAA2,0xBAC3,0xC2E3,0xC2E3,0xC303,
-	0xCB24,0xD344,0xD364,0xD384,0xDBA5,0xDBA5,0xE3E5,0xE406,
-	0xE445,0xEC66,0xEC86,0xECA6,0xECA6,0xECA6,0xECC5,0xECE5,
-	0xECE5,0xECE4,0xE504,0xE504,0xE4C3,0xDCA3,0xDC63,0xDC44,
-	0xDC04,0xDBE4,0xEC43,0xF482,0xF483,0xF4A3,0xF4A3,0xF4A4,
-	0xECE6,0xED25,0xED24,0xE4E4,0xE485,0xE465,0xE465,0xE485,
-	0xE485,0xEC85,0xEC86,0xF4C7,0xF4C8,0xF4C8,0xF4E8,0xF527,
-	0xF546,0xF546,0xF546,0xED26,0xF545,0xF546,0xF546,0xF566,
-	0xF567,0xF586,0xF5C6,0xF5E6,0xF5E6,0xF5A6,0xED66,0xED47,
-	0xED07,0xECC7,0xECA7,0xE4A7,0xECA7,0xECA7,0xF4E9,0xF529,
-	0xFD8A,0xFDCA,0xFE09,0xF608,0xF5A7,0xF547,0xF548,0xED6A,
-	0xF56C,0xF58D,0xF5AE,0xFDCE,0xFDED,0xFE0D,0xFE2C,0xF62C,
-	0xF60C,0xF5EC,0xF5AC,0xF58B,0xF58B,0xF58B,0xF58A,0xF569,
-	0xF589,0xF62E,0xFEF7,0xFFBC,0xFFDE,0xFFBD,0xFF39,0xFF18,
-	0xFEB4,0xFE0D,0xFDE9,0xFE29,0xFE29,0xFE09,0xF5E9,0xF5C8,
-	0xF5C9,0xFDE9,0xF5C8,0xF5E8,0xFDE8,0xF5E9,0xFE09,0xFE2B,
-	0xFE0A,0xFE0A,0xFE09,0xF609,0xF5E8,0x7BEF,0x09F7,0x09F6,
-	0x01F6,0x01D5,0xFE0A,0xF60A,0xF60B,0xFE0C,0xFE2E,0xFE71,
-	0xFE92,0xFED2,0xFEF2,0xFED2,0xFED4,0xFED5,0xFED4,0xFEB2,
-	0xF690,0xF690,0xFE91,0xFE51,0xFE70,0xFEAF,0xFEAE,0xFE4D,
-	0xFE0B,0xF5C9,0xF588,0xF567,0xF567,0xF566,0xF587,0xF5E7,
-	0xF667,0xFE87,0xFE68,0xFE29,0xFDEA,0xFDAB,0xFD8B,0xF54B,
-	0xB202,0xB222,0xB242,0xB242,0xB242,0xB241,0xAA41,0xAA22,
-	0xAA01,0xAA02,0xAA02,0xAA02,0xAA02,0xAA22,0xAA22,0xAA22,
-	0xAA22,0xAA22,0xB222,0xB222,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xBA62,0xBA82,0xBAA2,0xC2A2,0xC2C2,
-	0xCAE2,0xCB21,0xD362,0xDBC2,0xE422,0xE442,0xE422,0xDBC2,
-	0xDB82,0xD342,0xD342,0xD342,0xD323,0xD323,0xD324,0xD323,
-	0xD343,0xD344,0xD344,0xD344,0xD364,0xD384,0xD383,0xD383,
-	0xCBA3,0xCBA3,0xCB83,0xC363,0xC322,0xC302,0xC2E2,0xC2E3,
-	0xBAE2,0xBAC2,0xBAC2,0xBAC3,0xBAC3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xD344,0xD364,0xD384,0xDB85,0xDBA5,0xE3C6,0xE406,
-	0xEC26,0xEC66,0xEC86,0xECA6,0xECA6,0xECC6,0xECE6,0xECE5,
-	0xECE5,0xED04,0xED04,0xE504,0xE4E3,0xDCA3,0xDC64,0xDC44,
-	0xDC04,0xDC04,0xEC43,0xF462,0xF482,0xF4A3,0xF4A3,0xF4A4,
-	0xF4E6,0xED25,0xED24,0xE4E4,0xE4A5,0xE465,0xE485,0xE485,
-	0xEC85,0xEC86,0xECA6,0xF4A7,0xF4C8,0xF4C8,0xF4E8,0xF507,
-	0xF546,0xF566,0xED46,0xF546,0xF545,0xF546,0xF546,0xF547,
-	0xF566,0xF587,0xF5C7,0xF5E6,0xF5E6,0xF5C6,0xF567,0xED47,
-	0xED07,0xECE7,0xECC7,0xECA7,0xECA7,0xECA7,0xF4E8,0xF529,
-	0xFD8A,0xFDEA,0xFE09,0xF608,0xF5A7,0xF547,0xF548,0xF56B,
-	0xED8C,0xF5AE,0xF5CE,0xFDED,0xFDED,0xFE0D,0xF62C,0xF62C,
-	0xF60C,0xF5EC,0xF5AC,0xF5AC,0xF5AC,0xBCCD,0x7BF0,0x4333,
-	0x4333,0x42F0,0x632E,0x8C71,0xDEDA,0xFF9C,0xFF59,0xFF18,
-	0xFEB5,0xFE0D,0xFDEA,0xFE09,0xFE29,0xFE29,0xF5E9,0xF5C8,
-	0xF5E9,0xF5E9,0xF5C8,0xF5E7,0xF5E8,0xF5E9,0xFE09,0xFE0A,
-	0xFE0A,0xF60A,0xFE09,0xF5E9,0xF5E9,0x7BEF,0x09F7,0x09F6,
-	0x01D6,0x01D5,0xCD4C,0xF60A,0xFE0B,0xFE0C,0xFE2E,0xFE70,
-	0xFEB2,0xFED2,0xFEF2,0xFED2,0xFED4,0xFEF5,0xFED5,0xFEB2,
-	0xF690,0xF691,0xF691,0xFE51,0xFE70,0xFEAF,0xFECF,0xFE6D,
-	0xFE2B,0xF5CA,0xF5A8,0xED67,0xF547,0xF566,0xF5A7,0xF626,
-	0xFE87,0xFE87,0xFE68,0xFE29,0xFDCA,0xFDAB,0xFD6B,0xF54B,
-	0xB202,0xB202,0xB222,0xB242,0xB242,0xB242,0xB241,0xB221,
-	0xAA22,0xAA01,0xAA02,0xAA02,0xAA22,0xAA22,0xAA22,0xB222,
-	0xB222,0xB222,0xB222,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB222,0xB242,0xBA62,0xBA82,0xBA82,0xC2A2,0xC2C2,
-	0xCAE2,0xCB01,0xD362,0xDBC2,0xE402,0xE442,0xE421,0xE3E1,
-	0xDBA2,0xD362,0xD342,0xD342,0xD343,0xD323,0xD324,0xD324,
-	0xCB43,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,
-	0xCBA3,0xCBA3,0xCB83,0xCB63,0xC343,0xC323,0xC302,0xC2E3,
-	0xC2E2,0xBAE3,0xBAC3,0xBAC3,0xBAC3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB44,0xD364,0xD384,0xDB85,0xDBA5,0xE3C6,0xE3E6,
-	0xE425,0xEC65,0xEC86,0xECA6,0xECA6,0xECC6,0xF4C6,0xECE5,
-	0xED05,0xED04,0xED04,0xE504,0xE4E3,0xDCA3,0xDC83,0xDC43,
-	0xDC04,0xDC04,0xEC43,0xF462,0xF482,0xF4A2,0xF4A3,0xF4A5,
-	0xF4E6,0xED05,0xED24,0xE504,0xE4A4,0xE485,0xE465,0xE485,
-	0xEC85,0xEC86,0xECA6,0xF4C6,0xF4C8,0xF4C8,0xF4E8,0xF528,
-	0xF546,0xF566,0xF546,0xF546,0xF546,0xF546,0xF546,0xF547,
-	0xF567,0xF5A7,0xF5C7,0xF5E7,0xF5E7,0xF5C7,0xF587,0xF547,
-	0xED07,0xECE7,0xECC7,0xE4A7,0xECA7,0xECA7,0xF4E9,0xF529,
-	0xFD8A,0xFDEA,0xFE29,0xF608,0xF587,0xF547,0xF569,0xF58C,
-	0xEDAD,0xF5AE,0xF5CF,0xFDEE,0xFDED,0xFE0D,0xFE2C,0xF62B,
-	0xFE0C,0xF5EC,0xF5AC,0xACAE,0x22B2,0x0A54,0x0A54,0x0A55,
-	0x0275,0x09F1,0x0108,0x0063,0x0042,0x630C,0xEED8,0xFF18,
-	0xFED5,0xFE2D,0xFDEA,0xFE09,0xFE29,0x9C8E,0x5352,0x1A76,
-	0x0A16,0x0A16,0x32D4,0x73B1,0xDD6A,0xF5E9,0xFE09,0xFE2A,
-	0xFE0A,0xFE0A,0xFE09,0xFDE9,0xF5E9,0x8C2F,0x01F7,0x09D6,
-	0x01D6,0x01D5,0x6371,0xFE0A,0xFE0B,0xFE0C,0xFE2E,0xFE70,
-	0xFEB2,0xFED2,0xFED2,0xFED2,0xFED3,0xFEF5,0xFEF5,0xFEB3,
-	0xFEB1,0xF6B1,0xFE92,0xFE72,0xFE71,0xFEB0,0xFECF,0xFE6D,
-	0xFE2C,0xF5EA,0xF5C9,0xED87,0xF567,0xF587,0xF5C7,0xF626,
-	0xFE87,0xFEA7,0xFE68,0xFE29,0xFDEA,0xFDAB,0xFD8B,0xFD4C,
-	0xB1E2,0xB202,0xB222,0xB242,0xB242,0xB242,0xB242,0xAA21,
-	0xAA21,0xAA21,0xAA22,0xAA22,0xAA22,0xAA22,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB222,0xB242,0xBA62,0xBA82,0xBA82,0xC2A2,0xC2C2,
-	0xCAC2,0xCB01,0xD341,0xD3A2,0xDBE1,0xE441,0xE441,0xE402,
-	0xDBC2,0xDB82,0xD342,0xD342,0xD342,0xD343,0xD324,0xD324,
-	0xD343,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,
-	0xD3A3,0xCBC3,0xCBA3,0xCB63,0xCB43,0xC323,0xC303,0xC2E3,
-	0xC2E3,0xBAE3,0xBAC3,0xBAC3,0xBAC3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB44,0xD364,0xDB85,0xDB85,0xDBA5,0xE3C6,0xE405,
-	0xEC25,0xEC65,0xEC86,0xECA6,0xECA6,0xECC6,0xECE6,0xECE5,
-	0xED05,0xED04,0xED04,0xE504,0xE4E3,0xDCC3,0xDC83,0xDC43,
-	0xDC24,0xDC04,0xEC43,0xF462,0xF482,0xF4A2,0xF4A3,0xF4A5,
-	0xF4C6,0xED06,0xED44,0xED24,0xE4C5,0xE485,0xE485,0xE485,
-	0xEC86,0xECA5,0xECA6,0xECA6,0xF4C7,0xF4C8,0xF4E8,0xF508,
-	0xF547,0xF566,0xF546,0xF546,0xF546,0xF546,0xF547,0xF547,
-	0xF568,0xF5A8,0xF5C8,0xF608,0xF607,0xF5E7,0xF588,0xED47,
-	0xED07,0xECE7,0xECC7,0xE4A7,0xECA7,0xECA8,0xF4E9,0xF52A,
-	0xFD8A,0xFDEA,0xFE29,0xF608,0xF587,0xF547,0xF589,0xF5AC,
-	0xF5AE,0xF5CF,0xFDCF,0xFDEE,0xFDED,0xFE0D,0xFE2C,0xF62B,
-	0xF60C,0xF5EC,0x6390,0x0A32,0x0A53,0x0253,0x0A54,0x0A55,
-	0x0A55,0x09F1,0x0109,0x0063,0x0022,0x0063,0x1127,0xCDF5,
-	0xFED5,0xFE2E,0xF5E9,0xDD8B,0x32B4,0x01D6,0x0217,0x0A37,
-	0x0A16,0x0A16,0x0A37,0x0A18,0x0A17,0x73B0,0xF609,0xFE2A,
-	0xFE0A,0xFE0A,0xFE09,0xF609,0xF5E9,0xBD0C,0x09F7,0x09F6,
-	0x01D5,0x01D5,0x01D4,0xCD4C,0xF60B,0xF60C,0xF62E,0xF650,
-	0xFE92,0xFED2,0xFEF2,0xFED2,0xFED3,0xFEF5,0xFEF5,0xFED3,
-	0xFEB1,0xF6B2,0xFEB2,0xFE93,0xFE92,0xFED0,0xFECF,0xFE8E,
-	0xFE2C,0xF5EA,0xF5C9,0xF5A8,0xF587,0xF587,0xF5C7,0xF627,
-	0xFE87,0xFEA7,0xFE68,0xFE29,0xFDEA,0xFDAB,0xFD8B,0xFD4C,
-	0xB1E2,0xB202,0xB222,0xB222,0xB242,0xB242,0xB242,0xB241,
-	0xB241,0xB221,0xB222,0xAA22,0xAA22,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB222,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB262,0xBA62,0xBA82,0xBA82,0xBAA2,0xC2A2,
-	0xC2C2,0xCB02,0xCB22,0xDB82,0xE3E1,0xE441,0xEC42,0xE421,
-	0xDBE2,0xDB82,0xD362,0xD342,0xD342,0xD343,0xD323,0xD323,
-	0xCB24,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,
-	0xD3A3,0xD3C3,0xCBA3,0xCB83,0xC363,0xC323,0xC303,0xC303,
-	0xC2E3,0xC2E3,0xBAE3,0xBAE3,0xBAC3,0xBAE3,0xC303,0xC303,
-	0xCB23,0xCB44,0xD364,0xDB84,0xDB85,0xDBA5,0xE3C6,0xE3E5,
-	0xE426,0xEC46,0xEC86,0xECA6,0xECA6,0xECC6,0xF4E6,0xECE6,
-	0xECE5,0xED04,0xED04,0xE504,0xE4E3,0xDCC3,0xDC83,0xDC44,
-	0xD404,0xDC04,0xEC43,0xF482,0xF482,0xF4A2,0xF4A3,0xF4A5,
-	0xF4C6,0xED05,0xED45,0xED24,0xE4E4,0xE485,0xE485,0xE485,
-	0xEC85,0xE4A5,0xECA6,0xECA6,0xF4C7,0xF4C8,0xF4E8,0xFD07,
-	0xF567,0xF566,0xF566,0xF546,0xF546,0xF547,0xF567,0xF568,
-	0xF588,0xF5A8,0xF5C8,0xFDE8,0xF607,0xF5E7,0xF587,0xED47,
-	0xED27,0xECE7,0xECC7,0xE4A7,0xECA7,0xECC7,0xF4E8,0xFD2A,
-	0xFDAA,0xFDEA,0xFE2A,0xF5E8,0xF587,0xF567,0xF58A,0xF5AD,
-	0xF5CF,0xF5EF,0xF5EF,0xFDEE,0xFDEE,0xFE0D,0xFE2C,0xF62C,
-	0xF60C,0x6391,0x0253,0x0A32,0x0A32,0x0A33,0x0A33,0x0A55,
-	0x0254,0x09D1,0x0109,0x0063,0x0042,0x0064,0x00C7,0x1148,
-	0xCDD3,0xFE2E,0xEDAB,0x2275,0x01D6,0x09F6,0x0A17,0x0A37,
-	0x0236,0x0A16,0x0A17,0x0A17,0x0A17,0x01F6,0x32B3,0xEDCB,
-	0xFE0A,0xFE0A,0xFDEA,0xF609,0xF5E9,0xF5E9,0x2275,0x09F6,
-	0x01F6,0x01D5,0x01D5,0x32B3,0xEDCB,0xFE0C,0xFE2E,0xFE50,
-	0xFE92,0xFEB2,0xFED2,0xFEF2,0xFED3,0xFEF5,0xFEF5,0xFED3,
-	0xFEB1,0xFEB2,0xFEB2,0xFE93,0xFE92,0xFED2,0xFEF1,0xFEAF,
-	0xFE4D,0xF60B,0xF5C9,0xF5A8,0xF588,0xF5A8,0xF5C7,0xF627,
-	0xF687,0xFEA7,0xFE68,0xFE2A,0xFDEB,0xFDAC,0xFD8B,0xF54B,
-	0xB9E2,0xB9E2,0xB222,0xB222,0xB242,0xB242,0xB242,0xB241,
-	0xB241,0xB241,0xB242,0xAA22,0xAA22,0xB222,0xB222,0xB222,
-	0xB222,0xB222,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB262,0xB262,0xBA62,0xBA82,0xBAA2,0xC2C2,
-	0xC2C2,0xCAE2,0xCB22,0xD362,0xDBC2,0xE421,0xEC42,0xE421,
-	0xE402,0xDBC2,0xDB62,0xD342,0xD342,0xD343,0xD323,0xD323,
-	0xCB24,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xD383,
-	0xD3A3,0xD3A3,0xCBA3,0xCBA3,0xCB63,0xC343,0xC323,0xC303,
-	0xC303,0xBAE3,0xC2E3,0xBAE3,0xBAE3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB44,0xD364,0xD384,0xDB85,0xDBA5,0xE3C6,0xE3E5,
-	0xE405,0xEC46,0xEC86,0xECA6,0xECA6,0xECC6,0xF4E6,0xF4E6,
-	0xED05,0xED04,0xED04,0xED04,0xE504,0xE4E3,0xDCA3,0xDC44,
-	0xD424,0xDC04,0xEC23,0xF482,0xF482,0xF4A2,0xF483,0xF4A5,
-	0xF4C7,0xED06,0xED45,0xED44,0xE4E4,0xE4A5,0xE465,0xEC85,
-	0xEC85,0xECA5,0xECA6,0xECA6,0xF4C7,0xF4E8,0xF4C8,0xFD08,
-	0xF547,0xF586,0xF586,0xF567,0xF567,0xF567,0xF567,0xF568,
-	0xF588,0xF5A8,0xF5C8,0xF5E8,0xF607,0xF5E7,0xF5A7,0xF567,
-	0xED07,0xECE7,0xECC7,0xE4A7,0xECA7,0xECC7,0xF4E8,0xFD4A,
-	0xFDAB,0xFDEA,0xFE29,0xF5E8,0xF587,0xF568,0xF58A,0xF5CD,
-	0xF5EF,0xF5EF,0xFDEF,0xFDEE,0xFDED,0xFE0C,0xFE2C,0xF62C,
-	0x7BF0,0x0A33,0x0A32,0x0A32,0x0A32,0x0A32,0x0A13,0x0A34,
-	0x0A54,0x09D1,0x0108,0x0064,0x0043,0x0084,0x00C7,0x00E7,
-	0x428C,0xFE2E,0x5332,0x01D6,0x01D6,0x09F6,0x0A17,0x0A37,
-	0x0A36,0x0A16,0x0A17,0x0A17,0x0A17,0x01F6,0x09F6,0x6371,
-	0xFE0A,0xFE0A,0xFE0A,0xF609,0xF5E9,0xF5E9,0x7BEF,0x09F6,
-	0x01D6,0x01D5,0x01D5,0x01D5,0x1234,0x9C6F,0xEDCE,0xFE50,
-	0xFE91,0xFEB2,0xFED2,0xFEF2,0xFEF3,0xFEF5,0xFEF5,0xFED3,
-	0xFED1,0xF6B2,0xFEB2,0xFE93,0xFE92,0xFED2,0xFEF1,0xFEB0,
-	0xFE6F,0xFE2D,0xF5EB,0xF5A9,0xF588,0xF5A8,0xFDE8,0xF647,
-	0xF6A7,0xFEA8,0xFE69,0xFE4A,0xFDEB,0xFDAC,0xFD8B,0xFD6B,
-	0xB9E3,0xB9E2,0xBA02,0xBA22,0xB242,0xBA42,0xB262,0xB241,
-	0xB242,0xB242,0xB241,0xB242,0xB222,0xB222,0xB242,0xB222,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xBA62,0xBA82,0xBAA2,0xC2A2,
-	0xC2C2,0xCAE2,0xCB02,0xD342,0xDBA2,0xE401,0xEC41,0xEC41,
-	0xE422,0xE3C2,0xDB82,0xD362,0xD342,0xD343,0xD323,0xD323,
-	0xD344,0xD344,0xD344,0xD364,0xD364,0xD364,0xD384,0xD3A4,
-	0xD3A3,0xD3C3,0xD3C3,0xCBA3,0xCB83,0xCB43,0xC323,0xC303,
-	0xC303,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC2C3,0xC2E3,0xC303,
-	0xCB23,0xCB44,0xD344,0xD364,0xDB85,0xDBA5,0xE3C5,0xE3E5,
-	0xE425,0xEC46,0xEC66,0xECA6,0xECC6,0xECC6,0xF4E6,0xECE6,
-	0xED05,0xED05,0xED24,0xED24,0xE504,0xE4E3,0xDCA3,0xDC64,
-	0xDC24,0xDC04,0xEC43,0xF482,0xF482,0xF4A2,0xF483,0xF485,
-	0xF4A6,0xED06,0xED44,0xED44,0xE504,0xE4A5,0xE485,0xE485,
-	0xEC85,0xECA5,0xECA6,0xECA7,0xF4C7,0xF4E8,0xFCC8,0xFD08,
-	0xF548,0xF587,0xF587,0xF567,0xF567,0xF568,0xF568,0xF568,
-	0xF589,0xF5A8,0xF5C8,0xFDE8,0xF607,0xF607,0xF5A7,0xF567,
-	0xED27,0xECE7,0xECC7,0xE4A7,0xECA7,0xECC8,0xF508,0xFD4A,
-	0xFD8A,0xFDEA,0xFE29,0xF5E8,0xF587,0xF588,0xF5CB,0xF60E,
-	0xF5F0,0xF5F0,0xFDEF,0xFDEE,0xFDED,0xFE2C,0xF62B,0xD5AC,
-	0x09F3,0x0A33,0x0A53,0x0A32,0x0A32,0x0A12,0x0A13,0x0214,
-	0x0234,0x09D0,0x0109,0x0064,0x0063,0x0084,0x00C6,0x00E7,
-	0x0109,0x5B70,0x01F5,0x01D6,0x01F6,0x09F6,0x0A17,0x0A37,
-	0x0A36,0x0A16,0x0A17,0x0A17,0x0A17,0x01F6,0x09F6,0x01F5,
-	0xBD0D,0xFE0A,0xFE0A,0xF609,0xF609,0xF5E8,0xF609,0x32B4,
-	0x09D6,0x01B5,0x01D5,0x01D4,0x01F4,0x09F4,0x01D1,0x01AF,
-	0x016E,0x014D,0x012D,0x010D,0x010C,0x010A,0x010A,0x012C,
-	0x012E,0x014D,0x014D,0x7BEF,0xFE92,0xFED2,0xFEF1,0xFEB0,
-	0xFE6F,0xFE4E,0xF62D,0xF5EB,0xF5CA,0xF5C8,0xF5E8,0xFE67,
-	0xFEA8,0xFEA8,0xFE89,0xFE2A,0xFDEB,0xFDAC,0xFD8C,0xF54B,
-	0xB9E2,0xB9E2,0xBA02,0xBA22,0xBA42,0xBA42,0xBA42,0xB262,
-	0xB262,0xB241,0xB241,0xB242,0xB222,0xB222,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB242,0xB262,0xBA62,0xBA82,0xBAA2,
-	0xC2C2,0xCAE2,0xCB02,0xD342,0xDB81,0xE401,0xEC41,0xEC41,
-	0xE422,0xE3E2,0xDBA2,0xD362,0xD362,0xD342,0xD323,0xD323,
-	0xD344,0xD344,0xD344,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3A3,0xD3C3,0xD3A3,0xCBC3,0xCB83,0xCB63,0xC323,0xC303,
-	0xC303,0xC303,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB23,0xD364,0xD364,0xDB85,0xDBA5,0xE3C5,0xE3E5,
-	0xE405,0xEC46,0xEC66,0xECA6,0xECC6,0xECC6,0xF4E6,0xF4E6,
-	0xED05,0xED25,0xED24,0xE524,0xE504,0xE4E3,0xDCA3,0xDC64,
-	0xDC24,0xDC04,0xEC43,0xF462,0xF482,0xF4A2,0xF483,0xF485,
-	0xF4A6,0xF4E6,0xED45,0xED44,0xE504,0xE4A5,0xE485,0xE485,
-	0xEC85,0xECA6,0xECA6,0xECA6,0xF4C7,0xF4E8,0xFCE9,0xFD09,
-	0xF568,0xF5A8,0xF5A7,0xF588,0xF588,0xF588,0xF588,0xF588,
-	0xF589,0xF5A8,0xF5C8,0xFDE8,0xF607,0xF607,0xF5A7,0xF567,
-	0xED27,0xED07,0xECC7,0xECA7,0xECC7,0xECC7,0xF4E8,0xF54A,
-	0xFDAA,0xFE0A,0xFE29,0xFDE8,0xF588,0xF589,0xF5EC,0xF60F,
-	0xF610,0xF610,0xFDEF,0xFDEE,0xFDED,0xFE0C,0xF62C,0x6BB0,
-	0x0A13,0x0A33,0x0A53,0x0A32,0x0A12,0x0A12,0x0A12,0x0213,
-	0x4312,0x42D0,0x322B,0x0064,0x0063,0x0084,0x00C7,0x00E8,
-	0x0109,0x01B1,0x01F5,0x01D6,0x01D6,0x09F6,0x0A17,0x0A37,
-	0x0A36,0x0A16,0x0A17,0x0A17,0x0A17,0x01F7,0x09F6,0x01D5,
-	0x5331,0xFDEA,0xFE0A,0xF609,0xF5E9,0xF5E9,0xF609,0xD58B,
-	0x2254,0x01B5,0x01B5,0x01D5,0x01F4,0x01F3,0x01F1,0x01AF,
-	0x016E,0x014D,0x012D,0x010D,0x010C,0x010A,0x010A,0x010C,
-	0x014E,0x014D,0x014D,0x83EF,0xFE92,0xFED2,0xFEF1,0xFED0,
-	0xFE6F,0xF64E,0xF62D,0xF60C,0xF60B,0xF60A,0xF64A,0xF669,
-	0xF6A8,0xFEA9,0xFE89,0xFE4B,0xFDEC,0xFDAC,0xFD8B,0xF54B,
-	0xB9E2,0xB9E2,0xBA02,0xBA23,0xBA22,0xBA42,0xBA42,0xB262,
-	0xB262,0xB261,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB222,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA83,0xC2A3,
-	0xC2C2,0xCAE2,0xCB01,0xD321,0xDB81,0xE3E1,0xE421,0xEC41,
-	0xE422,0xE3E2,0xDBA2,0xDB82,0xD362,0xD343,0xD343,0xD343,
-	0xD343,0xD344,0xD364,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3A3,0xD3C3,0xD3C3,0xCBC3,0xCBA3,0xCB63,0xCB43,0xC323,
-	0xC302,0xC303,0xC303,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB23,0xCB44,0xD384,0xDBA5,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC66,0xEC86,0xECC6,0xF4C6,0xECE6,0xF506,
-	0xED05,0xED25,0xED24,0xED24,0xE524,0xE4E3,0xDCA4,0xDC63,
-	0xD424,0xDC23,0xEC43,0xF462,0xF482,0xF483,0xF484,0xF485,
-	0xF4A6,0xF4E6,0xED45,0xED44,0xE524,0xE4C5,0xE485,0xE485,
-	0xECA6,0xECA6,0xECA6,0xECA7,0xF4C7,0xF508,0xFD09,0xFD09,
-	0xF569,0xF5A8,0xF5A7,0xF587,0xF588,0xF587,0xF568,0xF568,
-	0xF589,0xF5A8,0xF5A8,0xFDE8,0xF608,0xF607,0xF5A7,0xF587,
-	0xED47,0xED07,0xE4C7,0xECC7,0xECC7,0xECE8,0xF508,0xF54A,
-	0xFDAA,0xFE0A,0xFE29,0xFDE8,0xF588,0xF589,0xF5ED,0xF60F,
-	0xF611,0xF611,0xFDEF,0xFDEE,0xFE0D,0xFE2C,0xF62C,0x1A33,
-	0x0A14,0x0A33,0x0253,0x0A32,0x0A32,0x2291,0x9C6F,0xF5ED,
+	0x6391,0x0A57,0xC005,0xA5A5,0xA49B,0x63A3,0x0003,0x6391,
+	0xF5C9,0xFDC8,0xF5C8,0x8002,0xF5C7,0xC008,0xACA4,0x9C9D,
+	0xACA5,0xAEEF,0x2600,0x0001,0x220E,0x012D,0xC006,0xA4AC,
+	0xA2A3,0xB7EE,0x9D00,0x0001,0x9C8F,0xFE6F,0xC00C,0x9CAB,
+	0xB4A3,0x8A83,0x529B,0x9C63,0xA4E4,0xB400,0x0000,0xF607,
+	0xC006,0xB3E4,0x9E8D,0x9D9D,0x9400,0x0000,0xAA21,0x8002,
+	0xAA01,0xC007,0x9C64,0x9CA4,0xE5A4,0xACA4,0x8002,0xAA02,
+	0xC004,0xEC5C,0xAC9C,0xEC00,0x8002,0xB242,0xC012,0xACE4,
+	0xACA4,0xECAC,0xA4F3,0xFDFC,0xB3ED,0x5494,0x549C,0x5CDC,
+	0x6400,0x8003,0xCB03,0xC021,0xA5A4,0xEB65,0xABA4,0xACA4,
+	0xA3A5,0x5B9D,0x9B5C,0x9CA5,0x9CA4,0xA39D,0xA4AC,0xACE4,
+	0xB4ED,0xACE4,0xACEC,0xADEC,0xB4AC,0x8002,0xEC65,0xC004,
+	0xADA3,0xACA4,0xA300,0x8002,0xE4C4,0xC006,0x5B9C,0x9D94,
+	0x9C9D,0xEC00,0x0000,0xF463,0xC009,0xB3A4,0xEC64,0x6EAD,
+	0x5B8D,0x9C5B,0x8003,0xE465,0xC023,0xEDAD,0xE4A5,0xACBB,
+	0xA39C,0x64A4,0xEC64,0xA4ED,0xA4AC,0xABAC,0xAB9C,0x4C9C,
+	0x9593,0x9C5C,0x9CE4,0xADF5,0xB5FD,0xB3BB,0x6B8B,0x0000,
+	0xED05,0xC009,0x949D,0x9CAD,0xB5FE,0xEDB4,0xB264,0x0001,
+	0x32D4,0x0A97,0xC006,0xB5AC,0xA4E5,0x6394,0x9200,0x0010,
+	0x09D0,0x00C6,0x0021,0x0000,0x0021,0x00C6,0x012A,0x018D,
+	0x0A14,0x0216,0x32B3,0xFE29,0xFE08,0xF5E7,0xF5C8,0x7BEF,
+	0x0A37,0x8003,0x0A38,0x0004,0x0216,0x1255,0xEDAA,0xFDC9,
+	0xFDE8,0x8004,0xF5C7,0xC007,0xECA4,0x5D9C,0xADAF,0xAEFE,
+	0x0002,0xCDB1,0x322E,0x012E,0xC003,0xABA2,0xA3B7,0x0002,
+	0x222F,0xACF0,0xF66F,0xC00D,0xE49C,0xABB4,0xA38A,0x8B4B,
+	0x9A9C,0x63E4,0xA4B4,0x0000,0xF607,0xC006,0xB3E4,0x9695,
+	0x9D9D,0x9400,0x0001,0xB241,0xAA21,0x8002,0xAA01,0xC006,
+	0x5CA4,0x9CEC,0x9DAC,0xA400,0x8002,0xAA02,0x0001,0xAA22,
+	0xAA02,0x8002,0xAA22,0x8002,0xB242,0xC012,0xACA4,0xE4AC,
+	0xECA4,0xACF4,0xF4B4,0xFCF3,0x9C55,0x5494,0x5CE4,0x6400,
+	0x8003,0xCB03,0xC006,0xA5A4,0xEB65,0xABE4,0x6400,0x8002,
+	0xCB63,0xC007,0x5C9C,0xA453,0x9CA4,0x9CA5,0x8002,0xBAA2,
+	0xC010,0xA5AC,0xE4B4,0xECA5,0xECAC,0xECAD,0xECAC,0xB4ED,
+	0xABAD,0xA400,0x8002,0xECA5,0xC015,0xACA3,0x64A4,0x9B5C,
+	0x9C95,0x9C9D,0xECF2,0xF3ED,0x6CA3,0xAE6D,0x638D,0x945C,
+	0x8003,0xE465,0xC02E,0xEDAD,0xE4A5,0xACB3,0xABA4,0x5CA4,
+	0xEC64,0xECA4,0xADAC,0xABAC,0xAB95,0x944B,0x9C94,0x5C9C,
+	0x9CA4,0xEDF5,0xB5FD,0xB3BB,0xAB43,0x4593,0x9CA5,0xA6BD,
+	0xFEED,0xB3AB,0x6C00,0x0001,0xC52C,0x1AB6,0xC006,0x25AC,
+	0xE563,0x9C9C,0x9B00,0x0010,0x01D0,0x00C6,0x0041,0x0000,
+	0x0021,0x00A5,0x0129,0x098C,0x0213,0x1235,0xCD6C,0xFE2A,
+	0xF608,0xF608,0xF5C8,0x8C2F,0x0A37,0xC004,0xA4A5,0x9CA3,
+	0xA300,0x0001,0xACAD,0xFDE9,0xC010,0xA4A3,0x63A4,0x9CAC,
+	0xA4E4,0x9DA4,0x64A5,0xEE6F,0xFEB5,0xAD00,0x0005,0xBD71,
+	0x840F,0x7BEF,0x9450,0xCD91,0xF670,0xC00B,0xA3A4,0x9DDC,
+	0xB3B2,0xA38C,0x4A93,0x929C,0x8002,0xF546,0xC008,0xBCBD,
+	0xFB9D,0x9595,0x9D9D,0x5500,0x0000,0xB241,0xC00A,0x5CA4,
+	0x9CA4,0x9C64,0xE4A4,0x9DAC,0xA400,0x8002,0xAA02,0x0002,
+	0xAA22,0xAA22,0xAA02,0x8002,0xAA22,0xC015,0xECA4,0xACA4,
+	0xECA4,0xECA4,0xACEB,0xF5B3,0xFDF3,0xAC55,0x9454,0x94A4,
+	0x649C,0x8002,0xCB03,0xC006,0xA5AC,0xE3A5,0xACA3,0x6400,
+	0x8002,0xCB63,0xC01B,0x6494,0xA494,0x5BA4,0x9CA5,0xA4A3,
+	0xA4A5,0xACE4,0xB4E4,0xADEC,0xACEC,0xADEC,0xACB4,0xEDAB,
+	0xADA4,0x8002,0xECA5,0xC015,0xACA3,0x64A4,0xA354,0x9D93,
+	0x9D9D,0xECF2,0xF3AD,0xACA3,0x6EAD,0x638C,0x9C55,0x8002,
+	0xE465,0xC030,0xE4AD,0xADE4,0xA4AD,0xABB4,0x639C,0xA4EC,
+	0x64EC,0xA5AC,0xA4B3,0xACAB,0x9D8C,0x5394,0x9C54,0x9C9C,
+	0xA4ED,0xF5FD,0xB5B4,0xBAAB,0x4345,0x9C94,0xADAE,0xF5F6,
+	0xB4AC,0xB4A3,0x5B00,0x0003,0xC50B,0x1AB5,0x0AB7,0x0AD7,
+	0x8002,0x0AB7,0x000B,0x0A96,0x01F0,0x00E6,0x0041,0x0000,
+	0x0021,0x00A5,0x0128,0x016C,0x1253,0xCD2C,0xFE29,0xC003,
+	0xA55B,0x9C9B,0x0007,0xBCEC,0x0A36,0x0A37,0x0A38,0x0A18,
+	0x1A56,0x9C6E,0xFDEA,0xC003,0xAC9C,0xA363,0x8003,0xF5E7,
+	0x0002,0xDD6A,0xBCEC,0xFDC9,0xC01C,0x64A4,0xEE6F,0xF6B5,
+	0xB5A4,0x9CA5,0xA69A,0x59A3,0xE45D,0xDCB3,0xB3A3,0x8B8A,
+	0x5392,0x9CA3,0xA5AB,0xB400,0x0000,0xF627,0xC006,0xF4A4,
+	0x9595,0x959D,0x5400,0x0000,0xB221,0xC004,0x64A4,0xA59B,
+	0xA400,0x8002,0xA9E1,0x8002,0xA9E2,0x8002,0xAA02,0x0001,
+	0xAA22,0xB222,0x8003,0xAA22,0xC00B,0xE4AC,0xA4AC,0xE4AC,
+	0xA4EC,0xACEC,0xACB3,0x0000,0xDBA2,0xC008,0xFCAC,0x9C54,
+	0x5494,0x9C64,0xE400,0x8002,0xCB03,0xC006,0xA5A4,0xEBA5,
+	0xACA4,0xAC00,0x8002,0xCB63,0xC034,0x639D,0x9C9B,0x9C9C,
+	0x5CA4,0xA5A3,0xA4A5,0xACE4,0xACEC,0xADEC,0xACEC,0xADEC,
+	0xACB4,0xEDAB,0xADA4,0xACA3,0xA4AC,0xABA4,0x649C,0x5B94,
+	0x9D9C,0x95E4,0xFAF3,0xADAC,0xA366,0xB56B,0x8D93,0x9C00,
+	0x8003,0xE465,0xC006,0xEDAD,0xE5AC,0xA4AB,0xB400,0x8003,
+	0xF526,0xC025,0x64EC,0xA4AD,0xA4AC,0xB3A3,0xA495,0x4B94,
+	0x9C94,0x5C9C,0xA5EC,0xF5F5,0xBDBC,0xBB62,0x8C84,0x54A5,
+	0xA6AD,0xF5FD,0xADAC,0xB3A3,0x5C93,0x0002,0xCCEC,0x3B34,
+	0x0AB6,0xC003,0xA564,0xE493,0x0009,0x09F0,0x00C6,0x0022,
+	0x0000,0x0022,0x00A5,0x0128,0x326D,0xCD4E,0xF5E9,0xC004,
+	0xF4A5,0x5B9C,0x9C00,0x0006,0xBCEC,0x0A16,0x0A37,0x0A17,
+	0x6392,0xDD6A,0xFDEA,0xC005,0xACA4,0x5CAB,0xA39C,0x0005,
+	0x9C6E,0x42F4,0x0A17,0x0A16,0x09F6,0xFDE9,0xC024,0xA465,
+	0xE56E,0xF7B5,0xB5A4,0x9CA5,0xA69A,0x59A3,0xADDC,0x54F3,
+	0xB3A3,0x8B8A,0x539A,0x94A4,0xA3AC,0xBCBD,0xF4A4,0x9596,
+	0x949D,0x5400,0x0000,0xB221,0xC004,0xA4A5,0xAC5B,0x9C00,
+	0x8002,0xA9E1,0x0001,0xA9E2,0xA9E2,0x8003,0xAA02,0x0001,
+	0xAA22,0xB222,0x8002,0xAA22,0x8002,0xB222,0xC010,0xACAC,
+	0xE4AC,0xA4EC,0xACE4,0xB4B3,0xFDF3,0xF5A3,0x5594,0x4C00,
+	0x8003,0xD322,0xC008,0x5DE4,0x65EC,0xA3A5,0xACA4,0xAC00,
+	0x8003,0xCB63,0xC033,0x5CA4,0x939C,0x9C64,0xA49D,0xA3A4,
+	0xA5AC,0xE4AC,0xF4A5,0xECAC,0xEDAC,0xECAC,0xB4EC,0xACAD,
+	0xACA3,0xA4AC,0xA4AB,0xA45C,0xA45B,0x949C,0x9D9D,0xDBFB,
+	0xF3AC,0xA4AC,0xA675,0xAB4D,0x939C,0x8002,0xE465,0xC008,
+	0xECA5,0xADE4,0xADA4,0xABB4,0xAB00,0x8002,0xF526,0xC027,
+	0x64EC,0xA4A5,0xACAC,0xB3AB,0x9C94,0x548D,0x9B94,0x5C9C,
+	0xA4ED,0xF5FD,0xB5BC,0xBB63,0x8B8C,0x5D9C,0xA6AE,0xF5F5,
+	0xACB4,0xAB64,0x9B9C,0x8C9B,0x000D,0x9C4E,0x3334,0x0AB7,
+	0x0A97,0x0A76,0x09F0,0x00E7,0x0022,0x0000,0x0042,0x31E9,
+	0x9CB1,0xFEB4,0xFE0C,0xC006,0x59F4,0xA5A3,0x549C,0x5D00,
+	0x0003,0x6371,0x9C6E,0xD56A,0xF5E8,0xC007,0xA5E5,0xADA3,
+	0x5CEB,0x5CA3,0x0005,0x7BEF,0x0A17,0x09F7,0x09F6,0x09F6,
+	0xFDE9,0xC01C,0x64A5,0xE66E,0xFEAD,0xADAC,0x9CA6,0xA5A2,
+	0x51A3,0xADD4,0xA4A3,0xBBA3,0x8B8A,0x539A,0x94A4,0xABA4,
+	0xBC00,0x0000,0xF647,0xC006,0xECA4,0x8D9D,0x959D,0x5400,
+	0x0000,0xB222,0xC005,0xA3A4,0xAC5C,0x9CA4,0x8004,0xA9E2,
+	0x0001,0xAA02,0xAA02,0x8003,0xAA22,0x0001,0xB222,0xB242,
+	0x8002,0xB222,0xC019,0xACAC,0xA4E4,0xACEC,0xACA4,0xF4AC,
+	0xFCF3,0xF5AC,0x9B55,0x5494,0x9CA5,0xA3A5,0xA45C,0xADE3,
+	0x8002,0xD344,0xC01E,0xACA3,0xA46C,0xA3A5,0x549B,0x9464,
+	0x9CA4,0xA59B,0xA5A4,0xABED,0xA4AC,0xF5E4,0xA4F5,0xA4B4,
+	0xEDAB,0xB4ED,0xAC00,0x8002,0xECA6,0xC015,0xABAC,0xA4A3,
+	0x649B,0x5C9C,0x949D,0x9CE4,0xF3F3,0xED64,0xA4AD,0x6D73,
+	0x9C8D,0x8002,0xE465,0xC009,0xACA4,0xE5AC,0xEDA5,0xA4AB,
+	0xB4AB,0x8002,0xED26,0xC005,0xA3EC,0xA5A4,0xADAC,0x8002,
+	0xF5C6,0xC021,0x9B4C,0x9594,0x9B9C,0x5CA5,0xECF5,0xB6FD,
+	0xBCB3,0xA34B,0x8C5C,0xA5A6,0xAEF5,0xF4AC,0xACAB,0x649B,
+	0x9494,0xA39C,0xA314,0x0000,0xBCCC,0x8003,0x7BEF,0x0005,
+	0xBDF7,0xEF5B,0xFF5A,0xFF18,0xFEB4,0xFE0C,0xC00B,0x99B4,
+	0xA55B,0x9C9B,0xE5AC,0x5BEC,0xA465,0x8003,0xFE0A,0x0008,
+	0xFDE9,0xF609,0xF5E9,0x7BEF,0x09F7,0x09F6,0x01F6,0x01F6,
+	0xFE0A,0xC005,0x5CA4,0xE6B6,0xB6B5,0x8002,0xFED2,0xC01B,
+	0x9DAE,0x9259,0xA3AC,0xDD9C,0xA3BB,0x9B93,0x5392,0x939B,
+	0x9CAB,0xADBB,0xBCF5,0x9C95,0x9695,0x9C54,0x0000,0xB222,
+	0xC006,0xA4AC,0xA39C,0x649C,0xA400,0x8002,0xA9E2,0x0001,
+	0xAA02,0xAA02,0x8004,0xAA22,0x8004,0xB222,0xC011,0xACA4,
+	0xACE4,0xACA4,0xF4A4,0xECB4,0xF4FC,0xF4AC,0x9B55,0x549B,
+	0x8002,0xD322,0xC006,0xA5A4,0x5CAD,0xE3AD,0xA400,0x8002,
+	0xD364,0x0000,0xD383,0x8002,0xCB83,0xC003,0x5C94,0x9B9D,
+	0x8003,0xBAC2,0xC010,0x9CA4,0xACED,0xA4AC,0xEDAC,0xECEC,
+	0xADAC,0xECAD,0xB3ED,0xAC00,0x8002,0xECA6,0xC00B,0xABAC,
+	0xA4A3,0x64A4,0x5B94,0x959C,0x9CA4,0x0000,0xEC43,0xC008,
+	0xF3A5,0xACA4,0xAD75,0xAC5B,0x9400,0x8002,0xE465,0xC00A,
+	0xACA4,0xE5AC,0xEDA5,0x9CB3,0xB4AB,0x6400,0x8002,0xED26,
+	0xC02B,0xECA4,0xA5AC,0xABB4,0xA4A3,0x9C4D,0x9C94,0x949C,
+	0x64E4,0xADF5,0xF6BC,0xB4B3,0x638B,0x8C5C,0xA6EE,0xADAD,
+	0xF5AB,0xACAB,0xAC54,0x9493,0xA4A3,0x9CA3,0xA3AD,0x0002,
+	0xF62E,0xFF18,0xFFBD,0xC004,0xB593,0x898A,0x9000,0x0000,
+	0xFE0D,0xC00B,0x98B4,0xA55B,0x9C9B,0xA5AC,0x9BA4,0xEC65,
+	0x8003,0xFE0A,0x0007,0xFE09,0xF609,0xF5E8,0x7BEF,0x09F7,
+	0x01F6,0x09F6,0x01F6,0x8002,0xFE0A,0xC003,0xA6AE,0xAEB5,
+	0x8002,0xFED2,0xC013,0x9EAD,0x9A59,0x9BAD,0xDC9C,0xA4BA,
+	0xA38C,0x5193,0x9393,0xABA4,0xADBC,0x0000,0xFE66,0xC006,
+	0xAD9C,0x958E,0x9D9C,0x5C00,0x0000,0xB222,0xC00B,0xA3AD,
+	0xA3A4,0x5CA4,0x9CA5,0xA49C,0xACA4,0x8004,0xAA22,0x8004,
+	0xB222,0xC018,0xACA4,0xACA4,0xE4AC,0xECAC,0xACEC,0xF4FC,
+	0xFCAC,0xA354,0x9554,0x94A4,0xAC9D,0xA464,0xA400,0x8002,
+	0xD344,0x8002,0xD364,0x0000,0xD384,0x8002,0xCB83,0xC018,
+	0x9C5C,0x94A4,0x5B9D,0xA3A4,0x9CA4,0xACED,0xA4AC,0xEDAC,
+	0xECEC,0xADAC,0xECAC,0xB4ED,0xAC00,0x8002,0xECA6,0xC00B,
+	0xABAC,0xA4A3,0xA464,0x9B5C,0x9593,0x9DA4,0x0000,0xEC43,
+	0xC018,0xF3A5,0xACA4,0x6DB6,0xAB9B,0x5455,0xDCA4,0xACA4,
+	0xE5A4,0xEDAD,0xA4AC,0xB3AC,0xA39C,0xA400,0x8002,0xF546,
+	0xC029,0xA5AC,0xABB4,0xA4A3,0x9C95,0x549C,0x949C,0x9DA4,
+	0xACF5,0xB6FC,0xB4B3,0x638B,0x8CA5,0x66EE,0xA4B6,0xECAB,
+	0xACAB,0xAC54,0x9C94,0x9BA4,0x9BA3,0xA3AD,0x0002,0xF60E,
+	0xFF18,0xFFBD,0xC004,0xAD9B,0x819A,0x8800,0x0000,0xFE0D,
+	0xC012,0x9874,0xE55B,0xA493,0xE5AC,0x5BEC,0xA4A5,0xACA5,
+	0xA5A3,0xA364,0x9B00,0x0001,0x7BEF,0x09F7,0x8002,0x01F6,
+	0x0000,0xFE0A,0xC01C,0x64A4,0xE6AE,0xB7AD,0xBC9C,0xA49E,
+	0xADA2,0x9263,0xA4DC,0x9CAC,0xB3AB,0x8392,0x5293,0x9B9C,
+	0xABAD,0xBC00,0x0000,0xF666,0xC006,0xADDD,0x9595,0x959C,
+	0x5C00,0x0000,0xB222,0xC006,0xA4A3,0xA4AD,0xA35C,0xA400,
+	0x8005,0xAA02,0x8003,0xAA22,0xC004,0xE4A4,0xAC9C,0xA400,
+	0x8002,0xB242,0xC016,0xACE4,0xACAC,0xE4B4,0xECEC,0xFCBC,
+	0xF4A3,0x9D54,0x5494,0xA49C,0xA5A4,0x64A5,0xEB00,0x8002,
+	0xD344,0xC003,0xACA4,0xABA4,0x8002,0xCB83,0xC004,0x549C,
+	0x9C5C,0xA400,0x8002,0xBAC2,0xC00F,0x9CAD,0xECA4,0xACED,
+	0xECAC,0xACED,0xA4F4,0xADB3,0xEDAC,0x8002,0xECA6,0xC00B,
+	0xABAC,0xA4A3,0x6CA4,0x935C,0x949D,0x949C,0x0000,0xEC43,
+	0xC014,0xF3A5,0xACA4,0xA576,0xB3A3,0x548D,0x9CA4,0xACA4,
+	0xE4A5,0xF5A5,0xA4AC,0xB300,0x8002,0xF546,0xC027,0x5CEB,
+	0xA5A4,0xACA5,0xABB4,0xACA4,0x9454,0x9D94,0x949C,0x64E4,
+	0xA4F6,0xB4FD,0xB4B3,0x638B,0x8CA5,0x6EE6,0xADAD,0xECAB,
+	0xACAB,0x649C,0x9C94,0x8002,0xF58B,0x0005,0xF58A,0xF569,
+	0xF589,0xF62E,0xFEF7,0xFFBC,0xC004,0xAE9B,0x809B,0x8800,
+	0x0000,0xFE0D,0xC012,0x98B4,0xA49C,0x5C9B,0xA5EC,0x5BAC,
+	0xE465,0xECAE,0x9BA4,0xA364,0x9B00,0x0005,0x7BEF,0x09F7,
+	0x09F6,0x01F6,0x01D5,0xFE0A,0xC01C,0x64A5,0xE5AE,0xB7AD,
+	0xB4AC,0x9CA6,0xA5A3,0x9A5A,0xA4E5,0x94AB,0xB3A3,0x8B92,
+	0x5293,0x9BA4,0xA3AD,0xBC00,0x0000,0xF667,0xC006,0xEC9D,
+	0x9595,0x959C,0x5400,0x0001,0xB202,0xB222,0x8002,0xB242,
+	0xC003,0xA364,0x9D9B,0x8003,0xAA02,0x8004,0xAA22,0x0001,
+	0xB222,0xB222,0x8006,0xB242,0xC00D,0xECAC,0xACE4,0xACEC,
+	0xB3F5,0xFCFC,0xAC9C,0x4C94,0x8002,0xD342,0xC004,0x9DA4,
+	0xA5A3,0xAC00,0x8002,0xD344,0xC02D,0xACAC,0xA3A4,0x6CA4,
+	0x9C5C,0x939C,0x9CA5,0x639C,0xA4A5,0xA4EC,0xA4AC,0xECED,
+	0xACAC,0xE5AC,0xEDB4,0xECB4,0xACAC,0xA4AC,0xACA3,0xA4AB,
+	0xA464,0x9B54,0x959C,0x94A4,0x0000,0xEC43,0xC027,0xEBAC,
+	0xADA4,0xA5B6,0x73A3,0x5495,0x94AC,0xA4E4,0xA5AC,0xE5AD,
+	0xA4AC,0xABB3,0xAC5C,0xE4A3,0xA5A4,0xA5AB,0xADB4,0xABA4,
+	0x9C8D,0x5C94,0x9C9C,0x8002,0xECA7,0xC013,0xF5B5,0xFDBC,
+	0xAB63,0x8B8C,0xA5AF,0x6DEE,0xACEB,0xA4AC,0x6BA4,0x9C9C,
+	0x8002,0xF5AC,0x000C,0xBCCD,0x7BF0,0x4333,0x4333,0x42F0,
+	0x632E,0x8C71,0xDEDA,0xFF9C,0xFF59,0xFF18,0xFEB5,0xFE0D,
+	0xC012,0x99AB,0xACA4,0x549B,0xADA4,0x9BAB,0xA5A5,0xECA5,
+	0xA464,0xE35C,0xA400,0x0006,0x7BEF,0x09F7,0x09F6,0x01D6,
+	0x01D5,0xCD4C,0xF60A,0xC01A,0xE5A5,0xAEB6,0xB6AC,0xAC9C,
+	0xA6AD,0x9C99,0x5AA5,0xA4D4,0xABB3,0xAC8A,0x924B,0x9A53,
+	0xDCAB,0xB500,0x0000,0xF626,0xC007,0xFDA4,0x9D95,0x8D9D,
+	0x945C,0x0002,0xB202,0xB202,0xB222,0x8002,0xB242,0xC005,
+	0xA39C,0x659B,0xA5A4,0x8002,0xAA22,0x8003,0xB222,0x8005,
+	0xB242,0xC019,0x9CAC,0xECAC,0xA4EC,0xACEC,0xABFD,0xFCF4,
+	0xB49B,0x9455,0x549C,0xA4A5,0x9CA5,0xA46B,0xE5A4,0x8002,
+	0xD364,0xC00B,0xACA3,0x6CA4,0x9C9C,0x5C9C,0x9B9D,0xA365,
+	0x8002,0xBAC3,0xC01C,0xECA4,0xACEC,0xADEC,0xACE5,0xACED,
+	0xACB3,0xF4AD,0xACA4,0xACE4,0x6BAC,0xA3A4,0x649B,0x549C,
+	0x9495,0xA400,0x0000,0xEC43,0xC016,0xEBAC,0xACA5,0xA6B5,
+	0x6BAB,0x5C8C,0x9D9C,0xACE4,0xA5AC,0xECA6,0xA4AC,0xB4AA,
+	0xAC00,0x8004,0xF546,0xC023,0xA5AC,0xB4AC,0xACA4,0x9C94,
+	0x9454,0x9C9C,0x5CE4,0xA4F6,0xB4FD,0xBCB3,0x5B83,0x94AE,
+	0xAF6D,0xE5AD,0xEBA3,0xACAB,0x63DD,0x5C94,0x0002,0xACAE,
+	0x22B2,0x0A54,0xC003,0xA4A5,0x6CC0,0x0013,0x0108,0x0063,
+	0x0042,0x630C,0xEED8,0xFF18,0xFED5,0xFE2D,0xFDEA,0xFE09,
+	0xFE29,0x9C8E,0x5352,0x1A76,0x0A16,0x0A16,0x32D4,0x73B1,
+	0xDD6A,0xF5E9,0xC006,0xECAD,0x9CA4,0xA39C,0x6400,0x0006,
+	0x8C2F,0x01F7,0x09D6,0x01D6,0x01D5,0x6371,0xFE0A,0xC004,
+	0xA5A5,0xAEB6,0xB600,0x8002,0xFED2,0xC01B,0xA5AE,0xA492,
+	0xA264,0xDD9C,0xA3B3,0xAB8A,0x9352,0x9B52,0xDCAC,0xB4BB,
+	0xFDAC,0x9595,0x9595,0x9C95,0x0002,0xB1E2,0xB202,0xB222,
+	0x8003,0xB242,0x8002,0xAA21,0x8003,0xAA22,0x8004,0xB222,
+	0x8005,0xB242,0xC010,0x9CAC,0xECAC,0xA4EC,0xACE4,0xB3F4,
+	0xBDF3,0xFCA4,0x9554,0x9400,0x8002,0xD342,0xC005,0xA59D,
+	0xA4AB,0xA5A4,0x8002,0xD364,0xC00B,0xACA3,0xAC6C,0x9C94,
+	0x9C5C,0x9C9C,0xA464,0x8002,0xBAC3,0xC01C,0xECA4,0xACEC,
+	0xADEC,0xEDA4,0xACED,0xB3EC,0xB4AD,0xACA4,0xACAC,0xA3AC,
+	0xA3A4,0x649B,0x5C94,0x949D,0x9C00,0x0000,0xEC43,0xC009,
+	0xEBAC,0xACA5,0xA6AD,0x74B2,0x9C4D,0x8002,0xE485,0xC009,
+	0xE5AB,0xA5A4,0xEDA5,0xACAC,0xB3AB,0x8003,0xF546,0xC023,
+	0xA5A4,0xADB4,0xACB4,0xA39C,0x8D53,0x949C,0x9C5C,0xE4A5,
+	0xF5B5,0xFCBC,0xB35B,0x8394,0xB6AF,0xA6AD,0xE4AB,0xA3AC,
+	0xAB63,0x9D9C,0x0001,0x6390,0x0A32,0xC005,0xAD64,0xE5A5,
+	0xA488,0x000B,0x0109,0x0063,0x0022,0x0063,0x1127,0xCDF5,
+	0xFED5,0xFE2E,0xF5E9,0xDD8B,0x32B4,0x01D6,0xC006,0xB5EC,
+	0x9BA4,0xAD9D,0xA300,0x0001,0x73B0,0xF609,0xC005,0xED9C,
+	0xA4A3,0x649C,0x0001,0xBD0C,0x09F7,0xC003,0xA35B,0xA4A3,
+	0x0001,0xCD4C,0xF60B,0xC022,0xA5AE,0xAEF6,0xB4AC,0x9CA5,
+	0xAEA4,0x9A9A,0x65E4,0x9DA3,0xB2A3,0x938A,0x529B,0x9B9B,
+	0xA4B4,0xBCFC,0xAC95,0x9595,0x959C,0x9500,0x0003,0xB1E2,
+	0xB202,0xB222,0xB222,0x8002,0xB242,0xC005,0xA3A4,0x9CA5,
+	0x64A4,0x8005,0xB222,0x8006,0xB242,0xC008,0xACE4,0xACA4,
+	0xACE4,0xACF4,0xAC00,0x0000,0xDB82,0xC00E,0xFBBC,0xE55B,
+	0x558C,0x5C9C,0xA4A5,0x9CA4,0x65EC,0xA400,0x8002,0xD364,
+	0xC02B,0xACA3,0xACAC,0x5C9C,0x5C94,0x9CA4,0x9CA4,0x64A4,
+	0x9CAC,0xECA4,0xECAD,0xECEC,0xA5AC,0xEDAB,0xB5EC,0xB4AC,
+	0xA4AC,0xEC64,0xA3AB,0xA464,0x9B5C,0x9495,0x54E4,0x0000,
+	0xEC43,0xC009,0xF3A4,0xACA5,0xA6AD,0x73B4,0x9B54,0x8002,
+	0xE485,0xC01F,0xE46C,0xE5A4,0xEDA5,0xACEB,0x7CA3,0xA49C,
+	0xA4A5,0xACA5,0xACAC,0xACEC,0x6B9C,0x8C54,0x9C94,0x9C5C,
+	0xE4AC,0xEDF6,0x0000,0xFDAA,0xC00F,0xB4B4,0x528B,0x9CAF,
+	0xAFAE,0xACA4,0xE3A4,0xABAB,0x649C,0x0001,0x6391,0x0253,
+	0xC006,0xDBA4,0xA5A4,0xAE63,0xC100,0x000A,0x0109,0x0063,
+	0x0042,0x0064,0x00C7,0x1148,0xCDD3,0xFE2E,0xEDAB,0x2275,
+	0x01D6,0xC004,0xECAD,0xAC63,0xDC00,0x8002,0x0A17,0x0003,
+	0x01F6,0x32B3,0xEDCB,0xFE0A,0xC004,0xA49C,0x6B9C,0xA400,
+	0x0007,0x2275,0x09F6,0x01F6,0x01D5,0x01D5,0x32B3,0xEDCB,
+	0xFE0C,0xC021,0xAEAE,0xB6AC,0xACAC,0x9DAE,0xA49A,0x9AA5,
+	0xA49D,0xA3B4,0xAB92,0x8A52,0x929B,0x9CAC,0xABBC,0xBCEC,
+	0x9596,0x9595,0x9B54,0x0003,0xB9E2,0xB9E2,0xB222,0xB222,
+	0x8002,0xB242,0x8002,0xB241,0x0002,0xB242,0xAA22,0xAA22,
+	0x8004,0xB222,0x8007,0xB242,0xC018,0xACA4,0xE4AC,0xACEC,
+	0xA4EC,0xB4F4,0xFCFB,0xED5B,0x9D54,0x8C5C,0xA4A5,0x9CA4,
+	0x65EC,0xA400,0x8002,0xD364,0xC022,0xACA3,0xACA4,0x64A4,
+	0x945C,0x9C9C,0xA45C,0xE464,0xA4E4,0xA4AC,0xECAD,0xECAC,
+	0xE5AC,0xEDAB,0xACF5,0xB4AC,0xA4AC,0xECA4,0x6B00,0x8002,
+	0xED04,0xC005,0x649B,0x548D,0x5CDC,0x0000,0xEC23,0xC017,
+	0xFBA4,0xAC9D,0xAEAE,0x73B3,0xA34C,0x9594,0xECA4,0xACA5,
+	0xA4ED,0xAD9C,0xF473,0xB3A4,0x8003,0xF567,0xC020,0xA5AC,
+	0xACAC,0xACAB,0x9C94,0x944C,0x9C9C,0x5CE4,0xACED,0xFEBD,
+	0xB3B3,0x538B,0x9DAE,0xB7AE,0xA4E4,0xA3A3,0xABAC,0x6400,
+	0x0001,0x7BF0,0x0A33,0x8003,0x0A32,0xC003,0x9DAD,0xAC81,
+	0x0001,0x0108,0x0064,0xC003,0x9BB5,0xB7AC,0x0003,0x428C,
+	0xFE2E,0x5332,0x01D6,0xC005,0xA4EC,0xADAC,0xA39C,0x8002,
+	0x0A17,0x0002,0x01F6,0x09F6,0x6371,0x8002,0xFE0A,0x0005,
+	0xF609,0xF5E9,0xF5E9,0x7BEF,0x09F6,0x01D6,0x8002,0x01D5,
+	0x0003,0x1234,0x9C6F,0xEDCE,0xFE50,0xC01F,0xB5AD,0xACAC,
+	0xA5A6,0xA49A,0xA25D,0xE49D,0xA3B4,0xAB93,0x9392,0x5292,
+	0x9BAC,0xF47B,0xBCE5,0x959D,0x8D95,0x9B9C,0x0000,0xB9E3,
+	0xC00E,0xA3AC,0xAC6C,0xE46C,0x9BA5,0xA4A3,0xA59C,0xA4AC,
+	0x9C00,0x8008,0xB242,0x8002,0xB262,0xC013,0xE4AC,0xACE4,
+	0xACEC,0xACF4,0xFCFB,0xF4A4,0x5D8C,0x545C,0x9CA5,0x9CA4,
+	0x8002,0xD344,0x8002,0xD364,0xC00A,0xACAC,0xA3AC,0xA45C,
+	0x9C94,0x5C9C,0xA400,0x8003,0xC2E3,0xC01C,0x9CAC,0xACEC,
+	0xADE4,0xACED,0xACEC,0xACB4,0xEDAC,0xB4AC,0xA4EC,0x64AB,
+	0xA4AB,0xA45C,0x9B54,0x9594,0x9C00,0x0000,0xEC43,0xC019,
+	0xF3A4,0xAC9D,0xA6AD,0x7CB2,0xA454,0x8D9C,0xA4E4,0xACA5,
+	0xA5EC,0xADDC,0xB474,0xB3A4,0x9CA4,0x8002,0xF568,0xC01E,
+	0xADAB,0xACEC,0x6BA4,0x8C94,0x5494,0x9C5C,0xE4AD,0xF4F6,
+	0xB4BC,0xB353,0x8BA5,0xB7B7,0x9EA4,0xE3A3,0xA3B3,0x6300,
+	0x0001,0xD5AC,0x09F3,0xC008,0xB4AC,0x9BA4,0x9CA5,0x65AC,
+	0xC800,0x0001,0x0109,0x0064,0xC004,0xA3AD,0xB6AD,0xAE00,
+	0x0001,0x5B70,0x01F5,0xC006,0x9DAC,0xE4AD,0xACA3,0x9C00,
+	0x8002,0x0A17,0x0004,0x01F6,0x09F6,0x01F5,0xBD0D,0xFE0A,
+	0xC004,0xA463,0xA49B,0xAD00,0x0001,0x32B4,0x09D6,0xC011,
+	0x5BAC,0xA3AC,0xE459,0x9A93,0x9B9C,0x9CA3,0xA2A4,0xAEA6,
+	0xABA4,0x0001,0x7BEF,0xFE92,0xC009,0xB4AB,0x9393,0x9B5B,
+	0x929B,0xA2AC,0x0000,0xFE67,0xC007,0xB5A4,0x9D8D,0x9595,
+	0x9C53,0x0003,0xB9E2,0xB9E2,0xBA02,0xBA22,0x8002,0xBA42,
+	0xC006,0x6CA4,0x9BA4,0xA59C,0xA400,0x800A,0xB242,0xC00B,
+	0xACA4,0x9CAC,0xE4AC,0xACEC,0xECAC,0xF4F3,0x0000,0xE401,
+	0xC009,0xF4A4,0x5D94,0x5454,0xA49C,0x9DA4,0x8002,0xD344,
+	0xC00B,0xACA4,0xACA4,0xACA3,0xAC9C,0x6C94,0x9C54,0x8002,
+	0xC303,0x8004,0xC2E3,0xC01A,0xACEC,0xA4F5,0xA4ED,0xACEC,
+	0xACAC,0xF5AC,0xB4AC,0xA4EC,0xA46B,0xACA3,0x649C,0x9B54,
+	0x9594,0x9C00,0x0000,0xEC43,0xC00D,0xEBAC,0xAC9D,0xA6AD,
+	0xB47B,0xA354,0x8D9C,0xA4E4,0x8002,0xECA6,0xC006,0xEDAD,
+	0xE5AC,0x7BB4,0xA300,0x8004,0xF588,0xC01E,0xA5AB,0xACEC,
+	0x6BA4,0x8C94,0x549C,0x949C,0xACA4,0xEDBE,0xFCBC,0xAB93,
+	0x4CA5,0xBFAF,0xA5A4,0xDBA3,0xA3AB,0x6C00,0x0004,0x6BB0,
+	0x0A13,0x0A33,0x0A53,0x0A32,0x8002,0x0A12,0x0004,0x0213,
+	0x4312,0x42D0,0x322B,0x0064,0xC004,0xA3AD,0xB7AD,0xAD00,
+	0x0001,0x01B1,0x01F5,0xC006,0x9DA4,0xECAD,0xACA3,0x9C00,
+	0x8002,0x0A17,0x0004,0x01F7,0x09F6,0x01D5,0x5331,0xFDEA,
+	0xC004,0xAC63,0x9CA4,0xAC00,0x0002,0xD58B,0x2254,0x01B5,
+	0xC010,0xA4AC,0xABA3,0xA292,0x939B,0x9C9C,0xA3A2,0xA4A6,
+	0xB6A3,0xA400,0x0001,0x83EF,0xFE92,0xC012,0xB4AB,0x9B8B,
+	0x5B9B,0x9BA3,0xA3B4,0xABB3,0xE59C,0x968D,0x949B,0x5400,
+	0x0000,0xB9E2,0xC008,0xA4AC,0xADA3,0xACA4,0x6CA4,0xA300,
+	0x8006,0xB242,0x0000,0xB222,0x8006,0xB242,0x8003,0xB262,
+	0xC00F,0xE4AD,0xECAB,0xECAB,0xECFC,0xFCB4,0xEC5D,0x9454,
+	0x9C5C,0x8003,0xD343,0x0000,0xD344,0x8002,0xD364,0xC00D,
+	0xACA4,0xACA3,0xACA4,0x649C,0x949C,0x5C9B,0xA5A4,0x8003,
+	0xC2E3,0xC01A,0xACEC,0xA4AD,0xF4ED,0xA4AC,0xECAD,0xECB4,
+	0xACB4,0xE46C,0xEC63,0xACA3,0xA464,0x9355,0x9355,0xE300,
+	0x0000,0xEC43,0xC00C,0xEBAC,0xA5A5,0xA5AD,0xB47B,0xA35C,
+	0x8D94,0xA400,0x8002,0xECA6,0xC022,0xA5EC,0xB5E5,0xA47C,
+	0xB3A3,0x9CA5,0xA39D,0xA4AD,0xABA4,0xF46C,0xA38C,0x9C54,
+	0x9454,0xE4A4,0xADEC,0xB6FC,0xBCAB,0x934C,0xA500,0x0000,
+	0xF5ED,0xC007,0xAEA6,0xA4DA,0xA3AB,0xAB64,0x0000,0x1A33,
+	0xC004,0x1DAB,0x6CDB,0xA400,0x0016,0x2291,0x9C6F,0xF5ED,
 	0xFDEC,0xF62F,0xFEF6,0xDEB8,0x83EF,0x00A5,0x00E7,0x00E8,
 	0x010A,0x01B0,0x09F4,0x01F6,0x01D6,0x1A35,0x73B1,0xBCCC,
-	0xBCEC,0x8C2F,0x2295,0x09F7,0x0217,0x01F7,0x01F6,0x01D5,
-	0x09D5,0xEDCB,0xFE09,0xF5E9,0xF608,0xF5E9,0xFE09,0xFE29,
-	0xEDEA,0x42D3,0x01B5,0x01D4,0x01F4,0x01F3,0x01D1,0x01B0,
-	0x016E,0x016D,0x012D,0x010D,0x010C,0x010A,0x010A,0x010C,
-	0x012D,0x094D,0x014D,0x7BEF,0xFE92,0xFED2,0xFEF1,0xFED0,
-	0xFE8F,0xFE4E,0xF62D,0xF60C,0xF5EB,0xF62B,0xF64C,0xFE8B,
-	0xFECA,0xFECA,0xFE8A,0xFE4B,0xFE0C,0xFDCC,0xFD8C,0xF56B,
-	0xB9C3,0xB9E2,0xB9E2,0xBA02,0xBA22,0xBA42,0xBA62,0xB262,
-	0xB262,0xB262,0xB241,0xB261,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,
-	0xB242,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA82,0xBAA2,
-	0xC2C2,0xCAE2,0xCB02,0xD322,0xD362,0xDBC1,0xE421,0xEC41,
-	0xEC42,0xE402,0xDBC2,0xDB81,0xD362,0xD342,0xD343,0xD323,
-	0xD343,0xD344,0xD364,0xD364,0xD364,0xD384,0xD384,0xD3A4,
-	0xD3A3,0xD3A3,0xD3C3,0xD3C3,0xCBA3,0xCB83,0xCB43,0xC323,
-	0xC303,0xC303,0xC303,0xC2E3,0xC2E3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB23,0xCB44,0xD364,0xDB85,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC46,0xEC66,0xECA6,0xECC6,0xF4C6,0xECE6,0xF506,
-	0xED25,0xED25,0xED25,0xED24,0xE523,0xE503,0xDCA3,0xDC63,
-	0xD423,0xDC23,0xEC43,0xF462,0xF482,0xF483,0xF484,0xF485,
-	0xF4A7,0xF4E6,0xED25,0xED45,0xED44,0xE4C5,0xE485,0xE485,
-	0xECA6,0xECA6,0xECA6,0xECC7,0xF4E8,0xF509,0xFD0A,0xFD29,
-	0xF569,0xFDA8,0xF5C7,0xF5A8,0xF588,0xF568,0xF568,0xF568,
-	0xF589,0xF5A8,0xF5A8,0xFDE8,0xF608,0xF607,0xF5C7,0xF587,
-	0xED27,0xED07,0xECE7,0xECC7,0xECC7,0xECE8,0xF508,0xF54A,
-	0xFDAA,0xFE0A,0xFE29,0xFDE8,0xF588,0xF5A9,0xF60D,0xF630,
-	0xFE31,0xFE31,0xFE0F,0xFDEE,0xFE0D,0xFE2C,0xCD4D,0x09F3,
-	0x0A13,0x0A33,0x0253,0x0252,0x32D1,0xE5AE,0xFE0E,0xFE0D,
-	0xFDEC,0xF630,0xFEF6,0xFF7A,0xFF7B,0x9CF2,0x00E7,0x00E8,
-	0x010A,0x01B0,0x09F4,0x01F6,0x2274,0xE5CA,0xF5E8,0xFDC8,
-	0xFDC9,0xFDE9,0xE5A9,0x32D4,0x0A17,0x01F7,0x01F5,0x09D5,
-	0x01D5,0xBD0D,0xFE0A,0xF609,0xF5E9,0xF5E9,0xFE09,0xFE29,
-	0xFE29,0xFE49,0xBD2D,0x42F2,0x01F4,0x01F3,0x01D1,0x01B0,
-	0x016E,0x014D,0x012D,0x010D,0x010C,0x010B,0x00EA,0x010B,
-	0x012D,0x014E,0x014D,0x7BEF,0xFE92,0xFED2,0xFEF1,0xFED0,
-	0xFE8F,0xFE4E,0xF62D,0xF60C,0xF60C,0xF60B,0xF64C,0xFEAC,
-	0xFF0C,0xFEEC,0xFECC,0xFE6C,0xFE0D,0xFDEC,0xFDAC,0xF56B,
-	0xB9E3,0xB9E3,0xB9E2,0xB9E2,0xBA02,0xBA22,0xBA42,0xB262,
-	0xB262,0xB262,0xB262,0xB262,0xB262,0xB262,0xB242,0xB262,
-	0xB243,0xB242,0xB242,0xB243,0xB243,0xB243,0xB242,0xB242,
-	0xB262,0xB262,0xB262,0xB262,0xB263,0xB262,0xBA83,0xBA82,
-	0xC2A2,0xC2C2,0xCAE2,0xD322,0xD362,0xDBC2,0xE401,0xEC41,
-	0xEC42,0xE402,0xE3E2,0xDBA2,0xDB62,0xD362,0xDB43,0xD343,
-	0xD343,0xD344,0xD364,0xD364,0xD384,0xD384,0xD3A4,0xD3A4,
-	0xD3A3,0xD3A3,0xD3C3,0xD3C3,0xCBC3,0xCB83,0xCB63,0xC323,
-	0xC323,0xC303,0xC303,0xC303,0xC2E3,0xC2E3,0xC2E3,0xC303,
-	0xCB23,0xCB23,0xD344,0xD364,0xDBA5,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC66,0xEC86,0xECC6,0xF4C6,0xF4E6,0xF506,
-	0xF505,0xED25,0xED25,0xED24,0xE523,0xE503,0xDCA3,0xDC63,
-	0xDC43,0xDC23,0xEC42,0xF462,0xF482,0xF483,0xF484,0xF486,
-	0xF4A7,0xECE6,0xED25,0xED65,0xED44,0xECE5,0xE485,0xE485,
-	0xECA6,0xECC6,0xECC7,0xECE7,0xF508,0xF529,0xFD2A,0xF52A,
-	0xF569,0xF5A8,0xF5C7,0xF5A8,0xF588,0xF588,0xF588,0xF588,
-	0xF588,0xF5A8,0xF5A8,0xF5E8,0xF608,0xF607,0xF5C7,0xF587,
-	0xED47,0xED07,0xECE7,0xECC7,0xECC7,0xECE8,0xF508,0xF54A,
-	0xFDAA,0xFE0A,0xFE29,0xFDE8,0xF588,0xF5CA,0xF62E,0xF651,
-	0xFE51,0xFE31,0xFE0F,0xFDEE,0xFE0D,0xFE2C,0xACCE,0x09F3,
-	0x0A13,0x0A33,0x0A53,0x0A32,0xBCEE,0xFE0E,0xFE0E,0xFE0D,
-	0xFE0C,0xF62F,0xFEF6,0xFF7A,0xFF9B,0xFF3A,0x632D,0x00E8,
-	0x010A,0x01B0,0x09F4,0x01F6,0x9C8E,0xFE09,0xF5E9,0xF5C8,
-	0xFDC9,0xFDE9,0xF5E8,0xDD6A,0x0A17,0x01F7,0x01F6,0x01D5,
-	0x01D4,0x8C4F,0xFE0A,0xFDE9,0xF609,0xF5E9,0xFE09,0xFE29,
-	0xFE29,0xFE4A,0xFE4A,0xFE2B,0xDD8C,0x9C8E,0x73B0,0x42CF,
-	0x018E,0x016D,0x014D,0x012D,0x010C,0x21CC,0x3A6D,0x428D,
-	0x428E,0x428E,0x42AE,0x9CB0,0xFE92,0xFED2,0xFEF1,0xFED0,
-	0xFE90,0xFE6E,0xFE2D,0xF60C,0xF60C,0xF62B,0xFE6B,0xF6CB,
-	0xFF0C,0xFEED,0xFECE,0xFE8E,0xFE2F,0xFDEE,0xF5AC,0xF58C,
-	0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA02,0xBA23,0xBA42,0xBA42,
-	0xB262,0xBA82,0xB262,0xB262,0xB262,0xB262,0xB262,0xB262,
-	0xB242,0xB242,0xB242,0xB242,0xB242,0xB243,0xB242,0xB242,
-	0xB262,0xB262,0xB262,0xB262,0xB262,0xB262,0xBA62,0xBA83,
-	0xC2A3,0xC2C2,0xCAE2,0xCB02,0xD342,0xDBA2,0xE3E2,0xEC42,
-	0xEC42,0xEC21,0xE3E2,0xDBA2,0xDB82,0xD362,0xDB43,0xD343,
-	0xD323,0xD344,0xD344,0xD364,0xD384,0xD384,0xDB84,0xD3A4,
-	0xD3A4,0xD3C4,0xD3C4,0xD3C3,0xCBC3,0xCBA3,0xCB83,0xC343,
-	0xC323,0xC303,0xC303,0xC303,0xC2E3,0xC2E3,0xC2E3,0xC2E3,
-	0xCB03,0xCB23,0xD344,0xD364,0xDB85,0xDBC5,0xDBC5,0xE3E5,
-	0xE405,0xEC26,0xEC46,0xEC86,0xECC6,0xECC6,0xF4E6,0xF506,
-	0xED25,0xED25,0xED44,0xED44,0xED23,0xE503,0xDCC3,0xDC83,
-	0xDC44,0xDC23,0xEC43,0xF482,0xF482,0xF483,0xF484,0xEC85,
-	0xF4A6,0xF4C6,0xF506,0xF565,0xED64,0xE505,0xE4A5,0xE4A6,
-	0xECA6,0xECC7,0xECE8,0xF508,0xF509,0xF52A,0xFD2B,0xFD2A,
-	0xFD69,0xFDA8,0xF5C8,0xF5A8,0xF588,0xF588,0xF588,0xF588,
-	0xF588,0xF588,0xF5A8,0xFDE9,0xF608,0xF607,0xF5C8,0xF587,
-	0xED47,0xED07,0xECE7,0xE4C7,0xECC7,0xECE8,0xF508,0xFD4A,
-	0xFDAA,0xFE2A,0xFE29,0xFDE8,0xF588,0xF5CB,0xFE2F,0xF651,
-	0xF652,0xF631,0xFE0F,0xFDED,0xFE0D,0xFE2C,0x83EF,0x09F4,
-	0x0A13,0x0233,0x0A53,0x22B2,0xF5ED,0xF60E,0xFE2E,0xFE0E,
-	0xFE0D,0xFE4F,0xFED6,0xFF7A,0xFF7B,0xFF19,0xAD13,0x00E9,
-	0x010A,0x01AF,0x01F4,0x01F6,0xEDEA,0xF628,0xF5E9,0xF5C8,
-	0xF5C9,0xF5E9,0xF5E8,0xF5E8,0x32D5,0x01F7,0x01D5,0x01B5,
-	0x09D5,0x840F,0xFE0A,0xFE09,0xF5E9,0xF608,0xFE09,0xF609,
-	0xFE28,0xFE4A,0xFE4A,0xFE2B,0xFE2B,0xFE2C,0xFE2E,0x9C8F,
-	0x018E,0x014D,0x014D,0x012D,0x632F,0xFF13,0xFF15,0xFEF4,
-	0xFED2,0xFED2,0xFE92,0xFE93,0xFE92,0xFED2,0xFEF2,0xFED1,
-	0xFE90,0xFE6E,0xFE4D,0xFE0C,0xF60C,0xF62B,0xFE6C,0xFECB,
-	0xFF0C,0xFEED,0xFECE,0xFE8F,0xFE50,0xFE2F,0xFDEE,0xF5AC,
-	0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xBA22,0xBA42,0xBA42,
-	0xBA62,0xBA82,0xBA82,0xB262,0xB262,0xB262,0xB262,0xB262,
-	0xB262,0xB242,0xB242,0xB242,0xB242,0xB242,0xB242,0xB262,
-	0xB262,0xB262,0xB262,0xBA62,0xBA62,0xBA63,0xBA62,0xBA83,
-	0xBAA3,0xC2C2,0xCAE2,0xCB02,0xD342,0xDB82,0xE3E2,0xE421,
-	0xEC61,0xEC42,0xE3E2,0xDBA2,0xDB82,0xDB62,0xDB43,0xD343,
-	0xD343,0xD344,0xD344,0xD364,0xD384,0xDB84,0xDB84,0xDBA4,
-	0xD3A4,0xD3C4,0xD3C4,0xD3E3,0xD3C3,0xCBA3,0xCB83,0xCB63,
-	0xC323,0xC303,0xC303,0xC303,0xC303,0xC303,0xC2E3,0xC303,
-	0xCB03,0xCB23,0xCB43,0xD364,0xDB85,0xDBA5,0xDBC5,0xE3E5,
-	0xE405,0xEC26,0xEC66,0xECA6,0xECC6,0xECC6,0xF4E6,0xF506,
-	0xED25,0xED45,0xED45,0xED44,0xED23,0xE503,0xE4C3,0xDC83,
-	0xDC43,0xDC23,0xEC43,0xF482,0xF482,0xF463,0xF464,0xF465,
-	0xF486,0xF4C6,0xF506,0xED45,0xED64,0xE505,0xE4C5,0xE4A6,
-	0xECC7,0xECE7,0xED08,0xF508,0xF509,0xF50A,0xFD2A,0xFD2A,
-	0xFD49,0xF5A8,0xF5E8,0xF5C8,0xF5A8,0xF588,0xF588,0xF588,
-	0xF588,0xF588,0xF5A9,0xFDE9,0xF608,0xF607,0xF5E8,0xF5A7,
-	0xED47,0xED27,0xECE7,0xE4C7,0xECC7,0xECE8,0xF508,0xFD4A,
-	0xFDAB,0xFE2A,0xFE29,0xF5E9,0xF589,0xF5CB,0xFE4F,0xF672,
-	0xF653,0xF651,0xFE0F,0xFDEE,0xFE0D,0xFE2C,0x7BEF,0x09F3,
-	0x0A13,0x0A53,0x0A53,0x4311,0xF5CD,0xFE0E,0xF62F,0xFE2E,
-	0xFE2E,0xFE50,0xFEF6,0xFF7A,0xFF7A,0xFF38,0xBD73,0x0109,
-	0x0109,0x01AF,0x01F4,0x01F6,0xFE29,0xF609,0xF608,0xF5C8,
-	0xF5C9,0xFDE9,0xF5E8,0xF5E8,0x42F4,0x01F7,0x01D5,0x01D5,
-	0x01D5,0x7BEF,0xFE0A,0xFE09,0xF609,0xF609,0xF609,0xFE29,
-	0xFE29,0xFE4A,0xFE4B,0xFE4B,0xFE2B,0xFE2C,0xFE2E,0x5310,
-	0x018E,0x014D,0x014D,0x012D,0xEE92,0xFF13,0xFF15,0xFEF4,
-	0xFEF2,0xFEB2,0xFEB2,0xFE93,0xFE93,0xFED2,0xFEF2,0xFED1,
-	0xFE90,0xFE6F,0xF64D,0xF60C,0xF62C,0xF64C,0xFE6C,0xFEEC,
-	0xFF0C,0xFEED,0xFECE,0xFE8F,0xFE70,0xFE30,0xFE10,0xFDCE,
-	0xB9C3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xBA23,0xBA42,
-	0xBA62,0xBA62,0xBA82,0xB281,0xB262,0xB262,0xB282,0xB262,
-	0xB262,0xB262,0xB262,0xB262,0xB262,0xB242,0xB263,0xB262,
-	0xB262,0xB262,0xB262,0xBA82,0xBA82,0xBA83,0xBA83,0xBA83,
-	0xBAA3,0xC2C2,0xCAE2,0xCB02,0xD322,0xD361,0xE3C2,0xE422,
-	0xEC41,0xEC41,0xE402,0xE3C2,0xDBA2,0xDB62,0xD362,0xD343,
-	0xD343,0xD344,0xD344,0xD364,0xD384,0xDB84,0xDBA4,0xDBA4,
-	0xD3A4,0xD3C4,0xD3C4,0xD3C3,0xD3E3,0xD3A3,0xCB83,0xCB63,
-	0xCB43,0xC323,0xC303,0xC303,0xC303,0xC2E3,0xC303,0xC303,
-	0xCB03,0xCB23,0xCB43,0xD364,0xDB84,0xDBA5,0xDBC5,0xE3E5,
-	0xE405,0xEC26,0xEC46,0xEC86,0xECC6,0xECE6,0xF4E6,0xED06,
-	0xF526,0xF545,0xF545,0xED44,0xED23,0xE504,0xE4C4,0xDC83,
-	0xDC44,0xDC23,0xEC42,0xEC82,0xF482,0xF463,0xF464,0xEC86,
-	0xEC86,0xF4C6,0xF506,0xF545,0xED65,0xE546,0xE4E6,0xECE7,
-	0xECE8,0xED08,0xED08,0xED09,0xED29,0xF52A,0xFD2A,0xFD2A,
-	0xFD49,0xFDA9,0xF5E8,0xF5E7,0xF5A8,0xF588,0xF588,0xF588,
-	0xF588,0xF588,0xF5A8,0xF5C8,0xF608,0xF627,0xFDE8,0xF5A7,
-	0xED47,0xED28,0xECE7,0xECE7,0xECC7,0xECE8,0xF528,0xFD4A,
-	0xFDAA,0xFE2B,0xFE2A,0xF5C9,0xF589,0xF5EC,0xFE70,0xF693,
-	0xF673,0xFE51,0xFE2F,0xFDEE,0xFE0D,0xFE4C,0x7BEF,0x09F3,
-	0x0A14,0x0A53,0x0253,0x32D1,0xF5ED,0xFE0E,0xFE2F,0xFE4F,
-	0xFE2E,0xF650,0xFEF6,0xFF7A,0xFF7A,0xFF39,0xAD12,0x0109,
-	0x0109,0x01AF,0x01F4,0x01F6,0xDDAB,0xF628,0xF608,0xF5C8,
-	0xF5C8,0xFDE9,0xF5E8,0xF5E8,0x2A95,0x09F7,0x01D5,0x01D5,
-	0x01D4,0x7BEF,0xFE0A,0xFE09,0xF5E9,0xF608,0xF609,0xFE29,
-	0xFE49,0xFE4A,0xFE4A,0xFE4B,0xFE2B,0xFE2B,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x322E,0xFEF2,0xFF13,0xFF15,0xFF14,
-	0xFEF2,0xFEB2,0xFEB2,0xFE93,0xFE93,0xFED2,0xFEF2,0xFED1,
-	0xFE90,0xFE6F,0xFE2E,0xF60C,0xF60C,0xF64C,0xFE8C,0xFEEC,
-	0xFF0C,0xFF0D,0xFECE,0xFE90,0xFE50,0xFE30,0xFE10,0xFDEF,
-	0xB9E2,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xBA23,0xBA42,
-	0xBA42,0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xB282,0xBA62,
-	0xBA62,0xB262,0xB262,0xB262,0xBA62,0xB263,0xB262,0xB262,
-	0xB262,0xB262,0xBA62,0xBA82,0xBA82,0xBA82,0xBA83,0xBA83,
-	0xBAA3,0xC2A2,0xC2C2,0xCB02,0xCB22,0xD362,0xDBA2,0xE421,
-	0xEC41,0xEC62,0xE422,0xE3E2,0xDBA2,0xDB82,0xDB62,0xD343,
-	0xD343,0xD344,0xD364,0xD364,0xD384,0xDBA4,0xDBA4,0xDBA4,
-	0xD3A4,0xD3A4,0xD3C4,0xD3E3,0xD3C3,0xD3C3,0xCBA3,0xCB63,
-	0xCB43,0xC323,0xC303,0xC303,0xC303,0xC303,0xC303,0xC303,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xDBC5,0xE3E5,
-	0xE405,0xEC26,0xEC46,0xEC86,0xECA6,0xECE6,0xF4E6,0xF506,
-	0xF526,0xF545,0xED45,0xED44,0xED44,0xE504,0xE4C3,0xDC83,
-	0xDC43,0xE443,0xEC42,0xEC82,0xF482,0xF463,0xF484,0xF466,
-	0xEC86,0xF4C7,0xF506,0xF546,0xED85,0xED66,0xED27,0xECE8,
-	0xECE8,0xED08,0xED28,0xED29,0xF529,0xF52A,0xFD2A,0xFD2A,
-	0xFD4A,0xFDA9,0xF5E8,0xF5E7,0xF5C8,0xF5A8,0xF588,0xF588,
-	0xF588,0xF588,0xF5A9,0xFDC9,0xF608,0xF608,0xF5E8,0xF5A7,
-	0xED67,0xED28,0xED07,0xE4E7,0xECE7,0xECE8,0xF529,0xFD4A,
-	0xFDAB,0xFE2B,0xFE4A,0xF5C9,0xF589,0xF60C,0xF671,0xF6B3,
-	0xF693,0xFE52,0xFE2F,0xFE0E,0xFE0D,0xFE4C,0x8C2F,0x09F3,
-	0x0A33,0x0A53,0x0253,0x0A32,0xD56E,0xFE0E,0xFE4F,0xFE4F,
-	0xF62E,0xF670,0xFEF6,0xFF7A,0xFF7A,0xFF38,0x634E,0x0109,
-	0x0109,0x01AF,0x01F4,0x01F6,0x7BEF,0xFE08,0xF608,0xF5C8,
-	0xF5C9,0xFDE9,0xF5E8,0xBCEC,0x09F7,0x09F6,0x01D5,0x01D5,
-	0x01D5,0x9C8E,0xFE0A,0xFE09,0xF609,0xFE09,0xF609,0xCD6B,
-	0xBD2C,0xCD6C,0xFE4A,0xFE4B,0xFE2B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x428E,0xFEF2,0xFF13,0xFF15,0xFF14,
-	0xFEF3,0xFEB2,0xFEB2,0xFEB3,0xFE93,0xFEB2,0xFEF2,0xFED1,
-	0xFEB0,0xFE6F,0xFE2D,0xF60C,0xF60C,0xF64C,0xFE8C,0xFEEC,
-	0xFF2D,0xFF0E,0xFECF,0xFE90,0xFE51,0xFE50,0xFE10,0xFE0F,
-	0xB1E3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xBA03,0xBA23,
-	0xBA42,0xBA62,0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBA62,0xB262,0xB262,0xBA63,0xB262,0xB262,0xBA63,
-	0xB262,0xB262,0xBA82,0xBA82,0xBA82,0xBA82,0xBA83,0xBA83,
-	0xBAA3,0xC2A3,0xC2C2,0xCAE2,0xD322,0xD342,0xDB82,0xE401,
-	0xEC42,0xEC62,0xE442,0xE3E1,0xDBC2,0xDB82,0xDB62,0xD343,
-	0xD343,0xD344,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBA4,0xD3A4,0xD3C4,0xD3E4,0xD3C3,0xD3C3,0xCBA3,0xCB63,
-	0xCB43,0xC323,0xC323,0xC303,0xC303,0xC303,0xC303,0xC303,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC86,0xECC6,0xF4C6,0xF4E6,0xF506,
-	0xF526,0xF545,0xED45,0xED44,0xED44,0xE523,0xE4E4,0xDCA3,
-	0xDC63,0xE443,0xEC42,0xF482,0xEC62,0xEC63,0xEC64,0xEC65,
-	0xEC87,0xF4A7,0xF507,0xF547,0xED87,0xED87,0xED47,0xECE8,
-	0xECE8,0xED28,0xED28,0xF529,0xF529,0xF52A,0xFD2A,0xFD2A,
-	0xFD4A,0xFDA9,0xF5E8,0xF5E7,0xF5C7,0xF587,0xF588,0xF588,
-	0xF588,0xF588,0xF5A9,0xFDC9,0xF608,0xF608,0xF608,0xF5A7,
-	0xED67,0xED28,0xED07,0xE4E7,0xECE7,0xED08,0xF529,0xFD4A,
-	0xFDAB,0xFE2B,0xFE4A,0xF5C9,0xF589,0xF60D,0xFE92,0xFEB4,
-	0xF6B3,0xF652,0xFE2F,0xFE0D,0xFE2C,0xFE4C,0xBD0D,0x0A14,
-	0x0A33,0x0A53,0x0A52,0x0A32,0x32D1,0xE5CE,0xFE4F,0xFE50,
-	0xFE2F,0xFE71,0xFED5,0xFF7A,0xFF7A,0x9CD2,0x0109,0x010A,
-	0x010A,0x018F,0x01F4,0x01D6,0x01D6,0xACCD,0xF5E8,0xF5C8,
-	0xF5C9,0xF5E9,0xD56A,0x2A75,0x09F7,0x09F6,0x01D5,0x01D5,
-	0x01D5,0xCD4C,0xFE2A,0xFE09,0xF609,0xF609,0x42F3,0x09D6,
-	0x01D6,0x0195,0x8C4F,0xFE4B,0xFE2B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x428E,0xFEF2,0xFF13,0xFF34,0xFF14,
-	0xFEF3,0xFEB2,0xFE93,0xFEB3,0xFEB3,0xFEB2,0xFEF2,0xFEF1,
-	0xFEB0,0xFE6F,0xF62D,0xF62D,0xF60C,0xF64C,0xFEAC,0xFEEC,
-	0xFF2D,0xFF0E,0xFECF,0xFE90,0xFE71,0xFE30,0xFE10,0xFE0F,
-	0xB1E3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xBA03,0xBA23,
-	0xBA43,0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBA62,0xBA62,0xBA62,0xB262,0xBA62,0xBA82,
-	0xBA63,0xB262,0xBA62,0xBA82,0xBA82,0xBA82,0xBA83,0xBA83,
-	0xBAA3,0xC2A2,0xC2C2,0xCAE2,0xCB02,0xD341,0xDB81,0xE3E2,
-	0xEC42,0xEC62,0xEC42,0xE401,0xE3C2,0xDB82,0xDB62,0xD363,
-	0xD343,0xD344,0xD344,0xD384,0xDB84,0xDB84,0xDBA4,0xDBA4,
-	0xDBA4,0xDBC4,0xD3C4,0xD3E4,0xD3E3,0xD3C3,0xCBC3,0xCB83,
-	0xCB43,0xC343,0xC323,0xC323,0xC303,0xC303,0xC303,0xC303,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC86,0xECA6,0xF4C6,0xF4E6,0xF506,
-	0xF526,0xF545,0xED45,0xED44,0xED44,0xED23,0xE4E3,0xDCA3,
-	0xDC63,0xE443,0xEC62,0xF462,0xEC62,0xEC63,0xEC64,0xEC65,
-	0xEC87,0xF4E8,0xF528,0xF568,0xF5C8,0xEDA7,0xED68,0xED08,
-	0xED08,0xED28,0xF529,0xF529,0xF529,0xF52A,0xFD2A,0xFD4B,
-	0xFD4A,0xFDA9,0xF5E8,0xF608,0xF5E8,0xF5A7,0xF588,0xF588,
-	0xF588,0xF589,0xF5A9,0xFDC9,0xF608,0xF628,0xF608,0xF5A8,
-	0xED67,0xED28,0xED07,0xECE7,0xECE8,0xED08,0xF529,0xFD4A,
-	0xFDAB,0xFE2A,0xFE2A,0xF5C9,0xF58A,0xF60E,0xFE92,0xF6B4,
-	0xFEB4,0xFE72,0xFE2F,0xFE0D,0xFE2C,0xFE4B,0xF62B,0x1253,
-	0x0A53,0x0A53,0x0A53,0x0A32,0x0A12,0x32B1,0xBD2F,0xF650,
-	0xFE4F,0xFE71,0xFEF5,0xEEF9,0x7BEF,0x00C8,0x0129,0x010A,
-	0x012A,0x018F,0x01F4,0x01F6,0x09F6,0x01F7,0x32D4,0x7BEF,
-	0x7BEF,0x5352,0x0A17,0x0A17,0x09F7,0x09F6,0x01D5,0x01D5,
-	0x1214,0xFE2A,0xFE0A,0xFE09,0xF609,0x9C6E,0x09D6,0x01D6,
-	0x01B6,0x0195,0x11F4,0xFE4B,0xFE4B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x428E,0xFEF2,0xFF13,0xFF34,0xFF14,
-	0xFEF3,0xFED2,0xFEB2,0xFEB3,0xFEB3,0xFEB2,0xFEF2,0xFEF1,
-	0xFEB1,0xFE8F,0xFE4E,0xF62D,0xF62C,0xF66C,0xFEAC,0xFF0C,
-	0xFF2D,0xFF0E,0xFECF,0xFE90,0xFE71,0xFE30,0xFE30,0xFE0F,
-	0xB1C2,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xBA03,0xC203,0xBA03,
-	0xBA22,0xBA43,0xBA62,0xBA82,0xBA82,0xBA82,0xBAA2,0xBA82,
-	0xBA82,0xBA82,0xBA82,0xBA82,0xBA62,0xBA62,0xBA82,0xBA82,
-	0xBA82,0xBA82,0xBA82,0xBA83,0xBA83,0xBA83,0xBA83,0xBAA3,
-	0xBAA3,0xBAA2,0xC2C2,0xCAE2,0xCB02,0xD342,0xDB82,0xE3E1,
-	0xEC21,0xEC61,0xEC42,0xE421,0xE3C2,0xDBA2,0xDB82,0xDB63,
-	0xD363,0xD344,0xD344,0xD364,0xD384,0xDB84,0xDBA4,0xDBA4,
-	0xDBA4,0xDBC4,0xD3C4,0xD3E4,0xD3E3,0xD3E3,0xD3C3,0xCBA3,
-	0xCB63,0xCB43,0xC323,0xC323,0xC323,0xC323,0xC303,0xC303,
-	0xCB03,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC86,0xECA6,0xECE6,0xF4E6,0xF506,
-	0xED26,0xF545,0xF545,0xED44,0xED44,0xED24,0xE4E4,0xDCA3,
-	0xDC63,0xE443,0xEC62,0xF462,0xEC62,0xEC63,0xEC64,0xEC66,
-	0xECA7,0xF509,0xF549,0xF589,0xF5C8,0xEDA8,0xED67,0xED28,
-	0xED08,0xED29,0xF529,0xF529,0xF529,0xF52A,0xFD2A,0xFD4A,
-	0xFD6A,0xFDA9,0xFE08,0xF608,0xF5E8,0xF5C8,0xF588,0xF588,
-	0xF588,0xF589,0xF5A9,0xFDC9,0xF608,0xF628,0xF608,0xF5A8,
-	0xED67,0xED48,0xED08,0xECE7,0xECE8,0xED08,0xF529,0xFD6A,
-	0xFDCB,0xFE2B,0xFE2A,0xF5C9,0xF5AA,0xFE2E,0xFEB3,0xFED5,
-	0xF6B4,0xFE72,0xFE2F,0xFE0E,0xFE2C,0xFE4C,0xF62B,0x6391,
-	0x0A54,0x0A53,0x0A53,0x0A52,0x0A12,0x09F1,0x09D0,0x11CF,
-	0x42D0,0x42CF,0x322C,0x0085,0x0084,0x00C7,0x012A,0x090A,
-	0x012A,0x018F,0x01F4,0x01F6,0x01D6,0x01F7,0x0A17,0x0A37,
-	0x0A36,0x0A16,0x0A17,0x0A17,0x09F7,0x09F6,0x01D5,0x01D5,
-	0x6371,0xFE0A,0xFE0A,0xFE09,0xFE09,0x7BEF,0x09D6,0x01D6,
-	0x01B5,0x0195,0x0195,0xFE6B,0xFE4B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x428E,0xFEF2,0xFF13,0xFF34,0xFF14,
-	0xFEF3,0xFED3,0xFEB3,0xFEB3,0xFEB3,0xFEB2,0xFEF2,0xFEF1,
-	0xFEB1,0xFE90,0xFE4E,0xF62D,0xF62C,0xF66C,0xFEAD,0xFF0D,
-	0xFF2D,0xFF0E,0xFECF,0xFEB0,0xFE71,0xFE30,0xFE30,0xF60F,
-	0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xC203,0xC203,0xC203,
-	0xBA23,0xBA43,0xBA62,0xBA82,0xBA82,0xBAA2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA62,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,0xBA83,0xBAA3,
-	0xBAA3,0xBAA2,0xC2C2,0xCAE2,0xCB02,0xD322,0xDB62,0xDBC2,
-	0xEC21,0xEC61,0xEC62,0xE421,0xE3E2,0xE3A2,0xDB82,0xDB63,
-	0xD343,0xD344,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBA4,0xDBC4,0xDBC4,0xD3E4,0xD3E3,0xD3E3,0xD3C3,0xCBA3,
-	0xCB63,0xC343,0xC323,0xC323,0xC323,0xC323,0xC323,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC86,0xECC6,0xF4C6,0xF4E6,0xF526,
-	0xF525,0xED45,0xF565,0xED44,0xED44,0xE524,0xE4E4,0xDCC3,
-	0xDC63,0xE443,0xEC62,0xEC62,0xEC62,0xEC63,0xEC65,0xEC87,
-	0xF4E9,0xF52A,0xF54A,0xF569,0xF5A8,0xEDC8,0xED88,0xED28,
-	0xED09,0xED29,0xF529,0xF549,0xF529,0xF52A,0xF54A,0xFD4B,
-	0xFD6B,0xFDAA,0xF609,0xF608,0xF5E8,0xF5C8,0xF5A8,0xF588,
-	0xF589,0xF589,0xF5A9,0xF5C9,0xFE08,0xF628,0xF628,0xF5C7,
-	0xED67,0xED48,0xED08,0xECE8,0xED08,0xED08,0xF529,0xFD6A,
-	0xFDCB,0xFE2B,0xFE2A,0xFDC9,0xF5AB,0xFE4F,0xFEB4,0xFED5,
-	0xFED4,0xFE72,0xFE4E,0xFE0D,0xFE2C,0xF64B,0xF62B,0xD56D,
-	0x0A53,0x0A53,0x0A53,0x0A32,0x0A12,0x09D1,0x01AF,0x018F,
-	0x01AF,0x098E,0x0109,0x0085,0x0084,0x00E7,0x012A,0x012A,
-	0x012A,0x8C50,0x01F4,0x01F6,0x09D7,0x01F7,0x0A17,0x0A37,
-	0x0236,0x0A16,0x0A17,0x0A17,0x01F7,0x01D6,0x01D5,0x01D5,
-	0xDDAB,0xFE2A,0xFE0A,0xF609,0xF609,0x7BEF,0x09F6,0x01D6,
-	0x01B5,0x0195,0x0175,0xFE6B,0xFE4B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x016D,0x428E,0xFEF2,0xFF13,0xFF34,0xFF34,
-	0xFEF3,0xFED3,0xFE93,0xFEB3,0xFEB3,0xFEB2,0xFEF2,0xFED2,
-	0xFEB1,0xFE90,0xFE4E,0xF64D,0xF62D,0xFE6C,0xFECC,0xFF0C,
-	0xFF2E,0xFF0F,0xFED0,0xFEB1,0xFE71,0xFE50,0xFE30,0xFE0F,
-	0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xC203,0xC203,0xC203,
-	0xC223,0xC243,0xC262,0xC262,0xBA82,0xBAA2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA2,0xBA82,0xBA82,0xBA82,0xBA82,0xBA82,
-	0xBA82,0xBA83,0xBA82,0xBAA2,0xBA82,0xBA83,0xBAA3,0xBAA3,
-	0xBA83,0xBAA2,0xC2C2,0xC2E2,0xCB02,0xD322,0xDB62,0xDBC2,
-	0xE421,0xEC41,0xEC62,0xEC41,0xE3E2,0xE3A2,0xDB82,0xDB63,
-	0xD363,0xD344,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xD3E4,0xD3E4,0xD3E3,0xD3E3,0xCBC3,
-	0xCB83,0xCB63,0xC323,0xCB23,0xCB23,0xC323,0xC323,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xE3C5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xECA6,0xF4C6,0xF4E6,0xF526,
-	0xF525,0xF545,0xF565,0xED65,0xED64,0xE524,0xE504,0xDCC3,
-	0xE483,0xE463,0xEC62,0xEC82,0xEC82,0xEC84,0xEC86,0xECC8,
-	0xF50A,0xF52A,0xF54A,0xF589,0xF5C9,0xEDC8,0xEDA8,0xED49,
-	0xED29,0xF529,0xF549,0xF54A,0xF529,0xF52A,0xF54A,0xFD4B,
-	0xFD6B,0xFDAA,0xF609,0xF608,0xF608,0xF5C8,0xF5A8,0xF588,
-	0xF589,0xF589,0xFDA9,0xFDC9,0xFE09,0xF628,0xF628,0xF5C8,
-	0xED87,0xED48,0xED28,0xED08,0xED08,0xED08,0xF549,0xFD6A,
-	0xFDCB,0xFE4B,0xFE2A,0xFDC9,0xF5CB,0xFE50,0xFED4,0xFEF6,
-	0xFED5,0xFE72,0xFE2E,0xFE2D,0xFE2C,0xFE4B,0xF62B,0xF5EC,
-	0x73D0,0x0A53,0x0A53,0x0232,0x0212,0x01D1,0x01AF,0x016E,
-	0x018E,0x016E,0x0109,0x0084,0x0084,0x00E8,0x012A,0x012A,
-	0x428D,0xF66F,0x73D0,0x01F5,0x01D6,0x01F7,0x0A17,0x0A37,
-	0x0236,0x0A36,0x0A17,0x0A17,0x09F7,0x01D6,0x01D5,0x8C4F,
-	0xFE2B,0xFE2A,0xFE0A,0xF609,0xF609,0xACCD,0x09F6,0x01D6,
-	0x01B5,0x0195,0x11D4,0xFE6A,0xFE4B,0xFE2C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x016E,0x014E,0xEE91,0xFF12,0xFF34,0xFF34,
-	0xFEF3,0xFED3,0xFE93,0xFEB4,0xFEB3,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB1,0xFE90,0xFE4E,0xF64D,0xF64D,0xFE6C,0xFECD,0xFF0D,
-	0xFF2E,0xFF0F,0xFEF0,0xFEB1,0xFE71,0xFE50,0xFE30,0xFE30,
-	0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xC203,0xC203,
-	0xC223,0xBA43,0xC263,0xC262,0xC282,0xBAA2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBA82,0xBA83,0xBA83,0xBA83,
-	0xBA83,0xBA83,0xBA82,0xBA82,0xBA83,0xBA83,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA2,0xC2C2,0xC2C2,0xCAE2,0xD302,0xDB42,0xDBA2,
-	0xE421,0xEC41,0xEC62,0xEC41,0xE402,0xE3A2,0xDB82,0xDB83,
-	0xD363,0xD343,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xD3E3,0xD403,0xD3E3,0xD3E3,0xD3C3,
-	0xCB83,0xCB63,0xCB43,0xCB23,0xCB23,0xC323,0xC323,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xE3E5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xECA6,0xF4C6,0xF4E6,0xF526,
-	0xF525,0xF545,0xF565,0xED64,0xED64,0xE524,0xE504,0xDCC3,
-	0xE483,0xE463,0xEC63,0xEC82,0xEC84,0xECA6,0xECC8,0xECE9,
-	0xED0A,0xF52A,0xF549,0xF58A,0xF5C9,0xF5E8,0xEDA8,0xED69,
-	0xED29,0xF549,0xF569,0xF549,0xF54A,0xF54A,0xF54B,0xFD6B,
-	0xFD6B,0xFDAA,0xF609,0xF628,0xF608,0xF5E8,0xF5A8,0xF588,
-	0xF589,0xF589,0xFDA9,0xFDC9,0xFE09,0xF628,0xF608,0xF5E7,
-	0xED88,0xF548,0xED28,0xED08,0xED08,0xED08,0xF549,0xFD6A,
-	0xFDEB,0xFE4B,0xFE4A,0xF5C9,0xF5CC,0xFE71,0xFED5,0xFEF6,
-	0xFED5,0xFE72,0xFE2E,0xFE2D,0xFE2C,0xFE4B,0xF60B,0xF5CB,
-	0xF5AC,0x4331,0x0A53,0x0A32,0x0212,0x01D1,0x01AF,0x016E,
-	0x016E,0x016D,0x0109,0x0084,0x0084,0x00E8,0x012A,0x118B,
-	0xCDB3,0xFE90,0xFE0B,0x32B3,0x09D6,0x01F7,0x0A17,0x0A37,
-	0x0236,0x0A16,0x0A17,0x09F7,0x01F7,0x01D6,0x73D1,0xFE2A,
-	0xFE2A,0xFE2A,0xFE0A,0xF609,0xFE09,0xF609,0x6371,0x01D6,
-	0x01B6,0x0195,0x8C4F,0xFE6B,0xFE4B,0xFE4C,0xFE2D,0x42D0,
-	0x018E,0x016D,0x014D,0x012D,0x52EE,0xAD31,0xBD92,0xBD92,
-	0xBD91,0xBD71,0xC551,0xDE13,0xFE93,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB1,0xFE90,0xFE4E,0xF64D,0xF64D,0xFE6C,0xFECD,0xFF0D,
-	0xFF2E,0xFF0F,0xFEF0,0xFEB1,0xFE71,0xFE51,0xFE30,0xFE30,
-	0xA9C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xC1E3,0xC203,
-	0xC203,0xC223,0xC243,0xC262,0xC282,0xC2A2,0xBAA2,0xBAA2,
-	0xBAC2,0xBAC2,0xBAC2,0xBAA2,0xBAA2,0xBA82,0xBA82,0xBA83,
-	0xBA83,0xBA83,0xBA83,0xBAA2,0xBAA2,0xBAA3,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA2,0xC2C2,0xC2C2,0xCAE2,0xCB02,0xD342,0xDB81,
-	0xE402,0xEC41,0xEC62,0xEC42,0xE421,0xE3C2,0xDBA2,0xDB82,
-	0xDB63,0xD343,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xD3E3,0xD3E3,0xD3E3,0xD3E3,
-	0xCB83,0xCB63,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBA5,0xE3E5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xECA6,0xF4C6,0xF506,0xF526,
-	0xF546,0xF565,0xF545,0xED65,0xED44,0xED44,0xE504,0xDCC3,
-	0xE483,0xE483,0xEC63,0xF4A3,0xF4C6,0xF4E8,0xECC9,0xECE9,
-	0xED0A,0xF52A,0xF54A,0xF58A,0xF5C9,0xF5E8,0xEDC8,0xED69,
-	0xED49,0xF549,0xF56A,0xF56A,0xF54A,0xF54A,0xFD6B,0xFD6B,
-	0xFD8B,0xFDAA,0xFE09,0xFE28,0xF608,0xF5E8,0xF5A8,0xF5A8,
-	0xF589,0xF589,0xFDA9,0xFDC9,0xFE09,0xFE29,0xF628,0xF5E8,
-	0xF588,0xED48,0xED28,0xED08,0xED08,0xF528,0xF549,0xFD6A,
-	0xFDEB,0xFE4B,0xFE2A,0xFDC9,0xFDCC,0xFE92,0xFEF5,0xFEF6,
-	0xFED5,0xFE92,0xFE2E,0xFE2D,0xFE2C,0xF62B,0xF60B,0xF5CC,
-	0xF5AC,0xE56D,0x6390,0x0A32,0x0A12,0x01D1,0x01AF,0x016E,
-	0x016E,0x016D,0x0109,0x0084,0x0084,0x00E8,0x118B,0xCDB3,
-	0xFED5,0xFE8F,0xFE2C,0xF60A,0x73D0,0x01F7,0x0A17,0x0A37,
-	0x0236,0x0A16,0x09F7,0x09F7,0x2275,0xACCD,0xFE2A,0xF64A,
-	0xFE2A,0xFE2A,0xFE2A,0xF60A,0xF609,0xFE29,0xF629,0xCD4B,
-	0xBD2D,0xCD8C,0xFE8A,0xFE6B,0xFE4C,0xFE4C,0xFE4E,0x840F,
-	0x018E,0x016D,0x016E,0x014E,0x010D,0x00ED,0x00CB,0x00CB,
-	0x00EB,0x012C,0x014C,0x7BEF,0xFEB3,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB1,0xF690,0xFE4F,0xF64E,0xF64D,0xF68C,0xFECD,0xFF2D,
-	0xFF2E,0xFF10,0xFEF1,0xFEB1,0xFE71,0xFE71,0xFE50,0xFE30,
-	0xA9C2,0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xB9E3,0xC1E3,
-	0xC203,0xC223,0xC243,0xC243,0xC262,0xC282,0xC2A2,0xC2A2,
-	0xC2C2,0xC2C2,0xBAC2,0xBAA2,0xBA82,0xBAA2,0xBA82,0xBA83,
-	0xBA83,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA3,0xBAC2,0xC2C2,0xCAE2,0xCB02,0xD342,0xDB82,
-	0xE3E2,0xEC41,0xEC61,0xEC61,0xEC21,0xE3E2,0xE3A2,0xDB82,
-	0xDB63,0xDB44,0xD344,0xDB64,0xDB84,0xDBA4,0xDBA4,0xDBA4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xD3E4,0xD3E4,0xD3E3,0xD3E3,
-	0xD3A3,0xCB83,0xCB43,0xCB23,0xCB23,0xCB23,0xCB23,0xCB23,
-	0xCB23,0xCB23,0xCB43,0xD364,0xD384,0xDBC4,0xE3E5,0xE3E5,
-	0xE405,0xEC25,0xEC26,0xEC66,0xEC87,0xF4C6,0xF506,0xF526,
-	0xF545,0xF545,0xF565,0xED64,0xED64,0xED44,0xE504,0xE4C3,
-	0xE483,0xE483,0xECA4,0xF4E6,0xECE7,0xECC8,0xECE9,0xECEA,
-	0xED0A,0xF52A,0xF54A,0xF56A,0xF5C9,0xF5E9,0xF5E9,0xED89,
-	0xED49,0xF54A,0xF56A,0xF56A,0xF56A,0xF56A,0xF56B,0xFD8B,
-	0xFD8B,0xFDCA,0xFE0A,0xF628,0xF628,0xF5E8,0xF5C8,0xF588,
-	0xF589,0xF589,0xF5A9,0xF5C9,0xFE09,0xF629,0xF628,0xF5E8,
-	0xF5A8,0xED68,0xED28,0xED08,0xED08,0xED29,0xF549,0xFD8A,
-	0xFDEB,0xFE4B,0xFE2A,0xF5C9,0xF5ED,0xFE92,0xFEF6,0xFEF7,
-	0xFEF5,0xFE92,0xFE4F,0xFE2D,0xF62C,0xF62B,0xF60B,0xF5CC,
-	0xF5AC,0xF5AC,0xF5AC,0xACAE,0x2271,0x09D2,0x01AF,0x016D,
-	0x016D,0x096D,0x0109,0x0085,0x0084,0x426B,0xDE13,0xFEB4,
-	0xFEB5,0xFE90,0xFE0B,0xFE09,0xF609,0xDD8A,0x8C2E,0x5352,
-	0x4313,0x4313,0x73D1,0xACCD,0xF608,0xF609,0xF62A,0xFE2A,
-	0xFE2B,0xFE2A,0xFE2A,0xF609,0xF60A,0xF629,0xFE29,0xFE29,
-	0xFE4A,0xFE6A,0xFE6A,0xFE6B,0xFE6C,0xFE6D,0xFE4E,0xDDCF,
-	0x11CE,0x018D,0x016D,0x014E,0x012D,0x00ED,0x00CB,0x00CB,
-	0x00EB,0x012C,0x014C,0x7BEF,0xFEB4,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB2,0xFE90,0xF66F,0xF64E,0xF64D,0xF68D,0xFECD,0xFF2D,
-	0xFF2E,0xFF30,0xFEF1,0xFED1,0xFE91,0xFE51,0xFE50,0xFE30,
-	0xA9C2,0xA9C2,0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xC203,0xC1E3,
-	0xC203,0xC203,0xBA23,0xC243,0xC262,0xC282,0xC2A2,0xC2A2,
-	0xC2C2,0xC2E2,0xC2C2,0xC2C2,0xBAA2,0xBAA2,0xBAA2,0xBAA2,
-	0xBA83,0xBAA2,0xBAA3,0xBAA3,0xBAA2,0xBAA2,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA3,0xBAC2,0xC2C3,0xCAE3,0xCB02,0xD322,0xDB62,
-	0xE3C2,0xE421,0xEC61,0xEC62,0xEC41,0xE3E2,0xE3A2,0xDB82,
-	0xDB63,0xDB43,0xD344,0xD364,0xDB84,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xD3E4,0xDBE4,0xD3E3,0xD3E3,
-	0xD3C3,0xCBA3,0xCB63,0xCB43,0xCB43,0xCB43,0xCB43,0xCB23,
-	0xCB23,0xCB44,0xCB43,0xD364,0xD384,0xDBA5,0xE3C5,0xE3E5,
-	0xE405,0xEC26,0xEC26,0xEC66,0xECA7,0xF4C6,0xF506,0xF526,
-	0xF545,0xF565,0xF565,0xF565,0xED64,0xE544,0xE504,0xE4E3,
-	0xECA3,0xE4C5,0xED07,0xF507,0xECE7,0xECE8,0xECE9,0xECEA,
-	0xED0A,0xF52A,0xF54A,0xFD8A,0xF5CA,0xF5E9,0xF5E9,0xF5A9,
-	0xED69,0xED6A,0xF58A,0xF58B,0xF56A,0xF56B,0xF56B,0xFD8B,
-	0xFDAB,0xFDCB,0xFE0A,0xFE49,0xF628,0xF608,0xF5C8,0xF5A9,
-	0xF589,0xF589,0xF589,0xFDCA,0xFE09,0xFE29,0xF628,0xF608,
-	0xF5A8,0xED68,0xED48,0xED28,0xED08,0xED29,0xF569,0xFD8A,
-	0xFDEB,0xFE4B,0xFE4A,0xF5CA,0xF5ED,0xFEB3,0xFF17,0xFF17,
-	0xFEF5,0xFE92,0xFE4F,0xFE2D,0xFE2C,0xF62B,0xF5EB,0xF5CC,
-	0xF5AC,0xF5AC,0xF5AC,0xFDCD,0xFE0D,0xCD4E,0x83EF,0x52EF,
-	0x42AE,0x42AE,0x52CD,0x8C71,0xDE98,0xFF18,0xFED5,0xFED4,
-	0xFEB4,0xFE8F,0xFE0B,0xFE09,0xFE29,0xFE08,0xFDE8,0xF5C8,
-	0xF5C9,0xF5E9,0xF5E8,0xF608,0xFE08,0xF609,0xFE2A,0xFE2A,
-	0xFE2B,0xFE2A,0xFE2A,0xF609,0xF609,0xFE29,0xFE29,0xFE29,
-	0xFE4A,0xFE6A,0xFE8B,0xFE6B,0xFE6C,0xFE4C,0xFE4E,0xFE6F,
-	0xACF0,0x016D,0x016D,0x014E,0x012D,0x00ED,0x00CB,0x00CB,
-	0x00EB,0x012C,0x012C,0x7BEF,0xFEB4,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB2,0xFE90,0xF66F,0xF64E,0xF64D,0xF6AD,0xFEED,0xFF2E,
-	0xFF4F,0xFF30,0xFEF1,0xFED1,0xFE91,0xFE51,0xFE50,0xFE30,
-	0xA1A2,0xA9C2,0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xC1E3,
-	0xC203,0xC203,0xBA23,0xC243,0xC262,0xC282,0xC2A2,0xC2C2,
-	0xC2C2,0xC2E2,0xC2E2,0xC2C3,0xC2C2,0xBAC2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA3,0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAA3,
-	0xBAA3,0xBAA3,0xBAC2,0xC2C3,0xCAE2,0xCB02,0xD322,0xD362,
-	0xDBC1,0xE421,0xEC61,0xEC61,0xEC41,0xE402,0xE3C2,0xDB82,
-	0xDB63,0xDB63,0xD344,0xD364,0xD384,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDC04,0xD403,0xD3E3,
-	0xD3C3,0xCBA3,0xCB63,0xCB43,0xCB43,0xCB43,0xCB43,0xCB23,
-	0xCB23,0xCB43,0xCB43,0xD364,0xD384,0xDBA4,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC26,0xEC66,0xEC86,0xF4C6,0xF506,0xF526,
-	0xF545,0xF565,0xF565,0xF565,0xED64,0xED44,0xE504,0xE4E4,
-	0xE4E6,0xED07,0xF507,0xECE7,0xECE7,0xECE8,0xECE9,0xED0A,
-	0xED0A,0xF52A,0xF54B,0xFD8B,0xF5CA,0xF5E9,0xF609,0xF5CA,
-	0xF58A,0xF56A,0xF58B,0xF58B,0xF58B,0xF56B,0xF56B,0xFDAB,
-	0xFDAC,0xFDCB,0xFE0A,0xF649,0xF648,0xF608,0xF5C8,0xF5A9,
-	0xF589,0xF589,0xF5AA,0xF5CA,0xFDEA,0xFE29,0xFE28,0xF608,
-	0xF5A8,0xF568,0xED48,0xED28,0xED28,0xED29,0xF569,0xFD8A,
-	0xFDEB,0xFE6B,0xFE4A,0xF5CA,0xFE0E,0xFEB4,0xFF17,0xFF37,
-	0xFF15,0xFEB2,0xFE4E,0xFE2D,0xFE2C,0xFE2B,0xF5EB,0xF5AB,
-	0xF58C,0xF5AC,0xF5AC,0xFDED,0xFE0D,0xFE2D,0xFE50,0xFEB2,
-	0xFED2,0xF6B3,0xFEF7,0xFF9B,0xFF9C,0xFF38,0xFED5,0xFED4,
-	0xFEB4,0xFE6F,0xFE0B,0xFE09,0xFE29,0xFE08,0xFDE8,0xF5C8,
-	0xF5C9,0xF5E9,0xF5E8,0xF608,0xF608,0xF628,0xFE2A,0xFE4A,
-	0xFE4B,0xFE2A,0xFE2A,0xFE09,0xF609,0xFE29,0xFE29,0xF629,
-	0xFE4A,0xF66A,0xFE8A,0xFE6B,0xFE6C,0xFE4C,0xFE4E,0xFE6F,
-	0xFE91,0xCD91,0x222E,0x094E,0x012D,0x010D,0x00CC,0x00AB,
-	0x00EB,0x012B,0x094C,0x8410,0xFEB4,0xFEB3,0xFEF2,0xFEF2,
-	0xFEB2,0xFE90,0xF66F,0xF64E,0xF66D,0xF6AD,0xFF0D,0xFF2E,
-	0xFF4F,0xFF30,0xFEF1,0xFED1,0xFE91,0xFE71,0xFE50,0xFE30,
-	0xA1A2,0xA9A2,0xB1C2,0xB1C3,0xB9E3,0xB9E3,0xB9E3,0xC203,
-	0xC203,0xC203,0xC203,0xC223,0xC242,0xC262,0xC2A2,0xC2C2,
-	0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xBAA2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAA2,0xBAA2,0xBAC3,0xBAC3,
-	0xBAC3,0xBAA3,0xBAC2,0xC2C3,0xC2E3,0xCAE2,0xD322,0xD362,
-	0xDBA2,0xE402,0xEC42,0xEC61,0xEC41,0xE402,0xE3C2,0xDBA2,
-	0xDB63,0xDB43,0xD364,0xD364,0xD384,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xDC04,0xD403,
-	0xD3E3,0xD3A3,0xCB83,0xCB63,0xCB43,0xCB43,0xCB43,0xCB23,
-	0xCB43,0xCB44,0xCB44,0xD364,0xD384,0xDBA4,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xF486,0xF4C6,0xF506,0xF526,
-	0xF545,0xF545,0xF565,0xED64,0xED84,0xED44,0xE525,0xED46,
-	0xED48,0xED27,0xF507,0xF507,0xECE7,0xECE8,0xECE9,0xED0A,
-	0xED2A,0xF54A,0xF56B,0xF58B,0xF5CA,0xF60A,0xF609,0xF5C9,
-	0xF5AA,0xF58A,0xF58B,0xF58B,0xF58B,0xF58B,0xF58B,0xFDAC,
-	0xFDAC,0xFDCB,0xFE0A,0xFE49,0xF649,0xF609,0xF5C8,0xF5A9,
-	0xF5A9,0xF5A9,0xF5AA,0xFDCA,0xFDEA,0xFE29,0xF628,0xF608,
-	0xF5A8,0xF568,0xED48,0xED28,0xED28,0xED29,0xF569,0xFD8B,
-	0xFDEB,0xFE6B,0xFE4A,0xF5CA,0xF60F,0xFED4,0xFF38,0xFF38,
-	0xFF16,0xFEB2,0xFE4E,0xFE2C,0xF64C,0xF60B,0xF5EB,0xF5AB,
-	0xF58C,0xF5AC,0xF5AC,0xFDED,0xFE0D,0xFE2D,0xFE50,0xFEB2,
-	0xFEB3,0xF6B3,0xFF17,0xFF9C,0xFF9C,0xFF39,0xFEF5,0xF6B4,
-	0xFEB4,0xFE6F,0xFE0B,0xFE29,0xFE29,0xFE08,0xFDE8,0xF5C8,
-	0xF5C9,0xF5E9,0xF5E8,0xFE08,0xF608,0xF628,0xF62A,0xFE4A,
-	0xFE2B,0xFE2A,0xFE2A,0xFE09,0xF609,0xFE29,0xFE29,0xFE29,
-	0xFE4A,0xFE6A,0xFE8B,0xFE8B,0xFE6C,0xFE4C,0xFE4E,0xFE6F,
-	0xFE91,0xFE91,0xFE91,0xBD50,0x7BEF,0x7BEF,0x7BEF,0x7BEF,
-	0x7BEF,0x7BEF,0x7BEF,0xBD51,0xFEB4,0xFEB3,0xFEF2,0xFEF3,
-	0xFEB2,0xFE91,0xF66F,0xFE4E,0xF66D,0xFEAD,0xFF0D,0xFF4E,
-	0xFF50,0xFF31,0xFEF2,0xFED2,0xFE91,0xFE71,0xFE51,0xFE30,
-	0xA1A2,0xA1A2,0xA9A2,0xB1C2,0xB1E3,0xB9E3,0xB9E3,0xC1E3,
-	0xC1E3,0xC203,0xC203,0xC223,0xC243,0xC263,0xC2A2,0xC2C2,
-	0xC2C2,0xC2E2,0xC2E2,0xC2E2,0xC2C2,0xC2C2,0xC2C2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAC3,0xBAC3,0xC2C3,
-	0xBAC3,0xBAC3,0xBAC3,0xC2C3,0xC2E3,0xCB02,0xD322,0xD362,
-	0xDBA2,0xE402,0xEC42,0xEC62,0xEC41,0xEC01,0xE3E2,0xE3A2,
-	0xDB83,0xDB63,0xD364,0xD364,0xD384,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xE3E4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xDC04,0xD403,
-	0xD3E3,0xD3C3,0xCB83,0xCB63,0xCB43,0xCB43,0xCB43,0xCB43,
-	0xCB43,0xCB44,0xD344,0xD344,0xD364,0xDBA4,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xF486,0xF4C6,0xF506,0xF526,
-	0xED45,0xF565,0xF565,0xED65,0xED84,0xED85,0xED87,0xED48,
-	0xED48,0xED27,0xED27,0xED08,0xED08,0xECE9,0xECE9,0xED0A,
-	0xED2A,0xF52B,0xF56B,0xF58B,0xF5CA,0xF60A,0xF629,0xF60A,
-	0xF5AA,0xF58B,0xF58B,0xFDAB,0xF5AB,0xF58B,0xF58B,0xFDAC,
-	0xFDAC,0xFDCC,0xFE0A,0xFE4A,0xF649,0xF629,0xF5E9,0xF5C9,
-	0xF5A9,0xF5AA,0xF5AA,0xF5CA,0xFE0A,0xFE29,0xFE49,0xF608,
-	0xF5C8,0xF588,0xED48,0xED28,0xED28,0xF549,0xF56A,0xFDAB,
-	0xFDEB,0xFE6B,0xFE4A,0xF5CB,0xFE0F,0xFED5,0xFF38,0xFF58,
-	0xFF16,0xFEB2,0xFE4E,0xFE4C,0xF64C,0xF60B,0xF5CB,0xF5AC,
-	0xF58C,0xF5AC,0xF5CC,0xF5ED,0xFE0D,0xFE2E,0xFE6F,0xFEB2,
-	0xFED3,0xF6D4,0xFF17,0xFF9C,0xFF9C,0xFF39,0xFED5,0xFEB4,
-	0xFEB3,0xFE6F,0xFE2B,0xFE2A,0xFE08,0xFE08,0xF5E8,0xF5C8,
-	0xF5C8,0xFDE9,0xF5E8,0xF608,0xF628,0xF629,0xFE2A,0xFE2A,
-	0xFE2B,0xFE2A,0xFE2A,0xFE2A,0xF609,0xF60A,0xFE2A,0xFE29,
-	0xFE4A,0xFE6A,0xFE8B,0xFE8B,0xFE8C,0xFE6D,0xFE6E,0xFE6F,
-	0xFE91,0xFE71,0xFE91,0xF691,0xFED2,0xFF12,0xFF33,0xFF54,
-	0xFF14,0xFEF4,0xFEB3,0xFEB4,0xFEB4,0xFEB3,0xFED3,0xFEF2,
-	0xFEB2,0xFE90,0xF66F,0xFE6E,0xF66D,0xFEAD,0xFF0E,0xFF2F,
-	0xFF50,0xFF31,0xFEF2,0xFED2,0xFE91,0xFE71,0xFE51,0xFE50,
-	0x99A2,0xA1A2,0xA9A2,0xB1C2,0xB1E2,0xB9E3,0xB9E3,0xC1E3,
-	0xC1E3,0xC1E3,0xC203,0xC223,0xC243,0xC263,0xC282,0xC2A2,
-	0xC2C2,0xC2E2,0xC2E2,0xC2E2,0xC2E2,0xC2E3,0xC2C2,0xBAA2,
-	0xBAA2,0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xBAC3,0xC2C3,
-	0xBAC3,0xBAC3,0xBAC2,0xC2C3,0xC2E3,0xCAE2,0xD322,0xD342,
-	0xDB82,0xE402,0xEC42,0xEC61,0xEC61,0xEC22,0xE3E2,0xE3A2,
-	0xDB83,0xDB63,0xD344,0xD344,0xDB84,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xDC04,0xD403,
-	0xD3E3,0xD3C3,0xCB83,0xCB63,0xCB43,0xCB43,0xCB43,0xCB43,
-	0xCB43,0xCB44,0xD344,0xD344,0xD364,0xDBA4,0xDBC5,0xE3E5,
-	0xE406,0xEC26,0xEC46,0xEC66,0xF486,0xF4C6,0xF506,0xF526,
-	0xF565,0xF565,0xF565,0xF585,0xED86,0xEDC8,0xEDA9,0xED69,
-	0xED48,0xED28,0xF527,0xED08,0xED08,0xED09,0xECEA,0xED0A,
-	0xED2B,0xF54B,0xF56C,0xF58C,0xF5CB,0xF60B,0xF62A,0xF60A,
-	0xF5CB,0xF5AB,0xF5AB,0xFDAB,0xFDAB,0xF5AB,0xF5AB,0xFDAC,
-	0xFDCC,0xFDEC,0xFE2B,0xFE6A,0xFE69,0xF629,0xF5E9,0xF5C9,
-	0xF5AA,0xF5AA,0xF5AA,0xFDCA,0xFE0A,0xFE2A,0xFE49,0xF629,
-	0xF5E9,0xF588,0xED69,0xED48,0xED29,0xF549,0xF56A,0xF5AB,
-	0xFE0B,0xFE6B,0xFE4A,0xFDEB,0xFE30,0xFEF5,0xFF38,0xFF38,
-	0xFF16,0xFEB2,0xFE6E,0xFE4C,0xF64B,0xF60B,0xF5CB,0xF5AC,
-	0xF58C,0xF5AC,0xF5CC,0xF5ED,0xFE0D,0xF62D,0xFE70,0xFEB2,
-	0xFED3,0xFED4,0xFF17,0xFF9B,0xFF9C,0xFF59,0xFED5,0xFED4,
-	0xFEB4,0xFE6F,0xFE2B,0xFE2A,0xFE08,0xFE08,0xF5E8,0xF5C8,
-	0xF5C9,0xF5E9,0xF5E9,0xF609,0xFE09,0xFE29,0xFE2A,0xFE2B,
-	0xFE2B,0xFE2A,0xFE2A,0xFE2A,0xF609,0xF60A,0xFE2A,0xFE29,
-	0xFE4A,0xFE6A,0xFE8B,0xFE8B,0xFE6C,0xFE6D,0xFE6E,0xFE6F,
-	0xFE91,0xFE71,0xFE91,0xFE91,0xFED2,0xFF11,0xFF33,0xFF54,
-	0xFF34,0xFEF4,0xFEB3,0xFEB4,0xFED4,0xFEB3,0xFED3,0xFEF2,
-	0xFED2,0xFE90,0xFE6F,0xF66E,0xF66E,0xFECE,0xFF0E,0xFF4F,
-	0xFF50,0xFF31,0xFEF2,0xFEB2,0xFE92,0xFE71,0xFE51,0xFE50,
-	0x99A2,0xA1A1,0xA9C2,0xA9C2,0xB1E2,0xB9E3,0xB9E3,0xB9E3,
-	0xC1E3,0xC1E3,0xC203,0xC203,0xC223,0xC243,0xC282,0xC2A2,
-	0xC2C2,0xC2C2,0xC2E2,0xC2E2,0xC2E2,0xC2E3,0xC2C2,0xBAA2,
-	0xC2A2,0xBAA2,0xBAA2,0xBAA2,0xBAA3,0xBAC3,0xC2C3,0xC2C4,
-	0xBAC3,0xC2C3,0xC2C3,0xC2C3,0xC2C3,0xCAE2,0xCB22,0xD342,
-	0xDB82,0xE3E2,0xEC42,0xEC62,0xEC61,0xEC22,0xE3E2,0xE3C2,
-	0xDB83,0xDB63,0xD344,0xD344,0xDB84,0xDBA4,0xDBA4,0xDBC4,
-	0xDBC4,0xDBE4,0xDBE4,0xDBE4,0xDBE4,0xDC04,0xDC04,0xD403,
-	0xD3E3,0xD3C3,0xCBA3,0xCB84,0xCB44,0xCB43,0xCB43,0xCB43,
-	0xCB43,0xCB44,0xD344,0xD344,0xD364,0xDBA4,0xDBC5,0xE405,
-	0xE406,0xEC26,0xEC46,0xEC66,0xF487,0xF4C6,0xF506,0xF546,
-	0xF565,0xF565,0xED85,0xF5A6,0xF5C9,0xEDC9,0xEDA8,0xED68,
-	0xED48,0xED48,0xED28,0xED28,0xED08,0xED09,0xED0A,0xED0A,
-	0xED2B,0xED4B,0xF56C,0xFD8C,0xF5CB,0xF60B,0xF62A,0xF62B,
-	0xF5EB,0xF5AB,0xF5AB,0xFDCC,0xFDCC,0xFDAC,0xF5AB,0xFDCC,
-	0xFDCC,0xFDEC,0xFE2B,0xFE6A,0xF669,0xF649,0xF5E9,0xF5CA,
-	0xF5CA,0xF5AA,0xF5AB,0xF5CB,0xF60A,0xFE2A,0xF649,0xF629,
-	0xF5E9,0xF589,0xF569,0xED48,0xED49,0xF549,0xF56A,0xF5AB,
-	0xFE0C,0xFE6B,0xFE4A,0xF5EB,0xFE50,0xFEF5,0xFF59,0xFF59,
-	0xFF36,0xFEB2,0xFE6E,0xFE4C,0xF64B,0xF60B,0xF5CB,0xF5AC,
-	0xF58C,0xF5AC,0xF5AC,0xF5ED,0xFE0D,0xFE2D,0xFE4F,0xFEB2,
-	0xFED3,0xFED4,0xFF17,0xFF9B,0xFF9C,0xFF59,0xFEF5,0xFED4,
-	0xFEB4,0xFE6F,0xFE2B,0xFE29,0xFE08,0xFE08,0xF5E9,0xF5E9,
-	0xFDE9,0xF5E9,0xF609,0xF609,0xFE29,0xFE29,0xFE2A,0xFE2B,
-	0xFE2B,0xFE2A,0xFE2A,0xFE2A,0xF609,0xF60A,0xFE2A,0xFE29,
-	0xFE4A,0xFE6A,0xFE8B,0xFE8B,0xFE8C,0xFE6D,0xFE6E,0xFE6F,
-	0xFE71,0xFE71,0xFE91,0xFE91,0xFEB1,0xFF11,0xFF53,0xFF54,
-	0xFF34,0xFEF4,0xFEB4,0xFEB4,0xFED4,0xFEB3,0xFED3,0xFEF3,
-	0xFED2,0xFE91,0xFE90,0xFE6E,0xFE6E,0xFECE,0xFF0E,0xFF4F,
-	0xFF51,0xFF32,0xFEF2,0xFED2,0xFE92,0xFE71,0xFE71,0xFE50
+	0xBCEC,0x8C2F,0x2295,0x09F7,0xC004,0x6C9C,0xA39B,0xE400,
+	0x0001,0xEDCB,0xFE09,0xC005,0x5CAB,0x9DEC,0xAC15,0x0001,
+	0x42D3,0x01B5,0xC00F,0xABAC,0xA39A,0x9B92,0xA394,0x9CA3,
+	0xA2A4,0xA6AD,0xEC64,0x0001,0x7BEF,0xFE92,0xC012,0xB4AB,
+	0x9B93,0x935B,0x9B9B,0xB4AD,0xF3B3,0xA494,0x9595,0x9494,
+	0x5B00,0x0000,0xB9C3,0xC005,0xABA4,0xACAC,0xACAC,0x8002,
+	0xB262,0x0001,0xB241,0xB261,0x800C,0xB242,0x8003,0xB262,
+	0xC014,0xE4AC,0xACEC,0xECAC,0xECB4,0xFBFC,0xECA5,0x5454,
+	0x935D,0x9CA5,0x9CAC,0xA500,0x8002,0xD364,0xC00A,0xACA4,
+	0xACA3,0xA4AC,0xA45C,0x9C94,0x5C00,0x8002,0xC303,0x8003,
+	0xC2E3,0xC010,0xACEC,0xA4AD,0xECED,0xACAC,0xECAD,0xF4AC,
+	0xB4AC,0xE46C,0xEC00,0x8002,0xED25,0xC006,0xA363,0x9C4C,
+	0x9454,0xE400,0x0000,0xEC43,0xC00C,0xEBAC,0xA5A5,0xA5AE,
+	0xB373,0xACA3,0x4594,0xA400,0x8002,0xECA6,0xC009,0xADED,
+	0xADE5,0xAB74,0xF36B,0x9D9C,0x8002,0xF568,0xC015,0xADAB,
+	0xA4F4,0x6CA3,0x9494,0x4C9C,0x9C9C,0xA4AD,0xECB6,0xFCBC,
+	0xAB93,0x4CAD,0x0000,0xF60D,0xC006,0xAFE5,0xA49A,0x9BAB,
+	0xAB00,0x0001,0xCD4D,0x09F3,0xC003,0xACAC,0x6CA3,0x0018,
+	0x32D1,0xE5AE,0xFE0E,0xFE0D,0xFDEC,0xF630,0xFEF6,0xFF7A,
+	0xFF7B,0x9CF2,0x00E7,0x00E8,0x010A,0x01B0,0x09F4,0x01F6,
+	0x2274,0xE5CA,0xF5E8,0xFDC8,0xFDC9,0xFDE9,0xE5A9,0x32D4,
+	0x0A17,0xC003,0x5CA2,0xDC64,0x0001,0xBD0D,0xFE0A,0xC006,
+	0x639C,0xA4EC,0xACA4,0xAC00,0x0002,0xBD2D,0x42F2,0x01F4,
+	0xC00D,0xA39A,0x9B92,0x9B9C,0x9CA3,0xA39B,0xADAE,0xADA3,
+	0x0001,0x7BEF,0xFE92,0xC012,0xB4AB,0x9B93,0x935B,0x9BA4,
+	0xA3B5,0xFCBC,0x9C9C,0x8C8D,0x9B94,0x5300,0x0000,0xB9E3,
+	0xC005,0xA4A3,0xA4AC,0xACAC,0x8006,0xB262,0xC004,0x9CAC,
+	0x9DA3,0xA400,0x8002,0xB243,0x0001,0xB242,0xB242,0x8003,
+	0xB262,0xC024,0xA5A3,0xEDA3,0xECAC,0xECF4,0xB4FC,0xF3F4,
+	0xA554,0x9C54,0x9464,0xDD64,0xA4A5,0xACA4,0xACA4,0xACA4,
+	0xA3A4,0xACA4,0x6494,0x9C54,0xA400,0x8002,0xC303,0x8002,
+	0xC2E3,0xC01A,0xACEC,0xA4ED,0xACF5,0xA4AC,0xECAD,0xECB4,
+	0xACB4,0xE4AC,0xACA3,0x6CA4,0xA363,0x9C4C,0x949C,0x9C00,
+	0x0000,0xEC42,0xC018,0xECAC,0xA5A5,0xA6AD,0x73B3,0xB49B,
+	0x8D4C,0xA4ED,0xACA5,0xACED,0xADE5,0x64B3,0xB3AB,0x9D00,
+	0x8004,0xF588,0xC014,0xACA4,0xB4AC,0xA394,0x9454,0x949C,
+	0x9CA4,0xADEC,0xB6FC,0xBCAB,0x934C,0xB600,0x0000,0xF62E,
+	0xC006,0xAFE4,0x9C9A,0x9BAB,0xAB00,0x0001,0xACCE,0x09F3,
+	0xC003,0xACAC,0xAC9B,0x0001,0xBCEE,0xFE0E,0xC003,0xA4A3,
+	0xA36F,0x000B,0xFEF6,0xFF7A,0xFF9B,0xFF3A,0x632D,0x00E8,
+	0x010A,0x01B0,0x09F4,0x01F6,0x9C8E,0xFE09,0xC004,0x5C9B,
+	0xE5AC,0x6300,0x0001,0xDD6A,0x0A17,0xC003,0x5CA3,0x9BA3,
+	0x0001,0x8C4F,0xFE0A,0xC008,0x9B6C,0x9CEC,0xACA4,0xADA4,
+	0x9D00,0x0004,0xDD8C,0x9C8E,0x73B0,0x42CF,0x018E,0xC003,
+	0x9B9C,0x9C9B,0x0001,0x21CC,0x3A6D,0xC003,0xECA5,0xA4AC,
+	0x0001,0x9CB0,0xFE92,0xC012,0xB4AB,0x9B94,0x9A93,0x5BA4,
+	0xABF4,0x7CF5,0x9D9D,0x948D,0x9352,0x9C00,0x8003,0xB9E3,
+	0xC005,0xABAD,0xABA4,0x6CEC,0x8005,0xB262,0x8004,0xB242,
+	0x0002,0xB243,0xB242,0xB242,0x8005,0xB262,0xC022,0xE4AD,
+	0xECAB,0xECAC,0xF4FC,0xF4FC,0xA49B,0x5554,0x9C5C,0xDD64,
+	0x9CAD,0xA4AC,0xACA4,0xE46C,0xA4AC,0xA4A3,0x649C,0x9C54,
+	0x9C00,0x8002,0xC303,0x8003,0xC2E3,0xC019,0xECAC,0xEDAC,
+	0xEDB4,0xA4EC,0xACED,0xACB4,0xB4A4,0xECAC,0x6BA4,0xABA4,
+	0x9B5C,0x5494,0x959B,0x0000,0xEC43,0xC018,0xF3A4,0xA5A5,
+	0x65ED,0xACB4,0xBB63,0x4D8C,0xA5E4,0xADAD,0xECA5,0xADE5,
+	0xA3B3,0xB36C,0x9C00,0x8005,0xF588,0xC00E,0xACF5,0x6BA3,
+	0x9593,0x5494,0x9C5C,0xE4AD,0xECF6,0xBC00,0x0000,0xFE2A,
+	0xC003,0xA393,0x4CB7,0x0000,0xFE2F,0xC006,0x6EA5,0x9BDA,
+	0x9AAC,0xAB00,0x0006,0x83EF,0x09F4,0x0A13,0x0233,0x0A53,
+	0x22B2,0xF5ED,0xC004,0xADEC,0x9CA3,0xB600,0x000A,0xFED6,
+	0xFF7A,0xFF7B,0xFF19,0xAD13,0x00E9,0x010A,0x01AF,0x01F4,
+	0x01F6,0xEDEA,0xC006,0xF295,0x9BA5,0xACA3,0xA400,0x0006,
+	0x32D5,0x01F7,0x01D5,0x01B5,0x09D5,0x840F,0xFE0A,0xC00B,
+	0xA35C,0xABE5,0x64EB,0xAEA4,0x9DA4,0xA5A6,0x0006,0x9C8F,
+	0x018E,0x014D,0x014D,0x012D,0x632F,0xFF13,0xC019,0xA69B,
+	0x9AA4,0x94A5,0xA3B4,0xAC9B,0x939A,0x9B93,0x64AB,0xF5BB,
+	0xB59D,0x9D95,0x959B,0x9352,0x8003,0xB9E3,0xC006,0xACAB,
+	0xACA4,0xACAC,0xA400,0x8005,0xB262,0x8005,0xB242,0x8003,
+	0xB262,0xC025,0xE4A4,0xA5A3,0xADAC,0xEBEC,0xACF4,0xF4FC,
+	0xB3F4,0x9D4C,0x549C,0x9C9D,0x64A4,0xA5A4,0xACAC,0xE4A4,
+	0xAC64,0xACA4,0xAB9C,0x5C9C,0x9C54,0x8004,0xC303,0xC01B,
+	0x9CAC,0xE4AC,0xACED,0xEDAC,0xACEC,0xACED,0xB4B4,0xACA4,
+	0xECAC,0x6BAC,0xA4A3,0x9B5C,0x9454,0x949C,0x0000,0xEC43,
+	0xC019,0xF3A4,0x9DA5,0xA5AD,0xB4B4,0x73AB,0x4D94,0x9DED,
+	0xACAD,0xE4A5,0xA5EC,0xA4AB,0x7BB4,0x9C9C,0x8004,0xF588,
+	0xC00E,0xADF4,0x6BA3,0x9D93,0x4C9C,0x945C,0xE4AD,0xECF6,
+	0xBD00,0x0000,0xFE2A,0xC003,0xA354,0x8CB6,0x0000,0xFE4F,
+	0xC006,0x6F9D,0xA2D2,0x9BAB,0xAB00,0x0006,0x7BEF,0x09F3,
+	0x0A13,0x0A53,0x0A53,0x4311,0xF5CD,0xC004,0xF56D,0xE3A4,
+	0xAE00,0x000A,0xFEF6,0xFF7A,0xFF7A,0xFF38,0xBD73,0x0109,
+	0x0109,0x01AF,0x01F4,0x01F6,0xFE29,0xC006,0x5CA3,0x94A5,
+	0xEC63,0xA400,0x0001,0x42F4,0x01F7,0x8002,0x01D5,0x0002,
+	0x7BEF,0xFE0A,0xFE09,0x8002,0xF609,0xC007,0xECA4,0xADA5,
+	0xA49C,0xA5A6,0x0006,0x5310,0x018E,0x014D,0x014D,0x012D,
+	0xEE92,0xFF13,0xC010,0xA69B,0xA294,0xA49D,0xA4B3,0xAC9B,
+	0x939B,0x5A93,0xACAC,0xEC00,0x0000,0xFEEC,0xC007,0xAC9D,
+	0x9D95,0x9D94,0x9C92,0x0000,0xB9C3,0x8003,0xB9E3,0xC009,
+	0xACAC,0xABAC,0xA4AC,0x639D,0xA4AC,0x8005,0xB262,0x0001,
+	0xB242,0xB263,0x8003,0xB262,0x0001,0xBA82,0xBA82,0x8002,
+	0xBA83,0xC005,0xACEB,0xECAC,0xECB3,0x0000,0xE3C2,0xC01A,
+	0xBCEB,0xA455,0x945C,0x9464,0x9DA4,0xA5A4,0xACAC,0xE4AC,
+	0xA464,0xACA4,0xA3AC,0x945C,0x9C9C,0x5C00,0x8002,0xC303,
+	0xC01C,0x9CAC,0xA4E4,0xACAC,0xEDEC,0xADAC,0xECAC,0xEDAC,
+	0xB4B4,0xACE4,0x6CEC,0xABA4,0x639B,0x5D94,0x5395,0x9B00,
+	0x0000,0xEC42,0xC019,0xB4E4,0x9DA5,0x6EA4,0xF4B4,0xB36C,
+	0x5D8C,0xE5A5,0xACA4,0xA5AC,0xE5E4,0xA4AB,0xBC73,0xA395,
+	0x8004,0xF588,0xC00E,0xACAC,0xB4AB,0xD553,0x4C9D,0x93A4,
+	0x9CAD,0xF4EE,0xBC00,0x0000,0xFE2B,0xC003,0xA34B,0x94BF,
+	0x0000,0xFE70,0xC006,0x6F9C,0xDA9A,0x93AB,0xB300,0x0006,
+	0x7BEF,0x09F3,0x0A14,0x0A53,0x0253,0x32D1,0xF5ED,0xC004,
+	0xEDAD,0xAC9B,0x6E00,0x000B,0xFEF6,0xFF7A,0xFF7A,0xFF39,
+	0xAD12,0x0109,0x0109,0x01AF,0x01F4,0x01F6,0xDDAB,0xF628,
+	0xC005,0x9C94,0xA4ED,0x63A4,0x0006,0x2A95,0x09F7,0x01D5,
+	0x01D5,0x01D4,0x7BEF,0xFE0A,0xC00B,0xA35C,0xABA5,0xECAC,
+	0xA5A4,0xA59C,0xA4A6,0x0005,0x42D0,0x018E,0x016D,0x014D,
+	0x322E,0xFEF2,0xC01A,0xADA6,0xA39A,0x94A4,0x9DA4,0xB3AC,
+	0x9B93,0x9B93,0x5AA4,0xB4F4,0xBCAC,0xA595,0x9694,0x9C9C,
+	0x9B00,0x0000,0xB9E2,0x8003,0xB9E3,0xC004,0xACAC,0xABA4,
+	0xAC00,0x8003,0xBA82,0x0002,0xB282,0xBA62,0xBA62,0x8002,
+	0xB262,0x0001,0xBA62,0xB263,0x8003,0xB262,0x0000,0xBA62,
+	0x8002,0xBA82,0xC008,0xA5A4,0xACE3,0xACF4,0xACF4,0xF400,
+	0x0000,0xE421,0xC00C,0xECAD,0x5494,0x549C,0x9C5D,0xA4A5,
+	0xACA4,0xAC00,0x8002,0xDBA4,0xC009,0x64A4,0xACAB,0x9CA4,
+	0x5C94,0x9C5C,0x8005,0xC303,0xC035,0xECA4,0xACED,0xACED,
+	0xACEC,0xACED,0xACB4,0xACB4,0xE4AC,0xACAB,0x64A3,0xA454,
+	0x9354,0x94E4,0xE3B4,0xE49D,0xAD9E,0x6CF5,0xB3B4,0x739D,
+	0x9595,0xA4AC,0xACA5,0xE4A5,0xE4A4,0xACBB,0x73A3,0x9D9C,
+	0x8003,0xF588,0xC00E,0xADEC,0x73A4,0x9C93,0x5495,0x9B5C,
+	0xE4A5,0xF5ED,0xBD00,0x0005,0xFE2B,0xFE4A,0xF5C9,0xF589,
+	0xF60C,0xF671,0xC006,0xB69C,0xD399,0x9BA3,0xB300,0x0001,
+	0x8C2F,0x09F3,0xC003,0xB4AC,0x64DB,0x0001,0xD56E,0xFE0E,
+	0xC003,0xB5A4,0x5BB6,0x000B,0xFEF6,0xFF7A,0xFF7A,0xFF38,
+	0x634E,0x0109,0x0109,0x01AF,0x01F4,0x01F6,0x7BEF,0xFE08,
+	0xC004,0x6494,0xA5EC,0x6300,0x0002,0xBCEC,0x09F7,0x09F6,
+	0x8002,0x01D5,0x0001,0x9C8E,0xFE0A,0xC003,0xA364,0xE464,
+	0x0003,0xCD6B,0xBD2C,0xCD6C,0xFE4A,0xC003,0xA59C,0xA5A5,
+	0x0005,0x42D0,0x018E,0x016D,0x014D,0x428E,0xFEF2,0xC01A,
+	0xADA6,0xA39B,0x93A4,0xA59C,0xABB4,0x9B9B,0x9392,0x5BA4,
+	0xB4F4,0xBCB5,0x9D95,0x9595,0xA394,0xA300,0x0000,0xB1E3,
+	0x8003,0xB9E3,0xC005,0xACA4,0xACAB,0xACA4,0x8005,0xBA82,
+	0xC008,0x9C64,0xA4E5,0x63A4,0xE563,0xA400,0x8003,0xBA82,
+	0xC008,0xA5A4,0xACE4,0xABEC,0xF4AC,0xF400,0x0000,0xE401,
+	0xC00C,0xF5AC,0x5C8B,0x5D94,0x9C5D,0xA4A5,0xA4AC,0xEC00,
+	0x8003,0xDBA4,0xC009,0x64AC,0xAC9B,0xA45C,0x949C,0x5CA4,
+	0x8004,0xC303,0xC035,0xECA4,0xACED,0xACED,0xACEC,0xADEC,
+	0xACB4,0xB4E4,0xACAC,0xACAB,0x64A3,0xA45B,0x9553,0x94DC,
+	0xE3F4,0x5CA5,0xA5A5,0xAEEC,0xBCB4,0x74A4,0x948D,0xA4B4,
+	0xA4E5,0xA4A5,0xE4A4,0xACBB,0x73A3,0x9C94,0x8003,0xF588,
+	0x0001,0xF5A9,0xFDC9,0x8002,0xF608,0xC009,0x8B54,0x959B,
+	0x5CE4,0xADED,0xEDBD,0x0005,0xFE2B,0xFE4A,0xF5C9,0xF589,
+	0xF60D,0xFE92,0xC006,0xAE63,0x8BD9,0x9AAB,0xAC00,0x0001,
+	0xBD0D,0x0A14,0xC003,0xABAC,0xA39C,0x0019,0x32D1,0xE5CE,
+	0xFE4F,0xFE50,0xFE2F,0xFE71,0xFED5,0xFF7A,0xFF7A,0x9CD2,
+	0x0109,0x010A,0x010A,0x018F,0x01F4,0x01D6,0x01D6,0xACCD,
+	0xF5E8,0xF5C8,0xF5C9,0xF5E9,0xD56A,0x2A75,0x09F7,0x09F6,
+	0x8002,0x01D5,0x0013,0xCD4C,0xFE2A,0xFE09,0xF609,0xF609,
+	0x42F3,0x09D6,0x01D6,0x0195,0x8C4F,0xFE4B,0xFE2B,0xFE2C,
+	0xFE2D,0x42D0,0x018E,0x016D,0x014D,0x428E,0xFEF2,0xC01A,
+	0xADAD,0x9C9B,0x939D,0xACA4,0xA3B4,0xA393,0x9352,0xA49B,
+	0xB4FC,0xB4B5,0x9D95,0x959D,0x939C,0xA300,0x0000,0xB1E3,
+	0x8003,0xB9E3,0xC004,0xACA4,0xACAC,0xAB00,0x8007,0xBA82,
+	0x8002,0xBA62,0xC005,0x64E4,0xAC9D,0x63E4,0x8002,0xBA82,
+	0xC017,0xA5A4,0xACE3,0xACEC,0xACF3,0xF4FD,0xFCAC,0x9C53,
+	0x9554,0x9C65,0x9CA5,0xA4B4,0xE4A4,0x8002,0xDBA4,0xC00A,
+	0xAC64,0xACA3,0x9C64,0x9494,0x649C,0xA400,0x8003,0xC303,
+	0xC029,0xECA4,0xACED,0xACED,0xACEC,0xADEC,0xACB4,0xACEC,
+	0xACAC,0xACAB,0x64A3,0xA49B,0x5454,0x94DC,0xEBE4,0x64A5,
+	0xA5A5,0xAEFD,0xB4B4,0xBC5B,0x958C,0xA4AC,0x8002,0xF529,
+	0xC008,0xA5E4,0xADA3,0xBB73,0xAC9C,0x9300,0x8002,0xF588,
+	0xC00F,0xA5AC,0xEC73,0xAC9C,0x8C53,0x959B,0x9CA5,0xACED,
+	0xEDBD,0x0005,0xFE2A,0xFE2A,0xF5C9,0xF58A,0xF60E,0xFE92,
+	0xC007,0x6EE4,0x9291,0x9AAB,0xAB5C,0x0000,0x1253,0x8002,
+	0x0A53,0x0017,0x0A32,0x0A12,0x32B1,0xBD2F,0xF650,0xFE4F,
+	0xFE71,0xFEF5,0xEEF9,0x7BEF,0x00C8,0x0129,0x010A,0x012A,
+	0x018F,0x01F4,0x01F6,0x09F6,0x01F7,0x32D4,0x7BEF,0x7BEF,
+	0x5352,0x0A17,0xC004,0xA49C,0xA35B,0xA400,0x0014,0x1214,
+	0xFE2A,0xFE0A,0xFE09,0xF609,0x9C6E,0x09D6,0x01D6,0x01B6,
+	0x0195,0x11F4,0xFE4B,0xFE4B,0xFE2C,0xFE2D,0x42D0,0x018E,
+	0x016D,0x014D,0x428E,0xFEF2,0xC01A,0xADAD,0x9C9B,0x9B9C,
+	0xA5A4,0xA3B4,0xA394,0x9A93,0x5BA3,0xB4F4,0xBCAD,0x9D95,
+	0x959D,0x93A4,0x9B00,0x0000,0xB1C2,0x8003,0xB9E3,0xC005,
+	0xACE4,0x64AB,0xADAB,0x8002,0xBA82,0x0000,0xBAA2,0x8004,
+	0xBA82,0x0001,0xBA62,0xBA62,0x8004,0xBA82,0x8003,0xBA83,
+	0xC016,0xACA4,0xA3EC,0xECAC,0xF4F4,0xFBF4,0xB49D,0x5B8D,
+	0x5C9C,0x9D64,0x9DA4,0xACAC,0xE400,0x8002,0xDBA4,0xC008,
+	0xAC64,0xACA3,0xA49C,0x5C94,0x9C00,0x8003,0xC323,0xC02B,
+	0x9CA4,0xE4AC,0xACED,0xACED,0xACEC,0xADEC,0xACB4,0xACB4,
+	0xE4AC,0x6CEB,0xA463,0xA49C,0x5453,0x94DC,0xEBE4,0x64A5,
+	0xA5A6,0xB5FE,0xB4B4,0xB35C,0x9395,0x9CAD,0x8002,0xF529,
+	0xC008,0xA5E4,0xACAC,0xB3BB,0x649C,0x9C00,0x8002,0xF588,
+	0xC013,0xA5AC,0xEC73,0xAC9C,0x8C53,0x9D94,0x9BA5,0xACED,
+	0xF5BD,0xBCA3,0x4B9D,0x0001,0xFE2E,0xFEB3,0xC007,0xAE5B,
+	0xD291,0x9BAA,0xAC5B,0x0001,0x6391,0x0A54,0xC006,0xA3A4,
+	0xA394,0x9B9B,0xE300,0x0003,0x42D0,0x42CF,0x322C,0x0085,
+	0xC004,0xA3B7,0xBFDC,0x6C00,0x0001,0x018F,0x01F4,0xC00C,
+	0xA69C,0xADEC,0xACA3,0x9CA5,0xA49C,0xA35B,0xA400,0x0006,
+	0x6371,0xFE0A,0xFE0A,0xFE09,0xFE09,0x7BEF,0x09D6,0xC003,
+	0x649B,0x9CA4,0x0009,0xFE6B,0xFE4B,0xFE2C,0xFE2D,0x42D0,
+	0x018E,0x016D,0x014D,0x428E,0xFEF2,0xC004,0xADAD,0x9C9B,
+	0x9C00,0x8002,0xFEB3,0xC012,0xA3B4,0xA394,0x9B92,0x5BA3,
+	0xB4F5,0xBCAC,0x9D95,0x9D95,0x93A4,0x5B00,0x0000,0xB1C3,
+	0x8003,0xB9E3,0x8002,0xC203,0xC004,0x6CAC,0xABAC,0xA400,
+	0x8004,0xBAA2,0x8005,0xBA82,0x0000,0xBA62,0x8004,0xBA82,
+	0xC009,0xA5AC,0xA4A3,0xECEC,0xACEC,0xF4BC,0x0000,0xEC21,
+	0xC00B,0xB4A5,0x5395,0x945C,0x9D5C,0xA5A4,0xACEC,0x8003,
+	0xDBA4,0xC008,0xACA4,0x6CA3,0xA49C,0x5C94,0x5C00,0x8004,
+	0xC323,0x8002,0xCB23,0xC017,0xACED,0xACED,0xACEC,0xADEC,
+	0xACB4,0xB4E4,0xACB4,0xA36C,0xEC5B,0xA45C,0x945B,0x8CDC,
+	0x8002,0xEC62,0xC02F,0xA5A6,0xAEFE,0xB5AC,0xABB3,0x6C94,
+	0x8C9D,0xACE4,0xAC9C,0xA5AC,0xE5AC,0xB37B,0xA39C,0x9C9C,
+	0x9CA5,0xA4AC,0xACF3,0x6CA4,0x8B4C,0x9D94,0x9CAC,0xA4ED,
+	0xF5BD,0xBCA3,0x8B5E,0x0001,0xFE4F,0xFEB4,0xC007,0xADA3,
+	0x8A98,0x93AB,0x6B9C,0x0000,0xD56D,0x8002,0x0A53,0xC006,
+	0x9B9C,0x935A,0x9CAC,0xDB00,0x0003,0x0109,0x0085,0x0084,
+	0x00E7,0x8002,0x012A,0x0001,0x8C50,0x01F4,0xC00C,0xA6DD,
+	0x6CEC,0xAC63,0xDCA5,0xA45C,0x9BA3,0xA400,0x0006,0xDDAB,
+	0xFE2A,0xFE0A,0xF609,0xF609,0x7BEF,0x09F6,0xC003,0x5C9B,
+	0x9C9C,0x0009,0xFE6B,0xFE4B,0xFE2C,0xFE2D,0x42D0,0x018E,
+	0x016D,0x016D,0x428E,0xFEF2,0xC01A,0xADAD,0xA493,0x9C94,
+	0xACA4,0xA3B4,0x9C9B,0x9B92,0x639C,0xF3BC,0xB4AE,0x9D95,
+	0x9D94,0x9B9C,0x9B00,0x0001,0xB1C2,0xB1C3,0x8002,0xB9E3,
+	0x8002,0xC203,0xC004,0xACAC,0xABA4,0x6C00,0x8005,0xBAA2,
+	0x8005,0xBA82,0xC01B,0xA5A3,0xAC9C,0xA5AC,0xA49C,0xABEC,
+	0xACEC,0xECF4,0xBCFB,0xECAD,0x9B4D,0x945C,0x9D64,0x9DA4,
+	0xACEC,0x8002,0xDBA4,0x8002,0xDBC4,0xC00B,0x6CA4,0xA3A4,
+	0x5C94,0x9C54,0xE4A4,0x64A4,0x8002,0xCB23,0xC040,0xACED,
+	0xACED,0xECAC,0xADEC,0xACAC,0xB4EC,0xACB4,0xA3AC,0xAC64,
+	0xA354,0x9C53,0xD49C,0xE3AC,0xA4A6,0xA6B6,0xF6AC,0xACB3,
+	0xB463,0x9C8D,0x9CE4,0xACA5,0x9BA5,0xACE5,0xACB3,0x7BA3,
+	0xA494,0x9C9C,0xA5A4,0xECAC,0xB46B,0xA48C,0x5395,0x9C00,
+	0x8002,0xED08,0x0008,0xF549,0xFD6A,0xFDCB,0xFE4B,0xFE2A,
+	0xFDC9,0xF5CB,0xFE50,0xFED4,0xC008,0xAE9B,0x8990,0xA3A3,
+	0xAB5C,0x9500,0x0001,0x73D0,0x0A53,0xC007,0xA45B,0x9C93,
+	0x9A93,0xAC9C,0x0009,0x0109,0x0084,0x0084,0x00E8,0x012A,
+	0x012A,0x428D,0xF66F,0x73D0,0x01F5,0xC00A,0x9DAD,0xECAC,
+	0x63E4,0x9DA4,0x9C5B,0xA300,0x0001,0x8C4F,0xFE2B,0xC003,
+	0xA39C,0x63A4,0x0010,0xACCD,0x09F6,0x01D6,0x01B5,0x0195,
+	0x11D4,0xFE6A,0xFE4B,0xFE2C,0xFE2D,0x42D0,0x018E,0x016D,
+	0x016E,0x014E,0xEE91,0xFF12,0xC019,0xAEA4,0x939C,0x94AD,
+	0xA3A4,0xB3A4,0x939B,0x9263,0xA4EB,0xBDB4,0xAD9D,0x9D95,
+	0x949B,0x9CA4,0x0001,0xB1C2,0xB1C3,0x8003,0xB9E3,0xC006,
+	0xECA4,0xAC6C,0xECA3,0xAC00,0x8006,0xBAA2,0x0000,0xBA82,
+	0x8004,0xBA83,0xC003,0xA3A4,0xA5A4,0x8002,0xBAA3,0xC006,
+	0xA3EC,0xA4EC,0xECF4,0xBC00,0x0000,0xE421,0xC00B,0xECAD,
+	0x9B55,0x8C5C,0xA55C,0x9CA5,0xACEC,0x8002,0xDBA4,0x8002,
+	0xDBC4,0xC00B,0x6BAC,0x9CA4,0x9C54,0x9C9C,0x9CA4,0x64A4,
+	0x8002,0xCB23,0xC040,0xACED,0xACED,0xF4A4,0xADEC,0xACAC,
+	0xB4EC,0xACB4,0xA3AC,0xAC63,0xA454,0x9C53,0xD49C,0xE4AB,
+	0xA6AE,0xAEAD,0xADEC,0xABB5,0xB3AB,0x5495,0x94EC,0xAC9C,
+	0xA5A4,0xA5EC,0xA4B3,0x7BAB,0x9C9C,0x949C,0xA5A4,0xECAC,
+	0xB46B,0x9C9B,0x4DD4,0x5C00,0x8002,0xED08,0x0002,0xF549,
+	0xFD6A,0xFDEB,0xC003,0xBCA3,0x43A7,0x0001,0xFE71,0xFED5,
+	0xC009,0xAD9B,0x8990,0xA3A3,0xAB54,0x949D,0x0001,0x4331,
+	0x0A53,0xC007,0x9B5C,0x939A,0x93A4,0xA388,0x0009,0x0084,
+	0x0084,0x00E8,0x012A,0x118B,0xCDB3,0xFE90,0xFE0B,0x32B3,
+	0x09D6,0xC008,0x6DEC,0xAC63,0xDCA5,0x9C64,0x9B00,0x0000,
+	0x73D1,0x8002,0xFE2A,0xC003,0x9C63,0xE464,0x0010,0x6371,
+	0x01D6,0x01B6,0x0195,0x8C4F,0xFE6B,0xFE4B,0xFE4C,0xFE2D,
+	0x42D0,0x018E,0x016D,0x014D,0x012D,0x52EE,0xAD31,0xBD92,
+	0xC003,0xA4A3,0x9CDC,0x0001,0xDE13,0xFE93,0xC012,0xACB3,
+	0xA493,0x9B92,0x63A4,0xEBBD,0xB4AD,0x9D9D,0x9594,0x9C9B,
+	0xA400,0x0001,0xA9C2,0xB1C3,0x8003,0xB9E3,0xC009,0xE4AC,
+	0xA4AC,0xACAB,0xACAC,0x64A4,0x8002,0xBAC2,0xC003,0x9CA4,
+	0x9CA4,0x8003,0xBA83,0x0001,0xBAA2,0xBAA2,0x8003,0xBAA3,
+	0xC006,0xA3EC,0xA4EC,0xACF4,0xF300,0x0000,0xE402,0xC00B,
+	0xF3AD,0x9C5B,0x8D5C,0x9C9D,0x5CA5,0xACEC,0x8002,0xDBA4,
+	0x8002,0xDBC4,0x0000,0xDBE4,0x8003,0xD3E3,0x0002,0xCB83,
+	0xCB63,0xCB43,0x8006,0xCB23,0xC045,0xACED,0xACED,0xF4A4,
+	0xADEC,0xACAC,0xB4EC,0xB4AC,0xACAB,0x9C6C,0x9BA4,0x5453,
+	0xD4A4,0xDCF4,0xAFAE,0x5DAC,0xADEC,0xACB4,0xB3AB,0x5C8D,
+	0x9CE4,0xADA4,0x9CA4,0xEDA4,0xACAB,0xBBAB,0x5C9C,0x94A4,
+	0x9DA4,0xECAC,0xB4AC,0x6394,0x8C54,0x9C9C,0xA4EC,0xADED,
+	0x0000,0xFDEB,0xC003,0xBC9B,0x8BA7,0x0000,0xFE92,0xC00B,
+	0xBFA5,0x9B91,0x88A3,0xA363,0x9C95,0x9C15,0x0001,0x6390,
+	0x0A32,0xC006,0x9C53,0x9A93,0xA4A3,0x8800,0x000A,0x0084,
+	0x0084,0x00E8,0x118B,0xCDB3,0xFED5,0xFE8F,0xFE2C,0xF60A,
+	0x73D0,0x01F7,0xC005,0xECAC,0x63DC,0x9DA4,0x0003,0x2275,
+	0xACCD,0xFE2A,0xF64A,0x8002,0xFE2A,0xC003,0x5CA3,0xEC64,
+	0x0003,0xCD4B,0xBD2D,0xCD8C,0xFE8A,0xC003,0x9D9D,0xA4A6,
+	0x0001,0x840F,0x018E,0xC009,0x9BA5,0x9C93,0x9C9A,0xA4AC,
+	0xB5AC,0x0001,0x7BEF,0xFEB3,0xC012,0xA4B3,0xA493,0x5BD3,
+	0x63A3,0xB3F5,0xBCA5,0x9E9D,0x9494,0xA49B,0x9C00,0x0002,
+	0xA9C2,0xB1C2,0xB1C3,0x8003,0xB9E3,0xC011,0xE4AC,0xACAC,
+	0xA4AB,0xACAC,0xA4AC,0xA464,0x9C9C,0xAC9C,0xA5A4,0x8004,
+	0xBAA2,0x8003,0xBAA3,0xC012,0xABE4,0xECAC,0xF4F4,0xFCFB,
+	0xACA4,0x9455,0x945C,0x9D9D,0x64EC,0xAC00,0x8002,0xDBA4,
+	0x8002,0xDBC4,0xC007,0xAC64,0xA4A3,0xA494,0x5C94,0x8006,
+	0xCB23,0xC027,0xACED,0xACF4,0xEDA4,0xACEC,0xA5B4,0xADF3,
+	0xB4AC,0xABA4,0xAC63,0xA49C,0x5493,0x94A4,0xEDF6,0x659D,
+	0xADA5,0xACEC,0xACAC,0xBBAC,0xA44C,0x94E5,0x8003,0xF56A,
+	0xC01D,0xA5EC,0xA4B3,0xB46A,0xA494,0x9C94,0xA5A4,0xACAC,
+	0xF46C,0xA394,0x9454,0x949C,0xA4AD,0xECF5,0xBDBC,0x9B4B,
+	0x0002,0xF5ED,0xFE92,0xFEF6,0xC008,0xA5A2,0x8991,0x9A63,
+	0xA39C,0x9500,0x8002,0xF5AC,0x0002,0xACAE,0x2271,0x09D2,
+	0xC006,0x5992,0xA4E4,0x4880,0xA300,0x000F,0x426B,0xDE13,
+	0xFEB4,0xFEB5,0xFE90,0xFE0B,0xFE09,0xF609,0xDD8A,0x8C2E,
+	0x5352,0x4313,0x4313,0x73D1,0xACCD,0xF608,0xC011,0xA5AD,
+	0xE4A5,0xA3A4,0x5BA5,0xABE4,0xA4AD,0xACA4,0xA5A5,0xA59D,
+	0x0001,0xDDCF,0x11CE,0xC009,0x139C,0x9D9B,0x949A,0xA4AC,
+	0xB5AC,0x0001,0x7BEF,0xFEB4,0xC012,0xA3B3,0xA494,0x9A5B,
+	0x9BA3,0xB4F4,0xBCA5,0xA695,0x9C94,0x94A3,0x9C00,0x0000,
+	0xA9C2,0xC012,0xA4E4,0xA5EC,0xA4EC,0x9CAC,0xA46C,0xECAB,
+	0xACAC,0xA4AC,0xAC9C,0xA400,0x8003,0xBAA2,0xC005,0x9DAB,
+	0xA5A4,0xA3A4,0x8003,0xBAA3,0xC014,0xABE5,0xECAB,0xECF4,
+	0xFCBB,0xF4A5,0x9B4D,0x945C,0x9D9C,0x65AC,0xECAC,0xA400,
+	0x8003,0xDBC4,0xC007,0xAC64,0xE463,0xA49C,0x5C94,0x8003,
+	0xCB43,0xC011,0x9CA4,0xADA3,0xEDAC,0xEDEC,0xACAC,0xEDA4,
+	0xB4B5,0xEBB4,0xACAB,0x8002,0xF565,0xC023,0x635C,0x949B,
+	0xD46E,0xF6E4,0x5CA5,0xA5A5,0xACEC,0xACF4,0x74AB,0xA494,
+	0x54A5,0xECA5,0x9BA5,0xA4EC,0xACAC,0xB3B3,0x5B9C,0x949D,
+	0x8002,0xF589,0xC011,0xF5B3,0xAC63,0x9C8C,0x549C,0x9C9C,
+	0xADF4,0xEDBD,0xBCA3,0x44AF,0x0001,0xFEB3,0xFF17,0xC008,
+	0xA49A,0x8991,0x9AA3,0x6394,0x9D00,0x8002,0xF5AC,0x000E,
+	0xFDCD,0xFE0D,0xCD4E,0x83EF,0x52EF,0x42AE,0x42AE,0x52CD,
+	0x8C71,0xDE98,0xFF18,0xFED5,0xFED4,0xFEB4,0xFE8F,0xC012,
+	0x80A2,0xAC9B,0x9C5C,0xA5AC,0xA3AC,0xE465,0xEDA4,0xA5A3,
+	0xA45B,0xA400,0x8002,0xFE29,0xC007,0xADAC,0xAD9C,0xA59C,
+	0xA6AD,0x0001,0xACF0,0x016D,0xC008,0xA49D,0x9B94,0x9AA4,
+	0xACB5,0xA400,0x0001,0x7BEF,0xFEB4,0xC012,0xA3B3,0xA494,
+	0x9A5B,0x9BA3,0xBCF4,0xB5AD,0x9D95,0x9C94,0x94A3,0x9C00,
+	0x0003,0xA1A2,0xA9C2,0xB1C2,0xB1C3,0x8002,0xB9E3,0xC00E,
+	0xE4AC,0xA46C,0xECAB,0xACAC,0xACA4,0xACA4,0x9DA3,0x6400,
+	0x8003,0xBAA2,0x0000,0xBAA3,0x8002,0xBAA2,0x8003,0xBAA3,
+	0xC014,0xABE5,0xEBAC,0xECB4,0xFBFC,0xF4A4,0x9C55,0x9454,
+	0x9DA4,0x5DAC,0xACEC,0xA400,0x8003,0xDBC4,0xC007,0xACA4,
+	0xAC63,0x9C9C,0x5C94,0x8003,0xCB43,0xC011,0x9CA4,0xACA4,
+	0xEDAC,0xECAD,0xECAD,0xECA4,0xB4AC,0xF4B4,0xACAB,0x8002,
+	0xF565,0xC015,0x639C,0x549C,0xA6ED,0xE45C,0xA4A5,0xA5AD,
+	0xA4EC,0xADF4,0x73AB,0xAC95,0x949C,0x8002,0xF58B,0xC01B,
+	0x9CA4,0xF4A5,0xABB3,0x73A3,0x9494,0x9D9C,0xA4AD,0xACEC,
+	0xB3A3,0x5C8C,0x945C,0x9CA4,0xA5F4,0xEDBD,0x0004,0xFE6B,
+	0xFE4A,0xF5CA,0xFE0E,0xFEB4,0xC013,0xBFAC,0x9A89,0x889B,
+	0xA3A3,0x5494,0x9DAC,0xA4F5,0xACAC,0xAFBE,0xAC5D,0x0001,
+	0xFEF7,0xFF9B,0xC004,0xA588,0x89A3,0x9C00,0x0000,0xFE6F,
+	0xC01E,0x88A2,0xAC9B,0x9C5C,0xA5AC,0xA3AC,0xA4AC,0xE6AC,
+	0xA59B,0xA49B,0x64EC,0xA464,0xED6C,0xEC9D,0xA59C,0xA6AD,
+	0xAE00,0x0002,0xCD91,0x222E,0x094E,0xC006,0x5B9C,0x939B,
+	0xB4B4,0xED00,0x0001,0x8410,0xFEB4,0xC012,0xA3B3,0xA494,
+	0x9A5B,0x9BAB,0xB4FC,0xADAD,0x9D95,0x9C94,0x9C9B,0x9C00,
+	0x0003,0xA1A2,0xA9A2,0xB1C2,0xB1C3,0x8002,0xB9E3,0x8003,
+	0xC203,0xC004,0xACAB,0xACB4,0xAC00,0x8002,0xC2E2,0x8002,
+	0xC2C2,0x8004,0xBAA2,0x0002,0xBAA3,0xBAA2,0xBAA2,0x8002,
+	0xBAC3,0xC015,0x9CAB,0xE5AC,0xE3F4,0xB4F4,0xFCF4,0xAB9C,
+	0x5594,0x5C95,0x9C6D,0xA4AC,0xECA4,0x8002,0xDBC4,0x8002,
+	0xDBE4,0xC006,0xACA4,0x639C,0x945C,0x9C00,0x8002,0xCB43,
+	0xC02A,0x9CAC,0xA5A4,0xECAC,0xECAD,0xECAD,0xECAC,0xACEC,
+	0xB4B4,0xACAB,0xA4AC,0x63AC,0x945D,0xEDA6,0x9BDC,0xA45C,
+	0xA5A5,0xADAC,0xECAD,0xACB3,0xB4A3,0x949D,0x9C00,0x8004,
+	0xF58B,0xC007,0xEDA4,0xABB3,0xB364,0x9493,0x8002,0xF5A9,
+	0xC00E,0xA5EC,0xACB3,0x639C,0x8C94,0x5C9C,0xA4A5,0xF4EE,
+	0xBC00,0x0005,0xFE6B,0xFE4A,0xF5CA,0xF60F,0xFED4,0xFF38,
+	0xC012,0xA49A,0x8888,0x9A6C,0x939C,0x949D,0xACA4,0xF5AC,
+	0xACAF,0xBEA5,0x6400,0x0001,0xFF17,0xFF9C,0xC004,0xA489,
+	0x9053,0xE400,0x0000,0xFE6F,0xC012,0x88AA,0xA49B,0x9C5C,
+	0xA5AC,0xA3EC,0x64AC,0xA6EC,0x9DA3,0xA49B,0x6400,0x8002,
+	0xFE29,0xC007,0xADAC,0xADA4,0x9D9C,0xA6AD,0x8002,0xFE91,
+	0x0000,0xBD50,0x8006,0x7BEF,0x0001,0xBD51,0xFEB4,0xC012,
+	0xA3B3,0xA593,0x9B5A,0xDB6B,0xF4BC,0xB5A6,0x9D95,0x9C93,
+	0x9C9C,0x9B00,0x0000,0xA1A2,0xC00F,0xA4E4,0xECAD,0xE4A4,
+	0xE4A4,0xACA4,0xACAC,0xACB3,0xACA4,0x8002,0xC2E2,0x8002,
+	0xC2C2,0x8005,0xBAA2,0x0002,0xBAC3,0xBAC3,0xC2C3,0x8002,
+	0xBAC3,0xC016,0xE4AC,0xEBEC,0xB4F4,0xFCF4,0xAC9B,0x945D,
+	0x945D,0x9C65,0xA4AC,0xECA4,0xACA4,0xEC00,0x8002,0xDBE4,
+	0xC006,0xACA4,0x639C,0x9C54,0x9C00,0x8004,0xCB43,0xC047,
+	0xA5E4,0xA4AC,0xF4AD,0xECAD,0xECAC,0xACEC,0xB4B4,0xAC6B,
+	0xECA4,0x64AB,0xA5A6,0x95A4,0x9BA4,0x9DA4,0x9DA4,0xADAC,
+	0xE5B4,0xACB3,0xB4AB,0x9D8C,0x9DA4,0xEC64,0x9CA4,0xEDA4,
+	0xACB2,0xB463,0x9C94,0x9C9C,0xA5A4,0xACF4,0xABAC,0x5394,
+	0x9454,0x9CA4,0xEDAD,0xF5B4,0x0004,0xFE6B,0xFE4A,0xF5CB,
+	0xFE0F,0xFED5,0xC014,0xBFAC,0x9288,0x88A2,0x6493,0x949D,
+	0x9CAC,0xACAD,0xECAD,0xB5B7,0xAD65,0xF700,0x0000,0xFF9C,
+	0xC014,0xA489,0x889B,0xA390,0x90A3,0x9AA4,0x5C9C,0xA4ED,
+	0x63AC,0xACA5,0xE5A4,0xA500,0x8002,0xFE2A,0xC02B,0x5BA5,
+	0xECA3,0xADAC,0xADA4,0xA59D,0xA5A5,0xAE9C,0xAC64,0xF5B4,
+	0xADAD,0x949C,0x93A5,0xA4A3,0xACAB,0x949A,0x5BE3,0x63F4,
+	0xBDAD,0xAD9D,0x959C,0x939C,0x9CA3,0x0000,0x99A2,0xC005,
+	0xE4E4,0xECAC,0xE5A4,0x8002,0xC1E3,0xC006,0xACAC,0xACAC,
+	0xABAC,0xAC00,0x8003,0xC2E2,0x0001,0xC2E3,0xC2C2,0x8004,
+	0xBAA2,0xC00C,0xA5AC,0xA4E4,0x64A4,0xA3E5,0xACE3,0xF4AC,
+	0xF400,0x0000,0xE402,0xC00E,0xF4AB,0xA495,0x5494,0x5D9C,
+	0x5DA4,0xF4AC,0xA4AC,0xA400,0x8003,0xDBE4,0xC006,0xACA4,
+	0x639C,0x9C54,0x9C00,0x8004,0xCB43,0xC00E,0xA5E4,0xA4AC,
+	0xF4AD,0xECAD,0xECAC,0xACEC,0xB4B4,0xAC00,0x8002,0xF565,
+	0xC024,0xAC65,0xB69D,0x949B,0x9CE3,0x5DA4,0xA59D,0xACAD,
+	0xECAD,0xACB3,0xB4AB,0x9C95,0x9CA4,0xE4A4,0x64A4,0xE5AC,
+	0xACB3,0xB3A3,0x5494,0x9C00,0x8002,0xF5AA,0xC010,0xECB4,
+	0xACAB,0x5C94,0x8B5D,0x9B9D,0xECAD,0xB5FC,0xBC9B,0x8D00,
+	0x0001,0xFE30,0xFEF5,0xC014,0xB7A4,0x9A88,0x909A,0x6394,
+	0x949D,0x9CAC,0xACAD,0xEC6C,0xF7B6,0xADA5,0xB700,0x0000,
+	0xFF9B,0xC004,0xA591,0x80A3,0x9C00,0x0000,0xFE6F,0xC00E,
+	0x90A3,0x9AA4,0x5C9C,0xA5AC,0xA4AC,0xE4AC,0xA5A5,0xA400,
+	0x8002,0xFE2A,0xC02B,0x5BA5,0xECA3,0xADAC,0xADA4,0x9DA5,
+	0xA5A5,0xAE9C,0xACA4,0xB5B3,0xAEAD,0x9C94,0x93A5,0xAC9B,
+	0xACAB,0x9C92,0x9B63,0xA4FC,0xB4B5,0xA59D,0x9594,0x9C9B,
+	0x9CA3,0x0000,0x99A2,0xC003,0xE3ED,0xA4EC,0x8002,0xB9E3,
+	0xC009,0xE4A4,0xACA4,0xACAC,0xB3AC,0xACA4,0x8002,0xC2E2,
+	0xC003,0xA59B,0x5CE4,0x8002,0xBAA2,0xC004,0xA5AC,0xE4A5,
+	0x6300,0x8003,0xC2C3,0xC013,0xEBB4,0xECF4,0xFCFC,0xACA3,
+	0x9554,0x9C55,0x9C5D,0xA4F4,0xACA4,0xACA4,0x8003,0xDBE4,
+	0xC007,0xACA4,0x639C,0x9C5C,0x9D94,0x8003,0xCB43,0xC04A,
+	0xA5E4,0xA4AC,0xF4AD,0xF4A5,0xECAC,0xACED,0xB3B4,0xB4AB,
+	0xA46C,0xEDAF,0x649B,0x949C,0xA49C,0xA49C,0xA5A5,0xA4AD,
+	0xACED,0xEC73,0xB4AB,0xA594,0x94A4,0xEDA4,0x9C63,0xEDA4,
+	0xACB3,0xB363,0x9C8C,0x9DA4,0x9CA5,0xACB3,0xEC6B,0x9C94,
+	0x8C9C,0x5BA5,0xE4AD,0xB5FD,0xBB9B,0x4D00,0x0002,0xFE50,
+	0xFEF5,0xFF59,0xC013,0xA499,0x8090,0x9A63,0x9494,0x9D9C,
+	0xACA4,0xB5EC,0xACAE,0xBFAD,0xA5B7,0x0000,0xFF9B,0xC004,
+	0xA591,0x889B,0x9C00,0x0000,0xFE6F,0xC00E,0x90A2,0x9BA4,
+	0x5DA4,0xE464,0xACA4,0xECA4,0xA5A5,0xA400,0x8002,0xFE2A,
+	0xC02B,0x5BA5,0xECA3,0xADAC,0xADA4,0xA59D,0xA5A5,0xA6A4,
+	0xACA4,0xACBC,0xB6A5,0x9C94,0x94A4,0xAC9B,0xACAC,0x9B93,
+	0xA39A,0xA4BC,0xB4B5,0xA69D,0x949C,0x949B,0xA49B
 	};
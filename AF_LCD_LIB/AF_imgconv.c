@@ -0,0 +1,152 @@
+//----------------------------------------------------------//
+//										AF_imgconv.c File
+//		Host tool: RGB565 image header -> AF_LCD RLE image
+//----------------------------------------------------------//
+/*------------------------------------------------------------------------------
+  Build and run on the PC (not part of the Keil project):
+
+    gcc -O2 -o AF_imgconv AF_imgconv.c
+    AF_imgconv image.h eca > image_rle.h
+
+  Input is a header made by the bmp to header convertor (ThaiEasyElec), that is
+  a C array of 16 bit numbers: width, height, then width*height RGB565 pixels.
+  Everything up to the first '{' is skipped.
+
+  Output is an array in the AF_LCD RLE format, which write_pic and
+  write_pic_fast draw directly:
+
+    word 0     AF_IMG_RLE (0xA5E1)
+    word 1,2   width, height
+    then packets, rows run on into each other (pixel order as in the input):
+      0nnnnnnn nnnnnnnn  c0 .. cn       n+1 literal pixels
+      10nnnnnn nnnnnnnn  color          run of n+1 pixels of color
+      11nnnnnn nnnnnnnn  d0d1 d2d3 ..   n+1 pixels, each one a byte added to
+                                        the pixel before it, two per word
+                                        (high byte first)
+    delta byte:  rrgggbbb  ->  red += rr-2, green += ggg-4, blue += bbb-4
+
+  Photos are mostly small steps between neighbours, so the delta packets do
+  most of the work there (eca: 76802 -> 50727 words); flat areas become runs.
+  A run is only cut for 3 or more equal pixels and a delta packet for 4 or
+  more pixels, shorter ones cost less as part of a literal packet.
+ *----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#define AF_IMG_RLE    0xA5E1
+#define MAX_LITERAL   0x8000
+#define MAX_PACKET    0x4000
+
+static unsigned short *in, *out;
+static unsigned long   npix, nout;
+
+static void emit (unsigned short w)
+{
+	out[nout++] = w;
+}
+
+/* delta byte for a -> b, -1 if a step is too large                           */
+static int delta (unsigned short a, unsigned short b)
+{
+	int dr = (b >> 11) - (a >> 11);
+	int dg = ((b >> 5) & 63) - ((a >> 5) & 63);
+	int db = (b & 31) - (a & 31);
+
+	if (dr < -2 || dr > 1 || dg < -4 || dg > 3 || db < -4 || db > 3)
+		return -1;
+	return ((dr + 2) << 6) | ((dg + 4) << 3) | (db + 4);
+}
+
+/* number of equal pixels from i                                              */
+static unsigned long run (unsigned long i)
+{
+	unsigned long j;
+	for (j = i; j < npix && j - i < MAX_PACKET && in[j] == in[i]; j++);
+	return j - i;
+}
+
+/* number of pixels from i (i > 0) that can be coded as deltas, up to a run  */
+static unsigned long drun (unsigned long i)
+{
+	unsigned long j;
+	for (j = i; j < npix && j - i < MAX_PACKET && delta(in[j - 1], in[j]) >= 0 && run(j) < 3; j++);
+	return j - i;
+}
+
+/* literal packets for the pending pixels lit .. i-1                          */
+static void flush (unsigned long *lit, unsigned long i)
+{
+	unsigned long k;
+
+	while (i > *lit) {
+		k = i - *lit < MAX_LITERAL ? i - *lit : MAX_LITERAL;
+		emit((unsigned short)(k - 1));
+		for (; k; k--) emit(in[(*lit)++]);
+	}
+}
+
+int main (int argc, char **argv)
+{
+	FILE *f;
+	unsigned long n = 0, cap = 1024, i, k, lit;
+	unsigned long v;
+	int c;
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s image.h name\n", argv[0]);
+		return 1;
+	}
+	f = fopen(argv[1], "r");
+	if (!f) { perror(argv[1]); return 1; }
+
+	while ((c = fgetc(f)) != EOF && c != '{');
+	in = malloc(cap * sizeof *in);
+	for (;;) {
+		while ((c = fgetc(f)) != EOF && c != '}' && (c < '0' || c > '9'));
+		if (c == EOF || c == '}') break;
+		ungetc(c, f);
+		if (fscanf(f, "%li", (long *)&v) != 1) break;
+		if (n == cap) in = realloc(in, (cap *= 2) * sizeof *in);
+		in[n++] = (unsigned short)v;
+	}
+	fclose(f);
+
+	if (n < 2 || n - 2 < (unsigned long)in[0] * in[1]) {
+		fprintf(stderr, "%s: %lu numbers, not width, height and pixels\n", argv[1], n);
+		return 1;
+	}
+	npix = (unsigned long)in[0] * in[1];
+	out = malloc((3 + npix * 2) * sizeof *out);
+
+	emit(AF_IMG_RLE);
+	emit(in[0]);
+	emit(in[1]);
+	in += 2;
+
+	for (i = 0, lit = 0; i < npix; ) {
+		if ((n = run(i)) >= 3) {
+			flush(&lit, i);
+			emit((unsigned short)(0x8000 | (n - 1)));
+			emit(in[i]);
+			lit = i += n;
+		} else if (i > 0 && (n = drun(i)) >= 4) {
+			flush(&lit, i);
+			emit((unsigned short)(0xC000 | (n - 1)));
+			for (k = 0; k < n; k += 2)
+				emit((unsigned short)(delta(in[i + k - 1], in[i + k]) << 8 |
+				                      (k + 1 < n ? delta(in[i + k], in[i + k + 1]) : 0)));
+			lit = i += n;
+		} else {
+			i++;
+		}
+	}
+	flush(&lit, npix);
+
+	printf("// %s: %ux%u RGB565, AF_LCD RLE (AF_imgconv)\n", argv[2], in[-2], in[-1]);
+	printf("// %lu words, raw %lu words\n", nout, npix + 2);
+	printf("const unsigned short %s[] = \n{", argv[2]);
+	for (i = 0; i < nout; i++)
+		printf("%s0x%04X%s", i % 8 ? "" : "\n\t", out[i], i + 1 < nout ? "," : "");
+	printf("\n\t};\n");
+	return 0;
+}
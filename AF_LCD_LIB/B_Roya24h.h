@@ -3858,7 +3858,7 @@ const ULONG font24h_arabic2_table[] =
 };
 
  
-	USHORT GetExtendedIndex (USHORT glyph, const FONTHEADER_BFC *pFontHeader)
+	USHORT GetExtendedIndexScan (USHORT glyph, const FONTHEADER_BFC *pFontHeader)
     {
         if( pFontHeader == NULL )
 		      return 0;
@@ -3899,6 +3899,19 @@ const ULONG font24h_arabic2_table[] =
         return 0;   //* not found, return the first glyph index * //
 
     }
+
+#ifndef AF_FONTIDX_GEN
+#include "B_Roya24h_idx.h"
+
+	/* O(1) with the page table made by AF_fontidx.c (codes between the ranges
+	   give 0 as well), the range scan above is left for other fonts          */
+	USHORT GetExtendedIndex (USHORT glyph, const FONTHEADER_BFC *pFontHeader)
+	{
+		if( pFontHeader == &font24h )
+			return font24h_idx_page[font24h_idx_top[glyph >> 8]][glyph & 0xFF];
+		return GetExtendedIndexScan(glyph, pFontHeader);
+	}
+#endif
 		
 
 
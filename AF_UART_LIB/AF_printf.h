@@ -0,0 +1,160 @@
+//----------------------------------------------------------//
+//												AF_printf.h File
+//						printf engine shared by LCD, UART, ...
+//----------------------------------------------------------//
+
+#ifndef _AF_PRINTF_H
+#define _AF_PRINTF_H
+
+#include "..\AF_LCD_LIB\AF_va_list.h"
+#include "..\AF_LCD_LIB\AF_stdarg.h"
+
+/*------------------------------------------------------------------------------
+  AF_vprintf (sink, format, args)
+
+  The output goes character by character to sink.put(char), nothing is copied
+  into a buffer first (%s is streamed from the argument, numbers are built in
+  a 11 byte stack buffer), so it is reentrant and works for any output that
+  has a put().
+
+  %[flags][width][.precision][l]type
+    flags     : '-' left align, '0' pad with zeros
+    width     : number or '*'
+    precision : number or '*', minimum digits for integers, maximum
+                characters for %s
+    type      : c s d i u x X %  ('l' is accepted, long is 32 bit here)
+ *----------------------------------------------------------------------------*/
+
+/* n / 10 with a multiply: 0xCCCCCCCD = 2^35 / 10 rounded up, exact for 32 bit */
+static __inline unsigned AF_div10 (unsigned n)
+{
+	return (unsigned)(((unsigned long long)n * 0xCCCCCCCDu) >> 35);
+}
+
+/* digits of n (least significant first) into buf, returns the count          */
+static __inline int AF_utoa_rev (unsigned n, int hex, int upper, char *buf)
+{
+	const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+	int len = 0;
+	unsigned q;
+
+	if (hex) {
+		do { buf[len++] = digits[n & 0xF]; n >>= 4; } while (n);
+	} else {
+		do { q = AF_div10(n); buf[len++] = (char)('0' + (n - q * 10)); n = q; } while (n);
+	}
+	return len;
+}
+
+template <class SINK>
+int AF_vprintf (SINK &out, const char *fmt, va_list args)
+{
+	char buf[11];
+	int count = 0;
+	int left, zero, width, prec, len, pad, neg;
+	unsigned u;
+	const char *s;
+	char c, sign;
+
+	for (; (c = *fmt) != 0; fmt++) {
+
+		if (c != '%') {
+			out.put(c);
+			count++;
+			continue;
+		}
+
+		/*** flags ***/
+		left = zero = 0;
+		for (;;) {
+			c = *++fmt;
+			if (c == '-')      left = 1;
+			else if (c == '0') zero = 1;
+			else break;
+		}
+
+		/*** width ***/
+		width = 0;
+		if (c == '*') {
+			width = va_arg(args, int);
+			if (width < 0) { left = 1; width = -width; }
+			c = *++fmt;
+		} else {
+			while (c >= '0' && c <= '9') { width = width * 10 + (c - '0'); c = *++fmt; }
+		}
+
+		/*** precision ***/
+		prec = -1;
+		if (c == '.') {
+			prec = 0;
+			c = *++fmt;
+			if (c == '*') {
+				prec = va_arg(args, int);
+				c = *++fmt;
+			} else {
+				while (c >= '0' && c <= '9') { prec = prec * 10 + (c - '0'); c = *++fmt; }
+			}
+		}
+
+		/*** length, long == int ***/
+		while (c == 'l' || c == 'h') c = *++fmt;
+
+		switch (c) {
+
+			/*** characters ***/
+		case 'c':
+			buf[0] = (char)va_arg(args, int);
+			s = buf;
+			len = 1;
+			goto put_string;
+
+			/*** strings, streamed from the argument ***/
+		case 's':
+			s = va_arg(args, const char *);
+			if (!s) s = "(null)";
+			for (len = 0; s[len] && (prec < 0 || len < prec); len++);
+		put_string:
+			pad = width > len ? width - len : 0;
+			count += pad + len;
+			if (!left) while (pad--) out.put(' ');
+			while (len--) out.put(*s++);
+			if (left) while (pad-- > 0) out.put(' ');
+			break;
+
+			/*** integers ***/
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'x':
+		case 'X':
+			u = va_arg(args, unsigned);
+			neg = 0;
+			if ((c == 'd' || c == 'i') && (int)u < 0) { neg = 1; u = 0u - u; }
+			sign = neg ? '-' : 0;
+			len = (prec == 0 && u == 0) ? 0 : AF_utoa_rev(u, c == 'x' || c == 'X', c == 'X', buf);
+			if (prec >= 0) zero = 0;
+			prec = prec > len ? prec - len : 0;            /* leading zeros  */
+			pad = width - len - prec - (sign ? 1 : 0);
+			if (pad < 0) pad = 0;
+			if (zero && !left) { prec += pad; pad = 0; }
+			count += pad + (sign ? 1 : 0) + prec + len;
+			if (!left) while (pad--) out.put(' ');
+			if (sign) out.put(sign);
+			while (prec--) out.put('0');
+			while (len--) out.put(buf[len]);
+			if (left) while (pad-- > 0) out.put(' ');
+			break;
+
+		case '%':
+			out.put('%');
+			count++;
+			break;
+
+		default:
+			return count;
+		}
+	}
+	return count;
+}
+
+#endif
@@ -1,9 +1,9 @@
 #include "AF_size_t.h"
 
-char tbuf[32];
 char bchars[] = { '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F' };
 
 void itoa(unsigned i, unsigned base, char* buf) {
+	char tbuf[32];
 	int pos = 0;
 	int opos = 0;
 	int top = 0;
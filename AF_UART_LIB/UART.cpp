@@ -13,6 +13,7 @@
 #include "..\AF_LCD_LIB\AF_stdarg.h"
 #include "AF_string.h"
 #include "AF_size_t.h"
+#include "AF_printf.h"
 
 void UART :: set_buadrate (uint32_t buadrate){
 	_buadrate=buadrate;
@@ -148,6 +149,11 @@ unsigned char UART :: getchar3 (void)  // Get Character from Uart
 
 
 
+struct UART_Sink {
+	UART *uart;
+	void put (char c) { uart->sendchar(c); }
+};
+
 int UART :: printf (const char* str, ...) {
 
 	if (!str)
@@ -155,71 +161,10 @@ int UART :: printf (const char* str, ...) {
 
 	va_list		args;
 	va_start(args, str);
-	size_t i;
-	for (i = 0; i<strlen(str); i++) {
-
-		switch (str[i]) {
-
-		case '%':
-
-			switch (str[i + 1]) {
-
-				/*** characters ***/
-			case 'c': {
-				char c = va_arg(args, char);
-				sendchar(c);
-				i++;		// go to next character
-				break;
-			}
-
-					  /*** address of ***/
-			case 's': {
-				int c = (int&)va_arg(args, char);
-				char str[64];
-				strcpy(str, (const char*)c);
-				sendstring(str);
-				i++;		// go to next character
-				break;
-			}
-
-					  /*** integers ***/
-			case 'd':
-			case 'i': {
-						int c = va_arg (args, int);
-						char str[32]={0};
-						itoa_s (c, 10, str);
-				sendstring(str);
-				i++;		// go to next character
-				break;
-			}
-
-					  /*** display in hex ***/
-			case 'X':
-			case 'x': {
-					int c = va_arg (args, int);
-					char str[32]={0};
-					itoa_s (c, 16, str);
-				sendstring(str);
-				i++;		// go to next character
-				break;
-			}
-
-			default:
-				va_end(args);
-				return 1;
-			}
-
-			break;
-
-		default:
-			sendchar(str[i]);
-			break;
-		}
-
-	}
-
+	UART_Sink sink = { this };
+	int n = AF_vprintf(sink, str, args);
 	va_end(args);
-	return i;
+	return n;
 }
 
 
@@ -3,6 +3,8 @@
 #include "DIALOG.h"
 #include "DIALOG.h"
 #include "..\MouseKeyboard\KeyboardHost.h"
+#include "LCD_Stat.h"
+#include "GUI_Heap.h"
 
 	WM_HWIN CreateUART(void);
 	WM_HWIN Createtools(void);
@@ -181,6 +183,8 @@ static void _cbBkWindow(WM_MESSAGE * pMsg) {
   int xSize;
   int ySize;
 
+  LCD_Stat_Paint(pMsg->MsgId);            /* display counters per paint cycle */
+  GUI_Heap_Paint(pMsg->MsgId);            /* heap and memory device samples   */
   switch (pMsg->MsgId) {
   case WM_PAINT:
     xSize = LCD_GetXSize();
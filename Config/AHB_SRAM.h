@@ -0,0 +1,79 @@
+/*********************************************************************
+*               arvin2009
+**                                 http://www.didbansanat.com
+----------------------------------------------------------------------
+File        : AHB_SRAM.h
+Purpose     : Layout of the AHB SRAM banks (0x2007C000 - 0x20083FFF)
+----------------------------------------------------------------------
+
+  The two 16 KB AHB SRAM banks are IRAM2 of the target. Every buffer
+  placed there is listed here and reserved by its owner with
+  __attribute__((at(...))), so the linker puts no other data on top:
+
+    AF_LCD_FB_ADDR    AF_LCD strip framebuffer      AF_LCD.cpp
+                      (AF_LCD_FB only, bottom of bank 0)
+    GUI_HEAP_ADDR     emWin heap                    GUIConf.c
+                      (GUI_HEAP_AHB 1, up to the DMA buffers)
+    SPI_DMA_BUF_ADDR  SPI DMA ping-pong buffers     LCD_X_SPI.c
+                      (top 2 KB of bank 1)
+
+  The GPDMA reaches only this RAM, not the CPU SRAM. USB data of the
+  LPC1768 build is not placed here (usbram is an LPC177x/8x section),
+  neither is the FAT free space map, it is a static of fs_fat.c.
+*/
+
+#ifndef AHB_SRAM_H
+#define AHB_SRAM_H
+
+#define AHB_SRAM_BASE     0x2007C000
+#define AHB_SRAM_END      0x20084000
+
+/*********************************************************************
+*
+*       AF_LCD strip framebuffer
+*
+*  AF_LCD_FB_LINES full GRAM rows (240 pixels, RGB565).
+*/
+//#define AF_LCD_FB                               /* strip framebuffer (FbOpen/Flush) */
+#ifndef   AF_LCD_FB_LINES
+  #define AF_LCD_FB_LINES  32                     /* 15 KB */
+#endif
+#ifdef AF_LCD_FB
+  #define AF_LCD_FB_ADDR   AHB_SRAM_BASE
+  #define AF_LCD_FB_SIZE   (AF_LCD_FB_LINES * 240 * 2)
+#else
+  #define AF_LCD_FB_SIZE   0
+#endif
+
+/*********************************************************************
+*
+*       SPI DMA buffers, two buffers of SPI_DMA_WORDS
+*/
+#define SPI_DMA_WORDS     512
+#define SPI_DMA_BUF_SIZE  (2 * 2 * SPI_DMA_WORDS)
+#define SPI_DMA_BUF_ADDR  (AHB_SRAM_END - SPI_DMA_BUF_SIZE)
+
+/*********************************************************************
+*
+*       emWin heap, the space between the framebuffer and the DMA buffers
+*/
+#ifndef   GUI_HEAP_AHB
+  #define GUI_HEAP_AHB    1
+#endif
+#define GUI_HEAP_ADDR     (AHB_SRAM_BASE + ((AF_LCD_FB_SIZE + 3) & ~3))
+#define GUI_HEAP_AHB_SIZE (SPI_DMA_BUF_ADDR - GUI_HEAP_ADDR)
+
+/*********************************************************************
+*
+*       Checks
+*/
+#if AF_LCD_FB_SIZE + SPI_DMA_BUF_SIZE > AHB_SRAM_END - AHB_SRAM_BASE
+  #error AF_LCD_FB_LINES: framebuffer and SPI DMA buffers do not fit into the AHB SRAM
+#endif
+#if GUI_HEAP_AHB && (GUI_HEAP_AHB_SIZE < 8 * 1024)
+  #error Less than 8 KB AHB SRAM left for the emWin heap, lower AF_LCD_FB_LINES or set GUI_HEAP_AHB 0
+#endif
+
+#endif /* AHB_SRAM_H */
+
+/*************************** End of file ****************************/
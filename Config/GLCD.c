@@ -23,9 +23,11 @@
 #include "GLCD.h" 
 #include "HzLib.h"
 #include "AsciiLib.h"
+#include "LCD_Stat.h"
 
 /* Private variables ---------------------------------------------------------*/
 static uint8_t LCD_Code;
+static uint32_t LCD_RdWait = 50;	/* wait_delay count for tRD, set in LCD_Initializtion */
 
 /* Private define ------------------------------------------------------------*/
 #define  ILI9320    0  /* 0x9320 */
@@ -116,7 +118,7 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 	unsigned short id1,id2,id;
   LPC_GPIO0->FIODIR &= (~(0xff<<15));  
 	LPC_GPIO0->FIODIR &= (~(0xff<<4));
-  wait_delay(50);							      //delay some times
+  wait_delay(LCD_RdWait);							      /* tRD, see LCD_T_RD_NS */
 	id1=(LPC_GPIO0->FIOPIN >>15)&0xFF;
   id2=(LPC_GPIO0->FIOPIN >>4)&0xFF;
 	id = id2|(id1<<8);
@@ -133,6 +135,8 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 *******************************************************************************/
  void LCD_WriteIndex(uint16_t index)
 {
+	LCD_STAT_ADD( RegWrites, 1 );
+	LCD_STAT_ADD( CsCycles, 1 );
 	LCD_CS(0);
 	LCD_RS(0);
 	LCD_RD(1);
@@ -154,6 +158,8 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 *******************************************************************************/
  void LCD_WriteData(uint16_t data)
 {				
+	LCD_STAT_ADD( WordsWritten, 1 );
+	LCD_STAT_ADD( CsCycles, 1 );
 	LCD_CS(0);
 	LCD_RS(1);   
 	LCD_Send( data );
@@ -175,6 +181,8 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 { 
 	uint16_t value;
 	
+	LCD_STAT_ADD( WordsRead, 1 );
+	LCD_STAT_ADD( CsCycles, 1 );
 	LCD_CS(0);
 	LCD_RS(1);
 	LCD_WR(1);
@@ -187,6 +195,82 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 	return value;
 }
 
+/*******************************************************************************
+* Function Name  : LCD_WriteDataMultiple
+* Description    : Write NumItems data words in one burst (emWin pfWriteM16_A1)
+* Input          : - pData: words
+*                  - NumItems: number of words
+* Output         : None
+* Return         : None
+* Attention		 : CS and RS are set once, then every word is two stores to
+*                  the data lines (FIOSET / FIOCLR, no FIOMASK so other P0
+*                  users in interrupts are not disturbed) and a WR strobe
+*******************************************************************************/
+#define LCD_DATA_PINS	( (0xffUL << 15) | (0xffUL << 4) )
+#define LCD_WR_STROBE()		{ LPC_GPIO2->FIOCLR = PIN_WR; __nop(); __nop(); __nop(); LPC_GPIO2->FIOSET = PIN_WR; }
+#define LCD_BURST_WORD(d)	{ v = ( (uint32_t)((d) >> 8) << 15 ) | ( (uint32_t)((d) & 0xff) << 4 ); \
+							  LPC_GPIO0->FIOSET = v; LPC_GPIO0->FIOCLR = v ^ LCD_DATA_PINS; \
+							  LCD_WR_STROBE(); }
+
+void LCD_WriteDataMultiple(uint16_t *pData, int NumItems)
+{
+	uint32_t v;
+
+	LCD_STAT_ADD( WordsWritten, NumItems );
+	LCD_STAT_ADD( CsCycles, 1 );
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_RD(1);
+	LPC_GPIO0->FIODIR |= LCD_DATA_PINS;
+	while( NumItems >= 4 )
+	{
+		LCD_BURST_WORD( pData[0] );
+		LCD_BURST_WORD( pData[1] );
+		LCD_BURST_WORD( pData[2] );
+		LCD_BURST_WORD( pData[3] );
+		pData += 4;
+		NumItems -= 4;
+	}
+	while( NumItems-- > 0 )
+	{
+		LCD_BURST_WORD( *pData );
+		pData++;
+	}
+	LCD_CS(1);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ReadDataMultiple
+* Description    : Read NumItems data words in one burst (emWin pfReadM16_A1)
+* Input          : - pData: words
+*                  - NumItems: number of words
+* Output         : None
+* Return         : None
+* Attention		 : CS and RS are set and the data lines switched to input once,
+*                  every word is one RD strobe held for tRD (LCD_RdWait)
+*******************************************************************************/
+void LCD_ReadDataMultiple(uint16_t *pData, int NumItems)
+{
+	uint32_t v;
+
+	LCD_STAT_ADD( WordsRead, NumItems );
+	LCD_STAT_ADD( CsCycles, 1 );
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_WR(1);
+	LPC_GPIO0->FIODIR &= ~LCD_DATA_PINS;
+	while( NumItems-- > 0 )
+	{
+		LCD_RD(0);
+		wait_delay(LCD_RdWait);
+		v = LPC_GPIO0->FIOPIN;
+		LCD_RD(1);
+		*pData++ = ( ( ( v >> 15 ) & 0xFF ) << 8 ) | ( ( v >> 4 ) & 0xFF );
+	}
+	LPC_GPIO0->FIODIR |= LCD_DATA_PINS;
+	LCD_CS(1);
+}
+
 /*******************************************************************************
 * Function Name  : LCD_WriteReg
 * Description    : Writes to the selected LCD register.
@@ -303,6 +387,8 @@ static void delay_ms(uint16_t ms)
 void LCD_Initializtion(void)
 {
 	uint16_t DeviceCode;
+	/* LCD_T_RD_NS in wait_delay loops (LCD_Timing.h) */
+	LCD_RdWait = LCD_RD_WAIT_COUNT(SystemCoreClock);
 	LPC_GPIO0->FIODIR |= (0xFF<<15);
 	LPC_GPIO0->FIODIR |= (0xFF<<4);
   LPC_GPIO2->FIODIR |= PIN_CS | PIN_RS | PIN_WR | PIN_RD | PIN_RST;					
@@ -1138,24 +1224,11 @@ void LCD_Clear(uint16_t Color)
 {
 	uint32_t index;
 	
-	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
+	if( LCD_FillWindow( 0, 0, MAX_X - 1, MAX_Y - 1, Color ) == 0 )
 	{
-		LCD_WriteReg(0x02,0x00);                                                  
-		LCD_WriteReg(0x03,0x00);  
-		                
-		LCD_WriteReg(0x04,0x00);                           
-		LCD_WriteReg(0x05,0xEF);  
-		                 
-		LCD_WriteReg(0x06,0x00);                           
-		LCD_WriteReg(0x07,0x00);    
-		               
-		LCD_WriteReg(0x08,0x01);                           
-		LCD_WriteReg(0x09,0x3F);     
+		return;
 	}
-	else
-	{	
-		LCD_SetCursor(0,0); 
-	}	
+	LCD_SetCursor(0,0); 
 
 	LCD_WriteIndex(0x0022);
 	for( index = 0; index < MAX_X * MAX_Y; index++ )
@@ -1232,6 +1305,267 @@ uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
 	}
 }
 
+/******************************************************************************
+* Function Name  : LCD_EntryMode
+* Description    : Entry mode register value outside of a window access
+* Input          : None
+* Output         : None
+* Return         : R11 value for SSD1289 / SSD1298, R03 value for the others
+* Attention		 : Known values, the register is not read back: LCD_ENTRY_MODE
+*                  (emWin) for the SSD controllers, the LCD_Initializtion
+*                  values for the others
+*******************************************************************************/
+static uint16_t LCD_EntryMode(void)
+{
+	switch( LCD_Code )
+	{
+		case SSD1289:
+		case SSD1298:
+			return LCD_ENTRY_MODE;
+		case ILI9320:
+		case R61505U:
+			return 0x1018;
+		default:
+			return 0x1030;
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_OpenWindow
+* Description    : Set a GRAM window for a rectangle and select GRAM access
+* Input          : - x0, y0: top left corner
+*                  - x1, y1: bottom right corner
+* Output         : None
+* Return         : entry mode register value to hand to LCD_CloseWindow
+* Attention		 : Only for controllers with window registers (not HX834x,
+*                  SSD2119). The entry mode is set to ID=11 AM=0, so with
+*                  DISP_ORIENTATION 90 one GRAM line is one screen column,
+*                  starting at x1
+*******************************************************************************/
+static uint16_t LCD_OpenWindow(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1)
+{
+	uint16_t hs, he, vs, ve, entry;
+
+	/* GRAM h/v address range of the rectangle */
+	#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	hs = y0;  he = y1;
+	vs = ( MAX_X - 1 ) - x1;  ve = ( MAX_X - 1 ) - x0;
+	#else
+	hs = x0;  he = x1;
+	vs = y0;  ve = y1;
+	#endif
+
+	entry = LCD_EntryMode();
+	if( LCD_Code == SSD1289 || LCD_Code == SSD1298 )
+	{
+		LCD_WriteReg( 0x0011, ( entry & ~0x0038 ) | 0x0030 );
+		LCD_WriteReg( 0x0044, ( he << 8 ) | hs );
+		LCD_WriteReg( 0x0045, vs );
+		LCD_WriteReg( 0x0046, ve );
+		LCD_WriteReg( 0x004e, hs );
+		LCD_WriteReg( 0x004f, vs );
+	}
+	else
+	{
+		LCD_WriteReg( 0x0003, ( entry & ~0x0038 ) | 0x0030 );
+		LCD_WriteReg( 0x0050, hs );
+		LCD_WriteReg( 0x0051, he );
+		LCD_WriteReg( 0x0052, vs );
+		LCD_WriteReg( 0x0053, ve );
+		LCD_WriteReg( 0x0020, hs );
+		LCD_WriteReg( 0x0021, vs );
+	}
+	LCD_WriteIndex( 0x0022 );
+	return entry;
+}
+
+/******************************************************************************
+* Function Name  : LCD_CloseWindow
+* Description    : Full screen window and the old entry mode back
+* Input          : - entry: value returned by LCD_OpenWindow
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_CloseWindow(uint16_t entry)
+{
+	if( LCD_Code == SSD1289 || LCD_Code == SSD1298 )
+	{
+		LCD_WriteReg( 0x0044, 0xEF00 );
+		LCD_WriteReg( 0x0045, 0x0000 );
+		LCD_WriteReg( 0x0046, 0x013F );
+		LCD_WriteReg( 0x0011, entry );
+	}
+	else
+	{
+		LCD_WriteReg( 0x0050, 0x0000 );
+		LCD_WriteReg( 0x0051, 0x00EF );
+		LCD_WriteReg( 0x0052, 0x0000 );
+		LCD_WriteReg( 0x0053, 0x013F );
+		LCD_WriteReg( 0x0003, entry );
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_GetRect
+* Description    : Read a rectangle back with one 0x22 read sequence
+* Input          : - x0, y0: top left corner
+*                  - x1, y1: bottom right corner
+*                  - buf: (x1-x0+1)*(y1-y0+1) pixels, row by row
+* Output         : None
+* Return         : None
+* Attention		 : Controllers without a GRAM window (HX834x, SSD2119) are read
+*                  point by point. The entry mode is set to ID=11 AM=0 for the
+*                  read and restored afterwards
+*******************************************************************************/
+void LCD_GetRect(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1,uint16_t *buf)
+{
+	uint16_t w = x1 - x0 + 1, h = y1 - y0 + 1;
+	uint16_t row, col, v, entry;
+	uint32_t n, k;
+	int bgr;
+
+	switch( LCD_Code )
+	{
+		case HX8346A:
+		case HX8347A:
+		case HX8347D:
+		case SSD2119:
+			for( row = 0; row < h; row++ )
+				for( col = 0; col < w; col++ )
+					*buf++ = LCD_GetPoint( x0 + col, y0 + row );
+			return;
+		case ST7781:
+		case LGDP4531:
+		case LGDP4535:
+		case SSD1289:
+		case SSD1298:
+			bgr = 0;
+			break;
+		default:
+			bgr = 1;
+			break;
+	}
+
+	entry = LCD_OpenWindow( x0, y0, x1, y1 );
+
+	LCD_STAT_ADD( WordsRead, (uint32_t)w * h + 1 );
+	LCD_STAT_ADD( CsCycles, 1 );
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_WR(1);
+	LPC_GPIO0->FIODIR &= (~(0xff<<15));  
+	LPC_GPIO0->FIODIR &= (~(0xff<<4));
+	LCD_RD(0);			/* empty read */
+	wait_delay(LCD_RdWait);
+	LCD_RD(1);
+	n = (uint32_t)w * h;
+	for( k = 0; k < n; k++ )
+	{
+		LCD_RD(0);
+		wait_delay(LCD_RdWait);
+		v = ( ( ( LPC_GPIO0->FIOPIN >> 15 ) & 0xFF ) << 8 ) | ( ( LPC_GPIO0->FIOPIN >> 4 ) & 0xFF );
+		LCD_RD(1);
+		if( bgr )
+		{
+			v = LCD_BGR2RGB( v );
+		}
+		#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+		row = k % h;  col = k / h;
+		buf[ (uint32_t)row * w + ( w - 1 - col ) ] = v;
+		#else
+		buf[k] = v;
+		#endif
+	}
+	LPC_GPIO0->FIODIR |= (0xff<<15);
+	LPC_GPIO0->FIODIR |= (0xff<<4);
+	LCD_CS(1);
+
+	LCD_CloseWindow( entry );
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillWindow
+* Description    : Fill a rectangle with one color through a GRAM window
+* Input          : - x0, y0: top left corner
+*                  - x1, y1: bottom right corner
+*                  - Color: pixel value, written as it is
+* Output         : None
+* Return         : 0 done, -1 controller without window (SSD2119), not filled
+* Attention		 : The color is put on the data lines once, then every pixel
+*                  is only a WR strobe (8 per loop, WR high held 3 nops)
+*******************************************************************************/
+#define LCD_REPEAT_PIXEL()	{ LCD_WR_STROBE(); __nop(); __nop(); __nop(); }
+
+int LCD_FillWindow(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1,uint16_t Color)
+{
+	uint16_t entry = 0;
+	uint32_t n, v;
+
+	switch( LCD_Code )
+	{
+		case SSD2119:
+			return -1;
+		case HX8346A:
+		case HX8347A:
+		case HX8347D:
+			#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+			LCD_WriteReg( 0x02, y0 >> 8 );  LCD_WriteReg( 0x03, y0 );
+			LCD_WriteReg( 0x04, y1 >> 8 );  LCD_WriteReg( 0x05, y1 );
+			LCD_WriteReg( 0x06, ( ( MAX_X - 1 ) - x1 ) >> 8 );  LCD_WriteReg( 0x07, ( MAX_X - 1 ) - x1 );
+			LCD_WriteReg( 0x08, ( ( MAX_X - 1 ) - x0 ) >> 8 );  LCD_WriteReg( 0x09, ( MAX_X - 1 ) - x0 );
+			#else
+			LCD_WriteReg( 0x02, x0 >> 8 );  LCD_WriteReg( 0x03, x0 );
+			LCD_WriteReg( 0x04, x1 >> 8 );  LCD_WriteReg( 0x05, x1 );
+			LCD_WriteReg( 0x06, y0 >> 8 );  LCD_WriteReg( 0x07, y0 );
+			LCD_WriteReg( 0x08, y1 >> 8 );  LCD_WriteReg( 0x09, y1 );
+			#endif
+			LCD_WriteIndex( 0x0022 );
+			break;
+		default:
+			entry = LCD_OpenWindow( x0, y0, x1, y1 );
+			break;
+	}
+
+	n = (uint32_t)( x1 - x0 + 1 ) * ( y1 - y0 + 1 );
+	v = ( (uint32_t)( Color >> 8 ) << 15 ) | ( (uint32_t)( Color & 0xff ) << 4 );
+	LCD_STAT_ADD( WordsWritten, n );
+	LCD_STAT_ADD( CsCycles, 1 );
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_RD(1);
+	LPC_GPIO0->FIODIR |= LCD_DATA_PINS;
+	LPC_GPIO0->FIOSET = v;
+	LPC_GPIO0->FIOCLR = v ^ LCD_DATA_PINS;
+	while( n >= 8 )
+	{
+		LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL();
+		LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL(); LCD_REPEAT_PIXEL();
+		n -= 8;
+	}
+	while( n-- > 0 )
+	{
+		LCD_REPEAT_PIXEL();
+	}
+	LCD_CS(1);
+
+	switch( LCD_Code )
+	{
+		case HX8346A:
+		case HX8347A:
+		case HX8347D:
+			LCD_WriteReg( 0x02, 0x00 );  LCD_WriteReg( 0x03, 0x00 );
+			LCD_WriteReg( 0x04, 0x00 );  LCD_WriteReg( 0x05, 0xEF );
+			LCD_WriteReg( 0x06, 0x00 );  LCD_WriteReg( 0x07, 0x00 );
+			LCD_WriteReg( 0x08, 0x01 );  LCD_WriteReg( 0x09, 0x3F );
+			break;
+		default:
+			LCD_CloseWindow( entry );
+			break;
+	}
+	return 0;
+}
+
 /******************************************************************************
 * Function Name  : LCD_SetPoint
 * Description    : ָ껭
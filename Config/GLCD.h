@@ -25,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "LPC17xx.h"
+#include "LCD_Timing.h"
 
 /* Private define ------------------------------------------------------------*/
 
@@ -49,6 +50,11 @@
 /* Private define ------------------------------------------------------------*/
 #define DISP_ORIENTATION  90  /* angle 0 90 */ 
 
+/* Entry mode (R11) of SSD1289 / SSD1298 while emWin draws. LCDConf.c hands it
+   to FlexColor as RegEntryMode, LCD_FillWindow and LCD_GetRect restore it
+   after their GRAM window */
+#define LCD_ENTRY_MODE    0x6870
+
 #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
 
 #define  MAX_X  320
@@ -92,6 +98,12 @@
 void LCD_Initializtion(void);
 void LCD_Clear(uint16_t Color);
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
+void LCD_GetRect(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1,uint16_t *buf);
+int LCD_FillWindow(uint16_t x0,uint16_t y0,uint16_t x1,uint16_t y1,uint16_t Color);
+void LCD_WriteIndex(uint16_t index);
+void LCD_WriteData(uint16_t data);
+void LCD_WriteDataMultiple(uint16_t *pData, int NumItems);
+void LCD_ReadDataMultiple(uint16_t *pData, int NumItems);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color );
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor );
@@ -30,7 +30,12 @@ Purpose     : Display controller initialization
 ---------------------------END-OF-HEADER------------------------------
 */
 
+#include <string.h>
 #include "GUI.h"
+#include "GUI_Private.h"
+#include "WM.h"
+#include "GUI_Heap.h"
+#include "AHB_SRAM.h"
 
 /*********************************************************************
 *
@@ -39,13 +44,42 @@ Purpose     : Display controller initialization
 **********************************************************************
 */
 //
-// Define the available number of bytes available for the GUI
+// Heap placement. GUI_HEAP_AHB 1 (AHB_SRAM.h) puts the heap at
+// GUI_HEAP_ADDR in the AHB SRAM banks (IRAM2 of the target). By default
+// it takes all the space AHB_SRAM.h leaves between the AF_LCD strip
+// framebuffer (if AF_LCD_FB) and the SPI DMA buffers of LCD_X_SPI.c,
+// 30 KB without the framebuffer.
+// GUI_HEAP_AHB 0 keeps the heap in the CPU SRAM with the other data.
 //
-#define GUI_NUMBYTES  ( 1024) * 16  // x MByte
+#if GUI_HEAP_AHB
+  #ifndef   GUI_NUMBYTES
+    #define GUI_NUMBYTES  GUI_HEAP_AHB_SIZE
+  #endif
+  #if (GUI_NUMBYTES > GUI_HEAP_AHB_SIZE) || (GUI_HEAP_ADDR & 3)
+    #error emWin heap does not fit between the AHB SRAM buffers of AHB_SRAM.h
+  #endif
+#else
+  #ifndef   GUI_NUMBYTES
+    #define GUI_NUMBYTES  ((1024) * 16)
+  #endif
+#endif
 //
 // Define the average block size
 //
 #define GUI_BLOCKSIZE 0x80
+//
+// Windows created with WM_CF_MEMDEV are drawn through memory devices in
+// bands. One band may take GUI_MEMDEV_PERCENT of the heap (emWin: 90),
+// the rest is left for the windows and widgets created while a band is
+// allocated. GUI_MEMDEV_MIN_LINES is the band height (320 pixels, 16bpp)
+// that has to fit, less is counted as NumBandShort in the telemetry.
+//
+#define GUI_MEMDEV_PERCENT    75
+#define GUI_MEMDEV_MIN_LINES  16
+
+#if GUI_NUMBYTES / 100 * GUI_MEMDEV_PERCENT < 320 * 2 * GUI_MEMDEV_MIN_LINES
+  #error GUI_MEMDEV_MIN_LINES does not fit into GUI_MEMDEV_PERCENT of the heap
+#endif
 
 /*********************************************************************
 *
@@ -57,12 +91,22 @@ Purpose     : Display controller initialization
 //
 // 32 bit aligned memory area
 //
-#ifdef __ICCARM__
-  #pragma location="GUI_RAM"
-  static __no_init U32 _aMemory[GUI_NUMBYTES / 4];
-#endif
-#ifdef __CC_ARM
-  U32 static _aMemory[GUI_NUMBYTES / 4] __attribute__ ((section ("GUI_RAM"), zero_init));
+#if GUI_HEAP_AHB
+  #ifdef __ICCARM__
+    #pragma location=GUI_HEAP_ADDR
+    static __no_init U32 _aMemory[GUI_NUMBYTES / 4];
+  #endif
+  #ifdef __CC_ARM
+    U32 static _aMemory[GUI_NUMBYTES / 4] __attribute__ ((at (GUI_HEAP_ADDR), zero_init));
+  #endif
+#else
+  #ifdef __ICCARM__
+    #pragma location="GUI_RAM"
+    static __no_init U32 _aMemory[GUI_NUMBYTES / 4];
+  #endif
+  #ifdef __CC_ARM
+    U32 static _aMemory[GUI_NUMBYTES / 4] __attribute__ ((section ("GUI_RAM"), zero_init));
+  #endif
 #endif
 #ifdef __GNUC__
 //  U32 static _aMemory[GUI_NUMBYTES / 4] __attribute__ ((section(".GUI_RAM"))) = { 0 };
@@ -71,6 +115,69 @@ Purpose     : Display controller initialization
   static U32 _aMemory[GUI_NUMBYTES / 4];
 #endif
 
+static GUI_HEAP_STAT _Stat;
+
+/*********************************************************************
+*
+*       Static code
+*
+**********************************************************************
+*/
+/*********************************************************************
+*
+*       _Sample
+*/
+static void _Sample(void) {
+  U32 Used;
+  U32 Free;
+  U32 Max;
+
+  Used = GUI_ALLOC_GetNumUsedBytes();
+  Free = GUI_ALLOC_GetNumFreeBytes();
+  Max  = GUI_ALLOC_GetMaxSize();
+  _Stat.UsedBytes     = Used;
+  _Stat.FreeBytes     = Free;
+  _Stat.MaxFreeBlock  = Max;
+  _Stat.NumFreeBlocks = GUI_ALLOC_GetNumFreeBlocks();
+  _Stat.Frag          = Free ? 100 - Max * 100 / Free : 0;
+  if (Used > _Stat.UsedBytesMax) {
+    _Stat.UsedBytesMax = Used;
+  }
+  if (Max < _Stat.MaxFreeBlockMin) {
+    _Stat.MaxFreeBlockMin = Max;
+  }
+  if (_Stat.Frag > _Stat.FragMax) {
+    _Stat.FragMax = _Stat.Frag;
+  }
+}
+
+#ifdef __CC_ARM
+
+/*********************************************************************
+*
+*       $Sub$$GUI_ALLOC_AllocNoInit
+*
+* Purpose:
+*   armlink calls this in place of GUI_ALLOC_AllocNoInit. It only counts
+*   the requests and the failed ones, see GUI_Heap.h.
+*/
+GUI_HMEM $Super$$GUI_ALLOC_AllocNoInit(GUI_ALLOC_DATATYPE Size);
+
+GUI_HMEM $Sub$$GUI_ALLOC_AllocNoInit(GUI_ALLOC_DATATYPE Size) {
+  GUI_HMEM hMem;
+
+  GUI_LOCK();
+  hMem = $Super$$GUI_ALLOC_AllocNoInit(Size);
+  _Stat.NumAlloc++;
+  if (hMem == 0) {
+    _Stat.NumAllocFail++;
+  }
+  GUI_UNLOCK();
+  return hMem;
+}
+
+#endif
+
 /*********************************************************************
 *
 *       Public code
@@ -89,9 +196,65 @@ void GUI_X_Config(void) {
   //
   // Assign memory to emWin
   //
-	static U32 aMemory[GUI_NUMBYTES / 4];
   GUI_ALLOC_AssignMemory(_aMemory, GUI_NUMBYTES);
   GUI_ALLOC_SetAvBlockSize(GUI_BLOCKSIZE);
+  GUI_ALLOC_SetMaxPercentage(GUI_MEMDEV_PERCENT);
+  GUI_Heap_Reset();
+}
+
+/*********************************************************************
+*
+*       GUI_Heap_Reset
+*/
+void GUI_Heap_Reset(void) {
+  memset(&_Stat, 0, sizeof(_Stat));
+  _Stat.NumBytes        = GUI_NUMBYTES;
+  _Stat.MaxFreeBlockMin = GUI_NUMBYTES;
+#ifndef __CC_ARM
+  _Stat.NumAlloc        = GUI_HEAP_NA;
+  _Stat.NumAllocFail    = GUI_HEAP_NA;
+#endif
+}
+
+/*********************************************************************
+*
+*       GUI_Heap_Get
+*/
+void GUI_Heap_Get(GUI_HEAP_STAT * p) {
+  GUI_LOCK();
+  _Sample();
+  *p = _Stat;
+  GUI_UNLOCK();
+}
+
+/*********************************************************************
+*
+*       GUI_Heap_Paint
+*
+* Purpose:
+*   Samples the heap around the paint cycle. The band check is done
+*   before anything is drawn, GUI_ALLOC_RequestSize is what a memory
+*   device may get at that time.
+*/
+void GUI_Heap_Paint(int MsgId) {
+  switch (MsgId) {
+  case WM_PRE_PAINT:
+    _Sample();
+    if ((U32)GUI_ALLOC_RequestSize() < (U32)LCD_GetXSize() * 2 * GUI_MEMDEV_MIN_LINES) {
+      _Stat.NumBandShort++;
+    }
+    break;
+  case WM_PAINT:
+    _Sample();
+    _Stat.NumPaint++;
+    if (GUI_pContext->hDevData == 0) {
+      _Stat.NumPaintDirect++;
+    }
+    break;
+  case WM_POST_PAINT:
+    _Sample();
+    break;
+  }
 }
 
 /*************************** End of file ****************************/
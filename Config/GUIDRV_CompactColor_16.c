@@ -134,13 +134,23 @@ extern void LCD_X_ReadM01_16 (U16 * pData, int NumWords);
 #ifndef   LCD_INIT_CONTROLLER
   #define LCD_INIT_CONTROLLER()
 #endif
+#ifndef   LCD_CACHE_BAND_LINES
+  #define LCD_CACHE_BAND_LINES 0      /* Logical lines per cache band, 0: cache holds the whole frame */
+#endif
+#ifndef   LCD_CACHE_NUM_BANDS
+  #define LCD_CACHE_NUM_BANDS  4      /* Number of bands kept in RAM */
+#endif
+#ifndef   LCD_CACHE_MAX_LINES
+  #define LCD_CACHE_MAX_LINES  320    /* Max. number of logical lines, sizes the band table */
+#endif
 #ifndef   LCD_CACHE
   #define LCD_CACHE           0
 #else
-  #if (LCD_SWAP_XY)
+  #if (LCD_CACHE) && (LCD_SWAP_XY) && (LCD_CACHE_BAND_LINES == 0)
     #error Cache can only be used without swapping mode!
   #endif
 #endif
+#define CACHE_BANDED (LCD_CACHE && LCD_CACHE_BAND_LINES)
 #ifndef   LCD_SET_ORG
   #define LCD_SET_ORG(x, y) GUI_USE_PARA(x); GUI_USE_PARA(y)
 #endif
@@ -616,6 +626,47 @@ extern void LCD_X_ReadM01_16 (U16 * pData, int NumWords);
   #define RAM_ADDR_SET 1
 #endif
 
+/*********************************************************************
+*
+*       Banded cache
+*
+*   Only LCD_CACHE_NUM_BANDS bands of LCD_CACHE_BAND_LINES logical
+*   lines are kept in RAM. With LCD_SWAP_XY a band is a range of
+*   physical columns, so drawing along a logical line stays in one
+*   band. A band is read back from the controller (one burst) when it
+*   is used for the first time, the least recently used band is
+*   written back and dropped if no slot is free.
+*   Modified pixels are tracked per band as a rectangle, which is sent
+*   as one window in physical order: the entry mode is set to the
+*   default orientation for the transfer, so mirroring and swapping
+*   does not need any per pixel handling.
+*/
+#if CACHE_BANDED
+  #if !LCD_USE_PARALLEL_16 ||      \
+      ((LCD_CONTROLLER != 66701) && \
+       (LCD_CONTROLLER != 66702) && \
+       (LCD_CONTROLLER != 66703) && \
+       (LCD_CONTROLLER != 66708))
+    #error Banded cache is only supported for 66701, 66702, 66703 and 66708 with 16 bit parallel interface!
+  #endif
+  #define CACHE_MAX_BANDS ((LCD_CACHE_MAX_LINES + LCD_CACHE_BAND_LINES - 1) / LCD_CACHE_BAND_LINES)
+  #if LCD_SWAP_XY
+    #define BAND_OF(x, y) ((x) / LCD_CACHE_BAND_LINES)
+    #define BAND_X0(Band) ((Band) * LCD_CACHE_BAND_LINES)
+    #define BAND_Y0(Band) 0
+    #define BAND_STRIDE   LCD_CACHE_BAND_LINES
+  #else
+    #define BAND_OF(x, y) ((y) / LCD_CACHE_BAND_LINES)
+    #define BAND_X0(Band) 0
+    #define BAND_Y0(Band) ((Band) * LCD_CACHE_BAND_LINES)
+    #define BAND_STRIDE   _xSizeCache
+  #endif
+  #define BAND_ADDR(Slot, Band, x, y) ((U32)(Slot) * _SlotSize + ((y) - BAND_Y0(Band)) * BAND_STRIDE + (x) - BAND_X0(Band))
+  #define MARK_DIRTY()    _MarkDirty()
+#else
+  #define MARK_DIRTY()
+#endif
+
 /*********************************************************************
 *
 *       Macros for MIRROR_, SWAP_ and LUT_
@@ -819,6 +870,17 @@ extern void LCD_X_ReadM01_16 (U16 * pData, int NumWords);
   static U16 IndexMask;
 #endif
 
+#if CACHE_BANDED
+  static I16      _aBandSlot [CACHE_MAX_BANDS];      /* Slot of each band, -1 if not in RAM */
+  static I16      _aSlotBand [LCD_CACHE_NUM_BANDS];  /* Band in each slot, -1 if free       */
+  static U32      _aSlotUse  [LCD_CACHE_NUM_BANDS];  /* Last use, for LRU replacement       */
+  static GUI_RECT _aSlotDirty[LCD_CACHE_NUM_BANDS];  /* Modified area, empty if x0 > x1     */
+  static int      _Band, _Slot;                      /* Band of _yPos and its slot          */
+  static U32      _UseCnt;
+  static int      _xSizeCache, _ySizeCache;          /* Physical size of the display        */
+  static U32      _SlotSize;                         /* Pixels per slot                     */
+#endif
+
 #if LCD_WRITE_BUFFER_SIZE
 
   #if LCD_USE_PARALLEL_16
@@ -962,8 +1024,7 @@ static U16 _ReadU16_A1(void) {
 	
   #if LCD_USE_PARALLEL_16
     U16 Word[1 + LCD_NUM_DUMMY_READS];
-    //READM_A1(Word, 1 + LCD_NUM_DUMMY_READS);  // zamieniono linia nizej - nie wiadomo czemu nie dziala.
-	  LCD_X_ReadM01_16(Word, 1 + LCD_NUM_DUMMY_READS);
+    READM_A1(Word, 1 + LCD_NUM_DUMMY_READS);
     return Word[LCD_NUM_DUMMY_READS];
   #else
     U16 Data;
@@ -1309,6 +1370,231 @@ static U16 _ReadU16_A1(void) {
 }
 #endif
 
+#if CACHE_BANDED
+
+/*********************************************************************
+*
+*       _SetIncMode
+*/
+static void _SetIncMode(U16 IncModeLB) {
+  #if (INC_MODE_LB != __XX____)
+    _WriteU16_A0(REG_INC_MODE);
+    _WriteU16_A1((INC_MODE_HB << 8) | IncModeLB);
+  #else
+    GUI_USE_PARA(IncModeLB);
+  #endif
+}
+
+/*********************************************************************
+*
+*       _SetPhysWindow
+*
+* Purpose:
+*   Sets the window in physical coordinates and the address to its
+*   top left pixel. Used with the default entry mode (__XX____).
+*/
+static void _SetPhysWindow(int x0, int y0, int x1, int y1) {
+  #if   (LCD_CONTROLLER == 66701) || /* Renesas R63401, R61509, OriseTech SPFD5420A */ \
+        (LCD_CONTROLLER == 66703) || /* Toshiba JBT6K71 */ \
+        (LCD_CONTROLLER == 66708)    /* Ilitek ILI9320, Ilitek ILI9325, LG Electronics LGDP4531, OriseTech SPFD5408 */
+    _WriteU16_A0(REG_SET_HRAM_S);
+    _WriteU16_A1(x0 + LCD_FIRSTSEG0);
+    _WriteU16_A0(REG_SET_HRAM_E);
+    _WriteU16_A1(x1 + LCD_FIRSTSEG0);
+  #elif (LCD_CONTROLLER == 66702)    /* Solomon SSD1289, Solomon SSD2119, Solomon SSD1298 */
+    _WriteU16_A0(REG_SET_HRAM_POS);
+    _WriteU16_A1(((x1 + LCD_FIRSTSEG0) << 8) | (x0 + LCD_FIRSTSEG0));
+  #endif
+  _WriteU16_A0(REG_SET_VRAM_S);
+  _WriteU16_A1(y0 + LCD_FIRSTCOM0);
+  _WriteU16_A0(REG_SET_VRAM_E);
+  _WriteU16_A1(y1 + LCD_FIRSTCOM0);
+  _WriteU16_A0(REG_RAM_ADDR_H);
+  _WriteU16_A1(x0 + LCD_FIRSTSEG0);
+  _WriteU16_A0(REG_RAM_ADDR_V);
+  _WriteU16_A1(y0 + LCD_FIRSTCOM0);
+  _WriteU16_A0(REG_RAM_ACCESS);
+}
+
+/*********************************************************************
+*
+*       _FlushSlot
+*
+* Purpose:
+*   Sends the modified area of the given slot. The default entry mode
+*   needs to be set by the caller.
+*/
+static void _FlushSlot(int Slot) {
+  GUI_RECT * pRect;
+  U16 * pData;
+  int xSize, Band, y;
+
+  pRect = &_aSlotDirty[Slot];
+  if (pRect->x0 > pRect->x1) {
+    return;
+  }
+  Band = _aSlotBand[Slot];
+  _SetPhysWindow(pRect->x0, pRect->y0, pRect->x1, pRect->y1);
+  xSize = pRect->x1 - pRect->x0 + 1;
+  pData = _pVRam + BAND_ADDR(Slot, Band, pRect->x0, pRect->y0);
+  if (xSize == BAND_STRIDE) {
+    WRITEM_A1(pData, xSize * (pRect->y1 - pRect->y0 + 1));
+  } else {
+    for (y = pRect->y0; y <= pRect->y1; y++, pData += BAND_STRIDE) {
+      WRITEM_A1(pData, xSize);
+    }
+  }
+  pRect->x0 = pRect->y0 = 0x7FFF;
+  pRect->x1 = pRect->y1 = -1;
+}
+
+/*********************************************************************
+*
+*       _FlushBands
+*/
+static void _FlushBands(void) {
+  int Slot;
+
+  for (Slot = 0; Slot < LCD_CACHE_NUM_BANDS; Slot++) {
+    if (_aSlotDirty[Slot].x0 <= _aSlotDirty[Slot].x1) {
+      break;
+    }
+  }
+  if (Slot == LCD_CACHE_NUM_BANDS) {
+    return;
+  }
+  _SetIncMode(__XX____);
+  for (; Slot < LCD_CACHE_NUM_BANDS; Slot++) {
+    _FlushSlot(Slot);
+  }
+  _SetIncMode(INC_MODE_LB);
+}
+
+/*********************************************************************
+*
+*       _ReadBlock
+*
+* Purpose:
+*   Reads the physical window x0..x1, y0..y1 in one burst, its lines
+*   are stored back to back at pData. The dummy words land in front
+*   of pData, the words they overwrite are restored.
+*/
+static void _ReadBlock(U16 * pData, int x0, int y0, int x1, int y1) {
+  U16 aSave[LCD_NUM_DUMMY_READS + 1];
+  int i;
+
+  _SetPhysWindow(x0, y0, x1, y1);
+  pData -= LCD_NUM_DUMMY_READS;
+  for (i = 0; i < LCD_NUM_DUMMY_READS; i++) {
+    aSave[i] = pData[i];
+  }
+  READM_A1(pData, LCD_NUM_DUMMY_READS + (x1 - x0 + 1) * (y1 - y0 + 1));
+  for (i = 0; i < LCD_NUM_DUMMY_READS; i++) {
+    pData[i] = aSave[i];
+  }
+}
+
+/*********************************************************************
+*
+*       _LoadBand
+*
+* Purpose:
+*   Brings the given band into a slot: a free one or the least
+*   recently used one, which is written back first. The band is read
+*   from the controller in one burst, or line by line if it is the
+*   last, narrower band of the display.
+*/
+static int _LoadBand(int Band) {
+  U16 * pData;
+  int Slot, i, x0, y0, x1, y1, y;
+
+  Slot = 0;
+  for (i = 0; i < LCD_CACHE_NUM_BANDS; i++) {
+    if (_aSlotBand[i] < 0) {
+      Slot = i;
+      break;
+    }
+    if (_aSlotUse[i] < _aSlotUse[Slot]) {
+      Slot = i;
+    }
+  }
+  _SetIncMode(__XX____);
+  if (_aSlotBand[Slot] >= 0) {
+    _FlushSlot(Slot);
+    _aBandSlot[_aSlotBand[Slot]] = -1;
+  }
+  x0 = BAND_X0(Band);
+  y0 = BAND_Y0(Band);
+  #if LCD_SWAP_XY
+    x1 = x0 + LCD_CACHE_BAND_LINES - 1;
+    y1 = _ySizeCache - 1;
+    if (x1 >= _xSizeCache) {
+      x1 = _xSizeCache - 1;
+    }
+  #else
+    x1 = _xSizeCache - 1;
+    y1 = y0 + LCD_CACHE_BAND_LINES - 1;
+    if (y1 >= _ySizeCache) {
+      y1 = _ySizeCache - 1;
+    }
+  #endif
+  pData = _pVRam + BAND_ADDR(Slot, Band, x0, y0);
+  if (x1 - x0 + 1 == BAND_STRIDE) {
+    _ReadBlock(pData, x0, y0, x1, y1);
+  } else {
+    for (y = y0; y <= y1; y++, pData += BAND_STRIDE) {
+      _ReadBlock(pData, x0, y, x1, y);
+    }
+  }
+  _SetIncMode(INC_MODE_LB);
+  _aSlotBand[Slot] = Band;
+  _aBandSlot[Band] = Slot;
+  return Slot;
+}
+
+/*********************************************************************
+*
+*       _MarkDirty
+*/
+static void _MarkDirty(void) {
+  GUI_RECT * pRect;
+
+  pRect = &_aSlotDirty[_Slot];
+  if (_xPos < pRect->x0) {
+    pRect->x0 = _xPos;
+  }
+  if (_xPos > pRect->x1) {
+    pRect->x1 = _xPos;
+  }
+  if (_yPos < pRect->y0) {
+    pRect->y0 = _yPos;
+  }
+  if (_yPos > pRect->y1) {
+    pRect->y1 = _yPos;
+  }
+}
+
+/*********************************************************************
+*
+*       _InitBands
+*/
+static void _InitBands(void) {
+  int i;
+
+  for (i = 0; i < CACHE_MAX_BANDS; i++) {
+    _aBandSlot[i] = -1;
+  }
+  for (i = 0; i < LCD_CACHE_NUM_BANDS; i++) {
+    _aSlotBand[i] = -1;
+    _aSlotUse[i]  = 0;
+    _aSlotDirty[i].x0 = _aSlotDirty[i].y0 = 0x7FFF;
+    _aSlotDirty[i].x1 = _aSlotDirty[i].y1 = -1;
+  }
+  _Band   = -1;
+  _UseCnt = 0;
+}
+#endif /* CACHE_BANDED */
+
 #if LCD_CACHE
 
 /*********************************************************************
@@ -1316,7 +1602,19 @@ static U16 _ReadU16_A1(void) {
 *       _CalcCacheAddr
 */
 static void _CalcCacheAddr(void) {
-  #if   (CACHE_OFFSET == 256)
+  #if CACHE_BANDED
+    int Band;
+    Band = BAND_OF(_xPos, _yPos);
+    if (Band != _Band) {
+      _Band = Band;
+      _Slot = _aBandSlot[Band];
+      if (_Slot < 0) {
+        _Slot = _LoadBand(Band);
+      }
+      _aSlotUse[_Slot] = ++_UseCnt;
+    }
+    _Addr = BAND_ADDR(_Slot, Band, _xPos, _yPos);
+  #elif (CACHE_OFFSET == 256)
     _Addr = (_yPos << 8) + _xPos;                /* Avoid multiplication */
   #elif (CACHE_OFFSET == 132)
     _Addr = (_yPos << 7) + (_yPos << 2) + _xPos; /* Avoid multiplication */
@@ -1467,6 +1765,7 @@ static void _WriteData(unsigned PixelIndex) {
     #else
       *(_pVRam + _Addr) = (PixelIndex >> 8) | (PixelIndex << 8);
     #endif
+    MARK_DIRTY();
     _IncrementCursor();
   #else
     #if LCD_USE_PARALLEL_16
@@ -1497,6 +1796,7 @@ static void _WriteDataM(unsigned PixelIndex, U32 NumPixels) {
     #endif
     while (NumPixels--) {
       *(_pVRam + _Addr) = Value;
+      MARK_DIRTY();
       _IncrementCursor();
     }
   #else
@@ -1567,6 +1867,7 @@ static void _WriteDataMP(U16 * pData, int NumPixels) {
         PixelIndex = (PixelIndex >> 8) | (PixelIndex << 8);
       #endif
       *(_pVRam + _Addr) = PixelIndex;
+      MARK_DIRTY();
       _IncrementCursor();
     }
   #else
@@ -1627,22 +1928,14 @@ static void _SetCacheAddr(int x, int y) {
 *       _CalcCacheEdge
 */
 static void _CalcCacheEdge(void) {
-  #if   (!LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
+  #if   (!LCD_MIRROR_X && !LCD_MIRROR_Y)
     _SetCacheAddr(_x0, _y0);
-  #elif ( LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
+  #elif ( LCD_MIRROR_X && !LCD_MIRROR_Y)
     _SetCacheAddr(_x1, _y0);
-  #elif (!LCD_MIRROR_X &&  LCD_MIRROR_Y && !LCD_SWAP_XY)
+  #elif (!LCD_MIRROR_X &&  LCD_MIRROR_Y)
     _SetCacheAddr(_x0, _y1);
-  #elif ( LCD_MIRROR_X &&  LCD_MIRROR_Y && !LCD_SWAP_XY)
+  #else
     _SetCacheAddr(_x1, _y1);
-  #elif (!LCD_MIRROR_X && !LCD_MIRROR_Y &&  LCD_SWAP_XY)
-    _SetCacheAddr(_y0, _x0);
-  #elif ( LCD_MIRROR_X && !LCD_MIRROR_Y &&  LCD_SWAP_XY)
-    _SetCacheAddr(_y0, _x1);
-  #elif (!LCD_MIRROR_X &&  LCD_MIRROR_Y &&  LCD_SWAP_XY)
-    _SetCacheAddr(_y1, _x0);
-  #elif (!LCD_MIRROR_X && !LCD_MIRROR_Y &&  LCD_SWAP_XY)
-    _SetCacheAddr(_y1, _x1);
   #endif
 }
 
@@ -2334,7 +2627,7 @@ static void _SetRect(int x0, int y0, int x1, int y1) {
 *       _ManageRect
 */
 static void _ManageRect(int Cmd) {
-  static int HasPushed, x0, y0, x1, y1, Addr;
+  static int HasPushed, x0, y0, x1, y1, xPos, yPos;
   switch (Cmd) {
   case PUSH_RECT:
     if (HasPushed == 0) {
@@ -2343,7 +2636,8 @@ static void _ManageRect(int Cmd) {
       y0   = _y0;
       x1   = _x1;
       y1   = _y1;
-      Addr = _Addr;
+      xPos = _xPos;
+      yPos = _yPos;
     }
     break;
   case POP_RECT:
@@ -2353,7 +2647,9 @@ static void _ManageRect(int Cmd) {
       _y0   = y0;
       _x1   = x1;
       _y1   = y1;
-      _Addr = Addr;
+      _xPos = xPos;
+      _yPos = yPos;
+      _CalcCacheAddr();  /* With bands the slot may have changed meanwhile */
     }
     break;
   }
@@ -2409,7 +2705,15 @@ static unsigned int _ReadCache(int x, int y) {
 */
 #if LCD_CACHE
 static void _SendCacheRect(void) {
-  #if (!LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
+  #if CACHE_BANDED
+    #if LCD_SUPPORT_CACHECONTROL
+      if (_CacheLocked) {
+        ADD_CACHE_RECT();
+        return;
+      }
+    #endif
+    _FlushBands();
+  #elif (!LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
     U16 * pCache;
     int NumBytes, y;
     #if LCD_SUPPORT_CACHECONTROL
@@ -2452,14 +2756,21 @@ static void _SendCacheRect(void) {
 */
 #if LCD_SUPPORT_CACHECONTROL
 static void _FlushCache(void) {
-  /*
-  * Set rectangle of modified area
-  */
-  _SetRect(_CacheRect.x0, _CacheRect.y0, _CacheRect.x1, _CacheRect.y1);
-  /*
-  * Send cache data
-  */
-  _SendCacheRect();
+  #if CACHE_BANDED
+    /*
+    * Send the modified area of each band
+    */
+    _FlushBands();
+  #else
+    /*
+    * Set rectangle of modified area
+    */
+    _SetRect(_CacheRect.x0, _CacheRect.y0, _CacheRect.x1, _CacheRect.y1);
+    /*
+    * Send cache data
+    */
+    _SendCacheRect();
+  #endif
   /*
   * Invalidate rectangle
   */
@@ -2481,7 +2792,7 @@ static void  _DrawBitLine1BPP(int x, int y, U8 const GUI_UNI_PTR *p, int Diff, i
   Index0 = *(pTrans + 0);
   Index1 = *(pTrans + 1);
   x += Diff;
-  switch (GUI_Context.DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
+  switch (GUI_pContext->DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
   case 0:
     do {
       _WriteData((*p & (0x80 >> Diff)) ? Index1 : Index0);
@@ -2543,7 +2854,7 @@ static void  _DrawBitLine2BPP(int x, int y, U8 const GUI_UNI_PTR * p, int Diff,
   Pixels = *p;
   CurrentPixel = Diff;
   x += Diff;
-  switch (GUI_Context.DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
+  switch (GUI_pContext->DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
   case 0:
     do {
       Shift = (3 - CurrentPixel) << 1;
@@ -2598,7 +2909,7 @@ static void  _DrawBitLine4BPP(int x, int y, U8 const GUI_UNI_PTR * p, int Diff,
   Pixels = *p;
   CurrentPixel = Diff;
   x += Diff;
-  switch (GUI_Context.DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
+  switch (GUI_pContext->DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
   case 0:
     do {
       Shift = (1 - CurrentPixel) << 2;
@@ -2650,7 +2961,7 @@ static void  _DrawBitLine8BPP(int x, int y, U8 const GUI_UNI_PTR * p, int xsize,
   if (pTrans == NULL) {
     return; /* Makes no sense */
   }
-  switch (GUI_Context.DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
+  switch (GUI_pContext->DrawMode & (LCD_DRAWMODE_TRANS | LCD_DRAWMODE_XOR)) {
   case 0:
     for (; xsize > 0; xsize--, p++) {
       Pixel = *p;
@@ -2684,7 +2995,7 @@ static void  _DrawBitLine8BPP(int x, int y, U8 const GUI_UNI_PTR * p, int xsize,
 #if (LCD_BITSPERPIXEL > 8)
 static void  DrawBitLine16BPP(int x, int y, U16 const GUI_UNI_PTR * p, int xsize) {
   LCD_PIXELINDEX pixel;
-  if ((GUI_Context.DrawMode & LCD_DRAWMODE_TRANS) == 0) {
+  if ((GUI_pContext->DrawMode & LCD_DRAWMODE_TRANS) == 0) {
     _WriteDataMP((U16 *)p, xsize);
   } else {
     for (; xsize > 0; xsize--, x++, p++) {
@@ -2740,12 +3051,13 @@ static void _NextPixel_WriteBuffer(int PixelIndex) {
 *
 *       _NextPixel_Start
 */
-static void _NextPixel_Start(int x0, int y0, int x1, int y1) {
+static int _NextPixel_Start(int x0, int y0, int x1, int y1) {
   _SetRect(x0, y0, x1, y1);
   #if LCD_WRITE_BUFFER_SIZE
     _pBuffer = _WriteBuffer;
     _NumPixelsInBuffer = 0;
   #endif
+  return 0;
 }
 
 /*********************************************************************
@@ -2843,21 +3155,30 @@ void LCD_L0_SetPixelIndex(int x, int y, int PixelIndex) {
     #define xPhys x
     #define yPhys y
   #endif
-  #if RAM_ADDR_SET
-    if ((xPhys < _x0) | (xPhys > _x1) | (yPhys < _y0) | (yPhys > _y1)) {
-      _SetRect(0, 0, LCD_XSIZE - 1, LCD_YSIZE - 1);
-    }
-    _SetPhysRAMAddr(xPhys, yPhys);
+  #if CACHE_BANDED
+    /* The band comes first, loading it may change the window */
     _SET_CACHE_ADDR(xPhys, yPhys);
-  #else
-    _SetPhysRAMAddr(xPhys, yPhys);
-    _SET_CACHE_ADDR(xPhys, yPhys);
-  #endif
-  #if LCD_CACHE
+    *(_pVRam + _Addr) = PixelIndex;
     ADD_CACHE_RECT();
+    _SetPhysWindow(xPhys, yPhys, xPhys, yPhys);
     _WriteU16_A1(PixelIndex);
+  #else
+    #if RAM_ADDR_SET
+      if ((xPhys < _x0) | (xPhys > _x1) | (yPhys < _y0) | (yPhys > _y1)) {
+        _SetRect(0, 0, LCD_XSIZE - 1, LCD_YSIZE - 1);
+      }
+      _SetPhysRAMAddr(xPhys, yPhys);
+      _SET_CACHE_ADDR(xPhys, yPhys);
+    #else
+      _SetPhysRAMAddr(xPhys, yPhys);
+      _SET_CACHE_ADDR(xPhys, yPhys);
+    #endif
+    #if LCD_CACHE
+      ADD_CACHE_RECT();
+      _WriteU16_A1(PixelIndex);
+    #endif
+    _WriteData(PixelIndex);
   #endif
-  _WriteData(PixelIndex);
 }
 
 /*********************************************************************
@@ -2880,9 +3201,11 @@ unsigned int LCD_L0_GetPixelIndex(int x, int y) {
       #define xPhys x
       #define yPhys y
     #endif
-    if ((xPhys < _x0) | (xPhys > _x1) | (yPhys < _y0) | (yPhys > _y1)) {
-      _SetRect(0, 0, LCD_XSIZE - 1, LCD_YSIZE - 1);
-    }
+    #if !CACHE_BANDED
+      if ((xPhys < _x0) | (xPhys > _x1) | (yPhys < _y0) | (yPhys > _y1)) {
+        _SetRect(0, 0, LCD_XSIZE - 1, LCD_YSIZE - 1);
+      }
+    #endif
     #if LCD_CACHE
       _SET_CACHE_ADDR(xPhys, yPhys);
     #else
@@ -2913,7 +3236,7 @@ void LCD_L0_XorPixel(int x, int y) {
 *       LCD_L0_DrawHLine
 */
 void LCD_L0_DrawHLine  (int x0, int y,  int x1) {
-  if (GUI_Context.DrawMode & LCD_DRAWMODE_XOR) {
+  if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR) {
     for (; x0 <= x1; x0++) {
       LCD_L0_XorPixel(x0, y);
     }
@@ -2927,7 +3250,7 @@ void LCD_L0_DrawHLine  (int x0, int y,  int x1) {
 *       LCD_L0_DrawVLine
 */
 void LCD_L0_DrawVLine  (int x, int y0,  int y1) {
-  if (GUI_Context.DrawMode & LCD_DRAWMODE_XOR) {
+  if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR) {
     for (; y0 <= y1; y0++) {
       LCD_L0_XorPixel(x, y0);
     }
@@ -2941,7 +3264,7 @@ void LCD_L0_DrawVLine  (int x, int y0,  int y1) {
 *       LCD_L0_FillRect
 */
 void LCD_L0_FillRect(int x0, int y0, int x1, int y1) {
-  if (GUI_Context.DrawMode & LCD_DRAWMODE_XOR) {
+  if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR) {
     #if LCD_CACHE
       U32 NumPixels;
       LCD_PIXELINDEX Mask;
@@ -2950,6 +3273,7 @@ void LCD_L0_FillRect(int x0, int y0, int x1, int y1) {
       NumPixels = (U32)(x1 - x0 + 1) * (U32)(y1 - y0 + 1);
       while (NumPixels--) {
         *(_pVRam + _Addr) ^= Mask;
+        MARK_DIRTY();
         _IncrementCursor();
       }
       _SendCacheRect();
@@ -3055,16 +3379,34 @@ int  LCD_L0_Init(void) {
     GUI_DEVICE * pDevice;
     U32 Addr;
 
-    pDevice   = GUI_DEVICE__GetpDriver(GUI_Context.SelLayer);
+    pDevice   = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
     IndexMask = pDevice->pColorConvAPI->pfGetIndexMask();
-    //
-    // Generate 16 bit aligned address for cache
-    //
-    Addr      = (U32)GUI_ALLOC_GetFixedBlock(CACHE_OFFSET * LCD_VYSIZE * 2 + 1) + 1;
-    if (Addr == 0) {
-      while (1); // Error: No memory for cache available!
-    }
-    Addr &= ~1;
+    #if CACHE_BANDED
+      //
+      // Bands of logical lines, dummy read words in front of the first one
+      //
+      _xSizeCache = LCD_SWAP_XY ? LCD_YSIZE : LCD_XSIZE;
+      _ySizeCache = LCD_SWAP_XY ? LCD_XSIZE : LCD_YSIZE;
+      if (LCD_YSIZE > LCD_CACHE_MAX_LINES) {
+        while (1); // Error: LCD_CACHE_MAX_LINES too small!
+      }
+      _SlotSize = (U32)LCD_CACHE_BAND_LINES * (LCD_SWAP_XY ? _ySizeCache : _xSizeCache);
+      Addr = (U32)GUI_ALLOC_GetFixedBlock((LCD_CACHE_NUM_BANDS * _SlotSize + LCD_NUM_DUMMY_READS) * 2 + 1) + 1;
+      if (Addr == 1) {
+        while (1); // Error: No memory for cache available!
+      }
+      Addr = (Addr & ~1) + LCD_NUM_DUMMY_READS * 2;
+      _InitBands();
+    #else
+      //
+      // Generate 16 bit aligned address for cache
+      //
+      Addr      = (U32)GUI_ALLOC_GetFixedBlock(CACHE_OFFSET * LCD_VYSIZE * 2 + 1) + 1;
+      if (Addr == 0) {
+        while (1); // Error: No memory for cache available!
+      }
+      Addr &= ~1;
+    #endif
     _pVRam = (U16 *)Addr;
   #endif
   LCD_X_DisplayDriver(LCD_DISPLAY_INDEX, LCD_X_INITCONTROLLER, NULL);
@@ -3115,17 +3457,17 @@ void LCD_L0_SetLUTEntry(U8 Pos, LCD_COLOR Color) {
 *
 *       LCD_L0_GetDevFunc
 */
-void * LCD_L0_GetDevFunc(int Index) {
+void (* LCD_L0_GetDevFunc(int Index))(void) {
   switch (Index) {
   case LCD_DEVFUNC_ISHW:
-    return (void *)1;
+    return (void (*)(void))1;
   #if (LCD_CONTROLLER == 66709) && (LCD_CACHE == 0) /* Novatek NT39122, Renesas R61516, Sitronix ST7628, Sitronix ST7637 */
   case LCD_DEVFUNC_READRECT:
-    return (void *)_ReadRect;
+    return (void (*)(void))_ReadRect;
   #endif
   #if (GUI_VERSION >= 41200)
   case LCD_DEVFUNC_NEXT_PIXEL:
-    return (void *)&_NextPixel_API;
+    return (void (*)(void))&_NextPixel_API;
   #endif
   }
   return NULL;
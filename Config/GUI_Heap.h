@@ -0,0 +1,69 @@
+/*********************************************************************
+*               arvin2009
+**                                 http://www.didbansanat.com
+----------------------------------------------------------------------
+File        : GUI_Heap.h
+Purpose     : emWin heap telemetry (GUIConf.c)
+----------------------------------------------------------------------
+
+  GUIConf.c places the emWin heap (AHB SRAM or CPU SRAM, GUI_HEAP_AHB)
+  and limits the memory device bands (GUI_MEMDEV_PERCENT). The values
+  here are sampled, not counted inside GUI_ALLOC: call GUI_Heap_Paint
+  (pMsg->MsgId) from the desktop callback, it samples at WM_PRE_PAINT,
+  WM_PAINT and WM_POST_PAINT. Any other window callback may call it on
+  WM_PAINT too, its paints are then counted as well.
+
+  A WM_PAINT with no memory device selected is a window of a WM_CF_MEMDEV
+  tree that was drawn directly, the memory device could not be allocated
+  (flicker, and the window is drawn once more by the next paint). This
+  count works with every tool chain.
+
+  NumAlloc / NumAllocFail are counted, not sampled: with ARMCC GUIConf.c
+  puts a $Sub$$ hook in front of GUI_ALLOC_AllocNoInit, which the memory
+  devices allocate with. The hook only counts, the block and its handle
+  are left to emWin. It sees the calls armlink redirects, the ones from
+  the application and from other objects of GUI_CM3.lib. Other tool
+  chains can not hook the library, the two fields are GUI_HEAP_NA there.
+*/
+
+#ifndef GUI_HEAP_H
+#define GUI_HEAP_H
+
+#include <stdint.h>
+
+#define GUI_HEAP_NA   0xFFFFFFFF  /* counter not available in this build   */
+
+typedef struct {
+  uint32_t NumBytes;          /* heap size                               */
+  uint32_t UsedBytes;         /* last sample                             */
+  uint32_t UsedBytesMax;      /* peak of the samples                     */
+  uint32_t FreeBytes;         /* last sample                             */
+  uint32_t MaxFreeBlock;      /* largest free block, last sample         */
+  uint32_t MaxFreeBlockMin;   /* smallest largest free block seen        */
+  uint32_t NumFreeBlocks;     /* last sample                             */
+  uint32_t Frag;              /* percent of the free bytes not in the
+                                 largest free block, last sample         */
+  uint32_t FragMax;
+  uint32_t NumPaint;          /* WM_PAINT samples                        */
+  uint32_t NumPaintDirect;    /* of them without a memory device         */
+  uint32_t NumBandShort;      /* paint cycles that started with less
+                                 than GUI_MEMDEV_MIN_LINES of band       */
+  uint32_t NumAlloc;          /* GUI_ALLOC_AllocNoInit calls, ARMCC only */
+  uint32_t NumAllocFail;      /* of them failed, memory devices mostly   */
+} GUI_HEAP_STAT;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void GUI_Heap_Reset(void);                      /* zero the peaks/counts   */
+void GUI_Heap_Get  (GUI_HEAP_STAT * p);         /* sample now and copy     */
+void GUI_Heap_Paint(int MsgId);                 /* from the window cb      */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HEAP_H */
+
+/*************************** End of file ****************************/
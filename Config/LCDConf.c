@@ -17,7 +17,16 @@ Purpose     : Display controller configuration (single layer)
 */
 
 #include "GUI.h"
-#include "GUIDRV_FlexColor.h"
+#ifdef LCD_USE_COMPACT_COLOR_16
+  #include "GUIDRV_CompactColor_16.h"
+  #include "LCDConf_CompactColor_16.h"
+#else
+  #include "GUIDRV_FlexColor.h"
+  #include "GUI_Private.h"
+#endif
+
+#include "GLCD.h"      /* GLCD.c driver: register, burst and window access */
+#include "LCD_Stat.h"
 
 //#include "touch/Touch.h"
 
@@ -29,7 +38,14 @@ Purpose     : Display controller configuration (single layer)
 #define COLOR_CONVERSION  GUICC_M565
 
 
-#define DISPLAY_DRIVER  GUIDRV_FLEXCOLOR
+/* LCD_USE_COMPACT_COLOR_16 (project define) selects GUIDRV_CompactColor_16
+   on LCD_X_16BitIF_lpc17xx.c instead of FlexColor on GLCD.c, for comparing
+   the two drivers on the same board */
+#ifdef LCD_USE_COMPACT_COLOR_16
+  #define DISPLAY_DRIVER  GUIDRV_COMPACT_COLOR_16
+#else
+  #define DISPLAY_DRIVER  GUIDRV_FLEXCOLOR
+#endif
 
 
 /*********************************************************************
@@ -61,33 +77,35 @@ Purpose     : Display controller configuration (single layer)
 
  *****************************************************************************************************************/
 static void _LcdSetReg(U16 Data) {
-LCD_WriteIndex(Data);
+  LCD_STAT_ENTER();
+  LCD_WriteIndex(Data);
+  LCD_STAT_LEAVE();
 }
 
 /**************************************************************************************************************
  
  *****************************************************************************************************************/
 static void _LcdWriteData(U16 Data) {
-LCD_WriteData(Data);
+  LCD_STAT_ENTER();
+  LCD_WriteData(Data);
+  LCD_STAT_LEAVE();
 }
 /**************************************************************************************************************
  
  *****************************************************************************************************************/
 static void _LcdWriteDataMultiple(U16 * pData, int NumItems) {
-  while (NumItems--) {
-    LCD_WriteData(*pData);
-		pData++;
-  }
+  LCD_STAT_ENTER();
+  LCD_WriteDataMultiple(pData, NumItems);
+  LCD_STAT_LEAVE();
 }
 
 /**************************************************************************************************************
   
  *****************************************************************************************************************/
 static void _LcdReadDataMultiple(U16 * pData, int NumItems) {
-  while (NumItems--) {
-   *pData = LCD_ReadData();
-		pData++;
-  }
+  LCD_STAT_ENTER();
+  LCD_ReadDataMultiple(pData, NumItems);
+  LCD_STAT_LEAVE();
 }
 
 /**************************************************************************************************************
@@ -112,16 +130,67 @@ static void _InitLcdController(void) {
 static void _Init(void) {
 		//touch_SPI_Configuration();
   _InitLcdController();
+#ifdef LCD_USE_COMPACT_COLOR_16
+  LCD_X_Init();
+#endif
 }
 
 
+#ifndef LCD_USE_COMPACT_COLOR_16
+/**************************************************************************************************************
+  Fill rectangles through LCD_FillWindow: one GRAM window and WR strobes with the color held on the bus.
+  FlexColor has no fill command for LCD_X_DisplayDriver, so LCD_X_Config puts _FillRect into a RAM copy
+  of the driver API. Small rectangles (window setup costs more than the pixels) and XOR go to FlexColor.
+ *****************************************************************************************************************/
+#define FILL_MIN_PIXELS  128
+
+/* LCD_FillWindow maps emWin coordinates to GRAM with DISP_ORIENTATION of GLCD.h,
+   FlexColor gets its orientation from the same define (FirstSEG / FirstCOM stay 0) */
+#if DISP_ORIENTATION == 90
+  #define FLEXCOLOR_ORIENTATION  (GUI_SWAP_XY | GUI_MIRROR_Y)
+#else
+  #error DISP_ORIENTATION: no FlexColor orientation matching LCD_FillWindow
+#endif
+
+static GUI_DEVICE_API _FillAPI;
+static void (* _pfFillRect)(GUI_DEVICE * pDevice, int x0, int y0, int x1, int y1);
+
+static void _FillRect(GUI_DEVICE * pDevice, int x0, int y0, int x1, int y1) {
+  LCD_STAT_ENTER();
+  if ((GUI_pContext->DrawMode & LCD_DRAWMODE_XOR) ||
+      (x1 - x0 + 1) * (y1 - y0 + 1) < FILL_MIN_PIXELS ||
+      LCD_FillWindow(x0, y0, x1, y1, LCD__GetColorIndex())) {
+    _pfFillRect(pDevice, x0, y0, x1, y1);
+  }
+  LCD_STAT_LEAVE();
+}
+#endif
+
 /**************************************************************************************************************
   
  *****************************************************************************************************************/
+#ifdef LCD_USE_COMPACT_COLOR_16
+void LCD_X_Config(void) {
+  //
+  // Orientation and controller are set in LCDConf_CompactColor_16.h,
+  // the sizes here are logical
+  //
+  LCD_Stat_Reset();
+  GUI_DEVICE_CreateAndLink(DISPLAY_DRIVER, COLOR_CONVERSION, 0, 0);
+  #if LCD_SWAP_XY
+    LCD_SetSizeEx (0, YSIZE_PHYS , XSIZE_PHYS);
+    LCD_SetVSizeEx(0, VYSIZE_PHYS, VXSIZE_PHYS);
+  #else
+    LCD_SetSizeEx (0, XSIZE_PHYS , YSIZE_PHYS);
+    LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
+  #endif
+}
+#else
 void LCD_X_Config(void) {
   GUI_DEVICE * pDevice;
   CONFIG_FLEXCOLOR Config = {0};
   GUI_PORT_API PortAPI = {0};
+  LCD_Stat_Reset();
   //
   // 
   //
@@ -133,8 +202,8 @@ void LCD_X_Config(void) {
   LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
   //
   //
-  Config.Orientation =  GUI_SWAP_XY |GUI_MIRROR_Y;// GUI_MIRROR_X;//
-  Config.RegEntryMode=0x6870;
+  Config.Orientation  = FLEXCOLOR_ORIENTATION;
+  Config.RegEntryMode = LCD_ENTRY_MODE;
 //	Config.FirstSEG=0;
 //	Config.FirstCOM=0;
   GUIDRV_FlexColor_Config(pDevice, &Config);
@@ -145,7 +214,15 @@ void LCD_X_Config(void) {
   PortAPI.pfWriteM16_A1 = _LcdWriteDataMultiple;
   PortAPI.pfReadM16_A1  = _LcdReadDataMultiple;
   GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66702, GUIDRV_FLEXCOLOR_M16C0B16);
+  //
+  // Controller fill for FillRect
+  //
+  _FillAPI            = *pDevice->pDeviceAPI;
+  _pfFillRect         = _FillAPI.pfFillRect;
+  _FillAPI.pfFillRect = _FillRect;
+  pDevice->pDeviceAPI = &_FillAPI;
 }
+#endif
 
 /*********************************************************************
 *
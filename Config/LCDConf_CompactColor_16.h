@@ -44,21 +44,43 @@ Purpose     : CompactColor driver configuration file
 /* 16 bit parallel interface is used */
 #define LCD_USE_PARALLEL_16     1
 
+/* Banded shadow cache: GetPixel / XOR / alpha readback served from RAM,
+   4 bands of 16 lines = 4 * 16 * 240 * 2 = 30 KB of emWin memory */
+//#define LCD_CACHE               1
+//#define LCD_CACHE_BAND_LINES    16
+//#define LCD_CACHE_NUM_BANDS     4
+
 
 //
-// Indirect interface configuration
+// Indirect interface configuration, LCD_X_16BitIF_lpc17xx.c
 //
+void LCD_X_Init(void);
+
+#if LCD_USE_PARALLEL_16
 void LCD_X_Write01_16 (unsigned short c);
 void LCD_X_Write00_16 (unsigned short c);
 void LCD_X_WriteM01_16(unsigned short * pData, int NumWords);
 void LCD_X_WriteM00_16(unsigned short * pData, int NumWords);
 void LCD_X_ReadM01_16 (unsigned short * pData, int NumWords);
 
-#define LCD_WRITE_A1 (Word) LCD_X_Write01_16(Word)
-#define LCD_WRITE_A0 (Word) LCD_X_Write00_16(Word)
+#define LCD_WRITE_A1(Word) LCD_X_Write01_16(Word)
+#define LCD_WRITE_A0(Word) LCD_X_Write00_16(Word)
 #define LCD_WRITEM_A1(Word, NumWords) LCD_X_WriteM01_16(Word, NumWords)
 #define LCD_WRITEM_A0(Word, NumWords) LCD_X_WriteM00_16(Word, NumWords)
-#define LCD_READM_A1 (Word, NumWords) LCD_X_ReadM01_16 (Word, NumWords)
+#define LCD_READM_A1(Word, NumWords)  LCD_X_ReadM01_16 (Word, NumWords)
+#else
+void LCD_X_Write01 (unsigned char c);
+void LCD_X_Write00 (unsigned char c);
+void LCD_X_WriteM01(unsigned char * pData, int NumBytes);
+void LCD_X_WriteM00(unsigned char * pData, int NumBytes);
+void LCD_X_ReadM01 (unsigned char * pData, int NumBytes);
+
+#define LCD_WRITE_A1(Byte) LCD_X_Write01(Byte)
+#define LCD_WRITE_A0(Byte) LCD_X_Write00(Byte)
+#define LCD_WRITEM_A1(Byte, NumBytes) LCD_X_WriteM01(Byte, NumBytes)
+#define LCD_WRITEM_A0(Byte, NumBytes) LCD_X_WriteM00(Byte, NumBytes)
+#define LCD_READM_A1(Byte, NumBytes)  LCD_X_ReadM01 (Byte, NumBytes)
+#endif
 #endif /* LCDCONF_COMPACTCOLOR_16_H */
 
 /*************************** End of file ****************************/
@@ -0,0 +1,114 @@
+/*********************************************************************
+*               arvin2009
+**                                 http://www.didbansanat.com
+----------------------------------------------------------------------
+File        : LCD_Stat.c
+Purpose     : Display driver counters, query / reset and paint cycles
+----------------------------------------------------------------------
+*/
+
+#include <string.h>
+#include "GUI.h"
+#include "WM.h"
+#include "LCD_Stat.h"
+
+#if LCD_STAT
+
+#define DEMCR        (*((volatile uint32_t *)0xE000EDFC))
+#define DWT_CTRL     (*((volatile uint32_t *)0xE0001000))
+
+/*********************************************************************
+*
+*       Static data
+*
+**********************************************************************
+*/
+LCD_STAT_COUNT LCD_StatCount;
+uint32_t       LCD_StatDepth;
+uint32_t       LCD_StatT0;
+
+static LCD_STAT_FRAME _Frame;
+static LCD_STAT_COUNT _Start;                   /* counters at WM_PRE_PAINT */
+static uint32_t       _FrameT0;
+
+/*********************************************************************
+*
+*       Exported code
+*
+**********************************************************************
+*/
+/*********************************************************************
+*
+*       LCD_Stat_Reset
+*/
+void LCD_Stat_Reset(void) {
+  DEMCR    |= (1UL << 24);                      /* TRCENA    */
+  DWT_CTRL |= 1;                                /* CYCCNTENA */
+  memset(&LCD_StatCount, 0, sizeof(LCD_StatCount));
+  memset(&_Frame, 0, sizeof(_Frame));
+  _Start = LCD_StatCount;
+}
+
+/*********************************************************************
+*
+*       LCD_Stat_Get
+*/
+void LCD_Stat_Get(LCD_STAT_COUNT * p) {
+  *p = LCD_StatCount;
+}
+
+/*********************************************************************
+*
+*       LCD_Stat_GetFrame
+*/
+void LCD_Stat_GetFrame(LCD_STAT_FRAME * p) {
+  *p = _Frame;
+}
+
+/*********************************************************************
+*
+*       LCD_Stat_Paint
+*
+* Purpose:
+*   WM_PRE_PAINT takes the counters, WM_POST_PAINT turns the difference
+*   into the frame summary. Other messages are ignored.
+*/
+void LCD_Stat_Paint(int MsgId) {
+  const uint32_t * pNow;
+  const uint32_t * pStart;
+  uint32_t       * pLast;
+  uint32_t       * pMax;
+  unsigned i;
+
+  if (MsgId == WM_PRE_PAINT) {
+    _Start   = LCD_StatCount;
+    _FrameT0 = LCD_STAT_CYCCNT;
+  } else if (MsgId == WM_POST_PAINT) {
+    pNow   = (const uint32_t *)&LCD_StatCount;
+    pStart = (const uint32_t *)&_Start;
+    pLast  = (uint32_t *)&_Frame.Last;
+    pMax   = (uint32_t *)&_Frame.Max;
+    for (i = 0; i < sizeof(LCD_STAT_COUNT) / sizeof(uint32_t); i++) {
+      pLast[i] = pNow[i] - pStart[i];
+      if (pLast[i] > pMax[i]) {
+        pMax[i] = pLast[i];
+      }
+    }
+    _Frame.FrameCycles = LCD_STAT_CYCCNT - _FrameT0;
+    if (_Frame.FrameCycles > _Frame.FrameCyclesMax) {
+      _Frame.FrameCyclesMax = _Frame.FrameCycles;
+    }
+    _Frame.NumFrames++;
+  }
+}
+
+#else
+
+void LCD_Stat_Reset   (void)                 { }
+void LCD_Stat_Get     (LCD_STAT_COUNT * p)   { memset(p, 0, sizeof(*p)); }
+void LCD_Stat_GetFrame(LCD_STAT_FRAME * p)   { memset(p, 0, sizeof(*p)); }
+void LCD_Stat_Paint   (int MsgId)            { GUI_USE_PARA(MsgId); }
+
+#endif
+
+/*************************** End of file ****************************/
@@ -0,0 +1,86 @@
+/*********************************************************************
+*               arvin2009
+**                                 http://www.didbansanat.com
+----------------------------------------------------------------------
+File        : LCD_Stat.h
+Purpose     : Display driver counters (bus events and DWT cycles)
+----------------------------------------------------------------------
+
+  With LCD_STAT 1 (project define) the driver layers count what they
+  put on the display bus:
+
+    GLCD.c              register writes, data words, reads, CS phases
+    LCDConf.c           cycles of the FlexColor PortAPI and fill hook
+    LCD_X_SPI.c         all of the above for the SPI panel
+    LCD_X_16BitIF_lpc17xx.c   all of the above for CompactColor
+
+  Cycles are DWT CYCCNT, taken only at the outermost driver entry, so a
+  FillRect that falls back to FlexColor is not counted twice. With
+  LCD_STAT 0 the macros are empty and the query functions return zeros.
+
+  Per paint cycle: call LCD_Stat_Paint(pMsg->MsgId) from the desktop
+  callback, it takes WM_PRE_PAINT / WM_POST_PAINT.
+*/
+
+#ifndef LCD_STAT_H
+#define LCD_STAT_H
+
+#include <stdint.h>
+
+#ifndef   LCD_STAT
+  #define LCD_STAT 0
+#endif
+
+typedef struct {
+  uint32_t RegWrites;         /* index (command) writes                  */
+  uint32_t WordsWritten;      /* data words, register values and pixels  */
+  uint32_t WordsRead;         /* data words read back, dummy reads too   */
+  uint32_t CsCycles;          /* CS low phases                           */
+  uint32_t Calls;             /* driver entries                          */
+  uint32_t Cycles;            /* CPU cycles inside the driver            */
+} LCD_STAT_COUNT;
+
+typedef struct {
+  LCD_STAT_COUNT Last;        /* last paint cycle                        */
+  LCD_STAT_COUNT Max;         /* largest value of every counter          */
+  uint32_t       NumFrames;   /* paint cycles since LCD_Stat_Reset       */
+  uint32_t       FrameCycles; /* WM_PRE_PAINT to WM_POST_PAINT, last     */
+  uint32_t       FrameCyclesMax;
+} LCD_STAT_FRAME;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void LCD_Stat_Reset   (void);                   /* zero all, start CYCCNT  */
+void LCD_Stat_Get     (LCD_STAT_COUNT * p);     /* totals since reset      */
+void LCD_Stat_GetFrame(LCD_STAT_FRAME * p);     /* paint cycle summary     */
+void LCD_Stat_Paint   (int MsgId);              /* from the desktop cb     */
+
+#if LCD_STAT
+
+extern LCD_STAT_COUNT LCD_StatCount;
+extern uint32_t       LCD_StatDepth;
+extern uint32_t       LCD_StatT0;
+
+#define LCD_STAT_CYCCNT         (*((volatile uint32_t *)0xE0001004))
+
+#define LCD_STAT_ADD(Item, n)   (LCD_StatCount.Item += (n))
+#define LCD_STAT_ENTER()        { LCD_StatCount.Calls++; if (LCD_StatDepth++ == 0) LCD_StatT0 = LCD_STAT_CYCCNT; }
+#define LCD_STAT_LEAVE()        { if (--LCD_StatDepth == 0) LCD_StatCount.Cycles += LCD_STAT_CYCCNT - LCD_StatT0; }
+
+#else
+
+#define LCD_STAT_ADD(Item, n)
+#define LCD_STAT_ENTER()
+#define LCD_STAT_LEAVE()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_STAT_H */
+
+/*************************** End of file ****************************/
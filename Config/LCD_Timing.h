@@ -0,0 +1,30 @@
+/*********************************************************************
+*               arvin2009
+**                                 http://www.didbansanat.com
+----------------------------------------------------------------------
+File        : LCD_Timing.h
+Purpose     : Bus timing of the parallel display controller
+----------------------------------------------------------------------
+
+  Shared by every driver of the 16 bit panel: GLCD.c,
+  LCD_X_16BitIF_lpc17xx.c and AF_LCD.cpp. Each of them turns
+  LCD_T_RD_NS into a busy wait count from the core clock at init,
+  LCD_RD_WAIT_COUNT does the conversion.
+*/
+
+#ifndef LCD_TIMING_H
+#define LCD_TIMING_H
+
+/* Read access time of the controller (RD low to valid data), ILI932x tRATFM
+   = 360 ns for GRAM, register reads (tRAT 100 ns) are covered by the same value */
+#define LCD_T_RD_NS  360
+
+/* Core clocks of one "while (n--);" loop on the Cortex-M3 at the least
+   (decrement and taken branch), so the wait is never shorter than LCD_T_RD_NS */
+#define LCD_WAIT_LOOP_CLKS  3
+
+/* Busy wait loop count for LCD_T_RD_NS at core clock Hz, rounded up */
+#define LCD_RD_WAIT_COUNT(Hz) \
+  ((((Hz) / 1000000) * LCD_T_RD_NS + 999) / 1000 / LCD_WAIT_LOOP_CLKS + 1)
+
+#endif /* LCD_TIMING_H */
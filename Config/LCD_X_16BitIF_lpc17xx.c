@@ -26,29 +26,169 @@ Full source code is available at: www.segger.com
 
 We appreciate your understanding and fairness.
 ----------------------------------------------------------------------
-File        : LCD_X_16BitIF_STM32.c
-Purpose     : Port routines for STM32 16-bit Interface
+File        : LCD_X_16BitIF_lpc17xx.c
+Purpose     : Port routines for the LPC17xx 16-bit GPIO interface
+              (GUIDRV_CompactColor_16, LCD_USE_COMPACT_COLOR_16)
 ----------------------------------------------------------------------
 */
 
 #include "GUI.h"
 
+#ifdef LCD_USE_COMPACT_COLOR_16
+
+#include "GLCD.h"
+#include "LCD_Stat.h"
+
 /*********************************************************************
 *
 *       Hardware configuration
 *
 **********************************************************************
+
+  Same wiring as GLCD.c: DB8..15 on P0.15..22, DB0..7 on P0.4..11,
+  CS, RS, WR, RD on P2.8..11. The 8 bit routines use DB8..15, the lines
+  the ILI932x / SSD1289 use for the 8 bit 80-system interface.
+
+  A word is put on the data lines with a FIOSET / FIOCLR pair (one bits
+  set, the other data lines cleared) as in GLCD.c. FIOMASK is not used,
+  so other P0 pins may be written from interrupts during a transfer.
 */
+#define DATA_PINS     ((0xffUL << 15) | (0xffUL << 4))
+#define MSB_PINS      (0xffUL << 15)
 
-#include <stm32f10x.h>
+#define DATA16(d)     (((U32)((d) >> 8) << 15) | ((U32)((d) & 0xff) << 4))
+#define DATA8(d)      ((U32)(d) << 15)
 
-#ifndef FSMC_Bank1_NORSRAM1     /* defined in ST Peripheral Library */
-  #define FSMC_Bank1_NORSRAM1      ((uint32_t)0x00000000)
+#define PUT16(d)      LPC_GPIO0->FIOSET = DATA16(d); LPC_GPIO0->FIOCLR = DATA16(d) ^ DATA_PINS
+#define PUT8(d)       LPC_GPIO0->FIOSET = DATA8(d);  LPC_GPIO0->FIOCLR = DATA8(d)  ^ MSB_PINS
+
+/*********************************************************************
+*
+*       Timing
+*
+* The ILI932x / SSD1289 need WR low for 50 ns and 100 ns per write
+* cycle. At 100 MHz the WR clear, LCD_X_WR_NOPS and the WR set give
+* ~50 ns low, loading and storing the next word fills the cycle.
+* Reads wait LCD_T_RD_NS (LCD_Timing.h) after RD goes low.
+*/
+#ifndef   LCD_X_WR_NOPS
+  #define LCD_X_WR_NOPS 3
+#endif
+
+#if   LCD_X_WR_NOPS == 0
+  #define WR_WAIT()
+#elif LCD_X_WR_NOPS == 1
+  #define WR_WAIT()   __nop()
+#elif LCD_X_WR_NOPS == 2
+  #define WR_WAIT()   __nop(); __nop()
+#elif LCD_X_WR_NOPS == 3
+  #define WR_WAIT()   __nop(); __nop(); __nop()
+#elif LCD_X_WR_NOPS == 4
+  #define WR_WAIT()   __nop(); __nop(); __nop(); __nop()
+#else
+  #error LCD_X_WR_NOPS > 4 not supported!
 #endif
 
-#define LCD_BASE        (0x60000000UL | 0x00000000UL)
-#define LCD_REG16  (*((volatile unsigned short *)(LCD_BASE  ))) 
-#define LCD_DAT16  (*((volatile unsigned short *)(LCD_BASE | 0x00020000UL)))
+#define STROBE_WR()   LPC_GPIO2->FIOCLR = PIN_WR; WR_WAIT(); LPC_GPIO2->FIOSET = PIN_WR
+
+/*********************************************************************
+*
+*       Static data
+*
+**********************************************************************
+*/
+static U32 _RdWait = 50;
+
+/*********************************************************************
+*
+*       Static code
+*
+**********************************************************************
+*/
+/*********************************************************************
+*
+*       _Begin
+*
+* Purpose:
+*   Select the controller, RS as given, data lines to output
+*/
+static void _Begin(U32 RS) {
+  LCD_STAT_ADD(CsCycles, 1);
+  LPC_GPIO0->FIODIR |= DATA_PINS;
+  LPC_GPIO2->FIOSET  = PIN_RD | (RS ? PIN_RS : 0);
+  LPC_GPIO2->FIOCLR  = PIN_CS | (RS ? 0 : PIN_RS);
+}
+
+/*********************************************************************
+*
+*       _End
+*/
+static void _End(void) {
+  LPC_GPIO2->FIOSET  = PIN_CS;
+}
+
+/*********************************************************************
+*
+*       _Wait
+*/
+static void _Wait(U32 Count) {
+  while (Count--);
+}
+
+/*********************************************************************
+*
+*       _Write16
+*/
+static void _Write16(U16 * pData, int NumWords) {
+  while (NumWords >= 4) {
+    PUT16(pData[0]); STROBE_WR();
+    PUT16(pData[1]); STROBE_WR();
+    PUT16(pData[2]); STROBE_WR();
+    PUT16(pData[3]); STROBE_WR();
+    pData    += 4;
+    NumWords -= 4;
+  }
+  while (NumWords-- > 0) {
+    PUT16(*pData); STROBE_WR();
+    pData++;
+  }
+}
+
+/*********************************************************************
+*
+*       _Write8
+*/
+static void _Write8(U8 * pData, int NumBytes) {
+  while (NumBytes >= 4) {
+    PUT8(pData[0]);  STROBE_WR();
+    PUT8(pData[1]);  STROBE_WR();
+    PUT8(pData[2]);  STROBE_WR();
+    PUT8(pData[3]);  STROBE_WR();
+    pData    += 4;
+    NumBytes -= 4;
+  }
+  while (NumBytes-- > 0) {
+    PUT8(*pData);  STROBE_WR();
+    pData++;
+  }
+}
+
+/*********************************************************************
+*
+*       _Read
+*
+* Purpose:
+*   One RD strobe, returns P0 as sampled (all pins, the callers pick the data lines)
+*/
+static U32 _Read(void) {
+  U32 v;
+
+  LPC_GPIO2->FIOCLR = PIN_RD;
+  _Wait(_RdWait);
+  v = LPC_GPIO0->FIOPIN;
+  LPC_GPIO2->FIOSET = PIN_RD;
+  return v;
+}
 
 /*********************************************************************
 *
@@ -65,58 +205,11 @@ Purpose     : Port routines for STM32 16-bit Interface
 *   to set port pins to their initial values
 */
 void LCD_X_Init(void) {
-
-/* Configure the LCD Control pins --------------------------------------------*/
-  RCC->APB2ENR |= 0x000001ED;                         /* enable GPIOA,D..G, AFIO clock */
-
-  /* PD.00(D2),  PD.01(D3),  PD.04(NOE), PD.05(NWE), PD.07(NE4 (LCD/CS)) - CE3(LCD /CS) */ 
-GPIOD->CRL &= ~0xF0FF00FF;                          /* clear Bits */
-GPIOD->CRL |=  0xB0BB00BB;                          /* alternate function output Push-pull 50MHz */
-  /* PD.08(D13), PD.09(D14), PD.10(D15), PD.11(RS) PD.14(D0), PD.15(D1) */
-GPIOD->CRH &= ~0xFF00FFFF;                          /* clear Bits */
-GPIOD->CRH |=  0xBB00BBBB;                          /* alternate function output Push-pull 50MHz */
-   
-  /* PE.07(D4) */ 
-GPIOE->CRL &= ~0xF0000000;                          /* clear Bits */
-GPIOE->CRL |=  0xB0000000;                          /* alternate function output Push-pull 50MHz */
-  /* PE.08(D5), PE.09(D6),  PE.10(D7), PE.11(D8), PE.12(D9), PE.13(D10), PE.14(D11), PE.15(D12) */
-GPIOE->CRH &= ~0xFFFFFFFF;                          /* clear Bits */
-GPIOE->CRH |=  0xBBBBBBBB;                          /* alternate function output Push-pull 50MHz */
-
- 
-
-  /* PB.05(LCD Backlight */
-  GPIOB->BRR |=  0x00000020;                          /* Backlight off */
-  GPIOB->CRL &= ~0x00F00000;                          /* clear Bits */
-  GPIOB->CRL |=  0x00300000;                          /*                    output Push-pull 50MHz */
-
-/*-- FSMC Configuration ------------------------------------------------------*/
-/*----------------------- SRAM Bank 4 ----------------------------------------*/
-  RCC->AHBENR  |= (1<<8);                             /* enable FSMC clock */
-
-  FSMC_Bank1->BTCR[FSMC_Bank1_NORSRAM1+1] =           /* Bank1 NOR/SRAM timing register configuration */
-                                         (0 << 28) |  /* FSMC AccessMode A */
-                                         (0 << 24) |  /* Data Latency */
-                                         (0 << 20) |  /* CLK Division */
-                                         (0 << 16) |  /* Bus Turnaround Duration */
-                                         (2 <<  10) |  /* Data SetUp Time */
-                                         (0 <<  4) |  /* Address Hold Time */
-                                         (2 <<  10);   /* Address SetUp Time */
-  FSMC_Bank1->BTCR[FSMC_Bank1_NORSRAM1  ] =           /* Control register */
-                                         (0 << 19) |  /* Write burst disabled */
-                                         (0 << 15) |  /* Async wait disabled */
-                                         (0 << 14) |  /* Extended mode disabled */
-                                         (0 << 13) |  /* NWAIT signal is disabled */ 
-                                         (1 << 12) |  /* Write operation enabled */
-                                         (0 << 11) |  /* NWAIT signal is active one data cycle before wait state */
-                                         (0 << 10) |  /* Wrapped burst mode disabled */
-                                         (1 <<  9) |  /* Wait signal polarity active low */
-                                         (0 <<  8) |  /* Burst access mode disabled */
-                                         (1 <<  4) |  /* Memory data  bus width is 16 bits */
-                                         (0 <<  2) |  /* Memory type is SRAM */
-                                         (0 <<  1) |  /* Address/Data Multiplexing disable */
-                                         (1 <<  0);   /* Memory Bank enable */
- GPIOB->BSRR = 0x00000020;             /* Turn backlight on */
+  /* LCD_T_RD_NS in _Wait loops (LCD_Timing.h) */
+  _RdWait = LCD_RD_WAIT_COUNT(SystemCoreClock);
+  LPC_GPIO0->FIODIR |= DATA_PINS;
+  LPC_GPIO2->FIODIR |= PIN_CS | PIN_RS | PIN_WR | PIN_RD;
+  LPC_GPIO2->FIOSET  = PIN_CS | PIN_RS | PIN_WR | PIN_RD;
 }
 
 /*********************************************************************
@@ -127,7 +220,12 @@ GPIOE->CRH |=  0xBBBBBBBB;                          /* alternate function output
 *   Write to controller, with A0 = 0
 */
 void LCD_X_Write00_16(U16 c) {
-  LCD_REG16 = c;
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(RegWrites, 1);
+  _Begin(0);
+  PUT16(c); STROBE_WR();
+  _End();
+  LCD_STAT_LEAVE();
 }
 
 /*********************************************************************
@@ -138,7 +236,12 @@ void LCD_X_Write00_16(U16 c) {
 *   Write to controller, with A0 = 1
 */
 void LCD_X_Write01_16(U16 c) {
-  LCD_DAT16 = c;
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, 1);
+  _Begin(1);
+  PUT16(c); STROBE_WR();
+  _End();
+  LCD_STAT_LEAVE();
 }
 
 /*********************************************************************
@@ -149,7 +252,10 @@ void LCD_X_Write01_16(U16 c) {
 *   Read from controller, with A0 = 1
 */
 U16 LCD_X_Read01_16(void) {
-  return (LCD_DAT16);
+  U16 c;
+
+  LCD_X_ReadM01_16(&c, 1);
+  return c;
 }
 
 /*********************************************************************
@@ -157,36 +263,159 @@ U16 LCD_X_Read01_16(void) {
 *       LCD_X_WriteM01_16
 *
 * Purpose:
-*   Write multiple bytes to controller, with A0 = 1
+*   Write multiple words to controller, with A0 = 1
 */
 void LCD_X_WriteM01_16(U16 * pData, int NumWords) {
-  for (; NumWords; NumWords--) {
-    LCD_DAT16 = *pData++;
-  }
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, NumWords);
+  _Begin(1);
+  _Write16(pData, NumWords);
+  _End();
+  LCD_STAT_LEAVE();
 }
+
 /*********************************************************************
 *
 *       LCD_X_WriteM00_16
 *
 * Purpose:
-*   Write multiple bytes to controller, with A0 = 0
+*   Write multiple words to controller, with A0 = 0
 */
 void LCD_X_WriteM00_16(U16 * pData, int NumWords) {
-  for (; NumWords; NumWords--) {
-    LCD_REG16 = *pData++;
-  }
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(RegWrites, NumWords);
+  _Begin(0);
+  _Write16(pData, NumWords);
+  _End();
+  LCD_STAT_LEAVE();
 }
+
 /*********************************************************************
 *
 *       LCD_X_ReadM01_16
 *
 * Purpose:
-*   Read multiple bytes from controller, with A0 = 1
+*   Read multiple words from controller, with A0 = 1
 */
 void LCD_X_ReadM01_16(U16 * pData, int NumWords) {
-  for (; NumWords; NumWords--) {
-    *pData++ = LCD_DAT16;
+  U32 v;
+
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsRead, NumWords);
+  _Begin(1);
+  LPC_GPIO0->FIODIR &= ~DATA_PINS;
+  while (NumWords-- > 0) {
+    v = _Read();
+    *pData++ = (((v >> 15) & 0xff) << 8) | ((v >> 4) & 0xff);
   }
+  LPC_GPIO0->FIODIR |= DATA_PINS;
+  _End();
+  LCD_STAT_LEAVE();
 }
 
+/*********************************************************************
+*
+*       LCD_X_Write00
+*
+* Purpose:
+*   Write to controller, with A0 = 0 (8 bit interface)
+*/
+void LCD_X_Write00(U8 c) {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(RegWrites, 1);
+  _Begin(0);
+  _Write8(&c, 1);
+  _End();
+  LCD_STAT_LEAVE();
+}
+
+/*********************************************************************
+*
+*       LCD_X_Write01
+*
+* Purpose:
+*   Write to controller, with A0 = 1 (8 bit interface)
+*/
+void LCD_X_Write01(U8 c) {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, 1);
+  _Begin(1);
+  _Write8(&c, 1);
+  _End();
+  LCD_STAT_LEAVE();
+}
+
+/*********************************************************************
+*
+*       LCD_X_Read01
+*
+* Purpose:
+*   Read from controller, with A0 = 1 (8 bit interface)
+*/
+U8 LCD_X_Read01(void) {
+  U8 c;
+
+  LCD_X_ReadM01(&c, 1);
+  return c;
+}
+
+/*********************************************************************
+*
+*       LCD_X_WriteM01
+*
+* Purpose:
+*   Write multiple bytes to controller, with A0 = 1 (8 bit interface)
+*/
+void LCD_X_WriteM01(U8 * pData, int NumBytes) {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, NumBytes);
+  _Begin(1);
+  _Write8(pData, NumBytes);
+  _End();
+  LCD_STAT_LEAVE();
+}
+
+/*********************************************************************
+*
+*       LCD_X_WriteM00
+*
+* Purpose:
+*   Write multiple bytes to controller, with A0 = 0 (8 bit interface)
+*/
+void LCD_X_WriteM00(U8 * pData, int NumBytes) {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(RegWrites, NumBytes);
+  _Begin(0);
+  _Write8(pData, NumBytes);
+  _End();
+  LCD_STAT_LEAVE();
+}
+
+/*********************************************************************
+*
+*       LCD_X_ReadM01
+*
+* Purpose:
+*   Read multiple bytes from controller, with A0 = 1 (8 bit interface)
+*/
+void LCD_X_ReadM01(U8 * pData, int NumBytes) {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsRead, NumBytes);
+  _Begin(1);
+  LPC_GPIO0->FIODIR &= ~MSB_PINS;
+  while (NumBytes-- > 0) {
+    *pData++ = (U8)(_Read() >> 15);
+  }
+  LPC_GPIO0->FIODIR |= MSB_PINS;
+  _End();
+  LCD_STAT_LEAVE();
+}
+
+#else
+
+void LCD_X_16BitIF_lpc17xx_c(void);
+void LCD_X_16BitIF_lpc17xx_c(void) { } /* avoid empty object files */
+
+#endif /* LCD_USE_COMPACT_COLOR_16 */
+
 /*************************** End of file ****************************/
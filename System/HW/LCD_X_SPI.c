@@ -11,6 +11,9 @@
 #include "GUI.h"
 #include "LPC17xx.h"
 #include "LCD_X_SPI.h"
+#include "lpc17xx_gpdma.h"
+#include "LCD_Stat.h"
+#include "AHB_SRAM.h"
 
 /*********************** Hardware specific configuration **********************/
 
@@ -35,11 +38,37 @@
 #define SPI_DATA    (0x02)              /* RS bit 1 within start byte */
 #define SPI_INDEX   (0x00)              /* RS bit 0 within start byte */
 
+/* GPDMA write path: LCD_X_SPI_WriteM01 copies the words (byte swapped, the
+   panel wants D8..D15 first) into one of two buffers and starts the DMA on
+   it, then returns. The next call fills the other buffer while the first one
+   is still on the wire. CS stays low and the data stream stays open between
+   calls; it is closed (wait for the DMA, then CS high) only at the next
+   command, single write or read. The GPDMA cannot reach the CPU SRAM, so the
+   buffers are placed (at) at SPI_DMA_BUF_ADDR of AHB_SRAM.h, the top of
+   AHB SRAM bank 1; SPI_DMA_WORDS is set there as well. Only channel
+   SPI_DMA_CH is set up here, the other channels are left to their users.    */
+
+#define SPI_DMA_CH        7                           /* lowest priority          */
+#define SPI_DMA_MIN       8                           /* fewer words go by FIFO   */
+
+#define SSP_BSY           (1 << 4)
+#define SSP_DMACR_TX      (1 << 1)
+
+#define SPI_DMA_CHREG      LPC_GPDMACH7                /* registers of SPI_DMA_CH  */
+#define PCONP_PCGPDMA     (1 << 29)
+
+static U16 _aDmaBuf[2][SPI_DMA_WORDS] __attribute__ ((at (SPI_DMA_BUF_ADDR), zero_init));
+static int _DmaBuf;                                   /* buffer filled next       */
+static int _DataOpen;                                 /* CS low, data write open  */
+
 /* local functions */
 __inline void wr_cmd (unsigned char cmd);						/* Write command to LCD */
 __inline void wr_dat (unsigned short dat);						/* Write data to LCD */
 __inline unsigned char spi_tran (unsigned char byte);	/* Write and read a byte over SPI */
 __inline void spi_tran_fifo (unsigned char byte);		/* Only write a byte over SPI (faster) */
+static void spi_dma_init (void);						/* Set up the DMA channel */
+static void spi_dma_wait (void);						/* Wait until the DMA channel is done */
+static void spi_data_close (void);						/* End an open data write */
 
 /*******************************************************************************
 * Initialize SPI (SSP) peripheral at 8 databit with a bitrate of 12.5Mbps      *
@@ -74,6 +103,11 @@ void LCD_X_SPI_Init(void)
   while(LPC_SSP1->SR & (1<<2))
     Dummy = LPC_SSP1->DR;			/* Clear the Rx FIFO */
 
+  /* Tx FIFO is fed by GPDMA channel SPI_DMA_CH for LCD_X_SPI_WriteM01 */
+  spi_dma_init();
+  LPC_SSP1->DMACR      = SSP_DMACR_TX;
+  _DataOpen = 0;
+
   LPC_GPIO4->FIOSET = 0x10000000;	/* Activate LCD backlight */
 }
 
@@ -84,7 +118,11 @@ void LCD_X_SPI_Init(void)
 *******************************************************************************/
 void LCD_X_SPI_Write00(U16 c)
 {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(RegWrites, 1);
+  spi_data_close();
   wr_cmd(c);
+  LCD_STAT_LEAVE();
 }
 
 /*******************************************************************************
@@ -94,7 +132,11 @@ void LCD_X_SPI_Write00(U16 c)
 *******************************************************************************/
 void LCD_X_SPI_Write01(U16 c)
 {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, 1);
+  spi_data_close();
   wr_dat(c);
+  LCD_STAT_LEAVE();
 }
 
 /*******************************************************************************
@@ -105,16 +147,62 @@ void LCD_X_SPI_Write01(U16 c)
 *******************************************************************************/
 void LCD_X_SPI_WriteM01(U16 * pData, int NumWords)
 {
-  LCD_CS(0);
-  spi_tran_fifo(SPI_START | SPI_WR | SPI_DATA);			/* Write : RS = 1, RW = 0 */
+  GPDMA_Channel_CFG_Type Cfg;
+  U16 * pBuf;
+  U16 d;
+  int n, i;
 
-  while(NumWords--)
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsWritten, NumWords);
+  if(!_DataOpen)
   {
-	  spi_tran_fifo(((*pData) >>   8));					/* Write D8..D15 */
-	  spi_tran_fifo(((*(pData++)) & 0xFF));				/* Write D0..D7 */
+    LCD_STAT_ADD(CsCycles, 1);
+    LCD_CS(0);
+    spi_tran_fifo(SPI_START | SPI_WR | SPI_DATA);		/* Write : RS = 1, RW = 0 */
+    _DataOpen = 1;
   }
-  while(LPC_SSP1->SR & (1<<4));							/* wait until done */
-  LCD_CS(1);
+
+  while(NumWords > 0)
+  {
+    n = NumWords < SPI_DMA_WORDS ? NumWords : SPI_DMA_WORDS;
+
+    /* Short writes: straight into the FIFO behind the running transfer */
+    if(n < SPI_DMA_MIN)
+    {
+      spi_dma_wait();
+      while(n--)
+      {
+        spi_tran_fifo(((*pData) >>   8));				/* Write D8..D15 */
+        spi_tran_fifo(((*(pData++)) & 0xFF));			/* Write D0..D7 */
+      }
+      break;
+    }
+
+    /* Fill the free buffer while the other one is sent */
+    pBuf = _aDmaBuf[_DmaBuf];
+    for(i = 0; i < n; i++)
+    {
+      d = *pData++;
+      pBuf[i] = (U16)((d >> 8) | (d << 8));
+    }
+    spi_dma_wait();
+
+    Cfg.ChannelNum    = SPI_DMA_CH;
+    Cfg.TransferSize  = n * 2;
+    Cfg.TransferWidth = 0;
+    Cfg.SrcMemAddr    = (uint32_t)pBuf;
+    Cfg.DstMemAddr    = 0;
+    Cfg.TransferType  = GPDMA_TRANSFERTYPE_M2P;
+    Cfg.SrcConn       = 0;
+    Cfg.DstConn       = GPDMA_CONN_SSP1_Tx;
+    Cfg.DMALLI        = 0;
+    GPDMA_Setup(&Cfg);
+    GPDMA_ChannelCmd(SPI_DMA_CH, ENABLE);
+
+    _DmaBuf ^= 1;
+    NumWords -= n;
+  }
+  LCD_STAT_LEAVE();
 }
 
 /*******************************************************************************
@@ -125,6 +213,10 @@ void LCD_X_SPI_WriteM01(U16 * pData, int NumWords)
 *******************************************************************************/
 void LCD_X_SPI_ReadM01(U16 * pData, int NumWords)
 {
+  LCD_STAT_ENTER();
+  LCD_STAT_ADD(WordsRead, NumWords);
+  LCD_STAT_ADD(CsCycles, 1);
+  spi_data_close();
   LCD_CS(0);
   spi_tran_fifo(SPI_START | SPI_RD | SPI_DATA);			/* Read: RS = 1, RW = 1 */
   spi_tran_fifo(0);										/* Dummy byte 1 */
@@ -135,6 +227,7 @@ void LCD_X_SPI_ReadM01(U16 * pData, int NumWords)
   }
   while(LPC_SSP1->SR & (1<<4));							/* wait until done */
   LCD_CS(1);
+  LCD_STAT_LEAVE();
 }
 
 /*******************************************************************************
@@ -144,6 +237,7 @@ void LCD_X_SPI_ReadM01(U16 * pData, int NumWords)
 *******************************************************************************/
 __inline void wr_cmd (unsigned char cmd)
 {
+  LCD_STAT_ADD(CsCycles, 1);
   LCD_CS(0);
   spi_tran_fifo(SPI_START | SPI_WR | SPI_INDEX);		/* Write : RS = 0, RW = 0 */
   spi_tran_fifo(0);
@@ -159,6 +253,7 @@ __inline void wr_cmd (unsigned char cmd)
 *******************************************************************************/
 __inline void wr_dat (unsigned short dat)
 {
+  LCD_STAT_ADD(CsCycles, 1);
   LCD_CS(0);
   spi_tran_fifo(SPI_START | SPI_WR | SPI_DATA);			/* Write : RS = 1, RW = 0 */
   spi_tran_fifo((dat >>   8));							/* Write D8..D15 */
@@ -195,4 +290,50 @@ __inline void spi_tran_fifo (unsigned char byte)
   LPC_SSP1->DR = byte;
 }
 
+/*******************************************************************************
+* Power the GPDMA and reset channel SPI_DMA_CH. GPDMA_Init would reset all     *
+* eight channels, including ones other drivers may have running                *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+static void spi_dma_init (void)
+{
+  LPC_SC->PCONP |= PCONP_PCGPDMA;
+  SPI_DMA_CHREG->DMACCConfig = 0;
+  LPC_GPDMA->DMACIntTCClear  = (1 << SPI_DMA_CH);
+  LPC_GPDMA->DMACIntErrClr   = (1 << SPI_DMA_CH);
+}
+
+/*******************************************************************************
+* Wait until the DMA channel has moved its last byte into the Tx FIFO          *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+static void spi_dma_wait (void)
+{
+  while(LPC_GPDMA->DMACEnbldChns & (1 << SPI_DMA_CH));	/* channel disables itself at TC */
+  LPC_GPDMA->DMACIntTCClear = (1 << SPI_DMA_CH);
+}
+
+/*******************************************************************************
+* Close a data write left open by LCD_X_SPI_WriteM01: wait for the DMA and the *
+* last bits on the wire, then CS high. Called before every other access        *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+static void spi_data_close (void)
+{
+  uint8_t Dummy;
+
+  if(!_DataOpen)
+    return;
+  spi_dma_wait();
+  while(LPC_SSP1->SR & SSP_BSY);						/* wait until done */
+  LCD_CS(1);
+  while(LPC_SSP1->SR & (1<<2))
+    Dummy = LPC_SSP1->DR;								/* drop what came in while sending */
+  LPC_SSP1->ICR = 1;									/* and the Rx overrun it caused */
+  _DataOpen = 0;
+}
+
 /*************************** End of file ****************************/